@@ -2,5 +2,15 @@
 
 from .spec_parser import get_xml_root, parse_spec
 from .function_ids import generate_function_ids, update_function_ids, apply_function_ids
-from .bindings import collect_modifiable_bindings, apply_modifiable_bindings, BindingLoop
+from .bindings import collect_modifiable_bindings, apply_modifiable_bindings, apply_output_params, apply_two_call_params, BindingLoop
+from .quantization import apply_quantization
+from .flat_structs import apply_flat_structs
+from .packed_calls import apply_packed_calls
+from .pipelined_calls import apply_pipelined_calls
+from .oneway_calls import apply_oneway_calls
+from .query_cache import apply_query_cache
+from .sampled_calls import apply_sampled_calls
+from .action_states import apply_action_states
+from .frame_loop import apply_frame_loop
+from .extension_subset import load_extension_profiles, parse_extension_list, resolve_extensions, apply_extension_subset
 from .struct_fuzzer import RandomStructGenerator
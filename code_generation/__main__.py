@@ -14,6 +14,21 @@ from . import (
     update_function_ids,
     apply_function_ids,
     apply_modifiable_bindings,
+    apply_output_params,
+    apply_two_call_params,
+    apply_quantization,
+    apply_flat_structs,
+    apply_packed_calls,
+    apply_pipelined_calls,
+    apply_oneway_calls,
+    apply_query_cache,
+    apply_sampled_calls,
+    apply_action_states,
+    apply_frame_loop,
+    load_extension_profiles,
+    parse_extension_list,
+    resolve_extensions,
+    apply_extension_subset,
     RandomStructGenerator
 )
 
@@ -21,6 +36,8 @@ parser = argparse.ArgumentParser(description="Generate serialization, deserializ
 parser.add_argument("openxr_spec_path", help="Path to the xr.xml file for the OpenXR spec")
 parser.add_argument("--project_root", default=".", type=str, help="Path to the xrtransport project folder")
 parser.add_argument("--fuzzer-seed", default=1337, type=int, help="Numerical seed to use for the fuzzer")
+parser.add_argument("--extensions", default=None, type=str, help="Only generate code for these extensions and the ones their structs need. Either a comma separated list of extension names or a profile from extension_profiles.json. Default is all extensions.")
+parser.add_argument("--print-extensions", action="store_true", help="Print the extensions selected by --extensions, one per line, and exit without generating anything")
 parser.add_argument("--regenerate-function-ids", action="store_true", help="Regenerate function ids from spec from scratch. Only use this for a full regenerate. Default behavior already accounts for changes in the spec.")
 args = parser.parse_args()
 
@@ -28,12 +45,25 @@ xr_xml_path = args.openxr_spec_path
 project_root = args.project_root
 fuzzer_seed = args.fuzzer_seed
 should_regenerate_function_ids = args.regenerate_function_ids
+extensions_arg = args.extensions
 
 random.seed(fuzzer_seed)
 
 xml_root = get_xml_root(xr_xml_path)
 spec = parse_spec(xml_root)
 
+selected_extensions = None
+if extensions_arg is not None:
+    profiles = load_extension_profiles(project_root)
+    selected_extensions = resolve_extensions(spec, parse_extension_list(extensions_arg, profiles))
+
+if args.print_extensions:
+    if selected_extensions is None:
+        selected_extensions = [ext_name for ext_name in spec.extensions if ext_name]
+    for ext_name in selected_extensions:
+        print(ext_name)
+    sys.exit(0)
+
 # Update/regenerate function ids and save
 function_ids_path = os.path.join(project_root, "function_ids.json")
 
@@ -54,6 +84,32 @@ apply_function_ids(spec, function_ids)
 
 apply_modifiable_bindings(spec)
 
+apply_output_params(spec)
+
+apply_two_call_params(spec)
+
+apply_quantization(spec)
+
+apply_flat_structs(spec)
+
+apply_packed_calls(spec)
+
+apply_pipelined_calls(spec)
+
+apply_oneway_calls(spec)
+
+apply_query_cache(spec)
+
+apply_sampled_calls(spec)
+
+apply_action_states(spec)
+
+apply_frame_loop(spec)
+
+# last, so that ids and extension bits don't depend on the selection
+if selected_extensions is not None:
+    apply_extension_subset(spec, selected_extensions)
+
 template_config = [
     ("client/rpc_header.mako", "src/client/rpc.h"),
     ("client/rpc_impl.mako", "src/client/rpc.cpp"),
@@ -61,14 +117,22 @@ template_config = [
     ("server/function_dispatch_header.mako", "src/server/function_dispatch.h"),
     ("server/function_dispatch_impl.mako", "src/server/function_dispatch.cpp"),
     ("server/function_loader.mako", "include/xrtransport/server/function_loader.h"),
+    ("structs/struct_index.mako", "include/xrtransport/serialization/struct_index.h"),
     ("structs/struct_size.mako", "src/common/serialization/struct_size.cpp"),
     ("structs/deserializer_header.mako", "include/xrtransport/serialization/deserializer.h"),
     ("structs/deserializer_impl.mako", "src/common/serialization/deserializer.cpp"),
     ("structs/serializer_header.mako", "include/xrtransport/serialization/serializer.h"),
     ("structs/serializer_impl.mako", "src/common/serialization/serializer.cpp"),
+    ("structs/packed_calls.mako", "include/xrtransport/serialization/packed_calls.h"),
+    ("structs/struct_tables.mako", "src/common/serialization/struct_tables.cpp"),
     ("extensions/enabled_extensions.mako", "include/xrtransport/extensions/enabled_extensions.h"),
     ("extensions/extension_functions.mako", "include/xrtransport/extensions/extension_functions.h"),
-    ("test/serialization_tests.mako", "test/serialization/fuzzer.cpp", {"struct_generator": RandomStructGenerator(spec)})
+    ("test/serialization_tests.mako", "test/serialization/fuzzer.cpp", {"struct_generator": RandomStructGenerator(spec)}),
+    # separate generator so that the fuzzer output doesn't depend on the benchmarks
+    ("test/serialization_benchmarks.mako", "test/serialization/benchmarks.cpp", {"struct_generator": RandomStructGenerator(
+        spec, rng=random.Random(fuzzer_seed), nullptr_chance=0.0, next_nullptr_chance=1.0)}),
+    ("test/struct_tables_tests.mako", "test/serialization/struct_tables_tests.cpp", {"struct_generator": RandomStructGenerator(
+        spec, rng=random.Random(fuzzer_seed))}),
 ]
 
 comment_template = """/*
@@ -0,0 +1,49 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# The function that updates the states of actions, and the functions that query them. The client sends
+# the queries made since the last sync in one batch with the next xrSyncActions, and answers the ones
+# that match from their responses until the sync after it (see src/client/action_states.h).
+SYNC_FUNCTION = "xrSyncActions"
+ACTION_STATE_FUNCTIONS = [
+    "xrGetActionStateBoolean",
+    "xrGetActionStateFloat",
+    "xrGetActionStateVector2f",
+    "xrGetActionStatePose",
+]
+
+# Handles whose destruction drops the snapshots, since queries may refer to them
+ACTION_STATE_OWNER_TYPES = ["XrInstance", "XrSession", "XrActionSet", "XrAction"]
+
+def apply_action_states(spec):
+    """Sets function.action_state to "sync" for SYNC_FUNCTION, "query" for the functions in
+    ACTION_STATE_FUNCTIONS and None for all others, function.action_state_inputs to the number of params
+    before the outputs, and function.clears_action_states for the functions that destroy an owner
+
+    Requires apply_two_call_params, apply_pipelined_calls, apply_oneway_calls, apply_query_cache and
+    apply_sampled_calls.
+    """
+    for function in spec.functions:
+        function.action_state = None
+        function.action_state_inputs = 0
+        function.clears_action_states = function.name.startswith("xrDestroy") and len(function.params) == 1 \
+            and function.params[0].type in ACTION_STATE_OWNER_TYPES
+        if function.name == SYNC_FUNCTION:
+            function.action_state = "sync"
+        elif function.name in ACTION_STATE_FUNCTIONS:
+            function.action_state = "query"
+        else:
+            continue
+        if function.two_call or function.pipelined or function.oneway or function.cached or function.sampled:
+            raise ValueError(f"{function.name} is an action state function but has its own way of calling")
+        if not function.params or function.params[0].type != "XrSession" or function.params[0].pointer:
+            raise ValueError(f"{function.name} is an action state function but doesn't take a session")
+        # queries are matched on the inputs, the outputs only have to have the same shape
+        outputs = [
+            index for index, param in enumerate(function.params)
+            if param.pointer and not (param.qualifier and "const" in param.qualifier.split())
+        ]
+        if function.action_state == "sync" and outputs:
+            raise ValueError(f"{function.name} syncs actions but has outputs")
+        if outputs and outputs != list(range(outputs[0], len(function.params))):
+            raise ValueError(f"{function.name} is an action state function but its outputs aren't its last params")
+        function.action_state_inputs = outputs[0] if outputs else len(function.params)
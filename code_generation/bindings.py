@@ -1,12 +1,14 @@
 # SPDX-License-Identifier: LGPL-3.0-or-later
 
 class Binding:
-    def __init__(self, type, binding_str, param, loops=(), len=None):
+    def __init__(self, type, binding_str, param, loops=(), len=None, count_output=None):
         self.type = type
         self.binding_str = binding_str
         self.param = param
         self.loops = loops
         self.len = len
+        # for arrays of the two-call idiom, the param the runtime writes the element count to
+        self.count_output = count_output
 
 class BindingLoop:
     def __init__(self, base, end, var):
@@ -129,7 +131,93 @@ def collect_modifiable_bindings(param, find_struct, binding_prefix="", decay_arr
     _collect_modifiable_bindings(first_binding, binding_prefix, param, (), find_struct, results, decay_array=decay_array)
     return results
 
+def _find_count_output(binding, function):
+    """Finds the count output param of a two-call idiom array param, e.g. viewCountOutput for views
+
+    Only arrays that are function params are linked, arrays in struct members are sent in full. Char
+    buffers are left out, they are sent as strings, which already stop at the terminator.
+    """
+    if binding.type not in ("sized_ptr", "xr_array") or binding.loops or binding.param.type == "char":
+        return None
+    if not binding.len.endswith("CapacityInput"):
+        return None
+    count_name = binding.len[:-len("CapacityInput")] + "CountOutput"
+    for param in function.params:
+        if param.name == count_name and param.pointer == "*":
+            return count_name
+    return None
+
 def apply_modifiable_bindings(spec):
     for function in spec.functions:
         for param in function.params:
-            function.modifiable_bindings += collect_modifiable_bindings(param, spec.find_struct, decay_array=True)
\ No newline at end of file
+            function.modifiable_bindings += collect_modifiable_bindings(param, spec.find_struct, decay_array=True)
+        for binding in function.modifiable_bindings:
+            binding.count_output = _find_count_output(binding, function)
+
+def _has_only_outputs(members, find_struct):
+    for member in members:
+        # capacities and the arrays they describe are filled in by the application
+        if member.pointer or member.name.endswith("CapacityInput"):
+            return False
+        struct = find_struct(member.type)
+        if struct and (struct.xr_type or struct.header or not _has_only_outputs(struct.members, find_struct)):
+            return False
+    return True
+
+def is_output_param(param, find_struct):
+    """Whether a function parameter is only written to by the runtime
+
+    The contents of these are never read, so the client only needs to send their length, plus the type
+    and next chain of each element if they are XR structs. An output struct with pointers or capacities
+    in it is an input as well, so it is sent in full.
+    """
+    const = param.qualifier and "const" in param.qualifier.split()
+    if param.pointer != "*" or const or param.array or param.type == "void":
+        return False
+    if param.len and (param.len == "null-terminated" or "," in param.len):
+        return False
+    struct = find_struct(param.type)
+    if not struct:
+        return True
+    if struct.header or struct.custom:
+        return False
+    members = struct.members[2:] if struct.xr_type else struct.members
+    return _has_only_outputs(members, find_struct)
+
+def apply_output_params(spec):
+    """Sets param.output on the function parameters that are only written to by the runtime"""
+    for function in spec.functions:
+        for param in function.params:
+            param.output = is_output_param(param, spec.find_struct)
+
+def find_two_call_params(function):
+    """Finds the capacity, count output and array params of a function whose only output is a two-call
+    idiom array of pure output elements, see src/client/two_call_cache.h
+
+    Char buffers are left out, they aren't cut to the count output without string interning.
+
+    Returns:
+        tuple[XrParam, XrParam, XrParam] | None
+    """
+    outputs = [
+        param for param in function.params
+        if param.pointer == "*" and not (param.qualifier and "const" in param.qualifier.split())
+    ]
+    if len(outputs) != 2:
+        return None
+    for array in outputs:
+        if not getattr(array, "output", False) or array.type == "char":
+            continue
+        if not array.len or not array.len.endswith("CapacityInput"):
+            continue
+        count_name = array.len[:-len("CapacityInput")] + "CountOutput"
+        count = next((param for param in outputs if param.name == count_name), None)
+        capacity = next((param for param in function.params if param.name == array.len), None)
+        if count and capacity:
+            return capacity, count, array
+    return None
+
+def apply_two_call_params(spec):
+    """Sets function.two_call to the result of find_two_call_params for every function"""
+    for function in spec.functions:
+        function.two_call = find_two_call_params(function)
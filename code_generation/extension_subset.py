@@ -0,0 +1,98 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+import json
+import os
+import sys
+
+def load_extension_profiles(project_root):
+    """Named extension lists from extension_profiles.json, e.g. quest-compat"""
+    with open(os.path.join(project_root, "extension_profiles.json"), "r") as profiles_file:
+        profiles = json.load(profiles_file)
+    return {name: profile["extensions"] for name, profile in profiles.items()}
+
+def parse_extension_list(value, profiles):
+    """Parses a profile name or a comma or semicolon separated list of extension names"""
+    names = []
+    for item in value.replace(";", ",").split(","):
+        item = item.strip()
+        if not item:
+            continue
+        if item in profiles:
+            names += profiles[item]
+        else:
+            names.append(item)
+    return names
+
+def _struct_dependencies(spec, ext_name, owners):
+    """Extensions whose structs are used by the structs and functions of an extension, but that the
+    extension doesn't require itself. Each entry is the set of extensions that provide the struct."""
+    extension = spec.extensions[ext_name]
+    own_structs = {struct.name for struct in extension.structs}
+    pending = [param.type for function in extension.functions for param in function.params]
+    pending += [member.type for struct in extension.structs for member in struct.members]
+    seen = set()
+    dependencies = []
+    while pending:
+        type_name = pending.pop()
+        if type_name in seen:
+            continue
+        seen.add(type_name)
+        struct = spec.find_struct(type_name)
+        if not struct:
+            continue # not a struct
+        pending += [member.type for member in struct.members]
+        if type_name in own_structs or None in owners[type_name]:
+            continue # generated together with the extension, or part of the core spec
+        dependencies.append(owners[type_name])
+    return dependencies
+
+def resolve_extensions(spec, requested):
+    """Adds the extensions that the requested ones need for their structs to be serializable
+
+    A struct may be provided by several extensions, in which case one that is already selected is
+    preferred, and the first one by name otherwise.
+
+    Returns:
+        list[str]: sorted names of the requested extensions and their transitive dependencies
+    """
+    owners = {}
+    for ext_name, extension in spec.extensions.items():
+        for struct in extension.structs or ():
+            owners.setdefault(struct.name, set()).add(ext_name)
+
+    selected = set()
+    pending = []
+    for ext_name in requested:
+        if ext_name not in spec.extensions or ext_name is None:
+            print(f"Warning! {ext_name} is not an extension with anything to generate, ignoring it", file=sys.stderr)
+            continue
+        pending.append(ext_name)
+
+    while pending:
+        ext_name = pending.pop()
+        if ext_name in selected:
+            continue
+        selected.add(ext_name)
+        for providers in _struct_dependencies(spec, ext_name, owners):
+            if not providers & selected:
+                pending.append(min(providers))
+
+    return sorted(selected)
+
+def apply_extension_subset(spec, ext_names):
+    """Drops every extension except ext_names from the spec, so that no code is generated for them.
+    The core spec is always kept.
+
+    Must run after the other passes: function ids and QUANTIZED_* extension bits are assigned from
+    the full spec, so that builds with different subsets stay compatible on the wire.
+    """
+    keep = set(ext_names)
+    spec.extensions = {
+        ext_name: extension
+        for ext_name, extension in spec.extensions.items()
+        if ext_name is None or ext_name in keep
+    }
+    spec.flat_struct_groups = [
+        group for group in spec.flat_struct_groups
+        if not group.extensions or keep.intersection(group.extensions)
+    ]
@@ -0,0 +1,50 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+class FlatStructGroup:
+    def __init__(self, extensions, structs):
+        # empty if the structs are part of the core spec
+        self.extensions = extensions
+        self.structs = structs
+
+    def guard(self):
+        return " || ".join(f"defined(XRTRANSPORT_EXT_{extension})" for extension in self.extensions)
+
+def _is_flat_candidate(struct):
+    """A plain (non-XR) struct whose generated serializer writes every member as raw bytes, in order.
+    Member structs and padding are checked by the compiler, see is_flat in deserializer.h"""
+    if struct.header or struct.xr_type or struct.custom or not struct.members:
+        return False
+    for member in struct.members:
+        # pointers are written as arrays, times are converted between clocks, strings may be interned
+        if member.pointer or member.type == "XrTime" or member.type == "char":
+            return False
+    return True
+
+def apply_flat_structs(spec):
+    """Finds the structs that may be used directly from a received message instead of being copied
+
+    A struct can be required by several extensions, so its is_flat definition is guarded by all of
+    them, or not at all if it is part of the core spec. Consecutive structs with the same guard are
+    grouped.
+
+    Sets:
+        spec.flat_structs (set[str]): names of the candidate structs
+        spec.flat_struct_groups (list[FlatStructGroup]): candidate structs grouped by guard, each struct
+            appears once
+    """
+    extensions = {}
+    for ext_name, extension in spec.extensions.items():
+        for struct in extension.structs or ():
+            if _is_flat_candidate(struct):
+                extensions.setdefault(struct.name, (struct, set()))[1].add(ext_name)
+
+    groups = []
+    for struct, ext_names in extensions.values():
+        guard = [] if None in ext_names else sorted(ext_names)
+        if groups and groups[-1].extensions == guard:
+            groups[-1].structs.append(struct)
+        else:
+            groups.append(FlatStructGroup(guard, [struct]))
+
+    spec.flat_structs = set(extensions)
+    spec.flat_struct_groups = groups
@@ -0,0 +1,32 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Functions whose public stubs go through the client's FrameLoop when XRTP_FEATURE_FRAME_LOOP_FUSION is
+# negotiated (see src/client/frame_loop.h), and the FrameLoop method that handles each of them. The
+# method gets the params of the function and the generated stub that calls the server.
+#
+# xrBeginFrame is sent as a oneway call with the feature instead, see oneway_calls.py.
+#
+# The destroy functions of the trackers in sampled calls (see sampled_calls.py) go through destroy_tracker.
+FRAME_LOOP_FUNCTIONS = {
+    "xrWaitFrame": "wait_frame",
+    "xrEndFrame": "end_frame",
+    "xrEndSession": "end_session",
+    "xrDestroySession": "destroy_session",
+    "xrLocateViews": "locate_views",
+    "xrLocateSpace": "locate_space",
+    "xrDestroySpace": "destroy_space",
+}
+
+def apply_frame_loop(spec):
+    """Sets function.frame_loop to the FrameLoop method for the functions in FRAME_LOOP_FUNCTIONS and the
+    destroy functions of sampled trackers, None for all others
+
+    Requires apply_two_call_params, apply_pipelined_calls, apply_query_cache and apply_sampled_calls.
+    """
+    tracker_types = {function.params[0].type for function in spec.functions if function.sampled}
+    for function in spec.functions:
+        function.frame_loop = FRAME_LOOP_FUNCTIONS.get(function.name)
+        if function.name.startswith("xrDestroy") and len(function.params) == 1 and function.params[0].type in tracker_types:
+            function.frame_loop = "destroy_tracker"
+        if function.frame_loop and (function.two_call or function.pipelined or function.cached):
+            raise ValueError(f"{function.name} is in FRAME_LOOP_FUNCTIONS but has its own way of calling")
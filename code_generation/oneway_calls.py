@@ -0,0 +1,56 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Functions that only return a result, which the client sends without waiting for the server when
+# XRTP_FEATURE_ONEWAY_CALLS is negotiated, and reports XR_SUCCESS for. If one of them fails, the server
+# sends an XRTP_MSG_DEFERRED_ERROR, which the next synchronous call reports (see deferred_errors.h).
+#
+# Besides this list, every xrDestroy* function that has no outputs is oneway, except for
+# xrDestroyInstance, which the server handles itself. Every function in the list has to be without
+# outputs (see _has_outputs), the generator fails otherwise.
+ONEWAY_FUNCTIONS = [
+    "xrApplyHapticFeedback",
+    "xrStopHapticFeedback",
+    "xrSessionBeginDebugUtilsLabelRegionEXT",
+    "xrSessionEndDebugUtilsLabelRegionEXT",
+    "xrSessionInsertDebugUtilsLabelEXT",
+    "xrSetDebugUtilsObjectNameEXT",
+    "xrPerfSettingsSetPerformanceLevelEXT",
+]
+
+NEVER_ONEWAY_FUNCTIONS = [
+    "xrDestroyInstance",
+]
+
+# Functions that are only oneway with another feature, which replaces XRTP_FEATURE_ONEWAY_CALLS for them
+ONEWAY_FEATURE_FUNCTIONS = {
+    # see src/client/frame_loop.h
+    "xrBeginFrame": "XRTP_FEATURE_FRAME_LOOP_FUSION",
+}
+
+def _is_const(param):
+    return bool(param.qualifier) and "const" in param.qualifier.split()
+
+def _has_outputs(function):
+    """Whether the function writes anything but its result"""
+    if function.modifiable_bindings:
+        return True
+    return any(param.pointer and not _is_const(param) for param in function.params)
+
+def apply_oneway_calls(spec):
+    """Sets function.oneway to the XRTP_FEATURE_* that makes the function oneway, None if it never is
+
+    Applies to the functions in ONEWAY_FUNCTIONS and ONEWAY_FEATURE_FUNCTIONS, and the xrDestroy* functions
+    without outputs.
+
+    Requires apply_modifiable_bindings and apply_pipelined_calls.
+    """
+    for function in spec.functions:
+        function.oneway = None
+        if function.name in NEVER_ONEWAY_FUNCTIONS or function.pipelined:
+            continue
+        if function.name in ONEWAY_FUNCTIONS or function.name in ONEWAY_FEATURE_FUNCTIONS:
+            if _has_outputs(function):
+                raise ValueError(f"{function.name} is oneway but has outputs")
+            function.oneway = ONEWAY_FEATURE_FUNCTIONS.get(function.name, "XRTP_FEATURE_ONEWAY_CALLS")
+        elif function.name.startswith("xrDestroy") and not _has_outputs(function):
+            function.oneway = "XRTP_FEATURE_ONEWAY_CALLS"
@@ -0,0 +1,151 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Hot functions that are sent as one fixed layout frame instead of being serialized param by param, see
+# packed_calls.h. Every one of them has to be packable (see _pack_function), the generator fails
+# otherwise. Functions of extensions that aren't in the spec are skipped.
+PACKED_FUNCTIONS = [
+    "xrLocateSpace",
+    "xrGetActionStateBoolean",
+    "xrGetActionStateFloat",
+    "xrGetActionStateVector2f",
+    "xrGetActionStatePose",
+    "xrApplyHapticFeedback",
+    "xrStopHapticFeedback",
+    "xrAcquireSwapchainImage",
+    "xrWaitSwapchainImage",
+    "xrReleaseSwapchainImage",
+    "xrGetDisplayRefreshRateFB",
+    "xrRequestDisplayRefreshRateFB",
+]
+
+class PackedField:
+    """A field of a Request_ or Response_ struct"""
+    def __init__(self, name, type_, member=None):
+        self.name = name
+        self.type = type_
+        # member of the param's struct that the field holds, or None if it holds the param itself
+        self.member = member
+        # times are converted between the clocks of the client and server
+        self.time = type_ == "XrTime"
+
+class PackedParam:
+    def __init__(self, param, struct, header, kind, fields):
+        self.param = param
+        # struct that the param points to, which is the child struct for header params
+        self.struct = struct
+        # the param is declared as a header struct, e.g. XrHapticBaseHeader
+        self.header = header
+        # "value", "input" or "output"
+        self.kind = kind
+        self.fields = fields
+
+    def fallback_condition(self):
+        """C++ condition under which the param can't be packed and the generic encoding is used"""
+        name = self.param.name
+        if self.kind == "value":
+            return None
+        if self.struct and self.struct.xr_type:
+            return f"!{name} || {name}->type != {self.struct.xr_type} || {name}->next"
+        return f"!{name}"
+
+    def server_argument(self, virtual_handle_types=()):
+        """The argument passed to the runtime by the server handler, with virtual handles resolved"""
+        name = self.param.name
+        if self.kind == "value":
+            if self.param.type in virtual_handle_types:
+                return f"resolve_handle(_request->{name})"
+            return f"_request->{name}"
+        if self.header:
+            return f"reinterpret_cast<const {self.param.type}*>(&{name})"
+        return f"&{name}"
+
+class PackedCall:
+    def __init__(self, params):
+        self.params = params
+
+    def request_fields(self):
+        return [field for param in self.params if param.kind != "output" for field in param.fields]
+
+    def response_fields(self):
+        return [field for param in self.params if param.kind == "output" for field in param.fields]
+
+    def fallback_conditions(self):
+        return [condition for condition in (param.fallback_condition() for param in self.params) if condition]
+
+def _is_packable_type(type_, spec):
+    """Plain values that are sent as their raw bytes: numbers, enums, flags, handles and flat structs"""
+    if type_ in ("void", "char") or type_.startswith("PFN"):
+        return False
+    struct = spec.find_struct(type_)
+    return not struct or struct.name in spec.flat_structs
+
+def _is_packable_member(member, spec):
+    return not member.pointer and not member.array and not member.len and _is_packable_type(member.type, spec)
+
+def _struct_fields(param, struct, spec):
+    """Fields for the members of a struct, or None if one of them can't be packed"""
+    if struct.custom or struct.header:
+        return None
+    members = struct.members[2:] if struct.xr_type else struct.members
+    if not all(_is_packable_member(member, spec) for member in members):
+        return None
+    return [PackedField(f"{param.name}_{member.name}", member.type, member) for member in members]
+
+def _pack_param(param, spec):
+    if not param.pointer:
+        if param.array or not _is_packable_type(param.type, spec):
+            return None
+        return PackedParam(param, None, False, "value", [PackedField(param.name, param.type)])
+
+    if param.pointer != "*" or param.array or param.len:
+        return None
+    const = param.qualifier and "const" in param.qualifier.split()
+    if const:
+        kind = "input"
+    elif getattr(param, "output", False):
+        kind = "output"
+    else:
+        return None
+
+    struct = spec.find_struct(param.type)
+    if not struct:
+        if not _is_packable_type(param.type, spec):
+            return None
+        return PackedParam(param, None, False, kind, [PackedField(param.name, param.type)])
+
+    header = bool(struct.header)
+    if header:
+        # headers can only be packed as their one child struct without pointers, e.g. XrHapticVibration
+        children = [s for s in spec.structs if s.parent == struct.name and _struct_fields(param, s, spec) is not None]
+        if kind != "input" or len(children) != 1:
+            return None
+        struct = children[0]
+    fields = _struct_fields(param, struct, spec)
+    if fields is None:
+        return None
+    return PackedParam(param, struct, header, kind, fields)
+
+def _pack_function(function, spec):
+    """Returns a PackedCall if every param of the function is a plain value, or a pointer to a single
+    plain value or struct without pointers that is either an input or a pure output"""
+    params = [_pack_param(param, spec) for param in function.params]
+    if any(param is None for param in params):
+        return None
+    return PackedCall(params)
+
+def apply_packed_calls(spec):
+    """Sets function.packed to a PackedCall for the functions in PACKED_FUNCTIONS, None for all others
+
+    Requires apply_output_params and apply_flat_structs.
+
+    Sets:
+        spec.packed_functions (list[XrFunction]): the packed functions, in spec order
+    """
+    for function in spec.functions:
+        function.packed = None
+        if function.name not in PACKED_FUNCTIONS:
+            continue
+        function.packed = _pack_function(function, spec)
+        if not function.packed:
+            raise ValueError(f"{function.name} is in PACKED_FUNCTIONS but can't be packed")
+    spec.packed_functions = [function for function in spec.functions if function.packed]
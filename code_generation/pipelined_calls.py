@@ -0,0 +1,50 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Functions that create an object at startup, which the client returns a virtual handle for without waiting
+# for the server when XRTP_FEATURE_PIPELINED_CREATION is negotiated, see virtual_handles.h. Every one of
+# them has to return its handle in a pure output param (see _pipelined_handle), the generator fails
+# otherwise.
+#
+# xrStringToPath isn't one of them: XrPath is a plain uint64_t that is sent raw in many structs, so
+# the server couldn't tell virtual paths from any other number.
+PIPELINED_FUNCTIONS = [
+    "xrCreateActionSet",
+    "xrCreateAction",
+    "xrCreateActionSpace",
+    "xrCreateReferenceSpace",
+]
+
+def _is_const(param):
+    return bool(param.qualifier) and "const" in param.qualifier.split()
+
+def _pipelined_handle(function, spec):
+    """The last param of the function if it is a pure output handle and the only output"""
+    if not function.params:
+        return None
+    *inputs, handle = function.params
+    if handle.pointer != "*" or handle.array or handle.len or not getattr(handle, "output", False):
+        return None
+    if spec.find_struct(handle.type) or handle.type in ("void", "char"):
+        return None
+    if any(param.pointer and not _is_const(param) for param in inputs):
+        return None
+    return handle
+
+def apply_pipelined_calls(spec):
+    """Sets function.pipelined to the output handle param for the functions in PIPELINED_FUNCTIONS, None
+    for all others
+
+    Requires apply_output_params.
+
+    Sets:
+        spec.virtual_handle_types (set[str]): types of the handles that the client may send virtual
+    """
+    spec.virtual_handle_types = set()
+    for function in spec.functions:
+        function.pipelined = None
+        if function.name not in PIPELINED_FUNCTIONS:
+            continue
+        function.pipelined = _pipelined_handle(function, spec)
+        if not function.pipelined:
+            raise ValueError(f"{function.name} is in PIPELINED_FUNCTIONS but can't be pipelined")
+        spec.virtual_handle_types.add(function.pipelined.type)
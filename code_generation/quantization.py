@@ -0,0 +1,116 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Float arrays with these member names hold blend shape weights or confidences in [0, 1]
+QUANTIZED_WEIGHT_MEMBERS = {"weights", "confidences"}
+
+# Member types that a quantized element struct may consist of, mapped to the QuantizedWriter and
+# QuantizedReader method suffix used for them
+QUANTIZED_MEMBER_CODECS = {
+    "XrPosef": "pose",
+    "XrVector3f": "vector",
+    "float": "float",
+}
+
+# Encoded size of each codec in bytes, must match quantization.h
+QUANTIZED_CODEC_SIZES = {
+    "flags": 1,
+    "pose": 12,
+    "vector": 6,
+    "float": 2,
+}
+
+class QuantizedMember:
+    def __init__(self, name, codec):
+        self.name = name
+        self.codec = codec
+
+class QuantizedStruct:
+    def __init__(self, struct, members):
+        self.struct = struct
+        self.members = members
+
+    def has_poses(self):
+        return any(member.codec == "pose" for member in self.members)
+
+    def encoded_size(self):
+        return sum(QUANTIZED_CODEC_SIZES[member.codec] for member in self.members)
+
+def _member_codec(member):
+    if member.pointer or member.array or member.len:
+        return None
+    if member.type.endswith("Flags"):
+        return "flags"
+    return QUANTIZED_MEMBER_CODECS.get(member.type)
+
+def _quantize_struct(struct):
+    """Returns a QuantizedStruct if every member of a plain (non-XR) struct has a quantized codec and
+    at least one of them is a pose or vector, e.g. XrHandJointLocationEXT or XrHandJointVelocityEXT"""
+    if struct.header or struct.xr_type or struct.custom:
+        return None
+    members = []
+    for member in struct.members:
+        codec = _member_codec(member)
+        if codec is None:
+            return None
+        members.append(QuantizedMember(member.name, codec))
+    if not any(member.codec in ("pose", "vector") for member in members):
+        return None
+    return QuantizedStruct(struct, members)
+
+def _owning_extensions(spec):
+    # structs can be required by several extensions, the one with the lowest number introduced them
+    owners = {}
+    core_structs = set()
+    for ext_name, extension in spec.extensions.items():
+        for struct in extension.structs or ():
+            if ext_name is None:
+                core_structs.add(struct.name)
+                continue
+            current = owners.get(struct.name)
+            if current is None or extension.number < spec.extensions[current].number:
+                owners[struct.name] = ext_name
+    for name in core_structs:
+        owners.pop(name, None)
+    return owners
+
+def apply_quantization(spec):
+    """Marks array members that can be sent quantized
+
+    An array member qualifies if it points to a struct made of flags, poses, vectors and floats (joint
+    and pose arrays), or if it is a float array of weights. Quantization is enabled per extension at
+    runtime, so each qualifying member is tagged with the extension that owns its containing struct.
+    Structs owned by the core spec are never quantized.
+
+    Sets:
+        spec.quantized_structs (dict[str, QuantizedStruct]): element structs of the qualifying members
+        spec.quantized_extensions (list[str]): extensions with quantizable arrays, the index is the bit
+            of the extension in the negotiated mask
+        member.quantized_extension (str): on each qualifying member, otherwise None
+    """
+    candidates = {}
+    for struct in spec.structs:
+        quantized = _quantize_struct(struct)
+        if quantized:
+            candidates[struct.name] = quantized
+
+    owners = _owning_extensions(spec)
+    quantized_structs = {}
+    quantized_extensions = set()
+    for struct in spec.structs:
+        owner = owners.get(struct.name)
+        for member in struct.members:
+            member.quantized_extension = None
+            if not owner or not member.pointer or not member.len or member.len == "null-terminated":
+                continue
+            if member.type in candidates:
+                quantized_structs[member.type] = candidates[member.type]
+            elif member.type != "float" or member.name not in QUANTIZED_WEIGHT_MEMBERS:
+                continue
+            member.quantized_extension = owner
+            quantized_extensions.add(owner)
+
+    if len(quantized_extensions) > 64:
+        raise ValueError("too many extensions with quantizable arrays for a 64 bit mask")
+
+    spec.quantized_structs = quantized_structs
+    spec.quantized_extensions = sorted(quantized_extensions)
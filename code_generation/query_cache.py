@@ -0,0 +1,40 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Functions that return the same data for the lifetime of the instance or session in their first param,
+# whose successful results the client keeps in its query cache (see src/client/query_cache.h).
+#
+# xrGetVulkanGraphicsRequirements2KHR isn't one of them, the Vulkan client module answers it itself.
+QUERY_CACHE_FUNCTIONS = [
+    "xrGetInstanceProperties",
+    "xrGetSystem",
+    "xrGetSystemProperties",
+    "xrEnumerateViewConfigurations",
+    "xrGetViewConfigurationProperties",
+    "xrEnumerateViewConfigurationViews",
+    "xrEnumerateEnvironmentBlendModes",
+    "xrEnumerateReferenceSpaces",
+    "xrEnumerateSwapchainFormats",
+    "xrGetVulkanGraphicsRequirementsKHR",
+]
+
+# Handles that cached results belong to
+QUERY_CACHE_OWNER_TYPES = ["XrInstance", "XrSession"]
+
+def apply_query_cache(spec):
+    """Sets function.cached to the owner param for the functions in QUERY_CACHE_FUNCTIONS, None for all
+    others, and function.clears_query_cache for the functions that destroy an owner
+
+    Requires apply_packed_calls, apply_pipelined_calls and apply_oneway_calls.
+    """
+    for function in spec.functions:
+        function.cached = None
+        function.clears_query_cache = function.name.startswith("xrDestroy") and bool(function.params) \
+            and function.params[0].type in QUERY_CACHE_OWNER_TYPES
+        if function.name not in QUERY_CACHE_FUNCTIONS:
+            continue
+        owner = function.params[0] if function.params else None
+        if not owner or owner.type not in QUERY_CACHE_OWNER_TYPES or owner.pointer:
+            raise ValueError(f"{function.name} is in QUERY_CACHE_FUNCTIONS but doesn't take an instance or session")
+        if function.packed or function.pipelined or function.oneway:
+            raise ValueError(f"{function.name} is in QUERY_CACHE_FUNCTIONS but has its own way of calling")
+        function.cached = owner
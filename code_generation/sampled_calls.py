@@ -0,0 +1,58 @@
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+# Functions that applications call for each of their trackers at the display time of every frame. With
+# XRTP_FEATURE_TRACKER_SAMPLING, the server makes these calls again at the display time of the next
+# frame, right after its speculative xrWaitFrame, and the client answers the calls that match from those
+# samples (see src/client/frame_loop.h).
+#
+# xrGetFacialExpressionsHTC isn't one of them: it takes no time and returns the latest expressions the
+# runtime has, which a sample taken at the start of the frame would only make older.
+SAMPLED_FUNCTIONS = [
+    "xrLocateHandJointsEXT",
+    "xrLocateBodyJointsFB",
+    "xrLocateBodyJointsBD",
+    "xrLocateBodyJointsHTC",
+    "xrGetEyeGazesFB",
+    "xrGetFaceExpressionWeights2FB",
+]
+
+def find_time_param(function, find_struct):
+    """Finds the const struct param with the time the function is called at
+
+    Returns:
+        XrParam | None
+    """
+    for param in function.params:
+        if param.pointer != "*" or not (param.qualifier and "const" in param.qualifier.split()):
+            continue
+        struct = find_struct(param.type)
+        if struct and any(member.name == "time" and member.type == "XrTime" for member in struct.members):
+            return param
+    return None
+
+def apply_sampled_calls(spec):
+    """Sets function.sampled to the param with the time for the functions in SAMPLED_FUNCTIONS, None for
+    all others, and function.sampled_inputs to the number of params before the outputs
+
+    Requires apply_two_call_params, apply_packed_calls, apply_pipelined_calls, apply_oneway_calls and
+    apply_query_cache.
+    """
+    for function in spec.functions:
+        function.sampled = None
+        function.sampled_inputs = 0
+        if function.name not in SAMPLED_FUNCTIONS:
+            continue
+        if function.two_call or function.packed or function.pipelined or function.oneway or function.cached:
+            raise ValueError(f"{function.name} is in SAMPLED_FUNCTIONS but has its own way of calling")
+        time_param = find_time_param(function, spec.find_struct)
+        if not time_param:
+            raise ValueError(f"{function.name} is in SAMPLED_FUNCTIONS but isn't called at a time")
+        # samples are matched on the inputs, the outputs only have to have the same shape
+        outputs = [
+            index for index, param in enumerate(function.params)
+            if param.pointer and not (param.qualifier and "const" in param.qualifier.split())
+        ]
+        if not outputs or outputs != list(range(outputs[0], len(function.params))):
+            raise ValueError(f"{function.name} is in SAMPLED_FUNCTIONS but its outputs aren't its last params")
+        function.sampled = time_param
+        function.sampled_inputs = outputs[0]
@@ -54,6 +54,8 @@ class XrStruct:
         self.xr_type_value = None
         self.members = members
         self.header = None
+        # header struct that this struct can be passed as, e.g. XrHapticBaseHeader
+        self.parent = None
         self.extension = None
         self.custom = False
     
@@ -264,6 +266,8 @@ def collect_structs(xml_root):
             struct.xr_type = xr_structure_type
             struct.xr_type_value = xr_structure_type_values[xr_structure_type]
 
+        struct.parent = type_tag.attrib.get("parentstruct")
+
         for member_tag in type_tag.findall("member"):
             member = parse_param(member_tag)
             struct.members.append(member)
@@ -99,11 +99,15 @@ class ValuePlan:
 
 # This stuff is very unwieldy to do in a Mako template, so it's defined here
 class RandomStructGenerator:
-    def __init__(self, spec):
+    def __init__(self, spec, rng=random, nullptr_chance=0.6, next_nullptr_chance=None):
+        # rng defaults to the global random module so that --fuzzer-seed applies
+        # next_nullptr_chance defaults to nullptr_chance
         self.spec = spec
+        self.rng = rng
         self.test_structs = [s for s in spec.test_structs if not s.custom and not s.header]
         self.test_xr_structs = [s for s in self.test_structs if s.xr_type]
-        self.nullptr_chance = 0.6
+        self.nullptr_chance = nullptr_chance
+        self.next_nullptr_chance = nullptr_chance if next_nullptr_chance is None else next_nullptr_chance
 
     def plan_member(self, type_name):
         struct = self.spec.find_struct(type_name)
@@ -116,7 +120,7 @@ class RandomStructGenerator:
         struct_plan = StructPlan(struct.name)
         if struct.xr_type:
             struct_plan.children["type"] = ValuePlan("XrStructureType", struct.xr_type)
-            if random.random() < self.nullptr_chance:
+            if self.rng.random() < self.next_nullptr_chance:
                 struct_plan.children["next"] = ValuePlan("void*", "nullptr")
             else:
                 next_xr_struct = self.choose_xr_struct()
@@ -126,16 +130,20 @@ class RandomStructGenerator:
             rest_members = struct.members[2:]
         else:
             rest_members = struct.members
-        
-        for member in rest_members:
+
+        self.plan_members(struct_plan, rest_members)
+        return struct_plan
+
+    def plan_members(self, struct_plan, members):
+        for member in members:
             if member.pointer:
-                if random.random() < self.nullptr_chance:
+                if self.rng.random() < self.nullptr_chance:
                     struct_plan.children[member.name] = ValuePlan(member.full_type(), "nullptr")
                     continue
                 
                 pointer_plan = PointerPlan(member.type)
                 if member.len:
-                    array_length = random.randint(1, 20)
+                    array_length = self.rng.randint(1, 20)
                     if member.len != "null-terminated":
                         # find the existing value plan for the member that specifies this member's length
                         # note that this will fail if the length-specifying member comes after, but I don't
@@ -159,25 +167,56 @@ class RandomStructGenerator:
                 struct_plan.children[member.name] = array_plan
             else:
                 struct_plan.children[member.name] = self.plan_member(member.type)
-        
-        return struct_plan
     
+    def can_plan_params(self, function):
+        """Whether plan_params can fill in every parameter of a function. Custom and header structs
+        have no plan, and the planner only supports single pointers whose length comes before them."""
+        seen = set()
+        def can_plan(params):
+            names = set()
+            for param in params:
+                if param.pointer and (param.pointer != "*" or param.array):
+                    return False
+                if param.len and param.len != "null-terminated" and param.len not in names:
+                    return False
+                names.add(param.name)
+                if param.is_next_ptr():
+                    continue
+                if param.type == "void":
+                    return False
+                struct = self.spec.find_struct(param.type)
+                if not struct or struct.name in seen:
+                    continue
+                if struct.custom or struct.header:
+                    return False
+                seen.add(struct.name)
+                if not can_plan(struct.members):
+                    return False
+            return True
+        return can_plan(function.params)
+
+    def plan_params(self, function, type_name):
+        """Plans the parameters of a function as the members of a struct called type_name"""
+        params_plan = StructPlan(type_name)
+        self.plan_members(params_plan, function.params)
+        return params_plan
+
     def plan_value(self, type_name):
         return ValuePlan(type_name, self.gen_random_value(type_name))
                         
     def gen_random_value(self, type_name):
         if type_name == "char":
-            return "'" + random.choice(string.ascii_letters + string.digits) + "'"
+            return "'" + self.rng.choice(string.ascii_letters + string.digits) + "'"
         # put in other special cases here
         # elif type_name == "...":
         else:
-            return f"({type_name}) {hex(random.randint(0, 2**64 - 1))}"
+            return f"({type_name}) {hex(self.rng.randint(0, 2**64 - 1))}"
     
     def choose_struct(self):
-        return random.choice(self.test_structs)
+        return self.rng.choice(self.test_structs)
     
     def choose_xr_struct(self):
-        return random.choice(self.test_xr_structs)
+        return self.rng.choice(self.test_xr_structs)
 
     def generate_plan(self, struct=None):
         if struct == None:
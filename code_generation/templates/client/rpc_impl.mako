@@ -4,10 +4,19 @@
 #include "rpc.h"
 #include "runtime.h"
 #include "synchronization.h"
+#include "two_call_cache.h"
+#include "query_cache.h"
+#include "action_states.h"
+#include "frame_loop.h"
 
 #include "xrtransport/transport/transport.h"
 #include "xrtransport/serialization/serializer.h"
 #include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/packed_calls.h"
+#include "xrtransport/serialization/virtual_handles.h"
 #include "xrtransport/time.h"
 #include "xrtransport/util.h"
 
@@ -25,8 +34,14 @@ static XrTime start_rpc_timer() {
     return get_time();
 }
 
-static void end_rpc_timer(XrTime start_time, XrDuration runtime_duration, std::string_view tag) {
+static void end_rpc_timer(XrTime start_time, XrDuration runtime_duration, MessageLockIn& msg_in, std::string_view tag) {
     XrTime end_time = get_time();
+    if (get_runtime().has_feature(XRTP_FEATURE_INBAND_TIMESTAMPS)) {
+        // server times the call was received and the response was sent
+        XrTime server_times[2]{};
+        asio::read(msg_in.buffer, asio::buffer(server_times, sizeof(server_times)));
+        get_runtime().get_clock_sync().add_sample(start_time, server_times[0], server_times[1], end_time);
+    }
     XrDuration total_duration = end_time - start_time;
     XrDuration rpc_duration = total_duration - runtime_duration;
     float duration_ms = (float)(rpc_duration) / 1000000;
@@ -36,27 +51,109 @@ static void end_rpc_timer(XrTime start_time, XrDuration runtime_duration, std::s
 }
 
 <%utils:for_grouped_functions args="function">\
-XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+<% fallback_conditions = function.packed.fallback_conditions() if function.packed else [] %>\
+% if function.oneway:
+static XrResult oneway_${function.signature()} try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = ${function.id};
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    % for param in function.params:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='s_ctx')}
+    % endfor
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if not function.packed or fallback_conditions:
+% if function.two_call:
+static XrResult uncached_${function.signature()} try {
+% elif function.packed:
+static XrResult unpacked_${function.signature()} try {
+% elif function.pipelined:
+static XrResult unpipelined_${function.signature()} try {
+% elif function.cached:
+static XrResult fetch_${function.signature()} try {
+% elif function.sampled:
+static XrResult unsampled_${function.signature()} try {
+% elif function.action_state:
+static XrResult unsynced_${function.signature()} try {
+% elif function.frame_loop:
+static XrResult unfused_${function.signature()} try {
+% else:
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+% endif
+    % if function.clears_query_cache:
+<% owner = function.params[0] %>\
+    // the runtime may reuse the handle value, see query_cache.h
+    if (QueryCache* query_cache = get_runtime().get_query_cache()) {
+        % if owner.type == "XrInstance":
+        query_cache->clear();
+        % else:
+        query_cache->clear(handle_value(${owner.name}));
+        % endif
+    }
+
+    % endif
+    % if function.clears_action_states:
+    // queries may refer to the handle, see action_states.h
+    if (ActionStates* action_states = get_runtime().get_action_states()) {
+        action_states->clear();
+    }
+
+    % endif
+    % if function.oneway and not function.packed:
+    if (get_runtime().has_feature(${function.oneway})) {
+        return oneway_${function.call()};
+    }
+
+    % endif
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = ${function.id};
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     % for param in function.params:
-    ${utils.serialize_member(param, binding_prefix='', ctx_var='s_ctx')}
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='s_ctx')}
     % endfor
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -66,8 +163,212 @@ XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
     ${utils.deserialize_binding(binding, ctx_var='d_ctx')}
     % endfor
 
-    end_rpc_timer(start_time, runtime_duration, "${function.name}");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "${function.name}");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if function.packed:
+<%
+    request_fields = function.packed.request_fields()
+    uses_time = any(field.time for param in function.packed.params for field in param.fields)
+%>\
+% if function.frame_loop:
+static XrResult unfused_${function.signature()} try {
+% elif function.action_state:
+static XrResult unsynced_${function.signature()} try {
+% else:
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+% endif
+    % if function.oneway:
+    if (get_runtime().has_feature(${function.oneway})) {
+        return oneway_${function.call()};
+    }
+
+    % endif
+    % if fallback_conditions:
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (${' || '.join(fallback_conditions)}) {
+        return unpacked_${function.call()};
+    }
+
+    % endif
+    auto& transport = get_runtime().get_transport();
 
+    % if uses_time:
+    XrDuration time_offset = get_time_offset();
+    % endif
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_${function.name} _request{};
+    % for param in function.packed.params:
+    % if param.kind != "output":
+    % for field in param.fields:
+<%
+    if param.kind == "value":
+        value = param.param.name
+    elif field.member is None:
+        value = f"*{param.param.name}"
+    elif param.header:
+        value = f"reinterpret_cast<const {param.struct.name}*>({param.param.name})->{field.member.name}"
+    else:
+        value = f"{param.param.name}->{field.member.name}"
+%>\
+    % if field.time:
+    _request.${field.name} = ${value} - time_offset;
+    % else:
+    _request.${field.name} = ${value};
+    % endif
+    % endfor
+    % endif
+    % endfor
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = ${function.id};
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_${function.name} _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    % for param in function.packed.params:
+    % if param.kind == "output":
+    % for field in param.fields:
+<% target = f"*{param.param.name}" if field.member is None else f"{param.param.name}->{field.member.name}" %>\
+    % if field.time:
+    ${target} = _response.${field.name} + time_offset;
+    % else:
+    ${target} = _response.${field.name};
+    % endif
+    % endfor
+    % endif
+    % endfor
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "${function.name}");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if function.pipelined:
+<% handle = function.pipelined %>\
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+    VirtualHandleAllocator* virtual_handles = get_runtime().get_virtual_handles();
+    if (!virtual_handles) {
+        return unpipelined_${function.call()};
+    }
+    if (!${handle.name}) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see virtual_handles.h
+    auto msg_out = transport.start_message(XRTP_MSG_PIPELINED_FUNCTION_CALL);
+
+    uint32_t function_id = ${function.id};
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    % for param in function.params:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='s_ctx')}
+    % endfor
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    // allocated while msg_out still holds the message lock, so that it matches the order of the calls
+    *${handle.name} = handle_from_value<${handle.type}>(virtual_handles->allocate());
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if function.two_call:
+<%
+    capacity, count, array = function.two_call
+    array_struct = spec.find_struct(array.type)
+    element_type = array_struct.xr_type if array_struct and array_struct.xr_type else "XR_TYPE_UNKNOWN"
+    call_args = {capacity.name: "capacity", count.name: "count_output", array.name: "elements"}
+%>\
+% if function.cached:
+static XrResult fetch_${function.signature()} try {
+% else:
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+% endif
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(${function.id});
+    SerializeContext key_ctx(key);
+    % for param in function.params:
+    % if param.name not in call_args:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='key_ctx')}
+    % endif
+    % endfor
+
+    return call_two_call(key, ${capacity.name}, ${count.name}, ${array.name}, ${element_type},
+        [&](uint32_t capacity, uint32_t* count_output, ${array.type}* elements) {
+            return uncached_${function.name}(${', '.join(call_args.get(param.name, param.name) for param in function.params)});
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if function.cached:
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_${function.call()};
+    }
+
+    // the results don't change for the lifetime of ${function.cached.name}, see query_cache.h
+    QueryKey key(handle_value(${function.cached.name}), ${function.id});
+    SerializeContext key_ctx(key);
+    % for param in function.params:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='key_ctx')}
+    % endfor
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        % for binding in function.modifiable_bindings:
+        ${utils.deserialize_binding(binding, ctx_var='outputs_ctx')}
+        % endfor
+        return get_runtime().get_deferred_errors().report(result);
+    }
+
+    result = fetch_${function.call()};
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        % for binding in function.modifiable_bindings:
+        ${utils.serialize_binding(binding, ctx_var='outputs_ctx', result_var='result')}
+        % endfor
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -75,6 +376,119 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
+% endif
+% if function.sampled:
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !${function.sampled.name}) {
+        return unsampled_${function.call()};
+    }
+
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = ${function.sampled.name}->time;
+    SampledCall call(${function.id});
+    SerializeContext call_ctx(call, time);
+    % for param in function.params[:function.sampled_inputs]:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='call_ctx')}
+    % endfor
+    call.key_size = call.bytes.size();
+    % for param in function.params[function.sampled_inputs:]:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='call_ctx')}
+    % endfor
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_${function.call()};
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_${function.call()};
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    % for binding in function.modifiable_bindings:
+    ${utils.deserialize_binding(binding, ctx_var='d_ctx')}
+    % endfor
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if function.action_state:
+<% session = function.params[0] %>\
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+    ActionStates* action_states = get_runtime().get_action_states();
+    if (!action_states) {
+        return unsynced_${function.call()};
+    }
+
+    % if function.action_state == "sync":
+    // the states queried since the last sync are fetched along with this one, see action_states.h
+    % else:
+    // states only change in xrSyncActions, which fetches the ones queried before it, see action_states.h
+    % endif
+    SampledCall call(${function.id});
+    SerializeContext call_ctx(call);
+    % for param in function.params[:function.action_state_inputs]:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='call_ctx')}
+    % endfor
+    call.key_size = call.bytes.size();
+    % for param in function.params[function.action_state_inputs:]:
+    ${utils.serialize_param(param, binding_prefix='', ctx_var='call_ctx')}
+    % endfor
+
+    QueryBuffer response;
+    % if function.action_state == "sync":
+    action_states->sync_actions(handle_value(${session.name}), call, response);
+    % else:
+    if (!action_states->take_snapshot(handle_value(${session.name}), std::move(call), response)) {
+        return unsynced_${function.call()};
+    }
+    % endif
+    DeserializeContext d_ctx(response, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    % if function.action_state == "query":
+    if (XR_FAILED(result)) {
+        // the query is made again, so that the error is for this call
+        return unsynced_${function.call()};
+    }
+    % endif
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    % for binding in function.modifiable_bindings:
+    ${utils.deserialize_binding(binding, ctx_var='d_ctx')}
+    % endfor
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
+% if function.frame_loop:
+XRAPI_ATTR XrResult XRAPI_CALL ${function.signature()} try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_${function.call()};
+    }
+    return frame_loop->${function.frame_loop}(${', '.join(param.name for param in function.params)}, unfused_${function.name});
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in ${function.name}: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+% endif
 </%utils:for_grouped_functions>
 
 } // namespace rpc
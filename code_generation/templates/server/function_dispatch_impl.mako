@@ -7,6 +7,10 @@
 #include "xrtransport/transport/transport.h"
 #include "xrtransport/serialization/serializer.h"
 #include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/packed_calls.h"
+#include "xrtransport/serialization/virtual_handles.h"
 #include "xrtransport/util.h"
 #include "xrtransport/time.h"
 
@@ -29,29 +33,75 @@ static XrDuration end_runtime_timer(XrTime start_time) {
     return get_time() - start_time;
 }
 
+<%def name="request_value(field)">\
+% if field.type in spec.virtual_handle_types:
+resolve_handle(_request->${field.name})\
+% else:
+_request->${field.name}\
+% endif
+</%def>\
+
 <%utils:for_grouped_functions args="function">\
 void FunctionDispatch::handle_${function.name}(MessageLockIn msg_in) {
 % if not function.name in ["xrCreateInstance", "xrDestroyInstance"]:
     function_loader.ensure_function_loaded("${function.name}", function_loader.${function.name[2:]});
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    % if function.sampled:
+    d_ctx.time_offset = sample_time;
+    % endif
     % for param in function.params:
-    ${param.declaration(with_qualifier=False, value_initialize=True)};
-    ${utils.deserialize_member(param, binding_prefix='', ctx_var='d_ctx')}
+    ${param.declaration(with_qualifier=bool(param.pointer), value_initialize=True)};
+    ${utils.deserialize_param(param, binding_prefix='', ctx_var='d_ctx')}
     % endfor
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.${function.name[2:]}(${', '.join(param.name for param in function.params)});
     XrDuration runtime_duration = end_runtime_timer(start_time);
+    % if function.oneway:
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(${function.id}, _result);
+        }
+        % for param in function.params:
+        ${utils.cleanup_member(param, binding_prefix='')}
+        % endfor
+        return;
+    }
+    % endif
+    % if function.pipelined:
+<% handle = function.pipelined %>\
+
+    if (pipelined_call) {
+        // the client already returned a virtual handle, which is bound to the one that was created
+        finish_pipelined_call(${function.id}, _result, ${handle.name} ? handle_value(*${handle.name}) : 0);
+        % for param in function.params:
+        ${utils.cleanup_member(param, binding_prefix='')}
+        % endfor
+        return;
+    }
+    % endif
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     % for binding in function.modifiable_bindings:
     ${utils.serialize_binding(binding, ctx_var='s_ctx')}
     % endfor
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     % for param in function.params:
     ${utils.cleanup_member(param, binding_prefix='')}
@@ -67,10 +117,250 @@ void FunctionDispatch::handle_${function.name}(MessageLockIn msg_in) {
 
 </%utils:for_grouped_functions>
 
+<%utils:for_grouped_functions packed_only="True" args="function">\
+void FunctionDispatch::handle_packed_${function.name}(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("${function.name}", function_loader.${function.name[2:]});
+    // the request is used directly from the message if it is there in one piece
+    Request_${function.name} request_copy;
+    auto _request = static_cast<const Request_${function.name}*>(
+        msg_in.buffer.borrow(sizeof(Request_${function.name}), alignof(Request_${function.name})));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    % for param in function.packed.params:
+<% name = param.param.name %>\
+    % if param.kind != "value" and param.struct:
+    ${param.struct.name} ${name}{${param.struct.xr_type or ''}};
+    % if param.kind == "input":
+    % for field in param.fields:
+    ${name}.${field.member.name} = ${request_value(field)};
+    % endfor
+    % endif
+    % elif param.kind == "input":
+    ${param.param.type} ${name} = ${request_value(param.fields[0])};
+    % elif param.kind == "output":
+    ${param.param.type} ${name}{};
+    % endif
+    % endfor
+    % if any(param.kind != "value" for param in function.packed.params):
+
+    % endif
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.${function.name[2:]}(${', '.join(param.server_argument(spec.virtual_handle_types) for param in function.packed.params)});
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_${function.name} _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    % for param in function.packed.params:
+    % if param.kind == "output":
+    % for field in param.fields:
+    _response.${field.name} = ${param.param.name if field.member is None else f"{param.param.name}.{field.member.name}"};
+    % endfor
+    % endif
+    % endfor
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+</%utils:for_grouped_functions>
+void FunctionDispatch::handle_pipelined_function(std::uint32_t function_id, MessageLockIn msg_in) {
+    if (pipelined_handlers.find(function_id) == pipelined_handlers.end()) {
+        throw UnknownFunctionIdException("Unknown function id in handle_pipelined_function: " + std::to_string(function_id));
+    }
+    if (!virtual_handles) {
+        throw std::runtime_error("Pipelined call without XRTP_FEATURE_PIPELINED_CREATION");
+    }
+    Handler handler = pipelined_handlers.at(function_id);
+    if (delta_decoder) {
+        decoded_params.reset(delta_decoder->decode(function_id, msg_in.buffer));
+    }
+    std::size_t bound = virtual_handles->size();
+    pipelined_call = true;
+    try {
+        (this->*handler)(std::move(msg_in));
+    }
+    catch (...) {
+        pipelined_call = false;
+        // keep the virtual handles in step with the client
+        if (virtual_handles->size() == bound) {
+            finish_pipelined_call(function_id, XR_ERROR_RUNTIME_FAILURE, 0);
+        }
+        throw;
+    }
+    pipelined_call = false;
+}
+
+void FunctionDispatch::finish_pipelined_call(std::uint32_t function_id, XrResult result, std::uint64_t handle) {
+    if (XR_SUCCEEDED(result) && is_virtual_handle(handle)) {
+        spdlog::error("Runtime returned handle {:#x}, which can't be told apart from a virtual handle", handle);
+    }
+    virtual_handles->bind(XR_SUCCEEDED(result) ? handle : 0);
+    if (XR_FAILED(result)) {
+        send_deferred_error(function_id, result);
+    }
+}
+
+void FunctionDispatch::handle_oneway_function(std::uint32_t function_id, MessageLockIn msg_in) {
+    if (oneway_handlers.find(function_id) == oneway_handlers.end()) {
+        throw UnknownFunctionIdException("Unknown function id in handle_oneway_function: " + std::to_string(function_id));
+    }
+    Handler handler = oneway_handlers.at(function_id);
+    if (delta_decoder) {
+        decoded_params.reset(delta_decoder->decode(function_id, msg_in.buffer));
+    }
+    oneway_call = true;
+    try {
+        (this->*handler)(std::move(msg_in));
+    }
+    catch (...) {
+        oneway_call = false;
+        throw;
+    }
+    oneway_call = false;
+}
+
+void FunctionDispatch::send_deferred_error(std::uint32_t function_id, XrResult result) {
+    auto msg_out = transport.start_message(XRTP_MSG_DEFERRED_ERROR);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&result, sizeof(XrResult)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_function_batch(MessageLockIn msg_in) {
+    uint32_t call_count{};
+    asio::read(msg_in.buffer, asio::buffer(&call_count, sizeof(uint32_t)));
+
+    // batched calls are sent without interning and compact encoding, but may use virtual handles
+    StringTable* saved_request_strings = request_strings;
+    StringInterner* saved_response_strings = response_strings;
+    HandleTable* saved_request_handles = request_handles;
+    HandleInterner* saved_response_handles = response_handles;
+    auto restore = [&]() {
+        batch_call = false;
+        request_strings = saved_request_strings;
+        response_strings = saved_response_strings;
+        request_handles = saved_request_handles;
+        response_handles = saved_response_handles;
+    };
+    batch_call = true;
+    request_strings = nullptr;
+    response_strings = nullptr;
+    request_handles = nullptr;
+    response_handles = nullptr;
+
+    ResponseBuffer results;
+    std::vector<std::uint8_t> params;
+    try {
+        for (uint32_t i = 0; i < call_count; i++) {
+            uint32_t function_id{};
+            asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+            uint32_t params_size{};
+            asio::read(msg_in.buffer, asio::buffer(&params_size, sizeof(uint32_t)));
+            params.resize(params_size);
+            asio::read(msg_in.buffer, asio::buffer(params.data(), params.size()));
+
+            if (handlers.find(function_id) == handlers.end()) {
+                throw UnknownFunctionIdException("Unknown function id in handle_function_batch: " + std::to_string(function_id));
+            }
+            Handler handler = handlers.at(function_id);
+            if (handler == &FunctionDispatch::handle_xrCreateInstance || handler == &FunctionDispatch::handle_xrDestroyInstance) {
+                throw std::runtime_error("xrCreateInstance and xrDestroyInstance can't be batched");
+            }
+
+            // the handler reads its params from decoded_params, and gets no message of its own
+            decoded_params.reset(params);
+            batch_response.bytes.clear();
+            (this->*handler)(MessageLockIn(nullptr));
+
+            uint32_t result_size = static_cast<uint32_t>(batch_response.bytes.size());
+            asio::write(results, asio::buffer(&result_size, sizeof(uint32_t)));
+            asio::write(results, asio::buffer(batch_response.bytes.data(), batch_response.bytes.size()));
+        }
+    }
+    catch (...) {
+        restore();
+        throw;
+    }
+    restore();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN_BATCH);
+    asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(results.bytes.data(), results.bytes.size()));
+    msg_out.flush();
+}
+
+void FunctionDispatch::sample_calls(const std::vector<SampledCall>& calls, XrTime display_time, SyncWriteStream& results) {
+    // sampled calls are sent like batched ones
+    StringTable* saved_request_strings = request_strings;
+    StringInterner* saved_response_strings = response_strings;
+    HandleTable* saved_request_handles = request_handles;
+    HandleInterner* saved_response_handles = response_handles;
+    batch_call = true;
+    sample_time = display_time;
+    request_strings = nullptr;
+    response_strings = nullptr;
+    request_handles = nullptr;
+    response_handles = nullptr;
+
+    for (const SampledCall& call : calls) {
+        batch_response.bytes.clear();
+        auto it = sampled_handlers.find(call.function_id);
+        if (it != sampled_handlers.end()) {
+            try {
+                decoded_params.reset(call.params);
+                (this->*(it->second))(MessageLockIn(nullptr));
+            }
+            catch (const std::exception& e) {
+                spdlog::debug("Sampling function {} failed: {}", call.function_id, e.what());
+                batch_response.bytes.clear();
+            }
+        }
+        uint32_t result_size = static_cast<uint32_t>(batch_response.bytes.size());
+        asio::write(results, asio::buffer(&result_size, sizeof(uint32_t)));
+        asio::write(results, asio::buffer(batch_response.bytes.data(), batch_response.bytes.size()));
+    }
+
+    batch_call = false;
+    sample_time = 0;
+    request_strings = saved_request_strings;
+    response_strings = saved_response_strings;
+    request_handles = saved_request_handles;
+    response_handles = saved_response_handles;
+}
+
 std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::handlers = {
 <%utils:for_grouped_functions args="function">\
     {${function.id}, &FunctionDispatch::handle_${function.name}},
 </%utils:for_grouped_functions>
 };
 
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::packed_handlers = {
+<%utils:for_grouped_functions packed_only="True" args="function">\
+    {${function.id}, &FunctionDispatch::handle_packed_${function.name}},
+</%utils:for_grouped_functions>
+};
+
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::pipelined_handlers = {
+<%utils:for_grouped_functions pipelined_only="True" args="function">\
+    {${function.id}, &FunctionDispatch::handle_${function.name}},
+</%utils:for_grouped_functions>
+};
+
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::oneway_handlers = {
+<%utils:for_grouped_functions oneway_only="True" args="function">\
+    {${function.id}, &FunctionDispatch::handle_${function.name}},
+</%utils:for_grouped_functions>
+};
+
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::sampled_handlers = {
+<%utils:for_grouped_functions sampled_only="True" args="function">\
+    {${function.id}, &FunctionDispatch::handle_${function.name}},
+</%utils:for_grouped_functions>
+};
+
 } // namespace xrtransport
\ No newline at end of file
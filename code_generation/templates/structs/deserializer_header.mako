@@ -3,33 +3,66 @@
 <%namespace name="utils" file="utils.mako"/>\
 <%def name="forward_deserializer(struct)">\
 void deserialize(${struct.name}* s, DeserializeContext& ctx);\
+% if struct.name in spec.quantized_structs:
+
+void dequantize(${struct.name}* s, std::size_t count, QuantizedReader& reader);\
+% endif
+% if struct.name in spec.flat_structs:
+
+constexpr bool is_flat(const ${struct.name}* s);\
+% endif
 </%def>
 
 <%def name="forward_cleaner(struct)">\
 void cleanup(const ${struct.name}* s);\
 </%def>
 
+<%def name="flat_definition(struct)">\
+constexpr bool is_flat(const ${struct.name}*) {
+    return
+% for member in struct.members:
+        is_flat_member<decltype(${struct.name}::${member.name})>() &&
+% endfor
+        sizeof(${struct.name}) == ${" + ".join(f"sizeof({struct.name}::{member.name})" for member in struct.members)};
+}\
+</%def>
+
 #ifndef XRTRANSPORT_DESERIALIZER_GENERATED_H
 #define XRTRANSPORT_DESERIALIZER_GENERATED_H
 
 #include "openxr/openxr.h"
 #include "xrtransport/asio_compat.h"
 #include "struct_size.h"
+#include "virtual_handles.h"
 
 #include "asio/read.hpp"
 #include "asio/write.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <unordered_map>
 #include <cstring>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace xrtransport {
 
+class StringTable;
+class HandleTable;
+
 struct DeserializeContext {
     SyncReadStream& in;
     bool in_place;
     XrDuration time_offset;
+    // set if XRTP_FEATURE_STRING_INTERNING was negotiated, see string_interning.h
+    StringTable* strings = nullptr;
+    // set if XRTP_FEATURE_COMPACT_ENCODING was negotiated, see compact_encoding.h
+    HandleTable* handles = nullptr;
+    // set if XRTP_FEATURE_PIPELINED_CREATION was negotiated, to resolve handles sent without compact
+    // encoding, see virtual_handles.h
+    const VirtualHandleMap* virtual_handles = nullptr;
 
     explicit DeserializeContext(SyncReadStream& in)
         : in(in), in_place(false), time_offset(0)
@@ -40,6 +73,8 @@ struct DeserializeContext {
     {}
 };
 
+class QuantizedReader;
+
 // Forward declarations (deserializers)
 <%utils:for_grouped_structs args="struct">\
 ${forward_deserializer(struct)}
@@ -50,22 +85,160 @@ ${forward_deserializer(struct)}
 ${forward_cleaner(struct)}
 </%utils:for_grouped_structs>
 
+/**
+ * True for types that are serialized exactly as they are laid out in memory, so that arrays of them can
+ * be used directly from a received message. Handles are sent as raw values, so they are flat as well.
+ */
+template <typename T>
+constexpr bool is_flat(const T*) {
+    return std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value;
+}
+
+template <typename T>
+constexpr bool is_flat_member() {
+    return is_flat(static_cast<const std::remove_all_extents_t<T>*>(nullptr));
+}
+
+// Plain structs without pointers or times are flat if their members are and they have no padding
+% for group in spec.flat_struct_groups:
+% if group.extensions:
+#if ${group.guard()}
+% endif
+% for struct in group.structs:
+${flat_definition(struct)}
+
+% endfor
+% if group.extensions:
+#endif
+% endif
+% endfor
 // Struct deserializer lookup
 // Only to be used with OpenXR pNext structs
 using StructDeserializer = void(*)(XrBaseOutStructure*, DeserializeContext&);
-#define STRUCT_DESERIALIZER_PTR(t) (reinterpret_cast<StructDeserializer>(static_cast<void(*)(t*, DeserializeContext&)>(&deserialize)))
+
+// Type-erased entry point, so that deserializer pointers are usable in constant expressions
+template <typename T>
+void deserialize_erased(XrBaseOutStructure* s, DeserializeContext& ctx) {
+    deserialize(reinterpret_cast<T*>(s), ctx);
+}
+
+#define STRUCT_DESERIALIZER_PTR(t) (&deserialize_erased<t>)
 
 StructDeserializer deserializer_lookup(XrStructureType struct_type);
 
 // Struct cleaner lookup
 // Only to be used with OpenXR pNext structs
 using StructCleaner = void(*)(const XrBaseOutStructure*);
-#define STRUCT_CLEANER_PTR(t) (reinterpret_cast<StructCleaner>(static_cast<void(*)(const t*)>(&cleanup)))
+
+template <typename T>
+void cleanup_erased(const XrBaseOutStructure* s) {
+    cleanup(reinterpret_cast<const T*>(s));
+}
+
+#define STRUCT_CLEANER_PTR(t) (&cleanup_erased<t>)
 
 StructCleaner cleaner_lookup(XrStructureType struct_type);
 
 void deserialize_time(XrTime* time, DeserializeContext& ctx);
 
+// Strings are interned if ctx.strings is set, see string_interning.h
+void deserialize_string(const char** x, DeserializeContext& ctx);
+void deserialize_string(char** x, DeserializeContext& ctx);
+// Fixed size char array member, the rest of the array is zeroed
+void deserialize_string_array(char* x, std::size_t size, DeserializeContext& ctx);
+// Always in place, null-terminated if there is room left in the buffer
+void deserialize_string_buffer(char* x, std::size_t capacity, DeserializeContext& ctx);
+
+/**
+ * Lets const arrays and strings deserialized on this thread point into the message they are read from
+ * instead of being copied, if the stream supports it (see SyncReadStream::borrow) and they are aligned.
+ * Generated server handlers hold one for as long as they hold the message. cleanup_ptr doesn't free
+ * pointers that were borrowed through the active scope.
+ */
+class BorrowScope {
+private:
+    inline static thread_local BorrowScope* active_scope = nullptr;
+
+    BorrowScope* previous;
+    std::vector<const void*> borrowed;
+
+public:
+    BorrowScope() : previous(active_scope) {
+        active_scope = this;
+    }
+
+    ~BorrowScope() {
+        active_scope = previous;
+    }
+
+    BorrowScope(const BorrowScope&) = delete;
+    BorrowScope& operator=(const BorrowScope&) = delete;
+
+    static BorrowScope* active() {
+        return active_scope;
+    }
+
+    const void* borrow(SyncReadStream& in, std::size_t size, std::size_t alignment) {
+        const void* data = in.borrow(size, alignment);
+        if (data) {
+            borrowed.push_back(data);
+        }
+        return data;
+    }
+
+    /**
+     * Marks data that outlives the scope (e.g. an interned string) as borrowed, so it isn't freed.
+     */
+    void add_borrowed(const void* data) {
+        borrowed.push_back(data);
+    }
+
+    bool is_borrowed(const void* data) const {
+        return std::find(borrowed.begin(), borrowed.end(), data) != borrowed.end();
+    }
+};
+
+/**
+ * Borrows len elements from the message if T is flat and a BorrowScope is active. Returns nullptr if
+ * they have to be copied, which they always do with compact encoding or virtual handles.
+ */
+template <typename T>
+const T* borrow_array(std::size_t len, DeserializeContext& ctx) {
+    if constexpr (is_flat(static_cast<const T*>(nullptr))) {
+        BorrowScope* scope = BorrowScope::active();
+        if (scope && !ctx.handles && !ctx.virtual_handles) {
+            return static_cast<const T*>(scope->borrow(ctx.in, sizeof(T) * len, alignof(T)));
+        }
+    }
+    return nullptr;
+}
+
+// Compact encodings used by deserialize if ctx.handles is set, see compact_encoding.h
+std::uint64_t deserialize_compact_uint(DeserializeContext& ctx);
+std::int64_t deserialize_compact_enum(DeserializeContext& ctx);
+XrStructureType deserialize_compact_struct_type(DeserializeContext& ctx);
+std::uint64_t deserialize_compact_handle(DeserializeContext& ctx);
+
+template <typename T>
+void deserialize_compact(T* x, DeserializeContext& ctx) {
+    if constexpr (std::is_same<T, XrStructureType>::value) {
+        *x = deserialize_compact_struct_type(ctx);
+    }
+    else if constexpr (std::is_enum<T>::value) {
+        *x = static_cast<T>(deserialize_compact_enum(ctx));
+    }
+    else if constexpr (std::is_pointer<T>::value) {
+        *x = reinterpret_cast<T>(static_cast<std::uintptr_t>(deserialize_compact_handle(ctx)));
+    }
+    else {
+        std::uint64_t value = deserialize_compact_uint(ctx);
+        if (value > UINT32_MAX) {
+            throw std::runtime_error("Compact value out of range: " + std::to_string(value));
+        }
+        *x = static_cast<T>(value);
+    }
+}
+
 // Generic deserializers
 template <typename T>
 void deserialize(T* x, DeserializeContext& ctx) {
@@ -73,7 +246,19 @@ void deserialize(T* x, DeserializeContext& ctx) {
         !std::is_class<T>::value,
         "T must be a supported type"
     );
+    // counts, lengths, enums and handles
+    if constexpr (std::is_same<T, std::uint32_t>::value || std::is_enum<T>::value || std::is_pointer<T>::value) {
+        if (ctx.handles) {
+            deserialize_compact(x, ctx);
+            return;
+        }
+    }
     asio::read(ctx.in, asio::buffer(x, sizeof(T)));
+    if constexpr (std::is_pointer<T>::value) {
+        if (ctx.virtual_handles) {
+            *x = ctx.virtual_handles->resolve(*x);
+        }
+    }
 }
 
 template <typename T>
@@ -100,6 +285,9 @@ void deserialize_ptr(const T** x, DeserializeContext& ctx) {
             }
             deserialize_array(*x, len, ctx);
         }
+        else if (const T* borrowed = borrow_array<T>(len, ctx)) {
+            *x = borrowed;
+        }
         else {
             T* data = static_cast<T*>(std::malloc(sizeof(T) * len));
             deserialize_array(data, len, ctx);
@@ -147,6 +335,32 @@ void deserialize_ptr(T** x, DeserializeContext& ctx) {
     }
 }
 
+/**
+ * Allocates a pure output param sent with serialize_output_ptr, zeroed for the runtime to fill in.
+ * Never in place, only requests contain pure output params.
+ * @return The number of elements
+ */
+template <typename T>
+std::uint32_t deserialize_output_ptr(T** x, DeserializeContext& ctx) {
+    std::uint32_t len{};
+    deserialize(&len, ctx);
+    *x = len ? static_cast<T*>(std::calloc(len, sizeof(T))) : nullptr;
+    return len;
+}
+
+/**
+ * Allocates a pure output XR struct array sent with serialize_output_xr_ptr, with the type and next
+ * chain of each element filled in.
+ */
+template <typename T>
+void deserialize_output_xr_ptr(T** x, DeserializeContext& ctx) {
+    std::uint32_t len = deserialize_output_ptr(x, ctx);
+    for (std::uint32_t i = 0; i < len; i++) {
+        deserialize(&(*x)[i].type, ctx);
+        deserialize_xr(&(*x)[i].next, ctx);
+    }
+}
+
 template <typename T>
 void deserialize_xr(const T** p_s, DeserializeContext& ctx) {
     XrStructureType type{};
@@ -257,6 +471,44 @@ void deserialize_xr_array(const T** p_s, DeserializeContext& ctx) {
     }
 }
 
+/**
+ * Deserializes the elements sent by serialize_filled_ptr into the application's array. Always in place,
+ * the array is left alone if no elements were sent.
+ */
+template <typename T>
+void deserialize_filled_ptr(T* x, std::size_t capacity, DeserializeContext& ctx) {
+    std::uint32_t len{};
+    deserialize(&len, ctx);
+    if (len == 0) {
+        return;
+    }
+    if (!x || len > capacity) {
+        throw std::runtime_error("Received " + std::to_string(len) + " elements for array of capacity " + std::to_string(capacity));
+    }
+    deserialize_array(x, len, ctx);
+}
+
+template <typename T>
+void deserialize_filled_xr_array(T* x, std::size_t capacity, DeserializeContext& ctx) {
+    std::uint32_t count{};
+    deserialize(&count, ctx);
+    if (count == 0) {
+        return;
+    }
+    if (!x || count > capacity) {
+        throw std::runtime_error("Received " + std::to_string(count) + " elements for array of capacity " + std::to_string(capacity));
+    }
+    XrStructureType type{};
+    deserialize(&type, ctx);
+    std::size_t struct_size = size_lookup(type);
+    StructDeserializer deserializer = deserializer_lookup(type);
+    char* buffer = reinterpret_cast<char*>(x);
+    for (std::uint32_t i = 0; i < count; i++) {
+        deserializer(reinterpret_cast<XrBaseOutStructure*>(buffer), ctx);
+        buffer += struct_size;
+    }
+}
+
 // Generic cleaners
 template <typename T>
 void cleanup(const T* x) {
@@ -281,6 +533,10 @@ void cleanup_ptr(const T* x, std::size_t len) {
         return; // do not clean up null pointer
     }
     cleanup_array(x, len);
+    BorrowScope* scope = BorrowScope::active();
+    if (scope && scope->is_borrowed(x)) {
+        return; // points into the message
+    }
     std::free(const_cast<T*>(x));
 }
 
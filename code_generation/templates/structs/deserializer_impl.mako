@@ -9,6 +9,18 @@ void deserialize(${struct.name}* s, DeserializeContext& ctx) {
 }\
 </%def>
 
+<%def name="dequantizer(struct)">\
+<% quantized = spec.quantized_structs[struct.name] %>\
+void dequantize(${struct.name}* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * ${quantized.encoded_size()});
+    for (std::size_t i = 0; i < count; i++) {
+% for member in quantized.members:
+        reader.get_${member.codec}(&s[i].${member.name});
+% endfor
+    }
+}\
+</%def>
+
 <%def name="cleaner(struct)">\
 void cleanup(const ${struct.name}* s) {
 % for member in struct.members:
@@ -18,46 +30,55 @@ void cleanup(const ${struct.name}* s) {
 </%def>
 
 #include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/quantization.h"
+#include "xrtransport/serialization/struct_index.h"
 #include "xrtransport/serialization/error.h"
 #include "xrtransport/util.h"
 
 namespace xrtransport {
 
-std::unordered_map<XrStructureType, StructDeserializer> deserializer_lookup_table = {
+constexpr StructTableEntry<StructDeserializer> deserializer_lookup_entries[] = {
 <%utils:for_grouped_structs xr_structs_only="True" args="struct">\
     {${struct.xr_type}, STRUCT_DESERIALIZER_PTR(${struct.name})},
 </%utils:for_grouped_structs>
 };
 
+constexpr auto deserializer_lookup_table = make_struct_table(deserializer_lookup_entries);
+
 StructDeserializer deserializer_lookup(XrStructureType struct_type) {
-    auto it = deserializer_lookup_table.find(struct_type);
-    if (it == deserializer_lookup_table.end()) {
-        return nullptr;
-    }
-    else {
-        return it->second;
-    }
+    return deserializer_lookup_table[struct_type_index(struct_type)];
 }
 
-std::unordered_map<XrStructureType, StructCleaner> cleaner_lookup_table = {
+constexpr StructTableEntry<StructCleaner> cleaner_lookup_entries[] = {
 <%utils:for_grouped_structs xr_structs_only="True" args="struct">\
     {${struct.xr_type}, STRUCT_CLEANER_PTR(${struct.name})},
 </%utils:for_grouped_structs>
 };
 
+constexpr auto cleaner_lookup_table = make_struct_table(cleaner_lookup_entries);
+
 StructCleaner cleaner_lookup(XrStructureType struct_type) {
-    if (cleaner_lookup_table.find(struct_type) == cleaner_lookup_table.end()) {
+    StructCleaner cleaner = cleaner_lookup_table[struct_type_index(struct_type)];
+    if (!cleaner) {
         throw UnknownXrStructureTypeException("Unknown XrStructureType in cleaner_lookup: " + std::to_string(struct_type));
     }
-    return cleaner_lookup_table.at(struct_type);
+    return cleaner;
 }
 
-// Deserializers
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+// Deserializers, replaced by the tables in struct_tables.cpp in table-driven mode
 <%utils:for_grouped_structs args="struct">\
 % if not struct.custom:
 ${deserializer(struct)}
 
 % endif
+</%utils:for_grouped_structs>
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+// Dequantizers
+<%utils:for_grouped_structs quantized_only="True" args="struct">\
+${dequantizer(struct)}
+
 </%utils:for_grouped_structs>
 
 // reads a remote time, converts it to local time, and applies it
@@ -68,6 +89,7 @@ void deserialize_time(XrTime* time, DeserializeContext& ctx) {
     *time = remote_time + ctx.time_offset;
 }
 
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
 // Cleaners
 <%utils:for_grouped_structs args="struct">\
 % if not struct.custom:
@@ -75,5 +97,6 @@ ${cleaner(struct)}
 
 % endif
 </%utils:for_grouped_structs>
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
 
 } // namespace xrtransport
\ No newline at end of file
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+<%namespace name="utils" file="utils.mako"/>\
+#ifndef XRTRANSPORT_PACKED_CALLS_GENERATED_H
+#define XRTRANSPORT_PACKED_CALLS_GENERATED_H
+
+#include "openxr/openxr.h"
+
+#include <cstdint>
+
+namespace xrtransport {
+
+/*
+ * Packed function calls
+ *
+ * The hot functions in code_generation/packed_calls.py only take plain values, and pointers to single
+ * structs without pointers in them. In the common case, where those structs have no next chain, the
+ * client sends all of their params as one Request_ struct in an XRTP_MSG_PACKED_FUNCTION_CALL, which
+ * the server uses directly from the message, and the server replies with one Response_ struct in an
+ * XRTP_MSG_FUNCTION_RETURN. Any other call to these functions uses the generic encoding.
+ *
+ * Members of struct params are named <param>_<member>. Times are in the server's clock.
+ */
+
+#pragma pack(push, 1)
+
+<%utils:for_grouped_functions packed_only="True" args="function">\
+struct Request_${function.name} {
+% for field in function.packed.request_fields():
+    ${field.type} ${field.name};
+% endfor
+};
+
+struct Response_${function.name} {
+    XrResult result;
+    XrDuration runtime_duration;
+% for field in function.packed.response_fields():
+    ${field.type} ${field.name};
+% endfor
+};
+
+</%utils:for_grouped_functions>
+#pragma pack(pop)
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_PACKED_CALLS_GENERATED_H
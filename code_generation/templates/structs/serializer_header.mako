@@ -3,6 +3,10 @@
 <%namespace name="utils" file="utils.mako"/>\
 <%def name="forward_serializer(struct)">\
 void serialize(const ${struct.name}* s, SerializeContext& ctx);\
+% if struct.name in spec.quantized_structs:
+
+bool quantize(const ${struct.name}* s, std::size_t count, QuantizedWriter& writer);\
+% endif
 </%def>
 
 #ifndef XRTRANSPORT_SERIALIZER_GENERATED_H
@@ -16,17 +20,28 @@ void serialize(const ${struct.name}* s, SerializeContext& ctx);\
 #include "asio/write.hpp"
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstdint>
-#include <unordered_map>
 #include <cassert>
 #include <cstring>
+#include <string>
+#include <type_traits>
 
 namespace xrtransport {
 
+class StringInterner;
+class HandleInterner;
+
 struct SerializeContext {
     SyncWriteStream& out;
     XrDuration time_offset;
     bool skip_unknown_structs;
+    // QUANTIZED_* bits of the extensions whose arrays may be sent quantized, see quantization.h
+    std::uint64_t quantized_extensions = 0;
+    // interns strings if XRTP_FEATURE_STRING_INTERNING was negotiated, see string_interning.h
+    StringInterner* strings = nullptr;
+    // sends counts, enums and handles compactly if XRTP_FEATURE_COMPACT_ENCODING was negotiated, see compact_encoding.h
+    HandleInterner* handles = nullptr;
 
     explicit SerializeContext(SyncWriteStream& out)
         : out(out), time_offset(0), skip_unknown_structs(false)
@@ -45,6 +60,8 @@ struct SerializeContext {
     {}
 };
 
+class QuantizedWriter;
+
 // Forward declarations
 <%utils:for_grouped_structs args="struct">\
 ${forward_serializer(struct)}
@@ -52,14 +69,58 @@ ${forward_serializer(struct)}
 
 // Only to be used with OpenXR pNext structs
 using StructSerializer = void(*)(const XrBaseInStructure*, SerializeContext& ctx);
-#define STRUCT_SERIALIZER_PTR(t) (reinterpret_cast<StructSerializer>(static_cast<void(*)(const t*, SerializeContext& ctx)>(&serialize)))
 
-extern std::unordered_map<XrStructureType, StructSerializer> serializer_lookup_table;
+// Type-erased entry point, so that serializer pointers are usable in constant expressions
+template <typename T>
+void serialize_erased(const XrBaseInStructure* s, SerializeContext& ctx) {
+    serialize(reinterpret_cast<const T*>(s), ctx);
+}
+
+#define STRUCT_SERIALIZER_PTR(t) (&serialize_erased<t>)
 
 StructSerializer serializer_lookup(XrStructureType struct_type);
 
 void serialize_time(const XrTime* local_time, SerializeContext& ctx);
 
+// Strings are interned if ctx.strings is set, see string_interning.h
+void serialize_string(const char* x, SerializeContext& ctx);
+// Fixed size char array member
+void serialize_string_array(const char* x, std::size_t size, SerializeContext& ctx);
+// Output buffer filled in by the runtime, which may not be null-terminated
+void serialize_string_buffer(const char* x, std::size_t capacity, SerializeContext& ctx);
+
+// Extensions with joint, pose or weight arrays that can be sent quantized
+% for i, ext_name in enumerate(spec.quantized_extensions):
+constexpr std::uint64_t QUANTIZED_${ext_name} = 1ull << ${i};
+% endfor
+
+/**
+ * Returns the QUANTIZED_* bit of an extension, or 0 if it has no arrays that can be sent quantized.
+ */
+std::uint64_t quantized_extension_bit(const std::string& extension_name);
+
+// Compact encodings used by serialize if ctx.handles is set, see compact_encoding.h
+void serialize_compact_uint(std::uint64_t value, SerializeContext& ctx);
+void serialize_compact_enum(std::int64_t value, SerializeContext& ctx);
+void serialize_compact_struct_type(XrStructureType type, SerializeContext& ctx);
+void serialize_compact_handle(std::uint64_t handle, SerializeContext& ctx);
+
+template <typename T>
+void serialize_compact(const T* x, SerializeContext& ctx) {
+    if constexpr (std::is_same<T, XrStructureType>::value) {
+        serialize_compact_struct_type(*x, ctx);
+    }
+    else if constexpr (std::is_enum<T>::value) {
+        serialize_compact_enum(static_cast<std::int64_t>(*x), ctx);
+    }
+    else if constexpr (std::is_pointer<T>::value) {
+        serialize_compact_handle(reinterpret_cast<std::uintptr_t>(*x), ctx);
+    }
+    else {
+        serialize_compact_uint(*x, ctx);
+    }
+}
+
 // Generic serializers
 template <typename T>
 void serialize(const T* x, SerializeContext& ctx) {
@@ -67,6 +128,13 @@ void serialize(const T* x, SerializeContext& ctx) {
         !std::is_class<T>::value,
         "T must be a supported type"
     );
+    // counts, lengths, enums and handles
+    if constexpr (std::is_same<T, std::uint32_t>::value || std::is_enum<T>::value || std::is_pointer<T>::value) {
+        if (ctx.handles) {
+            serialize_compact(x, ctx);
+            return;
+        }
+    }
     asio::write(ctx.out, asio::buffer(x, sizeof(T)));
 }
 
@@ -86,6 +154,30 @@ void serialize_ptr(const T* x, std::size_t len, SerializeContext& ctx) {
     }
 }
 
+/**
+ * Pure output params (see code_generation/bindings.py) are never read by the runtime, so only their
+ * length is sent for the receiver to allocate them.
+ */
+template <typename T>
+void serialize_output_ptr(const T* x, std::size_t len, SerializeContext& ctx) {
+    std::uint32_t marker = x != nullptr ? len : 0;
+    serialize(&marker, ctx);
+}
+
+/**
+ * Pure output XR structs also need their type and next chain, which tell the runtime what to fill in.
+ */
+template <typename T>
+void serialize_output_xr_ptr(const T* x, std::size_t len, SerializeContext& ctx) {
+    serialize_output_ptr(x, len, ctx);
+    if (x) {
+        for (std::size_t i = 0; i < len; i++) {
+            serialize(&x[i].type, ctx);
+            serialize_xr(x[i].next, ctx);
+        }
+    }
+}
+
 template <typename T>
 void serialize_xr(const T* untyped, SerializeContext& ctx) {
     const XrBaseInStructure* x = reinterpret_cast<const XrBaseInStructure*>(untyped);
@@ -149,6 +241,27 @@ void serialize_xr_array(const T* untyped, std::size_t len, SerializeContext& ctx
     }
 }
 
+/**
+ * Serializes the elements of a two-call idiom array that the runtime filled in, which may be fewer
+ * than its capacity. Nothing is sent if the call failed or only asked for the count.
+ */
+template <typename T>
+void serialize_filled_ptr(const T* x, std::size_t capacity, std::uint32_t count, SerializeContext& ctx) {
+    serialize_ptr(x, std::min<std::size_t>(count, capacity), ctx);
+}
+
+template <typename T>
+void serialize_filled_xr_array(const T* x, std::size_t capacity, std::uint32_t count, SerializeContext& ctx) {
+    std::size_t len = std::min<std::size_t>(count, capacity);
+    if (len == 0) {
+        // serialize_xr_array would still send the type, which isn't read back for an empty array
+        std::uint32_t marker = 0;
+        serialize(&marker, ctx);
+        return;
+    }
+    serialize_xr_array(x, len, ctx);
+}
+
 } // namespace xrtransport
 
 #endif // XRTRANSPORT_SERIALIZER_GENERATED_H
\ No newline at end of file
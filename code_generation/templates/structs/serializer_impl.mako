@@ -13,35 +13,87 @@ void serialize(const ${struct.name}* s, SerializeContext& ctx) {
 }\
 </%def>
 
+<%def name="quantizer(struct)">\
+<% quantized = spec.quantized_structs[struct.name] %>\
+bool quantize(const ${struct.name}* s, std::size_t count, QuantizedWriter& writer) {
+% if quantized.has_poses():
+    for (std::size_t i = 0; i < count; i++) {
+% for member in quantized.members:
+% if member.codec == "pose":
+        writer.include_position(s[i].${member.name}.position);
+% endif
+% endfor
+    }
+% endif
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+% for member in quantized.members:
+        if (!writer.put_${member.codec}(s[i].${member.name})) {
+            return false;
+        }
+% endfor
+    }
+    return true;
+}\
+</%def>
+
 #include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/quantization.h"
+#include "xrtransport/serialization/struct_index.h"
 #include "xrtransport/serialization/error.h"
 #include "xrtransport/util.h"
 
 namespace xrtransport {
 
-std::unordered_map<XrStructureType, StructSerializer> serializer_lookup_table = {
+constexpr StructTableEntry<StructSerializer> serializer_lookup_entries[] = {
 <%utils:for_grouped_structs xr_structs_only="True" args="struct">\
     {${struct.xr_type}, STRUCT_SERIALIZER_PTR(${struct.name})},
 </%utils:for_grouped_structs>
 };
 
+constexpr auto serializer_lookup_table = make_struct_table(serializer_lookup_entries);
+
 StructSerializer serializer_lookup(XrStructureType struct_type) {
-    auto it = serializer_lookup_table.find(struct_type);
-    if (it == serializer_lookup_table.end()) {
-        return nullptr;
-    }
-    else {
-        return it->second;
-    }
+    return serializer_lookup_table[struct_type_index(struct_type)];
 }
 
-// Serializers
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+// Serializers, replaced by the tables in struct_tables.cpp in table-driven mode
 <%utils:for_grouped_structs args="struct">\
 % if not struct.custom:
 ${serializer(struct)}
 
 % endif
 </%utils:for_grouped_structs>
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+// Quantizers
+<%utils:for_grouped_structs quantized_only="True" args="struct">\
+${quantizer(struct)}
+
+</%utils:for_grouped_structs>
+
+struct QuantizedExtensionEntry {
+    const char* name;
+    std::uint64_t bit;
+};
+
+constexpr QuantizedExtensionEntry quantized_extension_entries[] = {
+% for ext_name in spec.quantized_extensions:
+    {"${ext_name}", QUANTIZED_${ext_name}},
+% endfor
+};
+
+std::uint64_t quantized_extension_bit(const std::string& extension_name) {
+    for (const QuantizedExtensionEntry& entry : quantized_extension_entries) {
+        if (extension_name == entry.name) {
+            return entry.bit;
+        }
+    }
+    return 0;
+}
 
 // takes a local time, converts it to remote time, and puts it on the stream
 void serialize_time(const XrTime* local_time, SerializeContext& ctx) {
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+<%namespace name="utils" file="utils.mako"/>\
+#ifndef XRTRANSPORT_STRUCT_INDEX_GENERATED_H
+#define XRTRANSPORT_STRUCT_INDEX_GENERATED_H
+
+#include "openxr/openxr.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace xrtransport {
+
+// Every XrStructureType that the serializer was built for. Only used to lay out the dense struct
+// tables below, so duplicates are harmless.
+inline constexpr XrStructureType indexed_struct_types[] = {
+<%utils:for_grouped_structs xr_structs_only="True" args="struct">\
+    ${struct.xr_type},
+</%utils:for_grouped_structs>
+};
+
+namespace struct_index_detail {
+
+// Core XrStructureType values are small and used directly as indices. Values from extensions
+// (and from extensions promoted into feature levels) are 1000000000 + (extnumber - 1) * 1000 + offset,
+// so they are split into an extension slot and an offset within that slot.
+constexpr std::int32_t extension_type_base = 1000000000;
+constexpr std::int32_t extension_type_stride = 1000;
+
+struct ExtensionRange {
+    std::uint32_t base;
+    std::uint32_t count;
+};
+
+constexpr bool is_extension_type(XrStructureType struct_type) {
+    return struct_type >= extension_type_base;
+}
+
+constexpr std::size_t extension_slot(XrStructureType struct_type) {
+    return static_cast<std::size_t>((struct_type - extension_type_base) / extension_type_stride);
+}
+
+constexpr std::size_t extension_offset(XrStructureType struct_type) {
+    return static_cast<std::size_t>((struct_type - extension_type_base) % extension_type_stride);
+}
+
+constexpr std::size_t compute_core_count() {
+    std::size_t count = 0;
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (!is_extension_type(struct_type)) {
+            count = std::max(count, static_cast<std::size_t>(struct_type) + 1);
+        }
+    }
+    return count;
+}
+
+constexpr std::size_t compute_extension_slot_count() {
+    std::size_t count = 0;
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (is_extension_type(struct_type)) {
+            count = std::max(count, extension_slot(struct_type) + 1);
+        }
+    }
+    return count;
+}
+
+constexpr std::size_t core_count = compute_core_count();
+constexpr std::size_t extension_slot_count = compute_extension_slot_count();
+
+constexpr std::array<ExtensionRange, extension_slot_count> compute_extension_ranges() {
+    std::array<ExtensionRange, extension_slot_count> ranges{};
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (is_extension_type(struct_type)) {
+            ExtensionRange& range = ranges[extension_slot(struct_type)];
+            range.count = std::max(range.count, static_cast<std::uint32_t>(extension_offset(struct_type) + 1));
+        }
+    }
+    // extension slots are packed one after the other, after the core types
+    std::uint32_t next_base = static_cast<std::uint32_t>(core_count);
+    for (std::size_t i = 0; i < extension_slot_count; i++) {
+        ranges[i].base = next_base;
+        next_base += ranges[i].count;
+    }
+    return ranges;
+}
+
+constexpr std::array<ExtensionRange, extension_slot_count> extension_ranges = compute_extension_ranges();
+
+constexpr std::size_t compute_table_size() {
+    std::size_t size = core_count;
+    for (const ExtensionRange& range : extension_ranges) {
+        size += range.count;
+    }
+    return size;
+}
+
+} // namespace struct_index_detail
+
+// Number of slots in a dense struct table. Slot struct_table_size itself is reserved for unknown
+// types and is always empty, which is why the tables have one extra element.
+inline constexpr std::size_t struct_table_size = struct_index_detail::compute_table_size();
+
+// Maps an XrStructureType to its slot in a dense struct table, or struct_table_size if the
+// serializer was not built for it.
+constexpr std::size_t struct_type_index(XrStructureType struct_type) {
+    using namespace struct_index_detail;
+    if (struct_type < 0) {
+        return struct_table_size;
+    }
+    if (!is_extension_type(struct_type)) {
+        std::size_t index = static_cast<std::size_t>(struct_type);
+        return index < core_count ? index : struct_table_size;
+    }
+    std::size_t slot = extension_slot(struct_type);
+    if (slot >= extension_slot_count) {
+        return struct_table_size;
+    }
+    const ExtensionRange& range = extension_ranges[slot];
+    std::size_t offset = extension_offset(struct_type);
+    return offset < range.count ? range.base + offset : struct_table_size;
+}
+
+template <typename T>
+struct StructTableEntry {
+    XrStructureType type;
+    T value;
+};
+
+// Builds a dense table at compile time. Slots without an entry are value-initialized, so lookups
+// of unknown types yield 0 or nullptr.
+template <typename T, std::size_t N>
+constexpr std::array<T, struct_table_size + 1> make_struct_table(const StructTableEntry<T> (&entries)[N]) {
+    std::array<T, struct_table_size + 1> table{};
+    for (std::size_t i = 0; i < N; i++) {
+        table[struct_type_index(entries[i].type)] = entries[i].value;
+    }
+    return table;
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_STRUCT_INDEX_GENERATED_H
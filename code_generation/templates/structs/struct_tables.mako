@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+<%namespace name="utils" file="utils.mako"/>\
+<%def name="field(struct, member)">\
+<% member_struct = spec.find_struct(member.type) %>\
+## Same cases as serialize_member in utils.mako
+% if member.pointer and member.array:
+#error "auto-generator doesn't support array of pointers (${struct.name}::${member.name})"\
+% elif member.pointer and member.pointer != "*":
+#error "auto-generator doesn't support double pointers (${struct.name}::${member.name})"\
+% elif member.len and "," in member.len:
+#error "auto-generator doesn't support multi-variable lengths (${struct.name}::${member.name})"\
+% elif member.pointer and member.len and member_struct and member_struct.header:
+FIELD_XR_ARRAY(${struct.name}, ${member.name}, ${member.len}),\
+% elif (member.type == "void" and member.pointer == "*" and member.name == "next") or (member_struct and member_struct.header):
+FIELD_XR(${struct.name}, ${member.name}),\
+% elif member.type == "char" and member.pointer and member.len == "null-terminated":
+FIELD_STRING(${struct.name}, ${member.name}),\
+% elif member.pointer and member.len == "null-terminated":
+#error "table-driven serialization doesn't support null-terminated arrays (${struct.name}::${member.name})"\
+% elif member.pointer and member.len and getattr(member, "quantized_extension", None):
+FIELD_QUANTIZABLE_PTR(${struct.name}, ${member.name}, ${member.len}, QUANTIZED_${member.quantized_extension}),\
+% elif member.pointer and member.len:
+FIELD_PTR(${struct.name}, ${member.name}, ${member.len}),\
+% elif member.pointer:
+FIELD_SINGLE_PTR(${struct.name}, ${member.name}),\
+% elif member.array and member.type == "char":
+FIELD_STRING_ARRAY(${struct.name}, ${member.name}),\
+% elif member.array:
+FIELD_ARRAY(${struct.name}, ${member.name}),\
+% elif member.type == "XrTime":
+FIELD_TIME(${struct.name}, ${member.name}),\
+% else:
+FIELD_VALUE(${struct.name}, ${member.name}),\
+% endif
+</%def>
+
+<%def name="struct_table(struct)">\
+constexpr FieldDescriptor fields_${struct.name}[] = {
+% for member in struct.members:
+    ${field(struct, member)}
+% endfor
+};
+
+void serialize(const ${struct.name}* s, SerializeContext& ctx) {
+% if struct.header:
+    serialize_xr(s, ctx);
+% else:
+    serialize_fields(s, fields_${struct.name}, ctx);
+% endif
+}
+
+void deserialize(${struct.name}* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_${struct.name}, ctx);
+}
+
+void cleanup(const ${struct.name}* s) {
+    cleanup_fields(s, fields_${struct.name});
+}\
+</%def>
+
+// Field tables for table-driven serialization, see table_serialization.h. Used instead of the generated
+// serializers, deserializers and cleaners in serializer.cpp and deserializer.cpp.
+
+#include "xrtransport/serialization/table_serialization.h"
+
+#ifdef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+namespace xrtransport {
+
+<%utils:for_grouped_structs args="struct">\
+% if not struct.custom:
+${struct_table(struct)}
+
+% endif
+</%utils:for_grouped_structs>
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
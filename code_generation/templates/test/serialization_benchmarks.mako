@@ -0,0 +1,271 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+<%namespace name="utils" file="utils.mako"/>\
+<%
+    functions = spec.extensions[None].functions
+    benchmark_functions = [f for f in functions if struct_generator.can_plan_params(f)]
+    skipped_functions = [f for f in functions if not struct_generator.can_plan_params(f)]
+%>\
+// Measures the serialization cost of every core struct and of the params of every core function.
+// The values are generated the same way as in fuzzer.cpp, but every pointer is filled in and no
+// next chains are added, so that each result only covers the struct itself.
+//
+// Usage: serialization_benchmarks [--iterations N] [output.json]
+// Results are written as JSON to the output file, or stdout if none is given. Build once with and once
+// without XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION to compare both modes.
+
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/asio_compat.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+
+namespace {
+
+// Simple FIFO stream buffer, like the one in fuzzer.cpp
+class BenchmarkStreamBuffer : public SyncDuplexStream {
+private:
+    std::vector<char> buffer_;
+    std::size_t read_pos_ = 0;
+
+public:
+    void close() override {}
+
+    void close(asio::error_code& ec) override {
+        ec.clear();
+    }
+
+    std::size_t read_some(const asio::mutable_buffer& buffers) override {
+        asio::error_code ec;
+        return read_some(buffers, ec);
+    }
+
+    std::size_t read_some(const asio::mutable_buffer& buffers, asio::error_code& ec) override {
+        ec.clear();
+        std::size_t to_read = std::min(buffers.size(), buffer_.size() - read_pos_);
+        std::memcpy(buffers.data(), buffer_.data() + read_pos_, to_read);
+        read_pos_ += to_read;
+        return to_read;
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffers) override {
+        asio::error_code ec;
+        return write_some(buffers, ec);
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffers, asio::error_code& ec) override {
+        ec.clear();
+        const char* data = static_cast<const char*>(buffers.data());
+        buffer_.insert(buffer_.end(), data, data + buffers.size());
+        return buffers.size();
+    }
+
+    void clear() {
+        buffer_.clear();
+        read_pos_ = 0;
+    }
+
+    std::size_t size() const {
+        return buffer_.size();
+    }
+};
+
+struct BenchmarkResult {
+    const char* name;
+    double bytes;
+    double serialize_ns;
+    double deserialize_ns;
+    double cleanup_ns;
+    // one serialize, deserialize and cleanup before any other, with cold caches
+    double first_ns;
+};
+
+#ifdef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+constexpr const char* SERIALIZATION_MODE = "table";
+#else
+constexpr const char* SERIALIZATION_MODE = "generated";
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+double ns_per_op(Clock::time_point start, Clock::time_point end, std::size_t iterations) {
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// Serializes item iterations times, then deserializes and cleans up every copy
+template <typename T, typename Serialize, typename Deserialize, typename Cleanup>
+BenchmarkResult run_benchmark(const char* name, const T& item, std::size_t iterations,
+    Serialize serialize_item, Deserialize deserialize_item, Cleanup cleanup_item)
+{
+    BenchmarkStreamBuffer buffer;
+    // the first call pays for cold instruction caches, like at startup or for rarely used structs
+    auto first_start = Clock::now();
+    {
+        SerializeContext s_ctx(buffer);
+        serialize_item(item, s_ctx);
+        T first{};
+        DeserializeContext d_ctx(buffer);
+        deserialize_item(first, d_ctx);
+        cleanup_item(first);
+    }
+    auto first_end = Clock::now();
+    buffer.clear();
+
+    // warm up, so that the buffer doesn't grow while timing
+    {
+        SerializeContext s_ctx(buffer);
+        for (std::size_t i = 0; i < iterations; i++) {
+            serialize_item(item, s_ctx);
+        }
+    }
+    buffer.clear();
+
+    SerializeContext s_ctx(buffer);
+    auto serialize_start = Clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        serialize_item(item, s_ctx);
+    }
+    auto serialize_end = Clock::now();
+
+    std::vector<T> items(iterations);
+    DeserializeContext d_ctx(buffer);
+    auto deserialize_start = Clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        deserialize_item(items[i], d_ctx);
+    }
+    auto deserialize_end = Clock::now();
+
+    auto cleanup_start = Clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        cleanup_item(items[i]);
+    }
+    auto cleanup_end = Clock::now();
+
+    return BenchmarkResult{
+        name,
+        static_cast<double>(buffer.size()) / iterations,
+        ns_per_op(serialize_start, serialize_end, iterations),
+        ns_per_op(deserialize_start, deserialize_end, iterations),
+        ns_per_op(cleanup_start, cleanup_end, iterations),
+        ns_per_op(first_start, first_end, 1),
+    };
+}
+
+template <typename T>
+BenchmarkResult run_struct_benchmark(const char* name, const T& item, std::size_t iterations) {
+    return run_benchmark(name, item, iterations,
+        [](const T& item, SerializeContext& ctx) { serialize(&item, ctx); },
+        [](T& item, DeserializeContext& ctx) { deserialize(&item, ctx); },
+        [](T& item) { cleanup(&item); });
+}
+
+//
+// Structs
+//
+
+% for struct in struct_generator.test_structs:
+BenchmarkResult benchmark_${struct.name}(std::size_t iterations) {
+${struct_generator.init_struct(struct_generator.generate_plan(struct), "item", "    ")}
+    return run_struct_benchmark("${struct.name}", item, iterations);
+}
+
+% endfor
+//
+// Function params, as sent in XRTP_MSG_FUNCTION_CALL
+//
+% if skipped_functions:
+// Not benchmarked because their params contain custom or header structs:
+% for function in skipped_functions:
+// - ${function.name}
+% endfor
+% endif
+
+% for function in benchmark_functions:
+BenchmarkResult benchmark_${function.name}(std::size_t iterations) {
+    struct Args {
+% for param in function.params:
+        ${param.declaration(with_qualifier=bool(param.pointer), value_initialize=True)};
+% endfor
+    };
+${struct_generator.init_struct(struct_generator.plan_params(function, "Args"), "args", "    ")}
+    return run_benchmark("${function.name}", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+% for param in function.params:
+            ${utils.serialize_param(param, binding_prefix='args.', ctx_var='ctx')}
+% endfor
+        },
+        [](Args& args, DeserializeContext& ctx) {
+% for param in function.params:
+            ${utils.deserialize_param(param, binding_prefix='args.', ctx_var='ctx')}
+% endfor
+        },
+        [](Args& args) {
+% for param in function.params:
+            ${utils.cleanup_member(param, binding_prefix='args.')}
+% endfor
+        });
+}
+
+% endfor
+void write_results(std::FILE* out, const char* key, const std::vector<BenchmarkResult>& results) {
+    std::fprintf(out, "  \"%s\": [\n", key);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        std::fprintf(out,
+            "    {\"name\": \"%s\", \"bytes\": %.1f, \"serialize_ns\": %.1f, \"deserialize_ns\": %.1f, \"cleanup_ns\": %.1f, \"first_ns\": %.1f}%s\n",
+            result.name, result.bytes, result.serialize_ns, result.deserialize_ns, result.cleanup_ns, result.first_ns,
+            i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t iterations = 1000;
+    const char* output_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else {
+            output_path = argv[i];
+        }
+    }
+    if (iterations == 0) {
+        std::fprintf(stderr, "usage: %s [--iterations N] [output.json]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> struct_results;
+% for struct in struct_generator.test_structs:
+    struct_results.push_back(benchmark_${struct.name}(iterations));
+% endfor
+
+    std::vector<BenchmarkResult> function_results;
+% for function in benchmark_functions:
+    function_results.push_back(benchmark_${function.name}(iterations));
+% endfor
+
+    std::FILE* out = output_path ? std::fopen(output_path, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "failed to open %s\n", output_path);
+        return 1;
+    }
+    std::fprintf(out, "{\n  \"mode\": \"%s\",\n  \"iterations\": %zu,\n", SERIALIZATION_MODE, iterations);
+    write_results(out, "structs", struct_results);
+    std::fprintf(out, ",\n");
+    write_results(out, "functions", function_results);
+    std::fprintf(out, "\n}\n");
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+<%namespace name="tables" file="structs/struct_tables.mako"/>\
+// Checks that the field tables of struct_tables.cpp produce the same bytes as the generated struct
+// serializers, for a random value of every core struct. The tables are the ones struct_tables.cpp is
+// generated with, and the values are generated the same way as in fuzzer.cpp.
+//
+// With XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION, serialize itself walks these tables, so there is nothing
+// to compare them to and the checks are compiled out.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/table_serialization.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstddef>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+namespace {
+
+% for struct in struct_generator.test_structs:
+constexpr FieldDescriptor fields_${struct.name}[] = {
+% for member in struct.members:
+    ${tables.field(struct, member)}
+% endfor
+};
+
+% endfor
+// Nonzero, so that times which aren't converted or are converted twice change the bytes
+constexpr XrDuration TIME_OFFSET = 1'000'000'000;
+
+// Serializes item with the generated serializer and with fields, then deserializes the bytes with
+// fields and serializes the result with the generated serializer again. Compact encoding sends
+// counts, enums and handles differently, so it is checked separately.
+template <typename T, std::size_t N>
+void check_same_bytes(const T& item, const FieldDescriptor (&fields)[N], bool compact) {
+    HandleInterner generated_handles;
+    ByteQueue generated;
+    SerializeContext generated_ctx(generated, TIME_OFFSET);
+    generated_ctx.handles = compact ? begin_handles(&generated_handles) : nullptr;
+    serialize(&item, generated_ctx);
+
+    HandleInterner table_handles;
+    ByteQueue table;
+    SerializeContext table_ctx(table, TIME_OFFSET);
+    table_ctx.handles = compact ? begin_handles(&table_handles) : nullptr;
+    serialize_fields(&item, fields, table_ctx);
+    REQUIRE(table.bytes == generated.bytes);
+
+    HandleTable received_handles;
+    T deserialized{};
+    DeserializeContext d_ctx(table, false, TIME_OFFSET);
+    d_ctx.handles = compact ? &received_handles : nullptr;
+    deserialize_fields(&deserialized, fields, d_ctx);
+    CHECK(table.unread() == 0);
+
+    HandleInterner round_trip_handles;
+    ByteQueue round_trip;
+    SerializeContext round_trip_ctx(round_trip, TIME_OFFSET);
+    round_trip_ctx.handles = compact ? begin_handles(&round_trip_handles) : nullptr;
+    serialize(&deserialized, round_trip_ctx);
+    CHECK(round_trip.bytes == generated.bytes);
+
+    cleanup_fields(&deserialized, fields);
+}
+
+} // namespace
+
+TEST_CASE("Struct tables match the generated serializers", "[table_serialization]") {
+% for struct in struct_generator.test_structs:
+    SECTION("${struct.name}") {
+${struct_generator.init_struct(struct_generator.generate_plan(struct), "item", "        ")}
+        check_same_bytes(item, fields_${struct.name}, false);
+        check_same_bytes(item, fields_${struct.name}, true);
+    }
+% endfor
+}
+
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
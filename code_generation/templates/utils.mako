@@ -20,16 +20,25 @@
 serialize_xr_array(${binding_prefix}${member.name}, ${binding_prefix}${member.len}, ${ctx_var});\
 % elif (member.type == "void" and member.pointer == "*" and member.name == "next") or (member_struct and member_struct.header):
 serialize_xr(${binding_prefix}${member.name}, ${ctx_var});\
+% elif member.type == "char" and member.pointer and member.len == "null-terminated":
+serialize_string(${binding_prefix}${member.name}, ${ctx_var});\
 % elif member.pointer and member.len:
 <%
     if member.len == "null-terminated":
         count = f"count_null_terminated({binding_prefix}{member.name})"
     else:
         count = f"{binding_prefix}{member.len}"
+    quantized_extension = getattr(member, "quantized_extension", None)
 %>\
+% if quantized_extension:
+serialize_quantizable_ptr(${binding_prefix}${member.name}, ${count}, QUANTIZED_${quantized_extension}, ${ctx_var});\
+% else:
 serialize_ptr(${binding_prefix}${member.name}, ${count}, ${ctx_var});\
+% endif
 % elif member.pointer:
 serialize_ptr(${binding_prefix}${member.name}, 1, ${ctx_var});\
+% elif member.array and member.type == "char":
+serialize_string_array(${binding_prefix}${member.name}, ${member.array}, ${ctx_var});\
 % elif member.array:
 serialize_array(${binding_prefix}${member.name}, ${member.array}, ${ctx_var});\
 % elif member.type == "XrTime":
@@ -59,8 +68,14 @@ serialize(&${binding_prefix}${member.name}, ${ctx_var});\
 deserialize_xr_array(&${binding_prefix}${member.name}, ${ctx_var});\
 % elif (member.type == "void" and member.pointer == "*" and member.name == "next") or (member_struct and member_struct.header):
 deserialize_xr(&${binding_prefix}${member.name}, ${ctx_var});\
+% elif member.type == "char" and member.pointer and member.len == "null-terminated":
+deserialize_string(&${binding_prefix}${member.name}, ${ctx_var});\
+% elif member.pointer and getattr(member, "quantized_extension", None):
+deserialize_quantizable_ptr(&${binding_prefix}${member.name}, ${ctx_var});\
 % elif member.pointer:
 deserialize_ptr(&${binding_prefix}${member.name}, ${ctx_var});\
+% elif member.array and member.type == "char":
+deserialize_string_array(${binding_prefix}${member.name}, ${member.array}, ${ctx_var});\
 % elif member.array:
 deserialize_array(${binding_prefix}${member.name}, ${member.array}, ${ctx_var});\
 % elif member.type == "XrTime":
@@ -107,14 +122,54 @@ cleanup(&${binding_prefix}${member.name});\
 % endif
 </%def>
 
-<%def name="serialize_binding(binding, ctx_var='ctx')">\
+<%def name="serialize_param(param, binding_prefix='', ctx_var='ctx')">\
+## Pure output params only send their length, see bindings.py
+% if getattr(param, "output", False):
+<%
+    param_struct = spec.find_struct(param.type)
+    count = f"{binding_prefix}{param.len}" if param.len else "1"
+%>\
+% if param_struct and param_struct.xr_type:
+serialize_output_xr_ptr(${binding_prefix}${param.name}, ${count}, ${ctx_var});\
+% else:
+serialize_output_ptr(${binding_prefix}${param.name}, ${count}, ${ctx_var});\
+% endif
+% else:
+${serialize_member(param, binding_prefix, ctx_var)}\
+% endif
+</%def>
+
+<%def name="deserialize_param(param, binding_prefix='', ctx_var='ctx')">\
+% if getattr(param, "output", False):
+<% param_struct = spec.find_struct(param.type) %>\
+% if param_struct and param_struct.xr_type:
+deserialize_output_xr_ptr(&${binding_prefix}${param.name}, ${ctx_var});\
+% else:
+deserialize_output_ptr(&${binding_prefix}${param.name}, ${ctx_var});\
+% endif
+% else:
+${deserialize_member(param, binding_prefix, ctx_var)}\
+% endif
+</%def>
+
+<%def name="serialize_binding(binding, ctx_var='ctx', result_var='_result')">\
 % for _loop in binding.loops:
 for (int ${_loop.var} = ${_loop.base}; ${_loop.var} < ${_loop.end}; ${_loop.var}++) {\
 % endfor
-% if binding.type == "xr_array":
+## Two-call idiom arrays only send what the runtime filled in, see bindings.py
+% if binding.count_output:
+<% count = f"XR_SUCCEEDED({result_var}) && {binding.count_output} ? *{binding.count_output} : 0" %>\
+% endif
+% if binding.count_output and binding.type == "xr_array":
+serialize_filled_xr_array(${binding.binding_str}, ${binding.len}, ${count}, ${ctx_var});\
+% elif binding.count_output:
+serialize_filled_ptr(${binding.binding_str}, ${binding.len}, ${count}, ${ctx_var});\
+% elif binding.type == "xr_array":
 serialize_xr_array(${binding.binding_str}, ${binding.len}, ${ctx_var});\
 % elif binding.type == "xr":
 serialize_xr(${binding.binding_str}, ${ctx_var});\
+% elif (binding.type == "sized_ptr" or binding.type == "array") and binding.param.type == "char":
+serialize_string_buffer(${binding.binding_str}, ${binding.len}, ${ctx_var});\
 % elif binding.type == "sized_ptr" or binding.type == "array":
 serialize_ptr(${binding.binding_str}, ${binding.len}, ${ctx_var});\
 % elif binding.type == "ptr":
@@ -133,10 +188,16 @@ serialize(&${binding.binding_str}, ${ctx_var});\
 % for _loop in binding.loops:
 for (int ${_loop.var} = ${_loop.base}; ${_loop.var} < ${_loop.end}; ${_loop.var}++) {\
 % endfor
-% if binding.type == "xr_array":
+% if binding.count_output and binding.type == "xr_array":
+deserialize_filled_xr_array(${binding.binding_str}, ${binding.len}, ${ctx_var});\
+% elif binding.count_output:
+deserialize_filled_ptr(${binding.binding_str}, ${binding.len}, ${ctx_var});\
+% elif binding.type == "xr_array":
 deserialize_xr_array(&${binding.binding_str}, ${ctx_var});\
 % elif binding.type == "xr":
 deserialize_xr(&${binding.binding_str}, ${ctx_var});\
+% elif (binding.type == "sized_ptr" or binding.type == "array") and binding.param.type == "char":
+deserialize_string_buffer(${binding.binding_str}, ${binding.len}, ${ctx_var});\
 % elif binding.type == "sized_ptr" or binding.type == "ptr" or binding.type == "array":
 deserialize_ptr(&${binding.binding_str}, ${ctx_var});\
 % elif binding.param.type == "XrTime":
@@ -149,13 +210,14 @@ deserialize(&${binding.binding_str}, ${ctx_var});\
 % endfor
 </%def>
 
-<%def name="for_grouped_structs(xr_structs_only=False)">\
+<%def name="for_grouped_structs(xr_structs_only=False, quantized_only=False)">\
 % for ext_name, extension in spec.extensions.items():
-% if extension.structs:
+<% structs = [struct for struct in extension.structs or () if not quantized_only or struct.name in spec.quantized_structs] %>\
+% if structs:
 % if ext_name:
 #ifdef XRTRANSPORT_EXT_${ext_name}
 % endif
-% for struct in extension.structs:
+% for struct in structs:
 % if not xr_structs_only or struct.xr_type:
 ${caller.body(struct=struct)}\
 % endif
@@ -167,13 +229,14 @@ ${caller.body(struct=struct)}\
 % endfor
 </%def>
 
-<%def name="for_grouped_functions()">\
+<%def name="for_grouped_functions(packed_only=False, pipelined_only=False, oneway_only=False, sampled_only=False)">\
 % for ext_name, extension in spec.extensions.items():
-% if extension.functions:
+<% functions = [function for function in extension.functions if (not packed_only or function.packed) and (not pipelined_only or function.pipelined) and (not oneway_only or function.oneway) and (not sampled_only or function.sampled)] %>\
+% if functions:
 % if ext_name:
 #ifdef XRTRANSPORT_EXT_${ext_name}
 % endif
-% for function in extension.functions:
+% for function in functions:
 ${caller.body(function=function)}\
 % endfor
 % if ext_name:
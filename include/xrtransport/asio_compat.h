@@ -41,6 +41,13 @@ public:
     virtual std::size_t read_some(const asio::mutable_buffer& buffers) = 0;
     virtual std::size_t read_some(const asio::mutable_buffer& buffers, asio::error_code& ec) = 0;
 
+    // Consume the next size bytes without copying them, if the stream holds them in memory and they are
+    // aligned to alignment. Returns nullptr and consumes nothing otherwise. The bytes stay valid for as
+    // long as the data the stream reads from, see the implementations.
+    virtual const void* borrow(std::size_t size, std::size_t alignment) {
+        return nullptr;
+    }
+
     // Template convenience methods for ASIO compatibility
     template<typename MutableBufferSequence>
     std::size_t read_some(const MutableBufferSequence& buffers) {
@@ -4,6 +4,7 @@
 #define XRTRANSPORT_CONFIG_H
 
 #include <string>
+#include <vector>
 #include <cstdint>
 #include <stdexcept>
 
@@ -31,6 +32,62 @@ struct Config {
 
     // Filled in for TransportType::UNIX
     std::string unix_path;
+
+    // Optional protocol features requested from the server. All default to off.
+
+    // Send function params as a delta against the previous call to the same function
+    bool delta_encoding = false;
+
+    // Extensions (e.g. XR_EXT_hand_tracking) whose joint, pose and weight arrays are sent quantized
+    std::vector<std::string> quantized_extensions;
+
+    // Send repeated strings (names, paths) as ids into a per-connection string table
+    bool string_interning = false;
+
+    // Send counts and enums as varints, and handles as ids into a per-connection handle table
+    bool compact_encoding = false;
+
+    // Return handles from xrCreateActionSet, xrCreateAction, xrCreateActionSpace and xrCreateReferenceSpace
+    // without waiting for the server. Requires compact_encoding.
+    bool pipelined_creation = false;
+
+    // Send calls that only return a result, like xrApplyHapticFeedback and most xrDestroy* calls, without
+    // waiting for the server. Failures are reported by the next synchronous call.
+    bool oneway_calls = false;
+
+    // Have the server wait for the next frame as soon as xrEndFrame returns, so that xrWaitFrame
+    // usually doesn't wait for a round trip, and send xrBeginFrame without waiting for the server
+    bool frame_loop_fusion = false;
+
+    // Have the server locate the views of each frame along with its speculative xrWaitFrame, so that
+    // xrLocateViews at the predicted display time doesn't wait for the server. Requires frame_loop_fusion.
+    bool view_prefetch = false;
+
+    // Have the server locate the spaces that were located at the predicted display time of the last frame
+    // along with each speculative xrWaitFrame, so that xrLocateSpace for them doesn't wait for the server.
+    // Requires frame_loop_fusion.
+    bool space_prefetch = false;
+
+    // Have the server call the hand, body, eye and face tracking functions that were called at the
+    // predicted display time of the last frame again along with each speculative xrWaitFrame, so that
+    // those calls don't wait for the server. Requires frame_loop_fusion.
+    bool tracker_sampling = false;
+
+    // Have the server stamp every function return with the times it received the call and sent the
+    // response, so that every call is a sample for clock synchronization.
+    bool inband_timestamps = false;
+
+    // Check during the handshake whether the server runs on the same kernel, e.g. in Waydroid, and if
+    // so compute the time offset once exactly instead of synchronizing the clocks.
+    bool shared_clock = false;
+
+    // Keep the results of instance and system queries like xrGetSystemProperties on the client.
+    // Only client side, so it isn't negotiated.
+    bool query_cache = true;
+
+    // Answer xrGetActionState* calls from the states fetched with the last xrSyncActions.
+    // Only client side, so it isn't negotiated.
+    bool action_state_snapshot = true;
 };
 
 // Read and parse JSON file
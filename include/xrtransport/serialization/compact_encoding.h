@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_COMPACT_ENCODING_H
+#define XRTRANSPORT_COMPACT_ENCODING_H
+
+#include "serializer.h"
+#include "deserializer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Compact encoding (XRTP_FEATURE_COMPACT_ENCODING)
+ *
+ * Most of what is sent are small numbers at full width: counts, lengths, XrBool32, enums and handles.
+ * When this feature is negotiated, the generic serialize and deserialize (see is_compact) send these
+ * types more compactly, which covers every generated struct and function param at once:
+ * - uint32_t (counts, array lengths, pointer markers, XrBool32, flags): LEB128 varint
+ * - XrStructureType: varint struct code, see below
+ * - other enums: zigzag varint of the value
+ * - handles: varint tag into a per-connection handle table, see below
+ * Everything else, including times and 64-bit ids like XrPath, is sent as before.
+ *
+ * Struct codes:
+ * - 0 to 63: the core struct types, whose values are all below 64
+ * - 64 + i: COMPACT_STRUCT_TYPES[i], extension types that are sent often
+ * - 128 + ((value - 1000000000) << 1): any other extension type
+ * - 128 + ((value << 1) | 1): anything else
+ * so that core and common types take one byte, and other extension types three.
+ *
+ * Handles work like interned strings (see string_interning.h). Each direction of the connection keeps a
+ * table: the first time a handle is sent it is assigned the next id, and afterwards only the id is
+ * sent. Handles are plain values to the table, so destroyed handles don't need to be removed. Every
+ * handle starts with a varint tag:
+ * - 0: XR_NULL_HANDLE
+ * - (id << 1) | 1: a handle that was sent before
+ * - 2: a new handle, followed by its 64-bit value
+ *
+ * Handles are only distinct types on 64-bit platforms, so the feature is only supported there.
+ */
+
+constexpr std::size_t MAX_HANDLE_IDS = 4096;
+
+/**
+ * Assigns ids to the handles sent in one direction. Like StringInterner, handles added while
+ * serializing a message only become permanent once the message was sent (see begin_handles and
+ * commit_handles).
+ */
+class HandleInterner {
+private:
+    std::vector<std::uint64_t> handles;
+    std::unordered_map<std::uint64_t, std::uint32_t> ids;
+    // number of handles added since the last commit
+    std::size_t pending = 0;
+
+public:
+    /**
+     * @return The id of a handle that was sent before, or nullptr
+     */
+    const std::uint32_t* find(std::uint64_t handle) const;
+
+    /**
+     * Assigns the next id to a handle that is about to be sent in full, if the table isn't full.
+     */
+    void add(std::uint64_t handle);
+
+    void commit();
+    void rollback();
+
+    std::size_t size() const {
+        return handles.size();
+    }
+};
+
+class VirtualHandleMap;
+
+/**
+ * Receiving side of a HandleInterner.
+ */
+class HandleTable {
+private:
+    std::vector<std::uint64_t> handles;
+    const VirtualHandleMap* virtual_handles = nullptr;
+
+public:
+    void add(std::uint64_t handle);
+
+    /**
+     * Resolve new handles through virtual_handles before they are added, see virtual_handles.h.
+     */
+    void set_virtual_handles(const VirtualHandleMap* virtual_handles) {
+        this->virtual_handles = virtual_handles;
+    }
+
+    /**
+     * @return The real handle of a new handle that was received
+     */
+    std::uint64_t resolve(std::uint64_t handle) const;
+
+    /**
+     * @throws CompactEncodingException if the id was never assigned
+     */
+    std::uint64_t get(std::uint64_t id) const;
+
+    std::size_t size() const {
+        return handles.size();
+    }
+};
+
+/**
+ * Extension struct types that get a one byte struct code. Append only, the index is the code.
+ */
+extern const XrStructureType COMPACT_STRUCT_TYPES[];
+extern const std::size_t COMPACT_STRUCT_TYPE_COUNT;
+
+std::uint64_t struct_type_code(XrStructureType type);
+
+/**
+ * @throws CompactEncodingException if the code is out of range
+ */
+XrStructureType struct_type_from_code(std::uint64_t code);
+
+/**
+ * Prepares a handle interner for a new message, dropping handles added by a message that was never sent.
+ * @return handles, which is nullptr if compact encoding was not negotiated
+ */
+inline HandleInterner* begin_handles(HandleInterner* handles) {
+    if (handles) {
+        handles->rollback();
+    }
+    return handles;
+}
+
+/**
+ * Makes the handles added while serializing a message permanent. Call once the message was sent.
+ */
+inline void commit_handles(SerializeContext& ctx) {
+    if (ctx.handles) {
+        ctx.handles->commit();
+    }
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_COMPACT_ENCODING_H
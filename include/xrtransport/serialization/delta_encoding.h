@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_DELTA_ENCODING_H
+#define XRTRANSPORT_DELTA_ENCODING_H
+
+#include "xrtransport/asio_compat.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Request delta encoding (XRTP_FEATURE_DELTA_ENCODING)
+ *
+ * Per-frame calls like xrSyncActions, xrLocateViews and xrEndFrame send nearly the same params every
+ * frame. When this feature is negotiated, the client remembers the last serialized params of every
+ * function and only sends the byte ranges that changed. The server keeps the same history and rebuilds
+ * the full params before deserializing them.
+ *
+ * Each function has a few history slots so that calls alternating between handles (e.g. the left and
+ * right hand tracker) don't keep evicting each other. The client picks the slot by the first 8 bytes of
+ * the params, which is the handle for almost every function, and sends the slot index along.
+ *
+ * Params section of XRTP_MSG_FUNCTION_CALL when enabled:
+ * - slot (uint8_t)
+ * - mode (uint8_t): DELTA_MODE_FULL or DELTA_MODE_DELTA
+ * - size of the rebuilt params (uint32_t)
+ * - DELTA_MODE_FULL: the params
+ * - DELTA_MODE_DELTA: runs until size is covered, each one is
+ *   - unchanged byte count (LEB128 varint)
+ *   - changed byte count (LEB128 varint)
+ *   - changed bytes
+ *   Bytes past the end of the previous params are compared against zero.
+ */
+
+constexpr std::uint8_t DELTA_MODE_FULL = 0;
+constexpr std::uint8_t DELTA_MODE_DELTA = 1;
+
+constexpr std::size_t DELTA_SLOTS_PER_FUNCTION = 4;
+
+/**
+ * Client side of request delta encoding. Must only be used while holding the message lock.
+ */
+class DeltaEncoder {
+private:
+    struct Slot {
+        bool used = false;
+        std::uint64_t key = 0;
+        std::vector<std::uint8_t> params;
+    };
+
+    struct FunctionHistory {
+        std::array<Slot, DELTA_SLOTS_PER_FUNCTION> slots;
+        std::uint8_t next_evicted = 0;
+    };
+
+    std::unordered_map<std::uint32_t, FunctionHistory> history;
+
+    // reused between requests to avoid allocating every call
+    std::vector<std::uint8_t> params_buffer;
+    std::vector<std::uint8_t> runs_buffer;
+
+public:
+    /**
+     * Returns an empty buffer for the params of the next request to be serialized into.
+     */
+    std::vector<std::uint8_t>& begin_request() {
+        params_buffer.clear();
+        return params_buffer;
+    }
+
+    /**
+     * Writes the params collected since begin_request to out, delta encoded against the last params
+     * sent for the same function and handle.
+     */
+    void encode(std::uint32_t function_id, SyncWriteStream& out);
+};
+
+/**
+ * Server side of request delta encoding.
+ */
+class DeltaDecoder {
+private:
+    std::unordered_map<std::uint32_t, std::array<std::vector<std::uint8_t>, DELTA_SLOTS_PER_FUNCTION>> history;
+
+public:
+    /**
+     * Reads the encoded params of one request and returns the rebuilt params. The reference stays
+     * valid until the next request to the same function is decoded.
+     */
+    const std::vector<std::uint8_t>& decode(std::uint32_t function_id, SyncReadStream& in);
+};
+
+/**
+ * Stream that request params are serialized into. Passes writes straight through to the message if
+ * delta encoding is disabled (encoder is nullptr).
+ */
+class DeltaWriteStream : public SyncWriteStream {
+private:
+    SyncWriteStream& out;
+    DeltaEncoder* encoder;
+    std::uint32_t function_id;
+    std::vector<std::uint8_t>* params;
+
+public:
+    DeltaWriteStream(SyncWriteStream& out, DeltaEncoder* encoder, std::uint32_t function_id)
+        : out(out), encoder(encoder), function_id(function_id),
+        params(encoder ? &encoder->begin_request() : nullptr)
+    {}
+
+    std::size_t write_some(const asio::const_buffer& buffer, asio::error_code& ec) override {
+        if (!encoder) {
+            return out.write_some(buffer, ec);
+        }
+        ec.clear();
+        const std::uint8_t* data = static_cast<const std::uint8_t*>(buffer.data());
+        params->insert(params->end(), data, data + buffer.size());
+        return buffer.size();
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer) override {
+        asio::error_code ec;
+        std::size_t size_written = write_some(buffer, ec);
+        if (ec) {
+            throw asio::system_error(ec);
+        }
+        return size_written;
+    }
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+
+    /**
+     * Must be called once all params are serialized, before the message is flushed.
+     */
+    void finish() {
+        if (encoder) {
+            encoder->encode(function_id, out);
+        }
+    }
+};
+
+/**
+ * Reads from params rebuilt by DeltaDecoder.
+ */
+class DeltaReadStream : public SyncReadStream {
+private:
+    const std::uint8_t* data = nullptr;
+    std::size_t size = 0;
+    std::size_t read_head = 0;
+
+public:
+    void reset(const std::vector<std::uint8_t>& params) {
+        data = params.data();
+        size = params.size();
+        read_head = 0;
+    }
+
+    std::size_t read_some(const asio::mutable_buffer& buffer, asio::error_code& ec) override;
+
+    std::size_t read_some(const asio::mutable_buffer& buffer) override {
+        asio::error_code ec;
+        std::size_t size_read = read_some(buffer, ec);
+        if (ec) {
+            throw asio::system_error(ec);
+        }
+        return size_read;
+    }
+
+    // Borrowed bytes are valid until the decoder rebuilds the params of the next request
+    const void* borrow(std::size_t size, std::size_t alignment) override;
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_DELTA_ENCODING_H
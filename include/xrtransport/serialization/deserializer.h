@@ -19,21 +19,36 @@
 #include "openxr/openxr.h"
 #include "xrtransport/asio_compat.h"
 #include "struct_size.h"
+#include "virtual_handles.h"
 
 #include "asio/read.hpp"
 #include "asio/write.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <unordered_map>
 #include <cstring>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 namespace xrtransport {
 
+class StringTable;
+class HandleTable;
+
 struct DeserializeContext {
     SyncReadStream& in;
     bool in_place;
     XrDuration time_offset;
+    // set if XRTP_FEATURE_STRING_INTERNING was negotiated, see string_interning.h
+    StringTable* strings = nullptr;
+    // set if XRTP_FEATURE_COMPACT_ENCODING was negotiated, see compact_encoding.h
+    HandleTable* handles = nullptr;
+    // set if XRTP_FEATURE_PIPELINED_CREATION was negotiated, to resolve handles sent without compact
+    // encoding, see virtual_handles.h
+    const VirtualHandleMap* virtual_handles = nullptr;
 
     explicit DeserializeContext(SyncReadStream& in)
         : in(in), in_place(false), time_offset(0)
@@ -44,12 +59,16 @@ struct DeserializeContext {
     {}
 };
 
+class QuantizedReader;
+
 // Forward declarations (deserializers)
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 void deserialize(XrDigitalLensControlALMALENCE* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 #ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
 void deserialize(XrBodyJointLocationBD* s, DeserializeContext& ctx);
+void dequantize(XrBodyJointLocationBD* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrBodyJointLocationBD* s);
 void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx);
 void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx);
 void deserialize(XrBodyJointsLocateInfoBD* s, DeserializeContext& ctx);
@@ -156,6 +175,7 @@ void deserialize(XrSessionCreateInfoOverlayEXTX* s, DeserializeContext& ctx);
 void deserialize(XrActiveActionSetPrioritiesEXT* s, DeserializeContext& ctx);
 void deserialize(XrActiveActionSetPrioritiesEXT* s, DeserializeContext& ctx);
 void deserialize(XrActiveActionSetPriorityEXT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrActiveActionSetPriorityEXT* s);
 #endif // XRTRANSPORT_EXT_XR_EXT_active_action_set_priority
 #ifdef XRTRANSPORT_EXT_XR_EXT_debug_utils
 void deserialize(XrDebugUtilsLabelEXT* s, DeserializeContext& ctx);
@@ -200,11 +220,15 @@ void deserialize(XrHandJointsMotionRangeInfoEXT* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_EXT_hand_joints_motion_range
 #ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
 void deserialize(XrHandJointLocationEXT* s, DeserializeContext& ctx);
+void dequantize(XrHandJointLocationEXT* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrHandJointLocationEXT* s);
 void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx);
 void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx);
 void deserialize(XrHandJointVelocitiesEXT* s, DeserializeContext& ctx);
 void deserialize(XrHandJointVelocitiesEXT* s, DeserializeContext& ctx);
 void deserialize(XrHandJointVelocityEXT* s, DeserializeContext& ctx);
+void dequantize(XrHandJointVelocityEXT* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrHandJointVelocityEXT* s);
 void deserialize(XrHandJointsLocateInfoEXT* s, DeserializeContext& ctx);
 void deserialize(XrHandJointsLocateInfoEXT* s, DeserializeContext& ctx);
 void deserialize(XrHandTrackerCreateInfoEXT* s, DeserializeContext& ctx);
@@ -254,6 +278,8 @@ void deserialize(XrAndroidSurfaceSwapchainCreateInfoFB* s, DeserializeContext& c
 #endif // XRTRANSPORT_EXT_XR_FB_android_surface_swapchain_create
 #ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
 void deserialize(XrBodyJointLocationFB* s, DeserializeContext& ctx);
+void dequantize(XrBodyJointLocationFB* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrBodyJointLocationFB* s);
 void deserialize(XrBodyJointLocationsFB* s, DeserializeContext& ctx);
 void deserialize(XrBodyJointLocationsFB* s, DeserializeContext& ctx);
 void deserialize(XrBodyJointsLocateInfoFB* s, DeserializeContext& ctx);
@@ -261,6 +287,7 @@ void deserialize(XrBodyJointsLocateInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrBodySkeletonFB* s, DeserializeContext& ctx);
 void deserialize(XrBodySkeletonFB* s, DeserializeContext& ctx);
 void deserialize(XrBodySkeletonJointFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrBodySkeletonJointFB* s);
 void deserialize(XrBodyTrackerCreateInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrBodyTrackerCreateInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrSystemBodyTrackingPropertiesFB* s, DeserializeContext& ctx);
@@ -296,6 +323,7 @@ void deserialize(XrEventDataDisplayRefreshRateChangedFB* s, DeserializeContext&
 #endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
 #ifdef XRTRANSPORT_EXT_XR_FB_eye_tracking_social
 void deserialize(XrEyeGazeFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrEyeGazeFB* s);
 void deserialize(XrEyeGazesFB* s, DeserializeContext& ctx);
 void deserialize(XrEyeGazesFB* s, DeserializeContext& ctx);
 void deserialize(XrEyeGazesInfoFB* s, DeserializeContext& ctx);
@@ -309,6 +337,7 @@ void deserialize(XrSystemEyeTrackingPropertiesFB* s, DeserializeContext& ctx);
 void deserialize(XrFaceExpressionInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrFaceExpressionInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrFaceExpressionStatusFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrFaceExpressionStatusFB* s);
 void deserialize(XrFaceExpressionWeightsFB* s, DeserializeContext& ctx);
 void deserialize(XrFaceExpressionWeightsFB* s, DeserializeContext& ctx);
 void deserialize(XrFaceTrackerCreateInfoFB* s, DeserializeContext& ctx);
@@ -348,6 +377,7 @@ void deserialize(XrHandTrackingAimStateFB* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_aim
 #ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules
 void deserialize(XrHandCapsuleFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrHandCapsuleFB* s);
 void deserialize(XrHandTrackingCapsulesStateFB* s, DeserializeContext& ctx);
 void deserialize(XrHandTrackingCapsulesStateFB* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules
@@ -357,6 +387,7 @@ void deserialize(XrHandTrackingMeshFB* s, DeserializeContext& ctx);
 void deserialize(XrHandTrackingScaleFB* s, DeserializeContext& ctx);
 void deserialize(XrHandTrackingScaleFB* s, DeserializeContext& ctx);
 void deserialize(XrVector4sFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrVector4sFB* s);
 #endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_mesh
 #ifdef XRTRANSPORT_EXT_XR_FB_haptic_amplitude_envelope
 void deserialize(XrHapticAmplitudeEnvelopeVibrationFB* s, DeserializeContext& ctx);
@@ -425,7 +456,9 @@ void deserialize(XrSystemRenderModelPropertiesFB* s, DeserializeContext& ctx);
 void deserialize(XrBoundary2DFB* s, DeserializeContext& ctx);
 void deserialize(XrBoundary2DFB* s, DeserializeContext& ctx);
 void deserialize(XrOffset3DfFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrOffset3DfFB* s);
 void deserialize(XrRect3DfFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrRect3DfFB* s);
 void deserialize(XrRoomLayoutFB* s, DeserializeContext& ctx);
 void deserialize(XrRoomLayoutFB* s, DeserializeContext& ctx);
 void deserialize(XrSemanticLabelsFB* s, DeserializeContext& ctx);
@@ -475,6 +508,7 @@ void deserialize(XrSpaceQueryInfoBaseHeaderFB* s, DeserializeContext& ctx);
 void deserialize(XrSpaceQueryInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrSpaceQueryInfoFB* s, DeserializeContext& ctx);
 void deserialize(XrSpaceQueryResultFB* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSpaceQueryResultFB* s);
 void deserialize(XrSpaceQueryResultsFB* s, DeserializeContext& ctx);
 void deserialize(XrSpaceQueryResultsFB* s, DeserializeContext& ctx);
 void deserialize(XrSpaceStorageLocationFilterInfoFB* s, DeserializeContext& ctx);
@@ -542,6 +576,8 @@ void deserialize(XrSystemAnchorPropertiesHTC* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_HTC_anchor
 #ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
 void deserialize(XrBodyJointLocationHTC* s, DeserializeContext& ctx);
+void dequantize(XrBodyJointLocationHTC* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrBodyJointLocationHTC* s);
 void deserialize(XrBodyJointLocationsHTC* s, DeserializeContext& ctx);
 void deserialize(XrBodyJointLocationsHTC* s, DeserializeContext& ctx);
 void deserialize(XrBodyJointsLocateInfoHTC* s, DeserializeContext& ctx);
@@ -565,6 +601,7 @@ void deserialize(XrSystemFacialTrackingPropertiesHTC* s, DeserializeContext& ctx
 void deserialize(XrFoveationApplyInfoHTC* s, DeserializeContext& ctx);
 void deserialize(XrFoveationApplyInfoHTC* s, DeserializeContext& ctx);
 void deserialize(XrFoveationConfigurationHTC* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrFoveationConfigurationHTC* s);
 void deserialize(XrFoveationCustomModeInfoHTC* s, DeserializeContext& ctx);
 void deserialize(XrFoveationCustomModeInfoHTC* s, DeserializeContext& ctx);
 void deserialize(XrFoveationDynamicModeInfoHTC* s, DeserializeContext& ctx);
@@ -921,6 +958,7 @@ void deserialize(XrSpatialAnchorsCreateInfoFromPoseML* s, DeserializeContext& ct
 #endif // XRTRANSPORT_EXT_XR_ML_spatial_anchors
 #ifdef XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
 void deserialize(XrSpatialAnchorCompletionResultML* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSpatialAnchorCompletionResultML* s);
 void deserialize(XrSpatialAnchorsCreateInfoFromUuidsML* s, DeserializeContext& ctx);
 void deserialize(XrSpatialAnchorsCreateInfoFromUuidsML* s, DeserializeContext& ctx);
 void deserialize(XrSpatialAnchorsCreateStorageInfoML* s, DeserializeContext& ctx);
@@ -993,6 +1031,7 @@ void deserialize(XrGraphicsBindingEGLMNDX* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_MNDX_egl_enable
 #ifdef XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl
 void deserialize(XrForceFeedbackCurlApplyLocationMNDX* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrForceFeedbackCurlApplyLocationMNDX* s);
 void deserialize(XrForceFeedbackCurlApplyLocationsMNDX* s, DeserializeContext& ctx);
 void deserialize(XrForceFeedbackCurlApplyLocationsMNDX* s, DeserializeContext& ctx);
 void deserialize(XrSystemForceFeedbackCurlPropertiesMNDX* s, DeserializeContext& ctx);
@@ -1026,6 +1065,8 @@ void deserialize(XrHandMeshUpdateInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrHandMeshUpdateInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrHandMeshVertexBufferMSFT* s, DeserializeContext& ctx);
 void deserialize(XrHandMeshVertexMSFT* s, DeserializeContext& ctx);
+void dequantize(XrHandMeshVertexMSFT* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrHandMeshVertexMSFT* s);
 void deserialize(XrHandPoseTypeInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrHandPoseTypeInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSystemHandTrackingMeshPropertiesMSFT* s, DeserializeContext& ctx);
@@ -1038,6 +1079,7 @@ void deserialize(XrHolographicWindowAttachmentMSFT* s, DeserializeContext& ctx);
 #ifdef XRTRANSPORT_EXT_XR_MSFT_scene_marker
 void deserialize(XrSceneMarkerMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMarkerQRCodeMSFT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSceneMarkerQRCodeMSFT* s);
 void deserialize(XrSceneMarkerQRCodesMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMarkerQRCodesMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMarkerTypeFilterMSFT* s, DeserializeContext& ctx);
@@ -1050,6 +1092,8 @@ void deserialize(XrNewSceneComputeInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrNewSceneComputeInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneBoundsMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneComponentLocationMSFT* s, DeserializeContext& ctx);
+void dequantize(XrSceneComponentLocationMSFT* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrSceneComponentLocationMSFT* s);
 void deserialize(XrSceneComponentLocationsMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneComponentLocationsMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneComponentMSFT* s, DeserializeContext& ctx);
@@ -1064,6 +1108,7 @@ void deserialize(XrSceneComponentsMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneCreateInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneCreateInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneFrustumBoundMSFT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSceneFrustumBoundMSFT* s);
 void deserialize(XrSceneMeshBuffersGetInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshBuffersGetInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshBuffersMSFT* s, DeserializeContext& ctx);
@@ -1073,11 +1118,13 @@ void deserialize(XrSceneMeshIndicesUint16MSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshIndicesUint32MSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshIndicesUint32MSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshMSFT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSceneMeshMSFT* s);
 void deserialize(XrSceneMeshVertexBufferMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshVertexBufferMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshesMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneMeshesMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneObjectMSFT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSceneObjectMSFT* s);
 void deserialize(XrSceneObjectTypesFilterInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneObjectTypesFilterInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneObjectsMSFT* s, DeserializeContext& ctx);
@@ -1085,13 +1132,19 @@ void deserialize(XrSceneObjectsMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneObserverCreateInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneObserverCreateInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneOrientedBoxBoundMSFT* s, DeserializeContext& ctx);
+void dequantize(XrSceneOrientedBoxBoundMSFT* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrSceneOrientedBoxBoundMSFT* s);
 void deserialize(XrScenePlaneAlignmentFilterInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrScenePlaneAlignmentFilterInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrScenePlaneMSFT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrScenePlaneMSFT* s);
 void deserialize(XrScenePlanesMSFT* s, DeserializeContext& ctx);
 void deserialize(XrScenePlanesMSFT* s, DeserializeContext& ctx);
 void deserialize(XrSceneSphereBoundMSFT* s, DeserializeContext& ctx);
+void dequantize(XrSceneSphereBoundMSFT* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrSceneSphereBoundMSFT* s);
 void deserialize(XrUuidMSFT* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrUuidMSFT* s);
 void deserialize(XrVisualMeshComputeLodInfoMSFT* s, DeserializeContext& ctx);
 void deserialize(XrVisualMeshComputeLodInfoMSFT* s, DeserializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding
@@ -1176,15 +1229,22 @@ void deserialize(XrActionStateGetInfo* s, DeserializeContext& ctx);
 void deserialize(XrActionStatePose* s, DeserializeContext& ctx);
 void deserialize(XrActionStateVector2f* s, DeserializeContext& ctx);
 void deserialize(XrActionSuggestedBinding* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrActionSuggestedBinding* s);
 void deserialize(XrActionsSyncInfo* s, DeserializeContext& ctx);
 void deserialize(XrActiveActionSet* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrActiveActionSet* s);
 void deserialize(XrApiLayerProperties* s, DeserializeContext& ctx);
 void deserialize(XrApplicationInfo* s, DeserializeContext& ctx);
 void deserialize(XrBodySkeletonJointHTC* s, DeserializeContext& ctx);
+void dequantize(XrBodySkeletonJointHTC* s, std::size_t count, QuantizedReader& reader);
+constexpr bool is_flat(const XrBodySkeletonJointHTC* s);
 void deserialize(XrBoundSourcesForActionEnumerateInfo* s, DeserializeContext& ctx);
 void deserialize(XrBoxf* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrBoxf* s);
 void deserialize(XrColor3f* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrColor3f* s);
 void deserialize(XrColor4f* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrColor4f* s);
 void deserialize(XrCompositionLayerBaseHeader* s, DeserializeContext& ctx);
 void deserialize(XrCompositionLayerProjection* s, DeserializeContext& ctx);
 void deserialize(XrCompositionLayerProjectionView* s, DeserializeContext& ctx);
@@ -1198,14 +1258,19 @@ void deserialize(XrEventDataReferenceSpaceChangePending* s, DeserializeContext&
 void deserialize(XrEventDataSessionStateChanged* s, DeserializeContext& ctx);
 void deserialize(XrExtensionProperties* s, DeserializeContext& ctx);
 void deserialize(XrExtent2Df* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrExtent2Df* s);
 void deserialize(XrExtent2Di* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrExtent2Di* s);
 void deserialize(XrExtent3Df* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrExtent3Df* s);
 void deserialize(XrFovf* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrFovf* s);
 void deserialize(XrFrameBeginInfo* s, DeserializeContext& ctx);
 void deserialize(XrFrameEndInfo* s, DeserializeContext& ctx);
 void deserialize(XrFrameState* s, DeserializeContext& ctx);
 void deserialize(XrFrameWaitInfo* s, DeserializeContext& ctx);
 void deserialize(XrFrustumf* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrFrustumf* s);
 void deserialize(XrHapticActionInfo* s, DeserializeContext& ctx);
 void deserialize(XrHapticBaseHeader* s, DeserializeContext& ctx);
 void deserialize(XrHapticVibration* s, DeserializeContext& ctx);
@@ -1215,37 +1280,53 @@ void deserialize(XrInstanceProperties* s, DeserializeContext& ctx);
 void deserialize(XrInteractionProfileState* s, DeserializeContext& ctx);
 void deserialize(XrInteractionProfileSuggestedBinding* s, DeserializeContext& ctx);
 void deserialize(XrOffset2Df* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrOffset2Df* s);
 void deserialize(XrOffset2Di* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrOffset2Di* s);
 void deserialize(XrPosef* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrPosef* s);
 void deserialize(XrQuaternionf* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrQuaternionf* s);
 void deserialize(XrRect2Df* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrRect2Df* s);
 void deserialize(XrRect2Di* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrRect2Di* s);
 void deserialize(XrReferenceSpaceCreateInfo* s, DeserializeContext& ctx);
 void deserialize(XrSessionActionSetsAttachInfo* s, DeserializeContext& ctx);
 void deserialize(XrSessionBeginInfo* s, DeserializeContext& ctx);
 void deserialize(XrSessionCreateInfo* s, DeserializeContext& ctx);
 void deserialize(XrSpaceLocation* s, DeserializeContext& ctx);
 void deserialize(XrSpaceLocationData* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSpaceLocationData* s);
 void deserialize(XrSpaceLocations* s, DeserializeContext& ctx);
 void deserialize(XrSpaceVelocities* s, DeserializeContext& ctx);
 void deserialize(XrSpaceVelocity* s, DeserializeContext& ctx);
 void deserialize(XrSpaceVelocityData* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSpaceVelocityData* s);
 void deserialize(XrSpacesLocateInfo* s, DeserializeContext& ctx);
 void deserialize(XrSpheref* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSpheref* s);
 void deserialize(XrSwapchainCreateInfo* s, DeserializeContext& ctx);
 void deserialize(XrSwapchainImageAcquireInfo* s, DeserializeContext& ctx);
 void deserialize(XrSwapchainImageBaseHeader* s, DeserializeContext& ctx);
 void deserialize(XrSwapchainImageReleaseInfo* s, DeserializeContext& ctx);
 void deserialize(XrSwapchainImageWaitInfo* s, DeserializeContext& ctx);
 void deserialize(XrSwapchainSubImage* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSwapchainSubImage* s);
 void deserialize(XrSystemGetInfo* s, DeserializeContext& ctx);
 void deserialize(XrSystemGraphicsProperties* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSystemGraphicsProperties* s);
 void deserialize(XrSystemProperties* s, DeserializeContext& ctx);
 void deserialize(XrSystemTrackingProperties* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrSystemTrackingProperties* s);
 void deserialize(XrUuid* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrUuid* s);
 void deserialize(XrVector2f* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrVector2f* s);
 void deserialize(XrVector3f* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrVector3f* s);
 void deserialize(XrVector4f* s, DeserializeContext& ctx);
+constexpr bool is_flat(const XrVector4f* s);
 void deserialize(XrView* s, DeserializeContext& ctx);
 void deserialize(XrViewConfigurationProperties* s, DeserializeContext& ctx);
 void deserialize(XrViewConfigurationView* s, DeserializeContext& ctx);
@@ -2462,22 +2543,584 @@ void cleanup(const XrViewLocateInfo* s);
 void cleanup(const XrViewState* s);
 
 
+/**
+ * True for types that are serialized exactly as they are laid out in memory, so that arrays of them can
+ * be used directly from a received message. Handles are sent as raw values, so they are flat as well.
+ */
+template <typename T>
+constexpr bool is_flat(const T*) {
+    return std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value;
+}
+
+template <typename T>
+constexpr bool is_flat_member() {
+    return is_flat(static_cast<const std::remove_all_extents_t<T>*>(nullptr));
+}
+
+// Plain structs without pointers or times are flat if their members are and they have no padding
+#if defined(XRTRANSPORT_EXT_XR_BD_body_tracking)
+constexpr bool is_flat(const XrBodyJointLocationBD*) {
+    return
+        is_flat_member<decltype(XrBodyJointLocationBD::locationFlags)>() &&
+        is_flat_member<decltype(XrBodyJointLocationBD::pose)>() &&
+        sizeof(XrBodyJointLocationBD) == sizeof(XrBodyJointLocationBD::locationFlags) + sizeof(XrBodyJointLocationBD::pose);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_EXT_active_action_set_priority)
+constexpr bool is_flat(const XrActiveActionSetPriorityEXT*) {
+    return
+        is_flat_member<decltype(XrActiveActionSetPriorityEXT::actionSet)>() &&
+        is_flat_member<decltype(XrActiveActionSetPriorityEXT::priorityOverride)>() &&
+        sizeof(XrActiveActionSetPriorityEXT) == sizeof(XrActiveActionSetPriorityEXT::actionSet) + sizeof(XrActiveActionSetPriorityEXT::priorityOverride);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_EXT_hand_tracking)
+constexpr bool is_flat(const XrHandJointLocationEXT*) {
+    return
+        is_flat_member<decltype(XrHandJointLocationEXT::locationFlags)>() &&
+        is_flat_member<decltype(XrHandJointLocationEXT::pose)>() &&
+        is_flat_member<decltype(XrHandJointLocationEXT::radius)>() &&
+        sizeof(XrHandJointLocationEXT) == sizeof(XrHandJointLocationEXT::locationFlags) + sizeof(XrHandJointLocationEXT::pose) + sizeof(XrHandJointLocationEXT::radius);
+}
+
+constexpr bool is_flat(const XrHandJointVelocityEXT*) {
+    return
+        is_flat_member<decltype(XrHandJointVelocityEXT::velocityFlags)>() &&
+        is_flat_member<decltype(XrHandJointVelocityEXT::linearVelocity)>() &&
+        is_flat_member<decltype(XrHandJointVelocityEXT::angularVelocity)>() &&
+        sizeof(XrHandJointVelocityEXT) == sizeof(XrHandJointVelocityEXT::velocityFlags) + sizeof(XrHandJointVelocityEXT::linearVelocity) + sizeof(XrHandJointVelocityEXT::angularVelocity);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_body_tracking)
+constexpr bool is_flat(const XrBodyJointLocationFB*) {
+    return
+        is_flat_member<decltype(XrBodyJointLocationFB::locationFlags)>() &&
+        is_flat_member<decltype(XrBodyJointLocationFB::pose)>() &&
+        sizeof(XrBodyJointLocationFB) == sizeof(XrBodyJointLocationFB::locationFlags) + sizeof(XrBodyJointLocationFB::pose);
+}
+
+constexpr bool is_flat(const XrBodySkeletonJointFB*) {
+    return
+        is_flat_member<decltype(XrBodySkeletonJointFB::joint)>() &&
+        is_flat_member<decltype(XrBodySkeletonJointFB::parentJoint)>() &&
+        is_flat_member<decltype(XrBodySkeletonJointFB::pose)>() &&
+        sizeof(XrBodySkeletonJointFB) == sizeof(XrBodySkeletonJointFB::joint) + sizeof(XrBodySkeletonJointFB::parentJoint) + sizeof(XrBodySkeletonJointFB::pose);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_eye_tracking_social)
+constexpr bool is_flat(const XrEyeGazeFB*) {
+    return
+        is_flat_member<decltype(XrEyeGazeFB::isValid)>() &&
+        is_flat_member<decltype(XrEyeGazeFB::gazePose)>() &&
+        is_flat_member<decltype(XrEyeGazeFB::gazeConfidence)>() &&
+        sizeof(XrEyeGazeFB) == sizeof(XrEyeGazeFB::isValid) + sizeof(XrEyeGazeFB::gazePose) + sizeof(XrEyeGazeFB::gazeConfidence);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_face_tracking)
+constexpr bool is_flat(const XrFaceExpressionStatusFB*) {
+    return
+        is_flat_member<decltype(XrFaceExpressionStatusFB::isValid)>() &&
+        is_flat_member<decltype(XrFaceExpressionStatusFB::isEyeFollowingBlendshapesValid)>() &&
+        sizeof(XrFaceExpressionStatusFB) == sizeof(XrFaceExpressionStatusFB::isValid) + sizeof(XrFaceExpressionStatusFB::isEyeFollowingBlendshapesValid);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules)
+constexpr bool is_flat(const XrHandCapsuleFB*) {
+    return
+        is_flat_member<decltype(XrHandCapsuleFB::points)>() &&
+        is_flat_member<decltype(XrHandCapsuleFB::radius)>() &&
+        is_flat_member<decltype(XrHandCapsuleFB::joint)>() &&
+        sizeof(XrHandCapsuleFB) == sizeof(XrHandCapsuleFB::points) + sizeof(XrHandCapsuleFB::radius) + sizeof(XrHandCapsuleFB::joint);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_hand_tracking_mesh)
+constexpr bool is_flat(const XrVector4sFB*) {
+    return
+        is_flat_member<decltype(XrVector4sFB::x)>() &&
+        is_flat_member<decltype(XrVector4sFB::y)>() &&
+        is_flat_member<decltype(XrVector4sFB::z)>() &&
+        is_flat_member<decltype(XrVector4sFB::w)>() &&
+        sizeof(XrVector4sFB) == sizeof(XrVector4sFB::x) + sizeof(XrVector4sFB::y) + sizeof(XrVector4sFB::z) + sizeof(XrVector4sFB::w);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_scene)
+constexpr bool is_flat(const XrOffset3DfFB*) {
+    return
+        is_flat_member<decltype(XrOffset3DfFB::x)>() &&
+        is_flat_member<decltype(XrOffset3DfFB::y)>() &&
+        is_flat_member<decltype(XrOffset3DfFB::z)>() &&
+        sizeof(XrOffset3DfFB) == sizeof(XrOffset3DfFB::x) + sizeof(XrOffset3DfFB::y) + sizeof(XrOffset3DfFB::z);
+}
+
+constexpr bool is_flat(const XrRect3DfFB*) {
+    return
+        is_flat_member<decltype(XrRect3DfFB::offset)>() &&
+        is_flat_member<decltype(XrRect3DfFB::extent)>() &&
+        sizeof(XrRect3DfFB) == sizeof(XrRect3DfFB::offset) + sizeof(XrRect3DfFB::extent);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_FB_spatial_entity_query)
+constexpr bool is_flat(const XrSpaceQueryResultFB*) {
+    return
+        is_flat_member<decltype(XrSpaceQueryResultFB::space)>() &&
+        is_flat_member<decltype(XrSpaceQueryResultFB::uuid)>() &&
+        sizeof(XrSpaceQueryResultFB) == sizeof(XrSpaceQueryResultFB::space) + sizeof(XrSpaceQueryResultFB::uuid);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_HTC_body_tracking)
+constexpr bool is_flat(const XrBodyJointLocationHTC*) {
+    return
+        is_flat_member<decltype(XrBodyJointLocationHTC::locationFlags)>() &&
+        is_flat_member<decltype(XrBodyJointLocationHTC::pose)>() &&
+        sizeof(XrBodyJointLocationHTC) == sizeof(XrBodyJointLocationHTC::locationFlags) + sizeof(XrBodyJointLocationHTC::pose);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_HTC_foveation)
+constexpr bool is_flat(const XrFoveationConfigurationHTC*) {
+    return
+        is_flat_member<decltype(XrFoveationConfigurationHTC::level)>() &&
+        is_flat_member<decltype(XrFoveationConfigurationHTC::clearFovDegree)>() &&
+        is_flat_member<decltype(XrFoveationConfigurationHTC::focalCenterOffset)>() &&
+        sizeof(XrFoveationConfigurationHTC) == sizeof(XrFoveationConfigurationHTC::level) + sizeof(XrFoveationConfigurationHTC::clearFovDegree) + sizeof(XrFoveationConfigurationHTC::focalCenterOffset);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage)
+constexpr bool is_flat(const XrSpatialAnchorCompletionResultML*) {
+    return
+        is_flat_member<decltype(XrSpatialAnchorCompletionResultML::uuid)>() &&
+        is_flat_member<decltype(XrSpatialAnchorCompletionResultML::result)>() &&
+        sizeof(XrSpatialAnchorCompletionResultML) == sizeof(XrSpatialAnchorCompletionResultML::uuid) + sizeof(XrSpatialAnchorCompletionResultML::result);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl)
+constexpr bool is_flat(const XrForceFeedbackCurlApplyLocationMNDX*) {
+    return
+        is_flat_member<decltype(XrForceFeedbackCurlApplyLocationMNDX::location)>() &&
+        is_flat_member<decltype(XrForceFeedbackCurlApplyLocationMNDX::value)>() &&
+        sizeof(XrForceFeedbackCurlApplyLocationMNDX) == sizeof(XrForceFeedbackCurlApplyLocationMNDX::location) + sizeof(XrForceFeedbackCurlApplyLocationMNDX::value);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh)
+constexpr bool is_flat(const XrHandMeshVertexMSFT*) {
+    return
+        is_flat_member<decltype(XrHandMeshVertexMSFT::position)>() &&
+        is_flat_member<decltype(XrHandMeshVertexMSFT::normal)>() &&
+        sizeof(XrHandMeshVertexMSFT) == sizeof(XrHandMeshVertexMSFT::position) + sizeof(XrHandMeshVertexMSFT::normal);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_MSFT_scene_marker)
+constexpr bool is_flat(const XrSceneMarkerQRCodeMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneMarkerQRCodeMSFT::symbolType)>() &&
+        is_flat_member<decltype(XrSceneMarkerQRCodeMSFT::version)>() &&
+        sizeof(XrSceneMarkerQRCodeMSFT) == sizeof(XrSceneMarkerQRCodeMSFT::symbolType) + sizeof(XrSceneMarkerQRCodeMSFT::version);
+}
+
+#endif
+#if defined(XRTRANSPORT_EXT_XR_MSFT_scene_understanding)
+constexpr bool is_flat(const XrSceneComponentLocationMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneComponentLocationMSFT::flags)>() &&
+        is_flat_member<decltype(XrSceneComponentLocationMSFT::pose)>() &&
+        sizeof(XrSceneComponentLocationMSFT) == sizeof(XrSceneComponentLocationMSFT::flags) + sizeof(XrSceneComponentLocationMSFT::pose);
+}
+
+constexpr bool is_flat(const XrSceneFrustumBoundMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneFrustumBoundMSFT::pose)>() &&
+        is_flat_member<decltype(XrSceneFrustumBoundMSFT::fov)>() &&
+        is_flat_member<decltype(XrSceneFrustumBoundMSFT::farDistance)>() &&
+        sizeof(XrSceneFrustumBoundMSFT) == sizeof(XrSceneFrustumBoundMSFT::pose) + sizeof(XrSceneFrustumBoundMSFT::fov) + sizeof(XrSceneFrustumBoundMSFT::farDistance);
+}
+
+constexpr bool is_flat(const XrSceneMeshMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneMeshMSFT::meshBufferId)>() &&
+        is_flat_member<decltype(XrSceneMeshMSFT::supportsIndicesUint16)>() &&
+        sizeof(XrSceneMeshMSFT) == sizeof(XrSceneMeshMSFT::meshBufferId) + sizeof(XrSceneMeshMSFT::supportsIndicesUint16);
+}
+
+constexpr bool is_flat(const XrSceneObjectMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneObjectMSFT::objectType)>() &&
+        sizeof(XrSceneObjectMSFT) == sizeof(XrSceneObjectMSFT::objectType);
+}
+
+constexpr bool is_flat(const XrSceneOrientedBoxBoundMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneOrientedBoxBoundMSFT::pose)>() &&
+        is_flat_member<decltype(XrSceneOrientedBoxBoundMSFT::extents)>() &&
+        sizeof(XrSceneOrientedBoxBoundMSFT) == sizeof(XrSceneOrientedBoxBoundMSFT::pose) + sizeof(XrSceneOrientedBoxBoundMSFT::extents);
+}
+
+constexpr bool is_flat(const XrScenePlaneMSFT*) {
+    return
+        is_flat_member<decltype(XrScenePlaneMSFT::alignment)>() &&
+        is_flat_member<decltype(XrScenePlaneMSFT::size)>() &&
+        is_flat_member<decltype(XrScenePlaneMSFT::meshBufferId)>() &&
+        is_flat_member<decltype(XrScenePlaneMSFT::supportsIndicesUint16)>() &&
+        sizeof(XrScenePlaneMSFT) == sizeof(XrScenePlaneMSFT::alignment) + sizeof(XrScenePlaneMSFT::size) + sizeof(XrScenePlaneMSFT::meshBufferId) + sizeof(XrScenePlaneMSFT::supportsIndicesUint16);
+}
+
+constexpr bool is_flat(const XrSceneSphereBoundMSFT*) {
+    return
+        is_flat_member<decltype(XrSceneSphereBoundMSFT::center)>() &&
+        is_flat_member<decltype(XrSceneSphereBoundMSFT::radius)>() &&
+        sizeof(XrSceneSphereBoundMSFT) == sizeof(XrSceneSphereBoundMSFT::center) + sizeof(XrSceneSphereBoundMSFT::radius);
+}
+
+constexpr bool is_flat(const XrUuidMSFT*) {
+    return
+        is_flat_member<decltype(XrUuidMSFT::bytes)>() &&
+        sizeof(XrUuidMSFT) == sizeof(XrUuidMSFT::bytes);
+}
+
+#endif
+constexpr bool is_flat(const XrActionSuggestedBinding*) {
+    return
+        is_flat_member<decltype(XrActionSuggestedBinding::action)>() &&
+        is_flat_member<decltype(XrActionSuggestedBinding::binding)>() &&
+        sizeof(XrActionSuggestedBinding) == sizeof(XrActionSuggestedBinding::action) + sizeof(XrActionSuggestedBinding::binding);
+}
+
+constexpr bool is_flat(const XrActiveActionSet*) {
+    return
+        is_flat_member<decltype(XrActiveActionSet::actionSet)>() &&
+        is_flat_member<decltype(XrActiveActionSet::subactionPath)>() &&
+        sizeof(XrActiveActionSet) == sizeof(XrActiveActionSet::actionSet) + sizeof(XrActiveActionSet::subactionPath);
+}
+
+constexpr bool is_flat(const XrBodySkeletonJointHTC*) {
+    return
+        is_flat_member<decltype(XrBodySkeletonJointHTC::pose)>() &&
+        sizeof(XrBodySkeletonJointHTC) == sizeof(XrBodySkeletonJointHTC::pose);
+}
+
+constexpr bool is_flat(const XrBoxf*) {
+    return
+        is_flat_member<decltype(XrBoxf::center)>() &&
+        is_flat_member<decltype(XrBoxf::extents)>() &&
+        sizeof(XrBoxf) == sizeof(XrBoxf::center) + sizeof(XrBoxf::extents);
+}
+
+constexpr bool is_flat(const XrColor3f*) {
+    return
+        is_flat_member<decltype(XrColor3f::r)>() &&
+        is_flat_member<decltype(XrColor3f::g)>() &&
+        is_flat_member<decltype(XrColor3f::b)>() &&
+        sizeof(XrColor3f) == sizeof(XrColor3f::r) + sizeof(XrColor3f::g) + sizeof(XrColor3f::b);
+}
+
+constexpr bool is_flat(const XrColor4f*) {
+    return
+        is_flat_member<decltype(XrColor4f::r)>() &&
+        is_flat_member<decltype(XrColor4f::g)>() &&
+        is_flat_member<decltype(XrColor4f::b)>() &&
+        is_flat_member<decltype(XrColor4f::a)>() &&
+        sizeof(XrColor4f) == sizeof(XrColor4f::r) + sizeof(XrColor4f::g) + sizeof(XrColor4f::b) + sizeof(XrColor4f::a);
+}
+
+constexpr bool is_flat(const XrExtent2Df*) {
+    return
+        is_flat_member<decltype(XrExtent2Df::width)>() &&
+        is_flat_member<decltype(XrExtent2Df::height)>() &&
+        sizeof(XrExtent2Df) == sizeof(XrExtent2Df::width) + sizeof(XrExtent2Df::height);
+}
+
+constexpr bool is_flat(const XrExtent2Di*) {
+    return
+        is_flat_member<decltype(XrExtent2Di::width)>() &&
+        is_flat_member<decltype(XrExtent2Di::height)>() &&
+        sizeof(XrExtent2Di) == sizeof(XrExtent2Di::width) + sizeof(XrExtent2Di::height);
+}
+
+constexpr bool is_flat(const XrExtent3Df*) {
+    return
+        is_flat_member<decltype(XrExtent3Df::width)>() &&
+        is_flat_member<decltype(XrExtent3Df::height)>() &&
+        is_flat_member<decltype(XrExtent3Df::depth)>() &&
+        sizeof(XrExtent3Df) == sizeof(XrExtent3Df::width) + sizeof(XrExtent3Df::height) + sizeof(XrExtent3Df::depth);
+}
+
+constexpr bool is_flat(const XrFovf*) {
+    return
+        is_flat_member<decltype(XrFovf::angleLeft)>() &&
+        is_flat_member<decltype(XrFovf::angleRight)>() &&
+        is_flat_member<decltype(XrFovf::angleUp)>() &&
+        is_flat_member<decltype(XrFovf::angleDown)>() &&
+        sizeof(XrFovf) == sizeof(XrFovf::angleLeft) + sizeof(XrFovf::angleRight) + sizeof(XrFovf::angleUp) + sizeof(XrFovf::angleDown);
+}
+
+constexpr bool is_flat(const XrFrustumf*) {
+    return
+        is_flat_member<decltype(XrFrustumf::pose)>() &&
+        is_flat_member<decltype(XrFrustumf::fov)>() &&
+        is_flat_member<decltype(XrFrustumf::nearZ)>() &&
+        is_flat_member<decltype(XrFrustumf::farZ)>() &&
+        sizeof(XrFrustumf) == sizeof(XrFrustumf::pose) + sizeof(XrFrustumf::fov) + sizeof(XrFrustumf::nearZ) + sizeof(XrFrustumf::farZ);
+}
+
+constexpr bool is_flat(const XrOffset2Df*) {
+    return
+        is_flat_member<decltype(XrOffset2Df::x)>() &&
+        is_flat_member<decltype(XrOffset2Df::y)>() &&
+        sizeof(XrOffset2Df) == sizeof(XrOffset2Df::x) + sizeof(XrOffset2Df::y);
+}
+
+constexpr bool is_flat(const XrOffset2Di*) {
+    return
+        is_flat_member<decltype(XrOffset2Di::x)>() &&
+        is_flat_member<decltype(XrOffset2Di::y)>() &&
+        sizeof(XrOffset2Di) == sizeof(XrOffset2Di::x) + sizeof(XrOffset2Di::y);
+}
+
+constexpr bool is_flat(const XrPosef*) {
+    return
+        is_flat_member<decltype(XrPosef::orientation)>() &&
+        is_flat_member<decltype(XrPosef::position)>() &&
+        sizeof(XrPosef) == sizeof(XrPosef::orientation) + sizeof(XrPosef::position);
+}
+
+constexpr bool is_flat(const XrQuaternionf*) {
+    return
+        is_flat_member<decltype(XrQuaternionf::x)>() &&
+        is_flat_member<decltype(XrQuaternionf::y)>() &&
+        is_flat_member<decltype(XrQuaternionf::z)>() &&
+        is_flat_member<decltype(XrQuaternionf::w)>() &&
+        sizeof(XrQuaternionf) == sizeof(XrQuaternionf::x) + sizeof(XrQuaternionf::y) + sizeof(XrQuaternionf::z) + sizeof(XrQuaternionf::w);
+}
+
+constexpr bool is_flat(const XrRect2Df*) {
+    return
+        is_flat_member<decltype(XrRect2Df::offset)>() &&
+        is_flat_member<decltype(XrRect2Df::extent)>() &&
+        sizeof(XrRect2Df) == sizeof(XrRect2Df::offset) + sizeof(XrRect2Df::extent);
+}
+
+constexpr bool is_flat(const XrRect2Di*) {
+    return
+        is_flat_member<decltype(XrRect2Di::offset)>() &&
+        is_flat_member<decltype(XrRect2Di::extent)>() &&
+        sizeof(XrRect2Di) == sizeof(XrRect2Di::offset) + sizeof(XrRect2Di::extent);
+}
+
+constexpr bool is_flat(const XrSpaceLocationData*) {
+    return
+        is_flat_member<decltype(XrSpaceLocationData::locationFlags)>() &&
+        is_flat_member<decltype(XrSpaceLocationData::pose)>() &&
+        sizeof(XrSpaceLocationData) == sizeof(XrSpaceLocationData::locationFlags) + sizeof(XrSpaceLocationData::pose);
+}
+
+constexpr bool is_flat(const XrSpaceVelocityData*) {
+    return
+        is_flat_member<decltype(XrSpaceVelocityData::velocityFlags)>() &&
+        is_flat_member<decltype(XrSpaceVelocityData::linearVelocity)>() &&
+        is_flat_member<decltype(XrSpaceVelocityData::angularVelocity)>() &&
+        sizeof(XrSpaceVelocityData) == sizeof(XrSpaceVelocityData::velocityFlags) + sizeof(XrSpaceVelocityData::linearVelocity) + sizeof(XrSpaceVelocityData::angularVelocity);
+}
+
+constexpr bool is_flat(const XrSpheref*) {
+    return
+        is_flat_member<decltype(XrSpheref::center)>() &&
+        is_flat_member<decltype(XrSpheref::radius)>() &&
+        sizeof(XrSpheref) == sizeof(XrSpheref::center) + sizeof(XrSpheref::radius);
+}
+
+constexpr bool is_flat(const XrSwapchainSubImage*) {
+    return
+        is_flat_member<decltype(XrSwapchainSubImage::swapchain)>() &&
+        is_flat_member<decltype(XrSwapchainSubImage::imageRect)>() &&
+        is_flat_member<decltype(XrSwapchainSubImage::imageArrayIndex)>() &&
+        sizeof(XrSwapchainSubImage) == sizeof(XrSwapchainSubImage::swapchain) + sizeof(XrSwapchainSubImage::imageRect) + sizeof(XrSwapchainSubImage::imageArrayIndex);
+}
+
+constexpr bool is_flat(const XrSystemGraphicsProperties*) {
+    return
+        is_flat_member<decltype(XrSystemGraphicsProperties::maxSwapchainImageHeight)>() &&
+        is_flat_member<decltype(XrSystemGraphicsProperties::maxSwapchainImageWidth)>() &&
+        is_flat_member<decltype(XrSystemGraphicsProperties::maxLayerCount)>() &&
+        sizeof(XrSystemGraphicsProperties) == sizeof(XrSystemGraphicsProperties::maxSwapchainImageHeight) + sizeof(XrSystemGraphicsProperties::maxSwapchainImageWidth) + sizeof(XrSystemGraphicsProperties::maxLayerCount);
+}
+
+constexpr bool is_flat(const XrSystemTrackingProperties*) {
+    return
+        is_flat_member<decltype(XrSystemTrackingProperties::orientationTracking)>() &&
+        is_flat_member<decltype(XrSystemTrackingProperties::positionTracking)>() &&
+        sizeof(XrSystemTrackingProperties) == sizeof(XrSystemTrackingProperties::orientationTracking) + sizeof(XrSystemTrackingProperties::positionTracking);
+}
+
+constexpr bool is_flat(const XrUuid*) {
+    return
+        is_flat_member<decltype(XrUuid::data)>() &&
+        sizeof(XrUuid) == sizeof(XrUuid::data);
+}
+
+constexpr bool is_flat(const XrVector2f*) {
+    return
+        is_flat_member<decltype(XrVector2f::x)>() &&
+        is_flat_member<decltype(XrVector2f::y)>() &&
+        sizeof(XrVector2f) == sizeof(XrVector2f::x) + sizeof(XrVector2f::y);
+}
+
+constexpr bool is_flat(const XrVector3f*) {
+    return
+        is_flat_member<decltype(XrVector3f::x)>() &&
+        is_flat_member<decltype(XrVector3f::y)>() &&
+        is_flat_member<decltype(XrVector3f::z)>() &&
+        sizeof(XrVector3f) == sizeof(XrVector3f::x) + sizeof(XrVector3f::y) + sizeof(XrVector3f::z);
+}
+
+constexpr bool is_flat(const XrVector4f*) {
+    return
+        is_flat_member<decltype(XrVector4f::x)>() &&
+        is_flat_member<decltype(XrVector4f::y)>() &&
+        is_flat_member<decltype(XrVector4f::z)>() &&
+        is_flat_member<decltype(XrVector4f::w)>() &&
+        sizeof(XrVector4f) == sizeof(XrVector4f::x) + sizeof(XrVector4f::y) + sizeof(XrVector4f::z) + sizeof(XrVector4f::w);
+}
+
 // Struct deserializer lookup
 // Only to be used with OpenXR pNext structs
 using StructDeserializer = void(*)(XrBaseOutStructure*, DeserializeContext&);
-#define STRUCT_DESERIALIZER_PTR(t) (reinterpret_cast<StructDeserializer>(static_cast<void(*)(t*, DeserializeContext&)>(&deserialize)))
+
+// Type-erased entry point, so that deserializer pointers are usable in constant expressions
+template <typename T>
+void deserialize_erased(XrBaseOutStructure* s, DeserializeContext& ctx) {
+    deserialize(reinterpret_cast<T*>(s), ctx);
+}
+
+#define STRUCT_DESERIALIZER_PTR(t) (&deserialize_erased<t>)
 
 StructDeserializer deserializer_lookup(XrStructureType struct_type);
 
 // Struct cleaner lookup
 // Only to be used with OpenXR pNext structs
 using StructCleaner = void(*)(const XrBaseOutStructure*);
-#define STRUCT_CLEANER_PTR(t) (reinterpret_cast<StructCleaner>(static_cast<void(*)(const t*)>(&cleanup)))
+
+template <typename T>
+void cleanup_erased(const XrBaseOutStructure* s) {
+    cleanup(reinterpret_cast<const T*>(s));
+}
+
+#define STRUCT_CLEANER_PTR(t) (&cleanup_erased<t>)
 
 StructCleaner cleaner_lookup(XrStructureType struct_type);
 
 void deserialize_time(XrTime* time, DeserializeContext& ctx);
 
+// Strings are interned if ctx.strings is set, see string_interning.h
+void deserialize_string(const char** x, DeserializeContext& ctx);
+void deserialize_string(char** x, DeserializeContext& ctx);
+// Fixed size char array member, the rest of the array is zeroed
+void deserialize_string_array(char* x, std::size_t size, DeserializeContext& ctx);
+// Always in place, null-terminated if there is room left in the buffer
+void deserialize_string_buffer(char* x, std::size_t capacity, DeserializeContext& ctx);
+
+/**
+ * Lets const arrays and strings deserialized on this thread point into the message they are read from
+ * instead of being copied, if the stream supports it (see SyncReadStream::borrow) and they are aligned.
+ * Generated server handlers hold one for as long as they hold the message. cleanup_ptr doesn't free
+ * pointers that were borrowed through the active scope.
+ */
+class BorrowScope {
+private:
+    inline static thread_local BorrowScope* active_scope = nullptr;
+
+    BorrowScope* previous;
+    std::vector<const void*> borrowed;
+
+public:
+    BorrowScope() : previous(active_scope) {
+        active_scope = this;
+    }
+
+    ~BorrowScope() {
+        active_scope = previous;
+    }
+
+    BorrowScope(const BorrowScope&) = delete;
+    BorrowScope& operator=(const BorrowScope&) = delete;
+
+    static BorrowScope* active() {
+        return active_scope;
+    }
+
+    const void* borrow(SyncReadStream& in, std::size_t size, std::size_t alignment) {
+        const void* data = in.borrow(size, alignment);
+        if (data) {
+            borrowed.push_back(data);
+        }
+        return data;
+    }
+
+    /**
+     * Marks data that outlives the scope (e.g. an interned string) as borrowed, so it isn't freed.
+     */
+    void add_borrowed(const void* data) {
+        borrowed.push_back(data);
+    }
+
+    bool is_borrowed(const void* data) const {
+        return std::find(borrowed.begin(), borrowed.end(), data) != borrowed.end();
+    }
+};
+
+/**
+ * Borrows len elements from the message if T is flat and a BorrowScope is active. Returns nullptr if
+ * they have to be copied, which they always do with compact encoding or virtual handles.
+ */
+template <typename T>
+const T* borrow_array(std::size_t len, DeserializeContext& ctx) {
+    if constexpr (is_flat(static_cast<const T*>(nullptr))) {
+        BorrowScope* scope = BorrowScope::active();
+        if (scope && !ctx.handles && !ctx.virtual_handles) {
+            return static_cast<const T*>(scope->borrow(ctx.in, sizeof(T) * len, alignof(T)));
+        }
+    }
+    return nullptr;
+}
+
+// Compact encodings used by deserialize if ctx.handles is set, see compact_encoding.h
+std::uint64_t deserialize_compact_uint(DeserializeContext& ctx);
+std::int64_t deserialize_compact_enum(DeserializeContext& ctx);
+XrStructureType deserialize_compact_struct_type(DeserializeContext& ctx);
+std::uint64_t deserialize_compact_handle(DeserializeContext& ctx);
+
+template <typename T>
+void deserialize_compact(T* x, DeserializeContext& ctx) {
+    if constexpr (std::is_same<T, XrStructureType>::value) {
+        *x = deserialize_compact_struct_type(ctx);
+    }
+    else if constexpr (std::is_enum<T>::value) {
+        *x = static_cast<T>(deserialize_compact_enum(ctx));
+    }
+    else if constexpr (std::is_pointer<T>::value) {
+        *x = reinterpret_cast<T>(static_cast<std::uintptr_t>(deserialize_compact_handle(ctx)));
+    }
+    else {
+        std::uint64_t value = deserialize_compact_uint(ctx);
+        if (value > UINT32_MAX) {
+            throw std::runtime_error("Compact value out of range: " + std::to_string(value));
+        }
+        *x = static_cast<T>(value);
+    }
+}
+
 // Generic deserializers
 template <typename T>
 void deserialize(T* x, DeserializeContext& ctx) {
@@ -2485,7 +3128,19 @@ void deserialize(T* x, DeserializeContext& ctx) {
         !std::is_class<T>::value,
         "T must be a supported type"
     );
+    // counts, lengths, enums and handles
+    if constexpr (std::is_same<T, std::uint32_t>::value || std::is_enum<T>::value || std::is_pointer<T>::value) {
+        if (ctx.handles) {
+            deserialize_compact(x, ctx);
+            return;
+        }
+    }
     asio::read(ctx.in, asio::buffer(x, sizeof(T)));
+    if constexpr (std::is_pointer<T>::value) {
+        if (ctx.virtual_handles) {
+            *x = ctx.virtual_handles->resolve(*x);
+        }
+    }
 }
 
 template <typename T>
@@ -2512,6 +3167,9 @@ void deserialize_ptr(const T** x, DeserializeContext& ctx) {
             }
             deserialize_array(*x, len, ctx);
         }
+        else if (const T* borrowed = borrow_array<T>(len, ctx)) {
+            *x = borrowed;
+        }
         else {
             T* data = static_cast<T*>(std::malloc(sizeof(T) * len));
             deserialize_array(data, len, ctx);
@@ -2559,6 +3217,32 @@ void deserialize_ptr(T** x, DeserializeContext& ctx) {
     }
 }
 
+/**
+ * Allocates a pure output param sent with serialize_output_ptr, zeroed for the runtime to fill in.
+ * Never in place, only requests contain pure output params.
+ * @return The number of elements
+ */
+template <typename T>
+std::uint32_t deserialize_output_ptr(T** x, DeserializeContext& ctx) {
+    std::uint32_t len{};
+    deserialize(&len, ctx);
+    *x = len ? static_cast<T*>(std::calloc(len, sizeof(T))) : nullptr;
+    return len;
+}
+
+/**
+ * Allocates a pure output XR struct array sent with serialize_output_xr_ptr, with the type and next
+ * chain of each element filled in.
+ */
+template <typename T>
+void deserialize_output_xr_ptr(T** x, DeserializeContext& ctx) {
+    std::uint32_t len = deserialize_output_ptr(x, ctx);
+    for (std::uint32_t i = 0; i < len; i++) {
+        deserialize(&(*x)[i].type, ctx);
+        deserialize_xr(&(*x)[i].next, ctx);
+    }
+}
+
 template <typename T>
 void deserialize_xr(const T** p_s, DeserializeContext& ctx) {
     XrStructureType type{};
@@ -2669,6 +3353,44 @@ void deserialize_xr_array(const T** p_s, DeserializeContext& ctx) {
     }
 }
 
+/**
+ * Deserializes the elements sent by serialize_filled_ptr into the application's array. Always in place,
+ * the array is left alone if no elements were sent.
+ */
+template <typename T>
+void deserialize_filled_ptr(T* x, std::size_t capacity, DeserializeContext& ctx) {
+    std::uint32_t len{};
+    deserialize(&len, ctx);
+    if (len == 0) {
+        return;
+    }
+    if (!x || len > capacity) {
+        throw std::runtime_error("Received " + std::to_string(len) + " elements for array of capacity " + std::to_string(capacity));
+    }
+    deserialize_array(x, len, ctx);
+}
+
+template <typename T>
+void deserialize_filled_xr_array(T* x, std::size_t capacity, DeserializeContext& ctx) {
+    std::uint32_t count{};
+    deserialize(&count, ctx);
+    if (count == 0) {
+        return;
+    }
+    if (!x || count > capacity) {
+        throw std::runtime_error("Received " + std::to_string(count) + " elements for array of capacity " + std::to_string(capacity));
+    }
+    XrStructureType type{};
+    deserialize(&type, ctx);
+    std::size_t struct_size = size_lookup(type);
+    StructDeserializer deserializer = deserializer_lookup(type);
+    char* buffer = reinterpret_cast<char*>(x);
+    for (std::uint32_t i = 0; i < count; i++) {
+        deserializer(reinterpret_cast<XrBaseOutStructure*>(buffer), ctx);
+        buffer += struct_size;
+    }
+}
+
 // Generic cleaners
 template <typename T>
 void cleanup(const T* x) {
@@ -2693,6 +3415,10 @@ void cleanup_ptr(const T* x, std::size_t len) {
         return; // do not clean up null pointer
     }
     cleanup_array(x, len);
+    BorrowScope* scope = BorrowScope::active();
+    if (scope && scope->is_borrowed(x)) {
+        return; // points into the message
+    }
     std::free(const_cast<T*>(x));
 }
 
@@ -13,6 +13,31 @@ public:
     explicit UnknownXrStructureTypeException(const std::string& message) : std::runtime_error(message) {}
 };
 
+class DeltaEncodingException : public std::runtime_error {
+public:
+    explicit DeltaEncodingException(const std::string& message) : std::runtime_error(message) {}
+};
+
+class QuantizationException : public std::runtime_error {
+public:
+    explicit QuantizationException(const std::string& message) : std::runtime_error(message) {}
+};
+
+class StringInterningException : public std::runtime_error {
+public:
+    explicit StringInterningException(const std::string& message) : std::runtime_error(message) {}
+};
+
+class CompactEncodingException : public std::runtime_error {
+public:
+    explicit CompactEncodingException(const std::string& message) : std::runtime_error(message) {}
+};
+
+class VirtualHandleException : public std::runtime_error {
+public:
+    explicit VirtualHandleException(const std::string& message) : std::runtime_error(message) {}
+};
+
 } // namespace xrtransport
 
 #endif // XRTRANSPORT_SERIALIZATION_ERROR_H
\ No newline at end of file
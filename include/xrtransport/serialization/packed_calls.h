@@ -0,0 +1,186 @@
+/*
+ * AUTO-GENERATED FILE - DO NOT EDIT DIRECTLY
+ *
+ * This file was automatically generated by the code_generation module.
+ * Any changes made to this file will be lost when regenerated.
+ *
+ * To modify this file, edit the corresponding template in:
+ * code_generation/templates/structs/packed_calls.mako
+ */
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_PACKED_CALLS_GENERATED_H
+#define XRTRANSPORT_PACKED_CALLS_GENERATED_H
+
+#include "openxr/openxr.h"
+
+#include <cstdint>
+
+namespace xrtransport {
+
+/*
+ * Packed function calls
+ *
+ * The hot functions in code_generation/packed_calls.py only take plain values, and pointers to single
+ * structs without pointers in them. In the common case, where those structs have no next chain, the
+ * client sends all of their params as one Request_ struct in an XRTP_MSG_PACKED_FUNCTION_CALL, which
+ * the server uses directly from the message, and the server replies with one Response_ struct in an
+ * XRTP_MSG_FUNCTION_RETURN. Any other call to these functions uses the generic encoding.
+ *
+ * Members of struct params are named <param>_<member>. Times are in the server's clock.
+ */
+
+#pragma pack(push, 1)
+
+#ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+struct Request_xrGetDisplayRefreshRateFB {
+    XrSession session;
+};
+
+struct Response_xrGetDisplayRefreshRateFB {
+    XrResult result;
+    XrDuration runtime_duration;
+    float displayRefreshRate;
+};
+
+struct Request_xrRequestDisplayRefreshRateFB {
+    XrSession session;
+    float displayRefreshRate;
+};
+
+struct Response_xrRequestDisplayRefreshRateFB {
+    XrResult result;
+    XrDuration runtime_duration;
+};
+
+#endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+struct Request_xrAcquireSwapchainImage {
+    XrSwapchain swapchain;
+};
+
+struct Response_xrAcquireSwapchainImage {
+    XrResult result;
+    XrDuration runtime_duration;
+    uint32_t index;
+};
+
+struct Request_xrApplyHapticFeedback {
+    XrSession session;
+    XrAction hapticActionInfo_action;
+    XrPath hapticActionInfo_subactionPath;
+    XrDuration hapticFeedback_duration;
+    float hapticFeedback_frequency;
+    float hapticFeedback_amplitude;
+};
+
+struct Response_xrApplyHapticFeedback {
+    XrResult result;
+    XrDuration runtime_duration;
+};
+
+struct Request_xrGetActionStateBoolean {
+    XrSession session;
+    XrAction getInfo_action;
+    XrPath getInfo_subactionPath;
+};
+
+struct Response_xrGetActionStateBoolean {
+    XrResult result;
+    XrDuration runtime_duration;
+    XrBool32 state_currentState;
+    XrBool32 state_changedSinceLastSync;
+    XrTime state_lastChangeTime;
+    XrBool32 state_isActive;
+};
+
+struct Request_xrGetActionStateFloat {
+    XrSession session;
+    XrAction getInfo_action;
+    XrPath getInfo_subactionPath;
+};
+
+struct Response_xrGetActionStateFloat {
+    XrResult result;
+    XrDuration runtime_duration;
+    float state_currentState;
+    XrBool32 state_changedSinceLastSync;
+    XrTime state_lastChangeTime;
+    XrBool32 state_isActive;
+};
+
+struct Request_xrGetActionStatePose {
+    XrSession session;
+    XrAction getInfo_action;
+    XrPath getInfo_subactionPath;
+};
+
+struct Response_xrGetActionStatePose {
+    XrResult result;
+    XrDuration runtime_duration;
+    XrBool32 state_isActive;
+};
+
+struct Request_xrGetActionStateVector2f {
+    XrSession session;
+    XrAction getInfo_action;
+    XrPath getInfo_subactionPath;
+};
+
+struct Response_xrGetActionStateVector2f {
+    XrResult result;
+    XrDuration runtime_duration;
+    XrVector2f state_currentState;
+    XrBool32 state_changedSinceLastSync;
+    XrTime state_lastChangeTime;
+    XrBool32 state_isActive;
+};
+
+struct Request_xrLocateSpace {
+    XrSpace space;
+    XrSpace baseSpace;
+    XrTime time;
+};
+
+struct Response_xrLocateSpace {
+    XrResult result;
+    XrDuration runtime_duration;
+    XrSpaceLocationFlags location_locationFlags;
+    XrPosef location_pose;
+};
+
+struct Request_xrReleaseSwapchainImage {
+    XrSwapchain swapchain;
+};
+
+struct Response_xrReleaseSwapchainImage {
+    XrResult result;
+    XrDuration runtime_duration;
+};
+
+struct Request_xrStopHapticFeedback {
+    XrSession session;
+    XrAction hapticActionInfo_action;
+    XrPath hapticActionInfo_subactionPath;
+};
+
+struct Response_xrStopHapticFeedback {
+    XrResult result;
+    XrDuration runtime_duration;
+};
+
+struct Request_xrWaitSwapchainImage {
+    XrSwapchain swapchain;
+    XrDuration waitInfo_timeout;
+};
+
+struct Response_xrWaitSwapchainImage {
+    XrResult result;
+    XrDuration runtime_duration;
+};
+
+
+#pragma pack(pop)
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_PACKED_CALLS_GENERATED_H
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_QUANTIZATION_H
+#define XRTRANSPORT_QUANTIZATION_H
+
+#include "serializer.h"
+#include "deserializer.h"
+#include "error.h"
+
+#include "openxr/openxr.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Quantized joint, pose and weight arrays (XRTP_FEATURE_QUANTIZATION)
+ *
+ * Hand, body and face tracking results are large arrays of full precision floats that are sent every
+ * frame. When this feature is negotiated, the client also sends a mask of QUANTIZED_* extension bits
+ * (see serializer.h) and the server sends the arrays of those extensions in a lossy compact form:
+ * - flags: uint8_t, only the low 8 bits are defined by the spec
+ * - orientations: smallest three, 2 bit index of the dropped component and 3 x 15 bit components (6 bytes)
+ * - positions: 3 x uint16_t relative to the bounding box of all positions in the array
+ * - other vectors and floats (velocities, radii): half floats
+ * - weights and confidences: uint16_t in [0, 1]
+ *
+ * Which arrays qualify is decided by the code generator (code_generation/quantization.py). Every
+ * qualifying array starts with an encoding byte, so the deserializer needs no configuration. An array
+ * whose values don't fit the encoding (non-finite values, unknown flags, weights out of range) is sent
+ * raw instead.
+ *
+ * Quantized array layout:
+ * - QUANTIZED_ENCODING_QUANTIZED (uint8_t)
+ * - element count (uint32_t)
+ * - position origin (3 x float) and position scale (float)
+ * - size of the encoded elements (uint32_t)
+ * - encoded elements, members in declaration order
+ *
+ * Raw array layout:
+ * - QUANTIZED_ENCODING_RAW (uint8_t)
+ * - the array as written by serialize_ptr
+ */
+
+constexpr std::uint8_t QUANTIZED_ENCODING_RAW = 0;
+constexpr std::uint8_t QUANTIZED_ENCODING_QUANTIZED = 1;
+
+// Worst case error of the decoded values, for tests and for documentation
+constexpr float QUANTIZED_ORIENTATION_MAX_ERROR = 2e-4f; // per quaternion component
+constexpr float QUANTIZED_WEIGHT_MAX_ERROR = 1.0f / 65535.0f;
+
+/**
+ * Encodes the elements of one array. Generated quantize functions first include every position so
+ * that the frame can be computed, then call begin and put the members of each element in order. The
+ * put functions return false if a value can't be quantized, in which case the array is sent raw.
+ */
+class QuantizedWriter {
+private:
+    XrVector3f min{};
+    XrVector3f max{};
+    bool has_positions = false;
+    bool positions_finite = true;
+
+    XrVector3f origin{};
+    float scale = 0;
+
+    std::vector<std::uint8_t> data;
+
+    void put_u16(std::uint16_t value);
+    bool put_half(float value);
+
+public:
+    void reset();
+
+    void include_position(const XrVector3f& position);
+
+    /**
+     * Computes the position frame. Returns false if the positions can't be quantized.
+     */
+    bool begin();
+
+    bool put_flags(std::uint64_t flags);
+    bool put_pose(const XrPosef& pose);
+    bool put_vector(const XrVector3f& vector);
+    bool put_float(float value);
+    bool put_weight(float weight);
+
+    /**
+     * Size of the encoded elements, without the frame.
+     */
+    std::size_t size() const {
+        return data.size();
+    }
+
+    /**
+     * Writes the frame and the encoded elements.
+     */
+    void write(SerializeContext& ctx) const;
+};
+
+/**
+ * Decodes the elements of one array written by QuantizedWriter.
+ */
+class QuantizedReader {
+private:
+    DeserializeContext& ctx;
+
+    XrVector3f origin{};
+    float scale = 0;
+
+    std::vector<std::uint8_t> data;
+    std::size_t read_head = 0;
+
+    std::uint16_t get_u16();
+    float get_half();
+
+public:
+    explicit QuantizedReader(DeserializeContext& ctx) : ctx(ctx) {}
+
+    /**
+     * Reads the frame and the encoded elements, which must be exactly expected_size bytes.
+     */
+    void begin(std::size_t expected_size);
+
+    template <typename T>
+    void get_flags(T* flags) {
+        *flags = static_cast<T>(data[read_head++]);
+    }
+
+    void get_pose(XrPosef* pose);
+    void get_vector(XrVector3f* vector);
+    void get_float(float* value);
+    void get_weight(float* weight);
+};
+
+// Weight and confidence arrays
+bool quantize(const float* x, std::size_t count, QuantizedWriter& writer);
+void dequantize(float* x, std::size_t count, QuantizedReader& reader);
+
+template <typename T>
+void serialize_quantizable_ptr(const T* x, std::size_t len, std::uint64_t extension_bit, SerializeContext& ctx) {
+    if (x && len && (ctx.quantized_extensions & extension_bit)) {
+        // quantized arrays never nest, so one scratch writer per thread is enough
+        thread_local QuantizedWriter writer;
+        writer.reset();
+        if (quantize(x, len, writer)) {
+            std::uint8_t encoding = QUANTIZED_ENCODING_QUANTIZED;
+            serialize(&encoding, ctx);
+            std::uint32_t count = static_cast<std::uint32_t>(len);
+            serialize(&count, ctx);
+            writer.write(ctx);
+            return;
+        }
+    }
+    std::uint8_t encoding = QUANTIZED_ENCODING_RAW;
+    serialize(&encoding, ctx);
+    serialize_ptr(x, len, ctx);
+}
+
+template <typename T>
+void deserialize_quantized_ptr(T** x, DeserializeContext& ctx) {
+    std::uint32_t count{};
+    deserialize(&count, ctx);
+    if (!count) {
+        throw QuantizationException("Quantized array must not be empty");
+    }
+    T* data = *x;
+    if (ctx.in_place) {
+        if (!data) {
+            throw std::runtime_error("Attempted to deserialize in-place into nullptr");
+        }
+    }
+    else {
+        data = static_cast<T*>(std::malloc(sizeof(T) * count));
+    }
+    QuantizedReader reader(ctx);
+    dequantize(data, count, reader);
+    *x = data;
+}
+
+template <typename T>
+void deserialize_quantizable_ptr(T** x, DeserializeContext& ctx) {
+    std::uint8_t encoding{};
+    deserialize(&encoding, ctx);
+    if (encoding == QUANTIZED_ENCODING_RAW) {
+        deserialize_ptr(x, ctx);
+    }
+    else if (encoding == QUANTIZED_ENCODING_QUANTIZED) {
+        deserialize_quantized_ptr(x, ctx);
+    }
+    else {
+        throw QuantizationException("Invalid array encoding: " + std::to_string(encoding));
+    }
+}
+
+template <typename T>
+void deserialize_quantizable_ptr(const T** x, DeserializeContext& ctx) {
+    T* data = const_cast<T*>(*x);
+    deserialize_quantizable_ptr(&data, ctx);
+    *x = data;
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_QUANTIZATION_H
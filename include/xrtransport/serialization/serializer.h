@@ -22,17 +22,28 @@
 #include "asio/write.hpp"
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstdint>
-#include <unordered_map>
 #include <cassert>
 #include <cstring>
+#include <string>
+#include <type_traits>
 
 namespace xrtransport {
 
+class StringInterner;
+class HandleInterner;
+
 struct SerializeContext {
     SyncWriteStream& out;
     XrDuration time_offset;
     bool skip_unknown_structs;
+    // QUANTIZED_* bits of the extensions whose arrays may be sent quantized, see quantization.h
+    std::uint64_t quantized_extensions = 0;
+    // interns strings if XRTP_FEATURE_STRING_INTERNING was negotiated, see string_interning.h
+    StringInterner* strings = nullptr;
+    // sends counts, enums and handles compactly if XRTP_FEATURE_COMPACT_ENCODING was negotiated, see compact_encoding.h
+    HandleInterner* handles = nullptr;
 
     explicit SerializeContext(SyncWriteStream& out)
         : out(out), time_offset(0), skip_unknown_structs(false)
@@ -51,12 +62,15 @@ struct SerializeContext {
     {}
 };
 
+class QuantizedWriter;
+
 // Forward declarations
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 void serialize(const XrDigitalLensControlALMALENCE* s, SerializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 #ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
 void serialize(const XrBodyJointLocationBD* s, SerializeContext& ctx);
+bool quantize(const XrBodyJointLocationBD* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrBodyJointLocationsBD* s, SerializeContext& ctx);
 void serialize(const XrBodyJointLocationsBD* s, SerializeContext& ctx);
 void serialize(const XrBodyJointsLocateInfoBD* s, SerializeContext& ctx);
@@ -207,11 +221,13 @@ void serialize(const XrHandJointsMotionRangeInfoEXT* s, SerializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_EXT_hand_joints_motion_range
 #ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
 void serialize(const XrHandJointLocationEXT* s, SerializeContext& ctx);
+bool quantize(const XrHandJointLocationEXT* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrHandJointLocationsEXT* s, SerializeContext& ctx);
 void serialize(const XrHandJointLocationsEXT* s, SerializeContext& ctx);
 void serialize(const XrHandJointVelocitiesEXT* s, SerializeContext& ctx);
 void serialize(const XrHandJointVelocitiesEXT* s, SerializeContext& ctx);
 void serialize(const XrHandJointVelocityEXT* s, SerializeContext& ctx);
+bool quantize(const XrHandJointVelocityEXT* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrHandJointsLocateInfoEXT* s, SerializeContext& ctx);
 void serialize(const XrHandJointsLocateInfoEXT* s, SerializeContext& ctx);
 void serialize(const XrHandTrackerCreateInfoEXT* s, SerializeContext& ctx);
@@ -261,6 +277,7 @@ void serialize(const XrAndroidSurfaceSwapchainCreateInfoFB* s, SerializeContext&
 #endif // XRTRANSPORT_EXT_XR_FB_android_surface_swapchain_create
 #ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
 void serialize(const XrBodyJointLocationFB* s, SerializeContext& ctx);
+bool quantize(const XrBodyJointLocationFB* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrBodyJointLocationsFB* s, SerializeContext& ctx);
 void serialize(const XrBodyJointLocationsFB* s, SerializeContext& ctx);
 void serialize(const XrBodyJointsLocateInfoFB* s, SerializeContext& ctx);
@@ -549,6 +566,7 @@ void serialize(const XrSystemAnchorPropertiesHTC* s, SerializeContext& ctx);
 #endif // XRTRANSPORT_EXT_XR_HTC_anchor
 #ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
 void serialize(const XrBodyJointLocationHTC* s, SerializeContext& ctx);
+bool quantize(const XrBodyJointLocationHTC* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrBodyJointLocationsHTC* s, SerializeContext& ctx);
 void serialize(const XrBodyJointLocationsHTC* s, SerializeContext& ctx);
 void serialize(const XrBodyJointsLocateInfoHTC* s, SerializeContext& ctx);
@@ -1033,6 +1051,7 @@ void serialize(const XrHandMeshUpdateInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrHandMeshUpdateInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrHandMeshVertexBufferMSFT* s, SerializeContext& ctx);
 void serialize(const XrHandMeshVertexMSFT* s, SerializeContext& ctx);
+bool quantize(const XrHandMeshVertexMSFT* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrHandPoseTypeInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrHandPoseTypeInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrSystemHandTrackingMeshPropertiesMSFT* s, SerializeContext& ctx);
@@ -1057,6 +1076,7 @@ void serialize(const XrNewSceneComputeInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrNewSceneComputeInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneBoundsMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneComponentLocationMSFT* s, SerializeContext& ctx);
+bool quantize(const XrSceneComponentLocationMSFT* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrSceneComponentLocationsMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneComponentLocationsMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneComponentMSFT* s, SerializeContext& ctx);
@@ -1092,12 +1112,14 @@ void serialize(const XrSceneObjectsMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneObserverCreateInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneObserverCreateInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneOrientedBoxBoundMSFT* s, SerializeContext& ctx);
+bool quantize(const XrSceneOrientedBoxBoundMSFT* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrScenePlaneAlignmentFilterInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrScenePlaneAlignmentFilterInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrScenePlaneMSFT* s, SerializeContext& ctx);
 void serialize(const XrScenePlanesMSFT* s, SerializeContext& ctx);
 void serialize(const XrScenePlanesMSFT* s, SerializeContext& ctx);
 void serialize(const XrSceneSphereBoundMSFT* s, SerializeContext& ctx);
+bool quantize(const XrSceneSphereBoundMSFT* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrUuidMSFT* s, SerializeContext& ctx);
 void serialize(const XrVisualMeshComputeLodInfoMSFT* s, SerializeContext& ctx);
 void serialize(const XrVisualMeshComputeLodInfoMSFT* s, SerializeContext& ctx);
@@ -1188,6 +1210,7 @@ void serialize(const XrActiveActionSet* s, SerializeContext& ctx);
 void serialize(const XrApiLayerProperties* s, SerializeContext& ctx);
 void serialize(const XrApplicationInfo* s, SerializeContext& ctx);
 void serialize(const XrBodySkeletonJointHTC* s, SerializeContext& ctx);
+bool quantize(const XrBodySkeletonJointHTC* s, std::size_t count, QuantizedWriter& writer);
 void serialize(const XrBoundSourcesForActionEnumerateInfo* s, SerializeContext& ctx);
 void serialize(const XrBoxf* s, SerializeContext& ctx);
 void serialize(const XrColor3f* s, SerializeContext& ctx);
@@ -1262,14 +1285,63 @@ void serialize(const XrViewState* s, SerializeContext& ctx);
 
 // Only to be used with OpenXR pNext structs
 using StructSerializer = void(*)(const XrBaseInStructure*, SerializeContext& ctx);
-#define STRUCT_SERIALIZER_PTR(t) (reinterpret_cast<StructSerializer>(static_cast<void(*)(const t*, SerializeContext& ctx)>(&serialize)))
 
-extern std::unordered_map<XrStructureType, StructSerializer> serializer_lookup_table;
+// Type-erased entry point, so that serializer pointers are usable in constant expressions
+template <typename T>
+void serialize_erased(const XrBaseInStructure* s, SerializeContext& ctx) {
+    serialize(reinterpret_cast<const T*>(s), ctx);
+}
+
+#define STRUCT_SERIALIZER_PTR(t) (&serialize_erased<t>)
 
 StructSerializer serializer_lookup(XrStructureType struct_type);
 
 void serialize_time(const XrTime* local_time, SerializeContext& ctx);
 
+// Strings are interned if ctx.strings is set, see string_interning.h
+void serialize_string(const char* x, SerializeContext& ctx);
+// Fixed size char array member
+void serialize_string_array(const char* x, std::size_t size, SerializeContext& ctx);
+// Output buffer filled in by the runtime, which may not be null-terminated
+void serialize_string_buffer(const char* x, std::size_t capacity, SerializeContext& ctx);
+
+// Extensions with joint, pose or weight arrays that can be sent quantized
+constexpr std::uint64_t QUANTIZED_XR_BD_body_tracking = 1ull << 0;
+constexpr std::uint64_t QUANTIZED_XR_EXT_hand_tracking = 1ull << 1;
+constexpr std::uint64_t QUANTIZED_XR_FB_body_tracking = 1ull << 2;
+constexpr std::uint64_t QUANTIZED_XR_FB_face_tracking = 1ull << 3;
+constexpr std::uint64_t QUANTIZED_XR_FB_face_tracking2 = 1ull << 4;
+constexpr std::uint64_t QUANTIZED_XR_HTC_body_tracking = 1ull << 5;
+constexpr std::uint64_t QUANTIZED_XR_MSFT_hand_tracking_mesh = 1ull << 6;
+constexpr std::uint64_t QUANTIZED_XR_MSFT_scene_understanding = 1ull << 7;
+
+/**
+ * Returns the QUANTIZED_* bit of an extension, or 0 if it has no arrays that can be sent quantized.
+ */
+std::uint64_t quantized_extension_bit(const std::string& extension_name);
+
+// Compact encodings used by serialize if ctx.handles is set, see compact_encoding.h
+void serialize_compact_uint(std::uint64_t value, SerializeContext& ctx);
+void serialize_compact_enum(std::int64_t value, SerializeContext& ctx);
+void serialize_compact_struct_type(XrStructureType type, SerializeContext& ctx);
+void serialize_compact_handle(std::uint64_t handle, SerializeContext& ctx);
+
+template <typename T>
+void serialize_compact(const T* x, SerializeContext& ctx) {
+    if constexpr (std::is_same<T, XrStructureType>::value) {
+        serialize_compact_struct_type(*x, ctx);
+    }
+    else if constexpr (std::is_enum<T>::value) {
+        serialize_compact_enum(static_cast<std::int64_t>(*x), ctx);
+    }
+    else if constexpr (std::is_pointer<T>::value) {
+        serialize_compact_handle(reinterpret_cast<std::uintptr_t>(*x), ctx);
+    }
+    else {
+        serialize_compact_uint(*x, ctx);
+    }
+}
+
 // Generic serializers
 template <typename T>
 void serialize(const T* x, SerializeContext& ctx) {
@@ -1277,6 +1349,13 @@ void serialize(const T* x, SerializeContext& ctx) {
         !std::is_class<T>::value,
         "T must be a supported type"
     );
+    // counts, lengths, enums and handles
+    if constexpr (std::is_same<T, std::uint32_t>::value || std::is_enum<T>::value || std::is_pointer<T>::value) {
+        if (ctx.handles) {
+            serialize_compact(x, ctx);
+            return;
+        }
+    }
     asio::write(ctx.out, asio::buffer(x, sizeof(T)));
 }
 
@@ -1296,6 +1375,30 @@ void serialize_ptr(const T* x, std::size_t len, SerializeContext& ctx) {
     }
 }
 
+/**
+ * Pure output params (see code_generation/bindings.py) are never read by the runtime, so only their
+ * length is sent for the receiver to allocate them.
+ */
+template <typename T>
+void serialize_output_ptr(const T* x, std::size_t len, SerializeContext& ctx) {
+    std::uint32_t marker = x != nullptr ? len : 0;
+    serialize(&marker, ctx);
+}
+
+/**
+ * Pure output XR structs also need their type and next chain, which tell the runtime what to fill in.
+ */
+template <typename T>
+void serialize_output_xr_ptr(const T* x, std::size_t len, SerializeContext& ctx) {
+    serialize_output_ptr(x, len, ctx);
+    if (x) {
+        for (std::size_t i = 0; i < len; i++) {
+            serialize(&x[i].type, ctx);
+            serialize_xr(x[i].next, ctx);
+        }
+    }
+}
+
 template <typename T>
 void serialize_xr(const T* untyped, SerializeContext& ctx) {
     const XrBaseInStructure* x = reinterpret_cast<const XrBaseInStructure*>(untyped);
@@ -1359,6 +1462,27 @@ void serialize_xr_array(const T* untyped, std::size_t len, SerializeContext& ctx
     }
 }
 
+/**
+ * Serializes the elements of a two-call idiom array that the runtime filled in, which may be fewer
+ * than its capacity. Nothing is sent if the call failed or only asked for the count.
+ */
+template <typename T>
+void serialize_filled_ptr(const T* x, std::size_t capacity, std::uint32_t count, SerializeContext& ctx) {
+    serialize_ptr(x, std::min<std::size_t>(count, capacity), ctx);
+}
+
+template <typename T>
+void serialize_filled_xr_array(const T* x, std::size_t capacity, std::uint32_t count, SerializeContext& ctx) {
+    std::size_t len = std::min<std::size_t>(count, capacity);
+    if (len == 0) {
+        // serialize_xr_array would still send the type, which isn't read back for an empty array
+        std::uint32_t marker = 0;
+        serialize(&marker, ctx);
+        return;
+    }
+    serialize_xr_array(x, len, ctx);
+}
+
 } // namespace xrtransport
 
 #endif // XRTRANSPORT_SERIALIZER_GENERATED_H
\ No newline at end of file
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_STRING_INTERNING_H
+#define XRTRANSPORT_STRING_INTERNING_H
+
+#include "serializer.h"
+#include "deserializer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace xrtransport {
+
+/*
+ * String interning (XRTP_FEATURE_STRING_INTERNING)
+ *
+ * Action names, paths, extension names and the strings returned by the runtime tend to be sent over
+ * and over. When this feature is negotiated, each direction of the connection keeps a string table:
+ * the first time a string is sent it is assigned the next id, and afterwards only the id is sent.
+ * Requests use the table of the client's StringInterner and the server's StringTable, responses the
+ * other way around.
+ *
+ * Every string starts with a varint tag:
+ * - 0: nullptr
+ * - (id << 1) | 1: a string that was sent before
+ * - (size + 1) << 1: a new string, followed by size chars without the null terminator
+ *
+ * Both sides intern a new string only if it is at most MAX_INTERNED_STRING_SIZE chars long and the
+ * table has fewer than MAX_INTERNED_STRINGS entries, so they always agree on the ids without any
+ * acknowledgement.
+ */
+
+constexpr std::size_t MAX_INTERNED_STRINGS = 4096;
+constexpr std::size_t MAX_INTERNED_STRING_SIZE = 256;
+
+/**
+ * Assigns ids to the strings sent in one direction. Strings added while serializing a message only
+ * become permanent once the message was sent (see begin_strings and commit_strings), so that a message
+ * that fails to serialize doesn't leave ids the other side never saw.
+ */
+class StringInterner {
+private:
+    // ids are indices into strings, which never moves them so the map can refer to them
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, std::uint32_t> ids;
+    // number of strings added since the last commit
+    std::size_t pending = 0;
+
+public:
+    /**
+     * @return The id of a string that was sent before, or nullptr
+     */
+    const std::uint32_t* find(std::string_view string) const;
+
+    /**
+     * Assigns the next id to a string that is about to be sent in full, if it should be interned.
+     */
+    void add(std::string_view string);
+
+    void commit();
+    void rollback();
+
+    std::size_t size() const {
+        return strings.size();
+    }
+};
+
+/**
+ * Receiving side of a StringInterner. Strings are never moved once added, so they can be used in place
+ * for the lifetime of the connection.
+ */
+class StringTable {
+private:
+    std::deque<std::string> strings;
+
+public:
+    /**
+     * Adds a newly received string if the sender interned it as well.
+     * @return The stored string, or nullptr if it was not interned
+     */
+    const std::string* add(std::string string);
+
+    /**
+     * @throws StringInterningException if the id was never assigned
+     */
+    const std::string& get(std::uint64_t id) const;
+
+    std::size_t size() const {
+        return strings.size();
+    }
+};
+
+/**
+ * Whether the sender and receiver of a new string intern it.
+ */
+inline bool should_intern(std::size_t size, std::size_t table_size) {
+    return size <= MAX_INTERNED_STRING_SIZE && table_size < MAX_INTERNED_STRINGS;
+}
+
+/**
+ * Prepares an interner for a new message, dropping strings added by a message that was never sent.
+ * @return strings, which is nullptr if string interning was not negotiated
+ */
+inline StringInterner* begin_strings(StringInterner* strings) {
+    if (strings) {
+        strings->rollback();
+    }
+    return strings;
+}
+
+/**
+ * Makes the strings added while serializing a message permanent. Call once the message was sent.
+ */
+inline void commit_strings(SerializeContext& ctx) {
+    if (ctx.strings) {
+        ctx.strings->commit();
+    }
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_STRING_INTERNING_H
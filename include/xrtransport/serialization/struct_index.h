@@ -0,0 +1,1274 @@
+/*
+ * AUTO-GENERATED FILE - DO NOT EDIT DIRECTLY
+ *
+ * This file was automatically generated by the code_generation module.
+ * Any changes made to this file will be lost when regenerated.
+ *
+ * To modify this file, edit the corresponding template in:
+ * code_generation/templates/structs/struct_index.mako
+ */
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_STRUCT_INDEX_GENERATED_H
+#define XRTRANSPORT_STRUCT_INDEX_GENERATED_H
+
+#include "openxr/openxr.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace xrtransport {
+
+// Every XrStructureType that the serializer was built for. Only used to lay out the dense struct
+// tables below, so duplicates are harmless.
+inline constexpr XrStructureType indexed_struct_types[] = {
+#ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
+    XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE,
+#endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
+#ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
+    XR_TYPE_BODY_JOINT_LOCATIONS_BD,
+    XR_TYPE_BODY_JOINT_LOCATIONS_BD,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_BD,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_BD,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_BD,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_BD,
+    XR_TYPE_SYSTEM_BODY_TRACKING_PROPERTIES_BD,
+    XR_TYPE_SYSTEM_BODY_TRACKING_PROPERTIES_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_BD_future_progress
+    XR_TYPE_FUTURE_POLL_RESULT_PROGRESS_BD,
+    XR_TYPE_FUTURE_POLL_RESULT_PROGRESS_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_future_progress
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_anchor
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_COMPLETION_BD,
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_COMPLETION_BD,
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_PERSIST_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_PERSIST_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_UNPERSIST_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_UNPERSIST_INFO_BD,
+    XR_TYPE_SYSTEM_SPATIAL_ANCHOR_PROPERTIES_BD,
+    XR_TYPE_SYSTEM_SPATIAL_ANCHOR_PROPERTIES_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_anchor
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_anchor_sharing
+    XR_TYPE_SHARED_SPATIAL_ANCHOR_DOWNLOAD_INFO_BD,
+    XR_TYPE_SHARED_SPATIAL_ANCHOR_DOWNLOAD_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_SHARE_INFO_BD,
+    XR_TYPE_SPATIAL_ANCHOR_SHARE_INFO_BD,
+    XR_TYPE_SYSTEM_SPATIAL_ANCHOR_SHARING_PROPERTIES_BD,
+    XR_TYPE_SYSTEM_SPATIAL_ANCHOR_SHARING_PROPERTIES_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_anchor_sharing
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_mesh
+    XR_TYPE_SENSE_DATA_PROVIDER_CREATE_INFO_SPATIAL_MESH_BD,
+    XR_TYPE_SENSE_DATA_PROVIDER_CREATE_INFO_SPATIAL_MESH_BD,
+    XR_TYPE_SYSTEM_SPATIAL_MESH_PROPERTIES_BD,
+    XR_TYPE_SYSTEM_SPATIAL_MESH_PROPERTIES_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_mesh
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_scene
+    XR_TYPE_SCENE_CAPTURE_INFO_BD,
+    XR_TYPE_SCENE_CAPTURE_INFO_BD,
+    XR_TYPE_SYSTEM_SPATIAL_SCENE_PROPERTIES_BD,
+    XR_TYPE_SYSTEM_SPATIAL_SCENE_PROPERTIES_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_scene
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_sensing
+    XR_TYPE_ANCHOR_SPACE_CREATE_INFO_BD,
+    XR_TYPE_ANCHOR_SPACE_CREATE_INFO_BD,
+    XR_TYPE_EVENT_DATA_SENSE_DATA_PROVIDER_STATE_CHANGED_BD,
+    XR_TYPE_EVENT_DATA_SENSE_DATA_PROVIDER_STATE_CHANGED_BD,
+    XR_TYPE_EVENT_DATA_SENSE_DATA_UPDATED_BD,
+    XR_TYPE_EVENT_DATA_SENSE_DATA_UPDATED_BD,
+    XR_TYPE_QUERIED_SENSE_DATA_BD,
+    XR_TYPE_QUERIED_SENSE_DATA_BD,
+    XR_TYPE_QUERIED_SENSE_DATA_GET_INFO_BD,
+    XR_TYPE_QUERIED_SENSE_DATA_GET_INFO_BD,
+    XR_TYPE_SENSE_DATA_FILTER_SEMANTIC_BD,
+    XR_TYPE_SENSE_DATA_FILTER_SEMANTIC_BD,
+    XR_TYPE_SENSE_DATA_FILTER_UUID_BD,
+    XR_TYPE_SENSE_DATA_FILTER_UUID_BD,
+    XR_TYPE_SENSE_DATA_PROVIDER_CREATE_INFO_BD,
+    XR_TYPE_SENSE_DATA_PROVIDER_CREATE_INFO_BD,
+    XR_TYPE_SENSE_DATA_PROVIDER_START_INFO_BD,
+    XR_TYPE_SENSE_DATA_PROVIDER_START_INFO_BD,
+    XR_TYPE_SENSE_DATA_QUERY_COMPLETION_BD,
+    XR_TYPE_SENSE_DATA_QUERY_COMPLETION_BD,
+    XR_TYPE_SENSE_DATA_QUERY_INFO_BD,
+    XR_TYPE_SENSE_DATA_QUERY_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_ANCHOR_CREATE_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_ANCHOR_CREATE_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_BOUNDING_BOX_2D_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_BOUNDING_BOX_2D_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_BOUNDING_BOX_3D_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_BOUNDING_BOX_3D_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_LOCATION_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_LOCATION_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_POLYGON_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_POLYGON_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_SEMANTIC_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_SEMANTIC_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_TRIANGLE_MESH_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_DATA_TRIANGLE_MESH_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_GET_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_COMPONENT_GET_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_LOCATION_GET_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_LOCATION_GET_INFO_BD,
+    XR_TYPE_SPATIAL_ENTITY_STATE_BD,
+    XR_TYPE_SPATIAL_ENTITY_STATE_BD,
+    XR_TYPE_SYSTEM_SPATIAL_SENSING_PROPERTIES_BD,
+    XR_TYPE_SYSTEM_SPATIAL_SENSING_PROPERTIES_BD,
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_sensing
+#ifdef XRTRANSPORT_EXT_XR_EPIC_view_configuration_fov
+    XR_TYPE_VIEW_CONFIGURATION_VIEW_FOV_EPIC,
+    XR_TYPE_VIEW_CONFIGURATION_VIEW_FOV_EPIC,
+#endif // XRTRANSPORT_EXT_XR_EPIC_view_configuration_fov
+#ifdef XRTRANSPORT_EXT_XR_EXTX_overlay
+    XR_TYPE_EVENT_DATA_MAIN_SESSION_VISIBILITY_CHANGED_EXTX,
+    XR_TYPE_EVENT_DATA_MAIN_SESSION_VISIBILITY_CHANGED_EXTX,
+    XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX,
+    XR_TYPE_SESSION_CREATE_INFO_OVERLAY_EXTX,
+#endif // XRTRANSPORT_EXT_XR_EXTX_overlay
+#ifdef XRTRANSPORT_EXT_XR_EXT_active_action_set_priority
+    XR_TYPE_ACTIVE_ACTION_SET_PRIORITIES_EXT,
+    XR_TYPE_ACTIVE_ACTION_SET_PRIORITIES_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_active_action_set_priority
+#ifdef XRTRANSPORT_EXT_XR_EXT_debug_utils
+    XR_TYPE_DEBUG_UTILS_LABEL_EXT,
+    XR_TYPE_DEBUG_UTILS_LABEL_EXT,
+    XR_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT,
+    XR_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT,
+    XR_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+    XR_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+    XR_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
+    XR_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
+#ifdef XRTRANSPORT_EXT_XR_EXT_dpad_binding
+    XR_TYPE_INTERACTION_PROFILE_DPAD_BINDING_EXT,
+    XR_TYPE_INTERACTION_PROFILE_DPAD_BINDING_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_dpad_binding
+#ifdef XRTRANSPORT_EXT_XR_EXT_eye_gaze_interaction
+    XR_TYPE_EYE_GAZE_SAMPLE_TIME_EXT,
+    XR_TYPE_EYE_GAZE_SAMPLE_TIME_EXT,
+    XR_TYPE_SYSTEM_EYE_GAZE_INTERACTION_PROPERTIES_EXT,
+    XR_TYPE_SYSTEM_EYE_GAZE_INTERACTION_PROPERTIES_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_eye_gaze_interaction
+#ifdef XRTRANSPORT_EXT_XR_EXT_frame_synthesis
+    XR_TYPE_FRAME_SYNTHESIS_CONFIG_VIEW_EXT,
+    XR_TYPE_FRAME_SYNTHESIS_CONFIG_VIEW_EXT,
+    XR_TYPE_FRAME_SYNTHESIS_INFO_EXT,
+    XR_TYPE_FRAME_SYNTHESIS_INFO_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_frame_synthesis
+#ifdef XRTRANSPORT_EXT_XR_EXT_future
+    XR_TYPE_FUTURE_CANCEL_INFO_EXT,
+    XR_TYPE_FUTURE_CANCEL_INFO_EXT,
+    XR_TYPE_FUTURE_COMPLETION_EXT,
+    XR_TYPE_FUTURE_COMPLETION_EXT,
+    XR_TYPE_FUTURE_POLL_INFO_EXT,
+    XR_TYPE_FUTURE_POLL_INFO_EXT,
+    XR_TYPE_FUTURE_POLL_RESULT_EXT,
+    XR_TYPE_FUTURE_POLL_RESULT_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_future
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_joints_motion_range
+    XR_TYPE_HAND_JOINTS_MOTION_RANGE_INFO_EXT,
+    XR_TYPE_HAND_JOINTS_MOTION_RANGE_INFO_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_joints_motion_range
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+    XR_TYPE_HAND_JOINT_LOCATIONS_EXT,
+    XR_TYPE_HAND_JOINT_LOCATIONS_EXT,
+    XR_TYPE_HAND_JOINT_VELOCITIES_EXT,
+    XR_TYPE_HAND_JOINT_VELOCITIES_EXT,
+    XR_TYPE_HAND_JOINTS_LOCATE_INFO_EXT,
+    XR_TYPE_HAND_JOINTS_LOCATE_INFO_EXT,
+    XR_TYPE_HAND_TRACKER_CREATE_INFO_EXT,
+    XR_TYPE_HAND_TRACKER_CREATE_INFO_EXT,
+    XR_TYPE_SYSTEM_HAND_TRACKING_PROPERTIES_EXT,
+    XR_TYPE_SYSTEM_HAND_TRACKING_PROPERTIES_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking_data_source
+    XR_TYPE_HAND_TRACKING_DATA_SOURCE_INFO_EXT,
+    XR_TYPE_HAND_TRACKING_DATA_SOURCE_INFO_EXT,
+    XR_TYPE_HAND_TRACKING_DATA_SOURCE_STATE_EXT,
+    XR_TYPE_HAND_TRACKING_DATA_SOURCE_STATE_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking_data_source
+#ifdef XRTRANSPORT_EXT_XR_EXT_performance_settings
+    XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT,
+    XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_performance_settings
+#ifdef XRTRANSPORT_EXT_XR_EXT_plane_detection
+    XR_TYPE_PLANE_DETECTOR_BEGIN_INFO_EXT,
+    XR_TYPE_PLANE_DETECTOR_BEGIN_INFO_EXT,
+    XR_TYPE_PLANE_DETECTOR_CREATE_INFO_EXT,
+    XR_TYPE_PLANE_DETECTOR_CREATE_INFO_EXT,
+    XR_TYPE_PLANE_DETECTOR_GET_INFO_EXT,
+    XR_TYPE_PLANE_DETECTOR_GET_INFO_EXT,
+    XR_TYPE_PLANE_DETECTOR_LOCATION_EXT,
+    XR_TYPE_PLANE_DETECTOR_LOCATION_EXT,
+    XR_TYPE_PLANE_DETECTOR_LOCATIONS_EXT,
+    XR_TYPE_PLANE_DETECTOR_LOCATIONS_EXT,
+    XR_TYPE_PLANE_DETECTOR_POLYGON_BUFFER_EXT,
+    XR_TYPE_PLANE_DETECTOR_POLYGON_BUFFER_EXT,
+    XR_TYPE_SYSTEM_PLANE_DETECTION_PROPERTIES_EXT,
+    XR_TYPE_SYSTEM_PLANE_DETECTION_PROPERTIES_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_plane_detection
+#ifdef XRTRANSPORT_EXT_XR_EXT_user_presence
+    XR_TYPE_EVENT_DATA_USER_PRESENCE_CHANGED_EXT,
+    XR_TYPE_EVENT_DATA_USER_PRESENCE_CHANGED_EXT,
+    XR_TYPE_SYSTEM_USER_PRESENCE_PROPERTIES_EXT,
+    XR_TYPE_SYSTEM_USER_PRESENCE_PROPERTIES_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_user_presence
+#ifdef XRTRANSPORT_EXT_XR_EXT_view_configuration_depth_range
+    XR_TYPE_VIEW_CONFIGURATION_DEPTH_RANGE_EXT,
+    XR_TYPE_VIEW_CONFIGURATION_DEPTH_RANGE_EXT,
+#endif // XRTRANSPORT_EXT_XR_EXT_view_configuration_depth_range
+#ifdef XRTRANSPORT_EXT_XR_FB_android_surface_swapchain_create
+    XR_TYPE_ANDROID_SURFACE_SWAPCHAIN_CREATE_INFO_FB,
+    XR_TYPE_ANDROID_SURFACE_SWAPCHAIN_CREATE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_android_surface_swapchain_create
+#ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
+    XR_TYPE_BODY_JOINT_LOCATIONS_FB,
+    XR_TYPE_BODY_JOINT_LOCATIONS_FB,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_FB,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_FB,
+    XR_TYPE_BODY_SKELETON_FB,
+    XR_TYPE_BODY_SKELETON_FB,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_SYSTEM_BODY_TRACKING_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_BODY_TRACKING_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_color_space
+    XR_TYPE_SYSTEM_COLOR_SPACE_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_COLOR_SPACE_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_color_space
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_alpha_blend
+    XR_TYPE_COMPOSITION_LAYER_ALPHA_BLEND_FB,
+    XR_TYPE_COMPOSITION_LAYER_ALPHA_BLEND_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_alpha_blend
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_depth_test
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_TEST_FB,
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_TEST_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_depth_test
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_image_layout
+    XR_TYPE_COMPOSITION_LAYER_IMAGE_LAYOUT_FB,
+    XR_TYPE_COMPOSITION_LAYER_IMAGE_LAYOUT_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_image_layout
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_secure_content
+    XR_TYPE_COMPOSITION_LAYER_SECURE_CONTENT_FB,
+    XR_TYPE_COMPOSITION_LAYER_SECURE_CONTENT_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_secure_content
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_settings
+    XR_TYPE_COMPOSITION_LAYER_SETTINGS_FB,
+    XR_TYPE_COMPOSITION_LAYER_SETTINGS_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_settings
+#ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+    XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB,
+    XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+#ifdef XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+    XR_TYPE_EYE_GAZES_FB,
+    XR_TYPE_EYE_GAZES_FB,
+    XR_TYPE_EYE_GAZES_INFO_FB,
+    XR_TYPE_EYE_GAZES_INFO_FB,
+    XR_TYPE_EYE_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_EYE_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_SYSTEM_EYE_TRACKING_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_EYE_TRACKING_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking
+    XR_TYPE_FACE_EXPRESSION_INFO_FB,
+    XR_TYPE_FACE_EXPRESSION_INFO_FB,
+    XR_TYPE_FACE_EXPRESSION_WEIGHTS_FB,
+    XR_TYPE_FACE_EXPRESSION_WEIGHTS_FB,
+    XR_TYPE_FACE_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_FACE_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_SYSTEM_FACE_TRACKING_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_FACE_TRACKING_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking2
+    XR_TYPE_FACE_EXPRESSION_INFO2_FB,
+    XR_TYPE_FACE_EXPRESSION_INFO2_FB,
+    XR_TYPE_FACE_EXPRESSION_WEIGHTS2_FB,
+    XR_TYPE_FACE_EXPRESSION_WEIGHTS2_FB,
+    XR_TYPE_FACE_TRACKER_CREATE_INFO2_FB,
+    XR_TYPE_FACE_TRACKER_CREATE_INFO2_FB,
+    XR_TYPE_SYSTEM_FACE_TRACKING_PROPERTIES2_FB,
+    XR_TYPE_SYSTEM_FACE_TRACKING_PROPERTIES2_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking2
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation
+    XR_TYPE_FOVEATION_PROFILE_CREATE_INFO_FB,
+    XR_TYPE_FOVEATION_PROFILE_CREATE_INFO_FB,
+    XR_TYPE_SWAPCHAIN_CREATE_INFO_FOVEATION_FB,
+    XR_TYPE_SWAPCHAIN_CREATE_INFO_FOVEATION_FB,
+    XR_TYPE_SWAPCHAIN_STATE_FOVEATION_FB,
+    XR_TYPE_SWAPCHAIN_STATE_FOVEATION_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_foveation
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation_configuration
+    XR_TYPE_FOVEATION_LEVEL_PROFILE_CREATE_INFO_FB,
+    XR_TYPE_FOVEATION_LEVEL_PROFILE_CREATE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_foveation_configuration
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation_vulkan
+    XR_TYPE_SWAPCHAIN_IMAGE_FOVEATION_VULKAN_FB,
+    XR_TYPE_SWAPCHAIN_IMAGE_FOVEATION_VULKAN_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_foveation_vulkan
+#ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_aim
+    XR_TYPE_HAND_TRACKING_AIM_STATE_FB,
+    XR_TYPE_HAND_TRACKING_AIM_STATE_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_aim
+#ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules
+    XR_TYPE_HAND_TRACKING_CAPSULES_STATE_FB,
+    XR_TYPE_HAND_TRACKING_CAPSULES_STATE_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules
+#ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_mesh
+    XR_TYPE_HAND_TRACKING_MESH_FB,
+    XR_TYPE_HAND_TRACKING_MESH_FB,
+    XR_TYPE_HAND_TRACKING_SCALE_FB,
+    XR_TYPE_HAND_TRACKING_SCALE_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_mesh
+#ifdef XRTRANSPORT_EXT_XR_FB_haptic_amplitude_envelope
+    XR_TYPE_HAPTIC_AMPLITUDE_ENVELOPE_VIBRATION_FB,
+    XR_TYPE_HAPTIC_AMPLITUDE_ENVELOPE_VIBRATION_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_haptic_amplitude_envelope
+#ifdef XRTRANSPORT_EXT_XR_FB_haptic_pcm
+    XR_TYPE_DEVICE_PCM_SAMPLE_RATE_STATE_FB,
+    XR_TYPE_DEVICE_PCM_SAMPLE_RATE_STATE_FB,
+    XR_TYPE_HAPTIC_PCM_VIBRATION_FB,
+    XR_TYPE_HAPTIC_PCM_VIBRATION_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_haptic_pcm
+#ifdef XRTRANSPORT_EXT_XR_FB_keyboard_tracking
+    XR_TYPE_KEYBOARD_SPACE_CREATE_INFO_FB,
+    XR_TYPE_KEYBOARD_SPACE_CREATE_INFO_FB,
+    XR_TYPE_KEYBOARD_TRACKING_QUERY_FB,
+    XR_TYPE_KEYBOARD_TRACKING_QUERY_FB,
+    XR_TYPE_SYSTEM_KEYBOARD_TRACKING_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_KEYBOARD_TRACKING_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_keyboard_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_passthrough
+    XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_FB,
+    XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_FB,
+    XR_TYPE_EVENT_DATA_PASSTHROUGH_STATE_CHANGED_FB,
+    XR_TYPE_EVENT_DATA_PASSTHROUGH_STATE_CHANGED_FB,
+    XR_TYPE_GEOMETRY_INSTANCE_CREATE_INFO_FB,
+    XR_TYPE_GEOMETRY_INSTANCE_CREATE_INFO_FB,
+    XR_TYPE_GEOMETRY_INSTANCE_TRANSFORM_FB,
+    XR_TYPE_GEOMETRY_INSTANCE_TRANSFORM_FB,
+    XR_TYPE_PASSTHROUGH_BRIGHTNESS_CONTRAST_SATURATION_FB,
+    XR_TYPE_PASSTHROUGH_BRIGHTNESS_CONTRAST_SATURATION_FB,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_MONO_TO_MONO_FB,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_MONO_TO_MONO_FB,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_MONO_TO_RGBA_FB,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_MONO_TO_RGBA_FB,
+    XR_TYPE_PASSTHROUGH_CREATE_INFO_FB,
+    XR_TYPE_PASSTHROUGH_CREATE_INFO_FB,
+    XR_TYPE_PASSTHROUGH_LAYER_CREATE_INFO_FB,
+    XR_TYPE_PASSTHROUGH_LAYER_CREATE_INFO_FB,
+    XR_TYPE_PASSTHROUGH_STYLE_FB,
+    XR_TYPE_PASSTHROUGH_STYLE_FB,
+    XR_TYPE_SYSTEM_PASSTHROUGH_PROPERTIES2_FB,
+    XR_TYPE_SYSTEM_PASSTHROUGH_PROPERTIES2_FB,
+    XR_TYPE_SYSTEM_PASSTHROUGH_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_PASSTHROUGH_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_passthrough
+#ifdef XRTRANSPORT_EXT_XR_FB_passthrough_keyboard_hands
+    XR_TYPE_PASSTHROUGH_KEYBOARD_HANDS_INTENSITY_FB,
+    XR_TYPE_PASSTHROUGH_KEYBOARD_HANDS_INTENSITY_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_passthrough_keyboard_hands
+#ifdef XRTRANSPORT_EXT_XR_FB_render_model
+    XR_TYPE_RENDER_MODEL_BUFFER_FB,
+    XR_TYPE_RENDER_MODEL_BUFFER_FB,
+    XR_TYPE_RENDER_MODEL_CAPABILITIES_REQUEST_FB,
+    XR_TYPE_RENDER_MODEL_CAPABILITIES_REQUEST_FB,
+    XR_TYPE_RENDER_MODEL_LOAD_INFO_FB,
+    XR_TYPE_RENDER_MODEL_LOAD_INFO_FB,
+    XR_TYPE_RENDER_MODEL_PATH_INFO_FB,
+    XR_TYPE_RENDER_MODEL_PATH_INFO_FB,
+    XR_TYPE_RENDER_MODEL_PROPERTIES_FB,
+    XR_TYPE_RENDER_MODEL_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_RENDER_MODEL_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_RENDER_MODEL_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_render_model
+#ifdef XRTRANSPORT_EXT_XR_FB_scene
+    XR_TYPE_BOUNDARY_2D_FB,
+    XR_TYPE_BOUNDARY_2D_FB,
+    XR_TYPE_ROOM_LAYOUT_FB,
+    XR_TYPE_ROOM_LAYOUT_FB,
+    XR_TYPE_SEMANTIC_LABELS_FB,
+    XR_TYPE_SEMANTIC_LABELS_FB,
+    XR_TYPE_SEMANTIC_LABELS_SUPPORT_INFO_FB,
+    XR_TYPE_SEMANTIC_LABELS_SUPPORT_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_scene
+#ifdef XRTRANSPORT_EXT_XR_FB_scene_capture
+    XR_TYPE_EVENT_DATA_SCENE_CAPTURE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SCENE_CAPTURE_COMPLETE_FB,
+    XR_TYPE_SCENE_CAPTURE_REQUEST_INFO_FB,
+    XR_TYPE_SCENE_CAPTURE_REQUEST_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_scene_capture
+#ifdef XRTRANSPORT_EXT_XR_FB_space_warp
+    XR_TYPE_COMPOSITION_LAYER_SPACE_WARP_INFO_FB,
+    XR_TYPE_COMPOSITION_LAYER_SPACE_WARP_INFO_FB,
+    XR_TYPE_SYSTEM_SPACE_WARP_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_SPACE_WARP_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_space_warp
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity
+    XR_TYPE_EVENT_DATA_SPACE_SET_STATUS_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_SET_STATUS_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPATIAL_ANCHOR_CREATE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPATIAL_ANCHOR_CREATE_COMPLETE_FB,
+    XR_TYPE_SPACE_COMPONENT_STATUS_FB,
+    XR_TYPE_SPACE_COMPONENT_STATUS_FB,
+    XR_TYPE_SPACE_COMPONENT_STATUS_SET_INFO_FB,
+    XR_TYPE_SPACE_COMPONENT_STATUS_SET_INFO_FB,
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_FB,
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_FB,
+    XR_TYPE_SYSTEM_SPATIAL_ENTITY_PROPERTIES_FB,
+    XR_TYPE_SYSTEM_SPATIAL_ENTITY_PROPERTIES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_container
+    XR_TYPE_SPACE_CONTAINER_FB,
+    XR_TYPE_SPACE_CONTAINER_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_container
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_query
+    XR_TYPE_EVENT_DATA_SPACE_QUERY_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_QUERY_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_QUERY_RESULTS_AVAILABLE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_QUERY_RESULTS_AVAILABLE_FB,
+    XR_TYPE_SPACE_COMPONENT_FILTER_INFO_FB,
+    XR_TYPE_SPACE_COMPONENT_FILTER_INFO_FB,
+    XR_TYPE_SPACE_QUERY_INFO_FB,
+    XR_TYPE_SPACE_QUERY_INFO_FB,
+    XR_TYPE_SPACE_QUERY_RESULTS_FB,
+    XR_TYPE_SPACE_QUERY_RESULTS_FB,
+    XR_TYPE_SPACE_STORAGE_LOCATION_FILTER_INFO_FB,
+    XR_TYPE_SPACE_STORAGE_LOCATION_FILTER_INFO_FB,
+    XR_TYPE_SPACE_UUID_FILTER_INFO_FB,
+    XR_TYPE_SPACE_UUID_FILTER_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_query
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_sharing
+    XR_TYPE_EVENT_DATA_SPACE_SHARE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_SHARE_COMPLETE_FB,
+    XR_TYPE_SPACE_SHARE_INFO_FB,
+    XR_TYPE_SPACE_SHARE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_sharing
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_storage
+    XR_TYPE_EVENT_DATA_SPACE_ERASE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_ERASE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_SAVE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_SAVE_COMPLETE_FB,
+    XR_TYPE_SPACE_ERASE_INFO_FB,
+    XR_TYPE_SPACE_ERASE_INFO_FB,
+    XR_TYPE_SPACE_SAVE_INFO_FB,
+    XR_TYPE_SPACE_SAVE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_storage
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_storage_batch
+    XR_TYPE_EVENT_DATA_SPACE_LIST_SAVE_COMPLETE_FB,
+    XR_TYPE_EVENT_DATA_SPACE_LIST_SAVE_COMPLETE_FB,
+    XR_TYPE_SPACE_LIST_SAVE_INFO_FB,
+    XR_TYPE_SPACE_LIST_SAVE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_storage_batch
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_user
+    XR_TYPE_SPACE_USER_CREATE_INFO_FB,
+    XR_TYPE_SPACE_USER_CREATE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_user
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state_android_surface
+    XR_TYPE_SWAPCHAIN_STATE_ANDROID_SURFACE_DIMENSIONS_FB,
+    XR_TYPE_SWAPCHAIN_STATE_ANDROID_SURFACE_DIMENSIONS_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state_android_surface
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state_opengl_es
+    XR_TYPE_SWAPCHAIN_STATE_SAMPLER_OPENGL_ES_FB,
+    XR_TYPE_SWAPCHAIN_STATE_SAMPLER_OPENGL_ES_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state_opengl_es
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state_vulkan
+    XR_TYPE_SWAPCHAIN_STATE_SAMPLER_VULKAN_FB,
+    XR_TYPE_SWAPCHAIN_STATE_SAMPLER_VULKAN_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state_vulkan
+#ifdef XRTRANSPORT_EXT_XR_FB_triangle_mesh
+    XR_TYPE_TRIANGLE_MESH_CREATE_INFO_FB,
+    XR_TYPE_TRIANGLE_MESH_CREATE_INFO_FB,
+#endif // XRTRANSPORT_EXT_XR_FB_triangle_mesh
+#ifdef XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
+    XR_TYPE_EVENT_DATA_VIVE_TRACKER_CONNECTED_HTCX,
+    XR_TYPE_EVENT_DATA_VIVE_TRACKER_CONNECTED_HTCX,
+    XR_TYPE_VIVE_TRACKER_PATHS_HTCX,
+    XR_TYPE_VIVE_TRACKER_PATHS_HTCX,
+#endif // XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
+#ifdef XRTRANSPORT_EXT_XR_HTC_anchor
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_HTC,
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_HTC,
+    XR_TYPE_SYSTEM_ANCHOR_PROPERTIES_HTC,
+    XR_TYPE_SYSTEM_ANCHOR_PROPERTIES_HTC,
+#endif // XRTRANSPORT_EXT_XR_HTC_anchor
+#ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
+    XR_TYPE_BODY_JOINT_LOCATIONS_HTC,
+    XR_TYPE_BODY_JOINT_LOCATIONS_HTC,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_HTC,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_HTC,
+    XR_TYPE_BODY_SKELETON_HTC,
+    XR_TYPE_BODY_SKELETON_HTC,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_HTC,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_HTC,
+    XR_TYPE_SYSTEM_BODY_TRACKING_PROPERTIES_HTC,
+    XR_TYPE_SYSTEM_BODY_TRACKING_PROPERTIES_HTC,
+#endif // XRTRANSPORT_EXT_XR_HTC_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_facial_tracking
+    XR_TYPE_FACIAL_EXPRESSIONS_HTC,
+    XR_TYPE_FACIAL_EXPRESSIONS_HTC,
+    XR_TYPE_FACIAL_TRACKER_CREATE_INFO_HTC,
+    XR_TYPE_FACIAL_TRACKER_CREATE_INFO_HTC,
+    XR_TYPE_SYSTEM_FACIAL_TRACKING_PROPERTIES_HTC,
+    XR_TYPE_SYSTEM_FACIAL_TRACKING_PROPERTIES_HTC,
+#endif // XRTRANSPORT_EXT_XR_HTC_facial_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_foveation
+    XR_TYPE_FOVEATION_APPLY_INFO_HTC,
+    XR_TYPE_FOVEATION_APPLY_INFO_HTC,
+    XR_TYPE_FOVEATION_CUSTOM_MODE_INFO_HTC,
+    XR_TYPE_FOVEATION_CUSTOM_MODE_INFO_HTC,
+    XR_TYPE_FOVEATION_DYNAMIC_MODE_INFO_HTC,
+    XR_TYPE_FOVEATION_DYNAMIC_MODE_INFO_HTC,
+#endif // XRTRANSPORT_EXT_XR_HTC_foveation
+#ifdef XRTRANSPORT_EXT_XR_HTC_passthrough
+    XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_HTC,
+    XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_HTC,
+    XR_TYPE_PASSTHROUGH_COLOR_HTC,
+    XR_TYPE_PASSTHROUGH_COLOR_HTC,
+    XR_TYPE_PASSTHROUGH_CREATE_INFO_HTC,
+    XR_TYPE_PASSTHROUGH_CREATE_INFO_HTC,
+    XR_TYPE_PASSTHROUGH_MESH_TRANSFORM_INFO_HTC,
+    XR_TYPE_PASSTHROUGH_MESH_TRANSFORM_INFO_HTC,
+#endif // XRTRANSPORT_EXT_XR_HTC_passthrough
+#ifdef XRTRANSPORT_EXT_XR_KHR_D3D11_enable
+    XR_TYPE_GRAPHICS_BINDING_D3D11_KHR,
+    XR_TYPE_GRAPHICS_BINDING_D3D11_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_D3D11_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_D3D11_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_D3D11_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_D3D11_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_D3D11_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_D3D12_enable
+    XR_TYPE_GRAPHICS_BINDING_D3D12_KHR,
+    XR_TYPE_GRAPHICS_BINDING_D3D12_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_D3D12_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_D3D12_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_D3D12_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_D3D12_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_D3D12_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_android_create_instance
+    XR_TYPE_INSTANCE_CREATE_INFO_ANDROID_KHR,
+    XR_TYPE_INSTANCE_CREATE_INFO_ANDROID_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_android_create_instance
+#ifdef XRTRANSPORT_EXT_XR_KHR_binding_modification
+    XR_TYPE_BINDING_MODIFICATIONS_KHR,
+    XR_TYPE_BINDING_MODIFICATIONS_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_binding_modification
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_color_scale_bias
+    XR_TYPE_COMPOSITION_LAYER_COLOR_SCALE_BIAS_KHR,
+    XR_TYPE_COMPOSITION_LAYER_COLOR_SCALE_BIAS_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_color_scale_bias
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_cube
+    XR_TYPE_COMPOSITION_LAYER_CUBE_KHR,
+    XR_TYPE_COMPOSITION_LAYER_CUBE_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_cube
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_cylinder
+    XR_TYPE_COMPOSITION_LAYER_CYLINDER_KHR,
+    XR_TYPE_COMPOSITION_LAYER_CYLINDER_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_cylinder
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_depth
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR,
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_depth
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect
+    XR_TYPE_COMPOSITION_LAYER_EQUIRECT_KHR,
+    XR_TYPE_COMPOSITION_LAYER_EQUIRECT_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect2
+    XR_TYPE_COMPOSITION_LAYER_EQUIRECT2_KHR,
+    XR_TYPE_COMPOSITION_LAYER_EQUIRECT2_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect2
+#ifdef XRTRANSPORT_EXT_XR_KHR_loader_init
+#endif // XRTRANSPORT_EXT_XR_KHR_loader_init
+#ifdef XRTRANSPORT_EXT_XR_KHR_loader_init_android
+    XR_TYPE_LOADER_INIT_INFO_ANDROID_KHR,
+    XR_TYPE_LOADER_INIT_INFO_ANDROID_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_loader_init_android
+#ifdef XRTRANSPORT_EXT_XR_KHR_metal_enable
+    XR_TYPE_GRAPHICS_BINDING_METAL_KHR,
+    XR_TYPE_GRAPHICS_BINDING_METAL_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_METAL_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_METAL_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_METAL_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_METAL_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_metal_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_opengl_enable
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_WAYLAND_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_WAYLAND_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_WIN32_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_WIN32_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_XCB_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_XCB_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_XLIB_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_XLIB_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_OPENGL_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_OPENGL_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_opengl_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_opengl_es_enable
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_OPENGL_ES_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_OPENGL_ES_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_opengl_es_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_visibility_mask
+    XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR,
+    XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR,
+    XR_TYPE_VISIBILITY_MASK_KHR,
+    XR_TYPE_VISIBILITY_MASK_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_visibility_mask
+#ifdef XRTRANSPORT_EXT_XR_KHR_vulkan_enable
+    XR_TYPE_GRAPHICS_BINDING_VULKAN_KHR,
+    XR_TYPE_GRAPHICS_BINDING_VULKAN_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_VULKAN_KHR,
+    XR_TYPE_GRAPHICS_REQUIREMENTS_VULKAN_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_VULKAN_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_VULKAN_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_vulkan_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_vulkan_enable2
+    XR_TYPE_VULKAN_DEVICE_CREATE_INFO_KHR,
+    XR_TYPE_VULKAN_DEVICE_CREATE_INFO_KHR,
+    XR_TYPE_VULKAN_GRAPHICS_DEVICE_GET_INFO_KHR,
+    XR_TYPE_VULKAN_GRAPHICS_DEVICE_GET_INFO_KHR,
+    XR_TYPE_VULKAN_INSTANCE_CREATE_INFO_KHR,
+    XR_TYPE_VULKAN_INSTANCE_CREATE_INFO_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_vulkan_enable2
+#ifdef XRTRANSPORT_EXT_XR_KHR_vulkan_swapchain_format_list
+    XR_TYPE_VULKAN_SWAPCHAIN_FORMAT_LIST_CREATE_INFO_KHR,
+    XR_TYPE_VULKAN_SWAPCHAIN_FORMAT_LIST_CREATE_INFO_KHR,
+#endif // XRTRANSPORT_EXT_XR_KHR_vulkan_swapchain_format_list
+#ifdef XRTRANSPORT_EXT_XR_META_body_tracking_full_body
+    XR_TYPE_SYSTEM_PROPERTIES_BODY_TRACKING_FULL_BODY_META,
+    XR_TYPE_SYSTEM_PROPERTIES_BODY_TRACKING_FULL_BODY_META,
+#endif // XRTRANSPORT_EXT_XR_META_body_tracking_full_body
+#ifdef XRTRANSPORT_EXT_XR_META_colocation_discovery
+    XR_TYPE_COLOCATION_ADVERTISEMENT_START_INFO_META,
+    XR_TYPE_COLOCATION_ADVERTISEMENT_START_INFO_META,
+    XR_TYPE_COLOCATION_ADVERTISEMENT_STOP_INFO_META,
+    XR_TYPE_COLOCATION_ADVERTISEMENT_STOP_INFO_META,
+    XR_TYPE_COLOCATION_DISCOVERY_START_INFO_META,
+    XR_TYPE_COLOCATION_DISCOVERY_START_INFO_META,
+    XR_TYPE_COLOCATION_DISCOVERY_STOP_INFO_META,
+    XR_TYPE_COLOCATION_DISCOVERY_STOP_INFO_META,
+    XR_TYPE_EVENT_DATA_COLOCATION_ADVERTISEMENT_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_COLOCATION_ADVERTISEMENT_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_COLOCATION_DISCOVERY_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_COLOCATION_DISCOVERY_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_COLOCATION_DISCOVERY_RESULT_META,
+    XR_TYPE_EVENT_DATA_COLOCATION_DISCOVERY_RESULT_META,
+    XR_TYPE_EVENT_DATA_START_COLOCATION_ADVERTISEMENT_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_START_COLOCATION_ADVERTISEMENT_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_START_COLOCATION_DISCOVERY_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_START_COLOCATION_DISCOVERY_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_STOP_COLOCATION_ADVERTISEMENT_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_STOP_COLOCATION_ADVERTISEMENT_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_STOP_COLOCATION_DISCOVERY_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_STOP_COLOCATION_DISCOVERY_COMPLETE_META,
+    XR_TYPE_SYSTEM_COLOCATION_DISCOVERY_PROPERTIES_META,
+    XR_TYPE_SYSTEM_COLOCATION_DISCOVERY_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_colocation_discovery
+#ifdef XRTRANSPORT_EXT_XR_META_environment_depth
+    XR_TYPE_ENVIRONMENT_DEPTH_HAND_REMOVAL_SET_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_HAND_REMOVAL_SET_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_IMAGE_ACQUIRE_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_IMAGE_ACQUIRE_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_IMAGE_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_IMAGE_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_IMAGE_VIEW_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_IMAGE_VIEW_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_PROVIDER_CREATE_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_PROVIDER_CREATE_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_SWAPCHAIN_CREATE_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_SWAPCHAIN_CREATE_INFO_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_SWAPCHAIN_STATE_META,
+    XR_TYPE_ENVIRONMENT_DEPTH_SWAPCHAIN_STATE_META,
+    XR_TYPE_SYSTEM_ENVIRONMENT_DEPTH_PROPERTIES_META,
+    XR_TYPE_SYSTEM_ENVIRONMENT_DEPTH_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_environment_depth
+#ifdef XRTRANSPORT_EXT_XR_META_foveation_eye_tracked
+    XR_TYPE_FOVEATION_EYE_TRACKED_PROFILE_CREATE_INFO_META,
+    XR_TYPE_FOVEATION_EYE_TRACKED_PROFILE_CREATE_INFO_META,
+    XR_TYPE_FOVEATION_EYE_TRACKED_STATE_META,
+    XR_TYPE_FOVEATION_EYE_TRACKED_STATE_META,
+    XR_TYPE_SYSTEM_FOVEATION_EYE_TRACKED_PROPERTIES_META,
+    XR_TYPE_SYSTEM_FOVEATION_EYE_TRACKED_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_foveation_eye_tracked
+#ifdef XRTRANSPORT_EXT_XR_META_headset_id
+    XR_TYPE_SYSTEM_HEADSET_ID_PROPERTIES_META,
+    XR_TYPE_SYSTEM_HEADSET_ID_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_headset_id
+#ifdef XRTRANSPORT_EXT_XR_META_local_dimming
+    XR_TYPE_LOCAL_DIMMING_FRAME_END_INFO_META,
+    XR_TYPE_LOCAL_DIMMING_FRAME_END_INFO_META,
+#endif // XRTRANSPORT_EXT_XR_META_local_dimming
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_color_lut
+    XR_TYPE_PASSTHROUGH_COLOR_LUT_CREATE_INFO_META,
+    XR_TYPE_PASSTHROUGH_COLOR_LUT_CREATE_INFO_META,
+    XR_TYPE_PASSTHROUGH_COLOR_LUT_UPDATE_INFO_META,
+    XR_TYPE_PASSTHROUGH_COLOR_LUT_UPDATE_INFO_META,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_INTERPOLATED_LUT_META,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_INTERPOLATED_LUT_META,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_LUT_META,
+    XR_TYPE_PASSTHROUGH_COLOR_MAP_LUT_META,
+    XR_TYPE_SYSTEM_PASSTHROUGH_COLOR_LUT_PROPERTIES_META,
+    XR_TYPE_SYSTEM_PASSTHROUGH_COLOR_LUT_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_color_lut
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_layer_resumed_event
+    XR_TYPE_EVENT_DATA_PASSTHROUGH_LAYER_RESUMED_META,
+    XR_TYPE_EVENT_DATA_PASSTHROUGH_LAYER_RESUMED_META,
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_layer_resumed_event
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_preferences
+    XR_TYPE_PASSTHROUGH_PREFERENCES_META,
+    XR_TYPE_PASSTHROUGH_PREFERENCES_META,
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_preferences
+#ifdef XRTRANSPORT_EXT_XR_META_performance_metrics
+    XR_TYPE_PERFORMANCE_METRICS_COUNTER_META,
+    XR_TYPE_PERFORMANCE_METRICS_COUNTER_META,
+    XR_TYPE_PERFORMANCE_METRICS_STATE_META,
+    XR_TYPE_PERFORMANCE_METRICS_STATE_META,
+#endif // XRTRANSPORT_EXT_XR_META_performance_metrics
+#ifdef XRTRANSPORT_EXT_XR_META_recommended_layer_resolution
+    XR_TYPE_RECOMMENDED_LAYER_RESOLUTION_GET_INFO_META,
+    XR_TYPE_RECOMMENDED_LAYER_RESOLUTION_GET_INFO_META,
+    XR_TYPE_RECOMMENDED_LAYER_RESOLUTION_META,
+    XR_TYPE_RECOMMENDED_LAYER_RESOLUTION_META,
+#endif // XRTRANSPORT_EXT_XR_META_recommended_layer_resolution
+#ifdef XRTRANSPORT_EXT_XR_META_simultaneous_hands_and_controllers
+    XR_TYPE_SIMULTANEOUS_HANDS_AND_CONTROLLERS_TRACKING_PAUSE_INFO_META,
+    XR_TYPE_SIMULTANEOUS_HANDS_AND_CONTROLLERS_TRACKING_PAUSE_INFO_META,
+    XR_TYPE_SIMULTANEOUS_HANDS_AND_CONTROLLERS_TRACKING_RESUME_INFO_META,
+    XR_TYPE_SIMULTANEOUS_HANDS_AND_CONTROLLERS_TRACKING_RESUME_INFO_META,
+    XR_TYPE_SYSTEM_SIMULTANEOUS_HANDS_AND_CONTROLLERS_PROPERTIES_META,
+    XR_TYPE_SYSTEM_SIMULTANEOUS_HANDS_AND_CONTROLLERS_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_simultaneous_hands_and_controllers
+#ifdef XRTRANSPORT_EXT_XR_META_spatial_entity_group_sharing
+    XR_TYPE_SHARE_SPACES_RECIPIENT_GROUPS_META,
+    XR_TYPE_SHARE_SPACES_RECIPIENT_GROUPS_META,
+    XR_TYPE_SPACE_GROUP_UUID_FILTER_INFO_META,
+    XR_TYPE_SPACE_GROUP_UUID_FILTER_INFO_META,
+    XR_TYPE_SYSTEM_SPATIAL_ENTITY_GROUP_SHARING_PROPERTIES_META,
+    XR_TYPE_SYSTEM_SPATIAL_ENTITY_GROUP_SHARING_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_spatial_entity_group_sharing
+#ifdef XRTRANSPORT_EXT_XR_META_spatial_entity_mesh
+    XR_TYPE_SPACE_TRIANGLE_MESH_GET_INFO_META,
+    XR_TYPE_SPACE_TRIANGLE_MESH_GET_INFO_META,
+    XR_TYPE_SPACE_TRIANGLE_MESH_META,
+    XR_TYPE_SPACE_TRIANGLE_MESH_META,
+#endif // XRTRANSPORT_EXT_XR_META_spatial_entity_mesh
+#ifdef XRTRANSPORT_EXT_XR_META_spatial_entity_sharing
+    XR_TYPE_EVENT_DATA_SHARE_SPACES_COMPLETE_META,
+    XR_TYPE_EVENT_DATA_SHARE_SPACES_COMPLETE_META,
+    XR_TYPE_SHARE_SPACES_INFO_META,
+    XR_TYPE_SHARE_SPACES_INFO_META,
+    XR_TYPE_SYSTEM_SPATIAL_ENTITY_SHARING_PROPERTIES_META,
+    XR_TYPE_SYSTEM_SPATIAL_ENTITY_SHARING_PROPERTIES_META,
+#endif // XRTRANSPORT_EXT_XR_META_spatial_entity_sharing
+#ifdef XRTRANSPORT_EXT_XR_META_virtual_keyboard
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_BACKSPACE_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_BACKSPACE_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_COMMIT_TEXT_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_COMMIT_TEXT_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_ENTER_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_ENTER_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_HIDDEN_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_HIDDEN_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_SHOWN_META,
+    XR_TYPE_EVENT_DATA_VIRTUAL_KEYBOARD_SHOWN_META,
+    XR_TYPE_SYSTEM_VIRTUAL_KEYBOARD_PROPERTIES_META,
+    XR_TYPE_SYSTEM_VIRTUAL_KEYBOARD_PROPERTIES_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_ANIMATION_STATE_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_ANIMATION_STATE_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_CREATE_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_CREATE_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_INPUT_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_INPUT_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_LOCATION_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_LOCATION_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_MODEL_ANIMATION_STATES_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_MODEL_ANIMATION_STATES_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_MODEL_VISIBILITY_SET_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_MODEL_VISIBILITY_SET_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_SPACE_CREATE_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_SPACE_CREATE_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_TEXT_CONTEXT_CHANGE_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_TEXT_CONTEXT_CHANGE_INFO_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_TEXTURE_DATA_META,
+    XR_TYPE_VIRTUAL_KEYBOARD_TEXTURE_DATA_META,
+#endif // XRTRANSPORT_EXT_XR_META_virtual_keyboard
+#ifdef XRTRANSPORT_EXT_XR_META_vulkan_swapchain_create_info
+    XR_TYPE_VULKAN_SWAPCHAIN_CREATE_INFO_META,
+    XR_TYPE_VULKAN_SWAPCHAIN_CREATE_INFO_META,
+#endif // XRTRANSPORT_EXT_XR_META_vulkan_swapchain_create_info
+#ifdef XRTRANSPORT_EXT_XR_ML_compat
+    XR_TYPE_COORDINATE_SPACE_CREATE_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_compat
+#ifdef XRTRANSPORT_EXT_XR_ML_facial_expression
+    XR_TYPE_FACIAL_EXPRESSION_BLEND_SHAPE_GET_INFO_ML,
+    XR_TYPE_FACIAL_EXPRESSION_BLEND_SHAPE_GET_INFO_ML,
+    XR_TYPE_FACIAL_EXPRESSION_BLEND_SHAPE_PROPERTIES_ML,
+    XR_TYPE_FACIAL_EXPRESSION_BLEND_SHAPE_PROPERTIES_ML,
+    XR_TYPE_FACIAL_EXPRESSION_CLIENT_CREATE_INFO_ML,
+    XR_TYPE_FACIAL_EXPRESSION_CLIENT_CREATE_INFO_ML,
+    XR_TYPE_SYSTEM_FACIAL_EXPRESSION_PROPERTIES_ML,
+    XR_TYPE_SYSTEM_FACIAL_EXPRESSION_PROPERTIES_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_facial_expression
+#ifdef XRTRANSPORT_EXT_XR_ML_frame_end_info
+    XR_TYPE_FRAME_END_INFO_ML,
+    XR_TYPE_FRAME_END_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_frame_end_info
+#ifdef XRTRANSPORT_EXT_XR_ML_global_dimmer
+    XR_TYPE_GLOBAL_DIMMER_FRAME_END_INFO_ML,
+    XR_TYPE_GLOBAL_DIMMER_FRAME_END_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_global_dimmer
+#ifdef XRTRANSPORT_EXT_XR_ML_localization_map
+    XR_TYPE_EVENT_DATA_LOCALIZATION_CHANGED_ML,
+    XR_TYPE_EVENT_DATA_LOCALIZATION_CHANGED_ML,
+    XR_TYPE_LOCALIZATION_ENABLE_EVENTS_INFO_ML,
+    XR_TYPE_LOCALIZATION_ENABLE_EVENTS_INFO_ML,
+    XR_TYPE_LOCALIZATION_MAP_IMPORT_INFO_ML,
+    XR_TYPE_LOCALIZATION_MAP_IMPORT_INFO_ML,
+    XR_TYPE_LOCALIZATION_MAP_ML,
+    XR_TYPE_LOCALIZATION_MAP_ML,
+    XR_TYPE_MAP_LOCALIZATION_REQUEST_INFO_ML,
+    XR_TYPE_MAP_LOCALIZATION_REQUEST_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_localization_map
+#ifdef XRTRANSPORT_EXT_XR_ML_marker_understanding
+    XR_TYPE_MARKER_DETECTOR_APRIL_TAG_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_APRIL_TAG_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_ARUCO_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_ARUCO_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_CREATE_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_CREATE_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_CUSTOM_PROFILE_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_CUSTOM_PROFILE_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_SIZE_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_SIZE_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_SNAPSHOT_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_SNAPSHOT_INFO_ML,
+    XR_TYPE_MARKER_DETECTOR_STATE_ML,
+    XR_TYPE_MARKER_DETECTOR_STATE_ML,
+    XR_TYPE_MARKER_SPACE_CREATE_INFO_ML,
+    XR_TYPE_MARKER_SPACE_CREATE_INFO_ML,
+    XR_TYPE_SYSTEM_MARKER_UNDERSTANDING_PROPERTIES_ML,
+    XR_TYPE_SYSTEM_MARKER_UNDERSTANDING_PROPERTIES_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_marker_understanding
+#ifdef XRTRANSPORT_EXT_XR_ML_spatial_anchors
+    XR_TYPE_CREATE_SPATIAL_ANCHORS_COMPLETION_ML,
+    XR_TYPE_CREATE_SPATIAL_ANCHORS_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHOR_STATE_ML,
+    XR_TYPE_SPATIAL_ANCHOR_STATE_ML,
+    XR_TYPE_SPATIAL_ANCHORS_CREATE_INFO_FROM_POSE_ML,
+    XR_TYPE_SPATIAL_ANCHORS_CREATE_INFO_FROM_POSE_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_spatial_anchors
+#ifdef XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
+    XR_TYPE_SPATIAL_ANCHORS_CREATE_INFO_FROM_UUIDS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_CREATE_INFO_FROM_UUIDS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_CREATE_STORAGE_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_CREATE_STORAGE_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_DELETE_COMPLETION_DETAILS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_DELETE_COMPLETION_DETAILS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_DELETE_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_DELETE_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_DELETE_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_DELETE_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_PUBLISH_COMPLETION_DETAILS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_PUBLISH_COMPLETION_DETAILS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_PUBLISH_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_PUBLISH_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_PUBLISH_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_PUBLISH_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_QUERY_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_QUERY_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_QUERY_INFO_RADIUS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_QUERY_INFO_RADIUS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_UPDATE_EXPIRATION_COMPLETION_DETAILS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_UPDATE_EXPIRATION_COMPLETION_DETAILS_ML,
+    XR_TYPE_SPATIAL_ANCHORS_UPDATE_EXPIRATION_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_UPDATE_EXPIRATION_COMPLETION_ML,
+    XR_TYPE_SPATIAL_ANCHORS_UPDATE_EXPIRATION_INFO_ML,
+    XR_TYPE_SPATIAL_ANCHORS_UPDATE_EXPIRATION_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
+#ifdef XRTRANSPORT_EXT_XR_ML_system_notifications
+    XR_TYPE_SYSTEM_NOTIFICATIONS_SET_INFO_ML,
+    XR_TYPE_SYSTEM_NOTIFICATIONS_SET_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_system_notifications
+#ifdef XRTRANSPORT_EXT_XR_ML_user_calibration
+    XR_TYPE_EVENT_DATA_EYE_CALIBRATION_CHANGED_ML,
+    XR_TYPE_EVENT_DATA_EYE_CALIBRATION_CHANGED_ML,
+    XR_TYPE_EVENT_DATA_HEADSET_FIT_CHANGED_ML,
+    XR_TYPE_EVENT_DATA_HEADSET_FIT_CHANGED_ML,
+    XR_TYPE_USER_CALIBRATION_ENABLE_EVENTS_INFO_ML,
+    XR_TYPE_USER_CALIBRATION_ENABLE_EVENTS_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_user_calibration
+#ifdef XRTRANSPORT_EXT_XR_ML_world_mesh_detection
+    XR_TYPE_WORLD_MESH_BLOCK_ML,
+    XR_TYPE_WORLD_MESH_BLOCK_ML,
+    XR_TYPE_WORLD_MESH_BLOCK_REQUEST_ML,
+    XR_TYPE_WORLD_MESH_BLOCK_REQUEST_ML,
+    XR_TYPE_WORLD_MESH_BLOCK_STATE_ML,
+    XR_TYPE_WORLD_MESH_BLOCK_STATE_ML,
+    XR_TYPE_WORLD_MESH_BUFFER_ML,
+    XR_TYPE_WORLD_MESH_BUFFER_ML,
+    XR_TYPE_WORLD_MESH_BUFFER_RECOMMENDED_SIZE_INFO_ML,
+    XR_TYPE_WORLD_MESH_BUFFER_RECOMMENDED_SIZE_INFO_ML,
+    XR_TYPE_WORLD_MESH_BUFFER_SIZE_ML,
+    XR_TYPE_WORLD_MESH_BUFFER_SIZE_ML,
+    XR_TYPE_WORLD_MESH_DETECTOR_CREATE_INFO_ML,
+    XR_TYPE_WORLD_MESH_DETECTOR_CREATE_INFO_ML,
+    XR_TYPE_WORLD_MESH_GET_INFO_ML,
+    XR_TYPE_WORLD_MESH_GET_INFO_ML,
+    XR_TYPE_WORLD_MESH_REQUEST_COMPLETION_INFO_ML,
+    XR_TYPE_WORLD_MESH_REQUEST_COMPLETION_INFO_ML,
+    XR_TYPE_WORLD_MESH_REQUEST_COMPLETION_ML,
+    XR_TYPE_WORLD_MESH_REQUEST_COMPLETION_ML,
+    XR_TYPE_WORLD_MESH_STATE_REQUEST_COMPLETION_ML,
+    XR_TYPE_WORLD_MESH_STATE_REQUEST_COMPLETION_ML,
+    XR_TYPE_WORLD_MESH_STATE_REQUEST_INFO_ML,
+    XR_TYPE_WORLD_MESH_STATE_REQUEST_INFO_ML,
+#endif // XRTRANSPORT_EXT_XR_ML_world_mesh_detection
+#ifdef XRTRANSPORT_EXT_XR_MNDX_egl_enable
+    XR_TYPE_GRAPHICS_BINDING_EGL_MNDX,
+    XR_TYPE_GRAPHICS_BINDING_EGL_MNDX,
+#endif // XRTRANSPORT_EXT_XR_MNDX_egl_enable
+#ifdef XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl
+    XR_TYPE_FORCE_FEEDBACK_CURL_APPLY_LOCATIONS_MNDX,
+    XR_TYPE_FORCE_FEEDBACK_CURL_APPLY_LOCATIONS_MNDX,
+    XR_TYPE_SYSTEM_FORCE_FEEDBACK_CURL_PROPERTIES_MNDX,
+    XR_TYPE_SYSTEM_FORCE_FEEDBACK_CURL_PROPERTIES_MNDX,
+#endif // XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl
+#ifdef XRTRANSPORT_EXT_XR_MSFT_composition_layer_reprojection
+    XR_TYPE_COMPOSITION_LAYER_REPROJECTION_INFO_MSFT,
+    XR_TYPE_COMPOSITION_LAYER_REPROJECTION_INFO_MSFT,
+    XR_TYPE_COMPOSITION_LAYER_REPROJECTION_PLANE_OVERRIDE_MSFT,
+    XR_TYPE_COMPOSITION_LAYER_REPROJECTION_PLANE_OVERRIDE_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_composition_layer_reprojection
+#ifdef XRTRANSPORT_EXT_XR_MSFT_controller_model
+    XR_TYPE_CONTROLLER_MODEL_KEY_STATE_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_KEY_STATE_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_NODE_PROPERTIES_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_NODE_PROPERTIES_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_NODE_STATE_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_NODE_STATE_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_PROPERTIES_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_PROPERTIES_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_STATE_MSFT,
+    XR_TYPE_CONTROLLER_MODEL_STATE_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_controller_model
+#ifdef XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+    XR_TYPE_HAND_MESH_MSFT,
+    XR_TYPE_HAND_MESH_MSFT,
+    XR_TYPE_HAND_MESH_SPACE_CREATE_INFO_MSFT,
+    XR_TYPE_HAND_MESH_SPACE_CREATE_INFO_MSFT,
+    XR_TYPE_HAND_MESH_UPDATE_INFO_MSFT,
+    XR_TYPE_HAND_MESH_UPDATE_INFO_MSFT,
+    XR_TYPE_HAND_POSE_TYPE_INFO_MSFT,
+    XR_TYPE_HAND_POSE_TYPE_INFO_MSFT,
+    XR_TYPE_SYSTEM_HAND_TRACKING_MESH_PROPERTIES_MSFT,
+    XR_TYPE_SYSTEM_HAND_TRACKING_MESH_PROPERTIES_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+#ifdef XRTRANSPORT_EXT_XR_MSFT_holographic_window_attachment
+    XR_TYPE_HOLOGRAPHIC_WINDOW_ATTACHMENT_MSFT,
+    XR_TYPE_HOLOGRAPHIC_WINDOW_ATTACHMENT_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_holographic_window_attachment
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_marker
+    XR_TYPE_SCENE_MARKER_QR_CODES_MSFT,
+    XR_TYPE_SCENE_MARKER_QR_CODES_MSFT,
+    XR_TYPE_SCENE_MARKER_TYPE_FILTER_MSFT,
+    XR_TYPE_SCENE_MARKER_TYPE_FILTER_MSFT,
+    XR_TYPE_SCENE_MARKERS_MSFT,
+    XR_TYPE_SCENE_MARKERS_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_marker
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+    XR_TYPE_NEW_SCENE_COMPUTE_INFO_MSFT,
+    XR_TYPE_NEW_SCENE_COMPUTE_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENT_LOCATIONS_MSFT,
+    XR_TYPE_SCENE_COMPONENT_LOCATIONS_MSFT,
+    XR_TYPE_SCENE_COMPONENT_PARENT_FILTER_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENT_PARENT_FILTER_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENTS_GET_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENTS_GET_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENTS_LOCATE_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENTS_LOCATE_INFO_MSFT,
+    XR_TYPE_SCENE_COMPONENTS_MSFT,
+    XR_TYPE_SCENE_COMPONENTS_MSFT,
+    XR_TYPE_SCENE_CREATE_INFO_MSFT,
+    XR_TYPE_SCENE_CREATE_INFO_MSFT,
+    XR_TYPE_SCENE_MESH_BUFFERS_GET_INFO_MSFT,
+    XR_TYPE_SCENE_MESH_BUFFERS_GET_INFO_MSFT,
+    XR_TYPE_SCENE_MESH_BUFFERS_MSFT,
+    XR_TYPE_SCENE_MESH_BUFFERS_MSFT,
+    XR_TYPE_SCENE_MESH_INDICES_UINT16_MSFT,
+    XR_TYPE_SCENE_MESH_INDICES_UINT16_MSFT,
+    XR_TYPE_SCENE_MESH_INDICES_UINT32_MSFT,
+    XR_TYPE_SCENE_MESH_INDICES_UINT32_MSFT,
+    XR_TYPE_SCENE_MESH_VERTEX_BUFFER_MSFT,
+    XR_TYPE_SCENE_MESH_VERTEX_BUFFER_MSFT,
+    XR_TYPE_SCENE_MESHES_MSFT,
+    XR_TYPE_SCENE_MESHES_MSFT,
+    XR_TYPE_SCENE_OBJECT_TYPES_FILTER_INFO_MSFT,
+    XR_TYPE_SCENE_OBJECT_TYPES_FILTER_INFO_MSFT,
+    XR_TYPE_SCENE_OBJECTS_MSFT,
+    XR_TYPE_SCENE_OBJECTS_MSFT,
+    XR_TYPE_SCENE_OBSERVER_CREATE_INFO_MSFT,
+    XR_TYPE_SCENE_OBSERVER_CREATE_INFO_MSFT,
+    XR_TYPE_SCENE_PLANE_ALIGNMENT_FILTER_INFO_MSFT,
+    XR_TYPE_SCENE_PLANE_ALIGNMENT_FILTER_INFO_MSFT,
+    XR_TYPE_SCENE_PLANES_MSFT,
+    XR_TYPE_SCENE_PLANES_MSFT,
+    XR_TYPE_VISUAL_MESH_COMPUTE_LOD_INFO_MSFT,
+    XR_TYPE_VISUAL_MESH_COMPUTE_LOD_INFO_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding_serialization
+    XR_TYPE_SCENE_DESERIALIZE_INFO_MSFT,
+    XR_TYPE_SCENE_DESERIALIZE_INFO_MSFT,
+    XR_TYPE_SERIALIZED_SCENE_FRAGMENT_DATA_GET_INFO_MSFT,
+    XR_TYPE_SERIALIZED_SCENE_FRAGMENT_DATA_GET_INFO_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding_serialization
+#ifdef XRTRANSPORT_EXT_XR_MSFT_secondary_view_configuration
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_FRAME_END_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_FRAME_END_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_FRAME_STATE_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_FRAME_STATE_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_LAYER_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_LAYER_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_SESSION_BEGIN_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_SESSION_BEGIN_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_STATE_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_STATE_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_SWAPCHAIN_CREATE_INFO_MSFT,
+    XR_TYPE_SECONDARY_VIEW_CONFIGURATION_SWAPCHAIN_CREATE_INFO_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_secondary_view_configuration
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_anchor
+    XR_TYPE_SPATIAL_ANCHOR_CREATE_INFO_MSFT,
+    XR_TYPE_SPATIAL_ANCHOR_SPACE_CREATE_INFO_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
+    XR_TYPE_SPATIAL_ANCHOR_FROM_PERSISTED_ANCHOR_CREATE_INFO_MSFT,
+    XR_TYPE_SPATIAL_ANCHOR_FROM_PERSISTED_ANCHOR_CREATE_INFO_MSFT,
+    XR_TYPE_SPATIAL_ANCHOR_PERSISTENCE_INFO_MSFT,
+    XR_TYPE_SPATIAL_ANCHOR_PERSISTENCE_INFO_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_graph_bridge
+    XR_TYPE_SPATIAL_GRAPH_NODE_BINDING_PROPERTIES_GET_INFO_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_NODE_BINDING_PROPERTIES_GET_INFO_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_NODE_BINDING_PROPERTIES_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_NODE_BINDING_PROPERTIES_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_NODE_SPACE_CREATE_INFO_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_NODE_SPACE_CREATE_INFO_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_STATIC_NODE_BINDING_CREATE_INFO_MSFT,
+    XR_TYPE_SPATIAL_GRAPH_STATIC_NODE_BINDING_CREATE_INFO_MSFT,
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_graph_bridge
+#ifdef XRTRANSPORT_EXT_XR_OCULUS_external_camera
+    XR_TYPE_EXTERNAL_CAMERA_OCULUS,
+    XR_TYPE_EXTERNAL_CAMERA_OCULUS,
+#endif // XRTRANSPORT_EXT_XR_OCULUS_external_camera
+#ifdef XRTRANSPORT_EXT_XR_VALVE_analog_threshold
+    XR_TYPE_INTERACTION_PROFILE_ANALOG_THRESHOLD_VALVE,
+    XR_TYPE_INTERACTION_PROFILE_ANALOG_THRESHOLD_VALVE,
+#endif // XRTRANSPORT_EXT_XR_VALVE_analog_threshold
+#ifdef XRTRANSPORT_EXT_XR_VARJO_composition_layer_depth_test
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_TEST_VARJO,
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_TEST_VARJO,
+#endif // XRTRANSPORT_EXT_XR_VARJO_composition_layer_depth_test
+#ifdef XRTRANSPORT_EXT_XR_VARJO_foveated_rendering
+    XR_TYPE_FOVEATED_VIEW_CONFIGURATION_VIEW_VARJO,
+    XR_TYPE_FOVEATED_VIEW_CONFIGURATION_VIEW_VARJO,
+    XR_TYPE_SYSTEM_FOVEATED_RENDERING_PROPERTIES_VARJO,
+    XR_TYPE_SYSTEM_FOVEATED_RENDERING_PROPERTIES_VARJO,
+    XR_TYPE_VIEW_LOCATE_FOVEATED_RENDERING_VARJO,
+    XR_TYPE_VIEW_LOCATE_FOVEATED_RENDERING_VARJO,
+#endif // XRTRANSPORT_EXT_XR_VARJO_foveated_rendering
+#ifdef XRTRANSPORT_EXT_XR_VARJO_marker_tracking
+    XR_TYPE_EVENT_DATA_MARKER_TRACKING_UPDATE_VARJO,
+    XR_TYPE_EVENT_DATA_MARKER_TRACKING_UPDATE_VARJO,
+    XR_TYPE_MARKER_SPACE_CREATE_INFO_VARJO,
+    XR_TYPE_MARKER_SPACE_CREATE_INFO_VARJO,
+    XR_TYPE_SYSTEM_MARKER_TRACKING_PROPERTIES_VARJO,
+    XR_TYPE_SYSTEM_MARKER_TRACKING_PROPERTIES_VARJO,
+#endif // XRTRANSPORT_EXT_XR_VARJO_marker_tracking
+    XR_TYPE_ACTION_CREATE_INFO,
+    XR_TYPE_ACTION_SET_CREATE_INFO,
+    XR_TYPE_ACTION_SPACE_CREATE_INFO,
+    XR_TYPE_ACTION_STATE_BOOLEAN,
+    XR_TYPE_ACTION_STATE_FLOAT,
+    XR_TYPE_ACTION_STATE_GET_INFO,
+    XR_TYPE_ACTION_STATE_POSE,
+    XR_TYPE_ACTION_STATE_VECTOR2F,
+    XR_TYPE_ACTIONS_SYNC_INFO,
+    XR_TYPE_API_LAYER_PROPERTIES,
+    XR_TYPE_BOUND_SOURCES_FOR_ACTION_ENUMERATE_INFO,
+    XR_TYPE_COMPOSITION_LAYER_PROJECTION,
+    XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW,
+    XR_TYPE_COMPOSITION_LAYER_QUAD,
+    XR_TYPE_EVENT_DATA_BUFFER,
+    XR_TYPE_EVENT_DATA_EVENTS_LOST,
+    XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING,
+    XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED,
+    XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING,
+    XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED,
+    XR_TYPE_EXTENSION_PROPERTIES,
+    XR_TYPE_FRAME_BEGIN_INFO,
+    XR_TYPE_FRAME_END_INFO,
+    XR_TYPE_FRAME_STATE,
+    XR_TYPE_FRAME_WAIT_INFO,
+    XR_TYPE_HAPTIC_ACTION_INFO,
+    XR_TYPE_HAPTIC_VIBRATION,
+    XR_TYPE_INPUT_SOURCE_LOCALIZED_NAME_GET_INFO,
+    XR_TYPE_INSTANCE_CREATE_INFO,
+    XR_TYPE_INSTANCE_PROPERTIES,
+    XR_TYPE_INTERACTION_PROFILE_STATE,
+    XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING,
+    XR_TYPE_REFERENCE_SPACE_CREATE_INFO,
+    XR_TYPE_SESSION_ACTION_SETS_ATTACH_INFO,
+    XR_TYPE_SESSION_BEGIN_INFO,
+    XR_TYPE_SESSION_CREATE_INFO,
+    XR_TYPE_SPACE_LOCATION,
+    XR_TYPE_SPACE_LOCATIONS,
+    XR_TYPE_SPACE_VELOCITIES,
+    XR_TYPE_SPACE_VELOCITY,
+    XR_TYPE_SPACES_LOCATE_INFO,
+    XR_TYPE_SWAPCHAIN_CREATE_INFO,
+    XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO,
+    XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO,
+    XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO,
+    XR_TYPE_SYSTEM_GET_INFO,
+    XR_TYPE_SYSTEM_PROPERTIES,
+    XR_TYPE_VIEW,
+    XR_TYPE_VIEW_CONFIGURATION_PROPERTIES,
+    XR_TYPE_VIEW_CONFIGURATION_VIEW,
+    XR_TYPE_VIEW_LOCATE_INFO,
+    XR_TYPE_VIEW_STATE,
+
+};
+
+namespace struct_index_detail {
+
+// Core XrStructureType values are small and used directly as indices. Values from extensions
+// (and from extensions promoted into feature levels) are 1000000000 + (extnumber - 1) * 1000 + offset,
+// so they are split into an extension slot and an offset within that slot.
+constexpr std::int32_t extension_type_base = 1000000000;
+constexpr std::int32_t extension_type_stride = 1000;
+
+struct ExtensionRange {
+    std::uint32_t base;
+    std::uint32_t count;
+};
+
+constexpr bool is_extension_type(XrStructureType struct_type) {
+    return struct_type >= extension_type_base;
+}
+
+constexpr std::size_t extension_slot(XrStructureType struct_type) {
+    return static_cast<std::size_t>((struct_type - extension_type_base) / extension_type_stride);
+}
+
+constexpr std::size_t extension_offset(XrStructureType struct_type) {
+    return static_cast<std::size_t>((struct_type - extension_type_base) % extension_type_stride);
+}
+
+constexpr std::size_t compute_core_count() {
+    std::size_t count = 0;
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (!is_extension_type(struct_type)) {
+            count = std::max(count, static_cast<std::size_t>(struct_type) + 1);
+        }
+    }
+    return count;
+}
+
+constexpr std::size_t compute_extension_slot_count() {
+    std::size_t count = 0;
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (is_extension_type(struct_type)) {
+            count = std::max(count, extension_slot(struct_type) + 1);
+        }
+    }
+    return count;
+}
+
+constexpr std::size_t core_count = compute_core_count();
+constexpr std::size_t extension_slot_count = compute_extension_slot_count();
+
+constexpr std::array<ExtensionRange, extension_slot_count> compute_extension_ranges() {
+    std::array<ExtensionRange, extension_slot_count> ranges{};
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (is_extension_type(struct_type)) {
+            ExtensionRange& range = ranges[extension_slot(struct_type)];
+            range.count = std::max(range.count, static_cast<std::uint32_t>(extension_offset(struct_type) + 1));
+        }
+    }
+    // extension slots are packed one after the other, after the core types
+    std::uint32_t next_base = static_cast<std::uint32_t>(core_count);
+    for (std::size_t i = 0; i < extension_slot_count; i++) {
+        ranges[i].base = next_base;
+        next_base += ranges[i].count;
+    }
+    return ranges;
+}
+
+constexpr std::array<ExtensionRange, extension_slot_count> extension_ranges = compute_extension_ranges();
+
+constexpr std::size_t compute_table_size() {
+    std::size_t size = core_count;
+    for (const ExtensionRange& range : extension_ranges) {
+        size += range.count;
+    }
+    return size;
+}
+
+} // namespace struct_index_detail
+
+// Number of slots in a dense struct table. Slot struct_table_size itself is reserved for unknown
+// types and is always empty, which is why the tables have one extra element.
+inline constexpr std::size_t struct_table_size = struct_index_detail::compute_table_size();
+
+// Maps an XrStructureType to its slot in a dense struct table, or struct_table_size if the
+// serializer was not built for it.
+constexpr std::size_t struct_type_index(XrStructureType struct_type) {
+    using namespace struct_index_detail;
+    if (struct_type < 0) {
+        return struct_table_size;
+    }
+    if (!is_extension_type(struct_type)) {
+        std::size_t index = static_cast<std::size_t>(struct_type);
+        return index < core_count ? index : struct_table_size;
+    }
+    std::size_t slot = extension_slot(struct_type);
+    if (slot >= extension_slot_count) {
+        return struct_table_size;
+    }
+    const ExtensionRange& range = extension_ranges[slot];
+    std::size_t offset = extension_offset(struct_type);
+    return offset < range.count ? range.base + offset : struct_table_size;
+}
+
+template <typename T>
+struct StructTableEntry {
+    XrStructureType type;
+    T value;
+};
+
+// Builds a dense table at compile time. Slots without an entry are value-initialized, so lookups
+// of unknown types yield 0 or nullptr.
+template <typename T, std::size_t N>
+constexpr std::array<T, struct_table_size + 1> make_struct_table(const StructTableEntry<T> (&entries)[N]) {
+    std::array<T, struct_table_size + 1> table{};
+    for (std::size_t i = 0; i < N; i++) {
+        table[struct_type_index(entries[i].type)] = entries[i].value;
+    }
+    return table;
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_STRUCT_INDEX_GENERATED_H
@@ -0,0 +1,254 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_TABLE_SERIALIZATION_H
+#define XRTRANSPORT_TABLE_SERIALIZATION_H
+
+#include "serializer.h"
+#include "deserializer.h"
+#include "quantization.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace xrtransport {
+
+/*
+ * Table-driven serialization (XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION)
+ *
+ * By default every struct gets its own generated serialize, deserialize and cleanup function, which is
+ * fast but adds up to most of the code size of the library. When the project is configured with
+ * -DXRTRANSPORT_TABLE_DRIVEN_SERIALIZATION=ON, the generator's per-struct functions are compiled out
+ * and the ones in struct_tables.cpp are used instead. Each of them passes a constant table of field
+ * descriptors to serialize_fields, deserialize_fields or cleanup_fields, which walk the table and
+ * produce exactly the same bytes as the generated code, so both ends of a connection can use different
+ * modes. Function params are still serialized by generated code in both modes.
+ *
+ * Use serialization_benchmarks to compare the speed of both modes, and the size of the built libraries
+ * to compare their code size.
+ */
+
+/**
+ * How a field is serialized, matching the cases of serialize_member in code_generation/templates/utils.mako
+ */
+enum class FieldKind : std::uint8_t {
+    VALUE,           // plain value or nested struct
+    TIME,            // XrTime, converted between the clocks of both ends
+    ARRAY,           // fixed size array
+    STRING_ARRAY,    // fixed size char array
+    STRING,          // null-terminated string
+    PTR,             // pointer to one element, or as many as the len member says
+    QUANTIZABLE_PTR, // like PTR, but may be sent quantized, see quantization.h
+    XR,              // next chain, or pointer to a header struct
+    XR_ARRAY,        // pointer to an array of XR structs with the type of its first element
+};
+
+/**
+ * How a single element is sent, matching the generic serialize and deserialize
+ */
+enum class ValueKind : std::uint8_t {
+    RAW,         // always sent as its bytes
+    UINT32,      // counts, XrBool32 and flags, compact if ctx.handles is set
+    ENUM,
+    STRUCT_TYPE,
+    HANDLE,
+    STRUCT,      // serialized by its own serialize, deserialize and cleanup
+};
+
+// Type-erased functions of a struct type, for nested structs and arrays of them
+struct StructOps {
+    void (*serialize)(const void* s, SerializeContext& ctx);
+    void (*deserialize)(void* s, DeserializeContext& ctx);
+    void (*cleanup)(const void* s);
+};
+
+// Type-erased serialize_quantizable_ptr and deserialize_quantizable_ptr of an element type
+struct QuantizedOps {
+    void (*serialize)(const void* x, std::size_t len, std::uint64_t extension_bit, SerializeContext& ctx);
+    // member points to the pointer member itself
+    void (*deserialize)(void* member, DeserializeContext& ctx);
+    std::uint64_t extension_bit;
+};
+
+struct FieldDescriptor {
+    std::uint16_t offset;
+    // offset and size of the len member, len_size is 0 if the pointer points to a single element
+    std::uint16_t len_offset;
+    std::uint8_t len_size;
+    FieldKind kind;
+    ValueKind value;
+    std::uint8_t flags;
+    // size and alignment of one element, 0 for next chains
+    std::uint16_t size;
+    std::uint16_t alignment;
+    // number of elements of fixed size arrays, 1 otherwise
+    std::uint16_t count;
+    // set for STRUCT elements
+    const StructOps* ops;
+    // set for QUANTIZABLE_PTR fields
+    const QuantizedOps* quantized;
+};
+
+// FieldDescriptor::flags
+constexpr std::uint8_t FIELD_CONST = 1 << 0; // pointer to const elements
+constexpr std::uint8_t FIELD_FLAT = 1 << 1;  // elements are flat, see is_flat
+
+template <typename T>
+void serialize_untyped(const void* s, SerializeContext& ctx) {
+    serialize(static_cast<const T*>(s), ctx);
+}
+
+template <typename T>
+void deserialize_untyped(void* s, DeserializeContext& ctx) {
+    deserialize(static_cast<T*>(s), ctx);
+}
+
+template <typename T>
+void cleanup_untyped(const void* s) {
+    cleanup(static_cast<const T*>(s));
+}
+
+template <typename T>
+struct StructOpsFor {
+    static constexpr StructOps ops{&serialize_untyped<T>, &deserialize_untyped<T>, &cleanup_untyped<T>};
+};
+
+// T is the pointed to type, including const
+template <typename T>
+void serialize_quantizable_untyped(const void* x, std::size_t len, std::uint64_t extension_bit, SerializeContext& ctx) {
+    serialize_quantizable_ptr(static_cast<const std::remove_const_t<T>*>(x), len, extension_bit, ctx);
+}
+
+template <typename T>
+void deserialize_quantizable_untyped(void* member, DeserializeContext& ctx) {
+    deserialize_quantizable_ptr(static_cast<T**>(member), ctx);
+}
+
+template <typename T, std::uint64_t extension_bit>
+struct QuantizedOpsFor {
+    static constexpr QuantizedOps ops{&serialize_quantizable_untyped<T>, &deserialize_quantizable_untyped<T>, extension_bit};
+};
+
+template <typename T>
+constexpr ValueKind value_kind() {
+    if constexpr (std::is_class<T>::value) {
+        return ValueKind::STRUCT;
+    }
+    else if constexpr (std::is_same<T, XrStructureType>::value) {
+        return ValueKind::STRUCT_TYPE;
+    }
+    else if constexpr (std::is_enum<T>::value) {
+        static_assert(sizeof(T) == sizeof(std::int32_t), "OpenXR enums are 32-bit");
+        return ValueKind::ENUM;
+    }
+    else if constexpr (std::is_pointer<T>::value) {
+        return ValueKind::HANDLE;
+    }
+    else if constexpr (std::is_same<T, std::uint32_t>::value) {
+        return ValueKind::UINT32;
+    }
+    else {
+        return ValueKind::RAW;
+    }
+}
+
+// Fails to compile if a table doesn't fit into a FieldDescriptor
+constexpr std::uint16_t narrow_field(std::size_t value) {
+    if (value > UINT16_MAX) {
+        throw std::out_of_range("struct too large for table-driven serialization");
+    }
+    return static_cast<std::uint16_t>(value);
+}
+
+// T is the element type, P the declared type of the member holding it
+template <typename T, typename P>
+constexpr FieldDescriptor make_field(FieldKind kind, std::size_t offset, std::size_t count,
+    std::size_t len_offset = 0, std::size_t len_size = 0, const QuantizedOps* quantized = nullptr)
+{
+    using Element = std::remove_cv_t<T>;
+    FieldDescriptor field{};
+    field.offset = narrow_field(offset);
+    field.len_offset = narrow_field(len_offset);
+    field.len_size = static_cast<std::uint8_t>(len_size);
+    field.kind = kind;
+    field.count = narrow_field(count);
+    field.quantized = quantized;
+    if constexpr (std::is_pointer<P>::value && std::is_const<std::remove_pointer_t<P>>::value) {
+        field.flags |= FIELD_CONST;
+    }
+    if constexpr (!std::is_void<Element>::value) {
+        field.value = value_kind<Element>();
+        field.size = narrow_field(sizeof(Element));
+        field.alignment = narrow_field(alignof(Element));
+        if constexpr (is_flat(static_cast<const Element*>(nullptr))) {
+            field.flags |= FIELD_FLAT;
+        }
+        if constexpr (std::is_class<Element>::value) {
+            field.ops = &StructOpsFor<Element>::ops;
+        }
+    }
+    return field;
+}
+
+/*
+ * Field descriptors of member m of struct s, used by the generated tables in struct_tables.cpp
+ */
+#define FIELD_VALUE(s, m) \
+    make_field<decltype(s::m), decltype(s::m)>(FieldKind::VALUE, offsetof(s, m), 1)
+#define FIELD_TIME(s, m) \
+    make_field<decltype(s::m), decltype(s::m)>(FieldKind::TIME, offsetof(s, m), 1)
+#define FIELD_ARRAY(s, m) \
+    make_field<std::remove_all_extents_t<decltype(s::m)>, decltype(s::m)>(FieldKind::ARRAY, offsetof(s, m), \
+        sizeof(s::m) / sizeof(std::remove_all_extents_t<decltype(s::m)>))
+#define FIELD_STRING_ARRAY(s, m) \
+    make_field<char, decltype(s::m)>(FieldKind::STRING_ARRAY, offsetof(s, m), sizeof(s::m))
+#define FIELD_STRING(s, m) \
+    make_field<char, decltype(s::m)>(FieldKind::STRING, offsetof(s, m), 1)
+#define FIELD_SINGLE_PTR(s, m) \
+    make_field<std::remove_pointer_t<decltype(s::m)>, decltype(s::m)>(FieldKind::PTR, offsetof(s, m), 1)
+#define FIELD_PTR(s, m, len) \
+    make_field<std::remove_pointer_t<decltype(s::m)>, decltype(s::m)>(FieldKind::PTR, offsetof(s, m), 1, \
+        offsetof(s, len), sizeof(s::len))
+#define FIELD_QUANTIZABLE_PTR(s, m, len, extension_bit) \
+    make_field<std::remove_pointer_t<decltype(s::m)>, decltype(s::m)>(FieldKind::QUANTIZABLE_PTR, offsetof(s, m), 1, \
+        offsetof(s, len), sizeof(s::len), &QuantizedOpsFor<std::remove_pointer_t<decltype(s::m)>, extension_bit>::ops)
+#define FIELD_XR(s, m) \
+    make_field<void, decltype(s::m)>(FieldKind::XR, offsetof(s, m), 1)
+#define FIELD_XR_ARRAY(s, m, len) \
+    make_field<void, decltype(s::m)>(FieldKind::XR_ARRAY, offsetof(s, m), 1, offsetof(s, len), sizeof(s::len))
+
+/**
+ * Serializes the fields of struct s in table order, the same way as its generated serialize would.
+ */
+void serialize_fields(const void* s, const FieldDescriptor* fields, std::size_t field_count, SerializeContext& ctx);
+
+/**
+ * Deserializes the fields of struct s, following ctx.in_place and borrowing const flat arrays like
+ * the generated deserialize.
+ */
+void deserialize_fields(void* s, const FieldDescriptor* fields, std::size_t field_count, DeserializeContext& ctx);
+
+/**
+ * Frees what deserialize_fields allocated.
+ */
+void cleanup_fields(const void* s, const FieldDescriptor* fields, std::size_t field_count);
+
+template <std::size_t N>
+void serialize_fields(const void* s, const FieldDescriptor (&fields)[N], SerializeContext& ctx) {
+    serialize_fields(s, fields, N, ctx);
+}
+
+template <std::size_t N>
+void deserialize_fields(void* s, const FieldDescriptor (&fields)[N], DeserializeContext& ctx) {
+    deserialize_fields(s, fields, N, ctx);
+}
+
+template <std::size_t N>
+void cleanup_fields(const void* s, const FieldDescriptor (&fields)[N]) {
+    cleanup_fields(s, fields, N);
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_TABLE_SERIALIZATION_H
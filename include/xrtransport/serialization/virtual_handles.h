@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_VIRTUAL_HANDLES_H
+#define XRTRANSPORT_VIRTUAL_HANDLES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Virtual handles (XRTP_FEATURE_PIPELINED_CREATION)
+ *
+ * Applications create most of their action sets, actions and spaces at startup, one round trip each.
+ * When this feature is negotiated, the functions in code_generation/pipelined_calls.py are sent as
+ * XRTP_MSG_PIPELINED_FUNCTION_CALL instead, and return a handle that the client allocated itself
+ * without waiting for the server. The server handles pipelined calls in the order they were sent and
+ * binds the handle each one created to the next index of a dense table, so both sides agree on the
+ * indices without sending them.
+ *
+ * A virtual handle is VIRTUAL_HANDLE_TAG | index. The server resolves the handles it receives as they
+ * are added to its request HandleTable, which is why the feature requires compact encoding, in the
+ * handlers of packed calls, and through DeserializeContext::virtual_handles in batched calls, which
+ * are sent without compact encoding. Runtimes are assumed to never return handles with the tag in
+ * their top 16 bits, which as pointers would be non-canonical addresses.
+ *
+ * A pipelined call that fails binds XR_NULL_HANDLE to its index, and the server sends an
+ * XRTP_MSG_DEFERRED_ERROR, which the client reports on its next synchronous call (see
+ * src/client/deferred_errors.h).
+ *
+ * Like compact encoding, the feature is only supported on 64-bit platforms.
+ */
+
+constexpr std::uint64_t VIRTUAL_HANDLE_TAG = 0x5854ull << 48; // "XT"
+constexpr std::uint64_t VIRTUAL_HANDLE_TAG_MASK = 0xFFFFull << 48;
+
+inline bool is_virtual_handle(std::uint64_t handle) {
+    return (handle & VIRTUAL_HANDLE_TAG_MASK) == VIRTUAL_HANDLE_TAG;
+}
+
+/**
+ * The value of a handle, which is a pointer on 64-bit platforms and an integer on 32-bit platforms
+ */
+template <typename T>
+std::uint64_t handle_value(T handle) {
+    static_assert(sizeof(T) <= sizeof(std::uint64_t), "handles are at most 64 bits");
+    std::uint64_t value{};
+    std::memcpy(&value, &handle, sizeof(T));
+    return value;
+}
+
+template <typename T>
+T handle_from_value(std::uint64_t value) {
+    static_assert(sizeof(T) <= sizeof(std::uint64_t), "handles are at most 64 bits");
+    T handle{};
+    std::memcpy(&handle, &value, sizeof(T));
+    return handle;
+}
+
+/**
+ * Client side: hands out virtual handles in the order the pipelined calls are sent. Must be used while
+ * holding the message lock of the call, so that the order matches.
+ */
+class VirtualHandleAllocator {
+private:
+    std::uint64_t next = 0;
+
+public:
+    std::uint64_t allocate();
+
+    std::size_t size() const {
+        return static_cast<std::size_t>(next);
+    }
+};
+
+/**
+ * Server side: the real handle bound to each virtual handle, indexed by the order of the pipelined calls.
+ */
+class VirtualHandleMap {
+private:
+    std::vector<std::uint64_t> handles;
+
+public:
+    /**
+     * Binds the handle created by the next pipelined call, XR_NULL_HANDLE if it failed.
+     */
+    void bind(std::uint64_t real_handle);
+
+    /**
+     * @return The real handle of a virtual handle, and any other handle unchanged
+     * @throws VirtualHandleException if the virtual handle was never bound
+     */
+    std::uint64_t resolve(std::uint64_t handle) const;
+
+    template <typename T>
+    T resolve(T handle) const {
+        return handle_from_value<T>(resolve(handle_value(handle)));
+    }
+
+    std::size_t size() const {
+        return handles.size();
+    }
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_VIRTUAL_HANDLES_H
@@ -16,8 +16,34 @@
 #error platform not supported
 #endif
 
+#include <cstddef>
+#include <cstdio>
+
 namespace xrtransport {
 
+// length of a boot id, a UUID without the terminating newline
+constexpr std::size_t BOOT_ID_SIZE = 36;
+
+/**
+ * Reads the random id the kernel generates on every boot. Processes with the same boot id run on the
+ * same kernel, e.g. in a container, though their monotonic clocks may still differ by a time namespace.
+ * @return false if there is no boot id on this platform or it couldn't be read
+ */
+inline bool get_boot_id(char (&boot_id)[BOOT_ID_SIZE]) {
+#ifdef __linux__
+    std::FILE* file = std::fopen("/proc/sys/kernel/random/boot_id", "r");
+    if (!file) {
+        return false;
+    }
+    std::size_t size = std::fread(boot_id, 1, BOOT_ID_SIZE, file);
+    std::fclose(file);
+    return size == BOOT_ID_SIZE;
+#else
+    (void)boot_id;
+    return false;
+#endif
+}
+
 inline void get_platform_time(XRTRANSPORT_PLATFORM_TIME* platform_time) {
 #ifdef _WIN32
     QueryPerformanceCounter(platform_time);
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_CONNECTION_OPTIONS_H
+#define XRTRANSPORT_CONNECTION_OPTIONS_H
+
+#include "transport_c_api.h"
+
+#include <cstdint>
+
+namespace xrtransport {
+
+/**
+ * Optional protocol behavior negotiated during the handshake. The client fills it with what it would
+ * like to use, and both sides end up with what the server accepted.
+ */
+struct ConnectionOptions {
+    xrtp_Features features = 0;
+
+    // QUANTIZED_* bits (see serializer.h) of the extensions whose arrays the server sends quantized.
+    // Only exchanged if XRTP_FEATURE_QUANTIZATION was accepted.
+    std::uint64_t quantized_extensions = 0;
+
+    /**
+     * Check whether an optional protocol feature was accepted by the server during the handshake.
+     */
+    bool has_feature(xrtp_Features feature) const {
+        return (features & feature) == feature;
+    }
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_CONNECTION_OPTIONS_H
@@ -67,6 +67,13 @@ public:
         return size_read;
     }
 
+    // Borrowed bytes are valid until the parent MessageLockIn is released
+    const void* borrow(std::size_t size, std::size_t alignment) override {
+        const void* data{};
+        CHK_XRTP(xrtp_msg_in_borrow(wrapped, size, alignment, &data));
+        return data;
+    }
+
     void close() override { throw InvalidOperationException(); }
     void close(asio::error_code& ec) override { throw InvalidOperationException(); }
 
@@ -84,6 +91,13 @@ public:
         : wrapped(wrapped), buffer(wrapped)
     {}
 
+    // get_time() when the message arrived, before it waited behind other messages
+    std::int64_t get_receive_time() const {
+        std::int64_t receive_time{};
+        CHK_XRTP(xrtp_msg_in_get_receive_time(wrapped, &receive_time));
+        return receive_time;
+    }
+
     // delete copy constructors
     MessageLockIn(const MessageLockIn&) = delete;
     MessageLockIn& operator=(const MessageLockIn&) = delete;
@@ -243,6 +257,61 @@ public:
     }
 };
 
+struct [[nodiscard]] CallBatch {
+private:
+    xrtp_CallBatch wrapped;
+
+public:
+    explicit CallBatch(xrtp_CallBatch wrapped)
+        : wrapped(wrapped)
+    {}
+
+    // delete copy constructors
+    CallBatch(const CallBatch&) = delete;
+    CallBatch& operator=(const CallBatch&) = delete;
+
+    // move constructors
+    CallBatch(CallBatch&& other)
+        : wrapped(other.wrapped)
+    {
+        other.wrapped = nullptr;
+    };
+
+    CallBatch& operator=(CallBatch&& other) {
+        if (this != &other) {
+            if (wrapped) {
+                CHK_XRTP(xrtp_batch_release(wrapped));
+            }
+            wrapped = other.wrapped;
+            other.wrapped = nullptr;
+        }
+
+        return *this;
+    };
+
+    void append_call(std::uint32_t function_id, const void* params, std::size_t size) {
+        CHK_XRTP(xrtp_batch_append_call(wrapped, function_id, params, size));
+    }
+
+    void submit() {
+        CHK_XRTP(xrtp_batch_submit(wrapped));
+    }
+
+    // valid until the batch is destructed
+    asio::const_buffer get_result(std::uint32_t index) const {
+        const void* data{};
+        std::uint64_t size{};
+        CHK_XRTP(xrtp_batch_get_result(wrapped, index, &data, &size));
+        return asio::const_buffer(data, static_cast<std::size_t>(size));
+    }
+
+    ~CallBatch() {
+        if (wrapped) {
+            CHK_XRTP(xrtp_batch_release(wrapped));
+        }
+    }
+};
+
 class Transport {
 private:
     bool owns_transport;
@@ -289,6 +358,12 @@ public:
         return MessageLock(raw_lock);
     }
 
+    CallBatch begin_batch() {
+        xrtp_CallBatch raw_batch{};
+        CHK_XRTP(xrtp_batch_begin(wrapped, &raw_batch));
+        return CallBatch(raw_batch);
+    }
+
     void register_handler(xrtp_MessageHeader header, std::function<void(MessageLockIn)> handler) {
         // This is a bit of a mess because we need to make sure that the raw handler, which cannot
         // use lambda captures because it is a function pointer, can call this std::function so we'll
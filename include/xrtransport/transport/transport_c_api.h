@@ -17,11 +17,13 @@ typedef struct xrtp_Transport_T xrtp_Transport_T;
 typedef struct xrtp_MessageLockOut_T xrtp_MessageLockOut_T;
 typedef struct xrtp_MessageLockIn_T xrtp_MessageLockIn_T;
 typedef struct xrtp_MessageLock_T xrtp_MessageLock_T;
+typedef struct xrtp_CallBatch_T xrtp_CallBatch_T;
 
 typedef xrtp_Transport_T* xrtp_Transport;
 typedef xrtp_MessageLockOut_T* xrtp_MessageLockOut;
 typedef xrtp_MessageLockIn_T* xrtp_MessageLockIn;
 typedef xrtp_MessageLock_T* xrtp_MessageLock;
+typedef xrtp_CallBatch_T* xrtp_CallBatch;
 
 // message headers
 typedef uint16_t xrtp_MessageHeader;
@@ -31,6 +33,14 @@ typedef uint16_t xrtp_MessageHeader;
 #define XRTP_MSG_SYNCHRONIZATION_RESPONSE 4
 #define XRTP_MSG_POLL_EVENT 5
 #define XRTP_MSG_POLL_EVENT_RETURN 6
+#define XRTP_MSG_PACKED_FUNCTION_CALL 7
+#define XRTP_MSG_PIPELINED_FUNCTION_CALL 8
+#define XRTP_MSG_DEFERRED_ERROR 9
+#define XRTP_MSG_FUNCTION_CALL_BATCH 10
+#define XRTP_MSG_FUNCTION_RETURN_BATCH 11
+#define XRTP_MSG_ONEWAY_FUNCTION_CALL 12
+#define XRTP_MSG_SPECULATIVE_WAIT_FRAME 13
+#define XRTP_MSG_FRAME_STATE 14
 #define XRTP_MSG_SHUTDOWN 99
 #define XRTP_MSG_CUSTOM_BASE 100
 
@@ -53,9 +63,50 @@ typedef enum xrtp_TransportStatus {
 } xrtp_TransportStatus;
 
 // protocol values
-#define XRTRANSPORT_PROTOCOL_VERSION 1
+#define XRTRANSPORT_PROTOCOL_VERSION 13
 #define XRTRANSPORT_MAGIC 0x50545258 // "XRTP" as a little-endian uint32_t
 
+// optional protocol features, requested by the client and accepted by the server during the handshake
+typedef uint32_t xrtp_Features;
+#define XRTP_FEATURE_DELTA_ENCODING (1u << 0)
+#define XRTP_FEATURE_QUANTIZATION (1u << 1)
+#define XRTP_FEATURE_STRING_INTERNING (1u << 2)
+#define XRTP_FEATURE_COMPACT_ENCODING (1u << 3)
+// requires XRTP_FEATURE_COMPACT_ENCODING
+#define XRTP_FEATURE_PIPELINED_CREATION (1u << 4)
+#define XRTP_FEATURE_ONEWAY_CALLS (1u << 5)
+#define XRTP_FEATURE_FRAME_LOOP_FUSION (1u << 6)
+// requires XRTP_FEATURE_FRAME_LOOP_FUSION
+#define XRTP_FEATURE_VIEW_PREFETCH (1u << 7)
+// requires XRTP_FEATURE_FRAME_LOOP_FUSION
+#define XRTP_FEATURE_SPACE_PREFETCH (1u << 8)
+// requires XRTP_FEATURE_FRAME_LOOP_FUSION
+#define XRTP_FEATURE_TRACKER_SAMPLING (1u << 9)
+#define XRTP_FEATURE_INBAND_TIMESTAMPS (1u << 10)
+// only stays enabled if the handshake finds that client and server read the same monotonic clock
+#define XRTP_FEATURE_SHARED_CLOCK (1u << 11)
+
+// handles are only distinct pointer types on 64-bit platforms, which compact encoding relies on
+#if UINTPTR_MAX == UINT64_MAX
+#define XRTP_SUPPORTED_PLATFORM_FEATURES (XRTP_FEATURE_COMPACT_ENCODING | XRTP_FEATURE_PIPELINED_CREATION)
+#else
+#define XRTP_SUPPORTED_PLATFORM_FEATURES 0u
+#endif
+
+// features this build of the server is able to accept
+#define XRTP_SUPPORTED_FEATURES ( \
+    XRTP_FEATURE_DELTA_ENCODING | \
+    XRTP_FEATURE_QUANTIZATION | \
+    XRTP_FEATURE_STRING_INTERNING | \
+    XRTP_FEATURE_ONEWAY_CALLS | \
+    XRTP_FEATURE_FRAME_LOOP_FUSION | \
+    XRTP_FEATURE_VIEW_PREFETCH | \
+    XRTP_FEATURE_SPACE_PREFETCH | \
+    XRTP_FEATURE_TRACKER_SAMPLING | \
+    XRTP_FEATURE_INBAND_TIMESTAMPS | \
+    XRTP_FEATURE_SHARED_CLOCK | \
+    XRTP_SUPPORTED_PLATFORM_FEATURES)
+
 typedef int32_t xrtp_Result;
 
 /**
@@ -188,6 +239,25 @@ XRTP_API xrtp_Result xrtp_msg_in_read_some(
     uint64_t size,
     uint64_t* size_read);
 
+/**
+ * Consumes the next size bytes of the MessageLockIn's buffered data without copying them. Sets data to
+ * nullptr and consumes nothing if fewer bytes are left or they are not aligned to alignment. The bytes
+ * are valid until the MessageLockIn is released.
+ */
+XRTP_API xrtp_Result xrtp_msg_in_borrow(
+    xrtp_MessageLockIn msg_in,
+    uint64_t size,
+    uint64_t alignment,
+    const void** data);
+
+/**
+ * Gets the time, as read with xrtransport::get_time(), when the header of the message was read from the
+ * stream. Unlike the time it is handled at, this doesn't include the time it waited behind other messages.
+ */
+XRTP_API xrtp_Result xrtp_msg_in_get_receive_time(
+    xrtp_MessageLockIn msg_in,
+    int64_t* receive_time);
+
 /**
  * Releases the message lock and destructs the MessageLockIn
  */
@@ -222,6 +292,52 @@ XRTP_API xrtp_Result xrtp_msg_out_release(
 XRTP_API xrtp_Result xrtp_msg_lock_release(
     xrtp_MessageLock lock);
 
+/**
+ * Starts collecting function calls that are sent together as one
+ * XRTP_MSG_FUNCTION_CALL_BATCH, and answered with one XRTP_MSG_FUNCTION_RETURN_BATCH.
+ * Doesn't acquire the message lock.
+ *
+ * batch_out *must* be released.
+ */
+XRTP_API xrtp_Result xrtp_batch_begin(
+    xrtp_Transport transport,
+    xrtp_CallBatch* batch_out);
+
+/**
+ * Appends a call to the function with the given id (see function_ids.json).
+ * params holds the serialized params, as described for XRTP_MSG_FUNCTION_CALL_BATCH
+ * in protocol.txt, and is copied.
+ */
+XRTP_API xrtp_Result xrtp_batch_append_call(
+    xrtp_CallBatch batch,
+    uint32_t function_id,
+    const void* params,
+    uint64_t size);
+
+/**
+ * Sends the calls and waits for their results, holding the message lock
+ * in between. A batch can only be submitted once.
+ */
+XRTP_API xrtp_Result xrtp_batch_submit(
+    xrtp_CallBatch batch);
+
+/**
+ * Returns the serialized result of the call at index in a submitted batch, as
+ * described for XRTP_MSG_FUNCTION_RETURN_BATCH in protocol.txt. The bytes are
+ * valid until the batch is released.
+ */
+XRTP_API xrtp_Result xrtp_batch_get_result(
+    xrtp_CallBatch batch,
+    uint32_t index,
+    const void** data,
+    uint64_t* size);
+
+/**
+ * Destructs the batch, including the results returned by xrtp_batch_get_result
+ */
+XRTP_API xrtp_Result xrtp_batch_release(
+    xrtp_CallBatch batch);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
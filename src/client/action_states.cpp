@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "action_states.h"
+
+#include "xrtransport/serialization/deserializer.h"
+
+#include <algorithm>
+
+namespace xrtransport {
+
+void ActionStates::sync_actions(std::uint64_t session, const SampledCall& call, QueryBuffer& response) {
+    // held across the round trip, so that no query is answered from the snapshot that is replaced
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<SampledCall> synced = std::move(queries[session]);
+    queries.erase(session);
+    snapshots.erase(session);
+
+    // batched calls are run in order, so the queries see the states of this sync
+    CallBatch batch = transport.begin_batch();
+    batch.append_call(call.function_id, call.bytes.data(), call.bytes.size());
+    for (const SampledCall& query : synced) {
+        batch.append_call(query.function_id, query.bytes.data(), query.bytes.size());
+    }
+    batch.submit();
+
+    asio::const_buffer sync_result = batch.get_result(0);
+    const std::uint8_t* sync_data = static_cast<const std::uint8_t*>(sync_result.data());
+    response.bytes.assign(sync_data, sync_data + sync_result.size());
+    response.read_head = 0;
+
+    XrResult result{};
+    DeserializeContext result_ctx(response);
+    deserialize(&result, result_ctx);
+    response.read_head = 0;
+    if (XR_FAILED(result)) {
+        // the queries are sent with the next sync again
+        queries[session] = std::move(synced);
+        return;
+    }
+
+    std::vector<Snapshot>& snapshot = snapshots[session];
+    snapshot.reserve(synced.size());
+    for (std::uint32_t i = 0; i < synced.size(); i++) {
+        asio::const_buffer query_result = batch.get_result(i + 1);
+        const std::uint8_t* query_data = static_cast<const std::uint8_t*>(query_result.data());
+        snapshot.push_back(Snapshot{std::move(synced[i]), {query_data, query_data + query_result.size()}});
+    }
+}
+
+bool ActionStates::take_snapshot(std::uint64_t session, SampledCall query, QueryBuffer& snapshot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    bool found = false;
+    auto snapshot_it = snapshots.find(session);
+    if (snapshot_it != snapshots.end()) {
+        for (const Snapshot& taken : snapshot_it->second) {
+            if (taken.call.matches(query)) {
+                snapshot.bytes = taken.response;
+                found = true;
+                break;
+            }
+        }
+    }
+
+    // queries made since the last sync are made again with the next one
+    auto& session_queries = queries[session];
+    auto it = std::find_if(session_queries.begin(), session_queries.end(), [&query](const SampledCall& other){ return other.matches(query); });
+    if (it != session_queries.end()) {
+        *it = std::move(query);
+    }
+    else if (session_queries.size() < MAX_QUERIES) {
+        session_queries.push_back(std::move(query));
+    }
+
+    return found;
+}
+
+void ActionStates::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    queries.clear();
+    snapshots.clear();
+}
+
+} // namespace xrtransport
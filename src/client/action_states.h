@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_CLIENT_ACTION_STATES_H
+#define XRTRANSPORT_CLIENT_ACTION_STATES_H
+
+#include "query_cache.h"
+
+#include "xrtransport/transport/transport.h"
+
+#include "openxr/openxr.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Client side snapshot of action states
+ *
+ * Applications call xrSyncActions once per frame, and then query the state of every action they use
+ * with the xrGetActionState* functions, which would be a round trip for each of them. The states only
+ * change in xrSyncActions, so the queries made since the last sync of a session are sent in the same
+ * call batch as its next xrSyncActions, right after it. The server runs them in order and returns all
+ * of their responses in the one reply, and queries that match one of them are answered from its
+ * response until the next sync. Queries that weren't made during a sync interval aren't sent with the
+ * next sync, up to MAX_QUERIES of them are.
+ *
+ * The queries are opaque here, so the snapshots of all sessions are dropped when an action, action set,
+ * session or the instance is destroyed, and the snapshot of a session is dropped when its sync fails.
+ * Queries that fail are made again, so that the error is for the query. The snapshot can be turned off
+ * with the action_state_snapshot config option.
+ */
+class ActionStates {
+public:
+    static constexpr std::size_t MAX_QUERIES = 64;
+
+private:
+    struct Snapshot {
+        SampledCall call;
+        std::vector<std::uint8_t> response;
+    };
+
+    Transport& transport;
+
+    std::mutex mutex;
+    std::unordered_map<std::uint64_t, std::vector<SampledCall>> queries; // since the last sync
+    std::unordered_map<std::uint64_t, std::vector<Snapshot>> snapshots; // taken with the last sync
+
+public:
+    explicit ActionStates(Transport& transport) : transport(transport) {}
+
+    /**
+     * Called by the generated stub of xrSyncActions.
+     * @param call The serialized xrSyncActions call, sent in one batch with the queries since the last sync
+     * @param response Set to the response to call
+     */
+    void sync_actions(std::uint64_t session, const SampledCall& call, QueryBuffer& response);
+
+    /**
+     * Called by the generated stubs of the xrGetActionState* functions.
+     * @param query Sent with the next sync of session
+     * @param snapshot Set to the response of the query if it was made with the last sync
+     * @return Whether snapshot was set
+     */
+    bool take_snapshot(std::uint64_t session, SampledCall query, QueryBuffer& snapshot);
+
+    /**
+     * Drops all snapshots and queries, when anything they may refer to is destroyed.
+     */
+    void clear();
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_CLIENT_ACTION_STATES_H
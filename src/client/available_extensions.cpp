@@ -41,7 +41,10 @@ static std::unordered_map<std::string, ExtensionInfo> collect_rpc_available_exte
         std::string extension_name(extension_properties.extensionName);
 
         // available extensions is the intersection of enabled (compiled) extensions and the extensions the server runtime reports
-        if (enabled_extensions.find(extension_name) == enabled_extensions.end()) continue;
+        if (enabled_extensions.find(extension_name) == enabled_extensions.end()) {
+            spdlog::debug("Not advertising {}, it is not in the extensions this runtime was built with", extension_name);
+            continue;
+        }
 
         uint32_t transport_version = enabled_extensions.at(extension_name);
         uint32_t server_version = extension_properties.extensionVersion;
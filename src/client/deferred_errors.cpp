@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "deferred_errors.h"
+
+#include <asio.hpp>
+#include <spdlog/spdlog.h>
+
+namespace xrtransport {
+
+void DeferredErrors::handle_message(MessageLockIn msg_in) {
+    std::uint32_t function_id{};
+    asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(std::uint32_t)));
+    XrResult result{};
+    asio::read(msg_in.buffer, asio::buffer(&result, sizeof(XrResult)));
+
+    spdlog::error("Call to function {} failed with {}, reporting it on the next call", function_id, (int)result);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!pending.load(std::memory_order_relaxed)) {
+        first_error = result;
+        pending.store(true, std::memory_order_release);
+    }
+}
+
+XrResult DeferredErrors::take(XrResult result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    XrResult error = first_error;
+    first_error = XR_SUCCESS;
+    pending.store(false, std::memory_order_relaxed);
+    return XR_SUCCEEDED(result) ? error : result;
+}
+
+} // namespace xrtransport
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_CLIENT_DEFERRED_ERRORS_H
+#define XRTRANSPORT_CLIENT_DEFERRED_ERRORS_H
+
+#include "xrtransport/transport/transport.h"
+
+#include "openxr/openxr.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace xrtransport {
+
+/*
+ * Errors of calls that returned before the server ran them
+ *
+ * Pipelined calls (see xrtransport/serialization/virtual_handles.h) and oneway calls (see
+ * code_generation/oneway_calls.py) return as soon as they are sent. If one of them fails, the server
+ * sends an XRTP_MSG_DEFERRED_ERROR, which arrives before the response to any later call. The next
+ * synchronous call reports the first such error by returning it in place of its own result, unless
+ * that call failed as well. Every deferred error is logged when it arrives.
+ */
+class DeferredErrors {
+private:
+    std::mutex mutex;
+    std::atomic<bool> pending{false};
+    XrResult first_error = XR_SUCCESS;
+
+    XrResult take(XrResult result);
+
+public:
+    /**
+     * Records the error in an XRTP_MSG_DEFERRED_ERROR.
+     */
+    void handle_message(MessageLockIn msg_in);
+
+    /**
+     * @return The result of a synchronous call, or the first deferred error since the last one if that succeeded
+     */
+    XrResult report(XrResult result) {
+        if (!pending.load(std::memory_order_acquire)) {
+            return result;
+        }
+        return take(result);
+    }
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_CLIENT_DEFERRED_ERRORS_H
@@ -59,6 +59,10 @@ static XRAPI_ATTR XrResult XRAPI_CALL xrCreateInstanceImpl(
     const XrInstanceCreateInfo*                 createInfo,
     XrInstance*                                 instance);
 
+static PFN_xrDestroyInstance pfn_xrDestroyInstance_next;
+static XRAPI_ATTR XrResult XRAPI_CALL xrDestroyInstanceImpl(
+    XrInstance                                  instance);
+
 // built-in extension functions
 #ifdef _WIN32
 static PFN_xrConvertWin32PerformanceCounterToTimeKHR pfn_xrConvertWin32PerformanceCounterToTimeKHR_next;
@@ -310,10 +314,19 @@ static XRAPI_ATTR XrResult XRAPI_CALL xrCreateInstanceImpl(const XrInstanceCreat
     return result;
 }
 
+static XRAPI_ATTR XrResult XRAPI_CALL xrDestroyInstanceImpl(XrInstance instance) {
+    // the server converts times with the instance, so synchronization has to stop first
+    if (instance == saved_instance) {
+        disable_synchronization();
+    }
+    return pfn_xrDestroyInstance_next(instance);
+}
+
 static void layer_built_in_functions(FunctionTable& function_table) {
     function_table.add_function_layer("xrGetInstanceProcAddr", xrGetInstanceProcAddrImpl, pfn_xrGetInstanceProcAddr_next);
     function_table.add_function_layer("xrEnumerateInstanceExtensionProperties", xrEnumerateInstanceExtensionPropertiesImpl, pfn_xrEnumerateInstanceExtensionProperties_next);
     function_table.add_function_layer("xrCreateInstance", xrCreateInstanceImpl, pfn_xrCreateInstance_next);
+    function_table.add_function_layer("xrDestroyInstance", xrDestroyInstanceImpl, pfn_xrDestroyInstance_next);
     function_table.add_function_layer("xrPollEvent", xrPollEventImpl, pfn_xrPollEvent_next);
 #ifdef _WIN32
     function_table.add_function_layer("xrConvertWin32PerformanceCounterToTimeKHR", xrConvertWin32PerformanceCounterToTimeKHRImpl, pfn_xrConvertWin32PerformanceCounterToTimeKHR_next);
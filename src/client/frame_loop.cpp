@@ -0,0 +1,486 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "frame_loop.h"
+
+#include "xrtransport/serialization/virtual_handles.h"
+
+#include <asio.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace xrtransport {
+
+void FrameLoop::handle_message(MessageLockIn msg_in) {
+    std::uint64_t session{};
+    asio::read(msg_in.buffer, asio::buffer(&session, sizeof(std::uint64_t)));
+    FrameState frame_state{};
+    asio::read(msg_in.buffer, asio::buffer(&frame_state.result, sizeof(XrResult)));
+    asio::read(msg_in.buffer, asio::buffer(&frame_state.predicted_display_time, sizeof(XrTime)));
+    asio::read(msg_in.buffer, asio::buffer(&frame_state.predicted_display_period, sizeof(XrDuration)));
+    asio::read(msg_in.buffer, asio::buffer(&frame_state.should_render, sizeof(XrBool32)));
+
+    if (view_prefetch) {
+        std::uint8_t has_views{};
+        asio::read(msg_in.buffer, asio::buffer(&has_views, sizeof(std::uint8_t)));
+        frame_state.has_views = has_views;
+        if (has_views) {
+            asio::read(msg_in.buffer, asio::buffer(&frame_state.view_state_flags, sizeof(XrViewStateFlags)));
+            std::uint32_t view_count{};
+            asio::read(msg_in.buffer, asio::buffer(&view_count, sizeof(std::uint32_t)));
+            frame_state.views.resize(view_count, {XR_TYPE_VIEW});
+            for (XrView& view : frame_state.views) {
+                asio::read(msg_in.buffer, asio::buffer(&view.pose, sizeof(XrPosef)));
+                asio::read(msg_in.buffer, asio::buffer(&view.fov, sizeof(XrFovf)));
+            }
+        }
+    }
+
+    if (space_prefetch) {
+        std::uint32_t location_count{};
+        asio::read(msg_in.buffer, asio::buffer(&location_count, sizeof(std::uint32_t)));
+        frame_state.space_locations.resize(location_count);
+        for (SpaceLocation& location : frame_state.space_locations) {
+            asio::read(msg_in.buffer, asio::buffer(&location.result, sizeof(XrResult)));
+            asio::read(msg_in.buffer, asio::buffer(&location.location_flags, sizeof(XrSpaceLocationFlags)));
+            asio::read(msg_in.buffer, asio::buffer(&location.pose, sizeof(XrPosef)));
+        }
+    }
+
+    if (tracker_sampling) {
+        std::uint32_t sample_count{};
+        asio::read(msg_in.buffer, asio::buffer(&sample_count, sizeof(std::uint32_t)));
+        frame_state.samples.resize(sample_count);
+        for (std::vector<std::uint8_t>& sample : frame_state.samples) {
+            std::uint32_t sample_size{};
+            asio::read(msg_in.buffer, asio::buffer(&sample_size, sizeof(std::uint32_t)));
+            sample.resize(sample_size);
+            asio::read(msg_in.buffer, asio::buffer(sample.data(), sample.size()));
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mailbox_mutex);
+        mailbox[session].push_back(std::move(frame_state));
+    }
+    mailbox_condition.notify_all();
+}
+
+bool FrameLoop::take_speculative_wait(std::uint64_t session, SpeculativeRequest& request) {
+    auto it = speculative_waits.find(session);
+    if (it == speculative_waits.end() || it->second.empty()) {
+        return false;
+    }
+    request = std::move(it->second.front());
+    it->second.pop_front();
+    return true;
+}
+
+FrameLoop::FrameState FrameLoop::receive_frame_state(std::uint64_t session) {
+    await_frame_states(session, 1);
+    std::lock_guard<std::mutex> lock(mailbox_mutex);
+    auto& frame_states = mailbox[session];
+    FrameState frame_state = std::move(frame_states.front());
+    frame_states.pop_front();
+    return frame_state;
+}
+
+void FrameLoop::await_frame_states(std::uint64_t session, std::size_t count) {
+    // frame states are handled by the consumer thread, or by whichever thread holds the message lock
+    // while they arrive, so other calls can use the transport in the meantime
+    std::unique_lock<std::mutex> lock(mailbox_mutex);
+    while (!mailbox_condition.wait_for(lock, FRAME_STATE_POLL_INTERVAL,
+        [&]{ return mailbox[session].size() >= count; }))
+    {
+        if (transport.get_status() == XRTP_STATUS_CLOSED) {
+            throw TransportException("transport closed while waiting for a frame state");
+        }
+    }
+}
+
+void FrameLoop::discard_speculative_waits(std::uint64_t session) {
+    // the server must be done waiting before the session ends
+    SpeculativeRequest request{};
+    while (take_speculative_wait(session, request)) {
+        receive_frame_state(session);
+    }
+    speculative_waits.erase(session);
+    std::lock_guard<std::mutex> lock(mailbox_mutex);
+    mailbox.erase(session);
+}
+
+void FrameLoop::forget_sampled_calls() {
+    if (!tracker_sampling) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    {
+        std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+        sampled_calls.clear();
+        sample_snapshots.clear();
+    }
+    // the server may still be making the calls, and the runtime may reuse the handle value
+    for (auto& [session, requests] : speculative_waits) {
+        bool sampled = false;
+        for (SpeculativeRequest& request : requests) {
+            if (!request.calls.empty()) {
+                request.calls.clear();
+                sampled = true;
+            }
+        }
+        if (sampled) {
+            await_frame_states(session, requests.size());
+        }
+    }
+}
+
+void FrameLoop::store_snapshots(std::uint64_t session, XrTime display_time, SpeculativeRequest& request, FrameState& frame_state) {
+    display_times[session] = display_time;
+
+    if (frame_state.has_views && request.views.space) {
+        view_snapshots[session] = ViewSnapshot{
+            display_time,
+            request.views,
+            frame_state.view_state_flags,
+            std::move(frame_state.views)
+        };
+    }
+    else {
+        view_snapshots.erase(session);
+    }
+
+    SpaceSnapshot& space_snapshot = space_snapshots[session];
+    space_snapshot.display_time = display_time;
+    space_snapshot.locations.clear();
+    std::size_t location_count = std::min(request.spaces.size(), frame_state.space_locations.size());
+    for (std::size_t i = 0; i < location_count; i++) {
+        if (request.spaces[i].space) {
+            space_snapshot.locations[request.spaces[i]] = frame_state.space_locations[i];
+        }
+    }
+
+    SampleSnapshot& sample_snapshot = sample_snapshots[session];
+    sample_snapshot.display_time = display_time;
+    sample_snapshot.samples.clear();
+    std::size_t sample_count = std::min(request.calls.size(), frame_state.samples.size());
+    for (std::size_t i = 0; i < sample_count; i++) {
+        if (!frame_state.samples[i].empty()) {
+            sample_snapshot.samples.push_back(Sample{std::move(request.calls[i]), std::move(frame_state.samples[i])});
+        }
+    }
+}
+
+void FrameLoop::forget_snapshots(std::uint64_t session) {
+    display_times.erase(session);
+    view_requests.erase(session);
+    located_spaces.erase(session);
+    sampled_calls.erase(session);
+    view_snapshots.erase(session);
+    space_snapshots.erase(session);
+    sample_snapshots.erase(session);
+}
+
+XrResult FrameLoop::wait_frame(XrSession session, const XrFrameWaitInfo* frame_wait_info, XrFrameState* frame_state, PFN_WaitFrame unfused) {
+    XrDuration time_offset = clock_sync.get_time_offset();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    std::uint64_t session_value = handle_value(session);
+    SpeculativeRequest request{};
+    if (!take_speculative_wait(session_value, request)) {
+        // end_frame sends no speculative waits until this one returns, so the mutex isn't needed meanwhile
+        unfused_waits[session_value]++;
+        lock.unlock();
+        XrResult result = unfused(session, frame_wait_info, frame_state);
+        lock.lock();
+        if (--unfused_waits[session_value] == 0) {
+            unfused_waits.erase(session_value);
+        }
+        lock.unlock();
+        if (prefetch() && XR_SUCCEEDED(result)) {
+            std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+            FrameState no_snapshots{};
+            store_snapshots(session_value, frame_state->predictedDisplayTime, request, no_snapshots);
+        }
+        return result;
+    }
+
+    FrameState speculative = receive_frame_state(session_value);
+    if (!frame_state) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+    if ((frame_wait_info && frame_wait_info->next) || frame_state->next) {
+        spdlog::warn("xrWaitFrame was called with a next chain, turning off frame loop fusion");
+        enabled.store(false, std::memory_order_relaxed);
+    }
+    if (XR_SUCCEEDED(speculative.result)) {
+        frame_state->predictedDisplayTime = speculative.predicted_display_time + time_offset;
+        frame_state->predictedDisplayPeriod = speculative.predicted_display_period;
+        frame_state->shouldRender = speculative.should_render;
+
+        if (prefetch()) {
+            std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+            store_snapshots(session_value, frame_state->predictedDisplayTime, request, speculative);
+        }
+    }
+    return deferred_errors.report(speculative.result);
+}
+
+XrResult FrameLoop::end_frame(XrSession session, const XrFrameEndInfo* frame_end_info, PFN_EndFrame unfused) {
+    XrResult result = unfused(session, frame_end_info);
+    if (XR_FAILED(result) || !enabled.load(std::memory_order_relaxed)) {
+        return result;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::uint64_t session_value = handle_value(session);
+    if (unfused_waits.count(session_value)) {
+        // the server is already waiting for the next frame
+        return result;
+    }
+    SpeculativeRequest request{{XR_VIEW_CONFIGURATION_TYPE_MAX_ENUM, 0}, {}, {}};
+    if (prefetch()) {
+        std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+        auto it = view_requests.find(session_value);
+        if (it != view_requests.end()) {
+            request.views = it->second;
+        }
+        // the spaces that weren't located during this frame drop out
+        auto located = located_spaces.find(session_value);
+        if (located != located_spaces.end()) {
+            request.spaces = std::move(located->second);
+            located_spaces.erase(located);
+        }
+        auto sampled = sampled_calls.find(session_value);
+        if (sampled != sampled_calls.end()) {
+            request.calls = std::move(sampled->second);
+            sampled_calls.erase(sampled);
+        }
+    }
+
+    auto msg_out = transport.start_message(XRTP_MSG_SPECULATIVE_WAIT_FRAME);
+    asio::write(msg_out.buffer, asio::buffer(&session_value, sizeof(std::uint64_t)));
+    if (view_prefetch) {
+        asio::write(msg_out.buffer, asio::buffer(&request.views.view_configuration_type, sizeof(XrViewConfigurationType)));
+        asio::write(msg_out.buffer, asio::buffer(&request.views.space, sizeof(std::uint64_t)));
+    }
+    if (space_prefetch) {
+        std::uint32_t pair_count = static_cast<std::uint32_t>(request.spaces.size());
+        asio::write(msg_out.buffer, asio::buffer(&pair_count, sizeof(std::uint32_t)));
+        for (const SpacePair& pair : request.spaces) {
+            asio::write(msg_out.buffer, asio::buffer(&pair.space, sizeof(std::uint64_t)));
+            asio::write(msg_out.buffer, asio::buffer(&pair.base_space, sizeof(std::uint64_t)));
+        }
+    }
+    if (tracker_sampling) {
+        std::uint32_t call_count = static_cast<std::uint32_t>(request.calls.size());
+        asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(std::uint32_t)));
+        for (const SampledCall& call : request.calls) {
+            std::uint32_t params_size = static_cast<std::uint32_t>(call.bytes.size());
+            asio::write(msg_out.buffer, asio::buffer(&call.function_id, sizeof(std::uint32_t)));
+            asio::write(msg_out.buffer, asio::buffer(&params_size, sizeof(std::uint32_t)));
+            asio::write(msg_out.buffer, asio::buffer(call.bytes.data(), call.bytes.size()));
+        }
+    }
+    msg_out.flush();
+    speculative_waits[session_value].push_back(std::move(request));
+
+    return result;
+}
+
+XrResult FrameLoop::end_session(XrSession session, PFN_EndSession unfused) {
+    {
+        // a frame state from before the session ended would be stale once it runs again
+        std::lock_guard<std::mutex> lock(mutex);
+        discard_speculative_waits(handle_value(session));
+        std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+        forget_snapshots(handle_value(session));
+    }
+    return unfused(session);
+}
+
+XrResult FrameLoop::destroy_session(XrSession session, PFN_DestroySession unfused) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        discard_speculative_waits(handle_value(session));
+        std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+        forget_snapshots(handle_value(session));
+    }
+    return unfused(session);
+}
+
+XrResult FrameLoop::locate_views(XrSession session, const XrViewLocateInfo* view_locate_info, XrViewState* view_state,
+    uint32_t view_capacity_input, uint32_t* view_count_output, XrView* views, PFN_LocateViews unfused)
+{
+    if (!view_prefetch || !view_locate_info || view_locate_info->next || !view_state || view_state->next || !view_count_output) {
+        return unfused(session, view_locate_info, view_state, view_capacity_input, view_count_output, views);
+    }
+
+    std::uint64_t session_value = handle_value(session);
+    ViewRequest request{view_locate_info->viewConfigurationType, handle_value(view_locate_info->space)};
+    std::unique_lock<std::mutex> snapshots_lock(snapshots_mutex);
+
+    // calls at the predicted display time are made again next frame
+    auto display_time = display_times.find(session_value);
+    if (display_time != display_times.end() && display_time->second == view_locate_info->displayTime) {
+        view_requests[session_value] = request;
+    }
+
+    auto it = view_snapshots.find(session_value);
+    if (it == view_snapshots.end() ||
+        it->second.display_time != view_locate_info->displayTime ||
+        it->second.request.view_configuration_type != request.view_configuration_type ||
+        it->second.request.space != request.space)
+    {
+        snapshots_lock.unlock();
+        return unfused(session, view_locate_info, view_state, view_capacity_input, view_count_output, views);
+    }
+
+    const ViewSnapshot& snapshot = it->second;
+    uint32_t view_count = static_cast<uint32_t>(snapshot.views.size());
+    if (view_capacity_input != 0) {
+        if (view_capacity_input < view_count) {
+            *view_count_output = view_count;
+            return XR_ERROR_SIZE_INSUFFICIENT;
+        }
+        for (uint32_t i = 0; i < view_count; i++) {
+            if (views[i].next) {
+                snapshots_lock.unlock();
+                return unfused(session, view_locate_info, view_state, view_capacity_input, view_count_output, views);
+            }
+        }
+        for (uint32_t i = 0; i < view_count; i++) {
+            views[i].pose = snapshot.views[i].pose;
+            views[i].fov = snapshot.views[i].fov;
+        }
+    }
+    *view_count_output = view_count;
+    view_state->viewStateFlags = snapshot.view_state_flags;
+    snapshots_lock.unlock();
+
+    return deferred_errors.report(XR_SUCCESS);
+}
+
+XrResult FrameLoop::locate_space(XrSpace space, XrSpace base_space, XrTime time, XrSpaceLocation* location, PFN_LocateSpace unfused) {
+    if (!space_prefetch || !location || location->next) {
+        return unfused(space, base_space, time, location);
+    }
+
+    SpacePair pair{handle_value(space), handle_value(base_space)};
+    std::unique_lock<std::mutex> snapshots_lock(snapshots_mutex);
+
+    // xrLocateSpace has no session, so the frame is found by its display time
+    for (const auto& [session, display_time] : display_times) {
+        if (display_time != time) {
+            continue;
+        }
+
+        // calls at the predicted display time are made again next frame
+        auto& located = located_spaces[session];
+        if (std::find(located.begin(), located.end(), pair) == located.end() && located.size() < MAX_PREFETCHED_SPACES) {
+            located.push_back(pair);
+        }
+
+        auto snapshot = space_snapshots.find(session);
+        if (snapshot == space_snapshots.end() || snapshot->second.display_time != time) {
+            break;
+        }
+        auto it = snapshot->second.locations.find(pair);
+        if (it == snapshot->second.locations.end() || XR_FAILED(it->second.result)) {
+            break;
+        }
+        location->locationFlags = it->second.location_flags;
+        location->pose = it->second.pose;
+        XrResult result = it->second.result;
+        snapshots_lock.unlock();
+        return deferred_errors.report(result);
+    }
+
+    snapshots_lock.unlock();
+    return unfused(space, base_space, time, location);
+}
+
+XrResult FrameLoop::destroy_space(XrSpace space, PFN_DestroySpace unfused) {
+    // sampled calls may use the space as their base space
+    forget_sampled_calls();
+    if (prefetch()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::uint64_t space_value = handle_value(space);
+        {
+            std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+            for (auto it = view_requests.begin(); it != view_requests.end();) {
+                it = it->second.space == space_value ? view_requests.erase(it) : std::next(it);
+            }
+            for (auto& [session, located] : located_spaces) {
+                located.erase(std::remove_if(located.begin(), located.end(),
+                    [space_value](const SpacePair& pair){ return pair.contains(space_value); }), located.end());
+            }
+            for (auto it = view_snapshots.begin(); it != view_snapshots.end();) {
+                it = it->second.request.space == space_value ? view_snapshots.erase(it) : std::next(it);
+            }
+            for (auto& [session, snapshot] : space_snapshots) {
+                for (auto it = snapshot.locations.begin(); it != snapshot.locations.end();) {
+                    it = it->first.contains(space_value) ? snapshot.locations.erase(it) : std::next(it);
+                }
+            }
+        }
+        // the server may still be locating things in the space
+        for (auto& [session, requests] : speculative_waits) {
+            bool located = false;
+            for (SpeculativeRequest& request : requests) {
+                // the runtime may reuse the handle value for another space
+                if (request.views.space == space_value) {
+                    request.views.space = 0;
+                    located = true;
+                }
+                for (SpacePair& pair : request.spaces) {
+                    if (pair.contains(space_value)) {
+                        pair = SpacePair{0, 0};
+                        located = true;
+                    }
+                }
+            }
+            if (located) {
+                await_frame_states(session, requests.size());
+            }
+        }
+    }
+    return unfused(space);
+}
+
+bool FrameLoop::take_sample(SampledCall call, XrTime time, QueryBuffer& sample) {
+    std::lock_guard<std::mutex> snapshots_lock(snapshots_mutex);
+
+    // tracker functions have no session either, so the frame is found by its display time
+    for (const auto& [session, display_time] : display_times) {
+        if (display_time != time) {
+            continue;
+        }
+
+        bool found = false;
+        auto snapshot = sample_snapshots.find(session);
+        if (snapshot != sample_snapshots.end() && snapshot->second.display_time == time) {
+            for (const Sample& taken : snapshot->second.samples) {
+                if (taken.call.matches(call)) {
+                    sample.bytes = taken.response;
+                    found = true;
+                    break;
+                }
+            }
+        }
+
+        // calls at the predicted display time are made again next frame
+        auto& calls = sampled_calls[session];
+        auto it = std::find_if(calls.begin(), calls.end(), [&call](const SampledCall& other){ return other.matches(call); });
+        if (it != calls.end()) {
+            *it = std::move(call);
+        }
+        else if (calls.size() < MAX_SAMPLED_CALLS) {
+            calls.push_back(std::move(call));
+        }
+        return found;
+    }
+
+    return false;
+}
+
+} // namespace xrtransport
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_CLIENT_FRAME_LOOP_H
+#define XRTRANSPORT_CLIENT_FRAME_LOOP_H
+
+#include "deferred_errors.h"
+#include "query_cache.h"
+#include "synchronization.h"
+
+#include "xrtransport/transport/transport.h"
+
+#include "openxr/openxr.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Frame loop fusion (XRTP_FEATURE_FRAME_LOOP_FUSION)
+ *
+ * An application's xrWaitFrame, xrBeginFrame and xrEndFrame would cost three round trips per frame, and
+ * xrWaitFrame returns a full round trip after the runtime released the frame. When this feature is
+ * negotiated, xrBeginFrame is sent as a oneway call, and every xrEndFrame that succeeds is followed by
+ * an XRTP_MSG_SPECULATIVE_WAIT_FRAME. The server then calls xrWaitFrame for the session right away, on a
+ * thread of its own (see src/server/frame_waiter.h), and sends the frame state it got back in an
+ * XRTP_MSG_FRAME_STATE. The application's next xrWaitFrame takes that frame state, which has usually
+ * arrived by then, instead of calling the server.
+ *
+ * Every speculative wait is taken by exactly one xrWaitFrame, xrEndSession or xrDestroySession of the
+ * session, which is what keeps the server from calling xrWaitFrame twice for one frame. Applications
+ * that wait for the next frame on another thread while the previous one is ended still work: a wait
+ * that finds no speculative one is a normal call, and xrEndFrame doesn't send a speculative wait while
+ * a normal one is in flight for the session.
+ *
+ * Frame states with next chains can't be filled in from a speculative wait. If an application uses
+ * them, the wait that was already made is returned without the chain, and speculation is turned off.
+ *
+ * View prefetch (XRTP_FEATURE_VIEW_PREFETCH)
+ *
+ * Most applications call xrLocateViews with the predicted display time right after xrWaitFrame, which
+ * would be another round trip before they can render. With this feature, the view configuration and
+ * space of the last such call are sent with each speculative wait, and the server locates the views as
+ * soon as its xrWaitFrame returns. xrLocateViews calls with exactly the same view configuration, space
+ * and display time are answered from those views.
+ *
+ * Space prefetch (XRTP_FEATURE_SPACE_PREFETCH)
+ *
+ * The same goes for the handful of spaces, like controller poses, that applications locate every frame
+ * at the predicted display time. The pairs of space and base space that were located at the display
+ * time of a frame are sent with its speculative wait, up to MAX_PREFETCHED_SPACES of them, and the
+ * server locates them all at the display time of the next frame. xrLocateSpace calls for those pairs at
+ * that time are answered from the locations. Pairs that weren't located during a frame aren't sent with
+ * its speculative wait, so they drop out of the set as soon as the application stops using them.
+ *
+ * xrDestroySpace waits for the speculative waits that locate anything in the space, so that the server
+ * never uses it after it was destroyed.
+ *
+ * Tracker sampling (XRTP_FEATURE_TRACKER_SAMPLING)
+ *
+ * Hand, body, eye and face trackers are queried once per frame each, with the functions in
+ * code_generation/sampled_calls.py. Their stubs serialize the call with the times relative to the time
+ * it is made at, and calls made at the display time of a frame are sent with its speculative wait, up to
+ * MAX_SAMPLED_CALLS of them. The server runs them again at the display time of the next frame and sends
+ * their responses with its frame state, and a call that matches one of them is answered from its
+ * response. Like spaces, calls that weren't made during a frame drop out.
+ *
+ * Destroying a tracker or a space waits for the speculative waits that sample any calls, and forgets
+ * all of them, since the params of a call are opaque here. They are sampled again from the next frame.
+ */
+class FrameLoop {
+public:
+    using PFN_WaitFrame = XrResult (*)(XrSession, const XrFrameWaitInfo*, XrFrameState*);
+    using PFN_EndFrame = XrResult (*)(XrSession, const XrFrameEndInfo*);
+    using PFN_EndSession = XrResult (*)(XrSession);
+    using PFN_DestroySession = XrResult (*)(XrSession);
+    using PFN_LocateViews = XrResult (*)(XrSession, const XrViewLocateInfo*, XrViewState*, uint32_t, uint32_t*, XrView*);
+    using PFN_LocateSpace = XrResult (*)(XrSpace, XrSpace, XrTime, XrSpaceLocation*);
+    using PFN_DestroySpace = XrResult (*)(XrSpace);
+
+    static constexpr std::size_t MAX_PREFETCHED_SPACES = 16;
+    static constexpr std::size_t MAX_SAMPLED_CALLS = 16;
+    // how often a thread waiting for a frame state checks whether the transport was closed
+    static constexpr std::chrono::milliseconds FRAME_STATE_POLL_INTERVAL{100};
+
+private:
+    struct ViewRequest {
+        XrViewConfigurationType view_configuration_type;
+        std::uint64_t space; // XR_NULL_HANDLE if no views are located
+    };
+
+    struct SpacePair {
+        std::uint64_t space;
+        std::uint64_t base_space;
+
+        bool operator==(const SpacePair& other) const {
+            return space == other.space && base_space == other.base_space;
+        }
+
+        bool contains(std::uint64_t handle) const {
+            return space == handle || base_space == handle;
+        }
+    };
+
+    struct SpacePairHash {
+        std::size_t operator()(const SpacePair& pair) const {
+            return std::hash<std::uint64_t>()(pair.space) ^ (std::hash<std::uint64_t>()(pair.base_space) * 31);
+        }
+    };
+
+    struct SpeculativeRequest {
+        ViewRequest views;
+        std::vector<SpacePair> spaces; // {0, 0} for pairs that must not be used anymore
+        std::vector<SampledCall> calls;
+    };
+
+    struct SpaceLocation {
+        XrResult result;
+        XrSpaceLocationFlags location_flags;
+        XrPosef pose;
+    };
+
+    struct FrameState {
+        XrResult result;
+        XrTime predicted_display_time;
+        XrDuration predicted_display_period;
+        XrBool32 should_render;
+        bool has_views;
+        XrViewStateFlags view_state_flags;
+        std::vector<XrView> views;
+        std::vector<SpaceLocation> space_locations; // in the order of the request
+        std::vector<std::vector<std::uint8_t>> samples; // responses in the order of the request, empty if not sampled
+    };
+
+    struct ViewSnapshot {
+        XrTime display_time;
+        ViewRequest request;
+        XrViewStateFlags view_state_flags;
+        std::vector<XrView> views;
+    };
+
+    struct SpaceSnapshot {
+        XrTime display_time;
+        std::unordered_map<SpacePair, SpaceLocation, SpacePairHash> locations;
+    };
+
+    struct Sample {
+        SampledCall call;
+        std::vector<std::uint8_t> response;
+    };
+
+    struct SampleSnapshot {
+        XrTime display_time;
+        std::vector<Sample> samples;
+    };
+
+    Transport& transport;
+    DeferredErrors& deferred_errors;
+    const ClockSync& clock_sync;
+    bool view_prefetch;
+    bool space_prefetch;
+    bool tracker_sampling;
+
+    // Held while deciding between a speculative and a normal wait and sending it, so that the server
+    // gets them in the same order
+    std::mutex mutex;
+    // the speculative waits of each session that weren't taken yet, protected by mutex
+    std::unordered_map<std::uint64_t, std::deque<SpeculativeRequest>> speculative_waits;
+    // the normal waits of each session that are in flight, protected by mutex
+    std::unordered_map<std::uint64_t, std::size_t> unfused_waits;
+    std::atomic<bool> enabled{true};
+
+    // frame states that arrived before they were taken, signalled by handle_message
+    std::mutex mailbox_mutex;
+    std::condition_variable mailbox_condition;
+    std::unordered_map<std::uint64_t, std::deque<FrameState>> mailbox;
+
+    // Protects the prefetch state of each session, never held while waiting for the server. mutex must
+    // be taken first if both are needed.
+    std::mutex snapshots_mutex;
+    std::unordered_map<std::uint64_t, XrTime> display_times; // of the last frame
+    std::unordered_map<std::uint64_t, ViewRequest> view_requests; // to send with the next speculative wait
+    std::unordered_map<std::uint64_t, std::vector<SpacePair>> located_spaces; // during the current frame
+    std::unordered_map<std::uint64_t, std::vector<SampledCall>> sampled_calls; // during the current frame
+    std::unordered_map<std::uint64_t, ViewSnapshot> view_snapshots;
+    std::unordered_map<std::uint64_t, SpaceSnapshot> space_snapshots;
+    std::unordered_map<std::uint64_t, SampleSnapshot> sample_snapshots;
+
+    bool prefetch() const {
+        return view_prefetch || space_prefetch || tracker_sampling;
+    }
+
+    // mutex must be held
+    bool take_speculative_wait(std::uint64_t session, SpeculativeRequest& request);
+    FrameState receive_frame_state(std::uint64_t session);
+    void await_frame_states(std::uint64_t session, std::size_t count);
+    void discard_speculative_waits(std::uint64_t session);
+    void forget_sampled_calls();
+
+    // snapshots_mutex must be held
+    void store_snapshots(std::uint64_t session, XrTime display_time, SpeculativeRequest& request, FrameState& frame_state);
+    void forget_snapshots(std::uint64_t session);
+
+public:
+    FrameLoop(Transport& transport, DeferredErrors& deferred_errors, const ClockSync& clock_sync,
+        bool view_prefetch, bool space_prefetch, bool tracker_sampling)
+        : transport(transport), deferred_errors(deferred_errors), clock_sync(clock_sync), view_prefetch(view_prefetch),
+            space_prefetch(space_prefetch), tracker_sampling(tracker_sampling) {}
+
+    bool samples_calls() const {
+        return tracker_sampling;
+    }
+
+    /**
+     * Keeps the frame state in an XRTP_MSG_FRAME_STATE until it is taken.
+     */
+    void handle_message(MessageLockIn msg_in);
+
+    XrResult wait_frame(XrSession session, const XrFrameWaitInfo* frame_wait_info, XrFrameState* frame_state, PFN_WaitFrame unfused);
+    XrResult end_frame(XrSession session, const XrFrameEndInfo* frame_end_info, PFN_EndFrame unfused);
+    XrResult end_session(XrSession session, PFN_EndSession unfused);
+    XrResult destroy_session(XrSession session, PFN_DestroySession unfused);
+    XrResult locate_views(XrSession session, const XrViewLocateInfo* view_locate_info, XrViewState* view_state,
+        uint32_t view_capacity_input, uint32_t* view_count_output, XrView* views, PFN_LocateViews unfused);
+    XrResult locate_space(XrSpace space, XrSpace base_space, XrTime time, XrSpaceLocation* location, PFN_LocateSpace unfused);
+    XrResult destroy_space(XrSpace space, PFN_DestroySpace unfused);
+
+    /**
+     * Called by the generated stubs of sampled calls.
+     * @param call Made at time, sent with the next speculative wait if that is the display time of a frame
+     * @param sample Set to the response of the call if it was sampled at time
+     * @return Whether sample was set
+     */
+    bool take_sample(SampledCall call, XrTime time, QueryBuffer& sample);
+
+    template <typename T>
+    XrResult destroy_tracker(T tracker, XrResult (*unfused)(T)) {
+        forget_sampled_calls();
+        return unfused(tracker);
+    }
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_CLIENT_FRAME_LOOP_H
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "query_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace xrtransport {
+
+std::size_t QueryBuffer::read_some(const asio::mutable_buffer& buffer, asio::error_code& ec) {
+    ec.clear();
+    std::size_t size = std::min(buffer.size(), bytes.size() - read_head);
+    if (size == 0 && buffer.size() != 0) {
+        ec = asio::error::eof;
+        return 0;
+    }
+    std::memcpy(buffer.data(), bytes.data() + read_head, size);
+    read_head += size;
+    return size;
+}
+
+bool SampledCall::matches(const SampledCall& other) const {
+    return function_id == other.function_id &&
+        key_size == other.key_size &&
+        bytes.size() == other.bytes.size() &&
+        std::equal(bytes.begin(), bytes.begin() + key_size, other.bytes.begin());
+}
+
+bool QueryCache::lookup(const QueryKey& key, XrResult& result, QueryBuffer& outputs) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto owner_it = entries.find(key.owner);
+    if (owner_it != entries.end()) {
+        auto it = owner_it->second.find({key.function_id, key.bytes});
+        if (it != owner_it->second.end()) {
+            stats.hits++;
+            result = it->second.result;
+            outputs.bytes = it->second.outputs;
+            outputs.read_head = 0;
+            return true;
+        }
+    }
+    stats.misses++;
+    return false;
+}
+
+void QueryCache::store(const QueryKey& key, XrResult result, const QueryBuffer& outputs) {
+    if (result != XR_SUCCESS) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    entries[key.owner][{key.function_id, key.bytes}] = Entry{result, outputs.bytes};
+}
+
+void QueryCache::clear(std::uint64_t owner) {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.erase(owner);
+}
+
+void QueryCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    std::uint64_t total = stats.hits + stats.misses;
+    if (total) {
+        spdlog::info("Query cache answered {} of {} queries ({:.1f}%)", stats.hits, total, 100.0 * stats.hits / total);
+    }
+}
+
+QueryCacheStats QueryCache::get_stats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+} // namespace xrtransport
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_CLIENT_QUERY_CACHE_H
+#define XRTRANSPORT_CLIENT_QUERY_CACHE_H
+
+#include "xrtransport/asio_compat.h"
+
+#include "openxr/openxr.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Client side cache of instance and system queries
+ *
+ * The functions in code_generation/query_cache.py, like xrGetSystemProperties and
+ * xrEnumerateViewConfigurationViews, return the same data for the lifetime of the instance or session
+ * they are called on, and some engines call them every frame. Their generated stubs look up the
+ * function and serialized params before making the call, and keep the serialized outputs of every
+ * call that returned XR_SUCCESS.
+ *
+ * Entries belong to the handle in the first param. They are dropped when it is destroyed, so that a
+ * runtime that reuses the handle values doesn't get stale results, and all of them are dropped when
+ * the instance is destroyed. The cache can be turned off with the query_cache config option.
+ */
+
+/**
+ * Bytes written to and read back from the cache.
+ */
+class QueryBuffer : public SyncDuplexStream {
+public:
+    std::vector<std::uint8_t> bytes;
+    std::size_t read_head = 0;
+
+    std::size_t read_some(const asio::mutable_buffer& buffer, asio::error_code& ec) override;
+
+    std::size_t read_some(const asio::mutable_buffer& buffer) override {
+        asio::error_code ec;
+        std::size_t size_read = read_some(buffer, ec);
+        if (ec) {
+            throw asio::system_error(ec);
+        }
+        return size_read;
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer, asio::error_code& ec) override {
+        ec.clear();
+        const std::uint8_t* data = static_cast<const std::uint8_t*>(buffer.data());
+        bytes.insert(bytes.end(), data, data + buffer.size());
+        return buffer.size();
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer) override {
+        asio::error_code ec;
+        return write_some(buffer, ec);
+    }
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+};
+
+/**
+ * The owner handle, function and serialized params of a query.
+ */
+class QueryKey : public QueryBuffer {
+public:
+    std::uint64_t owner;
+    std::uint32_t function_id;
+
+    QueryKey(std::uint64_t owner, std::uint32_t function_id) : owner(owner), function_id(function_id) {}
+};
+
+/**
+ * The function and serialized params of a call that can be answered from the response to an earlier
+ * one, like the sampled calls in frame_loop.h and the action state queries in action_states.h. Only the
+ * params up to key_size, which come before the outputs, have to be the same for the response to answer
+ * the call. The outputs are whatever the application left in them, they only have to have the same size.
+ */
+class SampledCall : public QueryBuffer {
+public:
+    std::uint32_t function_id;
+    std::size_t key_size = 0;
+
+    explicit SampledCall(std::uint32_t function_id) : function_id(function_id) {}
+
+    bool matches(const SampledCall& other) const;
+};
+
+struct QueryCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+};
+
+class QueryCache {
+private:
+    struct Entry {
+        XrResult result;
+        std::vector<std::uint8_t> outputs;
+    };
+
+    std::mutex mutex;
+    // by owner, then by function id and params
+    std::unordered_map<std::uint64_t, std::map<std::pair<std::uint32_t, std::vector<std::uint8_t>>, Entry>> entries;
+    QueryCacheStats stats;
+
+public:
+    /**
+     * @return Whether there was an entry for key, in which case result and outputs are set
+     */
+    bool lookup(const QueryKey& key, XrResult& result, QueryBuffer& outputs);
+
+    /**
+     * Keeps the outputs of a call that returned XR_SUCCESS. Other results aren't stored, since a query
+     * that failed, like xrGetSystem while the headset is unplugged, may succeed when it is made again.
+     */
+    void store(const QueryKey& key, XrResult result, const QueryBuffer& outputs);
+
+    /**
+     * Drops the entries of a handle that is destroyed.
+     */
+    void clear(std::uint64_t owner);
+
+    /**
+     * Drops all entries, when the instance is destroyed.
+     */
+    void clear();
+
+    QueryCacheStats get_stats();
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_CLIENT_QUERY_CACHE_H
@@ -12,10 +12,19 @@
 #include "rpc.h"
 #include "runtime.h"
 #include "synchronization.h"
+#include "two_call_cache.h"
+#include "query_cache.h"
+#include "action_states.h"
+#include "frame_loop.h"
 
 #include "xrtransport/transport/transport.h"
 #include "xrtransport/serialization/serializer.h"
 #include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/packed_calls.h"
+#include "xrtransport/serialization/virtual_handles.h"
 #include "xrtransport/time.h"
 #include "xrtransport/util.h"
 
@@ -33,8 +42,14 @@ static XrTime start_rpc_timer() {
     return get_time();
 }
 
-static void end_rpc_timer(XrTime start_time, XrDuration runtime_duration, std::string_view tag) {
+static void end_rpc_timer(XrTime start_time, XrDuration runtime_duration, MessageLockIn& msg_in, std::string_view tag) {
     XrTime end_time = get_time();
+    if (get_runtime().has_feature(XRTP_FEATURE_INBAND_TIMESTAMPS)) {
+        // server times the call was received and the response was sent
+        XrTime server_times[2]{};
+        asio::read(msg_in.buffer, asio::buffer(server_times, sizeof(server_times)));
+        get_runtime().get_clock_sync().add_sample(start_time, server_times[0], server_times[1], end_time);
+    }
     XrDuration total_duration = end_time - start_time;
     XrDuration rpc_duration = total_duration - runtime_duration;
     float duration_ms = (float)(rpc_duration) / 1000000;
@@ -47,32 +62,39 @@ static void end_rpc_timer(XrTime start_time, XrDuration runtime_duration, std::s
 XRAPI_ATTR XrResult XRAPI_CALL xrSetDigitalLensControlALMALENCE(XrSession session, const XrDigitalLensControlALMALENCE* digitalLensControl) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 197001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(digitalLensControl, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetDigitalLensControlALMALENCE");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetDigitalLensControlALMALENCE");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetDigitalLensControlALMALENCE: {}", e.what());
@@ -84,24 +106,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateBodyTrackerBD(XrSession session, const XrBodyTrackerCreateInfoBD* createInfo, XrBodyTrackerBD* bodyTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 386001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(bodyTracker, 1, s_ctx);
+    serialize_output_ptr(bodyTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -109,70 +138,128 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateBodyTrackerBD(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bodyTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateBodyTrackerBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateBodyTrackerBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateBodyTrackerBD: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyBodyTrackerBD(XrBodyTrackerBD bodyTracker) try {
+static XrResult oneway_xrDestroyBodyTrackerBD(XrBodyTrackerBD bodyTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 386002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&bodyTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyBodyTrackerBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroyBodyTrackerBD(XrBodyTrackerBD bodyTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyBodyTrackerBD(bodyTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 386002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyBodyTrackerBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyBodyTrackerBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyBodyTrackerBD: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsBD(XrBodyTrackerBD bodyTracker, const XrBodyJointsLocateInfoBD* locateInfo, XrBodyJointLocationsBD* locations) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyBodyTrackerBD(XrBodyTrackerBD bodyTracker) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroyBodyTrackerBD(bodyTracker);
+    }
+    return frame_loop->destroy_tracker(bodyTracker, unfused_xrDestroyBodyTrackerBD);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyBodyTrackerBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unsampled_xrLocateBodyJointsBD(XrBodyTrackerBD bodyTracker, const XrBodyJointsLocateInfoBD* locateInfo, XrBodyJointLocationsBD* locations) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 386003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
     serialize_ptr(locateInfo, 1, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -180,9 +267,46 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsBD(XrBodyTrackerBD bodyTracker,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateBodyJointsBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateBodyJointsBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateBodyJointsBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsBD(XrBodyTrackerBD bodyTracker, const XrBodyJointsLocateInfoBD* locateInfo, XrBodyJointLocationsBD* locations) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !locateInfo) {
+        return unsampled_xrLocateBodyJointsBD(bodyTracker, locateInfo, locations);
+    }
+
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = locateInfo->time;
+    SampledCall call(386003);
+    SerializeContext call_ctx(call, time);
+    serialize(&bodyTracker, call_ctx);
+    serialize_ptr(locateInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_ptr(locations, 1, call_ctx);
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_xrLocateBodyJointsBD(bodyTracker, locateInfo, locations);
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_xrLocateBodyJointsBD(bodyTracker, locateInfo, locations);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&locations, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateBodyJointsBD: {}", e.what());
@@ -194,24 +318,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorAsyncBD(XrSenseDataProviderBD provider, const XrSpatialAnchorCreateInfoBD* info, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 391001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -219,9 +350,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorAsyncBD(XrSenseDataProviderB
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorAsyncBD: {}", e.what());
@@ -231,24 +362,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrSpatialAnchorCreateCompletionBD* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 391002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -256,9 +394,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorCompleteBD(XrSenseDataProvid
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorCompleteBD: {}", e.what());
@@ -268,24 +406,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPersistSpatialAnchorAsyncBD(XrSenseDataProviderBD provider, const XrSpatialAnchorPersistInfoBD* info, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 391003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -293,9 +438,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrPersistSpatialAnchorAsyncBD(XrSenseDataProvider
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPersistSpatialAnchorAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPersistSpatialAnchorAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPersistSpatialAnchorAsyncBD: {}", e.what());
@@ -305,24 +450,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPersistSpatialAnchorCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrFutureCompletionEXT* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 391004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -330,9 +482,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrPersistSpatialAnchorCompleteBD(XrSenseDataProvi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPersistSpatialAnchorCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPersistSpatialAnchorCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPersistSpatialAnchorCompleteBD: {}", e.what());
@@ -342,24 +494,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUnpersistSpatialAnchorAsyncBD(XrSenseDataProviderBD provider, const XrSpatialAnchorUnpersistInfoBD* info, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 391005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -367,9 +526,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrUnpersistSpatialAnchorAsyncBD(XrSenseDataProvid
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUnpersistSpatialAnchorAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUnpersistSpatialAnchorAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUnpersistSpatialAnchorAsyncBD: {}", e.what());
@@ -379,24 +538,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUnpersistSpatialAnchorCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrFutureCompletionEXT* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 391006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -404,9 +570,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrUnpersistSpatialAnchorCompleteBD(XrSenseDataPro
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUnpersistSpatialAnchorCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUnpersistSpatialAnchorCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUnpersistSpatialAnchorCompleteBD: {}", e.what());
@@ -418,24 +584,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrDownloadSharedSpatialAnchorAsyncBD(XrSenseDataProviderBD provider, const XrSharedSpatialAnchorDownloadInfoBD* info, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 392001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -443,9 +616,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrDownloadSharedSpatialAnchorAsyncBD(XrSenseDataP
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDownloadSharedSpatialAnchorAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDownloadSharedSpatialAnchorAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDownloadSharedSpatialAnchorAsyncBD: {}", e.what());
@@ -455,24 +628,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrDownloadSharedSpatialAnchorCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrFutureCompletionEXT* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 392002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -480,9 +660,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrDownloadSharedSpatialAnchorCompleteBD(XrSenseDa
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDownloadSharedSpatialAnchorCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDownloadSharedSpatialAnchorCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDownloadSharedSpatialAnchorCompleteBD: {}", e.what());
@@ -492,24 +672,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrShareSpatialAnchorAsyncBD(XrSenseDataProviderBD provider, const XrSpatialAnchorShareInfoBD* info, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 392003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -517,9 +704,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrShareSpatialAnchorAsyncBD(XrSenseDataProviderBD
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrShareSpatialAnchorAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrShareSpatialAnchorAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrShareSpatialAnchorAsyncBD: {}", e.what());
@@ -529,24 +716,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrShareSpatialAnchorCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrFutureCompletionEXT* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 392004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -554,9 +748,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrShareSpatialAnchorCompleteBD(XrSenseDataProvide
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrShareSpatialAnchorCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrShareSpatialAnchorCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrShareSpatialAnchorCompleteBD: {}", e.what());
@@ -568,24 +762,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCaptureSceneAsyncBD(XrSenseDataProviderBD provider, const XrSceneCaptureInfoBD* info, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 393001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -593,9 +794,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCaptureSceneAsyncBD(XrSenseDataProviderBD provi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCaptureSceneAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCaptureSceneAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCaptureSceneAsyncBD: {}", e.what());
@@ -605,24 +806,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCaptureSceneCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrFutureCompletionEXT* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 393002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -630,9 +838,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCaptureSceneCompleteBD(XrSenseDataProviderBD pr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCaptureSceneCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCaptureSceneCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCaptureSceneCompleteBD: {}", e.what());
@@ -644,24 +852,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateAnchorSpaceBD(XrSession session, const XrAnchorSpaceCreateInfoBD* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -669,9 +884,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateAnchorSpaceBD(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateAnchorSpaceBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateAnchorSpaceBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateAnchorSpaceBD: {}", e.what());
@@ -681,24 +896,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSenseDataProviderBD(XrSession session, const XrSenseDataProviderCreateInfoBD* createInfo, XrSenseDataProviderBD* provider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(provider, 1, s_ctx);
+    serialize_output_ptr(provider, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -706,9 +928,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSenseDataProviderBD(XrSession session, co
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&provider, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSenseDataProviderBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSenseDataProviderBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSenseDataProviderBD: {}", e.what());
@@ -718,24 +940,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialEntityAnchorBD(XrSenseDataProviderBD provider, const XrSpatialEntityAnchorCreateInfoBD* createInfo, XrAnchorBD* anchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(anchor, 1, s_ctx);
+    serialize_output_ptr(anchor, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -743,151 +972,292 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialEntityAnchorBD(XrSenseDataProvider
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&anchor, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialEntityAnchorBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialEntityAnchorBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialEntityAnchorBD: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyAnchorBD(XrAnchorBD anchor) try {
+static XrResult oneway_xrDestroyAnchorBD(XrAnchorBD anchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 390004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&anchor, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyAnchorBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyAnchorBD(XrAnchorBD anchor) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyAnchorBD(anchor);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&anchor, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyAnchorBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyAnchorBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyAnchorBD: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySenseDataProviderBD(XrSenseDataProviderBD provider) try {
+static XrResult oneway_xrDestroySenseDataProviderBD(XrSenseDataProviderBD provider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
-    // start timer after synchronization
+    uint32_t function_id = 390005;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&provider, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySenseDataProviderBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySenseDataProviderBD(XrSenseDataProviderBD provider) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySenseDataProviderBD(provider);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySenseDataProviderBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySenseDataProviderBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySenseDataProviderBD: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySenseDataSnapshotBD(XrSenseDataSnapshotBD snapshot) try {
+static XrResult oneway_xrDestroySenseDataSnapshotBD(XrSenseDataSnapshotBD snapshot) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 390006;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&snapshot, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySenseDataSnapshotBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySenseDataSnapshotBD(XrSenseDataSnapshotBD snapshot) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySenseDataSnapshotBD(snapshot);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&snapshot, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySenseDataSnapshotBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySenseDataSnapshotBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySenseDataSnapshotBD: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSpatialEntityComponentTypesBD(XrSenseDataSnapshotBD snapshot, XrSpatialEntityIdBD entityId, uint32_t componentTypeCapacityInput, uint32_t* componentTypeCountOutput, XrSpatialEntityComponentTypeBD* componentTypes) try {
+static XrResult uncached_xrEnumerateSpatialEntityComponentTypesBD(XrSenseDataSnapshotBD snapshot, XrSpatialEntityIdBD entityId, uint32_t componentTypeCapacityInput, uint32_t* componentTypeCountOutput, XrSpatialEntityComponentTypeBD* componentTypes) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&snapshot, s_ctx);
     serialize(&entityId, s_ctx);
     serialize(&componentTypeCapacityInput, s_ctx);
-    serialize_ptr(componentTypeCountOutput, 1, s_ctx);
-    serialize_ptr(componentTypes, componentTypeCapacityInput, s_ctx);
+    serialize_output_ptr(componentTypeCountOutput, 1, s_ctx);
+    serialize_output_ptr(componentTypes, componentTypeCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&componentTypeCountOutput, d_ctx);
-    deserialize_ptr(&componentTypes, d_ctx);
+    deserialize_filled_ptr(componentTypes, componentTypeCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateSpatialEntityComponentTypesBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateSpatialEntityComponentTypesBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateSpatialEntityComponentTypesBD: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSpatialEntityComponentTypesBD(XrSenseDataSnapshotBD snapshot, XrSpatialEntityIdBD entityId, uint32_t componentTypeCapacityInput, uint32_t* componentTypeCountOutput, XrSpatialEntityComponentTypeBD* componentTypes) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(390007);
+    SerializeContext key_ctx(key);
+    serialize(&snapshot, key_ctx);
+    serialize(&entityId, key_ctx);
+
+    return call_two_call(key, componentTypeCapacityInput, componentTypeCountOutput, componentTypes, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrSpatialEntityComponentTypeBD* elements) {
+            return uncached_xrEnumerateSpatialEntityComponentTypesBD(snapshot, entityId, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateSpatialEntityComponentTypesBD: {}", e.what());
@@ -897,23 +1267,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetAnchorUuidBD(XrAnchorBD anchor, XrUuidEXT* uuid) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&anchor, s_ctx);
-    serialize_ptr(uuid, 1, s_ctx);
+    serialize_output_ptr(uuid, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -921,9 +1298,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetAnchorUuidBD(XrAnchorBD anchor, XrUuidEXT* u
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&uuid, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetAnchorUuidBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetAnchorUuidBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetAnchorUuidBD: {}", e.what());
@@ -933,24 +1310,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetQueriedSenseDataBD(XrSenseDataSnapshotBD snapshot, XrQueriedSenseDataGetInfoBD* getInfo, XrQueriedSenseDataBD* queriedSenseData) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&snapshot, s_ctx);
-    serialize_ptr(getInfo, 1, s_ctx);
+    serialize_output_xr_ptr(getInfo, 1, s_ctx);
     serialize_ptr(queriedSenseData, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -959,9 +1343,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetQueriedSenseDataBD(XrSenseDataSnapshotBD sna
     deserialize_ptr(&getInfo, d_ctx);
     deserialize_ptr(&queriedSenseData, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetQueriedSenseDataBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetQueriedSenseDataBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetQueriedSenseDataBD: {}", e.what());
@@ -971,23 +1355,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSenseDataProviderStateBD(XrSenseDataProviderBD provider, XrSenseDataProviderStateBD* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -995,9 +1386,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSenseDataProviderStateBD(XrSenseDataProvider
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSenseDataProviderStateBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSenseDataProviderStateBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSenseDataProviderStateBD: {}", e.what());
@@ -1007,24 +1398,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialEntityComponentDataBD(XrSenseDataSnapshotBD snapshot, const XrSpatialEntityComponentGetInfoBD* getInfo, XrSpatialEntityComponentDataBaseHeaderBD* componentData) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390011;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&snapshot, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize_xr(componentData, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1032,9 +1430,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialEntityComponentDataBD(XrSenseDataSnap
     deserialize(&runtime_duration, d_ctx);
     deserialize_xr(&componentData, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpatialEntityComponentDataBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpatialEntityComponentDataBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpatialEntityComponentDataBD: {}", e.what());
@@ -1044,24 +1442,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialEntityUuidBD(XrSenseDataSnapshotBD snapshot, XrSpatialEntityIdBD entityId, XrUuidEXT* uuid) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390012;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&snapshot, s_ctx);
     serialize(&entityId, s_ctx);
-    serialize_ptr(uuid, 1, s_ctx);
+    serialize_output_ptr(uuid, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1069,9 +1474,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialEntityUuidBD(XrSenseDataSnapshotBD sn
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&uuid, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpatialEntityUuidBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpatialEntityUuidBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpatialEntityUuidBD: {}", e.what());
@@ -1081,24 +1486,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQuerySenseDataAsyncBD(XrSenseDataProviderBD provider, const XrSenseDataQueryInfoBD* queryInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390013;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(queryInfo, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1106,9 +1518,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQuerySenseDataAsyncBD(XrSenseDataProviderBD pro
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQuerySenseDataAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQuerySenseDataAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQuerySenseDataAsyncBD: {}", e.what());
@@ -1118,24 +1530,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQuerySenseDataCompleteBD(XrSenseDataProviderBD provider, XrFutureEXT future, XrSenseDataQueryCompletionBD* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390014;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1143,9 +1562,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQuerySenseDataCompleteBD(XrSenseDataProviderBD
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQuerySenseDataCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQuerySenseDataCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQuerySenseDataCompleteBD: {}", e.what());
@@ -1155,24 +1574,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStartSenseDataProviderAsyncBD(XrSenseDataProviderBD provider, const XrSenseDataProviderStartInfoBD* startInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390015;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
     serialize_ptr(startInfo, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1180,9 +1606,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStartSenseDataProviderAsyncBD(XrSenseDataProvid
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStartSenseDataProviderAsyncBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStartSenseDataProviderAsyncBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStartSenseDataProviderAsyncBD: {}", e.what());
@@ -1192,24 +1618,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStartSenseDataProviderCompleteBD(XrSession session, XrFutureEXT future, XrFutureCompletionEXT* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390016;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1217,9 +1650,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStartSenseDataProviderCompleteBD(XrSession sess
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStartSenseDataProviderCompleteBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStartSenseDataProviderCompleteBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStartSenseDataProviderCompleteBD: {}", e.what());
@@ -1229,31 +1662,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStopSenseDataProviderBD(XrSenseDataProviderBD provider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 390017;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&provider, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStopSenseDataProviderBD");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStopSenseDataProviderBD");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStopSenseDataProviderBD: {}", e.what());
@@ -1265,34 +1705,41 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetInputDeviceActiveEXT(XrSession session, XrPath interactionProfile, XrPath topLevelPath, XrBool32 isActive) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 48001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&interactionProfile, s_ctx);
     serialize(&topLevelPath, s_ctx);
     serialize(&isActive, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetInputDeviceActiveEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetInputDeviceActiveEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetInputDeviceActiveEXT: {}", e.what());
@@ -1302,35 +1749,42 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetInputDeviceLocationEXT(XrSession session, XrPath topLevelPath, XrPath inputSourcePath, XrSpace space, XrPosef pose) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 48002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&topLevelPath, s_ctx);
     serialize(&inputSourcePath, s_ctx);
     serialize(&space, s_ctx);
     serialize(&pose, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetInputDeviceLocationEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetInputDeviceLocationEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetInputDeviceLocationEXT: {}", e.what());
@@ -1340,34 +1794,41 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetInputDeviceStateBoolEXT(XrSession session, XrPath topLevelPath, XrPath inputSourcePath, XrBool32 state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 48003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&topLevelPath, s_ctx);
     serialize(&inputSourcePath, s_ctx);
     serialize(&state, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetInputDeviceStateBoolEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetInputDeviceStateBoolEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetInputDeviceStateBoolEXT: {}", e.what());
@@ -1377,34 +1838,41 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetInputDeviceStateFloatEXT(XrSession session, XrPath topLevelPath, XrPath inputSourcePath, float state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 48004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&topLevelPath, s_ctx);
     serialize(&inputSourcePath, s_ctx);
     serialize(&state, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetInputDeviceStateFloatEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetInputDeviceStateFloatEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetInputDeviceStateFloatEXT: {}", e.what());
@@ -1414,34 +1882,41 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetInputDeviceStateVector2fEXT(XrSession session, XrPath topLevelPath, XrPath inputSourcePath, XrVector2f state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 48005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&topLevelPath, s_ctx);
     serialize(&inputSourcePath, s_ctx);
     serialize(&state, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetInputDeviceStateVector2fEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetInputDeviceStateVector2fEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetInputDeviceStateVector2fEXT: {}", e.what());
@@ -1453,24 +1928,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateDebugUtilsMessengerEXT(XrInstance instance, const XrDebugUtilsMessengerCreateInfoEXT* createInfo, XrDebugUtilsMessengerEXT* messenger) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(messenger, 1, s_ctx);
+    serialize_output_ptr(messenger, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1479,182 +1961,380 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateDebugUtilsMessengerEXT(XrInstance instanc
     deserialize_ptr(&createInfo->userData, d_ctx);
     deserialize_ptr(&messenger, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateDebugUtilsMessengerEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateDebugUtilsMessengerEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateDebugUtilsMessengerEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyDebugUtilsMessengerEXT(XrDebugUtilsMessengerEXT messenger) try {
+static XrResult oneway_xrDestroyDebugUtilsMessengerEXT(XrDebugUtilsMessengerEXT messenger) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 20002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&messenger, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyDebugUtilsMessengerEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyDebugUtilsMessengerEXT(XrDebugUtilsMessengerEXT messenger) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyDebugUtilsMessengerEXT(messenger);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&messenger, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyDebugUtilsMessengerEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyDebugUtilsMessengerEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyDebugUtilsMessengerEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrSessionBeginDebugUtilsLabelRegionEXT(XrSession session, const XrDebugUtilsLabelEXT* labelInfo) try {
+static XrResult oneway_xrSessionBeginDebugUtilsLabelRegionEXT(XrSession session, const XrDebugUtilsLabelEXT* labelInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
+    XrDuration time_offset = get_time_offset();
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
     uint32_t function_id = 20003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(labelInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
-    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrSessionBeginDebugUtilsLabelRegionEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrSessionBeginDebugUtilsLabelRegionEXT(XrSession session, const XrDebugUtilsLabelEXT* labelInfo) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrSessionBeginDebugUtilsLabelRegionEXT(session, labelInfo);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 20003;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(labelInfo, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSessionBeginDebugUtilsLabelRegionEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSessionBeginDebugUtilsLabelRegionEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSessionBeginDebugUtilsLabelRegionEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrSessionEndDebugUtilsLabelRegionEXT(XrSession session) try {
+static XrResult oneway_xrSessionEndDebugUtilsLabelRegionEXT(XrSession session) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 20004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrSessionEndDebugUtilsLabelRegionEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrSessionEndDebugUtilsLabelRegionEXT(XrSession session) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrSessionEndDebugUtilsLabelRegionEXT(session);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSessionEndDebugUtilsLabelRegionEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSessionEndDebugUtilsLabelRegionEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSessionEndDebugUtilsLabelRegionEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrSessionInsertDebugUtilsLabelEXT(XrSession session, const XrDebugUtilsLabelEXT* labelInfo) try {
+static XrResult oneway_xrSessionInsertDebugUtilsLabelEXT(XrSession session, const XrDebugUtilsLabelEXT* labelInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 20005;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(labelInfo, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrSessionInsertDebugUtilsLabelEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrSessionInsertDebugUtilsLabelEXT(XrSession session, const XrDebugUtilsLabelEXT* labelInfo) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrSessionInsertDebugUtilsLabelEXT(session, labelInfo);
+    }
 
-    // start timer after synchronization
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(labelInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSessionInsertDebugUtilsLabelEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSessionInsertDebugUtilsLabelEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSessionInsertDebugUtilsLabelEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrSetDebugUtilsObjectNameEXT(XrInstance instance, const XrDebugUtilsObjectNameInfoEXT* nameInfo) try {
+static XrResult oneway_xrSetDebugUtilsObjectNameEXT(XrInstance instance, const XrDebugUtilsObjectNameInfoEXT* nameInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 20006;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&instance, s_ctx);
+    serialize_ptr(nameInfo, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrSetDebugUtilsObjectNameEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrSetDebugUtilsObjectNameEXT(XrInstance instance, const XrDebugUtilsObjectNameInfoEXT* nameInfo) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrSetDebugUtilsObjectNameEXT(instance, nameInfo);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(nameInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetDebugUtilsObjectNameEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetDebugUtilsObjectNameEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetDebugUtilsObjectNameEXT: {}", e.what());
@@ -1664,25 +2344,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSubmitDebugUtilsMessageEXT(XrInstance instance, XrDebugUtilsMessageSeverityFlagsEXT messageSeverity, XrDebugUtilsMessageTypeFlagsEXT messageTypes, const XrDebugUtilsMessengerCallbackDataEXT* callbackData) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&messageSeverity, s_ctx);
     serialize(&messageTypes, s_ctx);
     serialize_ptr(callbackData, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1691,9 +2378,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrSubmitDebugUtilsMessageEXT(XrInstance instance,
     deserialize_ptr(&callbackData->objects, d_ctx);
     deserialize_ptr(&callbackData->sessionLabels, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSubmitDebugUtilsMessageEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSubmitDebugUtilsMessageEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSubmitDebugUtilsMessageEXT: {}", e.what());
@@ -1705,32 +2392,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCancelFutureEXT(XrInstance instance, const XrFutureCancelInfoEXT* cancelInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 470001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(cancelInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCancelFutureEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCancelFutureEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCancelFutureEXT: {}", e.what());
@@ -1740,24 +2434,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPollFutureEXT(XrInstance instance, const XrFuturePollInfoEXT* pollInfo, XrFuturePollResultEXT* pollResult) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 470002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(pollInfo, 1, s_ctx);
-    serialize_ptr(pollResult, 1, s_ctx);
+    serialize_output_xr_ptr(pollResult, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1765,9 +2466,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrPollFutureEXT(XrInstance instance, const XrFutu
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&pollResult, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPollFutureEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPollFutureEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPollFutureEXT: {}", e.what());
@@ -1779,24 +2480,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateHandTrackerEXT(XrSession session, const XrHandTrackerCreateInfoEXT* createInfo, XrHandTrackerEXT* handTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 52001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(handTracker, 1, s_ctx);
+    serialize_output_ptr(handTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1804,70 +2512,128 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateHandTrackerEXT(XrSession session, const X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&handTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateHandTrackerEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateHandTrackerEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateHandTrackerEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyHandTrackerEXT(XrHandTrackerEXT handTracker) try {
+static XrResult oneway_xrDestroyHandTrackerEXT(XrHandTrackerEXT handTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 52002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&handTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyHandTrackerEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroyHandTrackerEXT(XrHandTrackerEXT handTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyHandTrackerEXT(handTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 52002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&handTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyHandTrackerEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyHandTrackerEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyHandTrackerEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateHandJointsEXT(XrHandTrackerEXT handTracker, const XrHandJointsLocateInfoEXT* locateInfo, XrHandJointLocationsEXT* locations) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyHandTrackerEXT(XrHandTrackerEXT handTracker) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroyHandTrackerEXT(handTracker);
+    }
+    return frame_loop->destroy_tracker(handTracker, unfused_xrDestroyHandTrackerEXT);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyHandTrackerEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unsampled_xrLocateHandJointsEXT(XrHandTrackerEXT handTracker, const XrHandJointsLocateInfoEXT* locateInfo, XrHandJointLocationsEXT* locations) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 52003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&handTracker, s_ctx);
     serialize_ptr(locateInfo, 1, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1875,9 +2641,46 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateHandJointsEXT(XrHandTrackerEXT handTracke
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateHandJointsEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateHandJointsEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateHandJointsEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateHandJointsEXT(XrHandTrackerEXT handTracker, const XrHandJointsLocateInfoEXT* locateInfo, XrHandJointLocationsEXT* locations) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !locateInfo) {
+        return unsampled_xrLocateHandJointsEXT(handTracker, locateInfo, locations);
+    }
+
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = locateInfo->time;
+    SampledCall call(52003);
+    SerializeContext call_ctx(call, time);
+    serialize(&handTracker, call_ctx);
+    serialize_ptr(locateInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_ptr(locations, 1, call_ctx);
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_xrLocateHandJointsEXT(handTracker, locateInfo, locations);
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_xrLocateHandJointsEXT(handTracker, locateInfo, locations);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&locations, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateHandJointsEXT: {}", e.what());
@@ -1886,36 +2689,77 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
 #ifdef XRTRANSPORT_EXT_XR_EXT_performance_settings
-XRAPI_ATTR XrResult XRAPI_CALL xrPerfSettingsSetPerformanceLevelEXT(XrSession session, XrPerfSettingsDomainEXT domain, XrPerfSettingsLevelEXT level) try {
+static XrResult oneway_xrPerfSettingsSetPerformanceLevelEXT(XrSession session, XrPerfSettingsDomainEXT domain, XrPerfSettingsLevelEXT level) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 16001;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize(&domain, s_ctx);
+    serialize(&level, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrPerfSettingsSetPerformanceLevelEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrPerfSettingsSetPerformanceLevelEXT(XrSession session, XrPerfSettingsDomainEXT domain, XrPerfSettingsLevelEXT level) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrPerfSettingsSetPerformanceLevelEXT(session, domain, level);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 16001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&domain, s_ctx);
     serialize(&level, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPerfSettingsSetPerformanceLevelEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPerfSettingsSetPerformanceLevelEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPerfSettingsSetPerformanceLevelEXT: {}", e.what());
@@ -1927,32 +2771,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrBeginPlaneDetectionEXT(XrPlaneDetectorEXT planeDetector, const XrPlaneDetectorBeginInfoEXT* beginInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 430001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&planeDetector, s_ctx);
     serialize_ptr(beginInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrBeginPlaneDetectionEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrBeginPlaneDetectionEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrBeginPlaneDetectionEXT: {}", e.what());
@@ -1962,24 +2813,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreatePlaneDetectorEXT(XrSession session, const XrPlaneDetectorCreateInfoEXT* createInfo, XrPlaneDetectorEXT* planeDetector) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 430002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(planeDetector, 1, s_ctx);
+    serialize_output_ptr(planeDetector, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -1987,43 +2845,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreatePlaneDetectorEXT(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&planeDetector, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreatePlaneDetectorEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreatePlaneDetectorEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreatePlaneDetectorEXT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPlaneDetectorEXT(XrPlaneDetectorEXT planeDetector) try {
+static XrResult oneway_xrDestroyPlaneDetectorEXT(XrPlaneDetectorEXT planeDetector) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 430003;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&planeDetector, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyPlaneDetectorEXT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPlaneDetectorEXT(XrPlaneDetectorEXT planeDetector) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyPlaneDetectorEXT(planeDetector);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 430003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&planeDetector, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyPlaneDetectorEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyPlaneDetectorEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyPlaneDetectorEXT: {}", e.what());
@@ -2033,23 +2930,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetPlaneDetectionStateEXT(XrPlaneDetectorEXT planeDetector, XrPlaneDetectionStateEXT* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 430004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&planeDetector, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2057,9 +2961,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetPlaneDetectionStateEXT(XrPlaneDetectorEXT pl
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetPlaneDetectionStateEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetPlaneDetectionStateEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetPlaneDetectionStateEXT: {}", e.what());
@@ -2069,24 +2973,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetPlaneDetectionsEXT(XrPlaneDetectorEXT planeDetector, const XrPlaneDetectorGetInfoEXT* info, XrPlaneDetectorLocationsEXT* locations) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 430005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&planeDetector, s_ctx);
     serialize_ptr(info, 1, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2094,9 +3005,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetPlaneDetectionsEXT(XrPlaneDetectorEXT planeD
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetPlaneDetectionsEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetPlaneDetectionsEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetPlaneDetectionsEXT: {}", e.what());
@@ -2106,25 +3017,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetPlanePolygonBufferEXT(XrPlaneDetectorEXT planeDetector, uint64_t planeId, uint32_t polygonBufferIndex, XrPlaneDetectorPolygonBufferEXT* polygonBuffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 430006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&planeDetector, s_ctx);
     serialize(&planeId, s_ctx);
     serialize(&polygonBufferIndex, s_ctx);
     serialize_ptr(polygonBuffer, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2132,9 +3050,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetPlanePolygonBufferEXT(XrPlaneDetectorEXT pla
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&polygonBuffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetPlanePolygonBufferEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetPlanePolygonBufferEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetPlanePolygonBufferEXT: {}", e.what());
@@ -2146,26 +3064,33 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrThermalGetTemperatureTrendEXT(XrSession session, XrPerfSettingsDomainEXT domain, XrPerfSettingsNotificationLevelEXT* notificationLevel, float* tempHeadroom, float* tempSlope) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 17001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&domain, s_ctx);
-    serialize_ptr(notificationLevel, 1, s_ctx);
-    serialize_ptr(tempHeadroom, 1, s_ctx);
-    serialize_ptr(tempSlope, 1, s_ctx);
+    serialize_output_ptr(notificationLevel, 1, s_ctx);
+    serialize_output_ptr(tempHeadroom, 1, s_ctx);
+    serialize_output_ptr(tempSlope, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2175,9 +3100,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrThermalGetTemperatureTrendEXT(XrSession session
     deserialize_ptr(&tempHeadroom, d_ctx);
     deserialize_ptr(&tempSlope, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrThermalGetTemperatureTrendEXT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrThermalGetTemperatureTrendEXT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrThermalGetTemperatureTrendEXT: {}", e.what());
@@ -2189,24 +3114,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateBodyTrackerFB(XrSession session, const XrBodyTrackerCreateInfoFB* createInfo, XrBodyTrackerFB* bodyTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 77001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(bodyTracker, 1, s_ctx);
+    serialize_output_ptr(bodyTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2214,43 +3146,94 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateBodyTrackerFB(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bodyTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateBodyTrackerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateBodyTrackerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateBodyTrackerFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyBodyTrackerFB(XrBodyTrackerFB bodyTracker) try {
+static XrResult oneway_xrDestroyBodyTrackerFB(XrBodyTrackerFB bodyTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 77002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&bodyTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyBodyTrackerFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroyBodyTrackerFB(XrBodyTrackerFB bodyTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyBodyTrackerFB(bodyTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 77002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyBodyTrackerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyBodyTrackerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyBodyTrackerFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyBodyTrackerFB(XrBodyTrackerFB bodyTracker) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroyBodyTrackerFB(bodyTracker);
+    }
+    return frame_loop->destroy_tracker(bodyTracker, unfused_xrDestroyBodyTrackerFB);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyBodyTrackerFB: {}", e.what());
@@ -2260,23 +3243,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetBodySkeletonFB(XrBodyTrackerFB bodyTracker, XrBodySkeletonFB* skeleton) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 77003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
     serialize_ptr(skeleton, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2284,36 +3274,43 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetBodySkeletonFB(XrBodyTrackerFB bodyTracker,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&skeleton, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetBodySkeletonFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetBodySkeletonFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetBodySkeletonFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsFB(XrBodyTrackerFB bodyTracker, const XrBodyJointsLocateInfoFB* locateInfo, XrBodyJointLocationsFB* locations) try {
+static XrResult unsampled_xrLocateBodyJointsFB(XrBodyTrackerFB bodyTracker, const XrBodyJointsLocateInfoFB* locateInfo, XrBodyJointLocationsFB* locations) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 77004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
     serialize_ptr(locateInfo, 1, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2321,50 +3318,110 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsFB(XrBodyTrackerFB bodyTracker,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateBodyJointsFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateBodyJointsFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateBodyJointsFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
-#ifdef XRTRANSPORT_EXT_XR_FB_color_space
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateColorSpacesFB(XrSession session, uint32_t colorSpaceCapacityInput, uint32_t* colorSpaceCountOutput, XrColorSpaceFB* colorSpaces) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsFB(XrBodyTrackerFB bodyTracker, const XrBodyJointsLocateInfoFB* locateInfo, XrBodyJointLocationsFB* locations) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !locateInfo) {
+        return unsampled_xrLocateBodyJointsFB(bodyTracker, locateInfo, locations);
+    }
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = locateInfo->time;
+    SampledCall call(77004);
+    SerializeContext call_ctx(call, time);
+    serialize(&bodyTracker, call_ctx);
+    serialize_ptr(locateInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_ptr(locations, 1, call_ctx);
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_xrLocateBodyJointsFB(bodyTracker, locateInfo, locations);
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_xrLocateBodyJointsFB(bodyTracker, locateInfo, locations);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&locations, d_ctx);
 
-    // start timer after synchronization
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateBodyJointsFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_color_space
+static XrResult uncached_xrEnumerateColorSpacesFB(XrSession session, uint32_t colorSpaceCapacityInput, uint32_t* colorSpaceCountOutput, XrColorSpaceFB* colorSpaces) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 109001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&colorSpaceCapacityInput, s_ctx);
-    serialize_ptr(colorSpaceCountOutput, 1, s_ctx);
-    serialize_ptr(colorSpaces, colorSpaceCapacityInput, s_ctx);
+    serialize_output_ptr(colorSpaceCountOutput, 1, s_ctx);
+    serialize_output_ptr(colorSpaces, colorSpaceCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&colorSpaceCountOutput, d_ctx);
-    deserialize_ptr(&colorSpaces, d_ctx);
+    deserialize_filled_ptr(colorSpaces, colorSpaceCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateColorSpacesFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateColorSpacesFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateColorSpacesFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateColorSpacesFB(XrSession session, uint32_t colorSpaceCapacityInput, uint32_t* colorSpaceCountOutput, XrColorSpaceFB* colorSpaces) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(109001);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+
+    return call_two_call(key, colorSpaceCapacityInput, colorSpaceCountOutput, colorSpaces, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrColorSpaceFB* elements) {
+            return uncached_xrEnumerateColorSpacesFB(session, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateColorSpacesFB: {}", e.what());
@@ -2374,32 +3431,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetColorSpaceFB(XrSession session, const XrColorSpaceFB colorSpace) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 109002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&colorSpace, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetColorSpaceFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetColorSpaceFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetColorSpaceFB: {}", e.what());
@@ -2408,65 +3472,95 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_FB_color_space
 #ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateDisplayRefreshRatesFB(XrSession session, uint32_t displayRefreshRateCapacityInput, uint32_t* displayRefreshRateCountOutput, float* displayRefreshRates) try {
+static XrResult uncached_xrEnumerateDisplayRefreshRatesFB(XrSession session, uint32_t displayRefreshRateCapacityInput, uint32_t* displayRefreshRateCountOutput, float* displayRefreshRates) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 102001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&displayRefreshRateCapacityInput, s_ctx);
-    serialize_ptr(displayRefreshRateCountOutput, 1, s_ctx);
-    serialize_ptr(displayRefreshRates, displayRefreshRateCapacityInput, s_ctx);
+    serialize_output_ptr(displayRefreshRateCountOutput, 1, s_ctx);
+    serialize_output_ptr(displayRefreshRates, displayRefreshRateCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&displayRefreshRateCountOutput, d_ctx);
-    deserialize_ptr(&displayRefreshRates, d_ctx);
+    deserialize_filled_ptr(displayRefreshRates, displayRefreshRateCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateDisplayRefreshRatesFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateDisplayRefreshRatesFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateDisplayRefreshRatesFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetDisplayRefreshRateFB(XrSession session, float* displayRefreshRate) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateDisplayRefreshRatesFB(XrSession session, uint32_t displayRefreshRateCapacityInput, uint32_t* displayRefreshRateCountOutput, float* displayRefreshRates) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(102001);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+
+    return call_two_call(key, displayRefreshRateCapacityInput, displayRefreshRateCountOutput, displayRefreshRates, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, float* elements) {
+            return uncached_xrEnumerateDisplayRefreshRatesFB(session, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateDisplayRefreshRatesFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unpacked_xrGetDisplayRefreshRateFB(XrSession session, float* displayRefreshRate) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 102002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
-    serialize_ptr(displayRefreshRate, 1, s_ctx);
+    serialize_output_ptr(displayRefreshRate, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2474,44 +3568,72 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetDisplayRefreshRateFB(XrSession session, floa
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&displayRefreshRate, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetDisplayRefreshRateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetDisplayRefreshRateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetDisplayRefreshRateFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrRequestDisplayRefreshRateFB(XrSession session, float displayRefreshRate) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrGetDisplayRefreshRateFB(XrSession session, float* displayRefreshRate) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!displayRefreshRate) {
+        return unpacked_xrGetDisplayRefreshRateFB(session, displayRefreshRate);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrGetDisplayRefreshRateFB _request{};
+    _request.session = session;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 102002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrGetDisplayRefreshRateFB _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    *displayRefreshRate = _response.displayRefreshRate;
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrGetDisplayRefreshRateFB");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetDisplayRefreshRateFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrRequestDisplayRefreshRateFB(XrSession session, float displayRefreshRate) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
     XrTime start_time = start_rpc_timer();
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrRequestDisplayRefreshRateFB _request{};
+    _request.session = session;
+    _request.displayRefreshRate = displayRefreshRate;
 
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
     uint32_t function_id = 102003;
-    serialize(&function_id, s_ctx);
-    serialize(&session, s_ctx);
-    serialize(&displayRefreshRate, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
     msg_out.flush();
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
-    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
-
-    XrResult result;
-    deserialize(&result, d_ctx);
-    XrDuration runtime_duration;
-    deserialize(&runtime_duration, d_ctx);
+    Response_xrRequestDisplayRefreshRateFB _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestDisplayRefreshRateFB");
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrRequestDisplayRefreshRateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(_response.result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestDisplayRefreshRateFB: {}", e.what());
@@ -2523,24 +3645,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateEyeTrackerFB(XrSession session, const XrEyeTrackerCreateInfoFB* createInfo, XrEyeTrackerFB* eyeTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 203001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(eyeTracker, 1, s_ctx);
+    serialize_output_ptr(eyeTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2548,70 +3677,128 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateEyeTrackerFB(XrSession session, const XrE
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&eyeTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateEyeTrackerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateEyeTrackerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateEyeTrackerFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyEyeTrackerFB(XrEyeTrackerFB eyeTracker) try {
+static XrResult oneway_xrDestroyEyeTrackerFB(XrEyeTrackerFB eyeTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 203002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&eyeTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyEyeTrackerFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroyEyeTrackerFB(XrEyeTrackerFB eyeTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyEyeTrackerFB(eyeTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 203002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&eyeTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyEyeTrackerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyEyeTrackerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyEyeTrackerFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetEyeGazesFB(XrEyeTrackerFB eyeTracker, const XrEyeGazesInfoFB* gazeInfo, XrEyeGazesFB* eyeGazes) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyEyeTrackerFB(XrEyeTrackerFB eyeTracker) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroyEyeTrackerFB(eyeTracker);
+    }
+    return frame_loop->destroy_tracker(eyeTracker, unfused_xrDestroyEyeTrackerFB);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyEyeTrackerFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unsampled_xrGetEyeGazesFB(XrEyeTrackerFB eyeTracker, const XrEyeGazesInfoFB* gazeInfo, XrEyeGazesFB* eyeGazes) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 203003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&eyeTracker, s_ctx);
     serialize_ptr(gazeInfo, 1, s_ctx);
-    serialize_ptr(eyeGazes, 1, s_ctx);
+    serialize_output_xr_ptr(eyeGazes, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2619,9 +3806,46 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetEyeGazesFB(XrEyeTrackerFB eyeTracker, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&eyeGazes, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetEyeGazesFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetEyeGazesFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetEyeGazesFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetEyeGazesFB(XrEyeTrackerFB eyeTracker, const XrEyeGazesInfoFB* gazeInfo, XrEyeGazesFB* eyeGazes) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !gazeInfo) {
+        return unsampled_xrGetEyeGazesFB(eyeTracker, gazeInfo, eyeGazes);
+    }
+
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = gazeInfo->time;
+    SampledCall call(203003);
+    SerializeContext call_ctx(call, time);
+    serialize(&eyeTracker, call_ctx);
+    serialize_ptr(gazeInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_output_xr_ptr(eyeGazes, 1, call_ctx);
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_xrGetEyeGazesFB(eyeTracker, gazeInfo, eyeGazes);
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_xrGetEyeGazesFB(eyeTracker, gazeInfo, eyeGazes);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&eyeGazes, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetEyeGazesFB: {}", e.what());
@@ -2633,24 +3857,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateFaceTrackerFB(XrSession session, const XrFaceTrackerCreateInfoFB* createInfo, XrFaceTrackerFB* faceTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 202001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(faceTracker, 1, s_ctx);
+    serialize_output_ptr(faceTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2658,43 +3889,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateFaceTrackerFB(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&faceTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateFaceTrackerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateFaceTrackerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateFaceTrackerFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFaceTrackerFB(XrFaceTrackerFB faceTracker) try {
+static XrResult oneway_xrDestroyFaceTrackerFB(XrFaceTrackerFB faceTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 202002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&faceTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyFaceTrackerFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // start timer after synchronization
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFaceTrackerFB(XrFaceTrackerFB faceTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyFaceTrackerFB(faceTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 202002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&faceTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyFaceTrackerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyFaceTrackerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyFaceTrackerFB: {}", e.what());
@@ -2704,24 +3974,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetFaceExpressionWeightsFB(XrFaceTrackerFB faceTracker, const XrFaceExpressionInfoFB* expressionInfo, XrFaceExpressionWeightsFB* expressionWeights) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 202003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&faceTracker, s_ctx);
     serialize_ptr(expressionInfo, 1, s_ctx);
     serialize_ptr(expressionWeights, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2729,9 +4006,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetFaceExpressionWeightsFB(XrFaceTrackerFB face
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&expressionWeights, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetFaceExpressionWeightsFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetFaceExpressionWeightsFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetFaceExpressionWeightsFB: {}", e.what());
@@ -2743,24 +4020,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateFaceTracker2FB(XrSession session, const XrFaceTrackerCreateInfo2FB* createInfo, XrFaceTracker2FB* faceTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 288001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(faceTracker, 1, s_ctx);
+    serialize_output_ptr(faceTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2769,70 +4053,128 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateFaceTracker2FB(XrSession session, const X
     deserialize_ptr(&createInfo->requestedDataSources, d_ctx);
     deserialize_ptr(&faceTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateFaceTracker2FB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateFaceTracker2FB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateFaceTracker2FB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFaceTracker2FB(XrFaceTracker2FB faceTracker) try {
+static XrResult oneway_xrDestroyFaceTracker2FB(XrFaceTracker2FB faceTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 288002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&faceTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyFaceTracker2FB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroyFaceTracker2FB(XrFaceTracker2FB faceTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyFaceTracker2FB(faceTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 288002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&faceTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyFaceTracker2FB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyFaceTracker2FB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyFaceTracker2FB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetFaceExpressionWeights2FB(XrFaceTracker2FB faceTracker, const XrFaceExpressionInfo2FB* expressionInfo, XrFaceExpressionWeights2FB* expressionWeights) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFaceTracker2FB(XrFaceTracker2FB faceTracker) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroyFaceTracker2FB(faceTracker);
+    }
+    return frame_loop->destroy_tracker(faceTracker, unfused_xrDestroyFaceTracker2FB);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyFaceTracker2FB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unsampled_xrGetFaceExpressionWeights2FB(XrFaceTracker2FB faceTracker, const XrFaceExpressionInfo2FB* expressionInfo, XrFaceExpressionWeights2FB* expressionWeights) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 288003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&faceTracker, s_ctx);
     serialize_ptr(expressionInfo, 1, s_ctx);
     serialize_ptr(expressionWeights, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2840,9 +4182,46 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetFaceExpressionWeights2FB(XrFaceTracker2FB fa
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&expressionWeights, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetFaceExpressionWeights2FB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetFaceExpressionWeights2FB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetFaceExpressionWeights2FB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetFaceExpressionWeights2FB(XrFaceTracker2FB faceTracker, const XrFaceExpressionInfo2FB* expressionInfo, XrFaceExpressionWeights2FB* expressionWeights) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !expressionInfo) {
+        return unsampled_xrGetFaceExpressionWeights2FB(faceTracker, expressionInfo, expressionWeights);
+    }
+
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = expressionInfo->time;
+    SampledCall call(288003);
+    SerializeContext call_ctx(call, time);
+    serialize(&faceTracker, call_ctx);
+    serialize_ptr(expressionInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_ptr(expressionWeights, 1, call_ctx);
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_xrGetFaceExpressionWeights2FB(faceTracker, expressionInfo, expressionWeights);
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_xrGetFaceExpressionWeights2FB(faceTracker, expressionInfo, expressionWeights);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&expressionWeights, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetFaceExpressionWeights2FB: {}", e.what());
@@ -2854,24 +4233,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateFoveationProfileFB(XrSession session, const XrFoveationProfileCreateInfoFB* createInfo, XrFoveationProfileFB* profile) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 115001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(profile, 1, s_ctx);
+    serialize_output_ptr(profile, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2880,43 +4266,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateFoveationProfileFB(XrSession session, con
     deserialize_xr(&createInfo->next, d_ctx);
     deserialize_ptr(&profile, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateFoveationProfileFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateFoveationProfileFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateFoveationProfileFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFoveationProfileFB(XrFoveationProfileFB profile) try {
+static XrResult oneway_xrDestroyFoveationProfileFB(XrFoveationProfileFB profile) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 115002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&profile, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyFoveationProfileFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFoveationProfileFB(XrFoveationProfileFB profile) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyFoveationProfileFB(profile);
+    }
 
-    // start timer after synchronization
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 115002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&profile, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyFoveationProfileFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyFoveationProfileFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyFoveationProfileFB: {}", e.what());
@@ -2928,23 +4353,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetHandMeshFB(XrHandTrackerEXT handTracker, XrHandTrackingMeshFB* mesh) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 111001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&handTracker, s_ctx);
     serialize_ptr(mesh, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2952,9 +4384,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetHandMeshFB(XrHandTrackerEXT handTracker, XrH
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&mesh, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetHandMeshFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetHandMeshFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetHandMeshFB: {}", e.what());
@@ -2966,24 +4398,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetDeviceSampleRateFB(XrSession session, const XrHapticActionInfo* hapticActionInfo, XrDevicePcmSampleRateGetInfoFB* deviceSampleRate) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 210001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(hapticActionInfo, 1, s_ctx);
-    serialize_ptr(deviceSampleRate, 1, s_ctx);
+    serialize_output_ptr(deviceSampleRate, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -2991,9 +4430,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetDeviceSampleRateFB(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&deviceSampleRate, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetDeviceSampleRateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetDeviceSampleRateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetDeviceSampleRateFB: {}", e.what());
@@ -3005,24 +4444,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateKeyboardSpaceFB(XrSession session, const XrKeyboardSpaceCreateInfoFB* createInfo, XrSpace* keyboardSpace) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 117001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(keyboardSpace, 1, s_ctx);
+    serialize_output_ptr(keyboardSpace, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3031,9 +4477,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateKeyboardSpaceFB(XrSession session, const
     deserialize_xr(&createInfo->next, d_ctx);
     deserialize_ptr(&keyboardSpace, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateKeyboardSpaceFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateKeyboardSpaceFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateKeyboardSpaceFB: {}", e.what());
@@ -3043,24 +4489,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQuerySystemTrackedKeyboardFB(XrSession session, const XrKeyboardTrackingQueryFB* queryInfo, XrKeyboardTrackingDescriptionFB* keyboard) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 117002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(queryInfo, 1, s_ctx);
-    serialize_ptr(keyboard, 1, s_ctx);
+    serialize_output_ptr(keyboard, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3069,9 +4522,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQuerySystemTrackedKeyboardFB(XrSession session,
     deserialize_xr(&queryInfo->next, d_ctx);
     deserialize_ptr(&keyboard, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQuerySystemTrackedKeyboardFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQuerySystemTrackedKeyboardFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQuerySystemTrackedKeyboardFB: {}", e.what());
@@ -3083,24 +4536,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateGeometryInstanceFB(XrSession session, const XrGeometryInstanceCreateInfoFB* createInfo, XrGeometryInstanceFB* outGeometryInstance) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(outGeometryInstance, 1, s_ctx);
+    serialize_output_ptr(outGeometryInstance, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3108,9 +4568,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateGeometryInstanceFB(XrSession session, con
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outGeometryInstance, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateGeometryInstanceFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateGeometryInstanceFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateGeometryInstanceFB: {}", e.what());
@@ -3120,24 +4580,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughFB(XrSession session, const XrPassthroughCreateInfoFB* createInfo, XrPassthroughFB* outPassthrough) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(outPassthrough, 1, s_ctx);
+    serialize_output_ptr(outPassthrough, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3145,9 +4612,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughFB(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outPassthrough, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreatePassthroughFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreatePassthroughFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreatePassthroughFB: {}", e.what());
@@ -3157,24 +4624,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughLayerFB(XrSession session, const XrPassthroughLayerCreateInfoFB* createInfo, XrPassthroughLayerFB* outLayer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(outLayer, 1, s_ctx);
+    serialize_output_ptr(outLayer, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3182,111 +4656,228 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughLayerFB(XrSession session, con
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outLayer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreatePassthroughLayerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreatePassthroughLayerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreatePassthroughLayerFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyGeometryInstanceFB(XrGeometryInstanceFB instance) try {
+static XrResult oneway_xrDestroyGeometryInstanceFB(XrGeometryInstanceFB instance) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
+    XrDuration time_offset = get_time_offset();
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
     uint32_t function_id = 119004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
-    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
-    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
-
-    XrResult result;
-    deserialize(&result, d_ctx);
-    XrDuration runtime_duration;
-    deserialize(&runtime_duration, d_ctx);
-
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyGeometryInstanceFB");
-
-    return result;
+    return XR_SUCCESS;
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyGeometryInstanceFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughFB(XrPassthroughFB passthrough) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyGeometryInstanceFB(XrGeometryInstanceFB instance) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyGeometryInstanceFB(instance);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 119004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&instance, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
+
+    XrResult result;
+    deserialize(&result, d_ctx);
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyGeometryInstanceFB");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyGeometryInstanceFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult oneway_xrDestroyPassthroughFB(XrPassthroughFB passthrough) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 119005;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&passthrough, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyPassthroughFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughFB(XrPassthroughFB passthrough) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyPassthroughFB(passthrough);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&passthrough, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyPassthroughFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyPassthroughFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyPassthroughFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughLayerFB(XrPassthroughLayerFB layer) try {
+static XrResult oneway_xrDestroyPassthroughLayerFB(XrPassthroughLayerFB layer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 119006;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&layer, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyPassthroughLayerFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughLayerFB(XrPassthroughLayerFB layer) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyPassthroughLayerFB(layer);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&layer, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyPassthroughLayerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyPassthroughLayerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyPassthroughLayerFB: {}", e.what());
@@ -3296,32 +4887,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGeometryInstanceSetTransformFB(XrGeometryInstanceFB instance, const XrGeometryInstanceTransformFB* transformation) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(transformation, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGeometryInstanceSetTransformFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGeometryInstanceSetTransformFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGeometryInstanceSetTransformFB: {}", e.what());
@@ -3331,31 +4929,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPassthroughLayerPauseFB(XrPassthroughLayerFB layer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&layer, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPassthroughLayerPauseFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPassthroughLayerPauseFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPassthroughLayerPauseFB: {}", e.what());
@@ -3365,31 +4970,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPassthroughLayerResumeFB(XrPassthroughLayerFB layer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&layer, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPassthroughLayerResumeFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPassthroughLayerResumeFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPassthroughLayerResumeFB: {}", e.what());
@@ -3399,32 +5011,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPassthroughLayerSetStyleFB(XrPassthroughLayerFB layer, const XrPassthroughStyleFB* style) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&layer, s_ctx);
     serialize_ptr(style, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPassthroughLayerSetStyleFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPassthroughLayerSetStyleFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPassthroughLayerSetStyleFB: {}", e.what());
@@ -3434,31 +5053,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPassthroughPauseFB(XrPassthroughFB passthrough) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119011;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&passthrough, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPassthroughPauseFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPassthroughPauseFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPassthroughPauseFB: {}", e.what());
@@ -3468,31 +5094,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPassthroughStartFB(XrPassthroughFB passthrough) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 119012;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&passthrough, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPassthroughStartFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPassthroughStartFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPassthroughStartFB: {}", e.what());
@@ -3504,32 +5137,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPassthroughLayerSetKeyboardHandsIntensityFB(XrPassthroughLayerFB layer, const XrPassthroughKeyboardHandsIntensityFB* intensity) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 204001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&layer, s_ctx);
     serialize_ptr(intensity, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPassthroughLayerSetKeyboardHandsIntensityFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPassthroughLayerSetKeyboardHandsIntensityFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPassthroughLayerSetKeyboardHandsIntensityFB: {}", e.what());
@@ -3538,39 +5178,62 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_FB_passthrough_keyboard_hands
 #ifdef XRTRANSPORT_EXT_XR_FB_render_model
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateRenderModelPathsFB(XrSession session, uint32_t pathCapacityInput, uint32_t* pathCountOutput, XrRenderModelPathInfoFB* paths) try {
+static XrResult uncached_xrEnumerateRenderModelPathsFB(XrSession session, uint32_t pathCapacityInput, uint32_t* pathCountOutput, XrRenderModelPathInfoFB* paths) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 120001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&pathCapacityInput, s_ctx);
-    serialize_ptr(pathCountOutput, 1, s_ctx);
-    serialize_ptr(paths, pathCapacityInput, s_ctx);
+    serialize_output_ptr(pathCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(paths, pathCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&pathCountOutput, d_ctx);
-    deserialize_ptr(&paths, d_ctx);
+    deserialize_filled_ptr(paths, pathCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateRenderModelPathsFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateRenderModelPathsFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateRenderModelPathsFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateRenderModelPathsFB(XrSession session, uint32_t pathCapacityInput, uint32_t* pathCountOutput, XrRenderModelPathInfoFB* paths) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(120001);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+
+    return call_two_call(key, pathCapacityInput, pathCountOutput, paths, XR_TYPE_RENDER_MODEL_PATH_INFO_FB,
+        [&](uint32_t capacity, uint32_t* count_output, XrRenderModelPathInfoFB* elements) {
+            return uncached_xrEnumerateRenderModelPathsFB(session, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateRenderModelPathsFB: {}", e.what());
@@ -3580,24 +5243,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetRenderModelPropertiesFB(XrSession session, XrPath path, XrRenderModelPropertiesFB* properties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 120002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&path, s_ctx);
-    serialize_ptr(properties, 1, s_ctx);
+    serialize_output_xr_ptr(properties, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3605,9 +5275,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetRenderModelPropertiesFB(XrSession session, X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&properties, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetRenderModelPropertiesFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetRenderModelPropertiesFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetRenderModelPropertiesFB: {}", e.what());
@@ -3617,24 +5287,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrLoadRenderModelFB(XrSession session, const XrRenderModelLoadInfoFB* info, XrRenderModelBufferFB* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 120003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3643,9 +5320,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLoadRenderModelFB(XrSession session, const XrRe
     deserialize_xr(&info->next, d_ctx);
     deserialize_ptr(&buffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLoadRenderModelFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLoadRenderModelFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLoadRenderModelFB: {}", e.what());
@@ -3657,24 +5334,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceBoundary2DFB(XrSession session, XrSpace space, XrBoundary2DFB* boundary2DOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 176001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&space, s_ctx);
     serialize_ptr(boundary2DOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3682,9 +5366,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceBoundary2DFB(XrSession session, XrSpace
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&boundary2DOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceBoundary2DFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceBoundary2DFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceBoundary2DFB: {}", e.what());
@@ -3694,24 +5378,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceBoundingBox2DFB(XrSession session, XrSpace space, XrRect2Df* boundingBox2DOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 176002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&space, s_ctx);
-    serialize_ptr(boundingBox2DOutput, 1, s_ctx);
+    serialize_output_ptr(boundingBox2DOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3719,9 +5410,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceBoundingBox2DFB(XrSession session, XrSp
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&boundingBox2DOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceBoundingBox2DFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceBoundingBox2DFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceBoundingBox2DFB: {}", e.what());
@@ -3731,24 +5422,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceBoundingBox3DFB(XrSession session, XrSpace space, XrRect3DfFB* boundingBox3DOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 176003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&space, s_ctx);
-    serialize_ptr(boundingBox3DOutput, 1, s_ctx);
+    serialize_output_ptr(boundingBox3DOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3756,9 +5454,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceBoundingBox3DFB(XrSession session, XrSp
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&boundingBox3DOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceBoundingBox3DFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceBoundingBox3DFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceBoundingBox3DFB: {}", e.what());
@@ -3768,24 +5466,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceRoomLayoutFB(XrSession session, XrSpace space, XrRoomLayoutFB* roomLayoutOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 176004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&space, s_ctx);
     serialize_ptr(roomLayoutOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3793,9 +5498,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceRoomLayoutFB(XrSession session, XrSpace
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&roomLayoutOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceRoomLayoutFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceRoomLayoutFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceRoomLayoutFB: {}", e.what());
@@ -3805,24 +5510,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceSemanticLabelsFB(XrSession session, XrSpace space, XrSemanticLabelsFB* semanticLabelsOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 176005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&space, s_ctx);
     serialize_ptr(semanticLabelsOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3830,9 +5542,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceSemanticLabelsFB(XrSession session, XrS
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&semanticLabelsOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceSemanticLabelsFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceSemanticLabelsFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceSemanticLabelsFB: {}", e.what());
@@ -3844,24 +5556,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRequestSceneCaptureFB(XrSession session, const XrSceneCaptureRequestInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 199001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3869,9 +5588,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrRequestSceneCaptureFB(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestSceneCaptureFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestSceneCaptureFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestSceneCaptureFB: {}", e.what());
@@ -3883,24 +5602,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorFB(XrSession session, const XrSpatialAnchorCreateInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 114001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3908,48 +5634,71 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorFB(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSpaceSupportedComponentsFB(XrSpace space, uint32_t componentTypeCapacityInput, uint32_t* componentTypeCountOutput, XrSpaceComponentTypeFB* componentTypes) try {
+static XrResult uncached_xrEnumerateSpaceSupportedComponentsFB(XrSpace space, uint32_t componentTypeCapacityInput, uint32_t* componentTypeCountOutput, XrSpaceComponentTypeFB* componentTypes) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 114002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
     serialize(&componentTypeCapacityInput, s_ctx);
-    serialize_ptr(componentTypeCountOutput, 1, s_ctx);
-    serialize_ptr(componentTypes, componentTypeCapacityInput, s_ctx);
+    serialize_output_ptr(componentTypeCountOutput, 1, s_ctx);
+    serialize_output_ptr(componentTypes, componentTypeCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&componentTypeCountOutput, d_ctx);
-    deserialize_ptr(&componentTypes, d_ctx);
+    deserialize_filled_ptr(componentTypes, componentTypeCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateSpaceSupportedComponentsFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateSpaceSupportedComponentsFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateSpaceSupportedComponentsFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSpaceSupportedComponentsFB(XrSpace space, uint32_t componentTypeCapacityInput, uint32_t* componentTypeCountOutput, XrSpaceComponentTypeFB* componentTypes) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(114002);
+    SerializeContext key_ctx(key);
+    serialize(&space, key_ctx);
+
+    return call_two_call(key, componentTypeCapacityInput, componentTypeCountOutput, componentTypes, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrSpaceComponentTypeFB* elements) {
+            return uncached_xrEnumerateSpaceSupportedComponentsFB(space, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateSpaceSupportedComponentsFB: {}", e.what());
@@ -3959,24 +5708,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceComponentStatusFB(XrSpace space, XrSpaceComponentTypeFB componentType, XrSpaceComponentStatusFB* status) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 114003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
     serialize(&componentType, s_ctx);
-    serialize_ptr(status, 1, s_ctx);
+    serialize_output_xr_ptr(status, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -3984,9 +5740,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceComponentStatusFB(XrSpace space, XrSpac
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&status, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceComponentStatusFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceComponentStatusFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceComponentStatusFB: {}", e.what());
@@ -3996,23 +5752,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceUuidFB(XrSpace space, XrUuidEXT* uuid) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 114004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
-    serialize_ptr(uuid, 1, s_ctx);
+    serialize_output_ptr(uuid, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4020,9 +5783,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceUuidFB(XrSpace space, XrUuidEXT* uuid)
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&uuid, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceUuidFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceUuidFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceUuidFB: {}", e.what());
@@ -4032,24 +5795,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetSpaceComponentStatusFB(XrSpace space, const XrSpaceComponentStatusSetInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 114005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4057,9 +5827,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrSetSpaceComponentStatusFB(XrSpace space, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetSpaceComponentStatusFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetSpaceComponentStatusFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetSpaceComponentStatusFB: {}", e.what());
@@ -4071,24 +5841,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceContainerFB(XrSession session, XrSpace space, XrSpaceContainerFB* spaceContainerOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 200001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&space, s_ctx);
     serialize_ptr(spaceContainerOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4096,9 +5873,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceContainerFB(XrSession session, XrSpace
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&spaceContainerOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceContainerFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceContainerFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceContainerFB: {}", e.what());
@@ -4110,24 +5887,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQuerySpacesFB(XrSession session, const XrSpaceQueryInfoBaseHeaderFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 157001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_xr(info, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4135,9 +5919,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQuerySpacesFB(XrSession session, const XrSpaceQ
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQuerySpacesFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQuerySpacesFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQuerySpacesFB: {}", e.what());
@@ -4147,24 +5931,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRetrieveSpaceQueryResultsFB(XrSession session, XrAsyncRequestIdFB requestId, XrSpaceQueryResultsFB* results) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 157002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&requestId, s_ctx);
     serialize_ptr(results, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4172,9 +5963,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrRetrieveSpaceQueryResultsFB(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&results, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRetrieveSpaceQueryResultsFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRetrieveSpaceQueryResultsFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRetrieveSpaceQueryResultsFB: {}", e.what());
@@ -4186,24 +5977,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrShareSpacesFB(XrSession session, const XrSpaceShareInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 170001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4213,9 +6011,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrShareSpacesFB(XrSession session, const XrSpaceS
     deserialize_ptr(&info->users, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrShareSpacesFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrShareSpacesFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrShareSpacesFB: {}", e.what());
@@ -4227,24 +6025,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrEraseSpaceFB(XrSession session, const XrSpaceEraseInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 159001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4252,9 +6057,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrEraseSpaceFB(XrSession session, const XrSpaceEr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEraseSpaceFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEraseSpaceFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEraseSpaceFB: {}", e.what());
@@ -4264,24 +6069,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSaveSpaceFB(XrSession session, const XrSpaceSaveInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 159002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4289,9 +6101,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrSaveSpaceFB(XrSession session, const XrSpaceSav
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSaveSpaceFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSaveSpaceFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSaveSpaceFB: {}", e.what());
@@ -4303,24 +6115,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSaveSpaceListFB(XrSession session, const XrSpaceListSaveInfoFB* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 239001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4329,9 +6148,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrSaveSpaceListFB(XrSession session, const XrSpac
     deserialize_ptr(&info->spaces, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSaveSpaceListFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSaveSpaceListFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSaveSpaceListFB: {}", e.what());
@@ -4343,24 +6162,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpaceUserFB(XrSession session, const XrSpaceUserCreateInfoFB* info, XrSpaceUserFB* user) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 242001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(user, 1, s_ctx);
+    serialize_output_ptr(user, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4368,43 +6194,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpaceUserFB(XrSession session, const XrSp
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&user, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpaceUserFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpaceUserFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpaceUserFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpaceUserFB(XrSpaceUserFB user) try {
+static XrResult oneway_xrDestroySpaceUserFB(XrSpaceUserFB user) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 242002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&user, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpaceUserFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpaceUserFB(XrSpaceUserFB user) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySpaceUserFB(user);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 242002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&user, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySpaceUserFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySpaceUserFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySpaceUserFB: {}", e.what());
@@ -4414,23 +6279,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceUserIdFB(XrSpaceUserFB user, XrSpaceUserIdFB* userId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 242003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&user, s_ctx);
-    serialize_ptr(userId, 1, s_ctx);
+    serialize_output_ptr(userId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4438,9 +6310,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceUserIdFB(XrSpaceUserFB user, XrSpaceUse
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&userId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceUserIdFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceUserIdFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceUserIdFB: {}", e.what());
@@ -4452,23 +6324,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSwapchainStateFB(XrSwapchain swapchain, XrSwapchainStateBaseHeaderFB* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 72001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize_xr(state, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4476,9 +6355,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSwapchainStateFB(XrSwapchain swapchain, XrSw
     deserialize(&runtime_duration, d_ctx);
     deserialize_xr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSwapchainStateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSwapchainStateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSwapchainStateFB: {}", e.what());
@@ -4488,32 +6367,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUpdateSwapchainFB(XrSwapchain swapchain, const XrSwapchainStateBaseHeaderFB* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 72002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize_xr(state, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUpdateSwapchainFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUpdateSwapchainFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUpdateSwapchainFB: {}", e.what());
@@ -4525,24 +6411,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateTriangleMeshFB(XrSession session, const XrTriangleMeshCreateInfoFB* createInfo, XrTriangleMeshFB* outTriangleMesh) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(outTriangleMesh, 1, s_ctx);
+    serialize_output_ptr(outTriangleMesh, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4550,43 +6443,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateTriangleMeshFB(XrSession session, const X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outTriangleMesh, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateTriangleMeshFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateTriangleMeshFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateTriangleMeshFB: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyTriangleMeshFB(XrTriangleMeshFB mesh) try {
+static XrResult oneway_xrDestroyTriangleMeshFB(XrTriangleMeshFB mesh) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 118002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&mesh, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyTriangleMeshFB: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyTriangleMeshFB(XrTriangleMeshFB mesh) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyTriangleMeshFB(mesh);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyTriangleMeshFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyTriangleMeshFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyTriangleMeshFB: {}", e.what());
@@ -4596,31 +6528,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshBeginUpdateFB(XrTriangleMeshFB mesh) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTriangleMeshBeginUpdateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTriangleMeshBeginUpdateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTriangleMeshBeginUpdateFB: {}", e.what());
@@ -4630,23 +6569,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshBeginVertexBufferUpdateFB(XrTriangleMeshFB mesh, uint32_t* outVertexCount) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
-    serialize_ptr(outVertexCount, 1, s_ctx);
+    serialize_output_ptr(outVertexCount, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4654,9 +6600,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshBeginVertexBufferUpdateFB(XrTriangl
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outVertexCount, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTriangleMeshBeginVertexBufferUpdateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTriangleMeshBeginVertexBufferUpdateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTriangleMeshBeginVertexBufferUpdateFB: {}", e.what());
@@ -4666,33 +6612,40 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshEndUpdateFB(XrTriangleMeshFB mesh, uint32_t vertexCount, uint32_t triangleCount) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
     serialize(&vertexCount, s_ctx);
     serialize(&triangleCount, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTriangleMeshEndUpdateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTriangleMeshEndUpdateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTriangleMeshEndUpdateFB: {}", e.what());
@@ -4702,31 +6655,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshEndVertexBufferUpdateFB(XrTriangleMeshFB mesh) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTriangleMeshEndVertexBufferUpdateFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTriangleMeshEndVertexBufferUpdateFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTriangleMeshEndVertexBufferUpdateFB: {}", e.what());
@@ -4736,23 +6696,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshGetIndexBufferFB(XrTriangleMeshFB mesh, uint32_t** outIndexBuffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
     #error "auto-generator doesn't support double pointers (outIndexBuffer)"None
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4760,9 +6727,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshGetIndexBufferFB(XrTriangleMeshFB m
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outIndexBuffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTriangleMeshGetIndexBufferFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTriangleMeshGetIndexBufferFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTriangleMeshGetIndexBufferFB: {}", e.what());
@@ -4772,23 +6739,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshGetVertexBufferFB(XrTriangleMeshFB mesh, XrVector3f** outVertexBuffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 118008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&mesh, s_ctx);
     #error "auto-generator doesn't support double pointers (outVertexBuffer)"None
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4796,9 +6770,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrTriangleMeshGetVertexBufferFB(XrTriangleMeshFB
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&outVertexBuffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTriangleMeshGetVertexBufferFB");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTriangleMeshGetVertexBufferFB");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTriangleMeshGetVertexBufferFB: {}", e.what());
@@ -4807,68 +6781,98 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_FB_triangle_mesh
 #ifdef XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateViveTrackerPathsHTCX(XrInstance instance, uint32_t pathCapacityInput, uint32_t* pathCountOutput, XrViveTrackerPathsHTCX* paths) try {
+static XrResult uncached_xrEnumerateViveTrackerPathsHTCX(XrInstance instance, uint32_t pathCapacityInput, uint32_t* pathCountOutput, XrViveTrackerPathsHTCX* paths) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 104001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&pathCapacityInput, s_ctx);
-    serialize_ptr(pathCountOutput, 1, s_ctx);
-    serialize_ptr(paths, pathCapacityInput, s_ctx);
+    serialize_output_ptr(pathCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(paths, pathCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&pathCountOutput, d_ctx);
-    deserialize_ptr(&paths, d_ctx);
+    deserialize_filled_ptr(paths, pathCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateViveTrackerPathsHTCX");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateViveTrackerPathsHTCX");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateViveTrackerPathsHTCX: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-#endif // XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
-#ifdef XRTRANSPORT_EXT_XR_HTC_anchor
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorHTC(XrSession session, const XrSpatialAnchorCreateInfoHTC* createInfo, XrSpace* anchor) try {
-    auto& transport = get_runtime().get_transport();
-
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateViveTrackerPathsHTCX(XrInstance instance, uint32_t pathCapacityInput, uint32_t* pathCountOutput, XrViveTrackerPathsHTCX* paths) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(104001);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
 
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
+    return call_two_call(key, pathCapacityInput, pathCountOutput, paths, XR_TYPE_VIVE_TRACKER_PATHS_HTCX,
+        [&](uint32_t capacity, uint32_t* count_output, XrViveTrackerPathsHTCX* elements) {
+            return uncached_xrEnumerateViveTrackerPathsHTCX(instance, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateViveTrackerPathsHTCX: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
+#ifdef XRTRANSPORT_EXT_XR_HTC_anchor
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorHTC(XrSession session, const XrSpatialAnchorCreateInfoHTC* createInfo, XrSpace* anchor) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 320001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(anchor, 1, s_ctx);
+    serialize_output_ptr(anchor, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4876,9 +6880,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorHTC(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&anchor, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorHTC: {}", e.what());
@@ -4888,23 +6892,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialAnchorNameHTC(XrSpace anchor, XrSpatialAnchorNameHTC* name) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 320002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&anchor, s_ctx);
-    serialize_ptr(name, 1, s_ctx);
+    serialize_output_ptr(name, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4912,9 +6923,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialAnchorNameHTC(XrSpace anchor, XrSpati
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&name, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpatialAnchorNameHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpatialAnchorNameHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpatialAnchorNameHTC: {}", e.what());
@@ -4926,24 +6937,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateBodyTrackerHTC(XrSession session, const XrBodyTrackerCreateInfoHTC* createInfo, XrBodyTrackerHTC* bodyTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 321001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(bodyTracker, 1, s_ctx);
+    serialize_output_ptr(bodyTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -4951,43 +6969,94 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateBodyTrackerHTC(XrSession session, const X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bodyTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateBodyTrackerHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateBodyTrackerHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateBodyTrackerHTC: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyBodyTrackerHTC(XrBodyTrackerHTC bodyTracker) try {
+static XrResult oneway_xrDestroyBodyTrackerHTC(XrBodyTrackerHTC bodyTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 321002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&bodyTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyBodyTrackerHTC: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroyBodyTrackerHTC(XrBodyTrackerHTC bodyTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyBodyTrackerHTC(bodyTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 321002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyBodyTrackerHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyBodyTrackerHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyBodyTrackerHTC: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyBodyTrackerHTC(XrBodyTrackerHTC bodyTracker) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroyBodyTrackerHTC(bodyTracker);
+    }
+    return frame_loop->destroy_tracker(bodyTracker, unfused_xrDestroyBodyTrackerHTC);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyBodyTrackerHTC: {}", e.what());
@@ -4997,25 +7066,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetBodySkeletonHTC(XrBodyTrackerHTC bodyTracker, XrSpace baseSpace, uint32_t skeletonGenerationId, XrBodySkeletonHTC* skeleton) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 321003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
     serialize(&baseSpace, s_ctx);
     serialize(&skeletonGenerationId, s_ctx);
     serialize_ptr(skeleton, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5023,36 +7099,43 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetBodySkeletonHTC(XrBodyTrackerHTC bodyTracker
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&skeleton, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetBodySkeletonHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetBodySkeletonHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetBodySkeletonHTC: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsHTC(XrBodyTrackerHTC bodyTracker, const XrBodyJointsLocateInfoHTC* locateInfo, XrBodyJointLocationsHTC* locations) try {
+static XrResult unsampled_xrLocateBodyJointsHTC(XrBodyTrackerHTC bodyTracker, const XrBodyJointsLocateInfoHTC* locateInfo, XrBodyJointLocationsHTC* locations) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 321004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&bodyTracker, s_ctx);
     serialize_ptr(locateInfo, 1, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5060,9 +7143,46 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsHTC(XrBodyTrackerHTC bodyTracke
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateBodyJointsHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateBodyJointsHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateBodyJointsHTC: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateBodyJointsHTC(XrBodyTrackerHTC bodyTracker, const XrBodyJointsLocateInfoHTC* locateInfo, XrBodyJointLocationsHTC* locations) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop || !frame_loop->samples_calls() || !locateInfo) {
+        return unsampled_xrLocateBodyJointsHTC(bodyTracker, locateInfo, locations);
+    }
+
+    // calls at the display time of a frame are answered from the samples taken with it, see frame_loop.h
+    XrTime time = locateInfo->time;
+    SampledCall call(321004);
+    SerializeContext call_ctx(call, time);
+    serialize(&bodyTracker, call_ctx);
+    serialize_ptr(locateInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_ptr(locations, 1, call_ctx);
+
+    QueryBuffer sample;
+    if (!frame_loop->take_sample(std::move(call), time, sample)) {
+        return unsampled_xrLocateBodyJointsHTC(bodyTracker, locateInfo, locations);
+    }
+    DeserializeContext d_ctx(sample, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the call is made again, so that the error is for this call
+        return unsampled_xrLocateBodyJointsHTC(bodyTracker, locateInfo, locations);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&locations, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateBodyJointsHTC: {}", e.what());
@@ -5074,24 +7194,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateFacialTrackerHTC(XrSession session, const XrFacialTrackerCreateInfoHTC* createInfo, XrFacialTrackerHTC* facialTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 105001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(facialTracker, 1, s_ctx);
+    serialize_output_ptr(facialTracker, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5099,43 +7226,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateFacialTrackerHTC(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&facialTracker, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateFacialTrackerHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateFacialTrackerHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateFacialTrackerHTC: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFacialTrackerHTC(XrFacialTrackerHTC facialTracker) try {
+static XrResult oneway_xrDestroyFacialTrackerHTC(XrFacialTrackerHTC facialTracker) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 105002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&facialTracker, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyFacialTrackerHTC: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFacialTrackerHTC(XrFacialTrackerHTC facialTracker) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyFacialTrackerHTC(facialTracker);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 105002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&facialTracker, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyFacialTrackerHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyFacialTrackerHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyFacialTrackerHTC: {}", e.what());
@@ -5145,23 +7311,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetFacialExpressionsHTC(XrFacialTrackerHTC facialTracker, XrFacialExpressionsHTC* facialExpressions) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 105003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&facialTracker, s_ctx);
     serialize_ptr(facialExpressions, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5169,9 +7342,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetFacialExpressionsHTC(XrFacialTrackerHTC faci
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&facialExpressions, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetFacialExpressionsHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetFacialExpressionsHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetFacialExpressionsHTC: {}", e.what());
@@ -5183,23 +7356,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrApplyFoveationHTC(XrSession session, const XrFoveationApplyInfoHTC* applyInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 319001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(applyInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5207,9 +7387,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrApplyFoveationHTC(XrSession session, const XrFo
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&applyInfo->subImages, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrApplyFoveationHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrApplyFoveationHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrApplyFoveationHTC: {}", e.what());
@@ -5221,24 +7401,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughHTC(XrSession session, const XrPassthroughCreateInfoHTC* createInfo, XrPassthroughHTC* passthrough) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 318001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(passthrough, 1, s_ctx);
+    serialize_output_ptr(passthrough, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5246,43 +7433,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughHTC(XrSession session, const X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&passthrough, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreatePassthroughHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreatePassthroughHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreatePassthroughHTC: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughHTC(XrPassthroughHTC passthrough) try {
+static XrResult oneway_xrDestroyPassthroughHTC(XrPassthroughHTC passthrough) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 318002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&passthrough, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyPassthroughHTC: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughHTC(XrPassthroughHTC passthrough) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyPassthroughHTC(passthrough);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 318002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&passthrough, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyPassthroughHTC");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyPassthroughHTC");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyPassthroughHTC: {}", e.what());
@@ -5294,24 +7520,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetD3D11GraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsD3D11KHR* graphicsRequirements) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 28001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
-    serialize_ptr(graphicsRequirements, 1, s_ctx);
+    serialize_output_xr_ptr(graphicsRequirements, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5319,9 +7552,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetD3D11GraphicsRequirementsKHR(XrInstance inst
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&graphicsRequirements, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetD3D11GraphicsRequirementsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetD3D11GraphicsRequirementsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetD3D11GraphicsRequirementsKHR: {}", e.what());
@@ -5333,24 +7566,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetD3D12GraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsD3D12KHR* graphicsRequirements) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 29001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
-    serialize_ptr(graphicsRequirements, 1, s_ctx);
+    serialize_output_xr_ptr(graphicsRequirements, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5358,9 +7598,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetD3D12GraphicsRequirementsKHR(XrInstance inst
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&graphicsRequirements, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetD3D12GraphicsRequirementsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetD3D12GraphicsRequirementsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetD3D12GraphicsRequirementsKHR: {}", e.what());
@@ -5372,25 +7612,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSwapchainAndroidSurfaceKHR(XrSession session, const XrSwapchainCreateInfo* info, XrSwapchain* swapchain, jobject* surface) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 5001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(swapchain, 1, s_ctx);
-    serialize_ptr(surface, 1, s_ctx);
+    serialize_output_ptr(swapchain, 1, s_ctx);
+    serialize_output_ptr(surface, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5399,9 +7646,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSwapchainAndroidSurfaceKHR(XrSession sess
     deserialize_ptr(&swapchain, d_ctx);
     deserialize_ptr(&surface, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSwapchainAndroidSurfaceKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSwapchainAndroidSurfaceKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSwapchainAndroidSurfaceKHR: {}", e.what());
@@ -5413,33 +7660,40 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetAndroidApplicationThreadKHR(XrSession session, XrAndroidThreadTypeKHR threadType, uint32_t threadId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 4001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&threadType, s_ctx);
     serialize(&threadId, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetAndroidApplicationThreadKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetAndroidApplicationThreadKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetAndroidApplicationThreadKHR: {}", e.what());
@@ -5451,24 +7705,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrConvertTimeToTimespecTimeKHR(XrInstance instance, XrTime time, struct timespec* timespecTime) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 37001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_time(&time, s_ctx);
-    serialize_ptr(timespecTime, 1, s_ctx);
+    serialize_output_ptr(timespecTime, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5476,9 +7737,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrConvertTimeToTimespecTimeKHR(XrInstance instanc
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&timespecTime, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrConvertTimeToTimespecTimeKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrConvertTimeToTimespecTimeKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrConvertTimeToTimespecTimeKHR: {}", e.what());
@@ -5488,24 +7749,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrConvertTimespecTimeToTimeKHR(XrInstance instance, const struct timespec* timespecTime, XrTime* time) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 37002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(timespecTime, 1, s_ctx);
-    serialize_ptr(time, 1, s_ctx);
+    serialize_output_ptr(time, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5514,9 +7782,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrConvertTimespecTimeToTimeKHR(XrInstance instanc
     deserialize_ptr(&timespecTime, d_ctx);
     deserialize_ptr(&time, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrConvertTimespecTimeToTimeKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrConvertTimespecTimeToTimeKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrConvertTimespecTimeToTimeKHR: {}", e.what());
@@ -5528,34 +7796,41 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStructureTypeToString2KHR(XrInstance instance, XrStructureType value, char buffer[XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR]) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 149001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&value, s_ctx);
-    serialize_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, s_ctx);
+    serialize_string_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStructureTypeToString2KHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStructureTypeToString2KHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStructureTypeToString2KHR: {}", e.what());
@@ -5567,31 +7842,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrInitializeLoaderKHR(const XrLoaderInitInfoBaseHeaderKHR* loaderInitInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 89001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize_xr(loaderInitInfo, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrInitializeLoaderKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrInitializeLoaderKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrInitializeLoaderKHR: {}", e.what());
@@ -5603,24 +7885,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMetalGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsMetalKHR* graphicsRequirements) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 30001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5628,9 +7917,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetMetalGraphicsRequirementsKHR(XrInstance inst
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&graphicsRequirements, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMetalGraphicsRequirementsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMetalGraphicsRequirementsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMetalGraphicsRequirementsKHR: {}", e.what());
@@ -5642,24 +7931,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetOpenGLGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsOpenGLKHR* graphicsRequirements) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 24001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
-    serialize_ptr(graphicsRequirements, 1, s_ctx);
+    serialize_output_xr_ptr(graphicsRequirements, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5667,9 +7963,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetOpenGLGraphicsRequirementsKHR(XrInstance ins
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&graphicsRequirements, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetOpenGLGraphicsRequirementsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetOpenGLGraphicsRequirementsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetOpenGLGraphicsRequirementsKHR: {}", e.what());
@@ -5681,24 +7977,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetOpenGLESGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsOpenGLESKHR* graphicsRequirements) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 25001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
-    serialize_ptr(graphicsRequirements, 1, s_ctx);
+    serialize_output_xr_ptr(graphicsRequirements, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5706,9 +8009,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetOpenGLESGraphicsRequirementsKHR(XrInstance i
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&graphicsRequirements, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetOpenGLESGraphicsRequirementsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetOpenGLESGraphicsRequirementsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetOpenGLESGraphicsRequirementsKHR: {}", e.what());
@@ -5720,26 +8023,33 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVisibilityMaskKHR(XrSession session, XrViewConfigurationType viewConfigurationType, uint32_t viewIndex, XrVisibilityMaskTypeKHR visibilityMaskType, XrVisibilityMaskKHR* visibilityMask) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 32001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&viewConfigurationType, s_ctx);
     serialize(&viewIndex, s_ctx);
     serialize(&visibilityMaskType, s_ctx);
     serialize_ptr(visibilityMask, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5747,9 +8057,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVisibilityMaskKHR(XrSession session, XrViewC
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&visibilityMask, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVisibilityMaskKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVisibilityMaskKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVisibilityMaskKHR: {}", e.what());
@@ -5761,37 +8071,44 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanDeviceExtensionsKHR(XrInstance instance, XrSystemId systemId, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 26001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVulkanDeviceExtensionsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVulkanDeviceExtensionsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVulkanDeviceExtensionsKHR: {}", e.what());
@@ -5801,25 +8118,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsDeviceKHR(XrInstance instance, XrSystemId systemId, VkInstance vkInstance, VkPhysicalDevice* vkPhysicalDevice) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 26002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&vkInstance, s_ctx);
-    serialize_ptr(vkPhysicalDevice, 1, s_ctx);
+    serialize_output_ptr(vkPhysicalDevice, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5827,36 +8151,43 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsDeviceKHR(XrInstance instance,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&vkPhysicalDevice, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVulkanGraphicsDeviceKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVulkanGraphicsDeviceKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVulkanGraphicsDeviceKHR: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsVulkanKHR* graphicsRequirements) try {
+static XrResult fetch_xrGetVulkanGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsVulkanKHR* graphicsRequirements) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 26003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
-    serialize_ptr(graphicsRequirements, 1, s_ctx);
+    serialize_output_xr_ptr(graphicsRequirements, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5864,8 +8195,42 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsRequirementsKHR(XrInstance ins
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&graphicsRequirements, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVulkanGraphicsRequirementsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVulkanGraphicsRequirementsKHR");
 
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetVulkanGraphicsRequirementsKHR: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsRequirementsKHR(XrInstance instance, XrSystemId systemId, XrGraphicsRequirementsVulkanKHR* graphicsRequirements) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrGetVulkanGraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
+    }
+
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 26003);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize_output_xr_ptr(graphicsRequirements, 1, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&graphicsRequirements, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
+
+    result = fetch_xrGetVulkanGraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(graphicsRequirements, 1, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -5876,37 +8241,44 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanInstanceExtensionsKHR(XrInstance instance, XrSystemId systemId, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 26004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVulkanInstanceExtensionsKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVulkanInstanceExtensionsKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVulkanInstanceExtensionsKHR: {}", e.what());
@@ -5918,25 +8290,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateVulkanDeviceKHR(XrInstance instance, const XrVulkanDeviceCreateInfoKHR* createInfo, VkDevice* vulkanDevice, VkResult* vulkanResult) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 91001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(vulkanDevice, 1, s_ctx);
-    serialize_ptr(vulkanResult, 1, s_ctx);
+    serialize_output_ptr(vulkanDevice, 1, s_ctx);
+    serialize_output_ptr(vulkanResult, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5945,9 +8324,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateVulkanDeviceKHR(XrInstance instance, cons
     deserialize_ptr(&vulkanDevice, d_ctx);
     deserialize_ptr(&vulkanResult, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateVulkanDeviceKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateVulkanDeviceKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateVulkanDeviceKHR: {}", e.what());
@@ -5957,25 +8336,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateVulkanInstanceKHR(XrInstance instance, const XrVulkanInstanceCreateInfoKHR* createInfo, VkInstance* vulkanInstance, VkResult* vulkanResult) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 91002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(vulkanInstance, 1, s_ctx);
-    serialize_ptr(vulkanResult, 1, s_ctx);
+    serialize_output_ptr(vulkanInstance, 1, s_ctx);
+    serialize_output_ptr(vulkanResult, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -5984,9 +8370,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateVulkanInstanceKHR(XrInstance instance, co
     deserialize_ptr(&vulkanInstance, d_ctx);
     deserialize_ptr(&vulkanResult, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateVulkanInstanceKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateVulkanInstanceKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateVulkanInstanceKHR: {}", e.what());
@@ -5996,24 +8382,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsDevice2KHR(XrInstance instance, const XrVulkanGraphicsDeviceGetInfoKHR* getInfo, VkPhysicalDevice* vulkanPhysicalDevice) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 91003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(vulkanPhysicalDevice, 1, s_ctx);
+    serialize_output_ptr(vulkanPhysicalDevice, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6021,9 +8414,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVulkanGraphicsDevice2KHR(XrInstance instance
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&vulkanPhysicalDevice, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVulkanGraphicsDevice2KHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVulkanGraphicsDevice2KHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVulkanGraphicsDevice2KHR: {}", e.what());
@@ -6035,24 +8428,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrConvertTimeToWin32PerformanceCounterKHR(XrInstance instance, XrTime time, LARGE_INTEGER* performanceCounter) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 36001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_time(&time, s_ctx);
-    serialize_ptr(performanceCounter, 1, s_ctx);
+    serialize_output_ptr(performanceCounter, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6060,9 +8460,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrConvertTimeToWin32PerformanceCounterKHR(XrInsta
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&performanceCounter, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrConvertTimeToWin32PerformanceCounterKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrConvertTimeToWin32PerformanceCounterKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrConvertTimeToWin32PerformanceCounterKHR: {}", e.what());
@@ -6072,24 +8472,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrConvertWin32PerformanceCounterToTimeKHR(XrInstance instance, const LARGE_INTEGER* performanceCounter, XrTime* time) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 36002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(performanceCounter, 1, s_ctx);
-    serialize_ptr(time, 1, s_ctx);
+    serialize_output_ptr(time, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6097,9 +8504,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrConvertWin32PerformanceCounterToTimeKHR(XrInsta
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&time, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrConvertWin32PerformanceCounterToTimeKHR");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrConvertWin32PerformanceCounterToTimeKHR");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrConvertWin32PerformanceCounterToTimeKHR: {}", e.what());
@@ -6111,24 +8518,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStartColocationAdvertisementMETA(XrSession session, const XrColocationAdvertisementStartInfoMETA* info, XrAsyncRequestIdFB* advertisementRequestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 572001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(advertisementRequestId, 1, s_ctx);
+    serialize_output_ptr(advertisementRequestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6137,9 +8551,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStartColocationAdvertisementMETA(XrSession sess
     deserialize_ptr(&info->buffer, d_ctx);
     deserialize_ptr(&advertisementRequestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStartColocationAdvertisementMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStartColocationAdvertisementMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStartColocationAdvertisementMETA: {}", e.what());
@@ -6149,24 +8563,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStartColocationDiscoveryMETA(XrSession session, const XrColocationDiscoveryStartInfoMETA* info, XrAsyncRequestIdFB* discoveryRequestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 572002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(discoveryRequestId, 1, s_ctx);
+    serialize_output_ptr(discoveryRequestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6174,9 +8595,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStartColocationDiscoveryMETA(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&discoveryRequestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStartColocationDiscoveryMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStartColocationDiscoveryMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStartColocationDiscoveryMETA: {}", e.what());
@@ -6186,24 +8607,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStopColocationAdvertisementMETA(XrSession session, const XrColocationAdvertisementStopInfoMETA* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 572003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6211,9 +8639,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStopColocationAdvertisementMETA(XrSession sessi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStopColocationAdvertisementMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStopColocationAdvertisementMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStopColocationAdvertisementMETA: {}", e.what());
@@ -6223,24 +8651,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStopColocationDiscoveryMETA(XrSession session, const XrColocationDiscoveryStopInfoMETA* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 572004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6248,9 +8683,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStopColocationDiscoveryMETA(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStopColocationDiscoveryMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStopColocationDiscoveryMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStopColocationDiscoveryMETA: {}", e.what());
@@ -6262,24 +8697,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrAcquireEnvironmentDepthImageMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider, const XrEnvironmentDepthImageAcquireInfoMETA* acquireInfo, XrEnvironmentDepthImageMETA* environmentDepthImage) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&environmentDepthProvider, s_ctx);
     serialize_ptr(acquireInfo, 1, s_ctx);
-    serialize_ptr(environmentDepthImage, 1, s_ctx);
+    serialize_output_xr_ptr(environmentDepthImage, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6287,9 +8729,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrAcquireEnvironmentDepthImageMETA(XrEnvironmentD
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&environmentDepthImage, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrAcquireEnvironmentDepthImageMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrAcquireEnvironmentDepthImageMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrAcquireEnvironmentDepthImageMETA: {}", e.what());
@@ -6299,24 +8741,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateEnvironmentDepthProviderMETA(XrSession session, const XrEnvironmentDepthProviderCreateInfoMETA* createInfo, XrEnvironmentDepthProviderMETA* environmentDepthProvider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(environmentDepthProvider, 1, s_ctx);
+    serialize_output_ptr(environmentDepthProvider, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6324,9 +8773,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateEnvironmentDepthProviderMETA(XrSession se
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&environmentDepthProvider, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateEnvironmentDepthProviderMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateEnvironmentDepthProviderMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateEnvironmentDepthProviderMETA: {}", e.what());
@@ -6336,24 +8785,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateEnvironmentDepthSwapchainMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider, const XrEnvironmentDepthSwapchainCreateInfoMETA* createInfo, XrEnvironmentDepthSwapchainMETA* swapchain) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&environmentDepthProvider, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(swapchain, 1, s_ctx);
+    serialize_output_ptr(swapchain, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6361,77 +8817,155 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateEnvironmentDepthSwapchainMETA(XrEnvironme
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&swapchain, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateEnvironmentDepthSwapchainMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateEnvironmentDepthSwapchainMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateEnvironmentDepthSwapchainMETA: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyEnvironmentDepthProviderMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider) try {
+static XrResult oneway_xrDestroyEnvironmentDepthProviderMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 292004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&environmentDepthProvider, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyEnvironmentDepthProviderMETA: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyEnvironmentDepthProviderMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyEnvironmentDepthProviderMETA(environmentDepthProvider);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&environmentDepthProvider, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyEnvironmentDepthProviderMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyEnvironmentDepthProviderMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyEnvironmentDepthProviderMETA: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyEnvironmentDepthSwapchainMETA(XrEnvironmentDepthSwapchainMETA swapchain) try {
+static XrResult oneway_xrDestroyEnvironmentDepthSwapchainMETA(XrEnvironmentDepthSwapchainMETA swapchain) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
+    XrDuration time_offset = get_time_offset();
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
     uint32_t function_id = 292005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
-    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
-    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyEnvironmentDepthSwapchainMETA: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyEnvironmentDepthSwapchainMETA(XrEnvironmentDepthSwapchainMETA swapchain) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyEnvironmentDepthSwapchainMETA(swapchain);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 292005;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&swapchain, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyEnvironmentDepthSwapchainMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyEnvironmentDepthSwapchainMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyEnvironmentDepthSwapchainMETA: {}", e.what());
@@ -6441,36 +8975,43 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateEnvironmentDepthSwapchainImagesMETA(XrEnvironmentDepthSwapchainMETA swapchain, uint32_t imageCapacityInput, uint32_t* imageCountOutput, XrSwapchainImageBaseHeader* images) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize(&imageCapacityInput, s_ctx);
-    serialize_ptr(imageCountOutput, 1, s_ctx);
+    serialize_output_ptr(imageCountOutput, 1, s_ctx);
     serialize_xr_array(images, imageCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&imageCountOutput, d_ctx);
-    deserialize_xr_array(&images, d_ctx);
+    deserialize_filled_xr_array(images, imageCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateEnvironmentDepthSwapchainImagesMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateEnvironmentDepthSwapchainImagesMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateEnvironmentDepthSwapchainImagesMETA: {}", e.what());
@@ -6480,23 +9021,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetEnvironmentDepthSwapchainStateMETA(XrEnvironmentDepthSwapchainMETA swapchain, XrEnvironmentDepthSwapchainStateMETA* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6504,9 +9052,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetEnvironmentDepthSwapchainStateMETA(XrEnviron
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetEnvironmentDepthSwapchainStateMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetEnvironmentDepthSwapchainStateMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetEnvironmentDepthSwapchainStateMETA: {}", e.what());
@@ -6516,32 +9064,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetEnvironmentDepthHandRemovalMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider, const XrEnvironmentDepthHandRemovalSetInfoMETA* setInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&environmentDepthProvider, s_ctx);
     serialize_ptr(setInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetEnvironmentDepthHandRemovalMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetEnvironmentDepthHandRemovalMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetEnvironmentDepthHandRemovalMETA: {}", e.what());
@@ -6551,31 +9106,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStartEnvironmentDepthProviderMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&environmentDepthProvider, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStartEnvironmentDepthProviderMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStartEnvironmentDepthProviderMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStartEnvironmentDepthProviderMETA: {}", e.what());
@@ -6585,31 +9147,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStopEnvironmentDepthProviderMETA(XrEnvironmentDepthProviderMETA environmentDepthProvider) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 292010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&environmentDepthProvider, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStopEnvironmentDepthProviderMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStopEnvironmentDepthProviderMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStopEnvironmentDepthProviderMETA: {}", e.what());
@@ -6621,23 +9190,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetFoveationEyeTrackedStateMETA(XrSession session, XrFoveationEyeTrackedStateMETA* foveationState) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 201001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
-    serialize_ptr(foveationState, 1, s_ctx);
+    serialize_output_xr_ptr(foveationState, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6645,9 +9221,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetFoveationEyeTrackedStateMETA(XrSession sessi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&foveationState, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetFoveationEyeTrackedStateMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetFoveationEyeTrackedStateMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetFoveationEyeTrackedStateMETA: {}", e.what());
@@ -6659,24 +9235,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughColorLutMETA(XrPassthroughFB passthrough, const XrPassthroughColorLutCreateInfoMETA* createInfo, XrPassthroughColorLutMETA* colorLut) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 267001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&passthrough, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(colorLut, 1, s_ctx);
+    serialize_output_ptr(colorLut, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6684,43 +9267,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreatePassthroughColorLutMETA(XrPassthroughFB p
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&colorLut, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreatePassthroughColorLutMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreatePassthroughColorLutMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreatePassthroughColorLutMETA: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughColorLutMETA(XrPassthroughColorLutMETA colorLut) try {
+static XrResult oneway_xrDestroyPassthroughColorLutMETA(XrPassthroughColorLutMETA colorLut) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 267002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&colorLut, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyPassthroughColorLutMETA: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyPassthroughColorLutMETA(XrPassthroughColorLutMETA colorLut) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyPassthroughColorLutMETA(colorLut);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 267002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&colorLut, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyPassthroughColorLutMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyPassthroughColorLutMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyPassthroughColorLutMETA: {}", e.what());
@@ -6730,32 +9352,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUpdatePassthroughColorLutMETA(XrPassthroughColorLutMETA colorLut, const XrPassthroughColorLutUpdateInfoMETA* updateInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 267003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&colorLut, s_ctx);
     serialize_ptr(updateInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUpdatePassthroughColorLutMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUpdatePassthroughColorLutMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUpdatePassthroughColorLutMETA: {}", e.what());
@@ -6767,23 +9396,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetPassthroughPreferencesMETA(XrSession session, XrPassthroughPreferencesMETA* preferences) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 218001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
-    serialize_ptr(preferences, 1, s_ctx);
+    serialize_output_xr_ptr(preferences, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6791,9 +9427,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetPassthroughPreferencesMETA(XrSession session
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&preferences, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetPassthroughPreferencesMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetPassthroughPreferencesMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetPassthroughPreferencesMETA: {}", e.what());
@@ -6802,39 +9438,62 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_META_passthrough_preferences
 #ifdef XRTRANSPORT_EXT_XR_META_performance_metrics
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumeratePerformanceMetricsCounterPathsMETA(XrInstance instance, uint32_t counterPathCapacityInput, uint32_t* counterPathCountOutput, XrPath* counterPaths) try {
+static XrResult uncached_xrEnumeratePerformanceMetricsCounterPathsMETA(XrInstance instance, uint32_t counterPathCapacityInput, uint32_t* counterPathCountOutput, XrPath* counterPaths) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 233001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&counterPathCapacityInput, s_ctx);
-    serialize_ptr(counterPathCountOutput, 1, s_ctx);
-    serialize_ptr(counterPaths, counterPathCapacityInput, s_ctx);
+    serialize_output_ptr(counterPathCountOutput, 1, s_ctx);
+    serialize_output_ptr(counterPaths, counterPathCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&counterPathCountOutput, d_ctx);
-    deserialize_ptr(&counterPaths, d_ctx);
+    deserialize_filled_ptr(counterPaths, counterPathCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumeratePerformanceMetricsCounterPathsMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumeratePerformanceMetricsCounterPathsMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumeratePerformanceMetricsCounterPathsMETA: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumeratePerformanceMetricsCounterPathsMETA(XrInstance instance, uint32_t counterPathCapacityInput, uint32_t* counterPathCountOutput, XrPath* counterPaths) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(233001);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+
+    return call_two_call(key, counterPathCapacityInput, counterPathCountOutput, counterPaths, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrPath* elements) {
+            return uncached_xrEnumeratePerformanceMetricsCounterPathsMETA(instance, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumeratePerformanceMetricsCounterPathsMETA: {}", e.what());
@@ -6844,23 +9503,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetPerformanceMetricsStateMETA(XrSession session, XrPerformanceMetricsStateMETA* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 233002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6868,9 +9534,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetPerformanceMetricsStateMETA(XrSession sessio
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetPerformanceMetricsStateMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetPerformanceMetricsStateMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetPerformanceMetricsStateMETA: {}", e.what());
@@ -6880,24 +9546,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQueryPerformanceMetricsCounterMETA(XrSession session, XrPath counterPath, XrPerformanceMetricsCounterMETA* counter) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 233003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&counterPath, s_ctx);
-    serialize_ptr(counter, 1, s_ctx);
+    serialize_output_xr_ptr(counter, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6905,9 +9578,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQueryPerformanceMetricsCounterMETA(XrSession se
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&counter, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQueryPerformanceMetricsCounterMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQueryPerformanceMetricsCounterMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQueryPerformanceMetricsCounterMETA: {}", e.what());
@@ -6917,32 +9590,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetPerformanceMetricsStateMETA(XrSession session, const XrPerformanceMetricsStateMETA* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 233004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetPerformanceMetricsStateMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetPerformanceMetricsStateMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetPerformanceMetricsStateMETA: {}", e.what());
@@ -6954,24 +9634,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetRecommendedLayerResolutionMETA(XrSession session, const XrRecommendedLayerResolutionGetInfoMETA* info, XrRecommendedLayerResolutionMETA* resolution) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 255001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(resolution, 1, s_ctx);
+    serialize_output_xr_ptr(resolution, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -6979,9 +9666,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetRecommendedLayerResolutionMETA(XrSession ses
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&resolution, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetRecommendedLayerResolutionMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetRecommendedLayerResolutionMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetRecommendedLayerResolutionMETA: {}", e.what());
@@ -6993,32 +9680,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPauseSimultaneousHandsAndControllersTrackingMETA(XrSession session, const XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* pauseInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 533001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(pauseInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPauseSimultaneousHandsAndControllersTrackingMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPauseSimultaneousHandsAndControllersTrackingMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPauseSimultaneousHandsAndControllersTrackingMETA: {}", e.what());
@@ -7028,32 +9722,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrResumeSimultaneousHandsAndControllersTrackingMETA(XrSession session, const XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* resumeInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 533002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(resumeInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrResumeSimultaneousHandsAndControllersTrackingMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrResumeSimultaneousHandsAndControllersTrackingMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrResumeSimultaneousHandsAndControllersTrackingMETA: {}", e.what());
@@ -7065,24 +9766,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceTriangleMeshMETA(XrSpace space, const XrSpaceTriangleMeshGetInfoMETA* getInfo, XrSpaceTriangleMeshMETA* triangleMeshOutput) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 270001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize_ptr(triangleMeshOutput, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7090,9 +9798,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpaceTriangleMeshMETA(XrSpace space, const X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&triangleMeshOutput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpaceTriangleMeshMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpaceTriangleMeshMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpaceTriangleMeshMETA: {}", e.what());
@@ -7104,24 +9812,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrShareSpacesMETA(XrSession session, const XrShareSpacesInfoMETA* info, XrAsyncRequestIdFB* requestId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 291001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(requestId, 1, s_ctx);
+    serialize_output_ptr(requestId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7130,9 +9845,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrShareSpacesMETA(XrSession session, const XrShar
     deserialize_ptr(&info->spaces, d_ctx);
     deserialize_ptr(&requestId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrShareSpacesMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrShareSpacesMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrShareSpacesMETA: {}", e.what());
@@ -7144,32 +9859,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrChangeVirtualKeyboardTextContextMETA(XrVirtualKeyboardMETA keyboard, const XrVirtualKeyboardTextContextChangeInfoMETA* changeInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize_ptr(changeInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrChangeVirtualKeyboardTextContextMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrChangeVirtualKeyboardTextContextMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrChangeVirtualKeyboardTextContextMETA: {}", e.what());
@@ -7179,24 +9901,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateVirtualKeyboardMETA(XrSession session, const XrVirtualKeyboardCreateInfoMETA* createInfo, XrVirtualKeyboardMETA* keyboard) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(keyboard, 1, s_ctx);
+    serialize_output_ptr(keyboard, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7204,9 +9933,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateVirtualKeyboardMETA(XrSession session, co
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&keyboard, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateVirtualKeyboardMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateVirtualKeyboardMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateVirtualKeyboardMETA: {}", e.what());
@@ -7216,25 +9945,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateVirtualKeyboardSpaceMETA(XrSession session, XrVirtualKeyboardMETA keyboard, const XrVirtualKeyboardSpaceCreateInfoMETA* createInfo, XrSpace* keyboardSpace) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&keyboard, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(keyboardSpace, 1, s_ctx);
+    serialize_output_ptr(keyboardSpace, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7242,82 +9978,144 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateVirtualKeyboardSpaceMETA(XrSession sessio
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&keyboardSpace, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateVirtualKeyboardSpaceMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateVirtualKeyboardSpaceMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateVirtualKeyboardSpaceMETA: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyVirtualKeyboardMETA(XrVirtualKeyboardMETA keyboard) try {
+static XrResult oneway_xrDestroyVirtualKeyboardMETA(XrVirtualKeyboardMETA keyboard) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 220004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&keyboard, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyVirtualKeyboardMETA: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyVirtualKeyboardMETA(XrVirtualKeyboardMETA keyboard) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyVirtualKeyboardMETA(keyboard);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyVirtualKeyboardMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyVirtualKeyboardMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyVirtualKeyboardMETA: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardDirtyTexturesMETA(XrVirtualKeyboardMETA keyboard, uint32_t textureIdCapacityInput, uint32_t* textureIdCountOutput, uint64_t* textureIds) try {
+static XrResult uncached_xrGetVirtualKeyboardDirtyTexturesMETA(XrVirtualKeyboardMETA keyboard, uint32_t textureIdCapacityInput, uint32_t* textureIdCountOutput, uint64_t* textureIds) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize(&textureIdCapacityInput, s_ctx);
-    serialize_ptr(textureIdCountOutput, 1, s_ctx);
-    serialize_ptr(textureIds, textureIdCapacityInput, s_ctx);
+    serialize_output_ptr(textureIdCountOutput, 1, s_ctx);
+    serialize_output_ptr(textureIds, textureIdCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&textureIdCountOutput, d_ctx);
-    deserialize_ptr(&textureIds, d_ctx);
+    deserialize_filled_ptr(textureIds, textureIdCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVirtualKeyboardDirtyTexturesMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVirtualKeyboardDirtyTexturesMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetVirtualKeyboardDirtyTexturesMETA: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardDirtyTexturesMETA(XrVirtualKeyboardMETA keyboard, uint32_t textureIdCapacityInput, uint32_t* textureIdCountOutput, uint64_t* textureIds) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(220005);
+    SerializeContext key_ctx(key);
+    serialize(&keyboard, key_ctx);
+
+    return call_two_call(key, textureIdCapacityInput, textureIdCountOutput, textureIds, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, uint64_t* elements) {
+            return uncached_xrGetVirtualKeyboardDirtyTexturesMETA(keyboard, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVirtualKeyboardDirtyTexturesMETA: {}", e.what());
@@ -7327,23 +10125,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardModelAnimationStatesMETA(XrVirtualKeyboardMETA keyboard, XrVirtualKeyboardModelAnimationStatesMETA* animationStates) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize_ptr(animationStates, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7351,9 +10156,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardModelAnimationStatesMETA(XrVi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&animationStates, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVirtualKeyboardModelAnimationStatesMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVirtualKeyboardModelAnimationStatesMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVirtualKeyboardModelAnimationStatesMETA: {}", e.what());
@@ -7363,23 +10168,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardScaleMETA(XrVirtualKeyboardMETA keyboard, float* scale) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
-    serialize_ptr(scale, 1, s_ctx);
+    serialize_output_ptr(scale, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7387,9 +10199,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardScaleMETA(XrVirtualKeyboardME
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&scale, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVirtualKeyboardScaleMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVirtualKeyboardScaleMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVirtualKeyboardScaleMETA: {}", e.what());
@@ -7399,24 +10211,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardTextureDataMETA(XrVirtualKeyboardMETA keyboard, uint64_t textureId, XrVirtualKeyboardTextureDataMETA* textureData) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize(&textureId, s_ctx);
     serialize_ptr(textureData, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7424,9 +10243,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetVirtualKeyboardTextureDataMETA(XrVirtualKeyb
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&textureData, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetVirtualKeyboardTextureDataMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetVirtualKeyboardTextureDataMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetVirtualKeyboardTextureDataMETA: {}", e.what());
@@ -7436,24 +10255,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSendVirtualKeyboardInputMETA(XrVirtualKeyboardMETA keyboard, const XrVirtualKeyboardInputInfoMETA* info, XrPosef* interactorRootPose) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize_ptr(info, 1, s_ctx);
-    serialize_ptr(interactorRootPose, 1, s_ctx);
+    serialize_output_ptr(interactorRootPose, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7461,9 +10287,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrSendVirtualKeyboardInputMETA(XrVirtualKeyboardM
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&interactorRootPose, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSendVirtualKeyboardInputMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSendVirtualKeyboardInputMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSendVirtualKeyboardInputMETA: {}", e.what());
@@ -7473,32 +10299,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetVirtualKeyboardModelVisibilityMETA(XrVirtualKeyboardMETA keyboard, const XrVirtualKeyboardModelVisibilitySetInfoMETA* modelVisibility) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize_ptr(modelVisibility, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetVirtualKeyboardModelVisibilityMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetVirtualKeyboardModelVisibilityMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetVirtualKeyboardModelVisibilityMETA: {}", e.what());
@@ -7508,32 +10341,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSuggestVirtualKeyboardLocationMETA(XrVirtualKeyboardMETA keyboard, const XrVirtualKeyboardLocationInfoMETA* locationInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 220011;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&keyboard, s_ctx);
     serialize_ptr(locationInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSuggestVirtualKeyboardLocationMETA");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSuggestVirtualKeyboardLocationMETA");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSuggestVirtualKeyboardLocationMETA: {}", e.what());
@@ -7545,24 +10385,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpaceFromCoordinateFrameUIDML(XrSession session, const XrCoordinateSpaceCreateInfoML* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 138001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7570,9 +10417,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpaceFromCoordinateFrameUIDML(XrSession s
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpaceFromCoordinateFrameUIDML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpaceFromCoordinateFrameUIDML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpaceFromCoordinateFrameUIDML: {}", e.what());
@@ -7584,24 +10431,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateFacialExpressionClientML(XrSession session, const XrFacialExpressionClientCreateInfoML* createInfo, XrFacialExpressionClientML* facialExpressionClient) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 483001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(facialExpressionClient, 1, s_ctx);
+    serialize_output_ptr(facialExpressionClient, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7609,43 +10463,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateFacialExpressionClientML(XrSession sessio
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&facialExpressionClient, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateFacialExpressionClientML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateFacialExpressionClientML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateFacialExpressionClientML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFacialExpressionClientML(XrFacialExpressionClientML facialExpressionClient) try {
+static XrResult oneway_xrDestroyFacialExpressionClientML(XrFacialExpressionClientML facialExpressionClient) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 483002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&facialExpressionClient, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyFacialExpressionClientML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyFacialExpressionClientML(XrFacialExpressionClientML facialExpressionClient) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyFacialExpressionClientML(facialExpressionClient);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 483002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&facialExpressionClient, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyFacialExpressionClientML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyFacialExpressionClientML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyFacialExpressionClientML: {}", e.what());
@@ -7655,25 +10548,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetFacialExpressionBlendShapePropertiesML(XrFacialExpressionClientML facialExpressionClient, const XrFacialExpressionBlendShapeGetInfoML* blendShapeGetInfo, uint32_t blendShapeCount, XrFacialExpressionBlendShapePropertiesML* blendShapes) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 483003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&facialExpressionClient, s_ctx);
     serialize_ptr(blendShapeGetInfo, 1, s_ctx);
     serialize(&blendShapeCount, s_ctx);
-    serialize_ptr(blendShapes, blendShapeCount, s_ctx);
+    serialize_output_xr_ptr(blendShapes, blendShapeCount, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7681,9 +10581,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetFacialExpressionBlendShapePropertiesML(XrFac
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&blendShapes, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetFacialExpressionBlendShapePropertiesML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetFacialExpressionBlendShapePropertiesML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetFacialExpressionBlendShapePropertiesML: {}", e.what());
@@ -7695,24 +10595,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateExportedLocalizationMapML(XrSession session, const XrUuidEXT* mapUuid, XrExportedLocalizationMapML* map) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(mapUuid, 1, s_ctx);
-    serialize_ptr(map, 1, s_ctx);
+    serialize_output_ptr(map, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7720,43 +10627,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateExportedLocalizationMapML(XrSession sessi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&map, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateExportedLocalizationMapML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateExportedLocalizationMapML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateExportedLocalizationMapML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyExportedLocalizationMapML(XrExportedLocalizationMapML map) try {
+static XrResult oneway_xrDestroyExportedLocalizationMapML(XrExportedLocalizationMapML map) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 140002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&map, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyExportedLocalizationMapML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyExportedLocalizationMapML(XrExportedLocalizationMapML map) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyExportedLocalizationMapML(map);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&map, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyExportedLocalizationMapML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyExportedLocalizationMapML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyExportedLocalizationMapML: {}", e.what());
@@ -7766,32 +10712,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrEnableLocalizationEventsML(XrSession session, const XrLocalizationEnableEventsInfoML* info) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(info, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnableLocalizationEventsML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnableLocalizationEventsML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnableLocalizationEventsML: {}", e.what());
@@ -7801,36 +10754,43 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetExportedLocalizationMapDataML(XrExportedLocalizationMapML map, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&map, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetExportedLocalizationMapDataML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetExportedLocalizationMapDataML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetExportedLocalizationMapDataML: {}", e.what());
@@ -7840,24 +10800,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrImportLocalizationMapML(XrSession session, const XrLocalizationMapImportInfoML* importInfo, XrUuidEXT* mapUuid) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(importInfo, 1, s_ctx);
-    serialize_ptr(mapUuid, 1, s_ctx);
+    serialize_output_ptr(mapUuid, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7866,49 +10833,73 @@ XRAPI_ATTR XrResult XRAPI_CALL xrImportLocalizationMapML(XrSession session, cons
     deserialize_ptr(&importInfo->data, d_ctx);
     deserialize_ptr(&mapUuid, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrImportLocalizationMapML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrImportLocalizationMapML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrImportLocalizationMapML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrQueryLocalizationMapsML(XrSession session, const XrLocalizationMapQueryInfoBaseHeaderML* queryInfo, uint32_t mapCapacityInput, uint32_t* mapCountOutput, XrLocalizationMapML* maps) try {
+static XrResult uncached_xrQueryLocalizationMapsML(XrSession session, const XrLocalizationMapQueryInfoBaseHeaderML* queryInfo, uint32_t mapCapacityInput, uint32_t* mapCountOutput, XrLocalizationMapML* maps) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_xr(queryInfo, s_ctx);
     serialize(&mapCapacityInput, s_ctx);
-    serialize_ptr(mapCountOutput, 1, s_ctx);
-    serialize_ptr(maps, mapCapacityInput, s_ctx);
+    serialize_output_ptr(mapCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(maps, mapCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&mapCountOutput, d_ctx);
-    deserialize_ptr(&maps, d_ctx);
+    deserialize_filled_ptr(maps, mapCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQueryLocalizationMapsML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQueryLocalizationMapsML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrQueryLocalizationMapsML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrQueryLocalizationMapsML(XrSession session, const XrLocalizationMapQueryInfoBaseHeaderML* queryInfo, uint32_t mapCapacityInput, uint32_t* mapCountOutput, XrLocalizationMapML* maps) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(140006);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+    serialize_xr(queryInfo, key_ctx);
+
+    return call_two_call(key, mapCapacityInput, mapCountOutput, maps, XR_TYPE_LOCALIZATION_MAP_ML,
+        [&](uint32_t capacity, uint32_t* count_output, XrLocalizationMapML* elements) {
+            return uncached_xrQueryLocalizationMapsML(session, queryInfo, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQueryLocalizationMapsML: {}", e.what());
@@ -7918,32 +10909,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRequestMapLocalizationML(XrSession session, const XrMapLocalizationRequestInfoML* requestInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 140007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(requestInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestMapLocalizationML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestMapLocalizationML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestMapLocalizationML: {}", e.what());
@@ -7955,24 +10953,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateMarkerDetectorML(XrSession session, const XrMarkerDetectorCreateInfoML* createInfo, XrMarkerDetectorML* markerDetector) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(markerDetector, 1, s_ctx);
+    serialize_output_ptr(markerDetector, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -7980,9 +10985,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateMarkerDetectorML(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&markerDetector, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateMarkerDetectorML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateMarkerDetectorML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateMarkerDetectorML: {}", e.what());
@@ -7992,24 +10997,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateMarkerSpaceML(XrSession session, const XrMarkerSpaceCreateInfoML* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8017,43 +11029,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateMarkerSpaceML(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateMarkerSpaceML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateMarkerSpaceML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateMarkerSpaceML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyMarkerDetectorML(XrMarkerDetectorML markerDetector) try {
+static XrResult oneway_xrDestroyMarkerDetectorML(XrMarkerDetectorML markerDetector) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
 
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
-
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
     uint32_t function_id = 139003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyMarkerDetectorML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyMarkerDetectorML(XrMarkerDetectorML markerDetector) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyMarkerDetectorML(markerDetector);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 139003;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&markerDetector, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyMarkerDetectorML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyMarkerDetectorML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyMarkerDetectorML: {}", e.what());
@@ -8063,23 +11114,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerDetectorStateML(XrMarkerDetectorML markerDetector, XrMarkerDetectorStateML* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8087,9 +11145,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerDetectorStateML(XrMarkerDetectorML mar
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkerDetectorStateML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkerDetectorStateML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkerDetectorStateML: {}", e.what());
@@ -8099,24 +11157,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerLengthML(XrMarkerDetectorML markerDetector, XrMarkerML marker, float* meters) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
     serialize(&marker, s_ctx);
-    serialize_ptr(meters, 1, s_ctx);
+    serialize_output_ptr(meters, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8124,9 +11189,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerLengthML(XrMarkerDetectorML markerDete
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&meters, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkerLengthML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkerLengthML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkerLengthML: {}", e.what());
@@ -8136,24 +11201,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerNumberML(XrMarkerDetectorML markerDetector, XrMarkerML marker, uint64_t* number) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
     serialize(&marker, s_ctx);
-    serialize_ptr(number, 1, s_ctx);
+    serialize_output_ptr(number, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8161,9 +11233,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerNumberML(XrMarkerDetectorML markerDete
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&number, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkerNumberML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkerNumberML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkerNumberML: {}", e.what());
@@ -8173,24 +11245,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerReprojectionErrorML(XrMarkerDetectorML markerDetector, XrMarkerML marker, float* reprojectionErrorMeters) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
     serialize(&marker, s_ctx);
-    serialize_ptr(reprojectionErrorMeters, 1, s_ctx);
+    serialize_output_ptr(reprojectionErrorMeters, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8198,9 +11277,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerReprojectionErrorML(XrMarkerDetectorML
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&reprojectionErrorMeters, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkerReprojectionErrorML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkerReprojectionErrorML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkerReprojectionErrorML: {}", e.what());
@@ -8210,76 +11289,106 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerStringML(XrMarkerDetectorML markerDetector, XrMarkerML marker, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
     serialize(&marker, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkerStringML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkerStringML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkerStringML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkersML(XrMarkerDetectorML markerDetector, uint32_t markerCapacityInput, uint32_t* markerCountOutput, XrMarkerML* markers) try {
+static XrResult uncached_xrGetMarkersML(XrMarkerDetectorML markerDetector, uint32_t markerCapacityInput, uint32_t* markerCountOutput, XrMarkerML* markers) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
     serialize(&markerCapacityInput, s_ctx);
-    serialize_ptr(markerCountOutput, 1, s_ctx);
-    serialize_ptr(markers, markerCapacityInput, s_ctx);
+    serialize_output_ptr(markerCountOutput, 1, s_ctx);
+    serialize_output_ptr(markers, markerCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&markerCountOutput, d_ctx);
-    deserialize_ptr(&markers, d_ctx);
+    deserialize_filled_ptr(markers, markerCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkersML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkersML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetMarkersML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkersML(XrMarkerDetectorML markerDetector, uint32_t markerCapacityInput, uint32_t* markerCountOutput, XrMarkerML* markers) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(139009);
+    SerializeContext key_ctx(key);
+    serialize(&markerDetector, key_ctx);
+
+    return call_two_call(key, markerCapacityInput, markerCountOutput, markers, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrMarkerML* elements) {
+            return uncached_xrGetMarkersML(markerDetector, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkersML: {}", e.what());
@@ -8289,23 +11398,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSnapshotMarkerDetectorML(XrMarkerDetectorML markerDetector, XrMarkerDetectorSnapshotInfoML* snapshotInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 139010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&markerDetector, s_ctx);
-    serialize_ptr(snapshotInfo, 1, s_ctx);
+    serialize_output_xr_ptr(snapshotInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8313,9 +11429,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrSnapshotMarkerDetectorML(XrMarkerDetectorML mar
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&snapshotInfo, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSnapshotMarkerDetectorML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSnapshotMarkerDetectorML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSnapshotMarkerDetectorML: {}", e.what());
@@ -8327,24 +11443,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorsAsyncML(XrSession session, const XrSpatialAnchorsCreateInfoBaseHeaderML* createInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 141001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_xr(createInfo, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8352,9 +11475,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorsAsyncML(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorsAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorsAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorsAsyncML: {}", e.what());
@@ -8364,24 +11487,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorsCompleteML(XrSession session, XrFutureEXT future, XrCreateSpatialAnchorsCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 141002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&future, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8389,9 +11519,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorsCompleteML(XrSession sessio
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorsCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorsCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorsCompleteML: {}", e.what());
@@ -8401,23 +11531,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialAnchorStateML(XrSpace anchor, XrSpatialAnchorStateML* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 141003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&anchor, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8425,9 +11562,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialAnchorStateML(XrSpace anchor, XrSpati
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpatialAnchorStateML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpatialAnchorStateML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpatialAnchorStateML: {}", e.what());
@@ -8439,24 +11576,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorsStorageML(XrSession session, const XrSpatialAnchorsCreateStorageInfoML* createInfo, XrSpatialAnchorsStorageML* storage) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(storage, 1, s_ctx);
+    serialize_output_ptr(storage, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8464,9 +11608,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorsStorageML(XrSession session
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&storage, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorsStorageML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorsStorageML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorsStorageML: {}", e.what());
@@ -8476,24 +11620,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrDeleteSpatialAnchorsAsyncML(XrSpatialAnchorsStorageML storage, const XrSpatialAnchorsDeleteInfoML* deleteInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize_ptr(deleteInfo, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8501,9 +11652,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrDeleteSpatialAnchorsAsyncML(XrSpatialAnchorsSto
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDeleteSpatialAnchorsAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDeleteSpatialAnchorsAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDeleteSpatialAnchorsAsyncML: {}", e.what());
@@ -8513,24 +11664,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrDeleteSpatialAnchorsCompleteML(XrSpatialAnchorsStorageML storage, XrFutureEXT future, XrSpatialAnchorsDeleteCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8538,43 +11696,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrDeleteSpatialAnchorsCompleteML(XrSpatialAnchors
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDeleteSpatialAnchorsCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDeleteSpatialAnchorsCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDeleteSpatialAnchorsCompleteML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialAnchorsStorageML(XrSpatialAnchorsStorageML storage) try {
+static XrResult oneway_xrDestroySpatialAnchorsStorageML(XrSpatialAnchorsStorageML storage) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 142004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&storage, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpatialAnchorsStorageML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialAnchorsStorageML(XrSpatialAnchorsStorageML storage) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySpatialAnchorsStorageML(storage);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySpatialAnchorsStorageML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySpatialAnchorsStorageML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySpatialAnchorsStorageML: {}", e.what());
@@ -8584,24 +11781,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPublishSpatialAnchorsAsyncML(XrSpatialAnchorsStorageML storage, const XrSpatialAnchorsPublishInfoML* publishInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize_ptr(publishInfo, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8609,9 +11813,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrPublishSpatialAnchorsAsyncML(XrSpatialAnchorsSt
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPublishSpatialAnchorsAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPublishSpatialAnchorsAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPublishSpatialAnchorsAsyncML: {}", e.what());
@@ -8621,24 +11825,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPublishSpatialAnchorsCompleteML(XrSpatialAnchorsStorageML storage, XrFutureEXT future, XrSpatialAnchorsPublishCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize(&future, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8646,9 +11857,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrPublishSpatialAnchorsCompleteML(XrSpatialAnchor
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPublishSpatialAnchorsCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPublishSpatialAnchorsCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPublishSpatialAnchorsCompleteML: {}", e.what());
@@ -8658,24 +11869,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQuerySpatialAnchorsAsyncML(XrSpatialAnchorsStorageML storage, const XrSpatialAnchorsQueryInfoBaseHeaderML* queryInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize_xr(queryInfo, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8683,9 +11901,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQuerySpatialAnchorsAsyncML(XrSpatialAnchorsStor
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQuerySpatialAnchorsAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQuerySpatialAnchorsAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQuerySpatialAnchorsAsyncML: {}", e.what());
@@ -8695,24 +11913,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrQuerySpatialAnchorsCompleteML(XrSpatialAnchorsStorageML storage, XrFutureEXT future, XrSpatialAnchorsQueryCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize(&future, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8720,9 +11945,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrQuerySpatialAnchorsCompleteML(XrSpatialAnchorsS
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrQuerySpatialAnchorsCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrQuerySpatialAnchorsCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrQuerySpatialAnchorsCompleteML: {}", e.what());
@@ -8732,24 +11957,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUpdateSpatialAnchorsExpirationAsyncML(XrSpatialAnchorsStorageML storage, const XrSpatialAnchorsUpdateExpirationInfoML* updateInfo, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize_ptr(updateInfo, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8757,9 +11989,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrUpdateSpatialAnchorsExpirationAsyncML(XrSpatial
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUpdateSpatialAnchorsExpirationAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUpdateSpatialAnchorsExpirationAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUpdateSpatialAnchorsExpirationAsyncML: {}", e.what());
@@ -8769,24 +12001,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUpdateSpatialAnchorsExpirationCompleteML(XrSpatialAnchorsStorageML storage, XrFutureEXT future, XrSpatialAnchorsUpdateExpirationCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 142010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&storage, s_ctx);
     serialize(&future, s_ctx);
-    serialize_ptr(completion, 1, s_ctx);
+    serialize_output_xr_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8794,9 +12033,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrUpdateSpatialAnchorsExpirationCompleteML(XrSpat
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUpdateSpatialAnchorsExpirationCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUpdateSpatialAnchorsExpirationCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUpdateSpatialAnchorsExpirationCompleteML: {}", e.what());
@@ -8808,32 +12047,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetSystemNotificationsML(XrInstance instance, const XrSystemNotificationsSetInfoML* info) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 474001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(info, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetSystemNotificationsML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetSystemNotificationsML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetSystemNotificationsML: {}", e.what());
@@ -8845,32 +12091,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrEnableUserCalibrationEventsML(XrInstance instance, const XrUserCalibrationEnableEventsInfoML* enableInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 473001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(enableInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnableUserCalibrationEventsML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnableUserCalibrationEventsML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnableUserCalibrationEventsML: {}", e.what());
@@ -8882,24 +12135,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrAllocateWorldMeshBufferML(XrWorldMeshDetectorML detector, const XrWorldMeshBufferSizeML* size, XrWorldMeshBufferML* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize_ptr(size, 1, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8908,9 +12168,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrAllocateWorldMeshBufferML(XrWorldMeshDetectorML
     deserialize_xr(&size->next, d_ctx);
     deserialize_ptr(&buffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrAllocateWorldMeshBufferML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrAllocateWorldMeshBufferML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrAllocateWorldMeshBufferML: {}", e.what());
@@ -8920,24 +12180,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateWorldMeshDetectorML(XrSession session, const XrWorldMeshDetectorCreateInfoML* createInfo, XrWorldMeshDetectorML* detector) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(detector, 1, s_ctx);
+    serialize_output_ptr(detector, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -8945,43 +12212,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateWorldMeshDetectorML(XrSession session, co
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&detector, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateWorldMeshDetectorML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateWorldMeshDetectorML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateWorldMeshDetectorML: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyWorldMeshDetectorML(XrWorldMeshDetectorML detector) try {
+static XrResult oneway_xrDestroyWorldMeshDetectorML(XrWorldMeshDetectorML detector) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 475003;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&detector, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyWorldMeshDetectorML: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyWorldMeshDetectorML(XrWorldMeshDetectorML detector) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyWorldMeshDetectorML(detector);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyWorldMeshDetectorML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyWorldMeshDetectorML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyWorldMeshDetectorML: {}", e.what());
@@ -8991,23 +12297,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrFreeWorldMeshBufferML(XrWorldMeshDetectorML detector, const XrWorldMeshBufferML* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9016,9 +12329,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrFreeWorldMeshBufferML(XrWorldMeshDetectorML det
     deserialize_xr(&buffer->next, d_ctx);
     deserialize_ptr(&buffer->buffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrFreeWorldMeshBufferML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrFreeWorldMeshBufferML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrFreeWorldMeshBufferML: {}", e.what());
@@ -9028,24 +12341,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetWorldMeshBufferRecommendSizeML(XrWorldMeshDetectorML detector, const XrWorldMeshBufferRecommendedSizeInfoML* sizeInfo, XrWorldMeshBufferSizeML* size) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize_ptr(sizeInfo, 1, s_ctx);
-    serialize_ptr(size, 1, s_ctx);
+    serialize_output_xr_ptr(size, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9053,9 +12373,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetWorldMeshBufferRecommendSizeML(XrWorldMeshDe
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&size, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetWorldMeshBufferRecommendSizeML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetWorldMeshBufferRecommendSizeML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetWorldMeshBufferRecommendSizeML: {}", e.what());
@@ -9065,25 +12385,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshAsyncML(XrWorldMeshDetectorML detector, const XrWorldMeshGetInfoML* getInfo, XrWorldMeshBufferML* buffer, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9093,9 +12420,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshAsyncML(XrWorldMeshDetectorML d
     deserialize_ptr(&buffer, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestWorldMeshAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestWorldMeshAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestWorldMeshAsyncML: {}", e.what());
@@ -9105,25 +12432,32 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshCompleteML(XrWorldMeshDetectorML detector, const XrWorldMeshRequestCompletionInfoML* completionInfo, XrFutureEXT future, XrWorldMeshRequestCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize_ptr(completionInfo, 1, s_ctx);
     serialize(&future, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9131,9 +12465,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshCompleteML(XrWorldMeshDetectorM
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestWorldMeshCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestWorldMeshCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestWorldMeshCompleteML: {}", e.what());
@@ -9143,24 +12477,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshStateAsyncML(XrWorldMeshDetectorML detector, const XrWorldMeshStateRequestInfoML* stateRequest, XrFutureEXT* future) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize_ptr(stateRequest, 1, s_ctx);
-    serialize_ptr(future, 1, s_ctx);
+    serialize_output_ptr(future, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9168,9 +12509,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshStateAsyncML(XrWorldMeshDetecto
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&future, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestWorldMeshStateAsyncML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestWorldMeshStateAsyncML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestWorldMeshStateAsyncML: {}", e.what());
@@ -9180,24 +12521,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshStateCompleteML(XrWorldMeshDetectorML detector, XrFutureEXT future, XrWorldMeshStateRequestCompletionML* completion) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 475009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&detector, s_ctx);
     serialize(&future, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9205,9 +12553,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrRequestWorldMeshStateCompleteML(XrWorldMeshDete
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&completion, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestWorldMeshStateCompleteML");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestWorldMeshStateCompleteML");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestWorldMeshStateCompleteML: {}", e.what());
@@ -9219,23 +12567,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrApplyForceFeedbackCurlMNDX(XrHandTrackerEXT handTracker, const XrForceFeedbackCurlApplyLocationsMNDX* locations) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 376001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&handTracker, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9243,9 +12598,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrApplyForceFeedbackCurlMNDX(XrHandTrackerEXT han
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations->locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrApplyForceFeedbackCurlMNDX");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrApplyForceFeedbackCurlMNDX");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrApplyForceFeedbackCurlMNDX: {}", e.what());
@@ -9254,41 +12609,66 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl
 #ifdef XRTRANSPORT_EXT_XR_MSFT_composition_layer_reprojection
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateReprojectionModesMSFT(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t modeCapacityInput, uint32_t* modeCountOutput, XrReprojectionModeMSFT* modes) try {
+static XrResult uncached_xrEnumerateReprojectionModesMSFT(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t modeCapacityInput, uint32_t* modeCountOutput, XrReprojectionModeMSFT* modes) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 67001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&viewConfigurationType, s_ctx);
     serialize(&modeCapacityInput, s_ctx);
-    serialize_ptr(modeCountOutput, 1, s_ctx);
-    serialize_ptr(modes, modeCapacityInput, s_ctx);
+    serialize_output_ptr(modeCountOutput, 1, s_ctx);
+    serialize_output_ptr(modes, modeCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&modeCountOutput, d_ctx);
-    deserialize_ptr(&modes, d_ctx);
+    deserialize_filled_ptr(modes, modeCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateReprojectionModesMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateReprojectionModesMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateReprojectionModesMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateReprojectionModesMSFT(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t modeCapacityInput, uint32_t* modeCountOutput, XrReprojectionModeMSFT* modes) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(67001);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationType, key_ctx);
+
+    return call_two_call(key, modeCapacityInput, modeCountOutput, modes, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrReprojectionModeMSFT* elements) {
+            return uncached_xrEnumerateReprojectionModesMSFT(instance, systemId, viewConfigurationType, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateReprojectionModesMSFT: {}", e.what());
@@ -9300,24 +12680,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetControllerModelKeyMSFT(XrSession session, XrPath topLevelUserPath, XrControllerModelKeyStateMSFT* controllerModelKeyState) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 56001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&topLevelUserPath, s_ctx);
-    serialize_ptr(controllerModelKeyState, 1, s_ctx);
+    serialize_output_xr_ptr(controllerModelKeyState, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9325,9 +12712,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetControllerModelKeyMSFT(XrSession session, Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&controllerModelKeyState, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetControllerModelKeyMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetControllerModelKeyMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetControllerModelKeyMSFT: {}", e.what());
@@ -9337,24 +12724,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetControllerModelPropertiesMSFT(XrSession session, XrControllerModelKeyMSFT modelKey, XrControllerModelPropertiesMSFT* properties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 56002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&modelKey, s_ctx);
     serialize_ptr(properties, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9362,9 +12756,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetControllerModelPropertiesMSFT(XrSession sess
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&properties, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetControllerModelPropertiesMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetControllerModelPropertiesMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetControllerModelPropertiesMSFT: {}", e.what());
@@ -9374,24 +12768,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetControllerModelStateMSFT(XrSession session, XrControllerModelKeyMSFT modelKey, XrControllerModelStateMSFT* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 56003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&modelKey, s_ctx);
     serialize_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9399,49 +12800,73 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetControllerModelStateMSFT(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetControllerModelStateMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetControllerModelStateMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetControllerModelStateMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLoadControllerModelMSFT(XrSession session, XrControllerModelKeyMSFT modelKey, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer) try {
+static XrResult uncached_xrLoadControllerModelMSFT(XrSession session, XrControllerModelKeyMSFT modelKey, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 56004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&modelKey, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_filled_ptr(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLoadControllerModelMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLoadControllerModelMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLoadControllerModelMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLoadControllerModelMSFT(XrSession session, XrControllerModelKeyMSFT modelKey, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(56004);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+    serialize(&modelKey, key_ctx);
+
+    return call_two_call(key, bufferCapacityInput, bufferCountOutput, buffer, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, uint8_t* elements) {
+            return uncached_xrLoadControllerModelMSFT(session, modelKey, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLoadControllerModelMSFT: {}", e.what());
@@ -9453,24 +12878,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateHandMeshSpaceMSFT(XrHandTrackerEXT handTracker, const XrHandMeshSpaceCreateInfoMSFT* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 53001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&handTracker, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9478,9 +12910,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateHandMeshSpaceMSFT(XrHandTrackerEXT handTr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateHandMeshSpaceMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateHandMeshSpaceMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateHandMeshSpaceMSFT: {}", e.what());
@@ -9490,24 +12922,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUpdateHandMeshMSFT(XrHandTrackerEXT handTracker, const XrHandMeshUpdateInfoMSFT* updateInfo, XrHandMeshMSFT* handMesh) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 53002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&handTracker, s_ctx);
     serialize_ptr(updateInfo, 1, s_ctx);
-    serialize_ptr(handMesh, 1, s_ctx);
+    serialize_output_xr_ptr(handMesh, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9515,9 +12954,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrUpdateHandMeshMSFT(XrHandTrackerEXT handTracker
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&handMesh, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUpdateHandMeshMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUpdateHandMeshMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUpdateHandMeshMSFT: {}", e.what());
@@ -9529,24 +12968,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorFromPerceptionAnchorMSFT(XrSession session, IUnknown* perceptionAnchor, XrSpatialAnchorMSFT* anchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 57001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
-    serialize_ptr(perceptionAnchor, 1, s_ctx);
-    serialize_ptr(anchor, 1, s_ctx);
+    serialize_output_ptr(perceptionAnchor, 1, s_ctx);
+    serialize_output_ptr(anchor, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9555,9 +13001,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorFromPerceptionAnchorMSFT(XrS
     deserialize_ptr(&perceptionAnchor, d_ctx);
     deserialize_ptr(&anchor, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorFromPerceptionAnchorMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorFromPerceptionAnchorMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorFromPerceptionAnchorMSFT: {}", e.what());
@@ -9567,24 +13013,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTryGetPerceptionAnchorFromSpatialAnchorMSFT(XrSession session, XrSpatialAnchorMSFT anchor, IUnknown** perceptionAnchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 57002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&anchor, s_ctx);
     #error "auto-generator doesn't support double pointers (perceptionAnchor)"None
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9592,9 +13045,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrTryGetPerceptionAnchorFromSpatialAnchorMSFT(XrS
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&perceptionAnchor, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTryGetPerceptionAnchorFromSpatialAnchorMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTryGetPerceptionAnchorFromSpatialAnchorMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTryGetPerceptionAnchorFromSpatialAnchorMSFT: {}", e.what());
@@ -9606,77 +13059,108 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneMarkerDecodedStringMSFT(XrSceneMSFT scene, const XrUuidMSFT* markerId, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 148001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
     serialize_ptr(markerId, 1, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSceneMarkerDecodedStringMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSceneMarkerDecodedStringMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSceneMarkerDecodedStringMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneMarkerRawDataMSFT(XrSceneMSFT scene, const XrUuidMSFT* markerId, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer) try {
+static XrResult uncached_xrGetSceneMarkerRawDataMSFT(XrSceneMSFT scene, const XrUuidMSFT* markerId, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 148002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
     serialize_ptr(markerId, 1, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_filled_ptr(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSceneMarkerRawDataMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSceneMarkerRawDataMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetSceneMarkerRawDataMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneMarkerRawDataMSFT(XrSceneMSFT scene, const XrUuidMSFT* markerId, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, uint8_t* buffer) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(148002);
+    SerializeContext key_ctx(key);
+    serialize(&scene, key_ctx);
+    serialize_ptr(markerId, 1, key_ctx);
+
+    return call_two_call(key, bufferCapacityInput, bufferCountOutput, buffer, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, uint8_t* elements) {
+            return uncached_xrGetSceneMarkerRawDataMSFT(scene, markerId, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSceneMarkerRawDataMSFT: {}", e.what());
@@ -9688,32 +13172,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrComputeNewSceneMSFT(XrSceneObserverMSFT sceneObserver, const XrNewSceneComputeInfoMSFT* computeInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&sceneObserver, s_ctx);
     serialize_ptr(computeInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrComputeNewSceneMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrComputeNewSceneMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrComputeNewSceneMSFT: {}", e.what());
@@ -9723,24 +13214,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSceneMSFT(XrSceneObserverMSFT sceneObserver, const XrSceneCreateInfoMSFT* createInfo, XrSceneMSFT* scene) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&sceneObserver, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(scene, 1, s_ctx);
+    serialize_output_ptr(scene, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9748,9 +13246,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSceneMSFT(XrSceneObserverMSFT sceneObserv
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&scene, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSceneMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSceneMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSceneMSFT: {}", e.what());
@@ -9760,24 +13258,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSceneObserverMSFT(XrSession session, const XrSceneObserverCreateInfoMSFT* createInfo, XrSceneObserverMSFT* sceneObserver) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(sceneObserver, 1, s_ctx);
+    serialize_output_ptr(sceneObserver, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9785,117 +13290,219 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSceneObserverMSFT(XrSession session, cons
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&sceneObserver, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSceneObserverMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSceneObserverMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSceneObserverMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySceneMSFT(XrSceneMSFT scene) try {
+static XrResult oneway_xrDestroySceneMSFT(XrSceneMSFT scene) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
+    XrDuration time_offset = get_time_offset();
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
     uint32_t function_id = 98004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
-    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
-    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
-
-    XrResult result;
-    deserialize(&result, d_ctx);
-    XrDuration runtime_duration;
-    deserialize(&runtime_duration, d_ctx);
-
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySceneMSFT");
-
-    return result;
+    return XR_SUCCESS;
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySceneMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySceneObserverMSFT(XrSceneObserverMSFT sceneObserver) try {
-    auto& transport = get_runtime().get_transport();
-
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySceneMSFT(XrSceneMSFT scene) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySceneMSFT(scene);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 98004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&scene, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
+
+    XrResult result;
+    deserialize(&result, d_ctx);
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySceneMSFT");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySceneMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult oneway_xrDestroySceneObserverMSFT(XrSceneObserverMSFT sceneObserver) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
-    // start timer after synchronization
+    uint32_t function_id = 98005;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&sceneObserver, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySceneObserverMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySceneObserverMSFT(XrSceneObserverMSFT sceneObserver) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySceneObserverMSFT(sceneObserver);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&sceneObserver, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySceneObserverMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySceneObserverMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySceneObserverMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSceneComputeFeaturesMSFT(XrInstance instance, XrSystemId systemId, uint32_t featureCapacityInput, uint32_t* featureCountOutput, XrSceneComputeFeatureMSFT* features) try {
+static XrResult uncached_xrEnumerateSceneComputeFeaturesMSFT(XrInstance instance, XrSystemId systemId, uint32_t featureCapacityInput, uint32_t* featureCountOutput, XrSceneComputeFeatureMSFT* features) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&featureCapacityInput, s_ctx);
-    serialize_ptr(featureCountOutput, 1, s_ctx);
-    serialize_ptr(features, featureCapacityInput, s_ctx);
+    serialize_output_ptr(featureCountOutput, 1, s_ctx);
+    serialize_output_ptr(features, featureCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&featureCountOutput, d_ctx);
-    deserialize_ptr(&features, d_ctx);
+    deserialize_filled_ptr(features, featureCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateSceneComputeFeaturesMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateSceneComputeFeaturesMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateSceneComputeFeaturesMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSceneComputeFeaturesMSFT(XrInstance instance, XrSystemId systemId, uint32_t featureCapacityInput, uint32_t* featureCountOutput, XrSceneComputeFeatureMSFT* features) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(98006);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+
+    return call_two_call(key, featureCapacityInput, featureCountOutput, features, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrSceneComputeFeatureMSFT* elements) {
+            return uncached_xrEnumerateSceneComputeFeaturesMSFT(instance, systemId, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateSceneComputeFeaturesMSFT: {}", e.what());
@@ -9905,24 +13512,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneComponentsMSFT(XrSceneMSFT scene, const XrSceneComponentsGetInfoMSFT* getInfo, XrSceneComponentsMSFT* components) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize_ptr(components, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9930,9 +13544,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneComponentsMSFT(XrSceneMSFT scene, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&components, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSceneComponentsMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSceneComponentsMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSceneComponentsMSFT: {}", e.what());
@@ -9942,23 +13556,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneComputeStateMSFT(XrSceneObserverMSFT sceneObserver, XrSceneComputeStateMSFT* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98008;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&sceneObserver, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -9966,9 +13587,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneComputeStateMSFT(XrSceneObserverMSFT sc
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSceneComputeStateMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSceneComputeStateMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSceneComputeStateMSFT: {}", e.what());
@@ -9978,24 +13599,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneMeshBuffersMSFT(XrSceneMSFT scene, const XrSceneMeshBuffersGetInfoMSFT* getInfo, XrSceneMeshBuffersMSFT* buffers) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98009;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(buffers, 1, s_ctx);
+    serialize_output_xr_ptr(buffers, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10003,9 +13631,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSceneMeshBuffersMSFT(XrSceneMSFT scene, cons
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&buffers, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSceneMeshBuffersMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSceneMeshBuffersMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSceneMeshBuffersMSFT: {}", e.what());
@@ -10015,24 +13643,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrLocateSceneComponentsMSFT(XrSceneMSFT scene, const XrSceneComponentsLocateInfoMSFT* locateInfo, XrSceneComponentLocationsMSFT* locations) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 98010;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
     serialize_ptr(locateInfo, 1, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10040,9 +13675,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateSceneComponentsMSFT(XrSceneMSFT scene, co
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&locations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateSceneComponentsMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateSceneComponentsMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateSceneComponentsMSFT: {}", e.what());
@@ -10054,32 +13689,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrDeserializeSceneMSFT(XrSceneObserverMSFT sceneObserver, const XrSceneDeserializeInfoMSFT* deserializeInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 99001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&sceneObserver, s_ctx);
     serialize_ptr(deserializeInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDeserializeSceneMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDeserializeSceneMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDeserializeSceneMSFT: {}", e.what());
@@ -10089,26 +13731,33 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSerializedSceneFragmentDataMSFT(XrSceneMSFT scene, const XrSerializedSceneFragmentDataGetInfoMSFT* getInfo, uint32_t countInput, uint32_t* readOutput, uint8_t* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 99002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&scene, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize(&countInput, s_ctx);
-    serialize_ptr(readOutput, 1, s_ctx);
-    serialize_ptr(buffer, countInput, s_ctx);
+    serialize_output_ptr(readOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, countInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10117,9 +13766,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSerializedSceneFragmentDataMSFT(XrSceneMSFT
     deserialize_ptr(&readOutput, d_ctx);
     deserialize_ptr(&buffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSerializedSceneFragmentDataMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSerializedSceneFragmentDataMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSerializedSceneFragmentDataMSFT: {}", e.what());
@@ -10131,24 +13780,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorMSFT(XrSession session, const XrSpatialAnchorCreateInfoMSFT* createInfo, XrSpatialAnchorMSFT* anchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 40001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(anchor, 1, s_ctx);
+    serialize_output_ptr(anchor, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10156,9 +13812,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorMSFT(XrSession session, cons
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&anchor, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorMSFT: {}", e.what());
@@ -10168,24 +13824,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorSpaceMSFT(XrSession session, const XrSpatialAnchorSpaceCreateInfoMSFT* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 40002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10193,43 +13856,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorSpaceMSFT(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorSpaceMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorSpaceMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorSpaceMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialAnchorMSFT(XrSpatialAnchorMSFT anchor) try {
+static XrResult oneway_xrDestroySpatialAnchorMSFT(XrSpatialAnchorMSFT anchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 40003;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&anchor, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpatialAnchorMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialAnchorMSFT(XrSpatialAnchorMSFT anchor) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySpatialAnchorMSFT(anchor);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 40003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&anchor, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySpatialAnchorMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySpatialAnchorMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySpatialAnchorMSFT: {}", e.what());
@@ -10241,31 +13943,38 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrClearSpatialAnchorStoreMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&spatialAnchorStore, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrClearSpatialAnchorStoreMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrClearSpatialAnchorStoreMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrClearSpatialAnchorStoreMSFT: {}", e.what());
@@ -10275,24 +13984,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorFromPersistedNameMSFT(XrSession session, const XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* spatialAnchorCreateInfo, XrSpatialAnchorMSFT* spatialAnchor) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(spatialAnchorCreateInfo, 1, s_ctx);
-    serialize_ptr(spatialAnchor, 1, s_ctx);
+    serialize_output_ptr(spatialAnchor, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10300,9 +14016,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorFromPersistedNameMSFT(XrSess
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&spatialAnchor, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorFromPersistedNameMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorFromPersistedNameMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorFromPersistedNameMSFT: {}", e.what());
@@ -10312,23 +14028,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorStoreConnectionMSFT(XrSession session, XrSpatialAnchorStoreConnectionMSFT* spatialAnchorStore) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
-    serialize_ptr(spatialAnchorStore, 1, s_ctx);
+    serialize_output_ptr(spatialAnchorStore, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10336,82 +14059,144 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialAnchorStoreConnectionMSFT(XrSessio
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&spatialAnchorStore, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialAnchorStoreConnectionMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialAnchorStoreConnectionMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialAnchorStoreConnectionMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialAnchorStoreConnectionMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore) try {
+static XrResult oneway_xrDestroySpatialAnchorStoreConnectionMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 143004;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&spatialAnchorStore, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpatialAnchorStoreConnectionMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialAnchorStoreConnectionMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySpatialAnchorStoreConnectionMSFT(spatialAnchorStore);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&spatialAnchorStore, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySpatialAnchorStoreConnectionMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySpatialAnchorStoreConnectionMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySpatialAnchorStoreConnectionMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumeratePersistedSpatialAnchorNamesMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore, uint32_t spatialAnchorNameCapacityInput, uint32_t* spatialAnchorNameCountOutput, XrSpatialAnchorPersistenceNameMSFT* spatialAnchorNames) try {
+static XrResult uncached_xrEnumeratePersistedSpatialAnchorNamesMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore, uint32_t spatialAnchorNameCapacityInput, uint32_t* spatialAnchorNameCountOutput, XrSpatialAnchorPersistenceNameMSFT* spatialAnchorNames) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&spatialAnchorStore, s_ctx);
     serialize(&spatialAnchorNameCapacityInput, s_ctx);
-    serialize_ptr(spatialAnchorNameCountOutput, 1, s_ctx);
-    serialize_ptr(spatialAnchorNames, spatialAnchorNameCapacityInput, s_ctx);
+    serialize_output_ptr(spatialAnchorNameCountOutput, 1, s_ctx);
+    serialize_output_ptr(spatialAnchorNames, spatialAnchorNameCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&spatialAnchorNameCountOutput, d_ctx);
-    deserialize_ptr(&spatialAnchorNames, d_ctx);
+    deserialize_filled_ptr(spatialAnchorNames, spatialAnchorNameCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumeratePersistedSpatialAnchorNamesMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumeratePersistedSpatialAnchorNamesMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumeratePersistedSpatialAnchorNamesMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumeratePersistedSpatialAnchorNamesMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore, uint32_t spatialAnchorNameCapacityInput, uint32_t* spatialAnchorNameCountOutput, XrSpatialAnchorPersistenceNameMSFT* spatialAnchorNames) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(143005);
+    SerializeContext key_ctx(key);
+    serialize(&spatialAnchorStore, key_ctx);
+
+    return call_two_call(key, spatialAnchorNameCapacityInput, spatialAnchorNameCountOutput, spatialAnchorNames, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrSpatialAnchorPersistenceNameMSFT* elements) {
+            return uncached_xrEnumeratePersistedSpatialAnchorNamesMSFT(spatialAnchorStore, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumeratePersistedSpatialAnchorNamesMSFT: {}", e.what());
@@ -10421,32 +14206,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPersistSpatialAnchorMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore, const XrSpatialAnchorPersistenceInfoMSFT* spatialAnchorPersistenceInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143006;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&spatialAnchorStore, s_ctx);
     serialize_ptr(spatialAnchorPersistenceInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPersistSpatialAnchorMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPersistSpatialAnchorMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPersistSpatialAnchorMSFT: {}", e.what());
@@ -10456,32 +14248,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrUnpersistSpatialAnchorMSFT(XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore, const XrSpatialAnchorPersistenceNameMSFT* spatialAnchorPersistenceName) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 143007;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&spatialAnchorStore, s_ctx);
     serialize_ptr(spatialAnchorPersistenceName, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrUnpersistSpatialAnchorMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrUnpersistSpatialAnchorMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrUnpersistSpatialAnchorMSFT: {}", e.what());
@@ -10493,24 +14292,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialGraphNodeSpaceMSFT(XrSession session, const XrSpatialGraphNodeSpaceCreateInfoMSFT* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 50001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10518,43 +14324,82 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSpatialGraphNodeSpaceMSFT(XrSession sessi
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSpatialGraphNodeSpaceMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSpatialGraphNodeSpaceMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSpatialGraphNodeSpaceMSFT: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialGraphNodeBindingMSFT(XrSpatialGraphNodeBindingMSFT nodeBinding) try {
+static XrResult oneway_xrDestroySpatialGraphNodeBindingMSFT(XrSpatialGraphNodeBindingMSFT nodeBinding) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 50002;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&nodeBinding, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpatialGraphNodeBindingMSFT: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpatialGraphNodeBindingMSFT(XrSpatialGraphNodeBindingMSFT nodeBinding) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySpatialGraphNodeBindingMSFT(nodeBinding);
+    }
+
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 50002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&nodeBinding, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySpatialGraphNodeBindingMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySpatialGraphNodeBindingMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySpatialGraphNodeBindingMSFT: {}", e.what());
@@ -10564,24 +14409,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialGraphNodeBindingPropertiesMSFT(XrSpatialGraphNodeBindingMSFT nodeBinding, const XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* getInfo, XrSpatialGraphNodeBindingPropertiesMSFT* properties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 50003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&nodeBinding, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(properties, 1, s_ctx);
+    serialize_output_xr_ptr(properties, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10589,9 +14441,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSpatialGraphNodeBindingPropertiesMSFT(XrSpat
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&properties, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSpatialGraphNodeBindingPropertiesMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSpatialGraphNodeBindingPropertiesMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetSpatialGraphNodeBindingPropertiesMSFT: {}", e.what());
@@ -10601,24 +14453,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrTryCreateSpatialGraphStaticNodeBindingMSFT(XrSession session, const XrSpatialGraphStaticNodeBindingCreateInfoMSFT* createInfo, XrSpatialGraphNodeBindingMSFT* nodeBinding) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 50004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(nodeBinding, 1, s_ctx);
+    serialize_output_ptr(nodeBinding, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10626,9 +14485,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrTryCreateSpatialGraphStaticNodeBindingMSFT(XrSe
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&nodeBinding, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrTryCreateSpatialGraphStaticNodeBindingMSFT");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrTryCreateSpatialGraphStaticNodeBindingMSFT");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrTryCreateSpatialGraphStaticNodeBindingMSFT: {}", e.what());
@@ -10640,23 +14499,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetAudioInputDeviceGuidOculus(XrInstance instance, wchar_t buffer[XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS]) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 160001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_array(buffer, XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10664,9 +14530,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetAudioInputDeviceGuidOculus(XrInstance instan
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&buffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetAudioInputDeviceGuidOculus");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetAudioInputDeviceGuidOculus");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetAudioInputDeviceGuidOculus: {}", e.what());
@@ -10676,23 +14542,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetAudioOutputDeviceGuidOculus(XrInstance instance, wchar_t buffer[XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS]) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 160002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_array(buffer, XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10700,9 +14573,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetAudioOutputDeviceGuidOculus(XrInstance insta
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&buffer, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetAudioOutputDeviceGuidOculus");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetAudioOutputDeviceGuidOculus");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetAudioOutputDeviceGuidOculus: {}", e.what());
@@ -10711,39 +14584,62 @@ catch (const std::exception& e) {
 
 #endif // XRTRANSPORT_EXT_XR_OCULUS_audio_device_guid
 #ifdef XRTRANSPORT_EXT_XR_OCULUS_external_camera
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateExternalCamerasOCULUS(XrSession session, uint32_t cameraCapacityInput, uint32_t* cameraCountOutput, XrExternalCameraOCULUS* cameras) try {
+static XrResult uncached_xrEnumerateExternalCamerasOCULUS(XrSession session, uint32_t cameraCapacityInput, uint32_t* cameraCountOutput, XrExternalCameraOCULUS* cameras) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 227001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&cameraCapacityInput, s_ctx);
-    serialize_ptr(cameraCountOutput, 1, s_ctx);
-    serialize_ptr(cameras, cameraCapacityInput, s_ctx);
+    serialize_output_ptr(cameraCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(cameras, cameraCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&cameraCountOutput, d_ctx);
-    deserialize_ptr(&cameras, d_ctx);
+    deserialize_filled_ptr(cameras, cameraCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateExternalCamerasOCULUS");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateExternalCamerasOCULUS");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateExternalCamerasOCULUS: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateExternalCamerasOCULUS(XrSession session, uint32_t cameraCapacityInput, uint32_t* cameraCountOutput, XrExternalCameraOCULUS* cameras) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(227001);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+
+    return call_two_call(key, cameraCapacityInput, cameraCountOutput, cameras, XR_TYPE_EXTERNAL_CAMERA_OCULUS,
+        [&](uint32_t capacity, uint32_t* count_output, XrExternalCameraOCULUS* elements) {
+            return uncached_xrEnumerateExternalCamerasOCULUS(session, capacity, count_output, elements);
+        });
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateExternalCamerasOCULUS: {}", e.what());
@@ -10755,33 +14651,40 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetTrackingOptimizationSettingsHintQCOM(XrSession session, XrTrackingOptimizationSettingsDomainQCOM domain, XrTrackingOptimizationSettingsHintQCOM hint) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 307001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&domain, s_ctx);
     serialize(&hint, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetTrackingOptimizationSettingsHintQCOM");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetTrackingOptimizationSettingsHintQCOM");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetTrackingOptimizationSettingsHintQCOM: {}", e.what());
@@ -10793,32 +14696,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetEnvironmentDepthEstimationVARJO(XrSession session, XrBool32 enabled) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 124001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&enabled, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetEnvironmentDepthEstimationVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetEnvironmentDepthEstimationVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetEnvironmentDepthEstimationVARJO: {}", e.what());
@@ -10830,24 +14740,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateMarkerSpaceVARJO(XrSession session, const XrMarkerSpaceCreateInfoVARJO* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 125001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10855,9 +14772,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateMarkerSpaceVARJO(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateMarkerSpaceVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateMarkerSpaceVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateMarkerSpaceVARJO: {}", e.what());
@@ -10867,24 +14784,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerSizeVARJO(XrSession session, uint64_t markerId, XrExtent2Df* size) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 125002;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&markerId, s_ctx);
-    serialize_ptr(size, 1, s_ctx);
+    serialize_output_ptr(size, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -10892,9 +14816,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetMarkerSizeVARJO(XrSession session, uint64_t
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&size, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetMarkerSizeVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetMarkerSizeVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetMarkerSizeVARJO: {}", e.what());
@@ -10904,33 +14828,40 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetMarkerTrackingPredictionVARJO(XrSession session, uint64_t markerId, XrBool32 enable) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 125003;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&markerId, s_ctx);
     serialize(&enable, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetMarkerTrackingPredictionVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetMarkerTrackingPredictionVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetMarkerTrackingPredictionVARJO: {}", e.what());
@@ -10940,33 +14871,40 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetMarkerTrackingTimeoutVARJO(XrSession session, uint64_t markerId, XrDuration timeout) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 125004;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&markerId, s_ctx);
     serialize(&timeout, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetMarkerTrackingTimeoutVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetMarkerTrackingTimeoutVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetMarkerTrackingTimeoutVARJO: {}", e.what());
@@ -10976,32 +14914,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetMarkerTrackingVARJO(XrSession session, XrBool32 enabled) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 125005;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&enabled, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetMarkerTrackingVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetMarkerTrackingVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetMarkerTrackingVARJO: {}", e.what());
@@ -11013,32 +14958,39 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSetViewOffsetVARJO(XrSession session, float offset) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 126001;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&offset, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSetViewOffsetVARJO");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSetViewOffsetVARJO");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSetViewOffsetVARJO: {}", e.what());
@@ -11046,27 +14998,34 @@ catch (const std::exception& e) {
 }
 
 #endif // XRTRANSPORT_EXT_XR_VARJO_view_offset
-XRAPI_ATTR XrResult XRAPI_CALL xrAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo* acquireInfo, uint32_t* index) try {
+static XrResult unpacked_xrAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo* acquireInfo, uint32_t* index) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 1;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize_ptr(acquireInfo, 1, s_ctx);
-    serialize_ptr(index, 1, s_ctx);
+    serialize_output_ptr(index, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11074,115 +15033,275 @@ XRAPI_ATTR XrResult XRAPI_CALL xrAcquireSwapchainImage(XrSwapchain swapchain, co
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&index, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrAcquireSwapchainImage");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrAcquireSwapchainImage");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrAcquireSwapchainImage: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrApplyHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo, const XrHapticBaseHeader* hapticFeedback) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrAcquireSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageAcquireInfo* acquireInfo, uint32_t* index) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!acquireInfo || acquireInfo->type != XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO || acquireInfo->next || !index) {
+        return unpacked_xrAcquireSwapchainImage(swapchain, acquireInfo, index);
+    }
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
     XrTime start_time = start_rpc_timer();
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrAcquireSwapchainImage _request{};
+    _request.swapchain = swapchain;
 
-    uint32_t function_id = 2;
-    serialize(&function_id, s_ctx);
-    serialize(&session, s_ctx);
-    serialize_ptr(hapticActionInfo, 1, s_ctx);
-    serialize_xr(hapticFeedback, s_ctx);
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 1;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
     msg_out.flush();
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
-    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
-
-    XrResult result;
-    deserialize(&result, d_ctx);
-    XrDuration runtime_duration;
-    deserialize(&runtime_duration, d_ctx);
+    Response_xrAcquireSwapchainImage _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    *index = _response.index;
 
-    end_rpc_timer(start_time, runtime_duration, "xrApplyHapticFeedback");
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrAcquireSwapchainImage");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(_response.result);
 }
 catch (const std::exception& e) {
-    spdlog::error("Exception in xrApplyHapticFeedback: {}", e.what());
+    spdlog::error("Exception in xrAcquireSwapchainImage: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrAttachSessionActionSets(XrSession session, const XrSessionActionSetsAttachInfo* attachInfo) try {
+static XrResult oneway_xrApplyHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo, const XrHapticBaseHeader* hapticFeedback) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
 
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    uint32_t function_id = 2;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
 
-    uint32_t function_id = 3;
-    serialize(&function_id, s_ctx);
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(hapticActionInfo, 1, s_ctx);
+    serialize_xr(hapticFeedback, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrApplyHapticFeedback: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unpacked_xrApplyHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo, const XrHapticBaseHeader* hapticFeedback) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 2;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(hapticActionInfo, 1, s_ctx);
+    serialize_xr(hapticFeedback, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
+
+    XrResult result;
+    deserialize(&result, d_ctx);
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrApplyHapticFeedback");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrApplyHapticFeedback: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrApplyHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo, const XrHapticBaseHeader* hapticFeedback) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrApplyHapticFeedback(session, hapticActionInfo, hapticFeedback);
+    }
+
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!hapticActionInfo || hapticActionInfo->type != XR_TYPE_HAPTIC_ACTION_INFO || hapticActionInfo->next || !hapticFeedback || hapticFeedback->type != XR_TYPE_HAPTIC_VIBRATION || hapticFeedback->next) {
+        return unpacked_xrApplyHapticFeedback(session, hapticActionInfo, hapticFeedback);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrApplyHapticFeedback _request{};
+    _request.session = session;
+    _request.hapticActionInfo_action = hapticActionInfo->action;
+    _request.hapticActionInfo_subactionPath = hapticActionInfo->subactionPath;
+    _request.hapticFeedback_duration = reinterpret_cast<const XrHapticVibration*>(hapticFeedback)->duration;
+    _request.hapticFeedback_frequency = reinterpret_cast<const XrHapticVibration*>(hapticFeedback)->frequency;
+    _request.hapticFeedback_amplitude = reinterpret_cast<const XrHapticVibration*>(hapticFeedback)->amplitude;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 2;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrApplyHapticFeedback _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrApplyHapticFeedback");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrApplyHapticFeedback: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrAttachSessionActionSets(XrSession session, const XrSessionActionSetsAttachInfo* attachInfo) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 3;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(attachInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrAttachSessionActionSets");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrAttachSessionActionSets");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrAttachSessionActionSets: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrBeginFrame(XrSession session, const XrFrameBeginInfo* frameBeginInfo) try {
+static XrResult oneway_xrBeginFrame(XrSession session, const XrFrameBeginInfo* frameBeginInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 4;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(frameBeginInfo, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrBeginFrame: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrBeginFrame(XrSession session, const XrFrameBeginInfo* frameBeginInfo) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_FRAME_LOOP_FUSION)) {
+        return oneway_xrBeginFrame(session, frameBeginInfo);
+    }
 
-    // start timer after synchronization
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 4;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(frameBeginInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrBeginFrame");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrBeginFrame");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrBeginFrame: {}", e.what());
@@ -11192,59 +15311,73 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrBeginSession(XrSession session, const XrSessionBeginInfo* beginInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 5;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(beginInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrBeginSession");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrBeginSession");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrBeginSession: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateAction(XrActionSet actionSet, const XrActionCreateInfo* createInfo, XrAction* action) try {
+static XrResult unpipelined_xrCreateAction(XrActionSet actionSet, const XrActionCreateInfo* createInfo, XrAction* action) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 6;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&actionSet, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(action, 1, s_ctx);
+    serialize_output_ptr(action, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11252,36 +15385,84 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateAction(XrActionSet actionSet, const XrAct
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&action, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateAction");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateAction");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateAction: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateActionSet(XrInstance instance, const XrActionSetCreateInfo* createInfo, XrActionSet* actionSet) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateAction(XrActionSet actionSet, const XrActionCreateInfo* createInfo, XrAction* action) try {
+    VirtualHandleAllocator* virtual_handles = get_runtime().get_virtual_handles();
+    if (!virtual_handles) {
+        return unpipelined_xrCreateAction(actionSet, createInfo, action);
+    }
+    if (!action) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see virtual_handles.h
+    auto msg_out = transport.start_message(XRTP_MSG_PIPELINED_FUNCTION_CALL);
+
+    uint32_t function_id = 6;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&actionSet, s_ctx);
+    serialize_ptr(createInfo, 1, s_ctx);
+    serialize_output_ptr(action, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    // allocated while msg_out still holds the message lock, so that it matches the order of the calls
+    *action = handle_from_value<XrAction>(virtual_handles->allocate());
 
-    // start timer after synchronization
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrCreateAction: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unpipelined_xrCreateActionSet(XrInstance instance, const XrActionSetCreateInfo* createInfo, XrActionSet* actionSet) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 7;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(actionSet, 1, s_ctx);
+    serialize_output_ptr(actionSet, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11289,36 +15470,84 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateActionSet(XrInstance instance, const XrAc
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&actionSet, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateActionSet");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateActionSet");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateActionSet: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateActionSpace(XrSession session, const XrActionSpaceCreateInfo* createInfo, XrSpace* space) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateActionSet(XrInstance instance, const XrActionSetCreateInfo* createInfo, XrActionSet* actionSet) try {
+    VirtualHandleAllocator* virtual_handles = get_runtime().get_virtual_handles();
+    if (!virtual_handles) {
+        return unpipelined_xrCreateActionSet(instance, createInfo, actionSet);
+    }
+    if (!actionSet) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see virtual_handles.h
+    auto msg_out = transport.start_message(XRTP_MSG_PIPELINED_FUNCTION_CALL);
 
-    // start timer after synchronization
+    uint32_t function_id = 7;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&instance, s_ctx);
+    serialize_ptr(createInfo, 1, s_ctx);
+    serialize_output_ptr(actionSet, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    // allocated while msg_out still holds the message lock, so that it matches the order of the calls
+    *actionSet = handle_from_value<XrActionSet>(virtual_handles->allocate());
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrCreateActionSet: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unpipelined_xrCreateActionSpace(XrSession session, const XrActionSpaceCreateInfo* createInfo, XrSpace* space) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 8;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11326,35 +15555,83 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateActionSpace(XrSession session, const XrAc
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateActionSpace");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateActionSpace");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateActionSpace: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateInstance(const XrInstanceCreateInfo* createInfo, XrInstance* instance) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateActionSpace(XrSession session, const XrActionSpaceCreateInfo* createInfo, XrSpace* space) try {
+    VirtualHandleAllocator* virtual_handles = get_runtime().get_virtual_handles();
+    if (!virtual_handles) {
+        return unpipelined_xrCreateActionSpace(session, createInfo, space);
+    }
+    if (!space) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see virtual_handles.h
+    auto msg_out = transport.start_message(XRTP_MSG_PIPELINED_FUNCTION_CALL);
+
+    uint32_t function_id = 8;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(createInfo, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    // allocated while msg_out still holds the message lock, so that it matches the order of the calls
+    *space = handle_from_value<XrSpace>(virtual_handles->allocate());
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrCreateActionSpace: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateInstance(const XrInstanceCreateInfo* createInfo, XrInstance* instance) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 9;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(instance, 1, s_ctx);
+    serialize_output_ptr(instance, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11362,36 +15639,43 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateInstance(const XrInstanceCreateInfo* crea
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&instance, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateInstance");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateInstance");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateInstance: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateReferenceSpace(XrSession session, const XrReferenceSpaceCreateInfo* createInfo, XrSpace* space) try {
+static XrResult unpipelined_xrCreateReferenceSpace(XrSession session, const XrReferenceSpaceCreateInfo* createInfo, XrSpace* space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 10;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(space, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11399,36 +15683,84 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateReferenceSpace(XrSession session, const X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&space, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateReferenceSpace");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateReferenceSpace");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateReferenceSpace: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrCreateSession(XrInstance instance, const XrSessionCreateInfo* createInfo, XrSession* session) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateReferenceSpace(XrSession session, const XrReferenceSpaceCreateInfo* createInfo, XrSpace* space) try {
+    VirtualHandleAllocator* virtual_handles = get_runtime().get_virtual_handles();
+    if (!virtual_handles) {
+        return unpipelined_xrCreateReferenceSpace(session, createInfo, space);
+    }
+    if (!space) {
+        return XR_ERROR_VALIDATION_FAILURE;
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see virtual_handles.h
+    auto msg_out = transport.start_message(XRTP_MSG_PIPELINED_FUNCTION_CALL);
+
+    uint32_t function_id = 10;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(createInfo, 1, s_ctx);
+    serialize_output_ptr(space, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    // allocated while msg_out still holds the message lock, so that it matches the order of the calls
+    *space = handle_from_value<XrSpace>(virtual_handles->allocate());
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrCreateReferenceSpace: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrCreateSession(XrInstance instance, const XrSessionCreateInfo* createInfo, XrSession* session) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 11;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(session, 1, s_ctx);
+    serialize_output_ptr(session, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11436,9 +15768,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSession(XrInstance instance, const XrSess
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&session, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSession");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSession");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSession: {}", e.what());
@@ -11448,24 +15780,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrCreateSwapchain(XrSession session, const XrSwapchainCreateInfo* createInfo, XrSwapchain* swapchain) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 12;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(createInfo, 1, s_ctx);
-    serialize_ptr(swapchain, 1, s_ctx);
+    serialize_output_ptr(swapchain, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -11473,77 +15812,165 @@ XRAPI_ATTR XrResult XRAPI_CALL xrCreateSwapchain(XrSession session, const XrSwap
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&swapchain, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrCreateSwapchain");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrCreateSwapchain");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrCreateSwapchain: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyAction(XrAction action) try {
+static XrResult oneway_xrDestroyAction(XrAction action) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 13;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&action, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyAction: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyAction(XrAction action) try {
+    // queries may refer to the handle, see action_states.h
+    if (ActionStates* action_states = get_runtime().get_action_states()) {
+        action_states->clear();
+    }
 
-    // start timer after synchronization
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyAction(action);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 13;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&action, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyAction");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyAction");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyAction: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroyActionSet(XrActionSet actionSet) try {
+static XrResult oneway_xrDestroyActionSet(XrActionSet actionSet) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
-    // start timer after synchronization
+    uint32_t function_id = 14;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&actionSet, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroyActionSet: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroyActionSet(XrActionSet actionSet) try {
+    // queries may refer to the handle, see action_states.h
+    if (ActionStates* action_states = get_runtime().get_action_states()) {
+        action_states->clear();
+    }
+
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroyActionSet(actionSet);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 14;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&actionSet, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyActionSet");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyActionSet");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyActionSet: {}", e.what());
@@ -11551,322 +15978,638 @@ catch (const std::exception& e) {
 }
 
 XRAPI_ATTR XrResult XRAPI_CALL xrDestroyInstance(XrInstance instance) try {
-    auto& transport = get_runtime().get_transport();
+    // the runtime may reuse the handle value, see query_cache.h
+    if (QueryCache* query_cache = get_runtime().get_query_cache()) {
+        query_cache->clear();
+    }
+
+    // queries may refer to the handle, see action_states.h
+    if (ActionStates* action_states = get_runtime().get_action_states()) {
+        action_states->clear();
+    }
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 15;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroyInstance");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroyInstance");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroyInstance: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySession(XrSession session) try {
+static XrResult oneway_xrDestroySession(XrSession session) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
 
-    // start timer after synchronization
-    XrTime start_time = start_rpc_timer();
-
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
 
     uint32_t function_id = 16;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySession: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unfused_xrDestroySession(XrSession session) try {
+    // the runtime may reuse the handle value, see query_cache.h
+    if (QueryCache* query_cache = get_runtime().get_query_cache()) {
+        query_cache->clear(handle_value(session));
+    }
+
+    // queries may refer to the handle, see action_states.h
+    if (ActionStates* action_states = get_runtime().get_action_states()) {
+        action_states->clear();
+    }
+
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySession(session);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
+
+    uint32_t function_id = 16;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySession");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySession");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySession: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpace(XrSpace space) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySession(XrSession session) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroySession(session);
+    }
+    return frame_loop->destroy_session(session, unfused_xrDestroySession);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySession: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult oneway_xrDestroySpace(XrSpace space) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 17;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&space, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpace: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // start timer after synchronization
+static XrResult unfused_xrDestroySpace(XrSpace space) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySpace(space);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 17;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySpace");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySpace");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySpace: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrDestroySwapchain(XrSwapchain swapchain) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySpace(XrSpace space) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrDestroySpace(space);
+    }
+    return frame_loop->destroy_space(space, unfused_xrDestroySpace);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySpace: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult oneway_xrDestroySwapchain(XrSwapchain swapchain) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 18;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&swapchain, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrDestroySwapchain: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // start timer after synchronization
+XRAPI_ATTR XrResult XRAPI_CALL xrDestroySwapchain(XrSwapchain swapchain) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrDestroySwapchain(swapchain);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 18;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrDestroySwapchain");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrDestroySwapchain");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrDestroySwapchain: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo) try {
+static XrResult unfused_xrEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 19;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(frameEndInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEndFrame");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEndFrame");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEndFrame: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEndSession(XrSession session) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrEndFrame(XrSession session, const XrFrameEndInfo* frameEndInfo) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrEndFrame(session, frameEndInfo);
+    }
+    return frame_loop->end_frame(session, frameEndInfo, unfused_xrEndFrame);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEndFrame: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unfused_xrEndSession(XrSession session) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 20;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEndSession");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEndSession");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEndSession: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateApiLayerProperties(uint32_t propertyCapacityInput, uint32_t* propertyCountOutput, XrApiLayerProperties* properties) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrEndSession(XrSession session) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrEndSession(session);
+    }
+    return frame_loop->end_session(session, unfused_xrEndSession);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEndSession: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult uncached_xrEnumerateApiLayerProperties(uint32_t propertyCapacityInput, uint32_t* propertyCountOutput, XrApiLayerProperties* properties) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 21;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&propertyCapacityInput, s_ctx);
-    serialize_ptr(propertyCountOutput, 1, s_ctx);
-    serialize_ptr(properties, propertyCapacityInput, s_ctx);
+    serialize_output_ptr(propertyCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(properties, propertyCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&propertyCountOutput, d_ctx);
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_filled_ptr(properties, propertyCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateApiLayerProperties");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateApiLayerProperties");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateApiLayerProperties: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateBoundSourcesForAction(XrSession session, const XrBoundSourcesForActionEnumerateInfo* enumerateInfo, uint32_t sourceCapacityInput, uint32_t* sourceCountOutput, XrPath* sources) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateApiLayerProperties(uint32_t propertyCapacityInput, uint32_t* propertyCountOutput, XrApiLayerProperties* properties) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(21);
+    SerializeContext key_ctx(key);
+
+    return call_two_call(key, propertyCapacityInput, propertyCountOutput, properties, XR_TYPE_API_LAYER_PROPERTIES,
+        [&](uint32_t capacity, uint32_t* count_output, XrApiLayerProperties* elements) {
+            return uncached_xrEnumerateApiLayerProperties(capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateApiLayerProperties: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult uncached_xrEnumerateBoundSourcesForAction(XrSession session, const XrBoundSourcesForActionEnumerateInfo* enumerateInfo, uint32_t sourceCapacityInput, uint32_t* sourceCountOutput, XrPath* sources) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 22;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(enumerateInfo, 1, s_ctx);
     serialize(&sourceCapacityInput, s_ctx);
-    serialize_ptr(sourceCountOutput, 1, s_ctx);
-    serialize_ptr(sources, sourceCapacityInput, s_ctx);
+    serialize_output_ptr(sourceCountOutput, 1, s_ctx);
+    serialize_output_ptr(sources, sourceCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&sourceCountOutput, d_ctx);
-    deserialize_ptr(&sources, d_ctx);
+    deserialize_filled_ptr(sources, sourceCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateBoundSourcesForAction");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateBoundSourcesForAction");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateBoundSourcesForAction: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t environmentBlendModeCapacityInput, uint32_t* environmentBlendModeCountOutput, XrEnvironmentBlendMode* environmentBlendModes) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateBoundSourcesForAction(XrSession session, const XrBoundSourcesForActionEnumerateInfo* enumerateInfo, uint32_t sourceCapacityInput, uint32_t* sourceCountOutput, XrPath* sources) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(22);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+    serialize_ptr(enumerateInfo, 1, key_ctx);
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    return call_two_call(key, sourceCapacityInput, sourceCountOutput, sources, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrPath* elements) {
+            return uncached_xrEnumerateBoundSourcesForAction(session, enumerateInfo, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateBoundSourcesForAction: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult uncached_xrEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t environmentBlendModeCapacityInput, uint32_t* environmentBlendModeCountOutput, XrEnvironmentBlendMode* environmentBlendModes) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 23;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&viewConfigurationType, s_ctx);
     serialize(&environmentBlendModeCapacityInput, s_ctx);
-    serialize_ptr(environmentBlendModeCountOutput, 1, s_ctx);
-    serialize_ptr(environmentBlendModes, environmentBlendModeCapacityInput, s_ctx);
+    serialize_output_ptr(environmentBlendModeCountOutput, 1, s_ctx);
+    serialize_output_ptr(environmentBlendModes, environmentBlendModeCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&environmentBlendModeCountOutput, d_ctx);
-    deserialize_ptr(&environmentBlendModes, d_ctx);
+    deserialize_filled_ptr(environmentBlendModes, environmentBlendModeCapacityInput, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateEnvironmentBlendModes");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateEnvironmentBlendModes: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult fetch_xrEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t environmentBlendModeCapacityInput, uint32_t* environmentBlendModeCountOutput, XrEnvironmentBlendMode* environmentBlendModes) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(23);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationType, key_ctx);
+
+    return call_two_call(key, environmentBlendModeCapacityInput, environmentBlendModeCountOutput, environmentBlendModes, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrEnvironmentBlendMode* elements) {
+            return uncached_xrEnumerateEnvironmentBlendModes(instance, systemId, viewConfigurationType, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateEnvironmentBlendModes: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateEnvironmentBlendModes");
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateEnvironmentBlendModes(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t environmentBlendModeCapacityInput, uint32_t* environmentBlendModeCountOutput, XrEnvironmentBlendMode* environmentBlendModes) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrEnumerateEnvironmentBlendModes(instance, systemId, viewConfigurationType, environmentBlendModeCapacityInput, environmentBlendModeCountOutput, environmentBlendModes);
+    }
 
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 23);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationType, key_ctx);
+    serialize(&environmentBlendModeCapacityInput, key_ctx);
+    serialize_output_ptr(environmentBlendModeCountOutput, 1, key_ctx);
+    serialize_output_ptr(environmentBlendModes, environmentBlendModeCapacityInput, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&environmentBlendModeCountOutput, outputs_ctx);
+        deserialize_filled_ptr(environmentBlendModes, environmentBlendModeCapacityInput, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
+
+    result = fetch_xrEnumerateEnvironmentBlendModes(instance, systemId, viewConfigurationType, environmentBlendModeCapacityInput, environmentBlendModeCountOutput, environmentBlendModes);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(environmentBlendModeCountOutput, 1, outputs_ctx);
+        serialize_filled_ptr(environmentBlendModes, environmentBlendModeCapacityInput, XR_SUCCEEDED(result) && environmentBlendModeCountOutput ? *environmentBlendModeCountOutput : 0, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -11874,77 +16617,160 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateInstanceExtensionProperties(const char* layerName, uint32_t propertyCapacityInput, uint32_t* propertyCountOutput, XrExtensionProperties* properties) try {
+static XrResult uncached_xrEnumerateInstanceExtensionProperties(const char* layerName, uint32_t propertyCapacityInput, uint32_t* propertyCountOutput, XrExtensionProperties* properties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 24;
-    serialize(&function_id, s_ctx);
-    serialize_ptr(layerName, count_null_terminated(layerName), s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize_string(layerName, s_ctx);
     serialize(&propertyCapacityInput, s_ctx);
-    serialize_ptr(propertyCountOutput, 1, s_ctx);
-    serialize_ptr(properties, propertyCapacityInput, s_ctx);
+    serialize_output_ptr(propertyCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(properties, propertyCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&propertyCountOutput, d_ctx);
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_filled_ptr(properties, propertyCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateInstanceExtensionProperties");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateInstanceExtensionProperties");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateInstanceExtensionProperties: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateReferenceSpaces(XrSession session, uint32_t spaceCapacityInput, uint32_t* spaceCountOutput, XrReferenceSpaceType* spaces) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateInstanceExtensionProperties(const char* layerName, uint32_t propertyCapacityInput, uint32_t* propertyCountOutput, XrExtensionProperties* properties) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(24);
+    SerializeContext key_ctx(key);
+    serialize_string(layerName, key_ctx);
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    return call_two_call(key, propertyCapacityInput, propertyCountOutput, properties, XR_TYPE_EXTENSION_PROPERTIES,
+        [&](uint32_t capacity, uint32_t* count_output, XrExtensionProperties* elements) {
+            return uncached_xrEnumerateInstanceExtensionProperties(layerName, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateInstanceExtensionProperties: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // start timer after synchronization
+static XrResult uncached_xrEnumerateReferenceSpaces(XrSession session, uint32_t spaceCapacityInput, uint32_t* spaceCountOutput, XrReferenceSpaceType* spaces) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 25;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&spaceCapacityInput, s_ctx);
-    serialize_ptr(spaceCountOutput, 1, s_ctx);
-    serialize_ptr(spaces, spaceCapacityInput, s_ctx);
+    serialize_output_ptr(spaceCountOutput, 1, s_ctx);
+    serialize_output_ptr(spaces, spaceCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&spaceCountOutput, d_ctx);
-    deserialize_ptr(&spaces, d_ctx);
+    deserialize_filled_ptr(spaces, spaceCapacityInput, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateReferenceSpaces");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateReferenceSpaces: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult fetch_xrEnumerateReferenceSpaces(XrSession session, uint32_t spaceCapacityInput, uint32_t* spaceCountOutput, XrReferenceSpaceType* spaces) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(25);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+
+    return call_two_call(key, spaceCapacityInput, spaceCountOutput, spaces, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrReferenceSpaceType* elements) {
+            return uncached_xrEnumerateReferenceSpaces(session, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateReferenceSpaces: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateReferenceSpaces(XrSession session, uint32_t spaceCapacityInput, uint32_t* spaceCountOutput, XrReferenceSpaceType* spaces) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrEnumerateReferenceSpaces(session, spaceCapacityInput, spaceCountOutput, spaces);
+    }
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateReferenceSpaces");
+    // the results don't change for the lifetime of session, see query_cache.h
+    QueryKey key(handle_value(session), 25);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+    serialize(&spaceCapacityInput, key_ctx);
+    serialize_output_ptr(spaceCountOutput, 1, key_ctx);
+    serialize_output_ptr(spaces, spaceCapacityInput, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&spaceCountOutput, outputs_ctx);
+        deserialize_filled_ptr(spaces, spaceCapacityInput, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
 
+    result = fetch_xrEnumerateReferenceSpaces(session, spaceCapacityInput, spaceCountOutput, spaces);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(spaceCountOutput, 1, outputs_ctx);
+        serialize_filled_ptr(spaces, spaceCapacityInput, XR_SUCCEEDED(result) && spaceCountOutput ? *spaceCountOutput : 0, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -11952,38 +16778,98 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSwapchainFormats(XrSession session, uint32_t formatCapacityInput, uint32_t* formatCountOutput, int64_t* formats) try {
+static XrResult uncached_xrEnumerateSwapchainFormats(XrSession session, uint32_t formatCapacityInput, uint32_t* formatCountOutput, int64_t* formats) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 26;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&formatCapacityInput, s_ctx);
-    serialize_ptr(formatCountOutput, 1, s_ctx);
-    serialize_ptr(formats, formatCapacityInput, s_ctx);
+    serialize_output_ptr(formatCountOutput, 1, s_ctx);
+    serialize_output_ptr(formats, formatCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&formatCountOutput, d_ctx);
-    deserialize_ptr(&formats, d_ctx);
+    deserialize_filled_ptr(formats, formatCapacityInput, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateSwapchainFormats");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateSwapchainFormats: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult fetch_xrEnumerateSwapchainFormats(XrSession session, uint32_t formatCapacityInput, uint32_t* formatCountOutput, int64_t* formats) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(26);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateSwapchainFormats");
+    return call_two_call(key, formatCapacityInput, formatCountOutput, formats, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, int64_t* elements) {
+            return uncached_xrEnumerateSwapchainFormats(session, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateSwapchainFormats: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSwapchainFormats(XrSession session, uint32_t formatCapacityInput, uint32_t* formatCountOutput, int64_t* formats) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrEnumerateSwapchainFormats(session, formatCapacityInput, formatCountOutput, formats);
+    }
+
+    // the results don't change for the lifetime of session, see query_cache.h
+    QueryKey key(handle_value(session), 26);
+    SerializeContext key_ctx(key);
+    serialize(&session, key_ctx);
+    serialize(&formatCapacityInput, key_ctx);
+    serialize_output_ptr(formatCountOutput, 1, key_ctx);
+    serialize_output_ptr(formats, formatCapacityInput, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&formatCountOutput, outputs_ctx);
+        deserialize_filled_ptr(formats, formatCapacityInput, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
+
+    result = fetch_xrEnumerateSwapchainFormats(session, formatCapacityInput, formatCountOutput, formats);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(formatCountOutput, 1, outputs_ctx);
+        serialize_filled_ptr(formats, formatCapacityInput, XR_SUCCEEDED(result) && formatCountOutput ? *formatCountOutput : 0, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -11994,76 +16880,147 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateSwapchainImages(XrSwapchain swapchain, uint32_t imageCapacityInput, uint32_t* imageCountOutput, XrSwapchainImageBaseHeader* images) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 27;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize(&imageCapacityInput, s_ctx);
-    serialize_ptr(imageCountOutput, 1, s_ctx);
+    serialize_output_ptr(imageCountOutput, 1, s_ctx);
     serialize_xr_array(images, imageCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&imageCountOutput, d_ctx);
-    deserialize_xr_array(&images, d_ctx);
+    deserialize_filled_xr_array(images, imageCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateSwapchainImages");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateSwapchainImages");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrEnumerateSwapchainImages: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateViewConfigurationViews(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrViewConfigurationView* views) try {
+static XrResult uncached_xrEnumerateViewConfigurationViews(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrViewConfigurationView* views) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 28;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&viewConfigurationType, s_ctx);
     serialize(&viewCapacityInput, s_ctx);
-    serialize_ptr(viewCountOutput, 1, s_ctx);
-    serialize_ptr(views, viewCapacityInput, s_ctx);
+    serialize_output_ptr(viewCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(views, viewCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&viewCountOutput, d_ctx);
-    deserialize_ptr(&views, d_ctx);
+    deserialize_filled_ptr(views, viewCapacityInput, d_ctx);
+
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateViewConfigurationViews");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateViewConfigurationViews: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult fetch_xrEnumerateViewConfigurationViews(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrViewConfigurationView* views) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(28);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationType, key_ctx);
+
+    return call_two_call(key, viewCapacityInput, viewCountOutput, views, XR_TYPE_VIEW_CONFIGURATION_VIEW,
+        [&](uint32_t capacity, uint32_t* count_output, XrViewConfigurationView* elements) {
+            return uncached_xrEnumerateViewConfigurationViews(instance, systemId, viewConfigurationType, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateViewConfigurationViews: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateViewConfigurationViews");
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateViewConfigurationViews(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrViewConfigurationView* views) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrEnumerateViewConfigurationViews(instance, systemId, viewConfigurationType, viewCapacityInput, viewCountOutput, views);
+    }
 
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 28);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationType, key_ctx);
+    serialize(&viewCapacityInput, key_ctx);
+    serialize_output_ptr(viewCountOutput, 1, key_ctx);
+    serialize_output_xr_ptr(views, viewCapacityInput, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&viewCountOutput, outputs_ctx);
+        deserialize_filled_ptr(views, viewCapacityInput, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
+
+    result = fetch_xrEnumerateViewConfigurationViews(instance, systemId, viewConfigurationType, viewCapacityInput, viewCountOutput, views);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(viewCountOutput, 1, outputs_ctx);
+        serialize_filled_ptr(views, viewCapacityInput, XR_SUCCEEDED(result) && viewCountOutput ? *viewCountOutput : 0, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -12071,39 +17028,101 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateViewConfigurations(XrInstance instance, XrSystemId systemId, uint32_t viewConfigurationTypeCapacityInput, uint32_t* viewConfigurationTypeCountOutput, XrViewConfigurationType* viewConfigurationTypes) try {
+static XrResult uncached_xrEnumerateViewConfigurations(XrInstance instance, XrSystemId systemId, uint32_t viewConfigurationTypeCapacityInput, uint32_t* viewConfigurationTypeCountOutput, XrViewConfigurationType* viewConfigurationTypes) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 29;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&viewConfigurationTypeCapacityInput, s_ctx);
-    serialize_ptr(viewConfigurationTypeCountOutput, 1, s_ctx);
-    serialize_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, s_ctx);
+    serialize_output_ptr(viewConfigurationTypeCountOutput, 1, s_ctx);
+    serialize_output_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&viewConfigurationTypeCountOutput, d_ctx);
-    deserialize_ptr(&viewConfigurationTypes, d_ctx);
+    deserialize_filled_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrEnumerateViewConfigurations");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrEnumerateViewConfigurations");
 
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateViewConfigurations: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult fetch_xrEnumerateViewConfigurations(XrInstance instance, XrSystemId systemId, uint32_t viewConfigurationTypeCapacityInput, uint32_t* viewConfigurationTypeCountOutput, XrViewConfigurationType* viewConfigurationTypes) try {
+    // size queries also fetch the elements for the following call, see two_call_cache.h
+    TwoCallKey key(29);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+
+    return call_two_call(key, viewConfigurationTypeCapacityInput, viewConfigurationTypeCountOutput, viewConfigurationTypes, XR_TYPE_UNKNOWN,
+        [&](uint32_t capacity, uint32_t* count_output, XrViewConfigurationType* elements) {
+            return uncached_xrEnumerateViewConfigurations(instance, systemId, capacity, count_output, elements);
+        });
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrEnumerateViewConfigurations: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrEnumerateViewConfigurations(XrInstance instance, XrSystemId systemId, uint32_t viewConfigurationTypeCapacityInput, uint32_t* viewConfigurationTypeCountOutput, XrViewConfigurationType* viewConfigurationTypes) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrEnumerateViewConfigurations(instance, systemId, viewConfigurationTypeCapacityInput, viewConfigurationTypeCountOutput, viewConfigurationTypes);
+    }
+
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 29);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationTypeCapacityInput, key_ctx);
+    serialize_output_ptr(viewConfigurationTypeCountOutput, 1, key_ctx);
+    serialize_output_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&viewConfigurationTypeCountOutput, outputs_ctx);
+        deserialize_filled_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
+
+    result = fetch_xrEnumerateViewConfigurations(instance, systemId, viewConfigurationTypeCapacityInput, viewConfigurationTypeCountOutput, viewConfigurationTypes);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(viewConfigurationTypeCountOutput, 1, outputs_ctx);
+        serialize_filled_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, XR_SUCCEEDED(result) && viewConfigurationTypeCountOutput ? *viewConfigurationTypeCountOutput : 0, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -12111,27 +17130,34 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateBoolean(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateBoolean* state) try {
+static XrResult unpacked_xrGetActionStateBoolean(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateBoolean* state) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 30;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12139,36 +17165,119 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateBoolean(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetActionStateBoolean");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetActionStateBoolean");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetActionStateBoolean: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateFloat(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateFloat* state) try {
+static XrResult unsynced_xrGetActionStateBoolean(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateBoolean* state) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!getInfo || getInfo->type != XR_TYPE_ACTION_STATE_GET_INFO || getInfo->next || !state || state->type != XR_TYPE_ACTION_STATE_BOOLEAN || state->next) {
+        return unpacked_xrGetActionStateBoolean(session, getInfo, state);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrGetActionStateBoolean _request{};
+    _request.session = session;
+    _request.getInfo_action = getInfo->action;
+    _request.getInfo_subactionPath = getInfo->subactionPath;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 30;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrGetActionStateBoolean _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    state->currentState = _response.state_currentState;
+    state->changedSinceLastSync = _response.state_changedSinceLastSync;
+    state->lastChangeTime = _response.state_lastChangeTime + time_offset;
+    state->isActive = _response.state_isActive;
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrGetActionStateBoolean");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStateBoolean: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateBoolean(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateBoolean* state) try {
+    ActionStates* action_states = get_runtime().get_action_states();
+    if (!action_states) {
+        return unsynced_xrGetActionStateBoolean(session, getInfo, state);
+    }
+
+    // states only change in xrSyncActions, which fetches the ones queried before it, see action_states.h
+    SampledCall call(30);
+    SerializeContext call_ctx(call);
+    serialize(&session, call_ctx);
+    serialize_ptr(getInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_output_xr_ptr(state, 1, call_ctx);
+
+    QueryBuffer response;
+    if (!action_states->take_snapshot(handle_value(session), std::move(call), response)) {
+        return unsynced_xrGetActionStateBoolean(session, getInfo, state);
+    }
+    DeserializeContext d_ctx(response, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the query is made again, so that the error is for this call
+        return unsynced_xrGetActionStateBoolean(session, getInfo, state);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&state, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStateBoolean: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // start timer after synchronization
+static XrResult unpacked_xrGetActionStateFloat(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateFloat* state) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 31;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12176,36 +17285,119 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateFloat(XrSession session, const Xr
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetActionStateFloat");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetActionStateFloat");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetActionStateFloat: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStatePose(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStatePose* state) try {
+static XrResult unsynced_xrGetActionStateFloat(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateFloat* state) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!getInfo || getInfo->type != XR_TYPE_ACTION_STATE_GET_INFO || getInfo->next || !state || state->type != XR_TYPE_ACTION_STATE_FLOAT || state->next) {
+        return unpacked_xrGetActionStateFloat(session, getInfo, state);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrGetActionStateFloat _request{};
+    _request.session = session;
+    _request.getInfo_action = getInfo->action;
+    _request.getInfo_subactionPath = getInfo->subactionPath;
 
-    // start timer after synchronization
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 31;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrGetActionStateFloat _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    state->currentState = _response.state_currentState;
+    state->changedSinceLastSync = _response.state_changedSinceLastSync;
+    state->lastChangeTime = _response.state_lastChangeTime + time_offset;
+    state->isActive = _response.state_isActive;
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrGetActionStateFloat");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStateFloat: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateFloat(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateFloat* state) try {
+    ActionStates* action_states = get_runtime().get_action_states();
+    if (!action_states) {
+        return unsynced_xrGetActionStateFloat(session, getInfo, state);
+    }
+
+    // states only change in xrSyncActions, which fetches the ones queried before it, see action_states.h
+    SampledCall call(31);
+    SerializeContext call_ctx(call);
+    serialize(&session, call_ctx);
+    serialize_ptr(getInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_output_xr_ptr(state, 1, call_ctx);
+
+    QueryBuffer response;
+    if (!action_states->take_snapshot(handle_value(session), std::move(call), response)) {
+        return unsynced_xrGetActionStateFloat(session, getInfo, state);
+    }
+    DeserializeContext d_ctx(response, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the query is made again, so that the error is for this call
+        return unsynced_xrGetActionStateFloat(session, getInfo, state);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&state, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStateFloat: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unpacked_xrGetActionStatePose(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStatePose* state) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 32;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12213,36 +17405,115 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStatePose(XrSession session, const XrA
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetActionStatePose");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetActionStatePose");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetActionStatePose: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateVector2f(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateVector2f* state) try {
+static XrResult unsynced_xrGetActionStatePose(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStatePose* state) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!getInfo || getInfo->type != XR_TYPE_ACTION_STATE_GET_INFO || getInfo->next || !state || state->type != XR_TYPE_ACTION_STATE_POSE || state->next) {
+        return unpacked_xrGetActionStatePose(session, getInfo, state);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrGetActionStatePose _request{};
+    _request.session = session;
+    _request.getInfo_action = getInfo->action;
+    _request.getInfo_subactionPath = getInfo->subactionPath;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 32;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrGetActionStatePose _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    state->isActive = _response.state_isActive;
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrGetActionStatePose");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStatePose: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStatePose(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStatePose* state) try {
+    ActionStates* action_states = get_runtime().get_action_states();
+    if (!action_states) {
+        return unsynced_xrGetActionStatePose(session, getInfo, state);
+    }
+
+    // states only change in xrSyncActions, which fetches the ones queried before it, see action_states.h
+    SampledCall call(32);
+    SerializeContext call_ctx(call);
+    serialize(&session, call_ctx);
+    serialize_ptr(getInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_output_xr_ptr(state, 1, call_ctx);
+
+    QueryBuffer response;
+    if (!action_states->take_snapshot(handle_value(session), std::move(call), response)) {
+        return unsynced_xrGetActionStatePose(session, getInfo, state);
+    }
+    DeserializeContext d_ctx(response, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the query is made again, so that the error is for this call
+        return unsynced_xrGetActionStatePose(session, getInfo, state);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&state, d_ctx);
 
-    // start timer after synchronization
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStatePose: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unpacked_xrGetActionStateVector2f(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateVector2f* state) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 33;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(state, 1, s_ctx);
+    serialize_output_xr_ptr(state, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12250,36 +17521,119 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateVector2f(XrSession session, const
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&state, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetActionStateVector2f");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetActionStateVector2f");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetActionStateVector2f: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetCurrentInteractionProfile(XrSession session, XrPath topLevelUserPath, XrInteractionProfileState* interactionProfile) try {
+static XrResult unsynced_xrGetActionStateVector2f(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateVector2f* state) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!getInfo || getInfo->type != XR_TYPE_ACTION_STATE_GET_INFO || getInfo->next || !state || state->type != XR_TYPE_ACTION_STATE_VECTOR2F || state->next) {
+        return unpacked_xrGetActionStateVector2f(session, getInfo, state);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrGetActionStateVector2f _request{};
+    _request.session = session;
+    _request.getInfo_action = getInfo->action;
+    _request.getInfo_subactionPath = getInfo->subactionPath;
 
-    // start timer after synchronization
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 33;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrGetActionStateVector2f _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    state->currentState = _response.state_currentState;
+    state->changedSinceLastSync = _response.state_changedSinceLastSync;
+    state->lastChangeTime = _response.state_lastChangeTime + time_offset;
+    state->isActive = _response.state_isActive;
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrGetActionStateVector2f");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStateVector2f: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetActionStateVector2f(XrSession session, const XrActionStateGetInfo* getInfo, XrActionStateVector2f* state) try {
+    ActionStates* action_states = get_runtime().get_action_states();
+    if (!action_states) {
+        return unsynced_xrGetActionStateVector2f(session, getInfo, state);
+    }
+
+    // states only change in xrSyncActions, which fetches the ones queried before it, see action_states.h
+    SampledCall call(33);
+    SerializeContext call_ctx(call);
+    serialize(&session, call_ctx);
+    serialize_ptr(getInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+    serialize_output_xr_ptr(state, 1, call_ctx);
+
+    QueryBuffer response;
+    if (!action_states->take_snapshot(handle_value(session), std::move(call), response)) {
+        return unsynced_xrGetActionStateVector2f(session, getInfo, state);
+    }
+    DeserializeContext d_ctx(response, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    if (XR_FAILED(result)) {
+        // the query is made again, so that the error is for this call
+        return unsynced_xrGetActionStateVector2f(session, getInfo, state);
+    }
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+    deserialize_ptr(&state, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetActionStateVector2f: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetCurrentInteractionProfile(XrSession session, XrPath topLevelUserPath, XrInteractionProfileState* interactionProfile) try {
+    auto& transport = get_runtime().get_transport();
+
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 34;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&topLevelUserPath, s_ctx);
-    serialize_ptr(interactionProfile, 1, s_ctx);
+    serialize_output_xr_ptr(interactionProfile, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12287,9 +17641,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetCurrentInteractionProfile(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&interactionProfile, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetCurrentInteractionProfile");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetCurrentInteractionProfile");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetCurrentInteractionProfile: {}", e.what());
@@ -12299,63 +17653,77 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetInputSourceLocalizedName(XrSession session, const XrInputSourceLocalizedNameGetInfo* getInfo, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 35;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetInputSourceLocalizedName");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetInputSourceLocalizedName");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetInputSourceLocalizedName: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetInstanceProperties(XrInstance instance, XrInstanceProperties* instanceProperties) try {
+static XrResult fetch_xrGetInstanceProperties(XrInstance instance, XrInstanceProperties* instanceProperties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 36;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
-    serialize_ptr(instanceProperties, 1, s_ctx);
+    serialize_output_xr_ptr(instanceProperties, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12363,8 +17731,41 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetInstanceProperties(XrInstance instance, XrIn
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&instanceProperties, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetInstanceProperties");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetInstanceProperties");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetInstanceProperties: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetInstanceProperties(XrInstance instance, XrInstanceProperties* instanceProperties) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrGetInstanceProperties(instance, instanceProperties);
+    }
+
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 36);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize_output_xr_ptr(instanceProperties, 1, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&instanceProperties, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
 
+    result = fetch_xrGetInstanceProperties(instance, instanceProperties);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(instanceProperties, 1, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -12375,24 +17776,31 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrGetReferenceSpaceBoundsRect(XrSession session, XrReferenceSpaceType referenceSpaceType, XrExtent2Df* bounds) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 37;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize(&referenceSpaceType, s_ctx);
-    serialize_ptr(bounds, 1, s_ctx);
+    serialize_output_ptr(bounds, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12400,36 +17808,43 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetReferenceSpaceBoundsRect(XrSession session,
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bounds, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetReferenceSpaceBoundsRect");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetReferenceSpaceBoundsRect");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrGetReferenceSpaceBoundsRect: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetSystem(XrInstance instance, const XrSystemGetInfo* getInfo, XrSystemId* systemId) try {
+static XrResult fetch_xrGetSystem(XrInstance instance, const XrSystemGetInfo* getInfo, XrSystemId* systemId) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 38;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
-    serialize_ptr(systemId, 1, s_ctx);
+    serialize_output_ptr(systemId, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12437,8 +17852,42 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSystem(XrInstance instance, const XrSystemGe
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&systemId, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSystem");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSystem");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetSystem: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetSystem(XrInstance instance, const XrSystemGetInfo* getInfo, XrSystemId* systemId) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrGetSystem(instance, getInfo, systemId);
+    }
+
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 38);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize_ptr(getInfo, 1, key_ctx);
+    serialize_output_ptr(systemId, 1, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&systemId, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
 
+    result = fetch_xrGetSystem(instance, getInfo, systemId);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(systemId, 1, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -12446,27 +17895,34 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetSystemProperties(XrInstance instance, XrSystemId systemId, XrSystemProperties* properties) try {
+static XrResult fetch_xrGetSystemProperties(XrInstance instance, XrSystemId systemId, XrSystemProperties* properties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 39;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
-    serialize_ptr(properties, 1, s_ctx);
+    serialize_output_xr_ptr(properties, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12474,8 +17930,42 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetSystemProperties(XrInstance instance, XrSyst
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&properties, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetSystemProperties");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetSystemProperties");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetSystemProperties: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetSystemProperties(XrInstance instance, XrSystemId systemId, XrSystemProperties* properties) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrGetSystemProperties(instance, systemId, properties);
+    }
+
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 39);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize_output_xr_ptr(properties, 1, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&properties, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
 
+    result = fetch_xrGetSystemProperties(instance, systemId, properties);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(properties, 1, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -12483,28 +17973,35 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrGetViewConfigurationProperties(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, XrViewConfigurationProperties* configurationProperties) try {
+static XrResult fetch_xrGetViewConfigurationProperties(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, XrViewConfigurationProperties* configurationProperties) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 40;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&systemId, s_ctx);
     serialize(&viewConfigurationType, s_ctx);
-    serialize_ptr(configurationProperties, 1, s_ctx);
+    serialize_output_xr_ptr(configurationProperties, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12512,8 +18009,43 @@ XRAPI_ATTR XrResult XRAPI_CALL xrGetViewConfigurationProperties(XrInstance insta
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&configurationProperties, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrGetViewConfigurationProperties");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrGetViewConfigurationProperties");
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrGetViewConfigurationProperties: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrGetViewConfigurationProperties(XrInstance instance, XrSystemId systemId, XrViewConfigurationType viewConfigurationType, XrViewConfigurationProperties* configurationProperties) try {
+    QueryCache* query_cache = get_runtime().get_query_cache();
+    if (!query_cache) {
+        return fetch_xrGetViewConfigurationProperties(instance, systemId, viewConfigurationType, configurationProperties);
+    }
+
+    // the results don't change for the lifetime of instance, see query_cache.h
+    QueryKey key(handle_value(instance), 40);
+    SerializeContext key_ctx(key);
+    serialize(&instance, key_ctx);
+    serialize(&systemId, key_ctx);
+    serialize(&viewConfigurationType, key_ctx);
+    serialize_output_xr_ptr(configurationProperties, 1, key_ctx);
+
+    XrResult result{};
+    QueryBuffer outputs;
+    if (query_cache->lookup(key, result, outputs)) {
+        DeserializeContext outputs_ctx(outputs, true, 0);
+        deserialize_ptr(&configurationProperties, outputs_ctx);
+        return get_runtime().get_deferred_errors().report(result);
+    }
 
+    result = fetch_xrGetViewConfigurationProperties(instance, systemId, viewConfigurationType, configurationProperties);
+    if (result == XR_SUCCESS) {
+        SerializeContext outputs_ctx(outputs);
+        serialize_ptr(configurationProperties, 1, outputs_ctx);
+        query_cache->store(key, result, outputs);
+    }
     return result;
 }
 catch (const std::exception& e) {
@@ -12521,28 +18053,35 @@ catch (const std::exception& e) {
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateSpace(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation* location) try {
+static XrResult unpacked_xrLocateSpace(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation* location) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 41;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&space, s_ctx);
     serialize(&baseSpace, s_ctx);
     serialize_time(&time, s_ctx);
-    serialize_ptr(location, 1, s_ctx);
+    serialize_output_xr_ptr(location, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12550,36 +18089,93 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateSpace(XrSpace space, XrSpace baseSpace, X
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&location, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateSpace");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateSpace");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateSpace: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateSpaces(XrSession session, const XrSpacesLocateInfo* locateInfo, XrSpaceLocations* spaceLocations) try {
+static XrResult unfused_xrLocateSpace(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation* location) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!location || location->type != XR_TYPE_SPACE_LOCATION || location->next) {
+        return unpacked_xrLocateSpace(space, baseSpace, time, location);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrLocateSpace _request{};
+    _request.space = space;
+    _request.baseSpace = baseSpace;
+    _request.time = time - time_offset;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 41;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrLocateSpace _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+    location->locationFlags = _response.location_locationFlags;
+    location->pose = _response.location_pose;
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrLocateSpace");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateSpace: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateSpace(XrSpace space, XrSpace baseSpace, XrTime time, XrSpaceLocation* location) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrLocateSpace(space, baseSpace, time, location);
+    }
+    return frame_loop->locate_space(space, baseSpace, time, location, unfused_xrLocateSpace);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateSpace: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateSpaces(XrSession session, const XrSpacesLocateInfo* locateInfo, XrSpaceLocations* spaceLocations) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 42;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(locateInfo, 1, s_ctx);
     serialize_ptr(spaceLocations, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12587,39 +18183,46 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateSpaces(XrSession session, const XrSpacesL
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&spaceLocations, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateSpaces");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateSpaces");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateSpaces: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo, XrViewState* viewState, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views) try {
+static XrResult unfused_xrLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo, XrViewState* viewState, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 43;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(viewLocateInfo, 1, s_ctx);
-    serialize_ptr(viewState, 1, s_ctx);
+    serialize_output_xr_ptr(viewState, 1, s_ctx);
     serialize(&viewCapacityInput, s_ctx);
-    serialize_ptr(viewCountOutput, 1, s_ctx);
-    serialize_ptr(views, viewCapacityInput, s_ctx);
+    serialize_output_ptr(viewCountOutput, 1, s_ctx);
+    serialize_output_xr_ptr(views, viewCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12627,11 +18230,23 @@ XRAPI_ATTR XrResult XRAPI_CALL xrLocateViews(XrSession session, const XrViewLoca
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&viewState, d_ctx);
     deserialize_ptr(&viewCountOutput, d_ctx);
-    deserialize_ptr(&views, d_ctx);
+    deserialize_filled_ptr(views, viewCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrLocateViews");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrLocateViews");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrLocateViews: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrLocateViews(XrSession session, const XrViewLocateInfo* viewLocateInfo, XrViewState* viewState, uint32_t viewCapacityInput, uint32_t* viewCountOutput, XrView* views) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrLocateViews(session, viewLocateInfo, viewState, viewCapacityInput, viewCountOutput, views);
+    }
+    return frame_loop->locate_views(session, viewLocateInfo, viewState, viewCapacityInput, viewCountOutput, views, unfused_xrLocateViews);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrLocateViews: {}", e.what());
@@ -12641,37 +18256,44 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPathToString(XrInstance instance, XrPath path, uint32_t bufferCapacityInput, uint32_t* bufferCountOutput, char* buffer) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 44;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&path, s_ctx);
     serialize(&bufferCapacityInput, s_ctx);
-    serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_output_ptr(bufferCountOutput, 1, s_ctx);
+    serialize_output_ptr(buffer, bufferCapacityInput, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&bufferCountOutput, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, bufferCapacityInput, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPathToString");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPathToString");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPathToString: {}", e.what());
@@ -12681,23 +18303,30 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrPollEvent(XrInstance instance, XrEventDataBuffer* eventData) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 45;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
-    serialize_ptr(eventData, 1, s_ctx);
+    serialize_output_xr_ptr(eventData, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12705,78 +18334,125 @@ XRAPI_ATTR XrResult XRAPI_CALL xrPollEvent(XrInstance instance, XrEventDataBuffe
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&eventData, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrPollEvent");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrPollEvent");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrPollEvent: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo* releaseInfo) try {
+static XrResult unpacked_xrReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo* releaseInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 46;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize_ptr(releaseInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrReleaseSwapchainImage");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrReleaseSwapchainImage");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrReleaseSwapchainImage: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrRequestExitSession(XrSession session) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrReleaseSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageReleaseInfo* releaseInfo) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!releaseInfo || releaseInfo->type != XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO || releaseInfo->next) {
+        return unpacked_xrReleaseSwapchainImage(swapchain, releaseInfo);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrReleaseSwapchainImage _request{};
+    _request.swapchain = swapchain;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 46;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrReleaseSwapchainImage _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrReleaseSwapchainImage");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrReleaseSwapchainImage: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrRequestExitSession(XrSession session) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 47;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrRequestExitSession");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrRequestExitSession");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrRequestExitSession: {}", e.what());
@@ -12786,96 +18462,185 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrResultToString(XrInstance instance, XrResult value, char buffer[XR_MAX_RESULT_STRING_SIZE]) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 48;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&value, s_ctx);
-    serialize_array(buffer, XR_MAX_RESULT_STRING_SIZE, s_ctx);
+    serialize_string_array(buffer, XR_MAX_RESULT_STRING_SIZE, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, XR_MAX_RESULT_STRING_SIZE, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrResultToString");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrResultToString");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrResultToString: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrStopHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo) try {
+static XrResult oneway_xrStopHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrDuration time_offset = get_time_offset();
+
+    // there is no response, errors are reported by a later call, see deferred_errors.h
+    auto msg_out = transport.start_message(XRTP_MSG_ONEWAY_FUNCTION_CALL);
+
+    uint32_t function_id = 49;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
+    serialize(&session, s_ctx);
+    serialize_ptr(hapticActionInfo, 1, s_ctx);
+    params_out.finish();
+    msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
+
+    return XR_SUCCESS;
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrStopHapticFeedback: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+static XrResult unpacked_xrStopHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 49;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(hapticActionInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStopHapticFeedback");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStopHapticFeedback");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStopHapticFeedback: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrStringToPath(XrInstance instance, const char* pathString, XrPath* path) try {
+XRAPI_ATTR XrResult XRAPI_CALL xrStopHapticFeedback(XrSession session, const XrHapticActionInfo* hapticActionInfo) try {
+    if (get_runtime().has_feature(XRTP_FEATURE_ONEWAY_CALLS)) {
+        return oneway_xrStopHapticFeedback(session, hapticActionInfo);
+    }
+
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!hapticActionInfo || hapticActionInfo->type != XR_TYPE_HAPTIC_ACTION_INFO || hapticActionInfo->next) {
+        return unpacked_xrStopHapticFeedback(session, hapticActionInfo);
+    }
+
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrStopHapticFeedback _request{};
+    _request.session = session;
+    _request.hapticActionInfo_action = hapticActionInfo->action;
+    _request.hapticActionInfo_subactionPath = hapticActionInfo->subactionPath;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 49;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrStopHapticFeedback _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrStopHapticFeedback");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrStopHapticFeedback: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrStringToPath(XrInstance instance, const char* pathString, XrPath* path) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 50;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
-    serialize_ptr(pathString, count_null_terminated(pathString), s_ctx);
-    serialize_ptr(path, 1, s_ctx);
+    serialize_string(pathString, s_ctx);
+    serialize_output_ptr(path, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -12883,9 +18648,9 @@ XRAPI_ATTR XrResult XRAPI_CALL xrStringToPath(XrInstance instance, const char* p
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&path, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStringToPath");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStringToPath");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStringToPath: {}", e.what());
@@ -12895,34 +18660,41 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrStructureTypeToString(XrInstance instance, XrStructureType value, char buffer[XR_MAX_STRUCTURE_NAME_SIZE]) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 51;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize(&value, s_ctx);
-    serialize_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE, s_ctx);
+    serialize_string_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_string_buffer(buffer, XR_MAX_STRUCTURE_NAME_SIZE, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrStructureTypeToString");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrStructureTypeToString");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrStructureTypeToString: {}", e.what());
@@ -12932,94 +18704,143 @@ catch (const std::exception& e) {
 XRAPI_ATTR XrResult XRAPI_CALL xrSuggestInteractionProfileBindings(XrInstance instance, const XrInteractionProfileSuggestedBinding* suggestedBindings) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 52;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&instance, s_ctx);
     serialize_ptr(suggestedBindings, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSuggestInteractionProfileBindings");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSuggestInteractionProfileBindings");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSuggestInteractionProfileBindings: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrSyncActions(XrSession session, const XrActionsSyncInfo* syncInfo) try {
+static XrResult unsynced_xrSyncActions(XrSession session, const XrActionsSyncInfo* syncInfo) try {
     auto& transport = get_runtime().get_transport();
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
-
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 53;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(syncInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrSyncActions");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrSyncActions");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrSyncActions: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrWaitFrame(XrSession session, const XrFrameWaitInfo* frameWaitInfo, XrFrameState* frameState) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrSyncActions(XrSession session, const XrActionsSyncInfo* syncInfo) try {
+    ActionStates* action_states = get_runtime().get_action_states();
+    if (!action_states) {
+        return unsynced_xrSyncActions(session, syncInfo);
+    }
+
+    // the states queried since the last sync are fetched along with this one, see action_states.h
+    SampledCall call(53);
+    SerializeContext call_ctx(call);
+    serialize(&session, call_ctx);
+    serialize_ptr(syncInfo, 1, call_ctx);
+    call.key_size = call.bytes.size();
+
+    QueryBuffer response;
+    action_states->sync_actions(handle_value(session), call, response);
+    DeserializeContext d_ctx(response, true, get_time_offset());
+    XrResult result;
+    deserialize(&result, d_ctx);
+    XrDuration runtime_duration;
+    deserialize(&runtime_duration, d_ctx);
+
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrSyncActions: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unfused_xrWaitFrame(XrSession session, const XrFrameWaitInfo* frameWaitInfo, XrFrameState* frameState) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 54;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&session, s_ctx);
     serialize_ptr(frameWaitInfo, 1, s_ctx);
-    serialize_ptr(frameState, 1, s_ctx);
+    serialize_output_xr_ptr(frameState, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
@@ -13027,44 +18848,97 @@ XRAPI_ATTR XrResult XRAPI_CALL xrWaitFrame(XrSession session, const XrFrameWaitI
     deserialize(&runtime_duration, d_ctx);
     deserialize_ptr(&frameState, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrWaitFrame");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrWaitFrame");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrWaitFrame: {}", e.what());
     return XR_ERROR_RUNTIME_FAILURE;
 }
 
-XRAPI_ATTR XrResult XRAPI_CALL xrWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo) try {
-    auto& transport = get_runtime().get_transport();
+XRAPI_ATTR XrResult XRAPI_CALL xrWaitFrame(XrSession session, const XrFrameWaitInfo* frameWaitInfo, XrFrameState* frameState) try {
+    FrameLoop* frame_loop = get_runtime().get_frame_loop();
+    if (!frame_loop) {
+        return unfused_xrWaitFrame(session, frameWaitInfo, frameState);
+    }
+    return frame_loop->wait_frame(session, frameWaitInfo, frameState, unfused_xrWaitFrame);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrWaitFrame: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
 
-    // synchronize if needed and get time offset
-    XrDuration time_offset = get_time_offset(true);
+static XrResult unpacked_xrWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo) try {
+    auto& transport = get_runtime().get_transport();
 
-    // start timer after synchronization
+    XrDuration time_offset = get_time_offset();
     XrTime start_time = start_rpc_timer();
 
     auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_CALL);
-    SerializeContext s_ctx(msg_out.buffer, time_offset);
 
     uint32_t function_id = 55;
-    serialize(&function_id, s_ctx);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+
+    // params are delta encoded against the previous call if the server accepted it
+    DeltaWriteStream params_out(msg_out.buffer, get_runtime().get_delta_encoder(), function_id);
+    SerializeContext s_ctx(params_out, time_offset);
+    s_ctx.strings = begin_strings(get_runtime().get_request_strings());
+    s_ctx.handles = begin_handles(get_runtime().get_request_handles());
     serialize(&swapchain, s_ctx);
     serialize_ptr(waitInfo, 1, s_ctx);
+    params_out.finish();
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
     DeserializeContext d_ctx(msg_in.buffer, true, time_offset);
+    d_ctx.strings = get_runtime().get_response_strings();
+    d_ctx.handles = get_runtime().get_response_handles();
 
     XrResult result;
     deserialize(&result, d_ctx);
     XrDuration runtime_duration;
     deserialize(&runtime_duration, d_ctx);
 
-    end_rpc_timer(start_time, runtime_duration, "xrWaitSwapchainImage");
+    end_rpc_timer(start_time, runtime_duration, msg_in, "xrWaitSwapchainImage");
 
-    return result;
+    return get_runtime().get_deferred_errors().report(result);
+}
+catch (const std::exception& e) {
+    spdlog::error("Exception in xrWaitSwapchainImage: {}", e.what());
+    return XR_ERROR_RUNTIME_FAILURE;
+}
+
+XRAPI_ATTR XrResult XRAPI_CALL xrWaitSwapchainImage(XrSwapchain swapchain, const XrSwapchainImageWaitInfo* waitInfo) try {
+    // anything but plain values and structs without next chains uses the generic encoding
+    if (!waitInfo || waitInfo->type != XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO || waitInfo->next) {
+        return unpacked_xrWaitSwapchainImage(swapchain, waitInfo);
+    }
+
+    auto& transport = get_runtime().get_transport();
+
+    XrTime start_time = start_rpc_timer();
+
+    // the params are sent as one fixed layout frame, see packed_calls.h
+    Request_xrWaitSwapchainImage _request{};
+    _request.swapchain = swapchain;
+    _request.waitInfo_timeout = waitInfo->timeout;
+
+    auto msg_out = transport.start_message(XRTP_MSG_PACKED_FUNCTION_CALL);
+    uint32_t function_id = 55;
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&_request, sizeof(_request)));
+    msg_out.flush();
+
+    auto msg_in = transport.await_message(XRTP_MSG_FUNCTION_RETURN);
+    Response_xrWaitSwapchainImage _response{};
+    asio::read(msg_in.buffer, asio::buffer(&_response, sizeof(_response)));
+
+    end_rpc_timer(start_time, _response.runtime_duration, msg_in, "xrWaitSwapchainImage");
+
+    return get_runtime().get_deferred_errors().report(_response.result);
 }
 catch (const std::exception& e) {
     spdlog::error("Exception in xrWaitSwapchainImage: {}", e.what());
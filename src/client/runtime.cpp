@@ -3,9 +3,12 @@
 #include "runtime.h"
 
 #include "xrtransport/config/config.h"
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/time.h"
 
 #include "asio.hpp"
 #include "openxr/openxr.h"
+#include <spdlog/spdlog.h>
 
 #include <stdexcept>
 #include <iostream>
@@ -25,7 +28,7 @@ static asio::io_context io_context;
 static std::unique_ptr<Runtime> runtime;
 static std::unique_ptr<Config> config;
 
-static bool do_handshake(SyncDuplexStream& stream) {
+static bool do_handshake(SyncDuplexStream& stream, const ConnectionOptions& requested, ConnectionOptions& accepted) {
     // handle magic
     uint32_t client_magic = XRTRANSPORT_MAGIC;
     asio::write(stream, asio::buffer(&client_magic, sizeof(uint32_t)));
@@ -65,9 +68,115 @@ static bool do_handshake(SyncDuplexStream& stream) {
         return false;
     }
 
+    // negotiate optional features
+    asio::write(stream, asio::buffer(&requested.features, sizeof(xrtp_Features)));
+    asio::read(stream, asio::buffer(&accepted.features, sizeof(xrtp_Features)));
+    // the server may only accept features that were requested
+    accepted.features &= requested.features;
+
+    if (accepted.has_feature(XRTP_FEATURE_QUANTIZATION)) {
+        accepted.quantized_extensions = requested.quantized_extensions;
+        asio::write(stream, asio::buffer(&accepted.quantized_extensions, sizeof(uint64_t)));
+    }
+
+    if (accepted.has_feature(XRTP_FEATURE_SHARED_CLOCK)) {
+        // on the same kernel, the server's reading of the clock falls within the round trip
+        char boot_id[BOOT_ID_SIZE]{};
+        get_boot_id(boot_id);
+        XrTime ping_time = get_time();
+        asio::write(stream, asio::buffer(boot_id, BOOT_ID_SIZE));
+        XrTime server_time{};
+        asio::read(stream, asio::buffer(&server_time, sizeof(XrTime)));
+        XrTime pong_time = get_time();
+
+        uint32_t shared_clock = server_time != 0 && ping_time <= server_time && server_time <= pong_time;
+        asio::write(stream, asio::buffer(&shared_clock, sizeof(uint32_t)));
+        if (!shared_clock) {
+            accepted.features &= ~XRTP_FEATURE_SHARED_CLOCK;
+        }
+    }
+
     return true;
 }
 
+static ConnectionOptions requested_options(const Config& config) {
+    ConnectionOptions options;
+    if (config.delta_encoding) {
+        options.features |= XRTP_FEATURE_DELTA_ENCODING;
+    }
+    for (const std::string& extension_name : config.quantized_extensions) {
+        uint64_t bit = quantized_extension_bit(extension_name);
+        if (!bit) {
+            spdlog::warn("Extension {} has no arrays that can be quantized", extension_name);
+            continue;
+        }
+        options.quantized_extensions |= bit;
+    }
+    if (options.quantized_extensions) {
+        options.features |= XRTP_FEATURE_QUANTIZATION;
+    }
+    if (config.string_interning) {
+        options.features |= XRTP_FEATURE_STRING_INTERNING;
+    }
+    if (config.compact_encoding) {
+        if (XRTP_SUPPORTED_PLATFORM_FEATURES & XRTP_FEATURE_COMPACT_ENCODING) {
+            options.features |= XRTP_FEATURE_COMPACT_ENCODING;
+        }
+        else {
+            spdlog::warn("Compact encoding is only supported on 64-bit platforms");
+        }
+    }
+    if (config.pipelined_creation) {
+        // virtual handles are resolved through the handle table of compact encoding
+        if (options.features & XRTP_FEATURE_COMPACT_ENCODING) {
+            options.features |= XRTP_FEATURE_PIPELINED_CREATION;
+        }
+        else {
+            spdlog::warn("Pipelined creation requires compact encoding");
+        }
+    }
+    if (config.oneway_calls) {
+        options.features |= XRTP_FEATURE_ONEWAY_CALLS;
+    }
+    if (config.frame_loop_fusion) {
+        options.features |= XRTP_FEATURE_FRAME_LOOP_FUSION;
+    }
+    if (config.view_prefetch) {
+        // views are located along with speculative waits
+        if (options.features & XRTP_FEATURE_FRAME_LOOP_FUSION) {
+            options.features |= XRTP_FEATURE_VIEW_PREFETCH;
+        }
+        else {
+            spdlog::warn("View prefetch requires frame loop fusion");
+        }
+    }
+    if (config.space_prefetch) {
+        // spaces are located along with speculative waits
+        if (options.features & XRTP_FEATURE_FRAME_LOOP_FUSION) {
+            options.features |= XRTP_FEATURE_SPACE_PREFETCH;
+        }
+        else {
+            spdlog::warn("Space prefetch requires frame loop fusion");
+        }
+    }
+    if (config.tracker_sampling) {
+        // trackers are sampled along with speculative waits
+        if (options.features & XRTP_FEATURE_FRAME_LOOP_FUSION) {
+            options.features |= XRTP_FEATURE_TRACKER_SAMPLING;
+        }
+        else {
+            spdlog::warn("Tracker sampling requires frame loop fusion");
+        }
+    }
+    if (config.inband_timestamps) {
+        options.features |= XRTP_FEATURE_INBAND_TIMESTAMPS;
+    }
+    if (config.shared_clock) {
+        options.features |= XRTP_FEATURE_SHARED_CLOCK;
+    }
+    return options;
+}
+
 static std::unique_ptr<SyncDuplexStream> create_tcp_connection(std::string ip, uint16_t port) {
     tcp::socket socket(io_context);
 
@@ -121,12 +230,13 @@ Runtime& get_runtime() {
         auto stream = create_connection();
 
         // Do the initial handshake
-        if (!do_handshake(*stream)) {
+        ConnectionOptions options;
+        if (!do_handshake(*stream, requested_options(*config), options)) {
             throw std::runtime_error("Transport handshake failed");
         }
 
         // Create the Transport instance
-        runtime = std::make_unique<Runtime>(std::move(stream));
+        runtime = std::make_unique<Runtime>(std::move(stream), options, config->query_cache, config->action_state_snapshot);
 
         // Start Transport thread
         runtime->get_transport().start();
@@ -135,4 +245,29 @@ Runtime& get_runtime() {
     return *runtime;
 }
 
+XrDuration get_time_offset() {
+    return get_runtime().get_clock_sync().get_time_offset();
+}
+
+void enable_synchronization() {
+    get_runtime().get_clock_sync().start();
+}
+
+void disable_synchronization() {
+    ClockSync& clock_sync = get_runtime().get_clock_sync();
+    clock_sync.stop();
+
+    ClockSyncStats stats = clock_sync.get_stats();
+    spdlog::info(
+        "Clock synchronization stopped after {} samples: "
+        "Offset: {:.3f} milliseconds, "
+        "Drift: {:.2f} ppm, "
+        "Uncertainty: {:.3f} milliseconds",
+        stats.samples,
+        (float)stats.offset / 1000000,
+        stats.drift_ppm,
+        (float)stats.uncertainty / 1000000
+    );
+}
+
 } // namespace xrtransport
\ No newline at end of file
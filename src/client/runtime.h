@@ -4,9 +4,19 @@
 #define XRTRANSPORT_CLIENT_RUNTIME_H
 
 #include "xrtransport/transport/transport.h"
+#include "xrtransport/transport/connection_options.h"
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/virtual_handles.h"
 #include "xrtransport/asio_compat.h"
 
 #include "function_table.h"
+#include "deferred_errors.h"
+#include "synchronization.h"
+#include "query_cache.h"
+#include "action_states.h"
+#include "frame_loop.h"
 
 #include <memory>
 
@@ -16,16 +26,123 @@ class Runtime {
 private:
     Transport transport;
     FunctionTable function_table;
+    ConnectionOptions options;
+    DeltaEncoder delta_encoder;
+    StringInterner request_strings;
+    StringTable response_strings;
+    HandleInterner request_handles;
+    HandleTable response_handles;
+    VirtualHandleAllocator virtual_handles;
+    DeferredErrors deferred_errors;
+    bool query_cache_enabled;
+    QueryCache query_cache;
+    bool action_states_enabled;
+    ActionStates action_states;
+    FrameLoop frame_loop;
+    // last, so that its thread stops before anything it uses is destroyed
+    ClockSync clock_sync;
 
 public:
-    explicit Runtime(std::unique_ptr<SyncDuplexStream> stream)
-        : transport(std::move(stream))
-    {}
+    explicit Runtime(std::unique_ptr<SyncDuplexStream> stream, ConnectionOptions options, bool query_cache_enabled, bool action_states_enabled)
+        : transport(std::move(stream)), options(options), query_cache_enabled(query_cache_enabled),
+            action_states_enabled(action_states_enabled), action_states(transport), frame_loop(transport, deferred_errors, clock_sync, options.has_feature(XRTP_FEATURE_VIEW_PREFETCH),
+            options.has_feature(XRTP_FEATURE_SPACE_PREFETCH), options.has_feature(XRTP_FEATURE_TRACKER_SAMPLING)), clock_sync(transport, options.has_feature(XRTP_FEATURE_SHARED_CLOCK))
+    {
+        if (has_feature(XRTP_FEATURE_PIPELINED_CREATION) || has_feature(XRTP_FEATURE_ONEWAY_CALLS) ||
+            has_feature(XRTP_FEATURE_FRAME_LOOP_FUSION)) {
+            transport.register_handler(XRTP_MSG_DEFERRED_ERROR, [this](MessageLockIn msg_in) {
+                deferred_errors.handle_message(std::move(msg_in));
+            });
+        }
+        if (has_feature(XRTP_FEATURE_FRAME_LOOP_FUSION)) {
+            transport.register_handler(XRTP_MSG_FRAME_STATE, [this](MessageLockIn msg_in) {
+                frame_loop.handle_message(std::move(msg_in));
+            });
+        }
+    }
 
     Transport& get_transport() {
         return transport;
     }
 
+    /**
+     * Check whether an optional protocol feature was accepted by the server during the handshake.
+     */
+    bool has_feature(xrtp_Features feature) const {
+        return options.has_feature(feature);
+    }
+
+    /**
+     * @return The request delta encoder, or nullptr if delta encoding was not negotiated
+     */
+    DeltaEncoder* get_delta_encoder() {
+        return has_feature(XRTP_FEATURE_DELTA_ENCODING) ? &delta_encoder : nullptr;
+    }
+
+    /**
+     * @return The table of strings sent in requests, or nullptr if string interning was not negotiated
+     */
+    StringInterner* get_request_strings() {
+        return has_feature(XRTP_FEATURE_STRING_INTERNING) ? &request_strings : nullptr;
+    }
+
+    /**
+     * @return The table of strings received in responses, or nullptr if string interning was not negotiated
+     */
+    StringTable* get_response_strings() {
+        return has_feature(XRTP_FEATURE_STRING_INTERNING) ? &response_strings : nullptr;
+    }
+
+    /**
+     * @return The table of handles sent in requests, or nullptr if compact encoding was not negotiated
+     */
+    HandleInterner* get_request_handles() {
+        return has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &request_handles : nullptr;
+    }
+
+    /**
+     * @return The table of handles received in responses, or nullptr if compact encoding was not negotiated
+     */
+    HandleTable* get_response_handles() {
+        return has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &response_handles : nullptr;
+    }
+
+    /**
+     * @return The allocator of handles returned by pipelined calls, or nullptr if pipelined creation was not negotiated
+     */
+    VirtualHandleAllocator* get_virtual_handles() {
+        return has_feature(XRTP_FEATURE_PIPELINED_CREATION) ? &virtual_handles : nullptr;
+    }
+
+    DeferredErrors& get_deferred_errors() {
+        return deferred_errors;
+    }
+
+    /**
+     * @return The cache of instance and system queries, or nullptr if it was turned off in the config
+     */
+    QueryCache* get_query_cache() {
+        return query_cache_enabled ? &query_cache : nullptr;
+    }
+
+    /**
+     * @return The snapshot of action states, or nullptr if it was turned off in the config
+     */
+    ActionStates* get_action_states() {
+        return action_states_enabled ? &action_states : nullptr;
+    }
+
+    /**
+     * @return The speculative frame loop, or nullptr if frame loop fusion was not negotiated
+     */
+    FrameLoop* get_frame_loop() {
+        return has_feature(XRTP_FEATURE_FRAME_LOOP_FUSION) ? &frame_loop : nullptr;
+    }
+
+    ClockSync& get_clock_sync() {
+        return clock_sync;
+    }
+
     FunctionTable& get_function_table() {
         return function_table;
     }
@@ -38,6 +155,17 @@ public:
  */
 Runtime& get_runtime();
 
+/**
+ * Returns the offset between the local timer and the remote timer:
+ * time_offset = local - remote
+ *
+ * This never calls the server, the offset is kept up to date by the synchronization thread.
+ */
+XrDuration get_time_offset();
+
+void enable_synchronization();
+void disable_synchronization();
+
 } // namespace xrtransport
 
 #endif // XRTRANSPORT_CLIENT_RUNTIME_H
\ No newline at end of file
@@ -1,88 +1,279 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "synchronization.h"
-#include "runtime.h"
 
 #include "xrtransport/time.h"
 
 #include <asio.hpp>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace xrtransport {
 
-static XrTime last_sync = INT64_MIN;
-static XrDuration sync_interval = 200'000'000; // 200ms
-static int sync_iterations = 20;
+static void lower_thread_priority() {
+#if defined(_WIN32)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+    // the nice value is per thread on Linux
+    if (setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10) != 0) {
+        spdlog::debug("Failed to lower the priority of the synchronization thread");
+    }
+#endif
+}
+
+void ClockSync::reset() {
+    std::lock_guard<std::mutex> lock(estimator_mutex);
+    bins.clear();
+    bin_start = 0;
+    line_time = 0;
+    line_offset = 0;
+    line_drift = 0;
+    uncertainty = 0;
+    sample_count = 0;
+    inband_samples.store(false, std::memory_order_relaxed);
+}
+
+void ClockSync::add(XrTime t1, XrTime t2, XrTime t3, XrTime t4) {
+    if (t2 == 0 || t3 == 0 || t4 < t1 || t3 < t2) {
+        return;
+    }
+
+    // the server's time is taken somewhere in between t1 and t4, minus the time it took to respond
+    Sample sample{};
+    sample.local_time = t1 + (t4 - t1) / 2;
+    sample.offset = ((t1 - t2) + (t4 - t3)) / 2;
+    sample.delay = std::max<XrDuration>((t4 - t1) - (t3 - t2), 0);
+    sample_count++;
+
+    if (bins.empty() || sample.local_time >= bin_start + BIN_DURATION) {
+        bins.push_back(sample);
+        bin_start = sample.local_time;
+        if (bins.size() > MAX_BINS) {
+            bins.pop_front();
+        }
+    }
+    else if (sample.delay < bins.back().delay) {
+        bins.back() = sample;
+    }
+    else {
+        return;
+    }
+    fit();
+}
+
+void ClockSync::fit() {
+    XrDuration min_delay = std::min_element(bins.begin(), bins.end(),
+        [](const Sample& a, const Sample& b){ return a.delay < b.delay; })->delay;
+    // bins in which every round trip was held up would pull the line away
+    XrDuration max_delay = min_delay * 2 + 100'000;
 
-static bool synchronization_enabled = false;
-static XrDuration time_offset = 0;
+    // relative to the last bin, so that the sums stay precise
+    const Sample& last = bins.back();
+    double count = 0;
+    double sum_x = 0;
+    double sum_y = 0;
+    for (const Sample& bin : bins) {
+        if (bin.delay <= max_delay) {
+            count++;
+            sum_x += static_cast<double>(bin.local_time - last.local_time);
+            sum_y += static_cast<double>(bin.offset - last.offset);
+        }
+    }
+    double mean_x = sum_x / count;
+    double mean_y = sum_y / count;
 
-static void do_synchronize() {
-    Transport& transport = get_runtime().get_transport();
+    double sum_xx = 0;
+    double sum_xy = 0;
+    for (const Sample& bin : bins) {
+        if (bin.delay <= max_delay) {
+            double x = static_cast<double>(bin.local_time - last.local_time) - mean_x;
+            double y = static_cast<double>(bin.offset - last.offset) - mean_y;
+            sum_xx += x * x;
+            sum_xy += x * y;
+        }
+    }
+    double drift = sum_xx > 0 ? std::clamp(sum_xy / sum_xx, -MAX_DRIFT, MAX_DRIFT) : 0;
 
-    // keep stream locked while in between messages
-    auto lock = transport.acquire_message_lock();
+    double sum_residuals = 0;
+    for (const Sample& bin : bins) {
+        if (bin.delay <= max_delay) {
+            double x = static_cast<double>(bin.local_time - last.local_time) - mean_x;
+            double y = static_cast<double>(bin.offset - last.offset) - mean_y;
+            double residual = y - drift * x;
+            sum_residuals += residual * residual;
+        }
+    }
 
-    XrTime min_t1{};
-    XrTime min_t2{};
-    XrTime min_t3{};
-    XrDuration min_rtt = INT64_MAX;
+    line_time = last.local_time + std::llround(mean_x);
+    line_offset = static_cast<double>(last.offset) + mean_y;
+    line_drift = drift;
+    uncertainty = min_delay / 2 + std::llround(std::sqrt(sum_residuals / count));
+}
+
+XrDuration ClockSync::offset_at(XrTime time) const {
+    return std::llround(line_offset + line_drift * static_cast<double>(time - line_time));
+}
+
+void ClockSync::probe() {
+    XrTime t1{};
+    XrTime server_time{};
+    XrTime t4{};
+    {
+        // keep stream locked in between messages
+        auto lock = transport.acquire_message_lock();
 
-    for (int i = 0; i < sync_iterations; i++) {
         auto msg_out = transport.start_message(XRTP_MSG_SYNCHRONIZATION_REQUEST);
-        XrTime t1 = get_time();
+        t1 = get_time();
         asio::write(msg_out.buffer, asio::buffer(&t1, sizeof(XrTime)));
         msg_out.flush();
 
         auto msg_in = transport.await_message(XRTP_MSG_SYNCHRONIZATION_RESPONSE);
-        XrTime t2{};
-        asio::read(msg_in.buffer, asio::buffer(&t2, sizeof(XrTime)));
+        asio::read(msg_in.buffer, asio::buffer(&server_time, sizeof(XrTime)));
+        t4 = get_time();
+    }
 
-        XrTime t3 = get_time();
+    std::lock_guard<std::mutex> estimator_lock(estimator_mutex);
+    add(t1, server_time, server_time, t4);
+    publish(t4);
+}
 
-        XrDuration rtt = t3 - t1;
-        if (rtt < min_rtt) {
-            min_rtt = rtt;
-            min_t1 = t1;
-            min_t2 = t2;
-            min_t3 = t3;
-        }
+void ClockSync::convert_time() {
+    XrTime client_time{};
+    XrTime server_time{};
+    {
+        auto lock = transport.acquire_message_lock();
+
+        auto msg_out = transport.start_message(XRTP_MSG_SYNCHRONIZATION_REQUEST);
+        client_time = get_time();
+        asio::write(msg_out.buffer, asio::buffer(&client_time, sizeof(XrTime)));
+        msg_out.flush();
+
+        // the server converted client_time itself, so the round trip doesn't matter
+        auto msg_in = transport.await_message(XRTP_MSG_SYNCHRONIZATION_RESPONSE);
+        asio::read(msg_in.buffer, asio::buffer(&server_time, sizeof(XrTime)));
     }
 
-    XrDuration delay = min_rtt / 2;
-    time_offset = (min_t1 + delay) - min_t2;
-    last_sync = get_time();
+    std::lock_guard<std::mutex> estimator_lock(estimator_mutex);
+    line_time = client_time;
+    line_offset = static_cast<double>(client_time - server_time);
+    line_drift = 0;
+    uncertainty = 0;
+    sample_count++;
+    time_offset.store(client_time - server_time, std::memory_order_relaxed);
 }
 
-XrDuration get_time_offset(bool try_synchronize) {
-    if (try_synchronize && synchronization_enabled) {
-        XrTime time = get_time();
-        if (time > last_sync + sync_interval) {
-            XrDuration old_offset = time_offset;
-            XrTime start_time = get_time();
-            do_synchronize();
-            XrTime end_time = get_time();
-            XrDuration took = end_time - start_time;
-            XrDuration drift = old_offset - time_offset;
-            spdlog::debug(
-                "Synchronization complete. "
-                "Drift: {:.3f} milliseconds, "
-                "Took: {:.3f} milliseconds",
-                (float)drift / 1000000,
-                (float)took / 1000000
-            );
+void ClockSync::publish(XrTime now) {
+    if (!bins.empty()) {
+        time_offset.store(offset_at(now), std::memory_order_relaxed);
+    }
+}
+
+void ClockSync::start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (thread.joinable()) {
+        return;
+    }
+
+    reset();
+
+    if (shared_clock) {
+        convert_time();
+        spdlog::debug("Clock is shared with the server, time offset: {} nanoseconds", get_time_offset());
+        return;
+    }
+
+    XrTime start_time = get_time();
+    for (int i = 0; i < INITIAL_PROBES; i++) {
+        probe();
+    }
+    spdlog::debug("Initial synchronization took {:.3f} milliseconds", (float)(get_time() - start_time) / 1000000);
+
+    stopping = false;
+    thread = std::thread(&ClockSync::run, this);
+}
+
+void ClockSync::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!thread.joinable()) {
+            return;
         }
+        stopping = true;
     }
+    stop_condition.notify_all();
+    thread.join();
+}
 
-    return time_offset;
+void ClockSync::add_sample(XrTime t1, XrTime t2, XrTime t3, XrTime t4) {
+    if (shared_clock) {
+        // the offset is already exact
+        return;
+    }
+    inband_samples.store(true, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(estimator_mutex);
+    add(t1, t2, t3, t4);
+    publish(t4);
 }
 
-void enable_synchronization() {
-    synchronization_enabled = true;
+ClockSyncStats ClockSync::get_stats() {
+    std::lock_guard<std::mutex> lock(estimator_mutex);
+    ClockSyncStats stats;
+    stats.offset = shared_clock ? get_time_offset() : bins.empty() ? 0 : offset_at(get_time());
+    stats.drift_ppm = line_drift * 1e6;
+    stats.uncertainty = uncertainty;
+    stats.samples = sample_count;
+    return stats;
 }
 
-void disable_synchronization() {
-    synchronization_enabled = false;
+void ClockSync::run() {
+    lower_thread_priority();
+
+    int ticks = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (stop_condition.wait_for(lock, std::chrono::nanoseconds(PROBE_INTERVAL), [this]{ return stopping; })) {
+                return;
+            }
+        }
+
+        // calls with timestamps keep the offset fresh while the application is busy
+        if (inband_samples.exchange(false, std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> estimator_lock(estimator_mutex);
+            publish(get_time());
+        }
+        else {
+            try {
+                probe();
+            }
+            catch (const std::exception& e) {
+                spdlog::error("Synchronization failed, keeping the last time offset: {}", e.what());
+                return;
+            }
+        }
+
+        if (++ticks % (BIN_DURATION / PROBE_INTERVAL) == 0) {
+            ClockSyncStats stats = get_stats();
+            spdlog::debug(
+                "Synchronization: "
+                "Offset: {:.3f} milliseconds, "
+                "Drift: {:.2f} ppm, "
+                "Uncertainty: {:.3f} milliseconds",
+                (float)stats.offset / 1000000,
+                stats.drift_ppm,
+                (float)stats.uncertainty / 1000000
+            );
+        }
+    }
 }
 
-} // namespace xrtransport
\ No newline at end of file
+} // namespace xrtransport
@@ -3,24 +3,137 @@
 #ifndef XRTRANSPORT_CLIENT_SYNCHRONIZATION_H
 #define XRTRANSPORT_CLIENT_SYNCHRONIZATION_H
 
+#include "xrtransport/transport/transport.h"
+
 #include "openxr/openxr.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace xrtransport {
 
-/**
- * Returns the offset between the local timer and the remote timer:
- * time_offset = local - remote
- * 
- * If try_synchronize is true and it has been long enough since the last sync,
- * a full synchronization will be performed with the server via the Transport.
- * This means that if you call this method with try_synchronize=true, the
- * Transport *must* not be in the middle of sending or receiving any messages.
+struct ClockSyncStats {
+    XrDuration offset = 0; // local - remote, now
+    double drift_ppm = 0; // how fast the offset changes, in nanoseconds per millisecond
+    XrDuration uncertainty = 0;
+    std::uint64_t samples = 0; // round trips that were measured
+};
+
+/*
+ * Clock synchronization with the server
+ *
+ * Every round trip with timestamps gives a sample of the offset, which is off by at most half of the
+ * time the messages spent in transit. Samples are grouped into bins of BIN_DURATION, of which only the
+ * one with the lowest delay is kept, and a line is fitted through the bins of the last MAX_BINS whose
+ * delay isn't much higher than the lowest one. The line gives the offset at any time and the drift of
+ * the clocks, and its value is published atomically.
+ *
+ * When XRTP_FEATURE_INBAND_TIMESTAMPS is negotiated, the server stamps every XRTP_MSG_FUNCTION_RETURN
+ * with the times it received the call and sent the response, which gives a sample for every call. Round
+ * trips of XRTP_MSG_SYNCHRONIZATION_REQUEST are only needed without them: when synchronization is
+ * enabled, INITIAL_PROBES are made back to back, and from then on a thread of low priority makes one
+ * every PROBE_INTERVAL unless there were calls with timestamps since the last one. Each probe holds the
+ * message lock for only its own round trip, so calls wait for one probe at most.
+ *
+ * When XRTP_FEATURE_SHARED_CLOCK stayed enabled through the handshake, client and server read the same
+ * monotonic clock, so the offset is only what the runtime adds to it. It is then computed once when
+ * synchronization is enabled, by having the server convert the client's time itself, and nothing
+ * changes it afterwards.
  */
-XrDuration get_time_offset(bool try_synchronize = false);
+class ClockSync {
+public:
+    static constexpr int INITIAL_PROBES = 20;
+    static constexpr XrDuration PROBE_INTERVAL = 20'000'000; // 20ms
+    static constexpr XrDuration BIN_DURATION = 200'000'000; // 200ms
+    static constexpr std::size_t MAX_BINS = 25;
+    static constexpr double MAX_DRIFT = 500e-6;
+
+private:
+    struct Sample {
+        XrTime local_time; // halfway through the round trip
+        XrDuration offset;
+        XrDuration delay;
+    };
+
+    Transport& transport;
+    bool shared_clock;
+    std::atomic<XrDuration> time_offset{0};
+    // set by calls with timestamps, and cleared by the thread when it decides whether to probe
+    std::atomic<bool> inband_samples{false};
+
+    // Protects the samples and the fitted line, never held while waiting for the server
+    std::mutex estimator_mutex;
+    std::deque<Sample> bins; // oldest first, the last one is still being filled
+    XrTime bin_start = 0; // of the last bin
+    XrTime line_time = 0;
+    double line_offset = 0;
+    double line_drift = 0;
+    XrDuration uncertainty = 0;
+    std::uint64_t sample_count = 0;
+
+    std::mutex mutex;
+    std::condition_variable stop_condition;
+    bool stopping = false;
+    std::thread thread;
+
+    // estimator_mutex must be held
+    void add(XrTime t1, XrTime t2, XrTime t3, XrTime t4);
+    void fit();
+    XrDuration offset_at(XrTime time) const;
+
+    void probe();
+    void convert_time();
+    void publish(XrTime now);
+    void run();
+
+public:
+    ClockSync(Transport& transport, bool shared_clock) : transport(transport), shared_clock(shared_clock) {}
+
+    ClockSync(const ClockSync&) = delete;
+    ClockSync& operator=(const ClockSync&) = delete;
+
+    ~ClockSync() {
+        stop();
+    }
+
+    /**
+     * Measures the offset on the calling thread, which must not hold the message lock, and then starts
+     * the synchronization thread. Does nothing if it is already running. Samples from before the last
+     * stop are dropped, since they may be from another instance of the runtime. With a shared clock, the
+     * offset is computed exactly and no thread is started.
+     */
+    void start();
+
+    /**
+     * Stops the synchronization thread and waits for it, the offset stays at its last value.
+     */
+    void stop();
+
+    /**
+     * Adds the timestamps of a call, see XRTP_FEATURE_INBAND_TIMESTAMPS.
+     * @param t1 Local time the call was sent at
+     * @param t2 Server time it was received at, 0 if the server couldn't tell
+     * @param t3 Server time the response was sent at, 0 if the server couldn't tell
+     * @param t4 Local time the response was received at
+     */
+    void add_sample(XrTime t1, XrTime t2, XrTime t3, XrTime t4);
+
+    /**
+     * Drops all samples, as start() does. The offset stays at its last value until there are new ones.
+     */
+    void reset();
+
+    XrDuration get_time_offset() const {
+        return time_offset.load(std::memory_order_relaxed);
+    }
 
-void enable_synchronization();
-void disable_synchronization();
+    ClockSyncStats get_stats();
+};
 
 } // namespace xrtransport
 
-#endif // XRTRANSPORT_CLIENT_SYNCHRONIZATION
\ No newline at end of file
+#endif // XRTRANSPORT_CLIENT_SYNCHRONIZATION
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "two_call_cache.h"
+
+#include <utility>
+
+namespace xrtransport {
+
+void TwoCallCache::store(const TwoCallKey& key, XrResult result, const void* elements, std::uint32_t count, std::size_t element_size) {
+    const std::uint8_t* data = static_cast<const std::uint8_t*>(elements);
+    this->valid = true;
+    this->function_id = key.function_id;
+    this->params = key.params;
+    this->fetch_time = get_time();
+    this->result = result;
+    this->count = count;
+    this->elements.assign(data, data + count * element_size);
+}
+
+bool TwoCallCache::take(const TwoCallKey& key, XrResult& result, std::uint32_t& count, std::vector<std::uint8_t>& elements) {
+    if (!valid) {
+        return false;
+    }
+    // only ever used once
+    valid = false;
+    if (function_id != key.function_id || params != key.params || get_time() - fetch_time > TWO_CALL_CACHE_LIFETIME) {
+        return false;
+    }
+    result = this->result;
+    count = this->count;
+    elements = std::move(this->elements);
+    return true;
+}
+
+TwoCallCache& get_two_call_cache() {
+    thread_local TwoCallCache cache;
+    return cache;
+}
+
+} // namespace xrtransport
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_CLIENT_TWO_CALL_CACHE_H
+#define XRTRANSPORT_CLIENT_TWO_CALL_CACHE_H
+
+#include "xrtransport/asio_compat.h"
+#include "xrtransport/time.h"
+
+#include "openxr/openxr.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Client side collapse of the two-call idiom
+ *
+ * Applications call xrEnumerate* style functions once with a capacity of 0 to get the count, and again
+ * to get the elements. The generated stubs of these functions (see code_generation/bindings.py) send
+ * the size query with a large capacity instead, return only the count, and keep the elements in a
+ * per-thread cache. The following call with the same params is then answered without a round trip.
+ *
+ * An entry is only used once, and only shortly after it was fetched, so results never get much staler
+ * than they would have been with two round trips.
+ */
+
+// Size of the array sent with a size query, which also bounds the number of elements prefetched. Only
+// the filled elements are sent back. If there are more, the size query falls back to a plain one.
+constexpr std::size_t TWO_CALL_PREFETCH_SIZE = 64 * 1024;
+constexpr XrDuration TWO_CALL_CACHE_LIFETIME = 100'000'000; // 100ms
+
+/**
+ * The function and serialized params (other than the capacity, count and array) of a two-call.
+ */
+class TwoCallKey : public SyncWriteStream {
+public:
+    std::uint32_t function_id;
+    std::vector<std::uint8_t> params;
+
+    explicit TwoCallKey(std::uint32_t function_id) : function_id(function_id) {}
+
+    std::size_t write_some(const asio::const_buffer& buffer, asio::error_code& ec) override {
+        ec.clear();
+        const std::uint8_t* data = static_cast<const std::uint8_t*>(buffer.data());
+        params.insert(params.end(), data, data + buffer.size());
+        return buffer.size();
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer) override {
+        asio::error_code ec;
+        return write_some(buffer, ec);
+    }
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+};
+
+/**
+ * Holds the elements of the last size query made on a thread.
+ */
+class TwoCallCache {
+private:
+    bool valid = false;
+    std::uint32_t function_id = 0;
+    std::vector<std::uint8_t> params;
+    XrTime fetch_time = 0;
+    XrResult result = XR_SUCCESS;
+    std::uint32_t count = 0;
+    std::vector<std::uint8_t> elements;
+
+public:
+    void store(const TwoCallKey& key, XrResult result, const void* elements, std::uint32_t count, std::size_t element_size);
+
+    /**
+     * Takes the entry for key out of the cache, if there is a fresh one.
+     * @return Whether there was an entry, in which case result, count and elements are set
+     */
+    bool take(const TwoCallKey& key, XrResult& result, std::uint32_t& count, std::vector<std::uint8_t>& elements);
+};
+
+/**
+ * The cache of the calling thread.
+ */
+TwoCallCache& get_two_call_cache();
+
+/**
+ * Implements a two-call function on top of call, which makes the actual RPC.
+ *
+ * @param element_type The XrStructureType of the elements, or XR_TYPE_UNKNOWN if they aren't XR structs
+ * @param call Callable with the signature XrResult(uint32_t capacity, uint32_t* count_output, T* elements)
+ */
+template <typename T, typename Call>
+XrResult call_two_call(const TwoCallKey& key, std::uint32_t capacity, std::uint32_t* count_output, T* elements,
+    XrStructureType element_type, Call call)
+{
+    TwoCallCache& cache = get_two_call_cache();
+
+    if (capacity == 0 && count_output) {
+        // size query, fetch the elements along with the count
+        std::vector<T> prefetched(std::max<std::size_t>(1, TWO_CALL_PREFETCH_SIZE / sizeof(T)));
+        if (element_type != XR_TYPE_UNKNOWN) {
+            for (T& element : prefetched) {
+                reinterpret_cast<XrBaseOutStructure*>(&element)->type = element_type;
+            }
+        }
+        std::uint32_t count{};
+        XrResult result = call(static_cast<std::uint32_t>(prefetched.size()), &count, prefetched.data());
+        if (result == XR_ERROR_SIZE_INSUFFICIENT) {
+            // too many to prefetch, make the plain size query and let the application make the second call
+            return call(0, count_output, nullptr);
+        }
+        if (XR_SUCCEEDED(result)) {
+            *count_output = count;
+            cache.store(key, result, prefetched.data(), count, sizeof(T));
+        }
+        return result;
+    }
+
+    XrResult cached_result{};
+    std::uint32_t cached_count{};
+    std::vector<std::uint8_t> cached_elements;
+    if (capacity == 0 || !count_output || !elements || !cache.take(key, cached_result, cached_count, cached_elements)) {
+        return call(capacity, count_output, elements);
+    }
+    if (capacity < cached_count) {
+        *count_output = cached_count;
+        return XR_ERROR_SIZE_INSUFFICIENT;
+    }
+    if (element_type != XR_TYPE_UNKNOWN) {
+        // the prefetched elements had no next chains, so they can't fill in requested ones
+        for (std::uint32_t i = 0; i < cached_count; i++) {
+            const XrBaseOutStructure* element = reinterpret_cast<const XrBaseOutStructure*>(&elements[i]);
+            if (element->type != element_type || element->next) {
+                return call(capacity, count_output, elements);
+            }
+        }
+    }
+    if (cached_count) {
+        std::memcpy(elements, cached_elements.data(), cached_count * sizeof(T));
+    }
+    *count_output = cached_count;
+    return cached_result;
+}
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_CLIENT_TWO_CALL_CACHE_H
@@ -49,6 +49,21 @@ Config from_json(std::string json_str) {
         else {
             throw ConfigException("invalid transport_type: " + transport_type);
         }
+
+        result.delta_encoding = data.value("delta_encoding", false);
+        result.quantized_extensions = data.value("quantized_extensions", std::vector<std::string>{});
+        result.string_interning = data.value("string_interning", false);
+        result.compact_encoding = data.value("compact_encoding", false);
+        result.pipelined_creation = data.value("pipelined_creation", false);
+        result.oneway_calls = data.value("oneway_calls", false);
+        result.frame_loop_fusion = data.value("frame_loop_fusion", false);
+        result.view_prefetch = data.value("view_prefetch", false);
+        result.space_prefetch = data.value("space_prefetch", false);
+        result.tracker_sampling = data.value("tracker_sampling", false);
+        result.inband_timestamps = data.value("inband_timestamps", false);
+        result.shared_clock = data.value("shared_clock", false);
+        result.query_cache = data.value("query_cache", true);
+        result.action_state_snapshot = data.value("action_state_snapshot", true);
     }
     catch(const json::exception& e) {
         throw ConfigException(std::string("error parsing json: ") + e.what());
@@ -72,6 +87,36 @@ static std::string get_system_property(std::string property_name) {
     return result;
 }
 
+static bool get_bool_system_property(std::string property_name, bool default_value) {
+    if (!__system_property_find(property_name.c_str())) {
+        return default_value;
+    }
+    std::string value = get_system_property(property_name);
+    if (value == "true" || value == "1") {
+        return true;
+    }
+    else if (value == "false" || value == "0") {
+        return false;
+    }
+    throw ConfigException(property_name + " must be true or false");
+}
+
+// comma separated, empty if the property is not set
+static std::vector<std::string> get_list_system_property(std::string property_name) {
+    std::vector<std::string> result;
+    if (!__system_property_find(property_name.c_str())) {
+        return result;
+    }
+    std::stringstream value(get_system_property(property_name));
+    std::string item;
+    while (std::getline(value, item, ',')) {
+        if (!item.empty()) {
+            result.push_back(item);
+        }
+    }
+    return result;
+}
+
 Config from_android_system_properties() {
     Config result;
     std::string transport_type = get_system_property("xrtransport.transport_type");
@@ -98,6 +143,21 @@ Config from_android_system_properties() {
     else {
         throw ConfigException("invalid xrtransport.transport_type: " + transport_type);
     }
+
+    result.delta_encoding = get_bool_system_property("xrtransport.delta_encoding", false);
+    result.quantized_extensions = get_list_system_property("xrtransport.quantized_extensions");
+    result.string_interning = get_bool_system_property("xrtransport.string_interning", false);
+    result.compact_encoding = get_bool_system_property("xrtransport.compact_encoding", false);
+    result.pipelined_creation = get_bool_system_property("xrtransport.pipelined_creation", false);
+    result.oneway_calls = get_bool_system_property("xrtransport.oneway_calls", false);
+    result.frame_loop_fusion = get_bool_system_property("xrtransport.frame_loop_fusion", false);
+    result.view_prefetch = get_bool_system_property("xrtransport.view_prefetch", false);
+    result.space_prefetch = get_bool_system_property("xrtransport.space_prefetch", false);
+    result.tracker_sampling = get_bool_system_property("xrtransport.tracker_sampling", false);
+    result.inband_timestamps = get_bool_system_property("xrtransport.inband_timestamps", false);
+    result.shared_clock = get_bool_system_property("xrtransport.shared_clock", false);
+    result.query_cache = get_bool_system_property("xrtransport.query_cache", true);
+    result.action_state_snapshot = get_bool_system_property("xrtransport.action_state_snapshot", true);
     return result;
 }
 #endif
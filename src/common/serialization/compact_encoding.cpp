@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/error.h"
+#include "xrtransport/serialization/virtual_handles.h"
+
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <string>
+
+using std::uint8_t;
+using std::uint32_t;
+using std::uint64_t;
+using std::int64_t;
+
+namespace xrtransport {
+
+static constexpr uint64_t CORE_STRUCT_CODES = 64;
+static constexpr uint64_t TABLE_STRUCT_CODES = 64;
+static constexpr uint64_t FIRST_EXTENSION_STRUCT_TYPE = 1000000000;
+
+const XrStructureType COMPACT_STRUCT_TYPES[] = {
+    // composition layers
+    XR_TYPE_COMPOSITION_LAYER_DEPTH_INFO_KHR,
+    XR_TYPE_COMPOSITION_LAYER_CYLINDER_KHR,
+    XR_TYPE_COMPOSITION_LAYER_CUBE_KHR,
+    XR_TYPE_COMPOSITION_LAYER_EQUIRECT_KHR,
+    XR_TYPE_COMPOSITION_LAYER_EQUIRECT2_KHR,
+    XR_TYPE_COMPOSITION_LAYER_COLOR_SCALE_BIAS_KHR,
+    XR_TYPE_COMPOSITION_LAYER_SETTINGS_FB,
+    XR_TYPE_COMPOSITION_LAYER_PASSTHROUGH_FB,
+    // graphics
+    XR_TYPE_SWAPCHAIN_IMAGE_VULKAN_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_D3D11_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_D3D12_KHR,
+    XR_TYPE_GRAPHICS_BINDING_VULKAN_KHR,
+    XR_TYPE_GRAPHICS_BINDING_OPENGL_ES_ANDROID_KHR,
+    XR_TYPE_VULKAN_SWAPCHAIN_FORMAT_LIST_CREATE_INFO_KHR,
+    XR_TYPE_VISIBILITY_MASK_KHR,
+    XR_TYPE_EVENT_DATA_VISIBILITY_MASK_CHANGED_KHR,
+    XR_TYPE_SWAPCHAIN_IMAGE_FOVEATION_VULKAN_FB,
+    XR_TYPE_SWAPCHAIN_STATE_FOVEATION_FB,
+    XR_TYPE_FOVEATION_PROFILE_CREATE_INFO_FB,
+    XR_TYPE_VIEW_CONFIGURATION_VIEW_FOV_EPIC,
+    // spaces
+    XR_TYPE_SPACES_LOCATE_INFO,
+    XR_TYPE_SPACE_LOCATIONS,
+    XR_TYPE_SPACE_VELOCITIES,
+    // hand tracking
+    XR_TYPE_HAND_TRACKER_CREATE_INFO_EXT,
+    XR_TYPE_HAND_JOINTS_LOCATE_INFO_EXT,
+    XR_TYPE_HAND_JOINT_LOCATIONS_EXT,
+    XR_TYPE_HAND_JOINT_VELOCITIES_EXT,
+    XR_TYPE_HAND_JOINTS_MOTION_RANGE_INFO_EXT,
+    XR_TYPE_HAND_TRACKING_AIM_STATE_FB,
+    XR_TYPE_SYSTEM_HAND_TRACKING_PROPERTIES_EXT,
+    // eye, face and body tracking
+    XR_TYPE_SYSTEM_EYE_GAZE_INTERACTION_PROPERTIES_EXT,
+    XR_TYPE_EYE_GAZE_SAMPLE_TIME_EXT,
+    XR_TYPE_EYE_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_EYE_GAZES_INFO_FB,
+    XR_TYPE_EYE_GAZES_FB,
+    XR_TYPE_FACE_TRACKER_CREATE_INFO2_FB,
+    XR_TYPE_FACE_EXPRESSION_INFO2_FB,
+    XR_TYPE_FACE_EXPRESSION_WEIGHTS2_FB,
+    XR_TYPE_BODY_TRACKER_CREATE_INFO_FB,
+    XR_TYPE_BODY_JOINTS_LOCATE_INFO_FB,
+    XR_TYPE_BODY_JOINT_LOCATIONS_FB,
+    // input and events
+    XR_TYPE_INTERACTION_PROFILE_DPAD_BINDING_EXT,
+    XR_TYPE_ACTIVE_ACTION_SET_PRIORITIES_EXT,
+    XR_TYPE_EVENT_DATA_DISPLAY_REFRESH_RATE_CHANGED_FB,
+    XR_TYPE_EVENT_DATA_PERF_SETTINGS_EXT,
+    XR_TYPE_PASSTHROUGH_LAYER_CREATE_INFO_FB,
+};
+
+const std::size_t COMPACT_STRUCT_TYPE_COUNT = sizeof(COMPACT_STRUCT_TYPES) / sizeof(COMPACT_STRUCT_TYPES[0]);
+
+static_assert(sizeof(COMPACT_STRUCT_TYPES) / sizeof(COMPACT_STRUCT_TYPES[0]) <= TABLE_STRUCT_CODES,
+    "COMPACT_STRUCT_TYPES has more entries than there are one byte struct codes");
+
+const uint32_t* HandleInterner::find(uint64_t handle) const {
+    auto it = ids.find(handle);
+    return it != ids.end() ? &it->second : nullptr;
+}
+
+void HandleInterner::add(uint64_t handle) {
+    if (handles.size() >= MAX_HANDLE_IDS) {
+        return;
+    }
+    handles.push_back(handle);
+    ids.emplace(handle, static_cast<uint32_t>(handles.size() - 1));
+    pending++;
+}
+
+void HandleInterner::commit() {
+    pending = 0;
+}
+
+void HandleInterner::rollback() {
+    for (; pending > 0; pending--) {
+        ids.erase(handles.back());
+        handles.pop_back();
+    }
+}
+
+void HandleTable::add(uint64_t handle) {
+    if (handles.size() >= MAX_HANDLE_IDS) {
+        return;
+    }
+    handles.push_back(handle);
+}
+
+uint64_t HandleTable::resolve(uint64_t handle) const {
+    return virtual_handles ? virtual_handles->resolve(handle) : handle;
+}
+
+uint64_t HandleTable::get(uint64_t id) const {
+    if (id >= handles.size()) {
+        throw CompactEncodingException("unknown handle id: " + std::to_string(id));
+    }
+    return handles[id];
+}
+
+uint64_t struct_type_code(XrStructureType type) {
+    uint64_t value = static_cast<uint32_t>(type);
+    if (value < CORE_STRUCT_CODES) {
+        return value;
+    }
+    for (std::size_t i = 0; i < COMPACT_STRUCT_TYPE_COUNT; i++) {
+        if (COMPACT_STRUCT_TYPES[i] == type) {
+            return CORE_STRUCT_CODES + i;
+        }
+    }
+    if (value >= FIRST_EXTENSION_STRUCT_TYPE) {
+        return CORE_STRUCT_CODES + TABLE_STRUCT_CODES + ((value - FIRST_EXTENSION_STRUCT_TYPE) << 1);
+    }
+    return CORE_STRUCT_CODES + TABLE_STRUCT_CODES + ((value << 1) | 1);
+}
+
+XrStructureType struct_type_from_code(uint64_t code) {
+    if (code < CORE_STRUCT_CODES) {
+        return static_cast<XrStructureType>(code);
+    }
+    if (code < CORE_STRUCT_CODES + TABLE_STRUCT_CODES) {
+        std::size_t index = code - CORE_STRUCT_CODES;
+        if (index >= COMPACT_STRUCT_TYPE_COUNT) {
+            throw CompactEncodingException("unknown struct code: " + std::to_string(code));
+        }
+        return COMPACT_STRUCT_TYPES[index];
+    }
+    uint64_t rest = code - CORE_STRUCT_CODES - TABLE_STRUCT_CODES;
+    uint64_t value = rest & 1 ? rest >> 1 : FIRST_EXTENSION_STRUCT_TYPE + (rest >> 1);
+    if (value > UINT32_MAX) {
+        throw CompactEncodingException("struct code out of range: " + std::to_string(code));
+    }
+    return static_cast<XrStructureType>(static_cast<uint32_t>(value));
+}
+
+static void write_varint(uint64_t value, SyncWriteStream& out) {
+    uint8_t bytes[10];
+    std::size_t size = 0;
+    while (value >= 0x80) {
+        bytes[size++] = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+    bytes[size++] = static_cast<uint8_t>(value);
+    asio::write(out, asio::buffer(bytes, size));
+}
+
+static uint64_t read_varint(SyncReadStream& in) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte{};
+        asio::read(in, asio::buffer(&byte, sizeof(uint8_t)));
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw CompactEncodingException("varint too long");
+}
+
+void serialize_compact_uint(uint64_t value, SerializeContext& ctx) {
+    write_varint(value, ctx.out);
+}
+
+void serialize_compact_enum(int64_t value, SerializeContext& ctx) {
+    // zigzag, so that negative values like error codes stay small
+    write_varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63), ctx.out);
+}
+
+void serialize_compact_struct_type(XrStructureType type, SerializeContext& ctx) {
+    write_varint(struct_type_code(type), ctx.out);
+}
+
+void serialize_compact_handle(uint64_t handle, SerializeContext& ctx) {
+    if (handle == 0) {
+        write_varint(0, ctx.out);
+        return;
+    }
+    if (const uint32_t* id = ctx.handles->find(handle)) {
+        write_varint((static_cast<uint64_t>(*id) << 1) | 1, ctx.out);
+        return;
+    }
+    ctx.handles->add(handle);
+    write_varint(2, ctx.out);
+    asio::write(ctx.out, asio::buffer(&handle, sizeof(uint64_t)));
+}
+
+uint64_t deserialize_compact_uint(DeserializeContext& ctx) {
+    return read_varint(ctx.in);
+}
+
+int64_t deserialize_compact_enum(DeserializeContext& ctx) {
+    uint64_t value = read_varint(ctx.in);
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+XrStructureType deserialize_compact_struct_type(DeserializeContext& ctx) {
+    return struct_type_from_code(read_varint(ctx.in));
+}
+
+uint64_t deserialize_compact_handle(DeserializeContext& ctx) {
+    uint64_t tag = read_varint(ctx.in);
+    if (tag == 0) {
+        return 0;
+    }
+    if (tag & 1) {
+        return ctx.handles->get(tag >> 1);
+    }
+    if (tag != 2) {
+        throw CompactEncodingException("invalid handle tag: " + std::to_string(tag));
+    }
+    uint64_t handle{};
+    asio::read(ctx.in, asio::buffer(&handle, sizeof(uint64_t)));
+    handle = ctx.handles->resolve(handle);
+    ctx.handles->add(handle);
+    return handle;
+}
+
+} // namespace xrtransport
@@ -15,14 +15,14 @@ void deserialize(XrInstanceCreateInfo* s, DeserializeContext& ctx) {
         s->enabledApiLayerNames = reinterpret_cast<char**>(std::malloc(s->enabledApiLayerCount * sizeof(char*)));
     }
     for (uint32_t i = 0; i < s->enabledApiLayerCount; i++) {
-        deserialize_ptr(const_cast<const char**>(&s->enabledApiLayerNames[i]), ctx);
+        deserialize_string(const_cast<const char**>(&s->enabledApiLayerNames[i]), ctx);
     }
     deserialize(&s->enabledExtensionCount, ctx);
     if (!ctx.in_place) {
         s->enabledExtensionNames = reinterpret_cast<char**>(std::malloc(s->enabledExtensionCount * sizeof(char*)));
     }
     for(uint32_t i = 0; i < s->enabledExtensionCount; i++) {
-        deserialize_ptr(const_cast<const char**>(&s->enabledExtensionNames[i]), ctx);
+        deserialize_string(const_cast<const char**>(&s->enabledExtensionNames[i]), ctx);
     }
 }
 
@@ -12,11 +12,11 @@ void serialize(const XrInstanceCreateInfo* s, SerializeContext& ctx) {
     serialize(&s->applicationInfo, ctx);
     serialize(&s->enabledApiLayerCount, ctx);
     for (uint32_t i = 0; i < s->enabledApiLayerCount; i++) {
-        serialize_ptr(s->enabledApiLayerNames[i], count_null_terminated(s->enabledApiLayerNames[i]), ctx);
+        serialize_string(s->enabledApiLayerNames[i], ctx);
     }
     serialize(&s->enabledExtensionCount, ctx);
     for (uint32_t i = 0; i < s->enabledExtensionCount; i++) {
-        serialize_ptr(s->enabledExtensionNames[i], count_null_terminated(s->enabledExtensionNames[i]), ctx);
+        serialize_string(s->enabledExtensionNames[i], ctx);
     }
 }
 
@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/serialization/error.h"
+
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+using std::uint8_t;
+using std::uint32_t;
+using std::uint64_t;
+
+namespace xrtransport {
+
+// Unchanged gaps shorter than this are cheaper to resend than to start a new run for
+static constexpr std::size_t MIN_UNCHANGED_RUN = 3;
+
+static void write_varint(uint64_t value, std::vector<uint8_t>& out) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+static uint64_t read_varint(SyncReadStream& in) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte{};
+        asio::read(in, asio::buffer(&byte, sizeof(uint8_t)));
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw DeltaEncodingException("varint too long");
+}
+
+static uint64_t params_key(const std::vector<uint8_t>& params) {
+    uint64_t key = 0;
+    std::memcpy(&key, params.data(), std::min(params.size(), sizeof(uint64_t)));
+    return key;
+}
+
+static void encode_runs(const std::vector<uint8_t>& previous, const std::vector<uint8_t>& params, std::vector<uint8_t>& out) {
+    auto previous_byte = [&](std::size_t i) -> uint8_t {
+        return i < previous.size() ? previous[i] : 0;
+    };
+    auto is_unchanged = [&](std::size_t i) {
+        return params[i] == previous_byte(i);
+    };
+
+    std::size_t size = params.size();
+    std::size_t pos = 0;
+    while (pos < size) {
+        std::size_t unchanged_start = pos;
+        while (pos < size && is_unchanged(pos)) {
+            pos++;
+        }
+        std::size_t changed_start = pos;
+
+        // extend the changed run over short unchanged gaps
+        while (pos < size) {
+            if (!is_unchanged(pos)) {
+                pos++;
+                continue;
+            }
+            std::size_t gap_end = pos;
+            while (gap_end < size && gap_end - pos < MIN_UNCHANGED_RUN && is_unchanged(gap_end)) {
+                gap_end++;
+            }
+            if (gap_end == size || gap_end - pos >= MIN_UNCHANGED_RUN) {
+                break;
+            }
+            pos = gap_end;
+        }
+
+        write_varint(changed_start - unchanged_start, out);
+        write_varint(pos - changed_start, out);
+        out.insert(out.end(), params.begin() + changed_start, params.begin() + pos);
+    }
+}
+
+void DeltaEncoder::encode(uint32_t function_id, SyncWriteStream& out) {
+    FunctionHistory& function_history = history[function_id];
+    uint64_t key = params_key(params_buffer);
+
+    // find the slot for this handle, or evict one
+    uint8_t slot_index = 0;
+    bool found = false;
+    for (uint8_t i = 0; i < DELTA_SLOTS_PER_FUNCTION; i++) {
+        const Slot& slot = function_history.slots[i];
+        if (slot.used && slot.key == key) {
+            slot_index = i;
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        auto unused = std::find_if(function_history.slots.begin(), function_history.slots.end(),
+            [](const Slot& slot){ return !slot.used; });
+        if (unused != function_history.slots.end()) {
+            slot_index = static_cast<uint8_t>(unused - function_history.slots.begin());
+        }
+        else {
+            slot_index = function_history.next_evicted;
+            function_history.next_evicted = (function_history.next_evicted + 1) % DELTA_SLOTS_PER_FUNCTION;
+        }
+    }
+    Slot& slot = function_history.slots[slot_index];
+
+    uint8_t mode = DELTA_MODE_FULL;
+    if (found) {
+        runs_buffer.clear();
+        encode_runs(slot.params, params_buffer, runs_buffer);
+        if (runs_buffer.size() < params_buffer.size()) {
+            mode = DELTA_MODE_DELTA;
+        }
+    }
+
+    uint32_t size = static_cast<uint32_t>(params_buffer.size());
+    asio::write(out, asio::buffer(&slot_index, sizeof(uint8_t)));
+    asio::write(out, asio::buffer(&mode, sizeof(uint8_t)));
+    asio::write(out, asio::buffer(&size, sizeof(uint32_t)));
+    if (mode == DELTA_MODE_DELTA) {
+        asio::write(out, asio::buffer(runs_buffer));
+    }
+    else {
+        asio::write(out, asio::buffer(params_buffer));
+    }
+
+    slot.used = true;
+    slot.key = key;
+    slot.params = params_buffer;
+}
+
+const std::vector<uint8_t>& DeltaDecoder::decode(uint32_t function_id, SyncReadStream& in) {
+    uint8_t slot_index{};
+    asio::read(in, asio::buffer(&slot_index, sizeof(uint8_t)));
+    uint8_t mode{};
+    asio::read(in, asio::buffer(&mode, sizeof(uint8_t)));
+    uint32_t size{};
+    asio::read(in, asio::buffer(&size, sizeof(uint32_t)));
+
+    if (slot_index >= DELTA_SLOTS_PER_FUNCTION) {
+        throw DeltaEncodingException("invalid delta slot: " + std::to_string(slot_index));
+    }
+    std::vector<uint8_t>& params = history[function_id][slot_index];
+
+    if (mode == DELTA_MODE_FULL) {
+        params.resize(size);
+        asio::read(in, asio::buffer(params));
+    }
+    else if (mode == DELTA_MODE_DELTA) {
+        // bytes past the end of the previous params start out as zero, same as on the encoder
+        params.resize(size, 0);
+        std::size_t pos = 0;
+        while (pos < size) {
+            uint64_t unchanged = read_varint(in);
+            uint64_t changed = read_varint(in);
+            if (unchanged > size - pos || changed > size - pos - unchanged) {
+                throw DeltaEncodingException("delta run out of bounds");
+            }
+            pos += unchanged;
+            asio::read(in, asio::buffer(params.data() + pos, changed));
+            pos += changed;
+        }
+    }
+    else {
+        throw DeltaEncodingException("invalid delta mode: " + std::to_string(mode));
+    }
+
+    return params;
+}
+
+std::size_t DeltaReadStream::read_some(const asio::mutable_buffer& buffer, asio::error_code& ec) {
+    ec.clear();
+    if (read_head == size) {
+        ec = asio::error::eof;
+        return 0;
+    }
+    std::size_t to_read = std::min(buffer.size(), size - read_head);
+    std::memcpy(buffer.data(), data + read_head, to_read);
+    read_head += to_read;
+    return to_read;
+}
+
+const void* DeltaReadStream::borrow(std::size_t size_to_borrow, std::size_t alignment) {
+    if (size - read_head < size_to_borrow) {
+        return nullptr;
+    }
+    const uint8_t* borrowed = data + read_head;
+    if (reinterpret_cast<std::uintptr_t>(borrowed) % alignment != 0) {
+        return nullptr;
+    }
+    read_head += size_to_borrow;
+    return borrowed;
+}
+
+} // namespace xrtransport
@@ -14,12 +14,14 @@
 
 
 #include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/quantization.h"
+#include "xrtransport/serialization/struct_index.h"
 #include "xrtransport/serialization/error.h"
 #include "xrtransport/util.h"
 
 namespace xrtransport {
 
-std::unordered_map<XrStructureType, StructDeserializer> deserializer_lookup_table = {
+constexpr StructTableEntry<StructDeserializer> deserializer_lookup_entries[] = {
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
     {XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE, STRUCT_DESERIALIZER_PTR(XrDigitalLensControlALMALENCE)},
 #endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
@@ -1147,17 +1149,13 @@ std::unordered_map<XrStructureType, StructDeserializer> deserializer_lookup_tabl
 
 };
 
+constexpr auto deserializer_lookup_table = make_struct_table(deserializer_lookup_entries);
+
 StructDeserializer deserializer_lookup(XrStructureType struct_type) {
-    auto it = deserializer_lookup_table.find(struct_type);
-    if (it == deserializer_lookup_table.end()) {
-        return nullptr;
-    }
-    else {
-        return it->second;
-    }
+    return deserializer_lookup_table[struct_type_index(struct_type)];
 }
 
-std::unordered_map<XrStructureType, StructCleaner> cleaner_lookup_table = {
+constexpr StructTableEntry<StructCleaner> cleaner_lookup_entries[] = {
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
     {XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE, STRUCT_CLEANER_PTR(XrDigitalLensControlALMALENCE)},
 #endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
@@ -2285,14 +2283,18 @@ std::unordered_map<XrStructureType, StructCleaner> cleaner_lookup_table = {
 
 };
 
+constexpr auto cleaner_lookup_table = make_struct_table(cleaner_lookup_entries);
+
 StructCleaner cleaner_lookup(XrStructureType struct_type) {
-    if (cleaner_lookup_table.find(struct_type) == cleaner_lookup_table.end()) {
+    StructCleaner cleaner = cleaner_lookup_table[struct_type_index(struct_type)];
+    if (!cleaner) {
         throw UnknownXrStructureTypeException("Unknown XrStructureType in cleaner_lookup: " + std::to_string(struct_type));
     }
-    return cleaner_lookup_table.at(struct_type);
+    return cleaner;
 }
 
-// Deserializers
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+// Deserializers, replaced by the tables in struct_tables.cpp in table-driven mode
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 void deserialize(XrDigitalLensControlALMALENCE* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
@@ -2312,7 +2314,7 @@ void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->allJointPosesTracked, ctx);
     deserialize(&s->jointLocationCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
 }
 
 void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx) {
@@ -2320,7 +2322,7 @@ void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->allJointPosesTracked, ctx);
     deserialize(&s->jointLocationCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
 }
 
 void deserialize(XrBodyJointsLocateInfoBD* s, DeserializeContext& ctx) {
@@ -2918,21 +2920,21 @@ void deserialize(XrActiveActionSetPriorityEXT* s, DeserializeContext& ctx) {
 void deserialize(XrDebugUtilsLabelEXT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_ptr(&s->labelName, ctx);
+    deserialize_string(&s->labelName, ctx);
 }
 
 void deserialize(XrDebugUtilsLabelEXT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_ptr(&s->labelName, ctx);
+    deserialize_string(&s->labelName, ctx);
 }
 
 void deserialize(XrDebugUtilsMessengerCallbackDataEXT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_ptr(&s->messageId, ctx);
-    deserialize_ptr(&s->functionName, ctx);
-    deserialize_ptr(&s->message, ctx);
+    deserialize_string(&s->messageId, ctx);
+    deserialize_string(&s->functionName, ctx);
+    deserialize_string(&s->message, ctx);
     deserialize(&s->objectCount, ctx);
     deserialize_ptr(&s->objects, ctx);
     deserialize(&s->sessionLabelCount, ctx);
@@ -2942,9 +2944,9 @@ void deserialize(XrDebugUtilsMessengerCallbackDataEXT* s, DeserializeContext& ct
 void deserialize(XrDebugUtilsMessengerCallbackDataEXT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_ptr(&s->messageId, ctx);
-    deserialize_ptr(&s->functionName, ctx);
-    deserialize_ptr(&s->message, ctx);
+    deserialize_string(&s->messageId, ctx);
+    deserialize_string(&s->functionName, ctx);
+    deserialize_string(&s->message, ctx);
     deserialize(&s->objectCount, ctx);
     deserialize_ptr(&s->objects, ctx);
     deserialize(&s->sessionLabelCount, ctx);
@@ -2974,7 +2976,7 @@ void deserialize(XrDebugUtilsObjectNameInfoEXT* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->objectType, ctx);
     deserialize(&s->objectHandle, ctx);
-    deserialize_ptr(&s->objectName, ctx);
+    deserialize_string(&s->objectName, ctx);
 }
 
 void deserialize(XrDebugUtilsObjectNameInfoEXT* s, DeserializeContext& ctx) {
@@ -2982,7 +2984,7 @@ void deserialize(XrDebugUtilsObjectNameInfoEXT* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->objectType, ctx);
     deserialize(&s->objectHandle, ctx);
-    deserialize_ptr(&s->objectName, ctx);
+    deserialize_string(&s->objectName, ctx);
 }
 
 #endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
@@ -3170,7 +3172,7 @@ void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->isActive, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
 }
 
 void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx) {
@@ -3178,21 +3180,21 @@ void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->isActive, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
 }
 
 void deserialize(XrHandJointVelocitiesEXT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->jointVelocities, ctx);
+    deserialize_quantizable_ptr(&s->jointVelocities, ctx);
 }
 
 void deserialize(XrHandJointVelocitiesEXT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->jointVelocities, ctx);
+    deserialize_quantizable_ptr(&s->jointVelocities, ctx);
 }
 
 void deserialize(XrHandJointVelocityEXT* s, DeserializeContext& ctx) {
@@ -3492,7 +3494,7 @@ void deserialize(XrBodyJointLocationsFB* s, DeserializeContext& ctx) {
     deserialize(&s->isActive, ctx);
     deserialize(&s->confidence, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
     deserialize(&s->skeletonChangedCount, ctx);
     deserialize_time(&s->time, ctx);
 }
@@ -3503,7 +3505,7 @@ void deserialize(XrBodyJointLocationsFB* s, DeserializeContext& ctx) {
     deserialize(&s->isActive, ctx);
     deserialize(&s->confidence, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
     deserialize(&s->skeletonChangedCount, ctx);
     deserialize_time(&s->time, ctx);
 }
@@ -3755,9 +3757,9 @@ void deserialize(XrFaceExpressionWeightsFB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->weightCount, ctx);
-    deserialize_ptr(&s->weights, ctx);
+    deserialize_quantizable_ptr(&s->weights, ctx);
     deserialize(&s->confidenceCount, ctx);
-    deserialize_ptr(&s->confidences, ctx);
+    deserialize_quantizable_ptr(&s->confidences, ctx);
     deserialize(&s->status, ctx);
     deserialize_time(&s->time, ctx);
 }
@@ -3766,9 +3768,9 @@ void deserialize(XrFaceExpressionWeightsFB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->weightCount, ctx);
-    deserialize_ptr(&s->weights, ctx);
+    deserialize_quantizable_ptr(&s->weights, ctx);
     deserialize(&s->confidenceCount, ctx);
-    deserialize_ptr(&s->confidences, ctx);
+    deserialize_quantizable_ptr(&s->confidences, ctx);
     deserialize(&s->status, ctx);
     deserialize_time(&s->time, ctx);
 }
@@ -3815,9 +3817,9 @@ void deserialize(XrFaceExpressionWeights2FB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->weightCount, ctx);
-    deserialize_ptr(&s->weights, ctx);
+    deserialize_quantizable_ptr(&s->weights, ctx);
     deserialize(&s->confidenceCount, ctx);
-    deserialize_ptr(&s->confidences, ctx);
+    deserialize_quantizable_ptr(&s->confidences, ctx);
     deserialize(&s->isValid, ctx);
     deserialize(&s->isEyeFollowingBlendshapesValid, ctx);
     deserialize(&s->dataSource, ctx);
@@ -3828,9 +3830,9 @@ void deserialize(XrFaceExpressionWeights2FB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->weightCount, ctx);
-    deserialize_ptr(&s->weights, ctx);
+    deserialize_quantizable_ptr(&s->weights, ctx);
     deserialize(&s->confidenceCount, ctx);
-    deserialize_ptr(&s->confidences, ctx);
+    deserialize_quantizable_ptr(&s->confidences, ctx);
     deserialize(&s->isValid, ctx);
     deserialize(&s->isEyeFollowingBlendshapesValid, ctx);
     deserialize(&s->dataSource, ctx);
@@ -4122,7 +4124,7 @@ void deserialize(XrKeyboardTrackingDescriptionFB* s, DeserializeContext& ctx) {
     deserialize(&s->trackedKeyboardId, ctx);
     deserialize(&s->size, ctx);
     deserialize(&s->flags, ctx);
-    deserialize_array(s->name, XR_MAX_KEYBOARD_TRACKING_NAME_SIZE_FB, ctx);
+    deserialize_string_array(s->name, XR_MAX_KEYBOARD_TRACKING_NAME_SIZE_FB, ctx);
 }
 
 void deserialize(XrKeyboardTrackingQueryFB* s, DeserializeContext& ctx) {
@@ -4397,7 +4399,7 @@ void deserialize(XrRenderModelPropertiesFB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->vendorId, ctx);
-    deserialize_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
+    deserialize_string_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
     deserialize(&s->modelKey, ctx);
     deserialize(&s->modelVersion, ctx);
     deserialize(&s->flags, ctx);
@@ -4407,7 +4409,7 @@ void deserialize(XrRenderModelPropertiesFB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->vendorId, ctx);
-    deserialize_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
+    deserialize_string_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
     deserialize(&s->modelKey, ctx);
     deserialize(&s->modelVersion, ctx);
     deserialize(&s->flags, ctx);
@@ -4494,14 +4496,14 @@ void deserialize(XrSemanticLabelsSupportInfoFB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->flags, ctx);
-    deserialize_ptr(&s->recognizedLabels, ctx);
+    deserialize_string(&s->recognizedLabels, ctx);
 }
 
 void deserialize(XrSemanticLabelsSupportInfoFB* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->flags, ctx);
-    deserialize_ptr(&s->recognizedLabels, ctx);
+    deserialize_string(&s->recognizedLabels, ctx);
 }
 
 #endif // XRTRANSPORT_EXT_XR_FB_scene
@@ -5123,7 +5125,7 @@ void deserialize(XrSpatialAnchorCreateInfoHTC* s, DeserializeContext& ctx) {
 }
 
 void deserialize(XrSpatialAnchorNameHTC* s, DeserializeContext& ctx) {
-    deserialize_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_HTC, ctx);
+    deserialize_string_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_HTC, ctx);
 }
 
 void deserialize(XrSystemAnchorPropertiesHTC* s, DeserializeContext& ctx) {
@@ -5151,7 +5153,7 @@ void deserialize(XrBodyJointLocationsHTC* s, DeserializeContext& ctx) {
     deserialize(&s->combinedLocationFlags, ctx);
     deserialize(&s->confidenceLevel, ctx);
     deserialize(&s->jointLocationCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
     deserialize(&s->skeletonGenerationId, ctx);
 }
 
@@ -5161,7 +5163,7 @@ void deserialize(XrBodyJointLocationsHTC* s, DeserializeContext& ctx) {
     deserialize(&s->combinedLocationFlags, ctx);
     deserialize(&s->confidenceLevel, ctx);
     deserialize(&s->jointLocationCount, ctx);
-    deserialize_ptr(&s->jointLocations, ctx);
+    deserialize_quantizable_ptr(&s->jointLocations, ctx);
     deserialize(&s->skeletonGenerationId, ctx);
 }
 
@@ -5183,14 +5185,14 @@ void deserialize(XrBodySkeletonHTC* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->joints, ctx);
+    deserialize_quantizable_ptr(&s->joints, ctx);
 }
 
 void deserialize(XrBodySkeletonHTC* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->jointCount, ctx);
-    deserialize_ptr(&s->joints, ctx);
+    deserialize_quantizable_ptr(&s->joints, ctx);
 }
 
 void deserialize(XrBodyTrackerCreateInfoHTC* s, DeserializeContext& ctx) {
@@ -6711,14 +6713,14 @@ void deserialize(XrEventDataVirtualKeyboardCommitTextMETA* s, DeserializeContext
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->keyboard, ctx);
-    deserialize_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
+    deserialize_string_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
 }
 
 void deserialize(XrEventDataVirtualKeyboardCommitTextMETA* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->keyboard, ctx);
-    deserialize_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
+    deserialize_string_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
 }
 
 void deserialize(XrEventDataVirtualKeyboardEnterMETA* s, DeserializeContext& ctx) {
@@ -6876,13 +6878,13 @@ void deserialize(XrVirtualKeyboardSpaceCreateInfoMETA* s, DeserializeContext& ct
 void deserialize(XrVirtualKeyboardTextContextChangeInfoMETA* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_ptr(&s->textContext, ctx);
+    deserialize_string(&s->textContext, ctx);
 }
 
 void deserialize(XrVirtualKeyboardTextContextChangeInfoMETA* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_ptr(&s->textContext, ctx);
+    deserialize_string(&s->textContext, ctx);
 }
 
 void deserialize(XrVirtualKeyboardTextureDataMETA* s, DeserializeContext& ctx) {
@@ -7069,7 +7071,7 @@ void deserialize(XrLocalizationMapImportInfoML* s, DeserializeContext& ctx) {
 void deserialize(XrLocalizationMapML* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
+    deserialize_string_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
     deserialize(&s->mapUuid, ctx);
     deserialize(&s->mapType, ctx);
 }
@@ -7077,7 +7079,7 @@ void deserialize(XrLocalizationMapML* s, DeserializeContext& ctx) {
 void deserialize(XrLocalizationMapML* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
+    deserialize_string_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
     deserialize(&s->mapUuid, ctx);
     deserialize(&s->mapType, ctx);
 }
@@ -7836,15 +7838,15 @@ void deserialize(XrControllerModelKeyStateMSFT* s, DeserializeContext& ctx) {
 void deserialize(XrControllerModelNodePropertiesMSFT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
-    deserialize_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    deserialize_string_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    deserialize_string_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
 }
 
 void deserialize(XrControllerModelNodePropertiesMSFT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
-    deserialize_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    deserialize_string_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    deserialize_string_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
 }
 
 void deserialize(XrControllerModelNodeStateMSFT* s, DeserializeContext& ctx) {
@@ -7952,7 +7954,7 @@ void deserialize(XrHandMeshVertexBufferMSFT* s, DeserializeContext& ctx) {
     deserialize_time(&s->vertexUpdateTime, ctx);
     deserialize(&s->vertexCapacityInput, ctx);
     deserialize(&s->vertexCountOutput, ctx);
-    deserialize_ptr(&s->vertices, ctx);
+    deserialize_quantizable_ptr(&s->vertices, ctx);
 }
 
 void deserialize(XrHandMeshVertexMSFT* s, DeserializeContext& ctx) {
@@ -8084,9 +8086,9 @@ void deserialize(XrSceneBoundsMSFT* s, DeserializeContext& ctx) {
     deserialize(&s->space, ctx);
     deserialize_time(&s->time, ctx);
     deserialize(&s->sphereCount, ctx);
-    deserialize_ptr(&s->spheres, ctx);
+    deserialize_quantizable_ptr(&s->spheres, ctx);
     deserialize(&s->boxCount, ctx);
-    deserialize_ptr(&s->boxes, ctx);
+    deserialize_quantizable_ptr(&s->boxes, ctx);
     deserialize(&s->frustumCount, ctx);
     deserialize_ptr(&s->frustums, ctx);
 }
@@ -8100,14 +8102,14 @@ void deserialize(XrSceneComponentLocationsMSFT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->locationCount, ctx);
-    deserialize_ptr(&s->locations, ctx);
+    deserialize_quantizable_ptr(&s->locations, ctx);
 }
 
 void deserialize(XrSceneComponentLocationsMSFT* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->locationCount, ctx);
-    deserialize_ptr(&s->locations, ctx);
+    deserialize_quantizable_ptr(&s->locations, ctx);
 }
 
 void deserialize(XrSceneComponentMSFT* s, DeserializeContext& ctx) {
@@ -8552,7 +8554,7 @@ void deserialize(XrSpatialAnchorPersistenceInfoMSFT* s, DeserializeContext& ctx)
 }
 
 void deserialize(XrSpatialAnchorPersistenceNameMSFT* s, DeserializeContext& ctx) {
-    deserialize_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_MSFT, ctx);
+    deserialize_string_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_MSFT, ctx);
 }
 
 #endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
@@ -8633,7 +8635,7 @@ void deserialize(XrExternalCameraIntrinsicsOCULUS* s, DeserializeContext& ctx) {
 void deserialize(XrExternalCameraOCULUS* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
+    deserialize_string_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
     deserialize(&s->intrinsics, ctx);
     deserialize(&s->extrinsics, ctx);
 }
@@ -8641,7 +8643,7 @@ void deserialize(XrExternalCameraOCULUS* s, DeserializeContext& ctx) {
 void deserialize(XrExternalCameraOCULUS* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
+    deserialize_string_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
     deserialize(&s->intrinsics, ctx);
     deserialize(&s->extrinsics, ctx);
 }
@@ -8774,18 +8776,18 @@ void deserialize(XrSystemMarkerTrackingPropertiesVARJO* s, DeserializeContext& c
 void deserialize(XrActionCreateInfo* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->actionName, XR_MAX_ACTION_NAME_SIZE, ctx);
+    deserialize_string_array(s->actionName, XR_MAX_ACTION_NAME_SIZE, ctx);
     deserialize(&s->actionType, ctx);
     deserialize(&s->countSubactionPaths, ctx);
     deserialize_ptr(&s->subactionPaths, ctx);
-    deserialize_array(s->localizedActionName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE, ctx);
+    deserialize_string_array(s->localizedActionName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE, ctx);
 }
 
 void deserialize(XrActionSetCreateInfo* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->actionSetName, XR_MAX_ACTION_SET_NAME_SIZE, ctx);
-    deserialize_array(s->localizedActionSetName, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE, ctx);
+    deserialize_string_array(s->actionSetName, XR_MAX_ACTION_SET_NAME_SIZE, ctx);
+    deserialize_string_array(s->localizedActionSetName, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE, ctx);
     deserialize(&s->priority, ctx);
 }
 
@@ -8857,16 +8859,16 @@ void deserialize(XrActiveActionSet* s, DeserializeContext& ctx) {
 void deserialize(XrApiLayerProperties* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->layerName, XR_MAX_API_LAYER_NAME_SIZE, ctx);
+    deserialize_string_array(s->layerName, XR_MAX_API_LAYER_NAME_SIZE, ctx);
     deserialize(&s->specVersion, ctx);
     deserialize(&s->layerVersion, ctx);
-    deserialize_array(s->description, XR_MAX_API_LAYER_DESCRIPTION_SIZE, ctx);
+    deserialize_string_array(s->description, XR_MAX_API_LAYER_DESCRIPTION_SIZE, ctx);
 }
 
 void deserialize(XrApplicationInfo* s, DeserializeContext& ctx) {
-    deserialize_array(s->applicationName, XR_MAX_APPLICATION_NAME_SIZE, ctx);
+    deserialize_string_array(s->applicationName, XR_MAX_APPLICATION_NAME_SIZE, ctx);
     deserialize(&s->applicationVersion, ctx);
-    deserialize_array(s->engineName, XR_MAX_ENGINE_NAME_SIZE, ctx);
+    deserialize_string_array(s->engineName, XR_MAX_ENGINE_NAME_SIZE, ctx);
     deserialize(&s->engineVersion, ctx);
     deserialize(&s->apiVersion, ctx);
 }
@@ -8984,7 +8986,7 @@ void deserialize(XrEventDataSessionStateChanged* s, DeserializeContext& ctx) {
 void deserialize(XrExtensionProperties* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
-    deserialize_array(s->extensionName, XR_MAX_EXTENSION_NAME_SIZE, ctx);
+    deserialize_string_array(s->extensionName, XR_MAX_EXTENSION_NAME_SIZE, ctx);
     deserialize(&s->extensionVersion, ctx);
 }
 
@@ -9067,7 +9069,7 @@ void deserialize(XrInstanceProperties* s, DeserializeContext& ctx) {
     deserialize(&s->type, ctx);
     deserialize_xr(&s->next, ctx);
     deserialize(&s->runtimeVersion, ctx);
-    deserialize_array(s->runtimeName, XR_MAX_RUNTIME_NAME_SIZE, ctx);
+    deserialize_string_array(s->runtimeName, XR_MAX_RUNTIME_NAME_SIZE, ctx);
 }
 
 void deserialize(XrInteractionProfileState* s, DeserializeContext& ctx) {
@@ -9255,7 +9257,7 @@ void deserialize(XrSystemProperties* s, DeserializeContext& ctx) {
     deserialize_xr(&s->next, ctx);
     deserialize(&s->systemId, ctx);
     deserialize(&s->vendorId, ctx);
-    deserialize_array(s->systemName, XR_MAX_SYSTEM_NAME_SIZE, ctx);
+    deserialize_string_array(s->systemName, XR_MAX_SYSTEM_NAME_SIZE, ctx);
     deserialize(&s->graphicsProperties, ctx);
     deserialize(&s->trackingProperties, ctx);
 }
@@ -9327,6 +9329,103 @@ void deserialize(XrViewState* s, DeserializeContext& ctx) {
 }
 
 
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+// Dequantizers
+#ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
+void dequantize(XrBodyJointLocationBD* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 13);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_flags(&s[i].locationFlags);
+        reader.get_pose(&s[i].pose);
+    }
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+void dequantize(XrHandJointLocationEXT* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 15);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_flags(&s[i].locationFlags);
+        reader.get_pose(&s[i].pose);
+        reader.get_float(&s[i].radius);
+    }
+}
+
+void dequantize(XrHandJointVelocityEXT* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 13);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_flags(&s[i].velocityFlags);
+        reader.get_vector(&s[i].linearVelocity);
+        reader.get_vector(&s[i].angularVelocity);
+    }
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
+void dequantize(XrBodyJointLocationFB* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 13);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_flags(&s[i].locationFlags);
+        reader.get_pose(&s[i].pose);
+    }
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
+void dequantize(XrBodyJointLocationHTC* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 13);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_flags(&s[i].locationFlags);
+        reader.get_pose(&s[i].pose);
+    }
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+void dequantize(XrHandMeshVertexMSFT* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 12);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_vector(&s[i].position);
+        reader.get_vector(&s[i].normal);
+    }
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+void dequantize(XrSceneComponentLocationMSFT* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 13);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_flags(&s[i].flags);
+        reader.get_pose(&s[i].pose);
+    }
+}
+
+void dequantize(XrSceneOrientedBoxBoundMSFT* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 18);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_pose(&s[i].pose);
+        reader.get_vector(&s[i].extents);
+    }
+}
+
+void dequantize(XrSceneSphereBoundMSFT* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 8);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_vector(&s[i].center);
+        reader.get_float(&s[i].radius);
+    }
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+void dequantize(XrBodySkeletonJointHTC* s, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 12);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_pose(&s[i].pose);
+    }
+}
+
+
 
 // reads a remote time, converts it to local time, and applies it
 void deserialize_time(XrTime* time, DeserializeContext& ctx) {
@@ -9336,6 +9435,7 @@ void deserialize_time(XrTime* time, DeserializeContext& ctx) {
     *time = remote_time + ctx.time_offset;
 }
 
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
 // Cleaners
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 void cleanup(const XrDigitalLensControlALMALENCE* s) {
@@ -16371,5 +16471,6 @@ void cleanup(const XrViewState* s) {
 }
 
 
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
 
 } // namespace xrtransport
\ No newline at end of file
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "xrtransport/serialization/quantization.h"
+
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+using std::uint8_t;
+using std::uint16_t;
+using std::uint32_t;
+using std::uint64_t;
+
+namespace xrtransport {
+
+// Smallest three components are in [-1/sqrt(2), 1/sqrt(2)]
+static constexpr float SMALLEST_THREE_RANGE = 0.70710678f;
+static constexpr uint32_t SMALLEST_THREE_MAX = (1u << 15) - 1;
+static constexpr float POSITION_STEPS = 65535.0f;
+static constexpr float HALF_MAX = 65504.0f;
+
+static uint16_t float_to_half(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t magnitude = bits & 0x7FFFFFFF;
+
+    // smallest normal half float is 2^-14
+    if (magnitude >= 0x38800000) {
+        // rebias the exponent from 127 to 15 and round the mantissa to nearest even
+        uint32_t half = (magnitude - 0x38000000) >> 13;
+        uint32_t remainder = magnitude & 0x1FFF;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // subnormal, in units of 2^-24
+    float abs_value = std::fabs(value);
+    uint32_t half = static_cast<uint32_t>(std::lround(abs_value * 16777216.0f));
+    return static_cast<uint16_t>(sign | half);
+}
+
+static float half_to_float(uint16_t half) {
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FF;
+
+    if (exponent == 0) {
+        float value = static_cast<float>(mantissa) / 16777216.0f;
+        return sign ? -value : value;
+    }
+
+    // infinities and NaNs are never encoded
+    uint32_t bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static bool is_finite(const XrVector3f& v) {
+    return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+}
+
+void QuantizedWriter::reset() {
+    min = {};
+    max = {};
+    has_positions = false;
+    positions_finite = true;
+    origin = {};
+    scale = 0;
+    data.clear();
+}
+
+void QuantizedWriter::include_position(const XrVector3f& position) {
+    if (!is_finite(position)) {
+        positions_finite = false;
+        return;
+    }
+    if (!has_positions) {
+        min = position;
+        max = position;
+        has_positions = true;
+        return;
+    }
+    min = {std::min(min.x, position.x), std::min(min.y, position.y), std::min(min.z, position.z)};
+    max = {std::max(max.x, position.x), std::max(max.y, position.y), std::max(max.z, position.z)};
+}
+
+bool QuantizedWriter::begin() {
+    if (!positions_finite) {
+        return false;
+    }
+    if (!has_positions) {
+        return true;
+    }
+    float extent = std::max({max.x - min.x, max.y - min.y, max.z - min.z});
+    if (!std::isfinite(extent)) {
+        return false;
+    }
+    origin = min;
+    scale = extent / POSITION_STEPS;
+    return true;
+}
+
+void QuantizedWriter::put_u16(uint16_t value) {
+    data.push_back(static_cast<uint8_t>(value));
+    data.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+bool QuantizedWriter::put_half(float value) {
+    if (!std::isfinite(value) || std::fabs(value) > HALF_MAX) {
+        return false;
+    }
+    put_u16(float_to_half(value));
+    return true;
+}
+
+bool QuantizedWriter::put_flags(uint64_t flags) {
+    if (flags > 0xFF) {
+        return false;
+    }
+    data.push_back(static_cast<uint8_t>(flags));
+    return true;
+}
+
+bool QuantizedWriter::put_pose(const XrPosef& pose) {
+    float q[4] = {pose.orientation.x, pose.orientation.y, pose.orientation.z, pose.orientation.w};
+    if (!std::isfinite(q[0]) || !std::isfinite(q[1]) || !std::isfinite(q[2]) || !std::isfinite(q[3])) {
+        return false;
+    }
+
+    // invalid orientations (e.g. untracked joints) are sent as identity
+    float norm = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if (norm < 1e-6f) {
+        q[0] = q[1] = q[2] = 0;
+        q[3] = 1;
+        norm = 1;
+    }
+
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; i++) {
+        if (std::fabs(q[i]) > std::fabs(q[largest])) {
+            largest = i;
+        }
+    }
+    // q and -q are the same rotation, flip it so that the dropped component is positive
+    float sign = q[largest] < 0 ? -1.0f : 1.0f;
+
+    uint64_t packed = largest;
+    uint32_t shift = 2;
+    for (uint32_t i = 0; i < 4; i++) {
+        if (i == largest) {
+            continue;
+        }
+        float component = q[i] * sign / norm;
+        float normalized = (component / SMALLEST_THREE_RANGE + 1.0f) * 0.5f;
+        long quantized = std::lround(normalized * SMALLEST_THREE_MAX);
+        quantized = std::clamp<long>(quantized, 0, SMALLEST_THREE_MAX);
+        packed |= static_cast<uint64_t>(quantized) << shift;
+        shift += 15;
+    }
+    for (int i = 0; i < 6; i++) {
+        data.push_back(static_cast<uint8_t>(packed >> (i * 8)));
+    }
+
+    const XrVector3f& p = pose.position;
+    float offsets[3] = {p.x - origin.x, p.y - origin.y, p.z - origin.z};
+    for (float offset : offsets) {
+        long quantized = scale > 0 ? std::lround(offset / scale) : 0;
+        put_u16(static_cast<uint16_t>(std::clamp<long>(quantized, 0, 65535)));
+    }
+    return true;
+}
+
+bool QuantizedWriter::put_vector(const XrVector3f& vector) {
+    return put_half(vector.x) && put_half(vector.y) && put_half(vector.z);
+}
+
+bool QuantizedWriter::put_float(float value) {
+    return put_half(value);
+}
+
+bool QuantizedWriter::put_weight(float weight) {
+    // also rejects NaN
+    if (!(weight >= 0.0f && weight <= 1.0f)) {
+        return false;
+    }
+    put_u16(static_cast<uint16_t>(std::lround(weight * 65535.0f)));
+    return true;
+}
+
+void QuantizedWriter::write(SerializeContext& ctx) const {
+    serialize(&origin.x, ctx);
+    serialize(&origin.y, ctx);
+    serialize(&origin.z, ctx);
+    serialize(&scale, ctx);
+    uint32_t size = static_cast<uint32_t>(data.size());
+    serialize(&size, ctx);
+    asio::write(ctx.out, asio::buffer(data));
+}
+
+void QuantizedReader::begin(std::size_t expected_size) {
+    deserialize(&origin.x, ctx);
+    deserialize(&origin.y, ctx);
+    deserialize(&origin.z, ctx);
+    deserialize(&scale, ctx);
+    uint32_t size{};
+    deserialize(&size, ctx);
+    if (size != expected_size) {
+        throw QuantizationException("Quantized array has " + std::to_string(size) +
+            " bytes, expected " + std::to_string(expected_size));
+    }
+    data.resize(size);
+    asio::read(ctx.in, asio::buffer(data));
+    read_head = 0;
+}
+
+uint16_t QuantizedReader::get_u16() {
+    uint16_t value = static_cast<uint16_t>(data[read_head] | (data[read_head + 1] << 8));
+    read_head += 2;
+    return value;
+}
+
+float QuantizedReader::get_half() {
+    return half_to_float(get_u16());
+}
+
+void QuantizedReader::get_pose(XrPosef* pose) {
+    uint64_t packed = 0;
+    for (int i = 0; i < 6; i++) {
+        packed |= static_cast<uint64_t>(data[read_head + i]) << (i * 8);
+    }
+    read_head += 6;
+
+    float q[4];
+    uint32_t largest = packed & 0x3;
+    uint32_t shift = 2;
+    float sum = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        if (i == largest) {
+            continue;
+        }
+        uint32_t quantized = (packed >> shift) & SMALLEST_THREE_MAX;
+        shift += 15;
+        q[i] = (static_cast<float>(quantized) / SMALLEST_THREE_MAX * 2.0f - 1.0f) * SMALLEST_THREE_RANGE;
+        sum += q[i] * q[i];
+    }
+    q[largest] = std::sqrt(std::max(0.0f, 1.0f - sum));
+    pose->orientation = {q[0], q[1], q[2], q[3]};
+
+    float x = static_cast<float>(get_u16());
+    float y = static_cast<float>(get_u16());
+    float z = static_cast<float>(get_u16());
+    pose->position = {origin.x + x * scale, origin.y + y * scale, origin.z + z * scale};
+}
+
+void QuantizedReader::get_vector(XrVector3f* vector) {
+    vector->x = get_half();
+    vector->y = get_half();
+    vector->z = get_half();
+}
+
+void QuantizedReader::get_float(float* value) {
+    *value = get_half();
+}
+
+void QuantizedReader::get_weight(float* weight) {
+    *weight = static_cast<float>(get_u16()) / 65535.0f;
+}
+
+bool quantize(const float* x, std::size_t count, QuantizedWriter& writer) {
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_weight(x[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void dequantize(float* x, std::size_t count, QuantizedReader& reader) {
+    reader.begin(count * 2);
+    for (std::size_t i = 0; i < count; i++) {
+        reader.get_weight(&x[i]);
+    }
+}
+
+} // namespace xrtransport
@@ -12,12 +12,14 @@
 
 
 #include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/quantization.h"
+#include "xrtransport/serialization/struct_index.h"
 #include "xrtransport/serialization/error.h"
 #include "xrtransport/util.h"
 
 namespace xrtransport {
 
-std::unordered_map<XrStructureType, StructSerializer> serializer_lookup_table = {
+constexpr StructTableEntry<StructSerializer> serializer_lookup_entries[] = {
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
     {XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE, STRUCT_SERIALIZER_PTR(XrDigitalLensControlALMALENCE)},
 #endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
@@ -1145,17 +1147,14 @@ std::unordered_map<XrStructureType, StructSerializer> serializer_lookup_table =
 
 };
 
+constexpr auto serializer_lookup_table = make_struct_table(serializer_lookup_entries);
+
 StructSerializer serializer_lookup(XrStructureType struct_type) {
-    auto it = serializer_lookup_table.find(struct_type);
-    if (it == serializer_lookup_table.end()) {
-        return nullptr;
-    }
-    else {
-        return it->second;
-    }
+    return serializer_lookup_table[struct_type_index(struct_type)];
 }
 
-// Serializers
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+// Serializers, replaced by the tables in struct_tables.cpp in table-driven mode
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
 
 void serialize(const XrDigitalLensControlALMALENCE* s, SerializeContext& ctx) {
@@ -1178,7 +1177,7 @@ void serialize(const XrBodyJointLocationsBD* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->allJointPosesTracked, ctx);
     serialize(&s->jointLocationCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointLocationCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointLocationCount, QUANTIZED_XR_BD_body_tracking, ctx);
 }
 
 
@@ -1187,7 +1186,7 @@ void serialize(const XrBodyJointLocationsBD* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->allJointPosesTracked, ctx);
     serialize(&s->jointLocationCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointLocationCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointLocationCount, QUANTIZED_XR_BD_body_tracking, ctx);
 }
 
 
@@ -1871,23 +1870,23 @@ void serialize(const XrActiveActionSetPriorityEXT* s, SerializeContext& ctx) {
 void serialize(const XrDebugUtilsLabelEXT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_ptr(s->labelName, count_null_terminated(s->labelName), ctx);
+    serialize_string(s->labelName, ctx);
 }
 
 
 void serialize(const XrDebugUtilsLabelEXT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_ptr(s->labelName, count_null_terminated(s->labelName), ctx);
+    serialize_string(s->labelName, ctx);
 }
 
 
 void serialize(const XrDebugUtilsMessengerCallbackDataEXT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_ptr(s->messageId, count_null_terminated(s->messageId), ctx);
-    serialize_ptr(s->functionName, count_null_terminated(s->functionName), ctx);
-    serialize_ptr(s->message, count_null_terminated(s->message), ctx);
+    serialize_string(s->messageId, ctx);
+    serialize_string(s->functionName, ctx);
+    serialize_string(s->message, ctx);
     serialize(&s->objectCount, ctx);
     serialize_ptr(s->objects, s->objectCount, ctx);
     serialize(&s->sessionLabelCount, ctx);
@@ -1898,9 +1897,9 @@ void serialize(const XrDebugUtilsMessengerCallbackDataEXT* s, SerializeContext&
 void serialize(const XrDebugUtilsMessengerCallbackDataEXT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_ptr(s->messageId, count_null_terminated(s->messageId), ctx);
-    serialize_ptr(s->functionName, count_null_terminated(s->functionName), ctx);
-    serialize_ptr(s->message, count_null_terminated(s->message), ctx);
+    serialize_string(s->messageId, ctx);
+    serialize_string(s->functionName, ctx);
+    serialize_string(s->message, ctx);
     serialize(&s->objectCount, ctx);
     serialize_ptr(s->objects, s->objectCount, ctx);
     serialize(&s->sessionLabelCount, ctx);
@@ -1933,7 +1932,7 @@ void serialize(const XrDebugUtilsObjectNameInfoEXT* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->objectType, ctx);
     serialize(&s->objectHandle, ctx);
-    serialize_ptr(s->objectName, count_null_terminated(s->objectName), ctx);
+    serialize_string(s->objectName, ctx);
 }
 
 
@@ -1942,7 +1941,7 @@ void serialize(const XrDebugUtilsObjectNameInfoEXT* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->objectType, ctx);
     serialize(&s->objectHandle, ctx);
-    serialize_ptr(s->objectName, count_null_terminated(s->objectName), ctx);
+    serialize_string(s->objectName, ctx);
 }
 
 #endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
@@ -2151,7 +2150,7 @@ void serialize(const XrHandJointLocationsEXT* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->isActive, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointCount, QUANTIZED_XR_EXT_hand_tracking, ctx);
 }
 
 
@@ -2160,7 +2159,7 @@ void serialize(const XrHandJointLocationsEXT* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->isActive, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointCount, QUANTIZED_XR_EXT_hand_tracking, ctx);
 }
 
 
@@ -2168,7 +2167,7 @@ void serialize(const XrHandJointVelocitiesEXT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->jointVelocities, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->jointVelocities, s->jointCount, QUANTIZED_XR_EXT_hand_tracking, ctx);
 }
 
 
@@ -2176,7 +2175,7 @@ void serialize(const XrHandJointVelocitiesEXT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->jointVelocities, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->jointVelocities, s->jointCount, QUANTIZED_XR_EXT_hand_tracking, ctx);
 }
 
 
@@ -2513,7 +2512,7 @@ void serialize(const XrBodyJointLocationsFB* s, SerializeContext& ctx) {
     serialize(&s->isActive, ctx);
     serialize(&s->confidence, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointCount, QUANTIZED_XR_FB_body_tracking, ctx);
     serialize(&s->skeletonChangedCount, ctx);
     serialize_time(&s->time, ctx);
 }
@@ -2525,7 +2524,7 @@ void serialize(const XrBodyJointLocationsFB* s, SerializeContext& ctx) {
     serialize(&s->isActive, ctx);
     serialize(&s->confidence, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointCount, QUANTIZED_XR_FB_body_tracking, ctx);
     serialize(&s->skeletonChangedCount, ctx);
     serialize_time(&s->time, ctx);
 }
@@ -2813,9 +2812,9 @@ void serialize(const XrFaceExpressionWeightsFB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->weightCount, ctx);
-    serialize_ptr(s->weights, s->weightCount, ctx);
+    serialize_quantizable_ptr(s->weights, s->weightCount, QUANTIZED_XR_FB_face_tracking, ctx);
     serialize(&s->confidenceCount, ctx);
-    serialize_ptr(s->confidences, s->confidenceCount, ctx);
+    serialize_quantizable_ptr(s->confidences, s->confidenceCount, QUANTIZED_XR_FB_face_tracking, ctx);
     serialize(&s->status, ctx);
     serialize_time(&s->time, ctx);
 }
@@ -2825,9 +2824,9 @@ void serialize(const XrFaceExpressionWeightsFB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->weightCount, ctx);
-    serialize_ptr(s->weights, s->weightCount, ctx);
+    serialize_quantizable_ptr(s->weights, s->weightCount, QUANTIZED_XR_FB_face_tracking, ctx);
     serialize(&s->confidenceCount, ctx);
-    serialize_ptr(s->confidences, s->confidenceCount, ctx);
+    serialize_quantizable_ptr(s->confidences, s->confidenceCount, QUANTIZED_XR_FB_face_tracking, ctx);
     serialize(&s->status, ctx);
     serialize_time(&s->time, ctx);
 }
@@ -2881,9 +2880,9 @@ void serialize(const XrFaceExpressionWeights2FB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->weightCount, ctx);
-    serialize_ptr(s->weights, s->weightCount, ctx);
+    serialize_quantizable_ptr(s->weights, s->weightCount, QUANTIZED_XR_FB_face_tracking2, ctx);
     serialize(&s->confidenceCount, ctx);
-    serialize_ptr(s->confidences, s->confidenceCount, ctx);
+    serialize_quantizable_ptr(s->confidences, s->confidenceCount, QUANTIZED_XR_FB_face_tracking2, ctx);
     serialize(&s->isValid, ctx);
     serialize(&s->isEyeFollowingBlendshapesValid, ctx);
     serialize(&s->dataSource, ctx);
@@ -2895,9 +2894,9 @@ void serialize(const XrFaceExpressionWeights2FB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->weightCount, ctx);
-    serialize_ptr(s->weights, s->weightCount, ctx);
+    serialize_quantizable_ptr(s->weights, s->weightCount, QUANTIZED_XR_FB_face_tracking2, ctx);
     serialize(&s->confidenceCount, ctx);
-    serialize_ptr(s->confidences, s->confidenceCount, ctx);
+    serialize_quantizable_ptr(s->confidences, s->confidenceCount, QUANTIZED_XR_FB_face_tracking2, ctx);
     serialize(&s->isValid, ctx);
     serialize(&s->isEyeFollowingBlendshapesValid, ctx);
     serialize(&s->dataSource, ctx);
@@ -3222,7 +3221,7 @@ void serialize(const XrKeyboardTrackingDescriptionFB* s, SerializeContext& ctx)
     serialize(&s->trackedKeyboardId, ctx);
     serialize(&s->size, ctx);
     serialize(&s->flags, ctx);
-    serialize_array(s->name, XR_MAX_KEYBOARD_TRACKING_NAME_SIZE_FB, ctx);
+    serialize_string_array(s->name, XR_MAX_KEYBOARD_TRACKING_NAME_SIZE_FB, ctx);
 }
 
 
@@ -3536,7 +3535,7 @@ void serialize(const XrRenderModelPropertiesFB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->vendorId, ctx);
-    serialize_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
+    serialize_string_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
     serialize(&s->modelKey, ctx);
     serialize(&s->modelVersion, ctx);
     serialize(&s->flags, ctx);
@@ -3547,7 +3546,7 @@ void serialize(const XrRenderModelPropertiesFB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->vendorId, ctx);
-    serialize_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
+    serialize_string_array(s->modelName, XR_MAX_RENDER_MODEL_NAME_SIZE_FB, ctx);
     serialize(&s->modelKey, ctx);
     serialize(&s->modelVersion, ctx);
     serialize(&s->flags, ctx);
@@ -3645,7 +3644,7 @@ void serialize(const XrSemanticLabelsSupportInfoFB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->flags, ctx);
-    serialize_ptr(s->recognizedLabels, count_null_terminated(s->recognizedLabels), ctx);
+    serialize_string(s->recognizedLabels, ctx);
 }
 
 
@@ -3653,7 +3652,7 @@ void serialize(const XrSemanticLabelsSupportInfoFB* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->flags, ctx);
-    serialize_ptr(s->recognizedLabels, count_null_terminated(s->recognizedLabels), ctx);
+    serialize_string(s->recognizedLabels, ctx);
 }
 
 #endif // XRTRANSPORT_EXT_XR_FB_scene
@@ -4345,7 +4344,7 @@ void serialize(const XrSpatialAnchorCreateInfoHTC* s, SerializeContext& ctx) {
 
 
 void serialize(const XrSpatialAnchorNameHTC* s, SerializeContext& ctx) {
-    serialize_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_HTC, ctx);
+    serialize_string_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_HTC, ctx);
 }
 
 
@@ -4377,7 +4376,7 @@ void serialize(const XrBodyJointLocationsHTC* s, SerializeContext& ctx) {
     serialize(&s->combinedLocationFlags, ctx);
     serialize(&s->confidenceLevel, ctx);
     serialize(&s->jointLocationCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointLocationCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointLocationCount, QUANTIZED_XR_HTC_body_tracking, ctx);
     serialize(&s->skeletonGenerationId, ctx);
 }
 
@@ -4388,7 +4387,7 @@ void serialize(const XrBodyJointLocationsHTC* s, SerializeContext& ctx) {
     serialize(&s->combinedLocationFlags, ctx);
     serialize(&s->confidenceLevel, ctx);
     serialize(&s->jointLocationCount, ctx);
-    serialize_ptr(s->jointLocations, s->jointLocationCount, ctx);
+    serialize_quantizable_ptr(s->jointLocations, s->jointLocationCount, QUANTIZED_XR_HTC_body_tracking, ctx);
     serialize(&s->skeletonGenerationId, ctx);
 }
 
@@ -4413,7 +4412,7 @@ void serialize(const XrBodySkeletonHTC* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->joints, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->joints, s->jointCount, QUANTIZED_XR_HTC_body_tracking, ctx);
 }
 
 
@@ -4421,7 +4420,7 @@ void serialize(const XrBodySkeletonHTC* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->jointCount, ctx);
-    serialize_ptr(s->joints, s->jointCount, ctx);
+    serialize_quantizable_ptr(s->joints, s->jointCount, QUANTIZED_XR_HTC_body_tracking, ctx);
 }
 
 
@@ -6139,7 +6138,7 @@ void serialize(const XrEventDataVirtualKeyboardCommitTextMETA* s, SerializeConte
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->keyboard, ctx);
-    serialize_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
+    serialize_string_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
 }
 
 
@@ -6147,7 +6146,7 @@ void serialize(const XrEventDataVirtualKeyboardCommitTextMETA* s, SerializeConte
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->keyboard, ctx);
-    serialize_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
+    serialize_string_array(s->text, XR_MAX_VIRTUAL_KEYBOARD_COMMIT_TEXT_SIZE_META, ctx);
 }
 
 
@@ -6328,14 +6327,14 @@ void serialize(const XrVirtualKeyboardSpaceCreateInfoMETA* s, SerializeContext&
 void serialize(const XrVirtualKeyboardTextContextChangeInfoMETA* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_ptr(s->textContext, count_null_terminated(s->textContext), ctx);
+    serialize_string(s->textContext, ctx);
 }
 
 
 void serialize(const XrVirtualKeyboardTextContextChangeInfoMETA* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_ptr(s->textContext, count_null_terminated(s->textContext), ctx);
+    serialize_string(s->textContext, ctx);
 }
 
 
@@ -6546,7 +6545,7 @@ void serialize(const XrLocalizationMapImportInfoML* s, SerializeContext& ctx) {
 void serialize(const XrLocalizationMapML* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
+    serialize_string_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
     serialize(&s->mapUuid, ctx);
     serialize(&s->mapType, ctx);
 }
@@ -6555,7 +6554,7 @@ void serialize(const XrLocalizationMapML* s, SerializeContext& ctx) {
 void serialize(const XrLocalizationMapML* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
+    serialize_string_array(s->name, XR_MAX_LOCALIZATION_MAP_NAME_LENGTH_ML, ctx);
     serialize(&s->mapUuid, ctx);
     serialize(&s->mapType, ctx);
 }
@@ -7413,16 +7412,16 @@ void serialize(const XrControllerModelKeyStateMSFT* s, SerializeContext& ctx) {
 void serialize(const XrControllerModelNodePropertiesMSFT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
-    serialize_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    serialize_string_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    serialize_string_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
 }
 
 
 void serialize(const XrControllerModelNodePropertiesMSFT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
-    serialize_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    serialize_string_array(s->parentNodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
+    serialize_string_array(s->nodeName, XR_MAX_CONTROLLER_MODEL_NODE_NAME_SIZE_MSFT, ctx);
 }
 
 
@@ -7544,7 +7543,7 @@ void serialize(const XrHandMeshVertexBufferMSFT* s, SerializeContext& ctx) {
     serialize_time(&s->vertexUpdateTime, ctx);
     serialize(&s->vertexCapacityInput, ctx);
     serialize(&s->vertexCountOutput, ctx);
-    serialize_ptr(s->vertices, s->vertexCapacityInput, ctx);
+    serialize_quantizable_ptr(s->vertices, s->vertexCapacityInput, QUANTIZED_XR_MSFT_hand_tracking_mesh, ctx);
 }
 
 
@@ -7694,9 +7693,9 @@ void serialize(const XrSceneBoundsMSFT* s, SerializeContext& ctx) {
     serialize(&s->space, ctx);
     serialize_time(&s->time, ctx);
     serialize(&s->sphereCount, ctx);
-    serialize_ptr(s->spheres, s->sphereCount, ctx);
+    serialize_quantizable_ptr(s->spheres, s->sphereCount, QUANTIZED_XR_MSFT_scene_understanding, ctx);
     serialize(&s->boxCount, ctx);
-    serialize_ptr(s->boxes, s->boxCount, ctx);
+    serialize_quantizable_ptr(s->boxes, s->boxCount, QUANTIZED_XR_MSFT_scene_understanding, ctx);
     serialize(&s->frustumCount, ctx);
     serialize_ptr(s->frustums, s->frustumCount, ctx);
 }
@@ -7712,7 +7711,7 @@ void serialize(const XrSceneComponentLocationsMSFT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->locationCount, ctx);
-    serialize_ptr(s->locations, s->locationCount, ctx);
+    serialize_quantizable_ptr(s->locations, s->locationCount, QUANTIZED_XR_MSFT_scene_understanding, ctx);
 }
 
 
@@ -7720,7 +7719,7 @@ void serialize(const XrSceneComponentLocationsMSFT* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->locationCount, ctx);
-    serialize_ptr(s->locations, s->locationCount, ctx);
+    serialize_quantizable_ptr(s->locations, s->locationCount, QUANTIZED_XR_MSFT_scene_understanding, ctx);
 }
 
 
@@ -8231,7 +8230,7 @@ void serialize(const XrSpatialAnchorPersistenceInfoMSFT* s, SerializeContext& ct
 
 
 void serialize(const XrSpatialAnchorPersistenceNameMSFT* s, SerializeContext& ctx) {
-    serialize_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_MSFT, ctx);
+    serialize_string_array(s->name, XR_MAX_SPATIAL_ANCHOR_NAME_SIZE_MSFT, ctx);
 }
 
 #endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
@@ -8323,7 +8322,7 @@ void serialize(const XrExternalCameraIntrinsicsOCULUS* s, SerializeContext& ctx)
 void serialize(const XrExternalCameraOCULUS* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
+    serialize_string_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
     serialize(&s->intrinsics, ctx);
     serialize(&s->extrinsics, ctx);
 }
@@ -8332,7 +8331,7 @@ void serialize(const XrExternalCameraOCULUS* s, SerializeContext& ctx) {
 void serialize(const XrExternalCameraOCULUS* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
+    serialize_string_array(s->name, XR_MAX_EXTERNAL_CAMERA_NAME_SIZE_OCULUS, ctx);
     serialize(&s->intrinsics, ctx);
     serialize(&s->extrinsics, ctx);
 }
@@ -8482,19 +8481,19 @@ void serialize(const XrSystemMarkerTrackingPropertiesVARJO* s, SerializeContext&
 void serialize(const XrActionCreateInfo* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->actionName, XR_MAX_ACTION_NAME_SIZE, ctx);
+    serialize_string_array(s->actionName, XR_MAX_ACTION_NAME_SIZE, ctx);
     serialize(&s->actionType, ctx);
     serialize(&s->countSubactionPaths, ctx);
     serialize_ptr(s->subactionPaths, s->countSubactionPaths, ctx);
-    serialize_array(s->localizedActionName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE, ctx);
+    serialize_string_array(s->localizedActionName, XR_MAX_LOCALIZED_ACTION_NAME_SIZE, ctx);
 }
 
 
 void serialize(const XrActionSetCreateInfo* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->actionSetName, XR_MAX_ACTION_SET_NAME_SIZE, ctx);
-    serialize_array(s->localizedActionSetName, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE, ctx);
+    serialize_string_array(s->actionSetName, XR_MAX_ACTION_SET_NAME_SIZE, ctx);
+    serialize_string_array(s->localizedActionSetName, XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE, ctx);
     serialize(&s->priority, ctx);
 }
 
@@ -8576,17 +8575,17 @@ void serialize(const XrActiveActionSet* s, SerializeContext& ctx) {
 void serialize(const XrApiLayerProperties* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->layerName, XR_MAX_API_LAYER_NAME_SIZE, ctx);
+    serialize_string_array(s->layerName, XR_MAX_API_LAYER_NAME_SIZE, ctx);
     serialize(&s->specVersion, ctx);
     serialize(&s->layerVersion, ctx);
-    serialize_array(s->description, XR_MAX_API_LAYER_DESCRIPTION_SIZE, ctx);
+    serialize_string_array(s->description, XR_MAX_API_LAYER_DESCRIPTION_SIZE, ctx);
 }
 
 
 void serialize(const XrApplicationInfo* s, SerializeContext& ctx) {
-    serialize_array(s->applicationName, XR_MAX_APPLICATION_NAME_SIZE, ctx);
+    serialize_string_array(s->applicationName, XR_MAX_APPLICATION_NAME_SIZE, ctx);
     serialize(&s->applicationVersion, ctx);
-    serialize_array(s->engineName, XR_MAX_ENGINE_NAME_SIZE, ctx);
+    serialize_string_array(s->engineName, XR_MAX_ENGINE_NAME_SIZE, ctx);
     serialize(&s->engineVersion, ctx);
     serialize(&s->apiVersion, ctx);
 }
@@ -8717,7 +8716,7 @@ void serialize(const XrEventDataSessionStateChanged* s, SerializeContext& ctx) {
 void serialize(const XrExtensionProperties* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
-    serialize_array(s->extensionName, XR_MAX_EXTENSION_NAME_SIZE, ctx);
+    serialize_string_array(s->extensionName, XR_MAX_EXTENSION_NAME_SIZE, ctx);
     serialize(&s->extensionVersion, ctx);
 }
 
@@ -8812,7 +8811,7 @@ void serialize(const XrInstanceProperties* s, SerializeContext& ctx) {
     serialize(&s->type, ctx);
     serialize_xr(s->next, ctx);
     serialize(&s->runtimeVersion, ctx);
-    serialize_array(s->runtimeName, XR_MAX_RUNTIME_NAME_SIZE, ctx);
+    serialize_string_array(s->runtimeName, XR_MAX_RUNTIME_NAME_SIZE, ctx);
 }
 
 
@@ -9028,7 +9027,7 @@ void serialize(const XrSystemProperties* s, SerializeContext& ctx) {
     serialize_xr(s->next, ctx);
     serialize(&s->systemId, ctx);
     serialize(&s->vendorId, ctx);
-    serialize_array(s->systemName, XR_MAX_SYSTEM_NAME_SIZE, ctx);
+    serialize_string_array(s->systemName, XR_MAX_SYSTEM_NAME_SIZE, ctx);
     serialize(&s->graphicsProperties, ctx);
     serialize(&s->trackingProperties, ctx);
 }
@@ -9110,6 +9109,221 @@ void serialize(const XrViewState* s, SerializeContext& ctx) {
 }
 
 
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+// Quantizers
+#ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
+bool quantize(const XrBodyJointLocationBD* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_flags(s[i].locationFlags)) {
+            return false;
+        }
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+bool quantize(const XrHandJointLocationEXT* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_flags(s[i].locationFlags)) {
+            return false;
+        }
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+        if (!writer.put_float(s[i].radius)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool quantize(const XrHandJointVelocityEXT* s, std::size_t count, QuantizedWriter& writer) {
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_flags(s[i].velocityFlags)) {
+            return false;
+        }
+        if (!writer.put_vector(s[i].linearVelocity)) {
+            return false;
+        }
+        if (!writer.put_vector(s[i].angularVelocity)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
+bool quantize(const XrBodyJointLocationFB* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_flags(s[i].locationFlags)) {
+            return false;
+        }
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
+bool quantize(const XrBodyJointLocationHTC* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_flags(s[i].locationFlags)) {
+            return false;
+        }
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+bool quantize(const XrHandMeshVertexMSFT* s, std::size_t count, QuantizedWriter& writer) {
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_vector(s[i].position)) {
+            return false;
+        }
+        if (!writer.put_vector(s[i].normal)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+bool quantize(const XrSceneComponentLocationMSFT* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_flags(s[i].flags)) {
+            return false;
+        }
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool quantize(const XrSceneOrientedBoxBoundMSFT* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+        if (!writer.put_vector(s[i].extents)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool quantize(const XrSceneSphereBoundMSFT* s, std::size_t count, QuantizedWriter& writer) {
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_vector(s[i].center)) {
+            return false;
+        }
+        if (!writer.put_float(s[i].radius)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+bool quantize(const XrBodySkeletonJointHTC* s, std::size_t count, QuantizedWriter& writer) {
+    for (std::size_t i = 0; i < count; i++) {
+        writer.include_position(s[i].pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        if (!writer.put_pose(s[i].pose)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+
+struct QuantizedExtensionEntry {
+    const char* name;
+    std::uint64_t bit;
+};
+
+constexpr QuantizedExtensionEntry quantized_extension_entries[] = {
+    {"XR_BD_body_tracking", QUANTIZED_XR_BD_body_tracking},
+    {"XR_EXT_hand_tracking", QUANTIZED_XR_EXT_hand_tracking},
+    {"XR_FB_body_tracking", QUANTIZED_XR_FB_body_tracking},
+    {"XR_FB_face_tracking", QUANTIZED_XR_FB_face_tracking},
+    {"XR_FB_face_tracking2", QUANTIZED_XR_FB_face_tracking2},
+    {"XR_HTC_body_tracking", QUANTIZED_XR_HTC_body_tracking},
+    {"XR_MSFT_hand_tracking_mesh", QUANTIZED_XR_MSFT_hand_tracking_mesh},
+    {"XR_MSFT_scene_understanding", QUANTIZED_XR_MSFT_scene_understanding},
+};
+
+std::uint64_t quantized_extension_bit(const std::string& extension_name) {
+    for (const QuantizedExtensionEntry& entry : quantized_extension_entries) {
+        if (extension_name == entry.name) {
+            return entry.bit;
+        }
+    }
+    return 0;
+}
 
 // takes a local time, converts it to remote time, and puts it on the stream
 void serialize_time(const XrTime* local_time, SerializeContext& ctx) {
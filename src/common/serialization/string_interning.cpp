@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/error.h"
+#include "xrtransport/util.h"
+
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+using std::uint8_t;
+using std::uint32_t;
+using std::uint64_t;
+
+namespace xrtransport {
+
+const uint32_t* StringInterner::find(std::string_view string) const {
+    auto it = ids.find(string);
+    return it != ids.end() ? &it->second : nullptr;
+}
+
+void StringInterner::add(std::string_view string) {
+    if (!should_intern(string.size(), strings.size())) {
+        return;
+    }
+    strings.emplace_back(string);
+    ids.emplace(strings.back(), static_cast<uint32_t>(strings.size() - 1));
+    pending++;
+}
+
+void StringInterner::commit() {
+    pending = 0;
+}
+
+void StringInterner::rollback() {
+    for (; pending > 0; pending--) {
+        ids.erase(strings.back());
+        strings.pop_back();
+    }
+}
+
+const std::string* StringTable::add(std::string string) {
+    if (!should_intern(string.size(), strings.size())) {
+        return nullptr;
+    }
+    strings.push_back(std::move(string));
+    return &strings.back();
+}
+
+const std::string& StringTable::get(uint64_t id) const {
+    if (id >= strings.size()) {
+        throw StringInterningException("unknown string id: " + std::to_string(id));
+    }
+    return strings[id];
+}
+
+static void write_varint(uint64_t value, SyncWriteStream& out) {
+    uint8_t bytes[10];
+    std::size_t size = 0;
+    while (value >= 0x80) {
+        bytes[size++] = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+    bytes[size++] = static_cast<uint8_t>(value);
+    asio::write(out, asio::buffer(bytes, size));
+}
+
+static uint64_t read_varint(SyncReadStream& in) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte{};
+        asio::read(in, asio::buffer(&byte, sizeof(uint8_t)));
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw StringInterningException("varint too long");
+}
+
+static void write_string(const char* data, std::size_t size, SerializeContext& ctx) {
+    std::string_view string(data, size);
+    if (const uint32_t* id = ctx.strings->find(string)) {
+        write_varint((static_cast<uint64_t>(*id) << 1) | 1, ctx.out);
+        return;
+    }
+    ctx.strings->add(string);
+    write_varint((static_cast<uint64_t>(size) + 1) << 1, ctx.out);
+    asio::write(ctx.out, asio::buffer(data, size));
+}
+
+// Returns nullptr for a nullptr string, otherwise either the interned string or literal
+static const std::string* read_string(std::string& literal, DeserializeContext& ctx) {
+    uint64_t tag = read_varint(ctx.in);
+    if (tag == 0) {
+        return nullptr;
+    }
+    if (tag & 1) {
+        return &ctx.strings->get(tag >> 1);
+    }
+    uint64_t size = (tag >> 1) - 1;
+    if (size > UINT32_MAX) {
+        throw StringInterningException("string too long: " + std::to_string(size));
+    }
+    literal.resize(size);
+    asio::read(ctx.in, asio::buffer(literal.data(), size));
+    if (const std::string* interned = ctx.strings->add(literal)) {
+        return interned;
+    }
+    return &literal;
+}
+
+void serialize_string(const char* x, SerializeContext& ctx) {
+    if (!ctx.strings) {
+        serialize_ptr(x, count_null_terminated(x), ctx);
+        return;
+    }
+    if (!x) {
+        write_varint(0, ctx.out);
+        return;
+    }
+    write_string(x, std::strlen(x), ctx);
+}
+
+void serialize_string_array(const char* x, std::size_t size, SerializeContext& ctx) {
+    if (!ctx.strings) {
+        serialize_array(x, size, ctx);
+        return;
+    }
+    write_string(x, strnlen(x, size), ctx);
+}
+
+void serialize_string_buffer(const char* x, std::size_t capacity, SerializeContext& ctx) {
+    if (!ctx.strings) {
+        serialize_ptr(x, capacity, ctx);
+        return;
+    }
+    if (!x || capacity == 0) {
+        write_varint(0, ctx.out);
+        return;
+    }
+    write_string(x, strnlen(x, capacity), ctx);
+}
+
+template <typename Char>
+static void deserialize_string_impl(Char** x, DeserializeContext& ctx) {
+    if (!ctx.strings) {
+        deserialize_ptr(x, ctx);
+        return;
+    }
+
+    std::string literal;
+    const std::string* string = read_string(literal, ctx);
+    if (!string) {
+        if (ctx.in_place) {
+            if (*x) {
+                throw std::runtime_error("Attempted to deserialize in-place nullptr but pointer is allocated");
+            }
+        }
+        else {
+            *x = nullptr;
+        }
+        return;
+    }
+
+    if (ctx.in_place) {
+        if (!*x) {
+            throw std::runtime_error("Attempted to deserialize in-place into nullptr");
+        }
+        std::memcpy(const_cast<char*>(*x), string->c_str(), string->size() + 1);
+        return;
+    }
+
+    // interned strings live as long as the connection, so they can be used directly
+    if constexpr (std::is_const_v<Char>) {
+        BorrowScope* scope = BorrowScope::active();
+        if (scope && string != &literal) {
+            scope->add_borrowed(string->c_str());
+            *x = string->c_str();
+            return;
+        }
+    }
+    char* data = static_cast<char*>(std::malloc(string->size() + 1));
+    std::memcpy(data, string->c_str(), string->size() + 1);
+    *x = data;
+}
+
+void deserialize_string(const char** x, DeserializeContext& ctx) {
+    deserialize_string_impl(x, ctx);
+}
+
+void deserialize_string(char** x, DeserializeContext& ctx) {
+    deserialize_string_impl(x, ctx);
+}
+
+void deserialize_string_array(char* x, std::size_t size, DeserializeContext& ctx) {
+    if (!ctx.strings) {
+        deserialize_array(x, size, ctx);
+        return;
+    }
+    std::string literal;
+    const std::string* string = read_string(literal, ctx);
+    std::size_t string_size = string ? string->size() : 0;
+    if (string_size > size) {
+        throw StringInterningException("string of size " + std::to_string(string_size) +
+            " does not fit in array of size " + std::to_string(size));
+    }
+    if (string_size) {
+        std::memcpy(x, string->data(), string_size);
+    }
+    std::memset(x + string_size, 0, size - string_size);
+}
+
+void deserialize_string_buffer(char* x, std::size_t capacity, DeserializeContext& ctx) {
+    if (!ctx.strings) {
+        deserialize_ptr(&x, ctx);
+        return;
+    }
+    std::string literal;
+    const std::string* string = read_string(literal, ctx);
+    if (!string) {
+        return;
+    }
+    if (!x || string->size() > capacity) {
+        throw StringInterningException("string of size " + std::to_string(string->size()) +
+            " does not fit in buffer of capacity " + std::to_string(capacity));
+    }
+    std::memcpy(x, string->data(), string->size());
+    if (string->size() < capacity) {
+        x[string->size()] = '\0';
+    }
+}
+
+} // namespace xrtransport
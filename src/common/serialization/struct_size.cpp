@@ -10,15 +10,15 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "xrtransport/serialization/struct_size.h"
+#include "xrtransport/serialization/struct_index.h"
 #include "xrtransport/serialization/error.h"
 
-#include <unordered_map>
 #include <cstddef>
 #include <string>
 
 namespace xrtransport {
 
-std::unordered_map<XrStructureType, std::size_t> size_lookup_table = {
+constexpr StructTableEntry<std::size_t> size_lookup_entries[] = {
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
     {XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE, sizeof(XrDigitalLensControlALMALENCE)},
 #endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
@@ -1146,14 +1146,10 @@ std::unordered_map<XrStructureType, std::size_t> size_lookup_table = {
 
 };
 
+constexpr auto size_lookup_table = make_struct_table(size_lookup_entries);
+
 std::size_t size_lookup(XrStructureType struct_type) {
-    auto it = size_lookup_table.find(struct_type);
-    if (it == size_lookup_table.end()) {
-        return 0;
-    }
-    else {
-        return it->second;
-    }
+    return size_lookup_table[struct_type_index(struct_type)];
 }
 
 } // namespace xrtransport
\ No newline at end of file
@@ -0,0 +1,18317 @@
+/*
+ * AUTO-GENERATED FILE - DO NOT EDIT DIRECTLY
+ *
+ * This file was automatically generated by the code_generation module.
+ * Any changes made to this file will be lost when regenerated.
+ *
+ * To modify this file, edit the corresponding template in:
+ * code_generation/templates/structs/struct_tables.mako
+ */
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+
+
+
+
+// Field tables for table-driven serialization, see table_serialization.h. Used instead of the generated
+// serializers, deserializers and cleaners in serializer.cpp and deserializer.cpp.
+
+#include "xrtransport/serialization/table_serialization.h"
+
+#ifdef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+namespace xrtransport {
+
+#ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
+constexpr FieldDescriptor fields_XrDigitalLensControlALMALENCE[] = {
+    FIELD_VALUE(XrDigitalLensControlALMALENCE, type),
+    FIELD_XR(XrDigitalLensControlALMALENCE, next),
+    FIELD_VALUE(XrDigitalLensControlALMALENCE, flags),
+};
+
+void serialize(const XrDigitalLensControlALMALENCE* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDigitalLensControlALMALENCE, ctx);
+}
+
+void deserialize(XrDigitalLensControlALMALENCE* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDigitalLensControlALMALENCE, ctx);
+}
+
+void cleanup(const XrDigitalLensControlALMALENCE* s) {
+    cleanup_fields(s, fields_XrDigitalLensControlALMALENCE);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
+#ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
+constexpr FieldDescriptor fields_XrBodyJointLocationBD[] = {
+    FIELD_VALUE(XrBodyJointLocationBD, locationFlags),
+    FIELD_VALUE(XrBodyJointLocationBD, pose),
+};
+
+void serialize(const XrBodyJointLocationBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationBD, ctx);
+}
+
+void deserialize(XrBodyJointLocationBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationBD, ctx);
+}
+
+void cleanup(const XrBodyJointLocationBD* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationBD);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointLocationsBD[] = {
+    FIELD_VALUE(XrBodyJointLocationsBD, type),
+    FIELD_XR(XrBodyJointLocationsBD, next),
+    FIELD_VALUE(XrBodyJointLocationsBD, allJointPosesTracked),
+    FIELD_VALUE(XrBodyJointLocationsBD, jointLocationCount),
+    FIELD_QUANTIZABLE_PTR(XrBodyJointLocationsBD, jointLocations, jointLocationCount, QUANTIZED_XR_BD_body_tracking),
+};
+
+void serialize(const XrBodyJointLocationsBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationsBD, ctx);
+}
+
+void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationsBD, ctx);
+}
+
+void cleanup(const XrBodyJointLocationsBD* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationsBD);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointLocationsBD[] = {
+    FIELD_VALUE(XrBodyJointLocationsBD, type),
+    FIELD_XR(XrBodyJointLocationsBD, next),
+    FIELD_VALUE(XrBodyJointLocationsBD, allJointPosesTracked),
+    FIELD_VALUE(XrBodyJointLocationsBD, jointLocationCount),
+    FIELD_QUANTIZABLE_PTR(XrBodyJointLocationsBD, jointLocations, jointLocationCount, QUANTIZED_XR_BD_body_tracking),
+};
+
+void serialize(const XrBodyJointLocationsBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationsBD, ctx);
+}
+
+void deserialize(XrBodyJointLocationsBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationsBD, ctx);
+}
+
+void cleanup(const XrBodyJointLocationsBD* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationsBD);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointsLocateInfoBD[] = {
+    FIELD_VALUE(XrBodyJointsLocateInfoBD, type),
+    FIELD_XR(XrBodyJointsLocateInfoBD, next),
+    FIELD_VALUE(XrBodyJointsLocateInfoBD, baseSpace),
+    FIELD_TIME(XrBodyJointsLocateInfoBD, time),
+};
+
+void serialize(const XrBodyJointsLocateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointsLocateInfoBD, ctx);
+}
+
+void deserialize(XrBodyJointsLocateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointsLocateInfoBD, ctx);
+}
+
+void cleanup(const XrBodyJointsLocateInfoBD* s) {
+    cleanup_fields(s, fields_XrBodyJointsLocateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointsLocateInfoBD[] = {
+    FIELD_VALUE(XrBodyJointsLocateInfoBD, type),
+    FIELD_XR(XrBodyJointsLocateInfoBD, next),
+    FIELD_VALUE(XrBodyJointsLocateInfoBD, baseSpace),
+    FIELD_TIME(XrBodyJointsLocateInfoBD, time),
+};
+
+void serialize(const XrBodyJointsLocateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointsLocateInfoBD, ctx);
+}
+
+void deserialize(XrBodyJointsLocateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointsLocateInfoBD, ctx);
+}
+
+void cleanup(const XrBodyJointsLocateInfoBD* s) {
+    cleanup_fields(s, fields_XrBodyJointsLocateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrBodyTrackerCreateInfoBD[] = {
+    FIELD_VALUE(XrBodyTrackerCreateInfoBD, type),
+    FIELD_XR(XrBodyTrackerCreateInfoBD, next),
+    FIELD_VALUE(XrBodyTrackerCreateInfoBD, jointSet),
+};
+
+void serialize(const XrBodyTrackerCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyTrackerCreateInfoBD, ctx);
+}
+
+void deserialize(XrBodyTrackerCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyTrackerCreateInfoBD, ctx);
+}
+
+void cleanup(const XrBodyTrackerCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrBodyTrackerCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrBodyTrackerCreateInfoBD[] = {
+    FIELD_VALUE(XrBodyTrackerCreateInfoBD, type),
+    FIELD_XR(XrBodyTrackerCreateInfoBD, next),
+    FIELD_VALUE(XrBodyTrackerCreateInfoBD, jointSet),
+};
+
+void serialize(const XrBodyTrackerCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyTrackerCreateInfoBD, ctx);
+}
+
+void deserialize(XrBodyTrackerCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyTrackerCreateInfoBD, ctx);
+}
+
+void cleanup(const XrBodyTrackerCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrBodyTrackerCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemBodyTrackingPropertiesBD[] = {
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesBD, type),
+    FIELD_XR(XrSystemBodyTrackingPropertiesBD, next),
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesBD, supportsBodyTracking),
+};
+
+void serialize(const XrSystemBodyTrackingPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemBodyTrackingPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemBodyTrackingPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemBodyTrackingPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemBodyTrackingPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemBodyTrackingPropertiesBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemBodyTrackingPropertiesBD[] = {
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesBD, type),
+    FIELD_XR(XrSystemBodyTrackingPropertiesBD, next),
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesBD, supportsBodyTracking),
+};
+
+void serialize(const XrSystemBodyTrackingPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemBodyTrackingPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemBodyTrackingPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemBodyTrackingPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemBodyTrackingPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemBodyTrackingPropertiesBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_BD_future_progress
+constexpr FieldDescriptor fields_XrFuturePollResultProgressBD[] = {
+    FIELD_VALUE(XrFuturePollResultProgressBD, type),
+    FIELD_XR(XrFuturePollResultProgressBD, next),
+    FIELD_VALUE(XrFuturePollResultProgressBD, isSupported),
+    FIELD_VALUE(XrFuturePollResultProgressBD, progressPercentage),
+};
+
+void serialize(const XrFuturePollResultProgressBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFuturePollResultProgressBD, ctx);
+}
+
+void deserialize(XrFuturePollResultProgressBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFuturePollResultProgressBD, ctx);
+}
+
+void cleanup(const XrFuturePollResultProgressBD* s) {
+    cleanup_fields(s, fields_XrFuturePollResultProgressBD);
+}
+
+constexpr FieldDescriptor fields_XrFuturePollResultProgressBD[] = {
+    FIELD_VALUE(XrFuturePollResultProgressBD, type),
+    FIELD_XR(XrFuturePollResultProgressBD, next),
+    FIELD_VALUE(XrFuturePollResultProgressBD, isSupported),
+    FIELD_VALUE(XrFuturePollResultProgressBD, progressPercentage),
+};
+
+void serialize(const XrFuturePollResultProgressBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFuturePollResultProgressBD, ctx);
+}
+
+void deserialize(XrFuturePollResultProgressBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFuturePollResultProgressBD, ctx);
+}
+
+void cleanup(const XrFuturePollResultProgressBD* s) {
+    cleanup_fields(s, fields_XrFuturePollResultProgressBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_future_progress
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_anchor
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateCompletionBD[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, type),
+    FIELD_XR(XrSpatialAnchorCreateCompletionBD, next),
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, futureResult),
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, anchor),
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, uuid),
+};
+
+void serialize(const XrSpatialAnchorCreateCompletionBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateCompletionBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateCompletionBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateCompletionBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateCompletionBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateCompletionBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateCompletionBD[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, type),
+    FIELD_XR(XrSpatialAnchorCreateCompletionBD, next),
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, futureResult),
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, anchor),
+    FIELD_VALUE(XrSpatialAnchorCreateCompletionBD, uuid),
+};
+
+void serialize(const XrSpatialAnchorCreateCompletionBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateCompletionBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateCompletionBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateCompletionBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateCompletionBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateCompletionBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoBD, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoBD, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoBD, pose),
+    FIELD_TIME(XrSpatialAnchorCreateInfoBD, time),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoBD, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoBD, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoBD, pose),
+    FIELD_TIME(XrSpatialAnchorCreateInfoBD, time),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorPersistInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorPersistInfoBD, type),
+    FIELD_XR(XrSpatialAnchorPersistInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorPersistInfoBD, location),
+    FIELD_VALUE(XrSpatialAnchorPersistInfoBD, anchor),
+};
+
+void serialize(const XrSpatialAnchorPersistInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorPersistInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorPersistInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorPersistInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorPersistInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorPersistInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorPersistInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorPersistInfoBD, type),
+    FIELD_XR(XrSpatialAnchorPersistInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorPersistInfoBD, location),
+    FIELD_VALUE(XrSpatialAnchorPersistInfoBD, anchor),
+};
+
+void serialize(const XrSpatialAnchorPersistInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorPersistInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorPersistInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorPersistInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorPersistInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorPersistInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorUnpersistInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorUnpersistInfoBD, type),
+    FIELD_XR(XrSpatialAnchorUnpersistInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorUnpersistInfoBD, location),
+    FIELD_VALUE(XrSpatialAnchorUnpersistInfoBD, anchor),
+};
+
+void serialize(const XrSpatialAnchorUnpersistInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorUnpersistInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorUnpersistInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorUnpersistInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorUnpersistInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorUnpersistInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorUnpersistInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorUnpersistInfoBD, type),
+    FIELD_XR(XrSpatialAnchorUnpersistInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorUnpersistInfoBD, location),
+    FIELD_VALUE(XrSpatialAnchorUnpersistInfoBD, anchor),
+};
+
+void serialize(const XrSpatialAnchorUnpersistInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorUnpersistInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorUnpersistInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorUnpersistInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorUnpersistInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorUnpersistInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialAnchorPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialAnchorPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialAnchorPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialAnchorPropertiesBD, supportsSpatialAnchor),
+};
+
+void serialize(const XrSystemSpatialAnchorPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialAnchorPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialAnchorPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialAnchorPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialAnchorPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialAnchorPropertiesBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialAnchorPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialAnchorPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialAnchorPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialAnchorPropertiesBD, supportsSpatialAnchor),
+};
+
+void serialize(const XrSystemSpatialAnchorPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialAnchorPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialAnchorPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialAnchorPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialAnchorPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialAnchorPropertiesBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_anchor
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_anchor_sharing
+constexpr FieldDescriptor fields_XrSharedSpatialAnchorDownloadInfoBD[] = {
+    FIELD_VALUE(XrSharedSpatialAnchorDownloadInfoBD, type),
+    FIELD_XR(XrSharedSpatialAnchorDownloadInfoBD, next),
+    FIELD_VALUE(XrSharedSpatialAnchorDownloadInfoBD, uuid),
+};
+
+void serialize(const XrSharedSpatialAnchorDownloadInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSharedSpatialAnchorDownloadInfoBD, ctx);
+}
+
+void deserialize(XrSharedSpatialAnchorDownloadInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSharedSpatialAnchorDownloadInfoBD, ctx);
+}
+
+void cleanup(const XrSharedSpatialAnchorDownloadInfoBD* s) {
+    cleanup_fields(s, fields_XrSharedSpatialAnchorDownloadInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSharedSpatialAnchorDownloadInfoBD[] = {
+    FIELD_VALUE(XrSharedSpatialAnchorDownloadInfoBD, type),
+    FIELD_XR(XrSharedSpatialAnchorDownloadInfoBD, next),
+    FIELD_VALUE(XrSharedSpatialAnchorDownloadInfoBD, uuid),
+};
+
+void serialize(const XrSharedSpatialAnchorDownloadInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSharedSpatialAnchorDownloadInfoBD, ctx);
+}
+
+void deserialize(XrSharedSpatialAnchorDownloadInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSharedSpatialAnchorDownloadInfoBD, ctx);
+}
+
+void cleanup(const XrSharedSpatialAnchorDownloadInfoBD* s) {
+    cleanup_fields(s, fields_XrSharedSpatialAnchorDownloadInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorShareInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorShareInfoBD, type),
+    FIELD_XR(XrSpatialAnchorShareInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorShareInfoBD, anchor),
+};
+
+void serialize(const XrSpatialAnchorShareInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorShareInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorShareInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorShareInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorShareInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorShareInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorShareInfoBD[] = {
+    FIELD_VALUE(XrSpatialAnchorShareInfoBD, type),
+    FIELD_XR(XrSpatialAnchorShareInfoBD, next),
+    FIELD_VALUE(XrSpatialAnchorShareInfoBD, anchor),
+};
+
+void serialize(const XrSpatialAnchorShareInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorShareInfoBD, ctx);
+}
+
+void deserialize(XrSpatialAnchorShareInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorShareInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialAnchorShareInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorShareInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialAnchorSharingPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialAnchorSharingPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialAnchorSharingPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialAnchorSharingPropertiesBD, supportsSpatialAnchorSharing),
+};
+
+void serialize(const XrSystemSpatialAnchorSharingPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialAnchorSharingPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialAnchorSharingPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialAnchorSharingPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialAnchorSharingPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialAnchorSharingPropertiesBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialAnchorSharingPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialAnchorSharingPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialAnchorSharingPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialAnchorSharingPropertiesBD, supportsSpatialAnchorSharing),
+};
+
+void serialize(const XrSystemSpatialAnchorSharingPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialAnchorSharingPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialAnchorSharingPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialAnchorSharingPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialAnchorSharingPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialAnchorSharingPropertiesBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_anchor_sharing
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_mesh
+constexpr FieldDescriptor fields_XrSenseDataProviderCreateInfoSpatialMeshBD[] = {
+    FIELD_VALUE(XrSenseDataProviderCreateInfoSpatialMeshBD, type),
+    FIELD_XR(XrSenseDataProviderCreateInfoSpatialMeshBD, next),
+    FIELD_VALUE(XrSenseDataProviderCreateInfoSpatialMeshBD, configFlags),
+    FIELD_VALUE(XrSenseDataProviderCreateInfoSpatialMeshBD, lod),
+};
+
+void serialize(const XrSenseDataProviderCreateInfoSpatialMeshBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataProviderCreateInfoSpatialMeshBD, ctx);
+}
+
+void deserialize(XrSenseDataProviderCreateInfoSpatialMeshBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataProviderCreateInfoSpatialMeshBD, ctx);
+}
+
+void cleanup(const XrSenseDataProviderCreateInfoSpatialMeshBD* s) {
+    cleanup_fields(s, fields_XrSenseDataProviderCreateInfoSpatialMeshBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataProviderCreateInfoSpatialMeshBD[] = {
+    FIELD_VALUE(XrSenseDataProviderCreateInfoSpatialMeshBD, type),
+    FIELD_XR(XrSenseDataProviderCreateInfoSpatialMeshBD, next),
+    FIELD_VALUE(XrSenseDataProviderCreateInfoSpatialMeshBD, configFlags),
+    FIELD_VALUE(XrSenseDataProviderCreateInfoSpatialMeshBD, lod),
+};
+
+void serialize(const XrSenseDataProviderCreateInfoSpatialMeshBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataProviderCreateInfoSpatialMeshBD, ctx);
+}
+
+void deserialize(XrSenseDataProviderCreateInfoSpatialMeshBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataProviderCreateInfoSpatialMeshBD, ctx);
+}
+
+void cleanup(const XrSenseDataProviderCreateInfoSpatialMeshBD* s) {
+    cleanup_fields(s, fields_XrSenseDataProviderCreateInfoSpatialMeshBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialMeshPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialMeshPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialMeshPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialMeshPropertiesBD, supportsSpatialMesh),
+};
+
+void serialize(const XrSystemSpatialMeshPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialMeshPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialMeshPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialMeshPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialMeshPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialMeshPropertiesBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialMeshPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialMeshPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialMeshPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialMeshPropertiesBD, supportsSpatialMesh),
+};
+
+void serialize(const XrSystemSpatialMeshPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialMeshPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialMeshPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialMeshPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialMeshPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialMeshPropertiesBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_mesh
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_scene
+constexpr FieldDescriptor fields_XrSceneCaptureInfoBD[] = {
+    FIELD_VALUE(XrSceneCaptureInfoBD, type),
+    FIELD_XR(XrSceneCaptureInfoBD, next),
+};
+
+void serialize(const XrSceneCaptureInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneCaptureInfoBD, ctx);
+}
+
+void deserialize(XrSceneCaptureInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneCaptureInfoBD, ctx);
+}
+
+void cleanup(const XrSceneCaptureInfoBD* s) {
+    cleanup_fields(s, fields_XrSceneCaptureInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSceneCaptureInfoBD[] = {
+    FIELD_VALUE(XrSceneCaptureInfoBD, type),
+    FIELD_XR(XrSceneCaptureInfoBD, next),
+};
+
+void serialize(const XrSceneCaptureInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneCaptureInfoBD, ctx);
+}
+
+void deserialize(XrSceneCaptureInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneCaptureInfoBD, ctx);
+}
+
+void cleanup(const XrSceneCaptureInfoBD* s) {
+    cleanup_fields(s, fields_XrSceneCaptureInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialScenePropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialScenePropertiesBD, type),
+    FIELD_XR(XrSystemSpatialScenePropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialScenePropertiesBD, supportsSpatialScene),
+};
+
+void serialize(const XrSystemSpatialScenePropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialScenePropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialScenePropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialScenePropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialScenePropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialScenePropertiesBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialScenePropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialScenePropertiesBD, type),
+    FIELD_XR(XrSystemSpatialScenePropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialScenePropertiesBD, supportsSpatialScene),
+};
+
+void serialize(const XrSystemSpatialScenePropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialScenePropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialScenePropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialScenePropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialScenePropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialScenePropertiesBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_scene
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_sensing
+constexpr FieldDescriptor fields_XrAnchorSpaceCreateInfoBD[] = {
+    FIELD_VALUE(XrAnchorSpaceCreateInfoBD, type),
+    FIELD_XR(XrAnchorSpaceCreateInfoBD, next),
+    FIELD_VALUE(XrAnchorSpaceCreateInfoBD, anchor),
+    FIELD_VALUE(XrAnchorSpaceCreateInfoBD, poseInAnchorSpace),
+};
+
+void serialize(const XrAnchorSpaceCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrAnchorSpaceCreateInfoBD, ctx);
+}
+
+void deserialize(XrAnchorSpaceCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrAnchorSpaceCreateInfoBD, ctx);
+}
+
+void cleanup(const XrAnchorSpaceCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrAnchorSpaceCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrAnchorSpaceCreateInfoBD[] = {
+    FIELD_VALUE(XrAnchorSpaceCreateInfoBD, type),
+    FIELD_XR(XrAnchorSpaceCreateInfoBD, next),
+    FIELD_VALUE(XrAnchorSpaceCreateInfoBD, anchor),
+    FIELD_VALUE(XrAnchorSpaceCreateInfoBD, poseInAnchorSpace),
+};
+
+void serialize(const XrAnchorSpaceCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrAnchorSpaceCreateInfoBD, ctx);
+}
+
+void deserialize(XrAnchorSpaceCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrAnchorSpaceCreateInfoBD, ctx);
+}
+
+void cleanup(const XrAnchorSpaceCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrAnchorSpaceCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSenseDataProviderStateChangedBD[] = {
+    FIELD_VALUE(XrEventDataSenseDataProviderStateChangedBD, type),
+    FIELD_XR(XrEventDataSenseDataProviderStateChangedBD, next),
+    FIELD_VALUE(XrEventDataSenseDataProviderStateChangedBD, provider),
+    FIELD_VALUE(XrEventDataSenseDataProviderStateChangedBD, newState),
+};
+
+void serialize(const XrEventDataSenseDataProviderStateChangedBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSenseDataProviderStateChangedBD, ctx);
+}
+
+void deserialize(XrEventDataSenseDataProviderStateChangedBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSenseDataProviderStateChangedBD, ctx);
+}
+
+void cleanup(const XrEventDataSenseDataProviderStateChangedBD* s) {
+    cleanup_fields(s, fields_XrEventDataSenseDataProviderStateChangedBD);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSenseDataProviderStateChangedBD[] = {
+    FIELD_VALUE(XrEventDataSenseDataProviderStateChangedBD, type),
+    FIELD_XR(XrEventDataSenseDataProviderStateChangedBD, next),
+    FIELD_VALUE(XrEventDataSenseDataProviderStateChangedBD, provider),
+    FIELD_VALUE(XrEventDataSenseDataProviderStateChangedBD, newState),
+};
+
+void serialize(const XrEventDataSenseDataProviderStateChangedBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSenseDataProviderStateChangedBD, ctx);
+}
+
+void deserialize(XrEventDataSenseDataProviderStateChangedBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSenseDataProviderStateChangedBD, ctx);
+}
+
+void cleanup(const XrEventDataSenseDataProviderStateChangedBD* s) {
+    cleanup_fields(s, fields_XrEventDataSenseDataProviderStateChangedBD);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSenseDataUpdatedBD[] = {
+    FIELD_VALUE(XrEventDataSenseDataUpdatedBD, type),
+    FIELD_XR(XrEventDataSenseDataUpdatedBD, next),
+    FIELD_VALUE(XrEventDataSenseDataUpdatedBD, provider),
+};
+
+void serialize(const XrEventDataSenseDataUpdatedBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSenseDataUpdatedBD, ctx);
+}
+
+void deserialize(XrEventDataSenseDataUpdatedBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSenseDataUpdatedBD, ctx);
+}
+
+void cleanup(const XrEventDataSenseDataUpdatedBD* s) {
+    cleanup_fields(s, fields_XrEventDataSenseDataUpdatedBD);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSenseDataUpdatedBD[] = {
+    FIELD_VALUE(XrEventDataSenseDataUpdatedBD, type),
+    FIELD_XR(XrEventDataSenseDataUpdatedBD, next),
+    FIELD_VALUE(XrEventDataSenseDataUpdatedBD, provider),
+};
+
+void serialize(const XrEventDataSenseDataUpdatedBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSenseDataUpdatedBD, ctx);
+}
+
+void deserialize(XrEventDataSenseDataUpdatedBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSenseDataUpdatedBD, ctx);
+}
+
+void cleanup(const XrEventDataSenseDataUpdatedBD* s) {
+    cleanup_fields(s, fields_XrEventDataSenseDataUpdatedBD);
+}
+
+constexpr FieldDescriptor fields_XrQueriedSenseDataBD[] = {
+    FIELD_VALUE(XrQueriedSenseDataBD, type),
+    FIELD_XR(XrQueriedSenseDataBD, next),
+    FIELD_VALUE(XrQueriedSenseDataBD, stateCapacityInput),
+    FIELD_VALUE(XrQueriedSenseDataBD, stateCountOutput),
+    FIELD_PTR(XrQueriedSenseDataBD, states, stateCapacityInput),
+};
+
+void serialize(const XrQueriedSenseDataBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrQueriedSenseDataBD, ctx);
+}
+
+void deserialize(XrQueriedSenseDataBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrQueriedSenseDataBD, ctx);
+}
+
+void cleanup(const XrQueriedSenseDataBD* s) {
+    cleanup_fields(s, fields_XrQueriedSenseDataBD);
+}
+
+constexpr FieldDescriptor fields_XrQueriedSenseDataBD[] = {
+    FIELD_VALUE(XrQueriedSenseDataBD, type),
+    FIELD_XR(XrQueriedSenseDataBD, next),
+    FIELD_VALUE(XrQueriedSenseDataBD, stateCapacityInput),
+    FIELD_VALUE(XrQueriedSenseDataBD, stateCountOutput),
+    FIELD_PTR(XrQueriedSenseDataBD, states, stateCapacityInput),
+};
+
+void serialize(const XrQueriedSenseDataBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrQueriedSenseDataBD, ctx);
+}
+
+void deserialize(XrQueriedSenseDataBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrQueriedSenseDataBD, ctx);
+}
+
+void cleanup(const XrQueriedSenseDataBD* s) {
+    cleanup_fields(s, fields_XrQueriedSenseDataBD);
+}
+
+constexpr FieldDescriptor fields_XrQueriedSenseDataGetInfoBD[] = {
+    FIELD_VALUE(XrQueriedSenseDataGetInfoBD, type),
+    FIELD_XR(XrQueriedSenseDataGetInfoBD, next),
+};
+
+void serialize(const XrQueriedSenseDataGetInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrQueriedSenseDataGetInfoBD, ctx);
+}
+
+void deserialize(XrQueriedSenseDataGetInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrQueriedSenseDataGetInfoBD, ctx);
+}
+
+void cleanup(const XrQueriedSenseDataGetInfoBD* s) {
+    cleanup_fields(s, fields_XrQueriedSenseDataGetInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrQueriedSenseDataGetInfoBD[] = {
+    FIELD_VALUE(XrQueriedSenseDataGetInfoBD, type),
+    FIELD_XR(XrQueriedSenseDataGetInfoBD, next),
+};
+
+void serialize(const XrQueriedSenseDataGetInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrQueriedSenseDataGetInfoBD, ctx);
+}
+
+void deserialize(XrQueriedSenseDataGetInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrQueriedSenseDataGetInfoBD, ctx);
+}
+
+void cleanup(const XrQueriedSenseDataGetInfoBD* s) {
+    cleanup_fields(s, fields_XrQueriedSenseDataGetInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataFilterSemanticBD[] = {
+    FIELD_VALUE(XrSenseDataFilterSemanticBD, type),
+    FIELD_XR(XrSenseDataFilterSemanticBD, next),
+    FIELD_VALUE(XrSenseDataFilterSemanticBD, labelCount),
+    FIELD_PTR(XrSenseDataFilterSemanticBD, labels, labelCount),
+};
+
+void serialize(const XrSenseDataFilterSemanticBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataFilterSemanticBD, ctx);
+}
+
+void deserialize(XrSenseDataFilterSemanticBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataFilterSemanticBD, ctx);
+}
+
+void cleanup(const XrSenseDataFilterSemanticBD* s) {
+    cleanup_fields(s, fields_XrSenseDataFilterSemanticBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataFilterSemanticBD[] = {
+    FIELD_VALUE(XrSenseDataFilterSemanticBD, type),
+    FIELD_XR(XrSenseDataFilterSemanticBD, next),
+    FIELD_VALUE(XrSenseDataFilterSemanticBD, labelCount),
+    FIELD_PTR(XrSenseDataFilterSemanticBD, labels, labelCount),
+};
+
+void serialize(const XrSenseDataFilterSemanticBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataFilterSemanticBD, ctx);
+}
+
+void deserialize(XrSenseDataFilterSemanticBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataFilterSemanticBD, ctx);
+}
+
+void cleanup(const XrSenseDataFilterSemanticBD* s) {
+    cleanup_fields(s, fields_XrSenseDataFilterSemanticBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataFilterUuidBD[] = {
+    FIELD_VALUE(XrSenseDataFilterUuidBD, type),
+    FIELD_XR(XrSenseDataFilterUuidBD, next),
+    FIELD_VALUE(XrSenseDataFilterUuidBD, uuidCount),
+    FIELD_PTR(XrSenseDataFilterUuidBD, uuids, uuidCount),
+};
+
+void serialize(const XrSenseDataFilterUuidBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataFilterUuidBD, ctx);
+}
+
+void deserialize(XrSenseDataFilterUuidBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataFilterUuidBD, ctx);
+}
+
+void cleanup(const XrSenseDataFilterUuidBD* s) {
+    cleanup_fields(s, fields_XrSenseDataFilterUuidBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataFilterUuidBD[] = {
+    FIELD_VALUE(XrSenseDataFilterUuidBD, type),
+    FIELD_XR(XrSenseDataFilterUuidBD, next),
+    FIELD_VALUE(XrSenseDataFilterUuidBD, uuidCount),
+    FIELD_PTR(XrSenseDataFilterUuidBD, uuids, uuidCount),
+};
+
+void serialize(const XrSenseDataFilterUuidBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataFilterUuidBD, ctx);
+}
+
+void deserialize(XrSenseDataFilterUuidBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataFilterUuidBD, ctx);
+}
+
+void cleanup(const XrSenseDataFilterUuidBD* s) {
+    cleanup_fields(s, fields_XrSenseDataFilterUuidBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataProviderCreateInfoBD[] = {
+    FIELD_VALUE(XrSenseDataProviderCreateInfoBD, type),
+    FIELD_XR(XrSenseDataProviderCreateInfoBD, next),
+    FIELD_VALUE(XrSenseDataProviderCreateInfoBD, providerType),
+};
+
+void serialize(const XrSenseDataProviderCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataProviderCreateInfoBD, ctx);
+}
+
+void deserialize(XrSenseDataProviderCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataProviderCreateInfoBD, ctx);
+}
+
+void cleanup(const XrSenseDataProviderCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrSenseDataProviderCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataProviderCreateInfoBD[] = {
+    FIELD_VALUE(XrSenseDataProviderCreateInfoBD, type),
+    FIELD_XR(XrSenseDataProviderCreateInfoBD, next),
+    FIELD_VALUE(XrSenseDataProviderCreateInfoBD, providerType),
+};
+
+void serialize(const XrSenseDataProviderCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataProviderCreateInfoBD, ctx);
+}
+
+void deserialize(XrSenseDataProviderCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataProviderCreateInfoBD, ctx);
+}
+
+void cleanup(const XrSenseDataProviderCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrSenseDataProviderCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataProviderStartInfoBD[] = {
+    FIELD_VALUE(XrSenseDataProviderStartInfoBD, type),
+    FIELD_XR(XrSenseDataProviderStartInfoBD, next),
+};
+
+void serialize(const XrSenseDataProviderStartInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataProviderStartInfoBD, ctx);
+}
+
+void deserialize(XrSenseDataProviderStartInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataProviderStartInfoBD, ctx);
+}
+
+void cleanup(const XrSenseDataProviderStartInfoBD* s) {
+    cleanup_fields(s, fields_XrSenseDataProviderStartInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataProviderStartInfoBD[] = {
+    FIELD_VALUE(XrSenseDataProviderStartInfoBD, type),
+    FIELD_XR(XrSenseDataProviderStartInfoBD, next),
+};
+
+void serialize(const XrSenseDataProviderStartInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataProviderStartInfoBD, ctx);
+}
+
+void deserialize(XrSenseDataProviderStartInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataProviderStartInfoBD, ctx);
+}
+
+void cleanup(const XrSenseDataProviderStartInfoBD* s) {
+    cleanup_fields(s, fields_XrSenseDataProviderStartInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataQueryCompletionBD[] = {
+    FIELD_VALUE(XrSenseDataQueryCompletionBD, type),
+    FIELD_XR(XrSenseDataQueryCompletionBD, next),
+    FIELD_VALUE(XrSenseDataQueryCompletionBD, futureResult),
+    FIELD_VALUE(XrSenseDataQueryCompletionBD, snapshot),
+};
+
+void serialize(const XrSenseDataQueryCompletionBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataQueryCompletionBD, ctx);
+}
+
+void deserialize(XrSenseDataQueryCompletionBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataQueryCompletionBD, ctx);
+}
+
+void cleanup(const XrSenseDataQueryCompletionBD* s) {
+    cleanup_fields(s, fields_XrSenseDataQueryCompletionBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataQueryCompletionBD[] = {
+    FIELD_VALUE(XrSenseDataQueryCompletionBD, type),
+    FIELD_XR(XrSenseDataQueryCompletionBD, next),
+    FIELD_VALUE(XrSenseDataQueryCompletionBD, futureResult),
+    FIELD_VALUE(XrSenseDataQueryCompletionBD, snapshot),
+};
+
+void serialize(const XrSenseDataQueryCompletionBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataQueryCompletionBD, ctx);
+}
+
+void deserialize(XrSenseDataQueryCompletionBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataQueryCompletionBD, ctx);
+}
+
+void cleanup(const XrSenseDataQueryCompletionBD* s) {
+    cleanup_fields(s, fields_XrSenseDataQueryCompletionBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataQueryInfoBD[] = {
+    FIELD_VALUE(XrSenseDataQueryInfoBD, type),
+    FIELD_XR(XrSenseDataQueryInfoBD, next),
+};
+
+void serialize(const XrSenseDataQueryInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataQueryInfoBD, ctx);
+}
+
+void deserialize(XrSenseDataQueryInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataQueryInfoBD, ctx);
+}
+
+void cleanup(const XrSenseDataQueryInfoBD* s) {
+    cleanup_fields(s, fields_XrSenseDataQueryInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSenseDataQueryInfoBD[] = {
+    FIELD_VALUE(XrSenseDataQueryInfoBD, type),
+    FIELD_XR(XrSenseDataQueryInfoBD, next),
+};
+
+void serialize(const XrSenseDataQueryInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSenseDataQueryInfoBD, ctx);
+}
+
+void deserialize(XrSenseDataQueryInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSenseDataQueryInfoBD, ctx);
+}
+
+void cleanup(const XrSenseDataQueryInfoBD* s) {
+    cleanup_fields(s, fields_XrSenseDataQueryInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityAnchorCreateInfoBD[] = {
+    FIELD_VALUE(XrSpatialEntityAnchorCreateInfoBD, type),
+    FIELD_XR(XrSpatialEntityAnchorCreateInfoBD, next),
+    FIELD_VALUE(XrSpatialEntityAnchorCreateInfoBD, snapshot),
+    FIELD_VALUE(XrSpatialEntityAnchorCreateInfoBD, entityId),
+};
+
+void serialize(const XrSpatialEntityAnchorCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityAnchorCreateInfoBD, ctx);
+}
+
+void deserialize(XrSpatialEntityAnchorCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityAnchorCreateInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityAnchorCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityAnchorCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityAnchorCreateInfoBD[] = {
+    FIELD_VALUE(XrSpatialEntityAnchorCreateInfoBD, type),
+    FIELD_XR(XrSpatialEntityAnchorCreateInfoBD, next),
+    FIELD_VALUE(XrSpatialEntityAnchorCreateInfoBD, snapshot),
+    FIELD_VALUE(XrSpatialEntityAnchorCreateInfoBD, entityId),
+};
+
+void serialize(const XrSpatialEntityAnchorCreateInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityAnchorCreateInfoBD, ctx);
+}
+
+void deserialize(XrSpatialEntityAnchorCreateInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityAnchorCreateInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityAnchorCreateInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityAnchorCreateInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataBaseHeaderBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataBaseHeaderBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataBaseHeaderBD, next),
+};
+
+void serialize(const XrSpatialEntityComponentDataBaseHeaderBD* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataBaseHeaderBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataBaseHeaderBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataBaseHeaderBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataBaseHeaderBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataBoundingBox2DBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox2DBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataBoundingBox2DBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox2DBD, boundingBox2D),
+};
+
+void serialize(const XrSpatialEntityComponentDataBoundingBox2DBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox2DBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataBoundingBox2DBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox2DBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataBoundingBox2DBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataBoundingBox2DBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataBoundingBox2DBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox2DBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataBoundingBox2DBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox2DBD, boundingBox2D),
+};
+
+void serialize(const XrSpatialEntityComponentDataBoundingBox2DBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox2DBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataBoundingBox2DBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox2DBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataBoundingBox2DBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataBoundingBox2DBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataBoundingBox3DBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox3DBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataBoundingBox3DBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox3DBD, boundingBox3D),
+};
+
+void serialize(const XrSpatialEntityComponentDataBoundingBox3DBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox3DBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataBoundingBox3DBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox3DBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataBoundingBox3DBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataBoundingBox3DBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataBoundingBox3DBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox3DBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataBoundingBox3DBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataBoundingBox3DBD, boundingBox3D),
+};
+
+void serialize(const XrSpatialEntityComponentDataBoundingBox3DBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox3DBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataBoundingBox3DBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataBoundingBox3DBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataBoundingBox3DBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataBoundingBox3DBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataLocationBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataLocationBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataLocationBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataLocationBD, location),
+};
+
+void serialize(const XrSpatialEntityComponentDataLocationBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataLocationBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataLocationBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataLocationBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataLocationBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataLocationBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataLocationBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataLocationBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataLocationBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataLocationBD, location),
+};
+
+void serialize(const XrSpatialEntityComponentDataLocationBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataLocationBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataLocationBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataLocationBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataLocationBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataLocationBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataPolygonBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataPolygonBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataPolygonBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataPolygonBD, vertexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataPolygonBD, vertexCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataPolygonBD, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrSpatialEntityComponentDataPolygonBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataPolygonBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataPolygonBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataPolygonBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataPolygonBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataPolygonBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataPolygonBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataPolygonBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataPolygonBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataPolygonBD, vertexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataPolygonBD, vertexCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataPolygonBD, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrSpatialEntityComponentDataPolygonBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataPolygonBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataPolygonBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataPolygonBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataPolygonBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataPolygonBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataSemanticBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataSemanticBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataSemanticBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataSemanticBD, labelCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataSemanticBD, labelCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataSemanticBD, labels, labelCapacityInput),
+};
+
+void serialize(const XrSpatialEntityComponentDataSemanticBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataSemanticBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataSemanticBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataSemanticBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataSemanticBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataSemanticBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataSemanticBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataSemanticBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataSemanticBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataSemanticBD, labelCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataSemanticBD, labelCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataSemanticBD, labels, labelCapacityInput),
+};
+
+void serialize(const XrSpatialEntityComponentDataSemanticBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataSemanticBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataSemanticBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataSemanticBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataSemanticBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataSemanticBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataTriangleMeshBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataTriangleMeshBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, vertexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, vertexCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataTriangleMeshBD, vertices, vertexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, indexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, indexCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataTriangleMeshBD, indices, indexCapacityInput),
+};
+
+void serialize(const XrSpatialEntityComponentDataTriangleMeshBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataTriangleMeshBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataTriangleMeshBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataTriangleMeshBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataTriangleMeshBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataTriangleMeshBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentDataTriangleMeshBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, type),
+    FIELD_XR(XrSpatialEntityComponentDataTriangleMeshBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, vertexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, vertexCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataTriangleMeshBD, vertices, vertexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, indexCapacityInput),
+    FIELD_VALUE(XrSpatialEntityComponentDataTriangleMeshBD, indexCountOutput),
+    FIELD_PTR(XrSpatialEntityComponentDataTriangleMeshBD, indices, indexCapacityInput),
+};
+
+void serialize(const XrSpatialEntityComponentDataTriangleMeshBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentDataTriangleMeshBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentDataTriangleMeshBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentDataTriangleMeshBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentDataTriangleMeshBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentDataTriangleMeshBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentGetInfoBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentGetInfoBD, type),
+    FIELD_XR(XrSpatialEntityComponentGetInfoBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentGetInfoBD, entityId),
+    FIELD_VALUE(XrSpatialEntityComponentGetInfoBD, componentType),
+};
+
+void serialize(const XrSpatialEntityComponentGetInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentGetInfoBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentGetInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentGetInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentGetInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentGetInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityComponentGetInfoBD[] = {
+    FIELD_VALUE(XrSpatialEntityComponentGetInfoBD, type),
+    FIELD_XR(XrSpatialEntityComponentGetInfoBD, next),
+    FIELD_VALUE(XrSpatialEntityComponentGetInfoBD, entityId),
+    FIELD_VALUE(XrSpatialEntityComponentGetInfoBD, componentType),
+};
+
+void serialize(const XrSpatialEntityComponentGetInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityComponentGetInfoBD, ctx);
+}
+
+void deserialize(XrSpatialEntityComponentGetInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityComponentGetInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityComponentGetInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityComponentGetInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityLocationGetInfoBD[] = {
+    FIELD_VALUE(XrSpatialEntityLocationGetInfoBD, type),
+    FIELD_XR(XrSpatialEntityLocationGetInfoBD, next),
+    FIELD_VALUE(XrSpatialEntityLocationGetInfoBD, baseSpace),
+};
+
+void serialize(const XrSpatialEntityLocationGetInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityLocationGetInfoBD, ctx);
+}
+
+void deserialize(XrSpatialEntityLocationGetInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityLocationGetInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityLocationGetInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityLocationGetInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityLocationGetInfoBD[] = {
+    FIELD_VALUE(XrSpatialEntityLocationGetInfoBD, type),
+    FIELD_XR(XrSpatialEntityLocationGetInfoBD, next),
+    FIELD_VALUE(XrSpatialEntityLocationGetInfoBD, baseSpace),
+};
+
+void serialize(const XrSpatialEntityLocationGetInfoBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityLocationGetInfoBD, ctx);
+}
+
+void deserialize(XrSpatialEntityLocationGetInfoBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityLocationGetInfoBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityLocationGetInfoBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityLocationGetInfoBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityStateBD[] = {
+    FIELD_VALUE(XrSpatialEntityStateBD, type),
+    FIELD_XR(XrSpatialEntityStateBD, next),
+    FIELD_VALUE(XrSpatialEntityStateBD, entityId),
+    FIELD_TIME(XrSpatialEntityStateBD, lastUpdateTime),
+    FIELD_VALUE(XrSpatialEntityStateBD, uuid),
+};
+
+void serialize(const XrSpatialEntityStateBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityStateBD, ctx);
+}
+
+void deserialize(XrSpatialEntityStateBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityStateBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityStateBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityStateBD);
+}
+
+constexpr FieldDescriptor fields_XrSpatialEntityStateBD[] = {
+    FIELD_VALUE(XrSpatialEntityStateBD, type),
+    FIELD_XR(XrSpatialEntityStateBD, next),
+    FIELD_VALUE(XrSpatialEntityStateBD, entityId),
+    FIELD_TIME(XrSpatialEntityStateBD, lastUpdateTime),
+    FIELD_VALUE(XrSpatialEntityStateBD, uuid),
+};
+
+void serialize(const XrSpatialEntityStateBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialEntityStateBD, ctx);
+}
+
+void deserialize(XrSpatialEntityStateBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialEntityStateBD, ctx);
+}
+
+void cleanup(const XrSpatialEntityStateBD* s) {
+    cleanup_fields(s, fields_XrSpatialEntityStateBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialSensingPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialSensingPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialSensingPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialSensingPropertiesBD, supportsSpatialSensing),
+};
+
+void serialize(const XrSystemSpatialSensingPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialSensingPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialSensingPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialSensingPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialSensingPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialSensingPropertiesBD);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialSensingPropertiesBD[] = {
+    FIELD_VALUE(XrSystemSpatialSensingPropertiesBD, type),
+    FIELD_XR(XrSystemSpatialSensingPropertiesBD, next),
+    FIELD_VALUE(XrSystemSpatialSensingPropertiesBD, supportsSpatialSensing),
+};
+
+void serialize(const XrSystemSpatialSensingPropertiesBD* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialSensingPropertiesBD, ctx);
+}
+
+void deserialize(XrSystemSpatialSensingPropertiesBD* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialSensingPropertiesBD, ctx);
+}
+
+void cleanup(const XrSystemSpatialSensingPropertiesBD* s) {
+    cleanup_fields(s, fields_XrSystemSpatialSensingPropertiesBD);
+}
+
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_sensing
+#ifdef XRTRANSPORT_EXT_XR_EPIC_view_configuration_fov
+constexpr FieldDescriptor fields_XrViewConfigurationViewFovEPIC[] = {
+    FIELD_VALUE(XrViewConfigurationViewFovEPIC, type),
+    FIELD_XR(XrViewConfigurationViewFovEPIC, next),
+    FIELD_VALUE(XrViewConfigurationViewFovEPIC, recommendedFov),
+    FIELD_VALUE(XrViewConfigurationViewFovEPIC, maxMutableFov),
+};
+
+void serialize(const XrViewConfigurationViewFovEPIC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewConfigurationViewFovEPIC, ctx);
+}
+
+void deserialize(XrViewConfigurationViewFovEPIC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewConfigurationViewFovEPIC, ctx);
+}
+
+void cleanup(const XrViewConfigurationViewFovEPIC* s) {
+    cleanup_fields(s, fields_XrViewConfigurationViewFovEPIC);
+}
+
+constexpr FieldDescriptor fields_XrViewConfigurationViewFovEPIC[] = {
+    FIELD_VALUE(XrViewConfigurationViewFovEPIC, type),
+    FIELD_XR(XrViewConfigurationViewFovEPIC, next),
+    FIELD_VALUE(XrViewConfigurationViewFovEPIC, recommendedFov),
+    FIELD_VALUE(XrViewConfigurationViewFovEPIC, maxMutableFov),
+};
+
+void serialize(const XrViewConfigurationViewFovEPIC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewConfigurationViewFovEPIC, ctx);
+}
+
+void deserialize(XrViewConfigurationViewFovEPIC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewConfigurationViewFovEPIC, ctx);
+}
+
+void cleanup(const XrViewConfigurationViewFovEPIC* s) {
+    cleanup_fields(s, fields_XrViewConfigurationViewFovEPIC);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EPIC_view_configuration_fov
+#ifdef XRTRANSPORT_EXT_XR_EXTX_overlay
+constexpr FieldDescriptor fields_XrEventDataMainSessionVisibilityChangedEXTX[] = {
+    FIELD_VALUE(XrEventDataMainSessionVisibilityChangedEXTX, type),
+    FIELD_XR(XrEventDataMainSessionVisibilityChangedEXTX, next),
+    FIELD_VALUE(XrEventDataMainSessionVisibilityChangedEXTX, visible),
+    FIELD_VALUE(XrEventDataMainSessionVisibilityChangedEXTX, flags),
+};
+
+void serialize(const XrEventDataMainSessionVisibilityChangedEXTX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataMainSessionVisibilityChangedEXTX, ctx);
+}
+
+void deserialize(XrEventDataMainSessionVisibilityChangedEXTX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataMainSessionVisibilityChangedEXTX, ctx);
+}
+
+void cleanup(const XrEventDataMainSessionVisibilityChangedEXTX* s) {
+    cleanup_fields(s, fields_XrEventDataMainSessionVisibilityChangedEXTX);
+}
+
+constexpr FieldDescriptor fields_XrEventDataMainSessionVisibilityChangedEXTX[] = {
+    FIELD_VALUE(XrEventDataMainSessionVisibilityChangedEXTX, type),
+    FIELD_XR(XrEventDataMainSessionVisibilityChangedEXTX, next),
+    FIELD_VALUE(XrEventDataMainSessionVisibilityChangedEXTX, visible),
+    FIELD_VALUE(XrEventDataMainSessionVisibilityChangedEXTX, flags),
+};
+
+void serialize(const XrEventDataMainSessionVisibilityChangedEXTX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataMainSessionVisibilityChangedEXTX, ctx);
+}
+
+void deserialize(XrEventDataMainSessionVisibilityChangedEXTX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataMainSessionVisibilityChangedEXTX, ctx);
+}
+
+void cleanup(const XrEventDataMainSessionVisibilityChangedEXTX* s) {
+    cleanup_fields(s, fields_XrEventDataMainSessionVisibilityChangedEXTX);
+}
+
+constexpr FieldDescriptor fields_XrSessionCreateInfoOverlayEXTX[] = {
+    FIELD_VALUE(XrSessionCreateInfoOverlayEXTX, type),
+    FIELD_XR(XrSessionCreateInfoOverlayEXTX, next),
+    FIELD_VALUE(XrSessionCreateInfoOverlayEXTX, createFlags),
+    FIELD_VALUE(XrSessionCreateInfoOverlayEXTX, sessionLayersPlacement),
+};
+
+void serialize(const XrSessionCreateInfoOverlayEXTX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSessionCreateInfoOverlayEXTX, ctx);
+}
+
+void deserialize(XrSessionCreateInfoOverlayEXTX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSessionCreateInfoOverlayEXTX, ctx);
+}
+
+void cleanup(const XrSessionCreateInfoOverlayEXTX* s) {
+    cleanup_fields(s, fields_XrSessionCreateInfoOverlayEXTX);
+}
+
+constexpr FieldDescriptor fields_XrSessionCreateInfoOverlayEXTX[] = {
+    FIELD_VALUE(XrSessionCreateInfoOverlayEXTX, type),
+    FIELD_XR(XrSessionCreateInfoOverlayEXTX, next),
+    FIELD_VALUE(XrSessionCreateInfoOverlayEXTX, createFlags),
+    FIELD_VALUE(XrSessionCreateInfoOverlayEXTX, sessionLayersPlacement),
+};
+
+void serialize(const XrSessionCreateInfoOverlayEXTX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSessionCreateInfoOverlayEXTX, ctx);
+}
+
+void deserialize(XrSessionCreateInfoOverlayEXTX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSessionCreateInfoOverlayEXTX, ctx);
+}
+
+void cleanup(const XrSessionCreateInfoOverlayEXTX* s) {
+    cleanup_fields(s, fields_XrSessionCreateInfoOverlayEXTX);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXTX_overlay
+#ifdef XRTRANSPORT_EXT_XR_EXT_active_action_set_priority
+constexpr FieldDescriptor fields_XrActiveActionSetPrioritiesEXT[] = {
+    FIELD_VALUE(XrActiveActionSetPrioritiesEXT, type),
+    FIELD_XR(XrActiveActionSetPrioritiesEXT, next),
+    FIELD_VALUE(XrActiveActionSetPrioritiesEXT, actionSetPriorityCount),
+    FIELD_PTR(XrActiveActionSetPrioritiesEXT, actionSetPriorities, actionSetPriorityCount),
+};
+
+void serialize(const XrActiveActionSetPrioritiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActiveActionSetPrioritiesEXT, ctx);
+}
+
+void deserialize(XrActiveActionSetPrioritiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActiveActionSetPrioritiesEXT, ctx);
+}
+
+void cleanup(const XrActiveActionSetPrioritiesEXT* s) {
+    cleanup_fields(s, fields_XrActiveActionSetPrioritiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrActiveActionSetPrioritiesEXT[] = {
+    FIELD_VALUE(XrActiveActionSetPrioritiesEXT, type),
+    FIELD_XR(XrActiveActionSetPrioritiesEXT, next),
+    FIELD_VALUE(XrActiveActionSetPrioritiesEXT, actionSetPriorityCount),
+    FIELD_PTR(XrActiveActionSetPrioritiesEXT, actionSetPriorities, actionSetPriorityCount),
+};
+
+void serialize(const XrActiveActionSetPrioritiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActiveActionSetPrioritiesEXT, ctx);
+}
+
+void deserialize(XrActiveActionSetPrioritiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActiveActionSetPrioritiesEXT, ctx);
+}
+
+void cleanup(const XrActiveActionSetPrioritiesEXT* s) {
+    cleanup_fields(s, fields_XrActiveActionSetPrioritiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrActiveActionSetPriorityEXT[] = {
+    FIELD_VALUE(XrActiveActionSetPriorityEXT, actionSet),
+    FIELD_VALUE(XrActiveActionSetPriorityEXT, priorityOverride),
+};
+
+void serialize(const XrActiveActionSetPriorityEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActiveActionSetPriorityEXT, ctx);
+}
+
+void deserialize(XrActiveActionSetPriorityEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActiveActionSetPriorityEXT, ctx);
+}
+
+void cleanup(const XrActiveActionSetPriorityEXT* s) {
+    cleanup_fields(s, fields_XrActiveActionSetPriorityEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_active_action_set_priority
+#ifdef XRTRANSPORT_EXT_XR_EXT_debug_utils
+constexpr FieldDescriptor fields_XrDebugUtilsLabelEXT[] = {
+    FIELD_VALUE(XrDebugUtilsLabelEXT, type),
+    FIELD_XR(XrDebugUtilsLabelEXT, next),
+    FIELD_STRING(XrDebugUtilsLabelEXT, labelName),
+};
+
+void serialize(const XrDebugUtilsLabelEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsLabelEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsLabelEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsLabelEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsLabelEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsLabelEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsLabelEXT[] = {
+    FIELD_VALUE(XrDebugUtilsLabelEXT, type),
+    FIELD_XR(XrDebugUtilsLabelEXT, next),
+    FIELD_STRING(XrDebugUtilsLabelEXT, labelName),
+};
+
+void serialize(const XrDebugUtilsLabelEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsLabelEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsLabelEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsLabelEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsLabelEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsLabelEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsMessengerCallbackDataEXT[] = {
+    FIELD_VALUE(XrDebugUtilsMessengerCallbackDataEXT, type),
+    FIELD_XR(XrDebugUtilsMessengerCallbackDataEXT, next),
+    FIELD_STRING(XrDebugUtilsMessengerCallbackDataEXT, messageId),
+    FIELD_STRING(XrDebugUtilsMessengerCallbackDataEXT, functionName),
+    FIELD_STRING(XrDebugUtilsMessengerCallbackDataEXT, message),
+    FIELD_VALUE(XrDebugUtilsMessengerCallbackDataEXT, objectCount),
+    FIELD_PTR(XrDebugUtilsMessengerCallbackDataEXT, objects, objectCount),
+    FIELD_VALUE(XrDebugUtilsMessengerCallbackDataEXT, sessionLabelCount),
+    FIELD_PTR(XrDebugUtilsMessengerCallbackDataEXT, sessionLabels, sessionLabelCount),
+};
+
+void serialize(const XrDebugUtilsMessengerCallbackDataEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsMessengerCallbackDataEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsMessengerCallbackDataEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsMessengerCallbackDataEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsMessengerCallbackDataEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsMessengerCallbackDataEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsMessengerCallbackDataEXT[] = {
+    FIELD_VALUE(XrDebugUtilsMessengerCallbackDataEXT, type),
+    FIELD_XR(XrDebugUtilsMessengerCallbackDataEXT, next),
+    FIELD_STRING(XrDebugUtilsMessengerCallbackDataEXT, messageId),
+    FIELD_STRING(XrDebugUtilsMessengerCallbackDataEXT, functionName),
+    FIELD_STRING(XrDebugUtilsMessengerCallbackDataEXT, message),
+    FIELD_VALUE(XrDebugUtilsMessengerCallbackDataEXT, objectCount),
+    FIELD_PTR(XrDebugUtilsMessengerCallbackDataEXT, objects, objectCount),
+    FIELD_VALUE(XrDebugUtilsMessengerCallbackDataEXT, sessionLabelCount),
+    FIELD_PTR(XrDebugUtilsMessengerCallbackDataEXT, sessionLabels, sessionLabelCount),
+};
+
+void serialize(const XrDebugUtilsMessengerCallbackDataEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsMessengerCallbackDataEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsMessengerCallbackDataEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsMessengerCallbackDataEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsMessengerCallbackDataEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsMessengerCallbackDataEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsMessengerCreateInfoEXT[] = {
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, type),
+    FIELD_XR(XrDebugUtilsMessengerCreateInfoEXT, next),
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, messageSeverities),
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, messageTypes),
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, userCallback),
+    FIELD_SINGLE_PTR(XrDebugUtilsMessengerCreateInfoEXT, userData),
+};
+
+void serialize(const XrDebugUtilsMessengerCreateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsMessengerCreateInfoEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsMessengerCreateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsMessengerCreateInfoEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsMessengerCreateInfoEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsMessengerCreateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsMessengerCreateInfoEXT[] = {
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, type),
+    FIELD_XR(XrDebugUtilsMessengerCreateInfoEXT, next),
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, messageSeverities),
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, messageTypes),
+    FIELD_VALUE(XrDebugUtilsMessengerCreateInfoEXT, userCallback),
+    FIELD_SINGLE_PTR(XrDebugUtilsMessengerCreateInfoEXT, userData),
+};
+
+void serialize(const XrDebugUtilsMessengerCreateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsMessengerCreateInfoEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsMessengerCreateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsMessengerCreateInfoEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsMessengerCreateInfoEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsMessengerCreateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsObjectNameInfoEXT[] = {
+    FIELD_VALUE(XrDebugUtilsObjectNameInfoEXT, type),
+    FIELD_XR(XrDebugUtilsObjectNameInfoEXT, next),
+    FIELD_VALUE(XrDebugUtilsObjectNameInfoEXT, objectType),
+    FIELD_VALUE(XrDebugUtilsObjectNameInfoEXT, objectHandle),
+    FIELD_STRING(XrDebugUtilsObjectNameInfoEXT, objectName),
+};
+
+void serialize(const XrDebugUtilsObjectNameInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsObjectNameInfoEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsObjectNameInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsObjectNameInfoEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsObjectNameInfoEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsObjectNameInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrDebugUtilsObjectNameInfoEXT[] = {
+    FIELD_VALUE(XrDebugUtilsObjectNameInfoEXT, type),
+    FIELD_XR(XrDebugUtilsObjectNameInfoEXT, next),
+    FIELD_VALUE(XrDebugUtilsObjectNameInfoEXT, objectType),
+    FIELD_VALUE(XrDebugUtilsObjectNameInfoEXT, objectHandle),
+    FIELD_STRING(XrDebugUtilsObjectNameInfoEXT, objectName),
+};
+
+void serialize(const XrDebugUtilsObjectNameInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDebugUtilsObjectNameInfoEXT, ctx);
+}
+
+void deserialize(XrDebugUtilsObjectNameInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDebugUtilsObjectNameInfoEXT, ctx);
+}
+
+void cleanup(const XrDebugUtilsObjectNameInfoEXT* s) {
+    cleanup_fields(s, fields_XrDebugUtilsObjectNameInfoEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
+#ifdef XRTRANSPORT_EXT_XR_EXT_dpad_binding
+constexpr FieldDescriptor fields_XrInteractionProfileDpadBindingEXT[] = {
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, type),
+    FIELD_XR(XrInteractionProfileDpadBindingEXT, next),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, binding),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, actionSet),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, forceThreshold),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, forceThresholdReleased),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, centerRegion),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, wedgeAngle),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, isSticky),
+    FIELD_XR(XrInteractionProfileDpadBindingEXT, onHaptic),
+    FIELD_XR(XrInteractionProfileDpadBindingEXT, offHaptic),
+};
+
+void serialize(const XrInteractionProfileDpadBindingEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInteractionProfileDpadBindingEXT, ctx);
+}
+
+void deserialize(XrInteractionProfileDpadBindingEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInteractionProfileDpadBindingEXT, ctx);
+}
+
+void cleanup(const XrInteractionProfileDpadBindingEXT* s) {
+    cleanup_fields(s, fields_XrInteractionProfileDpadBindingEXT);
+}
+
+constexpr FieldDescriptor fields_XrInteractionProfileDpadBindingEXT[] = {
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, type),
+    FIELD_XR(XrInteractionProfileDpadBindingEXT, next),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, binding),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, actionSet),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, forceThreshold),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, forceThresholdReleased),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, centerRegion),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, wedgeAngle),
+    FIELD_VALUE(XrInteractionProfileDpadBindingEXT, isSticky),
+    FIELD_XR(XrInteractionProfileDpadBindingEXT, onHaptic),
+    FIELD_XR(XrInteractionProfileDpadBindingEXT, offHaptic),
+};
+
+void serialize(const XrInteractionProfileDpadBindingEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInteractionProfileDpadBindingEXT, ctx);
+}
+
+void deserialize(XrInteractionProfileDpadBindingEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInteractionProfileDpadBindingEXT, ctx);
+}
+
+void cleanup(const XrInteractionProfileDpadBindingEXT* s) {
+    cleanup_fields(s, fields_XrInteractionProfileDpadBindingEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_dpad_binding
+#ifdef XRTRANSPORT_EXT_XR_EXT_eye_gaze_interaction
+constexpr FieldDescriptor fields_XrEyeGazeSampleTimeEXT[] = {
+    FIELD_VALUE(XrEyeGazeSampleTimeEXT, type),
+    FIELD_XR(XrEyeGazeSampleTimeEXT, next),
+    FIELD_TIME(XrEyeGazeSampleTimeEXT, time),
+};
+
+void serialize(const XrEyeGazeSampleTimeEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazeSampleTimeEXT, ctx);
+}
+
+void deserialize(XrEyeGazeSampleTimeEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazeSampleTimeEXT, ctx);
+}
+
+void cleanup(const XrEyeGazeSampleTimeEXT* s) {
+    cleanup_fields(s, fields_XrEyeGazeSampleTimeEXT);
+}
+
+constexpr FieldDescriptor fields_XrEyeGazeSampleTimeEXT[] = {
+    FIELD_VALUE(XrEyeGazeSampleTimeEXT, type),
+    FIELD_XR(XrEyeGazeSampleTimeEXT, next),
+    FIELD_TIME(XrEyeGazeSampleTimeEXT, time),
+};
+
+void serialize(const XrEyeGazeSampleTimeEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazeSampleTimeEXT, ctx);
+}
+
+void deserialize(XrEyeGazeSampleTimeEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazeSampleTimeEXT, ctx);
+}
+
+void cleanup(const XrEyeGazeSampleTimeEXT* s) {
+    cleanup_fields(s, fields_XrEyeGazeSampleTimeEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemEyeGazeInteractionPropertiesEXT[] = {
+    FIELD_VALUE(XrSystemEyeGazeInteractionPropertiesEXT, type),
+    FIELD_XR(XrSystemEyeGazeInteractionPropertiesEXT, next),
+    FIELD_VALUE(XrSystemEyeGazeInteractionPropertiesEXT, supportsEyeGazeInteraction),
+};
+
+void serialize(const XrSystemEyeGazeInteractionPropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemEyeGazeInteractionPropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemEyeGazeInteractionPropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemEyeGazeInteractionPropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemEyeGazeInteractionPropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemEyeGazeInteractionPropertiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemEyeGazeInteractionPropertiesEXT[] = {
+    FIELD_VALUE(XrSystemEyeGazeInteractionPropertiesEXT, type),
+    FIELD_XR(XrSystemEyeGazeInteractionPropertiesEXT, next),
+    FIELD_VALUE(XrSystemEyeGazeInteractionPropertiesEXT, supportsEyeGazeInteraction),
+};
+
+void serialize(const XrSystemEyeGazeInteractionPropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemEyeGazeInteractionPropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemEyeGazeInteractionPropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemEyeGazeInteractionPropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemEyeGazeInteractionPropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemEyeGazeInteractionPropertiesEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_eye_gaze_interaction
+#ifdef XRTRANSPORT_EXT_XR_EXT_frame_synthesis
+constexpr FieldDescriptor fields_XrFrameSynthesisConfigViewEXT[] = {
+    FIELD_VALUE(XrFrameSynthesisConfigViewEXT, type),
+    FIELD_XR(XrFrameSynthesisConfigViewEXT, next),
+    FIELD_VALUE(XrFrameSynthesisConfigViewEXT, recommendedMotionVectorImageRectWidth),
+    FIELD_VALUE(XrFrameSynthesisConfigViewEXT, recommendedMotionVectorImageRectHeight),
+};
+
+void serialize(const XrFrameSynthesisConfigViewEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameSynthesisConfigViewEXT, ctx);
+}
+
+void deserialize(XrFrameSynthesisConfigViewEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameSynthesisConfigViewEXT, ctx);
+}
+
+void cleanup(const XrFrameSynthesisConfigViewEXT* s) {
+    cleanup_fields(s, fields_XrFrameSynthesisConfigViewEXT);
+}
+
+constexpr FieldDescriptor fields_XrFrameSynthesisConfigViewEXT[] = {
+    FIELD_VALUE(XrFrameSynthesisConfigViewEXT, type),
+    FIELD_XR(XrFrameSynthesisConfigViewEXT, next),
+    FIELD_VALUE(XrFrameSynthesisConfigViewEXT, recommendedMotionVectorImageRectWidth),
+    FIELD_VALUE(XrFrameSynthesisConfigViewEXT, recommendedMotionVectorImageRectHeight),
+};
+
+void serialize(const XrFrameSynthesisConfigViewEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameSynthesisConfigViewEXT, ctx);
+}
+
+void deserialize(XrFrameSynthesisConfigViewEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameSynthesisConfigViewEXT, ctx);
+}
+
+void cleanup(const XrFrameSynthesisConfigViewEXT* s) {
+    cleanup_fields(s, fields_XrFrameSynthesisConfigViewEXT);
+}
+
+constexpr FieldDescriptor fields_XrFrameSynthesisInfoEXT[] = {
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, type),
+    FIELD_XR(XrFrameSynthesisInfoEXT, next),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, layerFlags),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, motionVectorSubImage),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, motionVectorScale),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, motionVectorOffset),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, appSpaceDeltaPose),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, depthSubImage),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, minDepth),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, maxDepth),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, nearZ),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, farZ),
+};
+
+void serialize(const XrFrameSynthesisInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameSynthesisInfoEXT, ctx);
+}
+
+void deserialize(XrFrameSynthesisInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameSynthesisInfoEXT, ctx);
+}
+
+void cleanup(const XrFrameSynthesisInfoEXT* s) {
+    cleanup_fields(s, fields_XrFrameSynthesisInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrFrameSynthesisInfoEXT[] = {
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, type),
+    FIELD_XR(XrFrameSynthesisInfoEXT, next),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, layerFlags),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, motionVectorSubImage),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, motionVectorScale),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, motionVectorOffset),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, appSpaceDeltaPose),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, depthSubImage),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, minDepth),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, maxDepth),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, nearZ),
+    FIELD_VALUE(XrFrameSynthesisInfoEXT, farZ),
+};
+
+void serialize(const XrFrameSynthesisInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameSynthesisInfoEXT, ctx);
+}
+
+void deserialize(XrFrameSynthesisInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameSynthesisInfoEXT, ctx);
+}
+
+void cleanup(const XrFrameSynthesisInfoEXT* s) {
+    cleanup_fields(s, fields_XrFrameSynthesisInfoEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_frame_synthesis
+#ifdef XRTRANSPORT_EXT_XR_EXT_future
+constexpr FieldDescriptor fields_XrFutureCancelInfoEXT[] = {
+    FIELD_VALUE(XrFutureCancelInfoEXT, type),
+    FIELD_XR(XrFutureCancelInfoEXT, next),
+    FIELD_VALUE(XrFutureCancelInfoEXT, future),
+};
+
+void serialize(const XrFutureCancelInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFutureCancelInfoEXT, ctx);
+}
+
+void deserialize(XrFutureCancelInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFutureCancelInfoEXT, ctx);
+}
+
+void cleanup(const XrFutureCancelInfoEXT* s) {
+    cleanup_fields(s, fields_XrFutureCancelInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrFutureCancelInfoEXT[] = {
+    FIELD_VALUE(XrFutureCancelInfoEXT, type),
+    FIELD_XR(XrFutureCancelInfoEXT, next),
+    FIELD_VALUE(XrFutureCancelInfoEXT, future),
+};
+
+void serialize(const XrFutureCancelInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFutureCancelInfoEXT, ctx);
+}
+
+void deserialize(XrFutureCancelInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFutureCancelInfoEXT, ctx);
+}
+
+void cleanup(const XrFutureCancelInfoEXT* s) {
+    cleanup_fields(s, fields_XrFutureCancelInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrFutureCompletionBaseHeaderEXT[] = {
+    FIELD_VALUE(XrFutureCompletionBaseHeaderEXT, type),
+    FIELD_XR(XrFutureCompletionBaseHeaderEXT, next),
+    FIELD_VALUE(XrFutureCompletionBaseHeaderEXT, futureResult),
+};
+
+void serialize(const XrFutureCompletionBaseHeaderEXT* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrFutureCompletionBaseHeaderEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFutureCompletionBaseHeaderEXT, ctx);
+}
+
+void cleanup(const XrFutureCompletionBaseHeaderEXT* s) {
+    cleanup_fields(s, fields_XrFutureCompletionBaseHeaderEXT);
+}
+
+constexpr FieldDescriptor fields_XrFutureCompletionEXT[] = {
+    FIELD_VALUE(XrFutureCompletionEXT, type),
+    FIELD_XR(XrFutureCompletionEXT, next),
+    FIELD_VALUE(XrFutureCompletionEXT, futureResult),
+};
+
+void serialize(const XrFutureCompletionEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFutureCompletionEXT, ctx);
+}
+
+void deserialize(XrFutureCompletionEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFutureCompletionEXT, ctx);
+}
+
+void cleanup(const XrFutureCompletionEXT* s) {
+    cleanup_fields(s, fields_XrFutureCompletionEXT);
+}
+
+constexpr FieldDescriptor fields_XrFutureCompletionEXT[] = {
+    FIELD_VALUE(XrFutureCompletionEXT, type),
+    FIELD_XR(XrFutureCompletionEXT, next),
+    FIELD_VALUE(XrFutureCompletionEXT, futureResult),
+};
+
+void serialize(const XrFutureCompletionEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFutureCompletionEXT, ctx);
+}
+
+void deserialize(XrFutureCompletionEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFutureCompletionEXT, ctx);
+}
+
+void cleanup(const XrFutureCompletionEXT* s) {
+    cleanup_fields(s, fields_XrFutureCompletionEXT);
+}
+
+constexpr FieldDescriptor fields_XrFuturePollInfoEXT[] = {
+    FIELD_VALUE(XrFuturePollInfoEXT, type),
+    FIELD_XR(XrFuturePollInfoEXT, next),
+    FIELD_VALUE(XrFuturePollInfoEXT, future),
+};
+
+void serialize(const XrFuturePollInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFuturePollInfoEXT, ctx);
+}
+
+void deserialize(XrFuturePollInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFuturePollInfoEXT, ctx);
+}
+
+void cleanup(const XrFuturePollInfoEXT* s) {
+    cleanup_fields(s, fields_XrFuturePollInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrFuturePollInfoEXT[] = {
+    FIELD_VALUE(XrFuturePollInfoEXT, type),
+    FIELD_XR(XrFuturePollInfoEXT, next),
+    FIELD_VALUE(XrFuturePollInfoEXT, future),
+};
+
+void serialize(const XrFuturePollInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFuturePollInfoEXT, ctx);
+}
+
+void deserialize(XrFuturePollInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFuturePollInfoEXT, ctx);
+}
+
+void cleanup(const XrFuturePollInfoEXT* s) {
+    cleanup_fields(s, fields_XrFuturePollInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrFuturePollResultEXT[] = {
+    FIELD_VALUE(XrFuturePollResultEXT, type),
+    FIELD_XR(XrFuturePollResultEXT, next),
+    FIELD_VALUE(XrFuturePollResultEXT, state),
+};
+
+void serialize(const XrFuturePollResultEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFuturePollResultEXT, ctx);
+}
+
+void deserialize(XrFuturePollResultEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFuturePollResultEXT, ctx);
+}
+
+void cleanup(const XrFuturePollResultEXT* s) {
+    cleanup_fields(s, fields_XrFuturePollResultEXT);
+}
+
+constexpr FieldDescriptor fields_XrFuturePollResultEXT[] = {
+    FIELD_VALUE(XrFuturePollResultEXT, type),
+    FIELD_XR(XrFuturePollResultEXT, next),
+    FIELD_VALUE(XrFuturePollResultEXT, state),
+};
+
+void serialize(const XrFuturePollResultEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFuturePollResultEXT, ctx);
+}
+
+void deserialize(XrFuturePollResultEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFuturePollResultEXT, ctx);
+}
+
+void cleanup(const XrFuturePollResultEXT* s) {
+    cleanup_fields(s, fields_XrFuturePollResultEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_future
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_joints_motion_range
+constexpr FieldDescriptor fields_XrHandJointsMotionRangeInfoEXT[] = {
+    FIELD_VALUE(XrHandJointsMotionRangeInfoEXT, type),
+    FIELD_XR(XrHandJointsMotionRangeInfoEXT, next),
+    FIELD_VALUE(XrHandJointsMotionRangeInfoEXT, handJointsMotionRange),
+};
+
+void serialize(const XrHandJointsMotionRangeInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointsMotionRangeInfoEXT, ctx);
+}
+
+void deserialize(XrHandJointsMotionRangeInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointsMotionRangeInfoEXT, ctx);
+}
+
+void cleanup(const XrHandJointsMotionRangeInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandJointsMotionRangeInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointsMotionRangeInfoEXT[] = {
+    FIELD_VALUE(XrHandJointsMotionRangeInfoEXT, type),
+    FIELD_XR(XrHandJointsMotionRangeInfoEXT, next),
+    FIELD_VALUE(XrHandJointsMotionRangeInfoEXT, handJointsMotionRange),
+};
+
+void serialize(const XrHandJointsMotionRangeInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointsMotionRangeInfoEXT, ctx);
+}
+
+void deserialize(XrHandJointsMotionRangeInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointsMotionRangeInfoEXT, ctx);
+}
+
+void cleanup(const XrHandJointsMotionRangeInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandJointsMotionRangeInfoEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_joints_motion_range
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+constexpr FieldDescriptor fields_XrHandJointLocationEXT[] = {
+    FIELD_VALUE(XrHandJointLocationEXT, locationFlags),
+    FIELD_VALUE(XrHandJointLocationEXT, pose),
+    FIELD_VALUE(XrHandJointLocationEXT, radius),
+};
+
+void serialize(const XrHandJointLocationEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointLocationEXT, ctx);
+}
+
+void deserialize(XrHandJointLocationEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointLocationEXT, ctx);
+}
+
+void cleanup(const XrHandJointLocationEXT* s) {
+    cleanup_fields(s, fields_XrHandJointLocationEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointLocationsEXT[] = {
+    FIELD_VALUE(XrHandJointLocationsEXT, type),
+    FIELD_XR(XrHandJointLocationsEXT, next),
+    FIELD_VALUE(XrHandJointLocationsEXT, isActive),
+    FIELD_VALUE(XrHandJointLocationsEXT, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrHandJointLocationsEXT, jointLocations, jointCount, QUANTIZED_XR_EXT_hand_tracking),
+};
+
+void serialize(const XrHandJointLocationsEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointLocationsEXT, ctx);
+}
+
+void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointLocationsEXT, ctx);
+}
+
+void cleanup(const XrHandJointLocationsEXT* s) {
+    cleanup_fields(s, fields_XrHandJointLocationsEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointLocationsEXT[] = {
+    FIELD_VALUE(XrHandJointLocationsEXT, type),
+    FIELD_XR(XrHandJointLocationsEXT, next),
+    FIELD_VALUE(XrHandJointLocationsEXT, isActive),
+    FIELD_VALUE(XrHandJointLocationsEXT, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrHandJointLocationsEXT, jointLocations, jointCount, QUANTIZED_XR_EXT_hand_tracking),
+};
+
+void serialize(const XrHandJointLocationsEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointLocationsEXT, ctx);
+}
+
+void deserialize(XrHandJointLocationsEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointLocationsEXT, ctx);
+}
+
+void cleanup(const XrHandJointLocationsEXT* s) {
+    cleanup_fields(s, fields_XrHandJointLocationsEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointVelocitiesEXT[] = {
+    FIELD_VALUE(XrHandJointVelocitiesEXT, type),
+    FIELD_XR(XrHandJointVelocitiesEXT, next),
+    FIELD_VALUE(XrHandJointVelocitiesEXT, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrHandJointVelocitiesEXT, jointVelocities, jointCount, QUANTIZED_XR_EXT_hand_tracking),
+};
+
+void serialize(const XrHandJointVelocitiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointVelocitiesEXT, ctx);
+}
+
+void deserialize(XrHandJointVelocitiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointVelocitiesEXT, ctx);
+}
+
+void cleanup(const XrHandJointVelocitiesEXT* s) {
+    cleanup_fields(s, fields_XrHandJointVelocitiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointVelocitiesEXT[] = {
+    FIELD_VALUE(XrHandJointVelocitiesEXT, type),
+    FIELD_XR(XrHandJointVelocitiesEXT, next),
+    FIELD_VALUE(XrHandJointVelocitiesEXT, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrHandJointVelocitiesEXT, jointVelocities, jointCount, QUANTIZED_XR_EXT_hand_tracking),
+};
+
+void serialize(const XrHandJointVelocitiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointVelocitiesEXT, ctx);
+}
+
+void deserialize(XrHandJointVelocitiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointVelocitiesEXT, ctx);
+}
+
+void cleanup(const XrHandJointVelocitiesEXT* s) {
+    cleanup_fields(s, fields_XrHandJointVelocitiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointVelocityEXT[] = {
+    FIELD_VALUE(XrHandJointVelocityEXT, velocityFlags),
+    FIELD_VALUE(XrHandJointVelocityEXT, linearVelocity),
+    FIELD_VALUE(XrHandJointVelocityEXT, angularVelocity),
+};
+
+void serialize(const XrHandJointVelocityEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointVelocityEXT, ctx);
+}
+
+void deserialize(XrHandJointVelocityEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointVelocityEXT, ctx);
+}
+
+void cleanup(const XrHandJointVelocityEXT* s) {
+    cleanup_fields(s, fields_XrHandJointVelocityEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointsLocateInfoEXT[] = {
+    FIELD_VALUE(XrHandJointsLocateInfoEXT, type),
+    FIELD_XR(XrHandJointsLocateInfoEXT, next),
+    FIELD_VALUE(XrHandJointsLocateInfoEXT, baseSpace),
+    FIELD_TIME(XrHandJointsLocateInfoEXT, time),
+};
+
+void serialize(const XrHandJointsLocateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointsLocateInfoEXT, ctx);
+}
+
+void deserialize(XrHandJointsLocateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointsLocateInfoEXT, ctx);
+}
+
+void cleanup(const XrHandJointsLocateInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandJointsLocateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandJointsLocateInfoEXT[] = {
+    FIELD_VALUE(XrHandJointsLocateInfoEXT, type),
+    FIELD_XR(XrHandJointsLocateInfoEXT, next),
+    FIELD_VALUE(XrHandJointsLocateInfoEXT, baseSpace),
+    FIELD_TIME(XrHandJointsLocateInfoEXT, time),
+};
+
+void serialize(const XrHandJointsLocateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandJointsLocateInfoEXT, ctx);
+}
+
+void deserialize(XrHandJointsLocateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandJointsLocateInfoEXT, ctx);
+}
+
+void cleanup(const XrHandJointsLocateInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandJointsLocateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackerCreateInfoEXT[] = {
+    FIELD_VALUE(XrHandTrackerCreateInfoEXT, type),
+    FIELD_XR(XrHandTrackerCreateInfoEXT, next),
+    FIELD_VALUE(XrHandTrackerCreateInfoEXT, hand),
+    FIELD_VALUE(XrHandTrackerCreateInfoEXT, handJointSet),
+};
+
+void serialize(const XrHandTrackerCreateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackerCreateInfoEXT, ctx);
+}
+
+void deserialize(XrHandTrackerCreateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackerCreateInfoEXT, ctx);
+}
+
+void cleanup(const XrHandTrackerCreateInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandTrackerCreateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackerCreateInfoEXT[] = {
+    FIELD_VALUE(XrHandTrackerCreateInfoEXT, type),
+    FIELD_XR(XrHandTrackerCreateInfoEXT, next),
+    FIELD_VALUE(XrHandTrackerCreateInfoEXT, hand),
+    FIELD_VALUE(XrHandTrackerCreateInfoEXT, handJointSet),
+};
+
+void serialize(const XrHandTrackerCreateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackerCreateInfoEXT, ctx);
+}
+
+void deserialize(XrHandTrackerCreateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackerCreateInfoEXT, ctx);
+}
+
+void cleanup(const XrHandTrackerCreateInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandTrackerCreateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemHandTrackingPropertiesEXT[] = {
+    FIELD_VALUE(XrSystemHandTrackingPropertiesEXT, type),
+    FIELD_XR(XrSystemHandTrackingPropertiesEXT, next),
+    FIELD_VALUE(XrSystemHandTrackingPropertiesEXT, supportsHandTracking),
+};
+
+void serialize(const XrSystemHandTrackingPropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemHandTrackingPropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemHandTrackingPropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemHandTrackingPropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemHandTrackingPropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemHandTrackingPropertiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemHandTrackingPropertiesEXT[] = {
+    FIELD_VALUE(XrSystemHandTrackingPropertiesEXT, type),
+    FIELD_XR(XrSystemHandTrackingPropertiesEXT, next),
+    FIELD_VALUE(XrSystemHandTrackingPropertiesEXT, supportsHandTracking),
+};
+
+void serialize(const XrSystemHandTrackingPropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemHandTrackingPropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemHandTrackingPropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemHandTrackingPropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemHandTrackingPropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemHandTrackingPropertiesEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking_data_source
+constexpr FieldDescriptor fields_XrHandTrackingDataSourceInfoEXT[] = {
+    FIELD_VALUE(XrHandTrackingDataSourceInfoEXT, type),
+    FIELD_XR(XrHandTrackingDataSourceInfoEXT, next),
+    FIELD_VALUE(XrHandTrackingDataSourceInfoEXT, requestedDataSourceCount),
+    FIELD_PTR(XrHandTrackingDataSourceInfoEXT, requestedDataSources, requestedDataSourceCount),
+};
+
+void serialize(const XrHandTrackingDataSourceInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingDataSourceInfoEXT, ctx);
+}
+
+void deserialize(XrHandTrackingDataSourceInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingDataSourceInfoEXT, ctx);
+}
+
+void cleanup(const XrHandTrackingDataSourceInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandTrackingDataSourceInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingDataSourceInfoEXT[] = {
+    FIELD_VALUE(XrHandTrackingDataSourceInfoEXT, type),
+    FIELD_XR(XrHandTrackingDataSourceInfoEXT, next),
+    FIELD_VALUE(XrHandTrackingDataSourceInfoEXT, requestedDataSourceCount),
+    FIELD_PTR(XrHandTrackingDataSourceInfoEXT, requestedDataSources, requestedDataSourceCount),
+};
+
+void serialize(const XrHandTrackingDataSourceInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingDataSourceInfoEXT, ctx);
+}
+
+void deserialize(XrHandTrackingDataSourceInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingDataSourceInfoEXT, ctx);
+}
+
+void cleanup(const XrHandTrackingDataSourceInfoEXT* s) {
+    cleanup_fields(s, fields_XrHandTrackingDataSourceInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingDataSourceStateEXT[] = {
+    FIELD_VALUE(XrHandTrackingDataSourceStateEXT, type),
+    FIELD_XR(XrHandTrackingDataSourceStateEXT, next),
+    FIELD_VALUE(XrHandTrackingDataSourceStateEXT, isActive),
+    FIELD_VALUE(XrHandTrackingDataSourceStateEXT, dataSource),
+};
+
+void serialize(const XrHandTrackingDataSourceStateEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingDataSourceStateEXT, ctx);
+}
+
+void deserialize(XrHandTrackingDataSourceStateEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingDataSourceStateEXT, ctx);
+}
+
+void cleanup(const XrHandTrackingDataSourceStateEXT* s) {
+    cleanup_fields(s, fields_XrHandTrackingDataSourceStateEXT);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingDataSourceStateEXT[] = {
+    FIELD_VALUE(XrHandTrackingDataSourceStateEXT, type),
+    FIELD_XR(XrHandTrackingDataSourceStateEXT, next),
+    FIELD_VALUE(XrHandTrackingDataSourceStateEXT, isActive),
+    FIELD_VALUE(XrHandTrackingDataSourceStateEXT, dataSource),
+};
+
+void serialize(const XrHandTrackingDataSourceStateEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingDataSourceStateEXT, ctx);
+}
+
+void deserialize(XrHandTrackingDataSourceStateEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingDataSourceStateEXT, ctx);
+}
+
+void cleanup(const XrHandTrackingDataSourceStateEXT* s) {
+    cleanup_fields(s, fields_XrHandTrackingDataSourceStateEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking_data_source
+#ifdef XRTRANSPORT_EXT_XR_EXT_performance_settings
+constexpr FieldDescriptor fields_XrEventDataPerfSettingsEXT[] = {
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, type),
+    FIELD_XR(XrEventDataPerfSettingsEXT, next),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, domain),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, subDomain),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, fromLevel),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, toLevel),
+};
+
+void serialize(const XrEventDataPerfSettingsEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataPerfSettingsEXT, ctx);
+}
+
+void deserialize(XrEventDataPerfSettingsEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataPerfSettingsEXT, ctx);
+}
+
+void cleanup(const XrEventDataPerfSettingsEXT* s) {
+    cleanup_fields(s, fields_XrEventDataPerfSettingsEXT);
+}
+
+constexpr FieldDescriptor fields_XrEventDataPerfSettingsEXT[] = {
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, type),
+    FIELD_XR(XrEventDataPerfSettingsEXT, next),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, domain),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, subDomain),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, fromLevel),
+    FIELD_VALUE(XrEventDataPerfSettingsEXT, toLevel),
+};
+
+void serialize(const XrEventDataPerfSettingsEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataPerfSettingsEXT, ctx);
+}
+
+void deserialize(XrEventDataPerfSettingsEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataPerfSettingsEXT, ctx);
+}
+
+void cleanup(const XrEventDataPerfSettingsEXT* s) {
+    cleanup_fields(s, fields_XrEventDataPerfSettingsEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_performance_settings
+#ifdef XRTRANSPORT_EXT_XR_EXT_plane_detection
+constexpr FieldDescriptor fields_XrPlaneDetectorBeginInfoEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, type),
+    FIELD_XR(XrPlaneDetectorBeginInfoEXT, next),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, baseSpace),
+    FIELD_TIME(XrPlaneDetectorBeginInfoEXT, time),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, orientationCount),
+    FIELD_PTR(XrPlaneDetectorBeginInfoEXT, orientations, orientationCount),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, semanticTypeCount),
+    FIELD_PTR(XrPlaneDetectorBeginInfoEXT, semanticTypes, semanticTypeCount),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, maxPlanes),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, minArea),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, boundingBoxPose),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, boundingBoxExtent),
+};
+
+void serialize(const XrPlaneDetectorBeginInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorBeginInfoEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorBeginInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorBeginInfoEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorBeginInfoEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorBeginInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorBeginInfoEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, type),
+    FIELD_XR(XrPlaneDetectorBeginInfoEXT, next),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, baseSpace),
+    FIELD_TIME(XrPlaneDetectorBeginInfoEXT, time),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, orientationCount),
+    FIELD_PTR(XrPlaneDetectorBeginInfoEXT, orientations, orientationCount),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, semanticTypeCount),
+    FIELD_PTR(XrPlaneDetectorBeginInfoEXT, semanticTypes, semanticTypeCount),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, maxPlanes),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, minArea),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, boundingBoxPose),
+    FIELD_VALUE(XrPlaneDetectorBeginInfoEXT, boundingBoxExtent),
+};
+
+void serialize(const XrPlaneDetectorBeginInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorBeginInfoEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorBeginInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorBeginInfoEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorBeginInfoEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorBeginInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorCreateInfoEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorCreateInfoEXT, type),
+    FIELD_XR(XrPlaneDetectorCreateInfoEXT, next),
+    FIELD_VALUE(XrPlaneDetectorCreateInfoEXT, flags),
+};
+
+void serialize(const XrPlaneDetectorCreateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorCreateInfoEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorCreateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorCreateInfoEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorCreateInfoEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorCreateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorCreateInfoEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorCreateInfoEXT, type),
+    FIELD_XR(XrPlaneDetectorCreateInfoEXT, next),
+    FIELD_VALUE(XrPlaneDetectorCreateInfoEXT, flags),
+};
+
+void serialize(const XrPlaneDetectorCreateInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorCreateInfoEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorCreateInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorCreateInfoEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorCreateInfoEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorCreateInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorGetInfoEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorGetInfoEXT, type),
+    FIELD_XR(XrPlaneDetectorGetInfoEXT, next),
+    FIELD_VALUE(XrPlaneDetectorGetInfoEXT, baseSpace),
+    FIELD_TIME(XrPlaneDetectorGetInfoEXT, time),
+};
+
+void serialize(const XrPlaneDetectorGetInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorGetInfoEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorGetInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorGetInfoEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorGetInfoEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorGetInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorGetInfoEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorGetInfoEXT, type),
+    FIELD_XR(XrPlaneDetectorGetInfoEXT, next),
+    FIELD_VALUE(XrPlaneDetectorGetInfoEXT, baseSpace),
+    FIELD_TIME(XrPlaneDetectorGetInfoEXT, time),
+};
+
+void serialize(const XrPlaneDetectorGetInfoEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorGetInfoEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorGetInfoEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorGetInfoEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorGetInfoEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorGetInfoEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorLocationEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, type),
+    FIELD_XR(XrPlaneDetectorLocationEXT, next),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, planeId),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, locationFlags),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, pose),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, extents),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, orientation),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, semanticType),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, polygonBufferCount),
+};
+
+void serialize(const XrPlaneDetectorLocationEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorLocationEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorLocationEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorLocationEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorLocationEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorLocationEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorLocationEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, type),
+    FIELD_XR(XrPlaneDetectorLocationEXT, next),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, planeId),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, locationFlags),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, pose),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, extents),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, orientation),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, semanticType),
+    FIELD_VALUE(XrPlaneDetectorLocationEXT, polygonBufferCount),
+};
+
+void serialize(const XrPlaneDetectorLocationEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorLocationEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorLocationEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorLocationEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorLocationEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorLocationEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorLocationsEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorLocationsEXT, type),
+    FIELD_XR(XrPlaneDetectorLocationsEXT, next),
+    FIELD_VALUE(XrPlaneDetectorLocationsEXT, planeLocationCapacityInput),
+    FIELD_VALUE(XrPlaneDetectorLocationsEXT, planeLocationCountOutput),
+    FIELD_PTR(XrPlaneDetectorLocationsEXT, planeLocations, planeLocationCapacityInput),
+};
+
+void serialize(const XrPlaneDetectorLocationsEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorLocationsEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorLocationsEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorLocationsEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorLocationsEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorLocationsEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorLocationsEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorLocationsEXT, type),
+    FIELD_XR(XrPlaneDetectorLocationsEXT, next),
+    FIELD_VALUE(XrPlaneDetectorLocationsEXT, planeLocationCapacityInput),
+    FIELD_VALUE(XrPlaneDetectorLocationsEXT, planeLocationCountOutput),
+    FIELD_PTR(XrPlaneDetectorLocationsEXT, planeLocations, planeLocationCapacityInput),
+};
+
+void serialize(const XrPlaneDetectorLocationsEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorLocationsEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorLocationsEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorLocationsEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorLocationsEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorLocationsEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorPolygonBufferEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorPolygonBufferEXT, type),
+    FIELD_XR(XrPlaneDetectorPolygonBufferEXT, next),
+    FIELD_VALUE(XrPlaneDetectorPolygonBufferEXT, vertexCapacityInput),
+    FIELD_VALUE(XrPlaneDetectorPolygonBufferEXT, vertexCountOutput),
+    FIELD_PTR(XrPlaneDetectorPolygonBufferEXT, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrPlaneDetectorPolygonBufferEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorPolygonBufferEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorPolygonBufferEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorPolygonBufferEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorPolygonBufferEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorPolygonBufferEXT);
+}
+
+constexpr FieldDescriptor fields_XrPlaneDetectorPolygonBufferEXT[] = {
+    FIELD_VALUE(XrPlaneDetectorPolygonBufferEXT, type),
+    FIELD_XR(XrPlaneDetectorPolygonBufferEXT, next),
+    FIELD_VALUE(XrPlaneDetectorPolygonBufferEXT, vertexCapacityInput),
+    FIELD_VALUE(XrPlaneDetectorPolygonBufferEXT, vertexCountOutput),
+    FIELD_PTR(XrPlaneDetectorPolygonBufferEXT, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrPlaneDetectorPolygonBufferEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPlaneDetectorPolygonBufferEXT, ctx);
+}
+
+void deserialize(XrPlaneDetectorPolygonBufferEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPlaneDetectorPolygonBufferEXT, ctx);
+}
+
+void cleanup(const XrPlaneDetectorPolygonBufferEXT* s) {
+    cleanup_fields(s, fields_XrPlaneDetectorPolygonBufferEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemPlaneDetectionPropertiesEXT[] = {
+    FIELD_VALUE(XrSystemPlaneDetectionPropertiesEXT, type),
+    FIELD_XR(XrSystemPlaneDetectionPropertiesEXT, next),
+    FIELD_VALUE(XrSystemPlaneDetectionPropertiesEXT, supportedFeatures),
+};
+
+void serialize(const XrSystemPlaneDetectionPropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPlaneDetectionPropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemPlaneDetectionPropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPlaneDetectionPropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemPlaneDetectionPropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemPlaneDetectionPropertiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemPlaneDetectionPropertiesEXT[] = {
+    FIELD_VALUE(XrSystemPlaneDetectionPropertiesEXT, type),
+    FIELD_XR(XrSystemPlaneDetectionPropertiesEXT, next),
+    FIELD_VALUE(XrSystemPlaneDetectionPropertiesEXT, supportedFeatures),
+};
+
+void serialize(const XrSystemPlaneDetectionPropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPlaneDetectionPropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemPlaneDetectionPropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPlaneDetectionPropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemPlaneDetectionPropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemPlaneDetectionPropertiesEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_plane_detection
+#ifdef XRTRANSPORT_EXT_XR_EXT_user_presence
+constexpr FieldDescriptor fields_XrEventDataUserPresenceChangedEXT[] = {
+    FIELD_VALUE(XrEventDataUserPresenceChangedEXT, type),
+    FIELD_XR(XrEventDataUserPresenceChangedEXT, next),
+    FIELD_VALUE(XrEventDataUserPresenceChangedEXT, session),
+    FIELD_VALUE(XrEventDataUserPresenceChangedEXT, isUserPresent),
+};
+
+void serialize(const XrEventDataUserPresenceChangedEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataUserPresenceChangedEXT, ctx);
+}
+
+void deserialize(XrEventDataUserPresenceChangedEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataUserPresenceChangedEXT, ctx);
+}
+
+void cleanup(const XrEventDataUserPresenceChangedEXT* s) {
+    cleanup_fields(s, fields_XrEventDataUserPresenceChangedEXT);
+}
+
+constexpr FieldDescriptor fields_XrEventDataUserPresenceChangedEXT[] = {
+    FIELD_VALUE(XrEventDataUserPresenceChangedEXT, type),
+    FIELD_XR(XrEventDataUserPresenceChangedEXT, next),
+    FIELD_VALUE(XrEventDataUserPresenceChangedEXT, session),
+    FIELD_VALUE(XrEventDataUserPresenceChangedEXT, isUserPresent),
+};
+
+void serialize(const XrEventDataUserPresenceChangedEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataUserPresenceChangedEXT, ctx);
+}
+
+void deserialize(XrEventDataUserPresenceChangedEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataUserPresenceChangedEXT, ctx);
+}
+
+void cleanup(const XrEventDataUserPresenceChangedEXT* s) {
+    cleanup_fields(s, fields_XrEventDataUserPresenceChangedEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemUserPresencePropertiesEXT[] = {
+    FIELD_VALUE(XrSystemUserPresencePropertiesEXT, type),
+    FIELD_XR(XrSystemUserPresencePropertiesEXT, next),
+    FIELD_VALUE(XrSystemUserPresencePropertiesEXT, supportsUserPresence),
+};
+
+void serialize(const XrSystemUserPresencePropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemUserPresencePropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemUserPresencePropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemUserPresencePropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemUserPresencePropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemUserPresencePropertiesEXT);
+}
+
+constexpr FieldDescriptor fields_XrSystemUserPresencePropertiesEXT[] = {
+    FIELD_VALUE(XrSystemUserPresencePropertiesEXT, type),
+    FIELD_XR(XrSystemUserPresencePropertiesEXT, next),
+    FIELD_VALUE(XrSystemUserPresencePropertiesEXT, supportsUserPresence),
+};
+
+void serialize(const XrSystemUserPresencePropertiesEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemUserPresencePropertiesEXT, ctx);
+}
+
+void deserialize(XrSystemUserPresencePropertiesEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemUserPresencePropertiesEXT, ctx);
+}
+
+void cleanup(const XrSystemUserPresencePropertiesEXT* s) {
+    cleanup_fields(s, fields_XrSystemUserPresencePropertiesEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_user_presence
+#ifdef XRTRANSPORT_EXT_XR_EXT_view_configuration_depth_range
+constexpr FieldDescriptor fields_XrViewConfigurationDepthRangeEXT[] = {
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, type),
+    FIELD_XR(XrViewConfigurationDepthRangeEXT, next),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, recommendedNearZ),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, minNearZ),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, recommendedFarZ),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, maxFarZ),
+};
+
+void serialize(const XrViewConfigurationDepthRangeEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewConfigurationDepthRangeEXT, ctx);
+}
+
+void deserialize(XrViewConfigurationDepthRangeEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewConfigurationDepthRangeEXT, ctx);
+}
+
+void cleanup(const XrViewConfigurationDepthRangeEXT* s) {
+    cleanup_fields(s, fields_XrViewConfigurationDepthRangeEXT);
+}
+
+constexpr FieldDescriptor fields_XrViewConfigurationDepthRangeEXT[] = {
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, type),
+    FIELD_XR(XrViewConfigurationDepthRangeEXT, next),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, recommendedNearZ),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, minNearZ),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, recommendedFarZ),
+    FIELD_VALUE(XrViewConfigurationDepthRangeEXT, maxFarZ),
+};
+
+void serialize(const XrViewConfigurationDepthRangeEXT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewConfigurationDepthRangeEXT, ctx);
+}
+
+void deserialize(XrViewConfigurationDepthRangeEXT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewConfigurationDepthRangeEXT, ctx);
+}
+
+void cleanup(const XrViewConfigurationDepthRangeEXT* s) {
+    cleanup_fields(s, fields_XrViewConfigurationDepthRangeEXT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_EXT_view_configuration_depth_range
+#ifdef XRTRANSPORT_EXT_XR_FB_android_surface_swapchain_create
+constexpr FieldDescriptor fields_XrAndroidSurfaceSwapchainCreateInfoFB[] = {
+    FIELD_VALUE(XrAndroidSurfaceSwapchainCreateInfoFB, type),
+    FIELD_XR(XrAndroidSurfaceSwapchainCreateInfoFB, next),
+    FIELD_VALUE(XrAndroidSurfaceSwapchainCreateInfoFB, createFlags),
+};
+
+void serialize(const XrAndroidSurfaceSwapchainCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrAndroidSurfaceSwapchainCreateInfoFB, ctx);
+}
+
+void deserialize(XrAndroidSurfaceSwapchainCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrAndroidSurfaceSwapchainCreateInfoFB, ctx);
+}
+
+void cleanup(const XrAndroidSurfaceSwapchainCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrAndroidSurfaceSwapchainCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrAndroidSurfaceSwapchainCreateInfoFB[] = {
+    FIELD_VALUE(XrAndroidSurfaceSwapchainCreateInfoFB, type),
+    FIELD_XR(XrAndroidSurfaceSwapchainCreateInfoFB, next),
+    FIELD_VALUE(XrAndroidSurfaceSwapchainCreateInfoFB, createFlags),
+};
+
+void serialize(const XrAndroidSurfaceSwapchainCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrAndroidSurfaceSwapchainCreateInfoFB, ctx);
+}
+
+void deserialize(XrAndroidSurfaceSwapchainCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrAndroidSurfaceSwapchainCreateInfoFB, ctx);
+}
+
+void cleanup(const XrAndroidSurfaceSwapchainCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrAndroidSurfaceSwapchainCreateInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_android_surface_swapchain_create
+#ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
+constexpr FieldDescriptor fields_XrBodyJointLocationFB[] = {
+    FIELD_VALUE(XrBodyJointLocationFB, locationFlags),
+    FIELD_VALUE(XrBodyJointLocationFB, pose),
+};
+
+void serialize(const XrBodyJointLocationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationFB, ctx);
+}
+
+void deserialize(XrBodyJointLocationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationFB, ctx);
+}
+
+void cleanup(const XrBodyJointLocationFB* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationFB);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointLocationsFB[] = {
+    FIELD_VALUE(XrBodyJointLocationsFB, type),
+    FIELD_XR(XrBodyJointLocationsFB, next),
+    FIELD_VALUE(XrBodyJointLocationsFB, isActive),
+    FIELD_VALUE(XrBodyJointLocationsFB, confidence),
+    FIELD_VALUE(XrBodyJointLocationsFB, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrBodyJointLocationsFB, jointLocations, jointCount, QUANTIZED_XR_FB_body_tracking),
+    FIELD_VALUE(XrBodyJointLocationsFB, skeletonChangedCount),
+    FIELD_TIME(XrBodyJointLocationsFB, time),
+};
+
+void serialize(const XrBodyJointLocationsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationsFB, ctx);
+}
+
+void deserialize(XrBodyJointLocationsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationsFB, ctx);
+}
+
+void cleanup(const XrBodyJointLocationsFB* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationsFB);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointLocationsFB[] = {
+    FIELD_VALUE(XrBodyJointLocationsFB, type),
+    FIELD_XR(XrBodyJointLocationsFB, next),
+    FIELD_VALUE(XrBodyJointLocationsFB, isActive),
+    FIELD_VALUE(XrBodyJointLocationsFB, confidence),
+    FIELD_VALUE(XrBodyJointLocationsFB, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrBodyJointLocationsFB, jointLocations, jointCount, QUANTIZED_XR_FB_body_tracking),
+    FIELD_VALUE(XrBodyJointLocationsFB, skeletonChangedCount),
+    FIELD_TIME(XrBodyJointLocationsFB, time),
+};
+
+void serialize(const XrBodyJointLocationsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationsFB, ctx);
+}
+
+void deserialize(XrBodyJointLocationsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationsFB, ctx);
+}
+
+void cleanup(const XrBodyJointLocationsFB* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationsFB);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointsLocateInfoFB[] = {
+    FIELD_VALUE(XrBodyJointsLocateInfoFB, type),
+    FIELD_XR(XrBodyJointsLocateInfoFB, next),
+    FIELD_VALUE(XrBodyJointsLocateInfoFB, baseSpace),
+    FIELD_TIME(XrBodyJointsLocateInfoFB, time),
+};
+
+void serialize(const XrBodyJointsLocateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointsLocateInfoFB, ctx);
+}
+
+void deserialize(XrBodyJointsLocateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointsLocateInfoFB, ctx);
+}
+
+void cleanup(const XrBodyJointsLocateInfoFB* s) {
+    cleanup_fields(s, fields_XrBodyJointsLocateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointsLocateInfoFB[] = {
+    FIELD_VALUE(XrBodyJointsLocateInfoFB, type),
+    FIELD_XR(XrBodyJointsLocateInfoFB, next),
+    FIELD_VALUE(XrBodyJointsLocateInfoFB, baseSpace),
+    FIELD_TIME(XrBodyJointsLocateInfoFB, time),
+};
+
+void serialize(const XrBodyJointsLocateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointsLocateInfoFB, ctx);
+}
+
+void deserialize(XrBodyJointsLocateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointsLocateInfoFB, ctx);
+}
+
+void cleanup(const XrBodyJointsLocateInfoFB* s) {
+    cleanup_fields(s, fields_XrBodyJointsLocateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrBodySkeletonFB[] = {
+    FIELD_VALUE(XrBodySkeletonFB, type),
+    FIELD_XR(XrBodySkeletonFB, next),
+    FIELD_VALUE(XrBodySkeletonFB, jointCount),
+    FIELD_PTR(XrBodySkeletonFB, joints, jointCount),
+};
+
+void serialize(const XrBodySkeletonFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodySkeletonFB, ctx);
+}
+
+void deserialize(XrBodySkeletonFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodySkeletonFB, ctx);
+}
+
+void cleanup(const XrBodySkeletonFB* s) {
+    cleanup_fields(s, fields_XrBodySkeletonFB);
+}
+
+constexpr FieldDescriptor fields_XrBodySkeletonFB[] = {
+    FIELD_VALUE(XrBodySkeletonFB, type),
+    FIELD_XR(XrBodySkeletonFB, next),
+    FIELD_VALUE(XrBodySkeletonFB, jointCount),
+    FIELD_PTR(XrBodySkeletonFB, joints, jointCount),
+};
+
+void serialize(const XrBodySkeletonFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodySkeletonFB, ctx);
+}
+
+void deserialize(XrBodySkeletonFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodySkeletonFB, ctx);
+}
+
+void cleanup(const XrBodySkeletonFB* s) {
+    cleanup_fields(s, fields_XrBodySkeletonFB);
+}
+
+constexpr FieldDescriptor fields_XrBodySkeletonJointFB[] = {
+    FIELD_VALUE(XrBodySkeletonJointFB, joint),
+    FIELD_VALUE(XrBodySkeletonJointFB, parentJoint),
+    FIELD_VALUE(XrBodySkeletonJointFB, pose),
+};
+
+void serialize(const XrBodySkeletonJointFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodySkeletonJointFB, ctx);
+}
+
+void deserialize(XrBodySkeletonJointFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodySkeletonJointFB, ctx);
+}
+
+void cleanup(const XrBodySkeletonJointFB* s) {
+    cleanup_fields(s, fields_XrBodySkeletonJointFB);
+}
+
+constexpr FieldDescriptor fields_XrBodyTrackerCreateInfoFB[] = {
+    FIELD_VALUE(XrBodyTrackerCreateInfoFB, type),
+    FIELD_XR(XrBodyTrackerCreateInfoFB, next),
+    FIELD_VALUE(XrBodyTrackerCreateInfoFB, bodyJointSet),
+};
+
+void serialize(const XrBodyTrackerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyTrackerCreateInfoFB, ctx);
+}
+
+void deserialize(XrBodyTrackerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyTrackerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrBodyTrackerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrBodyTrackerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrBodyTrackerCreateInfoFB[] = {
+    FIELD_VALUE(XrBodyTrackerCreateInfoFB, type),
+    FIELD_XR(XrBodyTrackerCreateInfoFB, next),
+    FIELD_VALUE(XrBodyTrackerCreateInfoFB, bodyJointSet),
+};
+
+void serialize(const XrBodyTrackerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyTrackerCreateInfoFB, ctx);
+}
+
+void deserialize(XrBodyTrackerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyTrackerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrBodyTrackerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrBodyTrackerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemBodyTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemBodyTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesFB, supportsBodyTracking),
+};
+
+void serialize(const XrSystemBodyTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemBodyTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemBodyTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemBodyTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemBodyTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemBodyTrackingPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemBodyTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemBodyTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesFB, supportsBodyTracking),
+};
+
+void serialize(const XrSystemBodyTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemBodyTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemBodyTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemBodyTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemBodyTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemBodyTrackingPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_color_space
+constexpr FieldDescriptor fields_XrSystemColorSpacePropertiesFB[] = {
+    FIELD_VALUE(XrSystemColorSpacePropertiesFB, type),
+    FIELD_XR(XrSystemColorSpacePropertiesFB, next),
+    FIELD_VALUE(XrSystemColorSpacePropertiesFB, colorSpace),
+};
+
+void serialize(const XrSystemColorSpacePropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemColorSpacePropertiesFB, ctx);
+}
+
+void deserialize(XrSystemColorSpacePropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemColorSpacePropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemColorSpacePropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemColorSpacePropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemColorSpacePropertiesFB[] = {
+    FIELD_VALUE(XrSystemColorSpacePropertiesFB, type),
+    FIELD_XR(XrSystemColorSpacePropertiesFB, next),
+    FIELD_VALUE(XrSystemColorSpacePropertiesFB, colorSpace),
+};
+
+void serialize(const XrSystemColorSpacePropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemColorSpacePropertiesFB, ctx);
+}
+
+void deserialize(XrSystemColorSpacePropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemColorSpacePropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemColorSpacePropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemColorSpacePropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_color_space
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_alpha_blend
+constexpr FieldDescriptor fields_XrCompositionLayerAlphaBlendFB[] = {
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, type),
+    FIELD_XR(XrCompositionLayerAlphaBlendFB, next),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, srcFactorColor),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, dstFactorColor),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, srcFactorAlpha),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, dstFactorAlpha),
+};
+
+void serialize(const XrCompositionLayerAlphaBlendFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerAlphaBlendFB, ctx);
+}
+
+void deserialize(XrCompositionLayerAlphaBlendFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerAlphaBlendFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerAlphaBlendFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerAlphaBlendFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerAlphaBlendFB[] = {
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, type),
+    FIELD_XR(XrCompositionLayerAlphaBlendFB, next),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, srcFactorColor),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, dstFactorColor),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, srcFactorAlpha),
+    FIELD_VALUE(XrCompositionLayerAlphaBlendFB, dstFactorAlpha),
+};
+
+void serialize(const XrCompositionLayerAlphaBlendFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerAlphaBlendFB, ctx);
+}
+
+void deserialize(XrCompositionLayerAlphaBlendFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerAlphaBlendFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerAlphaBlendFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerAlphaBlendFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_alpha_blend
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_depth_test
+constexpr FieldDescriptor fields_XrCompositionLayerDepthTestFB[] = {
+    FIELD_VALUE(XrCompositionLayerDepthTestFB, type),
+    FIELD_XR(XrCompositionLayerDepthTestFB, next),
+    FIELD_VALUE(XrCompositionLayerDepthTestFB, depthMask),
+    FIELD_VALUE(XrCompositionLayerDepthTestFB, compareOp),
+};
+
+void serialize(const XrCompositionLayerDepthTestFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerDepthTestFB, ctx);
+}
+
+void deserialize(XrCompositionLayerDepthTestFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerDepthTestFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerDepthTestFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerDepthTestFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerDepthTestFB[] = {
+    FIELD_VALUE(XrCompositionLayerDepthTestFB, type),
+    FIELD_XR(XrCompositionLayerDepthTestFB, next),
+    FIELD_VALUE(XrCompositionLayerDepthTestFB, depthMask),
+    FIELD_VALUE(XrCompositionLayerDepthTestFB, compareOp),
+};
+
+void serialize(const XrCompositionLayerDepthTestFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerDepthTestFB, ctx);
+}
+
+void deserialize(XrCompositionLayerDepthTestFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerDepthTestFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerDepthTestFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerDepthTestFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_depth_test
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_image_layout
+constexpr FieldDescriptor fields_XrCompositionLayerImageLayoutFB[] = {
+    FIELD_VALUE(XrCompositionLayerImageLayoutFB, type),
+    FIELD_XR(XrCompositionLayerImageLayoutFB, next),
+    FIELD_VALUE(XrCompositionLayerImageLayoutFB, flags),
+};
+
+void serialize(const XrCompositionLayerImageLayoutFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerImageLayoutFB, ctx);
+}
+
+void deserialize(XrCompositionLayerImageLayoutFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerImageLayoutFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerImageLayoutFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerImageLayoutFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerImageLayoutFB[] = {
+    FIELD_VALUE(XrCompositionLayerImageLayoutFB, type),
+    FIELD_XR(XrCompositionLayerImageLayoutFB, next),
+    FIELD_VALUE(XrCompositionLayerImageLayoutFB, flags),
+};
+
+void serialize(const XrCompositionLayerImageLayoutFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerImageLayoutFB, ctx);
+}
+
+void deserialize(XrCompositionLayerImageLayoutFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerImageLayoutFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerImageLayoutFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerImageLayoutFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_image_layout
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_secure_content
+constexpr FieldDescriptor fields_XrCompositionLayerSecureContentFB[] = {
+    FIELD_VALUE(XrCompositionLayerSecureContentFB, type),
+    FIELD_XR(XrCompositionLayerSecureContentFB, next),
+    FIELD_VALUE(XrCompositionLayerSecureContentFB, flags),
+};
+
+void serialize(const XrCompositionLayerSecureContentFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerSecureContentFB, ctx);
+}
+
+void deserialize(XrCompositionLayerSecureContentFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerSecureContentFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerSecureContentFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerSecureContentFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerSecureContentFB[] = {
+    FIELD_VALUE(XrCompositionLayerSecureContentFB, type),
+    FIELD_XR(XrCompositionLayerSecureContentFB, next),
+    FIELD_VALUE(XrCompositionLayerSecureContentFB, flags),
+};
+
+void serialize(const XrCompositionLayerSecureContentFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerSecureContentFB, ctx);
+}
+
+void deserialize(XrCompositionLayerSecureContentFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerSecureContentFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerSecureContentFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerSecureContentFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_secure_content
+#ifdef XRTRANSPORT_EXT_XR_FB_composition_layer_settings
+constexpr FieldDescriptor fields_XrCompositionLayerSettingsFB[] = {
+    FIELD_VALUE(XrCompositionLayerSettingsFB, type),
+    FIELD_XR(XrCompositionLayerSettingsFB, next),
+    FIELD_VALUE(XrCompositionLayerSettingsFB, layerFlags),
+};
+
+void serialize(const XrCompositionLayerSettingsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerSettingsFB, ctx);
+}
+
+void deserialize(XrCompositionLayerSettingsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerSettingsFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerSettingsFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerSettingsFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerSettingsFB[] = {
+    FIELD_VALUE(XrCompositionLayerSettingsFB, type),
+    FIELD_XR(XrCompositionLayerSettingsFB, next),
+    FIELD_VALUE(XrCompositionLayerSettingsFB, layerFlags),
+};
+
+void serialize(const XrCompositionLayerSettingsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerSettingsFB, ctx);
+}
+
+void deserialize(XrCompositionLayerSettingsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerSettingsFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerSettingsFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerSettingsFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_composition_layer_settings
+#ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+constexpr FieldDescriptor fields_XrEventDataDisplayRefreshRateChangedFB[] = {
+    FIELD_VALUE(XrEventDataDisplayRefreshRateChangedFB, type),
+    FIELD_XR(XrEventDataDisplayRefreshRateChangedFB, next),
+    FIELD_VALUE(XrEventDataDisplayRefreshRateChangedFB, fromDisplayRefreshRate),
+    FIELD_VALUE(XrEventDataDisplayRefreshRateChangedFB, toDisplayRefreshRate),
+};
+
+void serialize(const XrEventDataDisplayRefreshRateChangedFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataDisplayRefreshRateChangedFB, ctx);
+}
+
+void deserialize(XrEventDataDisplayRefreshRateChangedFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataDisplayRefreshRateChangedFB, ctx);
+}
+
+void cleanup(const XrEventDataDisplayRefreshRateChangedFB* s) {
+    cleanup_fields(s, fields_XrEventDataDisplayRefreshRateChangedFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataDisplayRefreshRateChangedFB[] = {
+    FIELD_VALUE(XrEventDataDisplayRefreshRateChangedFB, type),
+    FIELD_XR(XrEventDataDisplayRefreshRateChangedFB, next),
+    FIELD_VALUE(XrEventDataDisplayRefreshRateChangedFB, fromDisplayRefreshRate),
+    FIELD_VALUE(XrEventDataDisplayRefreshRateChangedFB, toDisplayRefreshRate),
+};
+
+void serialize(const XrEventDataDisplayRefreshRateChangedFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataDisplayRefreshRateChangedFB, ctx);
+}
+
+void deserialize(XrEventDataDisplayRefreshRateChangedFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataDisplayRefreshRateChangedFB, ctx);
+}
+
+void cleanup(const XrEventDataDisplayRefreshRateChangedFB* s) {
+    cleanup_fields(s, fields_XrEventDataDisplayRefreshRateChangedFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+#ifdef XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+constexpr FieldDescriptor fields_XrEyeGazeFB[] = {
+    FIELD_VALUE(XrEyeGazeFB, isValid),
+    FIELD_VALUE(XrEyeGazeFB, gazePose),
+    FIELD_VALUE(XrEyeGazeFB, gazeConfidence),
+};
+
+void serialize(const XrEyeGazeFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazeFB, ctx);
+}
+
+void deserialize(XrEyeGazeFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazeFB, ctx);
+}
+
+void cleanup(const XrEyeGazeFB* s) {
+    cleanup_fields(s, fields_XrEyeGazeFB);
+}
+
+constexpr FieldDescriptor fields_XrEyeGazesFB[] = {
+    FIELD_VALUE(XrEyeGazesFB, type),
+    FIELD_XR(XrEyeGazesFB, next),
+    FIELD_ARRAY(XrEyeGazesFB, gaze),
+    FIELD_TIME(XrEyeGazesFB, time),
+};
+
+void serialize(const XrEyeGazesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazesFB, ctx);
+}
+
+void deserialize(XrEyeGazesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazesFB, ctx);
+}
+
+void cleanup(const XrEyeGazesFB* s) {
+    cleanup_fields(s, fields_XrEyeGazesFB);
+}
+
+constexpr FieldDescriptor fields_XrEyeGazesFB[] = {
+    FIELD_VALUE(XrEyeGazesFB, type),
+    FIELD_XR(XrEyeGazesFB, next),
+    FIELD_ARRAY(XrEyeGazesFB, gaze),
+    FIELD_TIME(XrEyeGazesFB, time),
+};
+
+void serialize(const XrEyeGazesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazesFB, ctx);
+}
+
+void deserialize(XrEyeGazesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazesFB, ctx);
+}
+
+void cleanup(const XrEyeGazesFB* s) {
+    cleanup_fields(s, fields_XrEyeGazesFB);
+}
+
+constexpr FieldDescriptor fields_XrEyeGazesInfoFB[] = {
+    FIELD_VALUE(XrEyeGazesInfoFB, type),
+    FIELD_XR(XrEyeGazesInfoFB, next),
+    FIELD_VALUE(XrEyeGazesInfoFB, baseSpace),
+    FIELD_TIME(XrEyeGazesInfoFB, time),
+};
+
+void serialize(const XrEyeGazesInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazesInfoFB, ctx);
+}
+
+void deserialize(XrEyeGazesInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazesInfoFB, ctx);
+}
+
+void cleanup(const XrEyeGazesInfoFB* s) {
+    cleanup_fields(s, fields_XrEyeGazesInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrEyeGazesInfoFB[] = {
+    FIELD_VALUE(XrEyeGazesInfoFB, type),
+    FIELD_XR(XrEyeGazesInfoFB, next),
+    FIELD_VALUE(XrEyeGazesInfoFB, baseSpace),
+    FIELD_TIME(XrEyeGazesInfoFB, time),
+};
+
+void serialize(const XrEyeGazesInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeGazesInfoFB, ctx);
+}
+
+void deserialize(XrEyeGazesInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeGazesInfoFB, ctx);
+}
+
+void cleanup(const XrEyeGazesInfoFB* s) {
+    cleanup_fields(s, fields_XrEyeGazesInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrEyeTrackerCreateInfoFB[] = {
+    FIELD_VALUE(XrEyeTrackerCreateInfoFB, type),
+    FIELD_XR(XrEyeTrackerCreateInfoFB, next),
+};
+
+void serialize(const XrEyeTrackerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeTrackerCreateInfoFB, ctx);
+}
+
+void deserialize(XrEyeTrackerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeTrackerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrEyeTrackerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrEyeTrackerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrEyeTrackerCreateInfoFB[] = {
+    FIELD_VALUE(XrEyeTrackerCreateInfoFB, type),
+    FIELD_XR(XrEyeTrackerCreateInfoFB, next),
+};
+
+void serialize(const XrEyeTrackerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEyeTrackerCreateInfoFB, ctx);
+}
+
+void deserialize(XrEyeTrackerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEyeTrackerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrEyeTrackerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrEyeTrackerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemEyeTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemEyeTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemEyeTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemEyeTrackingPropertiesFB, supportsEyeTracking),
+};
+
+void serialize(const XrSystemEyeTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemEyeTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemEyeTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemEyeTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemEyeTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemEyeTrackingPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemEyeTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemEyeTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemEyeTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemEyeTrackingPropertiesFB, supportsEyeTracking),
+};
+
+void serialize(const XrSystemEyeTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemEyeTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemEyeTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemEyeTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemEyeTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemEyeTrackingPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking
+constexpr FieldDescriptor fields_XrFaceExpressionInfoFB[] = {
+    FIELD_VALUE(XrFaceExpressionInfoFB, type),
+    FIELD_XR(XrFaceExpressionInfoFB, next),
+    FIELD_TIME(XrFaceExpressionInfoFB, time),
+};
+
+void serialize(const XrFaceExpressionInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionInfoFB, ctx);
+}
+
+void deserialize(XrFaceExpressionInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionInfoFB, ctx);
+}
+
+void cleanup(const XrFaceExpressionInfoFB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionInfoFB[] = {
+    FIELD_VALUE(XrFaceExpressionInfoFB, type),
+    FIELD_XR(XrFaceExpressionInfoFB, next),
+    FIELD_TIME(XrFaceExpressionInfoFB, time),
+};
+
+void serialize(const XrFaceExpressionInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionInfoFB, ctx);
+}
+
+void deserialize(XrFaceExpressionInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionInfoFB, ctx);
+}
+
+void cleanup(const XrFaceExpressionInfoFB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionStatusFB[] = {
+    FIELD_VALUE(XrFaceExpressionStatusFB, isValid),
+    FIELD_VALUE(XrFaceExpressionStatusFB, isEyeFollowingBlendshapesValid),
+};
+
+void serialize(const XrFaceExpressionStatusFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionStatusFB, ctx);
+}
+
+void deserialize(XrFaceExpressionStatusFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionStatusFB, ctx);
+}
+
+void cleanup(const XrFaceExpressionStatusFB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionStatusFB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionWeightsFB[] = {
+    FIELD_VALUE(XrFaceExpressionWeightsFB, type),
+    FIELD_XR(XrFaceExpressionWeightsFB, next),
+    FIELD_VALUE(XrFaceExpressionWeightsFB, weightCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeightsFB, weights, weightCount, QUANTIZED_XR_FB_face_tracking),
+    FIELD_VALUE(XrFaceExpressionWeightsFB, confidenceCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeightsFB, confidences, confidenceCount, QUANTIZED_XR_FB_face_tracking),
+    FIELD_VALUE(XrFaceExpressionWeightsFB, status),
+    FIELD_TIME(XrFaceExpressionWeightsFB, time),
+};
+
+void serialize(const XrFaceExpressionWeightsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionWeightsFB, ctx);
+}
+
+void deserialize(XrFaceExpressionWeightsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionWeightsFB, ctx);
+}
+
+void cleanup(const XrFaceExpressionWeightsFB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionWeightsFB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionWeightsFB[] = {
+    FIELD_VALUE(XrFaceExpressionWeightsFB, type),
+    FIELD_XR(XrFaceExpressionWeightsFB, next),
+    FIELD_VALUE(XrFaceExpressionWeightsFB, weightCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeightsFB, weights, weightCount, QUANTIZED_XR_FB_face_tracking),
+    FIELD_VALUE(XrFaceExpressionWeightsFB, confidenceCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeightsFB, confidences, confidenceCount, QUANTIZED_XR_FB_face_tracking),
+    FIELD_VALUE(XrFaceExpressionWeightsFB, status),
+    FIELD_TIME(XrFaceExpressionWeightsFB, time),
+};
+
+void serialize(const XrFaceExpressionWeightsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionWeightsFB, ctx);
+}
+
+void deserialize(XrFaceExpressionWeightsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionWeightsFB, ctx);
+}
+
+void cleanup(const XrFaceExpressionWeightsFB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionWeightsFB);
+}
+
+constexpr FieldDescriptor fields_XrFaceTrackerCreateInfoFB[] = {
+    FIELD_VALUE(XrFaceTrackerCreateInfoFB, type),
+    FIELD_XR(XrFaceTrackerCreateInfoFB, next),
+    FIELD_VALUE(XrFaceTrackerCreateInfoFB, faceExpressionSet),
+};
+
+void serialize(const XrFaceTrackerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceTrackerCreateInfoFB, ctx);
+}
+
+void deserialize(XrFaceTrackerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceTrackerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrFaceTrackerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrFaceTrackerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrFaceTrackerCreateInfoFB[] = {
+    FIELD_VALUE(XrFaceTrackerCreateInfoFB, type),
+    FIELD_XR(XrFaceTrackerCreateInfoFB, next),
+    FIELD_VALUE(XrFaceTrackerCreateInfoFB, faceExpressionSet),
+};
+
+void serialize(const XrFaceTrackerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceTrackerCreateInfoFB, ctx);
+}
+
+void deserialize(XrFaceTrackerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceTrackerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrFaceTrackerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrFaceTrackerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemFaceTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemFaceTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemFaceTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemFaceTrackingPropertiesFB, supportsFaceTracking),
+};
+
+void serialize(const XrSystemFaceTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFaceTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemFaceTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFaceTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemFaceTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemFaceTrackingPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemFaceTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemFaceTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemFaceTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemFaceTrackingPropertiesFB, supportsFaceTracking),
+};
+
+void serialize(const XrSystemFaceTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFaceTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemFaceTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFaceTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemFaceTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemFaceTrackingPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking2
+constexpr FieldDescriptor fields_XrFaceExpressionInfo2FB[] = {
+    FIELD_VALUE(XrFaceExpressionInfo2FB, type),
+    FIELD_XR(XrFaceExpressionInfo2FB, next),
+    FIELD_TIME(XrFaceExpressionInfo2FB, time),
+};
+
+void serialize(const XrFaceExpressionInfo2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionInfo2FB, ctx);
+}
+
+void deserialize(XrFaceExpressionInfo2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionInfo2FB, ctx);
+}
+
+void cleanup(const XrFaceExpressionInfo2FB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionInfo2FB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionInfo2FB[] = {
+    FIELD_VALUE(XrFaceExpressionInfo2FB, type),
+    FIELD_XR(XrFaceExpressionInfo2FB, next),
+    FIELD_TIME(XrFaceExpressionInfo2FB, time),
+};
+
+void serialize(const XrFaceExpressionInfo2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionInfo2FB, ctx);
+}
+
+void deserialize(XrFaceExpressionInfo2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionInfo2FB, ctx);
+}
+
+void cleanup(const XrFaceExpressionInfo2FB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionInfo2FB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionWeights2FB[] = {
+    FIELD_VALUE(XrFaceExpressionWeights2FB, type),
+    FIELD_XR(XrFaceExpressionWeights2FB, next),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, weightCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeights2FB, weights, weightCount, QUANTIZED_XR_FB_face_tracking2),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, confidenceCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeights2FB, confidences, confidenceCount, QUANTIZED_XR_FB_face_tracking2),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, isValid),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, isEyeFollowingBlendshapesValid),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, dataSource),
+    FIELD_TIME(XrFaceExpressionWeights2FB, time),
+};
+
+void serialize(const XrFaceExpressionWeights2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionWeights2FB, ctx);
+}
+
+void deserialize(XrFaceExpressionWeights2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionWeights2FB, ctx);
+}
+
+void cleanup(const XrFaceExpressionWeights2FB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionWeights2FB);
+}
+
+constexpr FieldDescriptor fields_XrFaceExpressionWeights2FB[] = {
+    FIELD_VALUE(XrFaceExpressionWeights2FB, type),
+    FIELD_XR(XrFaceExpressionWeights2FB, next),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, weightCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeights2FB, weights, weightCount, QUANTIZED_XR_FB_face_tracking2),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, confidenceCount),
+    FIELD_QUANTIZABLE_PTR(XrFaceExpressionWeights2FB, confidences, confidenceCount, QUANTIZED_XR_FB_face_tracking2),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, isValid),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, isEyeFollowingBlendshapesValid),
+    FIELD_VALUE(XrFaceExpressionWeights2FB, dataSource),
+    FIELD_TIME(XrFaceExpressionWeights2FB, time),
+};
+
+void serialize(const XrFaceExpressionWeights2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceExpressionWeights2FB, ctx);
+}
+
+void deserialize(XrFaceExpressionWeights2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceExpressionWeights2FB, ctx);
+}
+
+void cleanup(const XrFaceExpressionWeights2FB* s) {
+    cleanup_fields(s, fields_XrFaceExpressionWeights2FB);
+}
+
+constexpr FieldDescriptor fields_XrFaceTrackerCreateInfo2FB[] = {
+    FIELD_VALUE(XrFaceTrackerCreateInfo2FB, type),
+    FIELD_XR(XrFaceTrackerCreateInfo2FB, next),
+    FIELD_VALUE(XrFaceTrackerCreateInfo2FB, faceExpressionSet),
+    FIELD_VALUE(XrFaceTrackerCreateInfo2FB, requestedDataSourceCount),
+    FIELD_PTR(XrFaceTrackerCreateInfo2FB, requestedDataSources, requestedDataSourceCount),
+};
+
+void serialize(const XrFaceTrackerCreateInfo2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceTrackerCreateInfo2FB, ctx);
+}
+
+void deserialize(XrFaceTrackerCreateInfo2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceTrackerCreateInfo2FB, ctx);
+}
+
+void cleanup(const XrFaceTrackerCreateInfo2FB* s) {
+    cleanup_fields(s, fields_XrFaceTrackerCreateInfo2FB);
+}
+
+constexpr FieldDescriptor fields_XrFaceTrackerCreateInfo2FB[] = {
+    FIELD_VALUE(XrFaceTrackerCreateInfo2FB, type),
+    FIELD_XR(XrFaceTrackerCreateInfo2FB, next),
+    FIELD_VALUE(XrFaceTrackerCreateInfo2FB, faceExpressionSet),
+    FIELD_VALUE(XrFaceTrackerCreateInfo2FB, requestedDataSourceCount),
+    FIELD_PTR(XrFaceTrackerCreateInfo2FB, requestedDataSources, requestedDataSourceCount),
+};
+
+void serialize(const XrFaceTrackerCreateInfo2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFaceTrackerCreateInfo2FB, ctx);
+}
+
+void deserialize(XrFaceTrackerCreateInfo2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFaceTrackerCreateInfo2FB, ctx);
+}
+
+void cleanup(const XrFaceTrackerCreateInfo2FB* s) {
+    cleanup_fields(s, fields_XrFaceTrackerCreateInfo2FB);
+}
+
+constexpr FieldDescriptor fields_XrSystemFaceTrackingProperties2FB[] = {
+    FIELD_VALUE(XrSystemFaceTrackingProperties2FB, type),
+    FIELD_XR(XrSystemFaceTrackingProperties2FB, next),
+    FIELD_VALUE(XrSystemFaceTrackingProperties2FB, supportsVisualFaceTracking),
+    FIELD_VALUE(XrSystemFaceTrackingProperties2FB, supportsAudioFaceTracking),
+};
+
+void serialize(const XrSystemFaceTrackingProperties2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFaceTrackingProperties2FB, ctx);
+}
+
+void deserialize(XrSystemFaceTrackingProperties2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFaceTrackingProperties2FB, ctx);
+}
+
+void cleanup(const XrSystemFaceTrackingProperties2FB* s) {
+    cleanup_fields(s, fields_XrSystemFaceTrackingProperties2FB);
+}
+
+constexpr FieldDescriptor fields_XrSystemFaceTrackingProperties2FB[] = {
+    FIELD_VALUE(XrSystemFaceTrackingProperties2FB, type),
+    FIELD_XR(XrSystemFaceTrackingProperties2FB, next),
+    FIELD_VALUE(XrSystemFaceTrackingProperties2FB, supportsVisualFaceTracking),
+    FIELD_VALUE(XrSystemFaceTrackingProperties2FB, supportsAudioFaceTracking),
+};
+
+void serialize(const XrSystemFaceTrackingProperties2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFaceTrackingProperties2FB, ctx);
+}
+
+void deserialize(XrSystemFaceTrackingProperties2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFaceTrackingProperties2FB, ctx);
+}
+
+void cleanup(const XrSystemFaceTrackingProperties2FB* s) {
+    cleanup_fields(s, fields_XrSystemFaceTrackingProperties2FB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking2
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation
+constexpr FieldDescriptor fields_XrFoveationProfileCreateInfoFB[] = {
+    FIELD_VALUE(XrFoveationProfileCreateInfoFB, type),
+    FIELD_XR(XrFoveationProfileCreateInfoFB, next),
+};
+
+void serialize(const XrFoveationProfileCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationProfileCreateInfoFB, ctx);
+}
+
+void deserialize(XrFoveationProfileCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationProfileCreateInfoFB, ctx);
+}
+
+void cleanup(const XrFoveationProfileCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrFoveationProfileCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrFoveationProfileCreateInfoFB[] = {
+    FIELD_VALUE(XrFoveationProfileCreateInfoFB, type),
+    FIELD_XR(XrFoveationProfileCreateInfoFB, next),
+};
+
+void serialize(const XrFoveationProfileCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationProfileCreateInfoFB, ctx);
+}
+
+void deserialize(XrFoveationProfileCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationProfileCreateInfoFB, ctx);
+}
+
+void cleanup(const XrFoveationProfileCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrFoveationProfileCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainCreateInfoFoveationFB[] = {
+    FIELD_VALUE(XrSwapchainCreateInfoFoveationFB, type),
+    FIELD_XR(XrSwapchainCreateInfoFoveationFB, next),
+    FIELD_VALUE(XrSwapchainCreateInfoFoveationFB, flags),
+};
+
+void serialize(const XrSwapchainCreateInfoFoveationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainCreateInfoFoveationFB, ctx);
+}
+
+void deserialize(XrSwapchainCreateInfoFoveationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainCreateInfoFoveationFB, ctx);
+}
+
+void cleanup(const XrSwapchainCreateInfoFoveationFB* s) {
+    cleanup_fields(s, fields_XrSwapchainCreateInfoFoveationFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainCreateInfoFoveationFB[] = {
+    FIELD_VALUE(XrSwapchainCreateInfoFoveationFB, type),
+    FIELD_XR(XrSwapchainCreateInfoFoveationFB, next),
+    FIELD_VALUE(XrSwapchainCreateInfoFoveationFB, flags),
+};
+
+void serialize(const XrSwapchainCreateInfoFoveationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainCreateInfoFoveationFB, ctx);
+}
+
+void deserialize(XrSwapchainCreateInfoFoveationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainCreateInfoFoveationFB, ctx);
+}
+
+void cleanup(const XrSwapchainCreateInfoFoveationFB* s) {
+    cleanup_fields(s, fields_XrSwapchainCreateInfoFoveationFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainStateFoveationFB[] = {
+    FIELD_VALUE(XrSwapchainStateFoveationFB, type),
+    FIELD_XR(XrSwapchainStateFoveationFB, next),
+    FIELD_VALUE(XrSwapchainStateFoveationFB, flags),
+    FIELD_VALUE(XrSwapchainStateFoveationFB, profile),
+};
+
+void serialize(const XrSwapchainStateFoveationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateFoveationFB, ctx);
+}
+
+void deserialize(XrSwapchainStateFoveationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateFoveationFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateFoveationFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateFoveationFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainStateFoveationFB[] = {
+    FIELD_VALUE(XrSwapchainStateFoveationFB, type),
+    FIELD_XR(XrSwapchainStateFoveationFB, next),
+    FIELD_VALUE(XrSwapchainStateFoveationFB, flags),
+    FIELD_VALUE(XrSwapchainStateFoveationFB, profile),
+};
+
+void serialize(const XrSwapchainStateFoveationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateFoveationFB, ctx);
+}
+
+void deserialize(XrSwapchainStateFoveationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateFoveationFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateFoveationFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateFoveationFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_foveation
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation_configuration
+constexpr FieldDescriptor fields_XrFoveationLevelProfileCreateInfoFB[] = {
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, type),
+    FIELD_XR(XrFoveationLevelProfileCreateInfoFB, next),
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, level),
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, verticalOffset),
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, dynamic),
+};
+
+void serialize(const XrFoveationLevelProfileCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationLevelProfileCreateInfoFB, ctx);
+}
+
+void deserialize(XrFoveationLevelProfileCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationLevelProfileCreateInfoFB, ctx);
+}
+
+void cleanup(const XrFoveationLevelProfileCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrFoveationLevelProfileCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrFoveationLevelProfileCreateInfoFB[] = {
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, type),
+    FIELD_XR(XrFoveationLevelProfileCreateInfoFB, next),
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, level),
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, verticalOffset),
+    FIELD_VALUE(XrFoveationLevelProfileCreateInfoFB, dynamic),
+};
+
+void serialize(const XrFoveationLevelProfileCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationLevelProfileCreateInfoFB, ctx);
+}
+
+void deserialize(XrFoveationLevelProfileCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationLevelProfileCreateInfoFB, ctx);
+}
+
+void cleanup(const XrFoveationLevelProfileCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrFoveationLevelProfileCreateInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_foveation_configuration
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation_vulkan
+constexpr FieldDescriptor fields_XrSwapchainImageFoveationVulkanFB[] = {
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, type),
+    FIELD_XR(XrSwapchainImageFoveationVulkanFB, next),
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, image),
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, width),
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, height),
+};
+
+void serialize(const XrSwapchainImageFoveationVulkanFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageFoveationVulkanFB, ctx);
+}
+
+void deserialize(XrSwapchainImageFoveationVulkanFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageFoveationVulkanFB, ctx);
+}
+
+void cleanup(const XrSwapchainImageFoveationVulkanFB* s) {
+    cleanup_fields(s, fields_XrSwapchainImageFoveationVulkanFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageFoveationVulkanFB[] = {
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, type),
+    FIELD_XR(XrSwapchainImageFoveationVulkanFB, next),
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, image),
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, width),
+    FIELD_VALUE(XrSwapchainImageFoveationVulkanFB, height),
+};
+
+void serialize(const XrSwapchainImageFoveationVulkanFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageFoveationVulkanFB, ctx);
+}
+
+void deserialize(XrSwapchainImageFoveationVulkanFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageFoveationVulkanFB, ctx);
+}
+
+void cleanup(const XrSwapchainImageFoveationVulkanFB* s) {
+    cleanup_fields(s, fields_XrSwapchainImageFoveationVulkanFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_foveation_vulkan
+#ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_aim
+constexpr FieldDescriptor fields_XrHandTrackingAimStateFB[] = {
+    FIELD_VALUE(XrHandTrackingAimStateFB, type),
+    FIELD_XR(XrHandTrackingAimStateFB, next),
+    FIELD_VALUE(XrHandTrackingAimStateFB, status),
+    FIELD_VALUE(XrHandTrackingAimStateFB, aimPose),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthIndex),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthMiddle),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthRing),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthLittle),
+};
+
+void serialize(const XrHandTrackingAimStateFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingAimStateFB, ctx);
+}
+
+void deserialize(XrHandTrackingAimStateFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingAimStateFB, ctx);
+}
+
+void cleanup(const XrHandTrackingAimStateFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingAimStateFB);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingAimStateFB[] = {
+    FIELD_VALUE(XrHandTrackingAimStateFB, type),
+    FIELD_XR(XrHandTrackingAimStateFB, next),
+    FIELD_VALUE(XrHandTrackingAimStateFB, status),
+    FIELD_VALUE(XrHandTrackingAimStateFB, aimPose),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthIndex),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthMiddle),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthRing),
+    FIELD_VALUE(XrHandTrackingAimStateFB, pinchStrengthLittle),
+};
+
+void serialize(const XrHandTrackingAimStateFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingAimStateFB, ctx);
+}
+
+void deserialize(XrHandTrackingAimStateFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingAimStateFB, ctx);
+}
+
+void cleanup(const XrHandTrackingAimStateFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingAimStateFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_aim
+#ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules
+constexpr FieldDescriptor fields_XrHandCapsuleFB[] = {
+    FIELD_ARRAY(XrHandCapsuleFB, points),
+    FIELD_VALUE(XrHandCapsuleFB, radius),
+    FIELD_VALUE(XrHandCapsuleFB, joint),
+};
+
+void serialize(const XrHandCapsuleFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandCapsuleFB, ctx);
+}
+
+void deserialize(XrHandCapsuleFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandCapsuleFB, ctx);
+}
+
+void cleanup(const XrHandCapsuleFB* s) {
+    cleanup_fields(s, fields_XrHandCapsuleFB);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingCapsulesStateFB[] = {
+    FIELD_VALUE(XrHandTrackingCapsulesStateFB, type),
+    FIELD_XR(XrHandTrackingCapsulesStateFB, next),
+    FIELD_ARRAY(XrHandTrackingCapsulesStateFB, capsules),
+};
+
+void serialize(const XrHandTrackingCapsulesStateFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingCapsulesStateFB, ctx);
+}
+
+void deserialize(XrHandTrackingCapsulesStateFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingCapsulesStateFB, ctx);
+}
+
+void cleanup(const XrHandTrackingCapsulesStateFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingCapsulesStateFB);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingCapsulesStateFB[] = {
+    FIELD_VALUE(XrHandTrackingCapsulesStateFB, type),
+    FIELD_XR(XrHandTrackingCapsulesStateFB, next),
+    FIELD_ARRAY(XrHandTrackingCapsulesStateFB, capsules),
+};
+
+void serialize(const XrHandTrackingCapsulesStateFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingCapsulesStateFB, ctx);
+}
+
+void deserialize(XrHandTrackingCapsulesStateFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingCapsulesStateFB, ctx);
+}
+
+void cleanup(const XrHandTrackingCapsulesStateFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingCapsulesStateFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_capsules
+#ifdef XRTRANSPORT_EXT_XR_FB_hand_tracking_mesh
+constexpr FieldDescriptor fields_XrHandTrackingMeshFB[] = {
+    FIELD_VALUE(XrHandTrackingMeshFB, type),
+    FIELD_XR(XrHandTrackingMeshFB, next),
+    FIELD_VALUE(XrHandTrackingMeshFB, jointCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, jointCountOutput),
+    FIELD_PTR(XrHandTrackingMeshFB, jointBindPoses, jointCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, jointRadii, jointCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, jointParents, jointCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, vertexCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, vertexCountOutput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexPositions, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexNormals, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexUVs, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexBlendIndices, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexBlendWeights, vertexCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, indexCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, indexCountOutput),
+    FIELD_PTR(XrHandTrackingMeshFB, indices, indexCapacityInput),
+};
+
+void serialize(const XrHandTrackingMeshFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingMeshFB, ctx);
+}
+
+void deserialize(XrHandTrackingMeshFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingMeshFB, ctx);
+}
+
+void cleanup(const XrHandTrackingMeshFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingMeshFB);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingMeshFB[] = {
+    FIELD_VALUE(XrHandTrackingMeshFB, type),
+    FIELD_XR(XrHandTrackingMeshFB, next),
+    FIELD_VALUE(XrHandTrackingMeshFB, jointCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, jointCountOutput),
+    FIELD_PTR(XrHandTrackingMeshFB, jointBindPoses, jointCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, jointRadii, jointCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, jointParents, jointCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, vertexCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, vertexCountOutput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexPositions, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexNormals, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexUVs, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexBlendIndices, vertexCapacityInput),
+    FIELD_PTR(XrHandTrackingMeshFB, vertexBlendWeights, vertexCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, indexCapacityInput),
+    FIELD_VALUE(XrHandTrackingMeshFB, indexCountOutput),
+    FIELD_PTR(XrHandTrackingMeshFB, indices, indexCapacityInput),
+};
+
+void serialize(const XrHandTrackingMeshFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingMeshFB, ctx);
+}
+
+void deserialize(XrHandTrackingMeshFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingMeshFB, ctx);
+}
+
+void cleanup(const XrHandTrackingMeshFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingMeshFB);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingScaleFB[] = {
+    FIELD_VALUE(XrHandTrackingScaleFB, type),
+    FIELD_XR(XrHandTrackingScaleFB, next),
+    FIELD_VALUE(XrHandTrackingScaleFB, sensorOutput),
+    FIELD_VALUE(XrHandTrackingScaleFB, currentOutput),
+    FIELD_VALUE(XrHandTrackingScaleFB, overrideHandScale),
+    FIELD_VALUE(XrHandTrackingScaleFB, overrideValueInput),
+};
+
+void serialize(const XrHandTrackingScaleFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingScaleFB, ctx);
+}
+
+void deserialize(XrHandTrackingScaleFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingScaleFB, ctx);
+}
+
+void cleanup(const XrHandTrackingScaleFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingScaleFB);
+}
+
+constexpr FieldDescriptor fields_XrHandTrackingScaleFB[] = {
+    FIELD_VALUE(XrHandTrackingScaleFB, type),
+    FIELD_XR(XrHandTrackingScaleFB, next),
+    FIELD_VALUE(XrHandTrackingScaleFB, sensorOutput),
+    FIELD_VALUE(XrHandTrackingScaleFB, currentOutput),
+    FIELD_VALUE(XrHandTrackingScaleFB, overrideHandScale),
+    FIELD_VALUE(XrHandTrackingScaleFB, overrideValueInput),
+};
+
+void serialize(const XrHandTrackingScaleFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandTrackingScaleFB, ctx);
+}
+
+void deserialize(XrHandTrackingScaleFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandTrackingScaleFB, ctx);
+}
+
+void cleanup(const XrHandTrackingScaleFB* s) {
+    cleanup_fields(s, fields_XrHandTrackingScaleFB);
+}
+
+constexpr FieldDescriptor fields_XrVector4sFB[] = {
+    FIELD_VALUE(XrVector4sFB, x),
+    FIELD_VALUE(XrVector4sFB, y),
+    FIELD_VALUE(XrVector4sFB, z),
+    FIELD_VALUE(XrVector4sFB, w),
+};
+
+void serialize(const XrVector4sFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVector4sFB, ctx);
+}
+
+void deserialize(XrVector4sFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVector4sFB, ctx);
+}
+
+void cleanup(const XrVector4sFB* s) {
+    cleanup_fields(s, fields_XrVector4sFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_hand_tracking_mesh
+#ifdef XRTRANSPORT_EXT_XR_FB_haptic_amplitude_envelope
+constexpr FieldDescriptor fields_XrHapticAmplitudeEnvelopeVibrationFB[] = {
+    FIELD_VALUE(XrHapticAmplitudeEnvelopeVibrationFB, type),
+    FIELD_XR(XrHapticAmplitudeEnvelopeVibrationFB, next),
+    FIELD_VALUE(XrHapticAmplitudeEnvelopeVibrationFB, duration),
+    FIELD_VALUE(XrHapticAmplitudeEnvelopeVibrationFB, amplitudeCount),
+    FIELD_PTR(XrHapticAmplitudeEnvelopeVibrationFB, amplitudes, amplitudeCount),
+};
+
+void serialize(const XrHapticAmplitudeEnvelopeVibrationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHapticAmplitudeEnvelopeVibrationFB, ctx);
+}
+
+void deserialize(XrHapticAmplitudeEnvelopeVibrationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticAmplitudeEnvelopeVibrationFB, ctx);
+}
+
+void cleanup(const XrHapticAmplitudeEnvelopeVibrationFB* s) {
+    cleanup_fields(s, fields_XrHapticAmplitudeEnvelopeVibrationFB);
+}
+
+constexpr FieldDescriptor fields_XrHapticAmplitudeEnvelopeVibrationFB[] = {
+    FIELD_VALUE(XrHapticAmplitudeEnvelopeVibrationFB, type),
+    FIELD_XR(XrHapticAmplitudeEnvelopeVibrationFB, next),
+    FIELD_VALUE(XrHapticAmplitudeEnvelopeVibrationFB, duration),
+    FIELD_VALUE(XrHapticAmplitudeEnvelopeVibrationFB, amplitudeCount),
+    FIELD_PTR(XrHapticAmplitudeEnvelopeVibrationFB, amplitudes, amplitudeCount),
+};
+
+void serialize(const XrHapticAmplitudeEnvelopeVibrationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHapticAmplitudeEnvelopeVibrationFB, ctx);
+}
+
+void deserialize(XrHapticAmplitudeEnvelopeVibrationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticAmplitudeEnvelopeVibrationFB, ctx);
+}
+
+void cleanup(const XrHapticAmplitudeEnvelopeVibrationFB* s) {
+    cleanup_fields(s, fields_XrHapticAmplitudeEnvelopeVibrationFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_haptic_amplitude_envelope
+#ifdef XRTRANSPORT_EXT_XR_FB_haptic_pcm
+constexpr FieldDescriptor fields_XrDevicePcmSampleRateStateFB[] = {
+    FIELD_VALUE(XrDevicePcmSampleRateStateFB, type),
+    FIELD_XR(XrDevicePcmSampleRateStateFB, next),
+    FIELD_VALUE(XrDevicePcmSampleRateStateFB, sampleRate),
+};
+
+void serialize(const XrDevicePcmSampleRateStateFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDevicePcmSampleRateStateFB, ctx);
+}
+
+void deserialize(XrDevicePcmSampleRateStateFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDevicePcmSampleRateStateFB, ctx);
+}
+
+void cleanup(const XrDevicePcmSampleRateStateFB* s) {
+    cleanup_fields(s, fields_XrDevicePcmSampleRateStateFB);
+}
+
+constexpr FieldDescriptor fields_XrDevicePcmSampleRateStateFB[] = {
+    FIELD_VALUE(XrDevicePcmSampleRateStateFB, type),
+    FIELD_XR(XrDevicePcmSampleRateStateFB, next),
+    FIELD_VALUE(XrDevicePcmSampleRateStateFB, sampleRate),
+};
+
+void serialize(const XrDevicePcmSampleRateStateFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDevicePcmSampleRateStateFB, ctx);
+}
+
+void deserialize(XrDevicePcmSampleRateStateFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDevicePcmSampleRateStateFB, ctx);
+}
+
+void cleanup(const XrDevicePcmSampleRateStateFB* s) {
+    cleanup_fields(s, fields_XrDevicePcmSampleRateStateFB);
+}
+
+constexpr FieldDescriptor fields_XrHapticPcmVibrationFB[] = {
+    FIELD_VALUE(XrHapticPcmVibrationFB, type),
+    FIELD_XR(XrHapticPcmVibrationFB, next),
+    FIELD_VALUE(XrHapticPcmVibrationFB, bufferSize),
+    FIELD_PTR(XrHapticPcmVibrationFB, buffer, bufferSize),
+    FIELD_VALUE(XrHapticPcmVibrationFB, sampleRate),
+    FIELD_VALUE(XrHapticPcmVibrationFB, append),
+    FIELD_SINGLE_PTR(XrHapticPcmVibrationFB, samplesConsumed),
+};
+
+void serialize(const XrHapticPcmVibrationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHapticPcmVibrationFB, ctx);
+}
+
+void deserialize(XrHapticPcmVibrationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticPcmVibrationFB, ctx);
+}
+
+void cleanup(const XrHapticPcmVibrationFB* s) {
+    cleanup_fields(s, fields_XrHapticPcmVibrationFB);
+}
+
+constexpr FieldDescriptor fields_XrHapticPcmVibrationFB[] = {
+    FIELD_VALUE(XrHapticPcmVibrationFB, type),
+    FIELD_XR(XrHapticPcmVibrationFB, next),
+    FIELD_VALUE(XrHapticPcmVibrationFB, bufferSize),
+    FIELD_PTR(XrHapticPcmVibrationFB, buffer, bufferSize),
+    FIELD_VALUE(XrHapticPcmVibrationFB, sampleRate),
+    FIELD_VALUE(XrHapticPcmVibrationFB, append),
+    FIELD_SINGLE_PTR(XrHapticPcmVibrationFB, samplesConsumed),
+};
+
+void serialize(const XrHapticPcmVibrationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHapticPcmVibrationFB, ctx);
+}
+
+void deserialize(XrHapticPcmVibrationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticPcmVibrationFB, ctx);
+}
+
+void cleanup(const XrHapticPcmVibrationFB* s) {
+    cleanup_fields(s, fields_XrHapticPcmVibrationFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_haptic_pcm
+#ifdef XRTRANSPORT_EXT_XR_FB_keyboard_tracking
+constexpr FieldDescriptor fields_XrKeyboardSpaceCreateInfoFB[] = {
+    FIELD_VALUE(XrKeyboardSpaceCreateInfoFB, type),
+    FIELD_XR(XrKeyboardSpaceCreateInfoFB, next),
+    FIELD_VALUE(XrKeyboardSpaceCreateInfoFB, trackedKeyboardId),
+};
+
+void serialize(const XrKeyboardSpaceCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrKeyboardSpaceCreateInfoFB, ctx);
+}
+
+void deserialize(XrKeyboardSpaceCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrKeyboardSpaceCreateInfoFB, ctx);
+}
+
+void cleanup(const XrKeyboardSpaceCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrKeyboardSpaceCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrKeyboardSpaceCreateInfoFB[] = {
+    FIELD_VALUE(XrKeyboardSpaceCreateInfoFB, type),
+    FIELD_XR(XrKeyboardSpaceCreateInfoFB, next),
+    FIELD_VALUE(XrKeyboardSpaceCreateInfoFB, trackedKeyboardId),
+};
+
+void serialize(const XrKeyboardSpaceCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrKeyboardSpaceCreateInfoFB, ctx);
+}
+
+void deserialize(XrKeyboardSpaceCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrKeyboardSpaceCreateInfoFB, ctx);
+}
+
+void cleanup(const XrKeyboardSpaceCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrKeyboardSpaceCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrKeyboardTrackingDescriptionFB[] = {
+    FIELD_VALUE(XrKeyboardTrackingDescriptionFB, trackedKeyboardId),
+    FIELD_VALUE(XrKeyboardTrackingDescriptionFB, size),
+    FIELD_VALUE(XrKeyboardTrackingDescriptionFB, flags),
+    FIELD_STRING_ARRAY(XrKeyboardTrackingDescriptionFB, name),
+};
+
+void serialize(const XrKeyboardTrackingDescriptionFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrKeyboardTrackingDescriptionFB, ctx);
+}
+
+void deserialize(XrKeyboardTrackingDescriptionFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrKeyboardTrackingDescriptionFB, ctx);
+}
+
+void cleanup(const XrKeyboardTrackingDescriptionFB* s) {
+    cleanup_fields(s, fields_XrKeyboardTrackingDescriptionFB);
+}
+
+constexpr FieldDescriptor fields_XrKeyboardTrackingQueryFB[] = {
+    FIELD_VALUE(XrKeyboardTrackingQueryFB, type),
+    FIELD_XR(XrKeyboardTrackingQueryFB, next),
+    FIELD_VALUE(XrKeyboardTrackingQueryFB, flags),
+};
+
+void serialize(const XrKeyboardTrackingQueryFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrKeyboardTrackingQueryFB, ctx);
+}
+
+void deserialize(XrKeyboardTrackingQueryFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrKeyboardTrackingQueryFB, ctx);
+}
+
+void cleanup(const XrKeyboardTrackingQueryFB* s) {
+    cleanup_fields(s, fields_XrKeyboardTrackingQueryFB);
+}
+
+constexpr FieldDescriptor fields_XrKeyboardTrackingQueryFB[] = {
+    FIELD_VALUE(XrKeyboardTrackingQueryFB, type),
+    FIELD_XR(XrKeyboardTrackingQueryFB, next),
+    FIELD_VALUE(XrKeyboardTrackingQueryFB, flags),
+};
+
+void serialize(const XrKeyboardTrackingQueryFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrKeyboardTrackingQueryFB, ctx);
+}
+
+void deserialize(XrKeyboardTrackingQueryFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrKeyboardTrackingQueryFB, ctx);
+}
+
+void cleanup(const XrKeyboardTrackingQueryFB* s) {
+    cleanup_fields(s, fields_XrKeyboardTrackingQueryFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemKeyboardTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemKeyboardTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemKeyboardTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemKeyboardTrackingPropertiesFB, supportsKeyboardTracking),
+};
+
+void serialize(const XrSystemKeyboardTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemKeyboardTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemKeyboardTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemKeyboardTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemKeyboardTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemKeyboardTrackingPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemKeyboardTrackingPropertiesFB[] = {
+    FIELD_VALUE(XrSystemKeyboardTrackingPropertiesFB, type),
+    FIELD_XR(XrSystemKeyboardTrackingPropertiesFB, next),
+    FIELD_VALUE(XrSystemKeyboardTrackingPropertiesFB, supportsKeyboardTracking),
+};
+
+void serialize(const XrSystemKeyboardTrackingPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemKeyboardTrackingPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemKeyboardTrackingPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemKeyboardTrackingPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemKeyboardTrackingPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemKeyboardTrackingPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_keyboard_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_passthrough
+constexpr FieldDescriptor fields_XrCompositionLayerPassthroughFB[] = {
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, type),
+    FIELD_XR(XrCompositionLayerPassthroughFB, next),
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, flags),
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, space),
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, layerHandle),
+};
+
+void serialize(const XrCompositionLayerPassthroughFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerPassthroughFB, ctx);
+}
+
+void deserialize(XrCompositionLayerPassthroughFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerPassthroughFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerPassthroughFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerPassthroughFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerPassthroughFB[] = {
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, type),
+    FIELD_XR(XrCompositionLayerPassthroughFB, next),
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, flags),
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, space),
+    FIELD_VALUE(XrCompositionLayerPassthroughFB, layerHandle),
+};
+
+void serialize(const XrCompositionLayerPassthroughFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerPassthroughFB, ctx);
+}
+
+void deserialize(XrCompositionLayerPassthroughFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerPassthroughFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerPassthroughFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerPassthroughFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataPassthroughStateChangedFB[] = {
+    FIELD_VALUE(XrEventDataPassthroughStateChangedFB, type),
+    FIELD_XR(XrEventDataPassthroughStateChangedFB, next),
+    FIELD_VALUE(XrEventDataPassthroughStateChangedFB, flags),
+};
+
+void serialize(const XrEventDataPassthroughStateChangedFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataPassthroughStateChangedFB, ctx);
+}
+
+void deserialize(XrEventDataPassthroughStateChangedFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataPassthroughStateChangedFB, ctx);
+}
+
+void cleanup(const XrEventDataPassthroughStateChangedFB* s) {
+    cleanup_fields(s, fields_XrEventDataPassthroughStateChangedFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataPassthroughStateChangedFB[] = {
+    FIELD_VALUE(XrEventDataPassthroughStateChangedFB, type),
+    FIELD_XR(XrEventDataPassthroughStateChangedFB, next),
+    FIELD_VALUE(XrEventDataPassthroughStateChangedFB, flags),
+};
+
+void serialize(const XrEventDataPassthroughStateChangedFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataPassthroughStateChangedFB, ctx);
+}
+
+void deserialize(XrEventDataPassthroughStateChangedFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataPassthroughStateChangedFB, ctx);
+}
+
+void cleanup(const XrEventDataPassthroughStateChangedFB* s) {
+    cleanup_fields(s, fields_XrEventDataPassthroughStateChangedFB);
+}
+
+constexpr FieldDescriptor fields_XrGeometryInstanceCreateInfoFB[] = {
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, type),
+    FIELD_XR(XrGeometryInstanceCreateInfoFB, next),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, layer),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, mesh),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, baseSpace),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, pose),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, scale),
+};
+
+void serialize(const XrGeometryInstanceCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGeometryInstanceCreateInfoFB, ctx);
+}
+
+void deserialize(XrGeometryInstanceCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGeometryInstanceCreateInfoFB, ctx);
+}
+
+void cleanup(const XrGeometryInstanceCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrGeometryInstanceCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrGeometryInstanceCreateInfoFB[] = {
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, type),
+    FIELD_XR(XrGeometryInstanceCreateInfoFB, next),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, layer),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, mesh),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, baseSpace),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, pose),
+    FIELD_VALUE(XrGeometryInstanceCreateInfoFB, scale),
+};
+
+void serialize(const XrGeometryInstanceCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGeometryInstanceCreateInfoFB, ctx);
+}
+
+void deserialize(XrGeometryInstanceCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGeometryInstanceCreateInfoFB, ctx);
+}
+
+void cleanup(const XrGeometryInstanceCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrGeometryInstanceCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrGeometryInstanceTransformFB[] = {
+    FIELD_VALUE(XrGeometryInstanceTransformFB, type),
+    FIELD_XR(XrGeometryInstanceTransformFB, next),
+    FIELD_VALUE(XrGeometryInstanceTransformFB, baseSpace),
+    FIELD_TIME(XrGeometryInstanceTransformFB, time),
+    FIELD_VALUE(XrGeometryInstanceTransformFB, pose),
+    FIELD_VALUE(XrGeometryInstanceTransformFB, scale),
+};
+
+void serialize(const XrGeometryInstanceTransformFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGeometryInstanceTransformFB, ctx);
+}
+
+void deserialize(XrGeometryInstanceTransformFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGeometryInstanceTransformFB, ctx);
+}
+
+void cleanup(const XrGeometryInstanceTransformFB* s) {
+    cleanup_fields(s, fields_XrGeometryInstanceTransformFB);
+}
+
+constexpr FieldDescriptor fields_XrGeometryInstanceTransformFB[] = {
+    FIELD_VALUE(XrGeometryInstanceTransformFB, type),
+    FIELD_XR(XrGeometryInstanceTransformFB, next),
+    FIELD_VALUE(XrGeometryInstanceTransformFB, baseSpace),
+    FIELD_TIME(XrGeometryInstanceTransformFB, time),
+    FIELD_VALUE(XrGeometryInstanceTransformFB, pose),
+    FIELD_VALUE(XrGeometryInstanceTransformFB, scale),
+};
+
+void serialize(const XrGeometryInstanceTransformFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGeometryInstanceTransformFB, ctx);
+}
+
+void deserialize(XrGeometryInstanceTransformFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGeometryInstanceTransformFB, ctx);
+}
+
+void cleanup(const XrGeometryInstanceTransformFB* s) {
+    cleanup_fields(s, fields_XrGeometryInstanceTransformFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughBrightnessContrastSaturationFB[] = {
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, type),
+    FIELD_XR(XrPassthroughBrightnessContrastSaturationFB, next),
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, brightness),
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, contrast),
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, saturation),
+};
+
+void serialize(const XrPassthroughBrightnessContrastSaturationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughBrightnessContrastSaturationFB, ctx);
+}
+
+void deserialize(XrPassthroughBrightnessContrastSaturationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughBrightnessContrastSaturationFB, ctx);
+}
+
+void cleanup(const XrPassthroughBrightnessContrastSaturationFB* s) {
+    cleanup_fields(s, fields_XrPassthroughBrightnessContrastSaturationFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughBrightnessContrastSaturationFB[] = {
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, type),
+    FIELD_XR(XrPassthroughBrightnessContrastSaturationFB, next),
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, brightness),
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, contrast),
+    FIELD_VALUE(XrPassthroughBrightnessContrastSaturationFB, saturation),
+};
+
+void serialize(const XrPassthroughBrightnessContrastSaturationFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughBrightnessContrastSaturationFB, ctx);
+}
+
+void deserialize(XrPassthroughBrightnessContrastSaturationFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughBrightnessContrastSaturationFB, ctx);
+}
+
+void cleanup(const XrPassthroughBrightnessContrastSaturationFB* s) {
+    cleanup_fields(s, fields_XrPassthroughBrightnessContrastSaturationFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapMonoToMonoFB[] = {
+    FIELD_VALUE(XrPassthroughColorMapMonoToMonoFB, type),
+    FIELD_XR(XrPassthroughColorMapMonoToMonoFB, next),
+    FIELD_ARRAY(XrPassthroughColorMapMonoToMonoFB, textureColorMap),
+};
+
+void serialize(const XrPassthroughColorMapMonoToMonoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapMonoToMonoFB, ctx);
+}
+
+void deserialize(XrPassthroughColorMapMonoToMonoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapMonoToMonoFB, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapMonoToMonoFB* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapMonoToMonoFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapMonoToMonoFB[] = {
+    FIELD_VALUE(XrPassthroughColorMapMonoToMonoFB, type),
+    FIELD_XR(XrPassthroughColorMapMonoToMonoFB, next),
+    FIELD_ARRAY(XrPassthroughColorMapMonoToMonoFB, textureColorMap),
+};
+
+void serialize(const XrPassthroughColorMapMonoToMonoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapMonoToMonoFB, ctx);
+}
+
+void deserialize(XrPassthroughColorMapMonoToMonoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapMonoToMonoFB, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapMonoToMonoFB* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapMonoToMonoFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapMonoToRgbaFB[] = {
+    FIELD_VALUE(XrPassthroughColorMapMonoToRgbaFB, type),
+    FIELD_XR(XrPassthroughColorMapMonoToRgbaFB, next),
+    FIELD_ARRAY(XrPassthroughColorMapMonoToRgbaFB, textureColorMap),
+};
+
+void serialize(const XrPassthroughColorMapMonoToRgbaFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapMonoToRgbaFB, ctx);
+}
+
+void deserialize(XrPassthroughColorMapMonoToRgbaFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapMonoToRgbaFB, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapMonoToRgbaFB* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapMonoToRgbaFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapMonoToRgbaFB[] = {
+    FIELD_VALUE(XrPassthroughColorMapMonoToRgbaFB, type),
+    FIELD_XR(XrPassthroughColorMapMonoToRgbaFB, next),
+    FIELD_ARRAY(XrPassthroughColorMapMonoToRgbaFB, textureColorMap),
+};
+
+void serialize(const XrPassthroughColorMapMonoToRgbaFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapMonoToRgbaFB, ctx);
+}
+
+void deserialize(XrPassthroughColorMapMonoToRgbaFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapMonoToRgbaFB, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapMonoToRgbaFB* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapMonoToRgbaFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughCreateInfoFB[] = {
+    FIELD_VALUE(XrPassthroughCreateInfoFB, type),
+    FIELD_XR(XrPassthroughCreateInfoFB, next),
+    FIELD_VALUE(XrPassthroughCreateInfoFB, flags),
+};
+
+void serialize(const XrPassthroughCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughCreateInfoFB, ctx);
+}
+
+void deserialize(XrPassthroughCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughCreateInfoFB, ctx);
+}
+
+void cleanup(const XrPassthroughCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrPassthroughCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughCreateInfoFB[] = {
+    FIELD_VALUE(XrPassthroughCreateInfoFB, type),
+    FIELD_XR(XrPassthroughCreateInfoFB, next),
+    FIELD_VALUE(XrPassthroughCreateInfoFB, flags),
+};
+
+void serialize(const XrPassthroughCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughCreateInfoFB, ctx);
+}
+
+void deserialize(XrPassthroughCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughCreateInfoFB, ctx);
+}
+
+void cleanup(const XrPassthroughCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrPassthroughCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughLayerCreateInfoFB[] = {
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, type),
+    FIELD_XR(XrPassthroughLayerCreateInfoFB, next),
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, passthrough),
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, flags),
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, purpose),
+};
+
+void serialize(const XrPassthroughLayerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughLayerCreateInfoFB, ctx);
+}
+
+void deserialize(XrPassthroughLayerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughLayerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrPassthroughLayerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrPassthroughLayerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughLayerCreateInfoFB[] = {
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, type),
+    FIELD_XR(XrPassthroughLayerCreateInfoFB, next),
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, passthrough),
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, flags),
+    FIELD_VALUE(XrPassthroughLayerCreateInfoFB, purpose),
+};
+
+void serialize(const XrPassthroughLayerCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughLayerCreateInfoFB, ctx);
+}
+
+void deserialize(XrPassthroughLayerCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughLayerCreateInfoFB, ctx);
+}
+
+void cleanup(const XrPassthroughLayerCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrPassthroughLayerCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughStyleFB[] = {
+    FIELD_VALUE(XrPassthroughStyleFB, type),
+    FIELD_XR(XrPassthroughStyleFB, next),
+    FIELD_VALUE(XrPassthroughStyleFB, textureOpacityFactor),
+    FIELD_VALUE(XrPassthroughStyleFB, edgeColor),
+};
+
+void serialize(const XrPassthroughStyleFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughStyleFB, ctx);
+}
+
+void deserialize(XrPassthroughStyleFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughStyleFB, ctx);
+}
+
+void cleanup(const XrPassthroughStyleFB* s) {
+    cleanup_fields(s, fields_XrPassthroughStyleFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughStyleFB[] = {
+    FIELD_VALUE(XrPassthroughStyleFB, type),
+    FIELD_XR(XrPassthroughStyleFB, next),
+    FIELD_VALUE(XrPassthroughStyleFB, textureOpacityFactor),
+    FIELD_VALUE(XrPassthroughStyleFB, edgeColor),
+};
+
+void serialize(const XrPassthroughStyleFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughStyleFB, ctx);
+}
+
+void deserialize(XrPassthroughStyleFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughStyleFB, ctx);
+}
+
+void cleanup(const XrPassthroughStyleFB* s) {
+    cleanup_fields(s, fields_XrPassthroughStyleFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemPassthroughProperties2FB[] = {
+    FIELD_VALUE(XrSystemPassthroughProperties2FB, type),
+    FIELD_XR(XrSystemPassthroughProperties2FB, next),
+    FIELD_VALUE(XrSystemPassthroughProperties2FB, capabilities),
+};
+
+void serialize(const XrSystemPassthroughProperties2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPassthroughProperties2FB, ctx);
+}
+
+void deserialize(XrSystemPassthroughProperties2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPassthroughProperties2FB, ctx);
+}
+
+void cleanup(const XrSystemPassthroughProperties2FB* s) {
+    cleanup_fields(s, fields_XrSystemPassthroughProperties2FB);
+}
+
+constexpr FieldDescriptor fields_XrSystemPassthroughProperties2FB[] = {
+    FIELD_VALUE(XrSystemPassthroughProperties2FB, type),
+    FIELD_XR(XrSystemPassthroughProperties2FB, next),
+    FIELD_VALUE(XrSystemPassthroughProperties2FB, capabilities),
+};
+
+void serialize(const XrSystemPassthroughProperties2FB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPassthroughProperties2FB, ctx);
+}
+
+void deserialize(XrSystemPassthroughProperties2FB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPassthroughProperties2FB, ctx);
+}
+
+void cleanup(const XrSystemPassthroughProperties2FB* s) {
+    cleanup_fields(s, fields_XrSystemPassthroughProperties2FB);
+}
+
+constexpr FieldDescriptor fields_XrSystemPassthroughPropertiesFB[] = {
+    FIELD_VALUE(XrSystemPassthroughPropertiesFB, type),
+    FIELD_XR(XrSystemPassthroughPropertiesFB, next),
+    FIELD_VALUE(XrSystemPassthroughPropertiesFB, supportsPassthrough),
+};
+
+void serialize(const XrSystemPassthroughPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPassthroughPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemPassthroughPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPassthroughPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemPassthroughPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemPassthroughPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemPassthroughPropertiesFB[] = {
+    FIELD_VALUE(XrSystemPassthroughPropertiesFB, type),
+    FIELD_XR(XrSystemPassthroughPropertiesFB, next),
+    FIELD_VALUE(XrSystemPassthroughPropertiesFB, supportsPassthrough),
+};
+
+void serialize(const XrSystemPassthroughPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPassthroughPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemPassthroughPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPassthroughPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemPassthroughPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemPassthroughPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_passthrough
+#ifdef XRTRANSPORT_EXT_XR_FB_passthrough_keyboard_hands
+constexpr FieldDescriptor fields_XrPassthroughKeyboardHandsIntensityFB[] = {
+    FIELD_VALUE(XrPassthroughKeyboardHandsIntensityFB, type),
+    FIELD_XR(XrPassthroughKeyboardHandsIntensityFB, next),
+    FIELD_VALUE(XrPassthroughKeyboardHandsIntensityFB, leftHandIntensity),
+    FIELD_VALUE(XrPassthroughKeyboardHandsIntensityFB, rightHandIntensity),
+};
+
+void serialize(const XrPassthroughKeyboardHandsIntensityFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughKeyboardHandsIntensityFB, ctx);
+}
+
+void deserialize(XrPassthroughKeyboardHandsIntensityFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughKeyboardHandsIntensityFB, ctx);
+}
+
+void cleanup(const XrPassthroughKeyboardHandsIntensityFB* s) {
+    cleanup_fields(s, fields_XrPassthroughKeyboardHandsIntensityFB);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughKeyboardHandsIntensityFB[] = {
+    FIELD_VALUE(XrPassthroughKeyboardHandsIntensityFB, type),
+    FIELD_XR(XrPassthroughKeyboardHandsIntensityFB, next),
+    FIELD_VALUE(XrPassthroughKeyboardHandsIntensityFB, leftHandIntensity),
+    FIELD_VALUE(XrPassthroughKeyboardHandsIntensityFB, rightHandIntensity),
+};
+
+void serialize(const XrPassthroughKeyboardHandsIntensityFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughKeyboardHandsIntensityFB, ctx);
+}
+
+void deserialize(XrPassthroughKeyboardHandsIntensityFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughKeyboardHandsIntensityFB, ctx);
+}
+
+void cleanup(const XrPassthroughKeyboardHandsIntensityFB* s) {
+    cleanup_fields(s, fields_XrPassthroughKeyboardHandsIntensityFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_passthrough_keyboard_hands
+#ifdef XRTRANSPORT_EXT_XR_FB_render_model
+constexpr FieldDescriptor fields_XrRenderModelBufferFB[] = {
+    FIELD_VALUE(XrRenderModelBufferFB, type),
+    FIELD_XR(XrRenderModelBufferFB, next),
+    FIELD_VALUE(XrRenderModelBufferFB, bufferCapacityInput),
+    FIELD_VALUE(XrRenderModelBufferFB, bufferCountOutput),
+    FIELD_PTR(XrRenderModelBufferFB, buffer, bufferCapacityInput),
+};
+
+void serialize(const XrRenderModelBufferFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelBufferFB, ctx);
+}
+
+void deserialize(XrRenderModelBufferFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelBufferFB, ctx);
+}
+
+void cleanup(const XrRenderModelBufferFB* s) {
+    cleanup_fields(s, fields_XrRenderModelBufferFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelBufferFB[] = {
+    FIELD_VALUE(XrRenderModelBufferFB, type),
+    FIELD_XR(XrRenderModelBufferFB, next),
+    FIELD_VALUE(XrRenderModelBufferFB, bufferCapacityInput),
+    FIELD_VALUE(XrRenderModelBufferFB, bufferCountOutput),
+    FIELD_PTR(XrRenderModelBufferFB, buffer, bufferCapacityInput),
+};
+
+void serialize(const XrRenderModelBufferFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelBufferFB, ctx);
+}
+
+void deserialize(XrRenderModelBufferFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelBufferFB, ctx);
+}
+
+void cleanup(const XrRenderModelBufferFB* s) {
+    cleanup_fields(s, fields_XrRenderModelBufferFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelCapabilitiesRequestFB[] = {
+    FIELD_VALUE(XrRenderModelCapabilitiesRequestFB, type),
+    FIELD_XR(XrRenderModelCapabilitiesRequestFB, next),
+    FIELD_VALUE(XrRenderModelCapabilitiesRequestFB, flags),
+};
+
+void serialize(const XrRenderModelCapabilitiesRequestFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelCapabilitiesRequestFB, ctx);
+}
+
+void deserialize(XrRenderModelCapabilitiesRequestFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelCapabilitiesRequestFB, ctx);
+}
+
+void cleanup(const XrRenderModelCapabilitiesRequestFB* s) {
+    cleanup_fields(s, fields_XrRenderModelCapabilitiesRequestFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelCapabilitiesRequestFB[] = {
+    FIELD_VALUE(XrRenderModelCapabilitiesRequestFB, type),
+    FIELD_XR(XrRenderModelCapabilitiesRequestFB, next),
+    FIELD_VALUE(XrRenderModelCapabilitiesRequestFB, flags),
+};
+
+void serialize(const XrRenderModelCapabilitiesRequestFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelCapabilitiesRequestFB, ctx);
+}
+
+void deserialize(XrRenderModelCapabilitiesRequestFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelCapabilitiesRequestFB, ctx);
+}
+
+void cleanup(const XrRenderModelCapabilitiesRequestFB* s) {
+    cleanup_fields(s, fields_XrRenderModelCapabilitiesRequestFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelLoadInfoFB[] = {
+    FIELD_VALUE(XrRenderModelLoadInfoFB, type),
+    FIELD_XR(XrRenderModelLoadInfoFB, next),
+    FIELD_VALUE(XrRenderModelLoadInfoFB, modelKey),
+};
+
+void serialize(const XrRenderModelLoadInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelLoadInfoFB, ctx);
+}
+
+void deserialize(XrRenderModelLoadInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelLoadInfoFB, ctx);
+}
+
+void cleanup(const XrRenderModelLoadInfoFB* s) {
+    cleanup_fields(s, fields_XrRenderModelLoadInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelLoadInfoFB[] = {
+    FIELD_VALUE(XrRenderModelLoadInfoFB, type),
+    FIELD_XR(XrRenderModelLoadInfoFB, next),
+    FIELD_VALUE(XrRenderModelLoadInfoFB, modelKey),
+};
+
+void serialize(const XrRenderModelLoadInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelLoadInfoFB, ctx);
+}
+
+void deserialize(XrRenderModelLoadInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelLoadInfoFB, ctx);
+}
+
+void cleanup(const XrRenderModelLoadInfoFB* s) {
+    cleanup_fields(s, fields_XrRenderModelLoadInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelPathInfoFB[] = {
+    FIELD_VALUE(XrRenderModelPathInfoFB, type),
+    FIELD_XR(XrRenderModelPathInfoFB, next),
+    FIELD_VALUE(XrRenderModelPathInfoFB, path),
+};
+
+void serialize(const XrRenderModelPathInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelPathInfoFB, ctx);
+}
+
+void deserialize(XrRenderModelPathInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelPathInfoFB, ctx);
+}
+
+void cleanup(const XrRenderModelPathInfoFB* s) {
+    cleanup_fields(s, fields_XrRenderModelPathInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelPathInfoFB[] = {
+    FIELD_VALUE(XrRenderModelPathInfoFB, type),
+    FIELD_XR(XrRenderModelPathInfoFB, next),
+    FIELD_VALUE(XrRenderModelPathInfoFB, path),
+};
+
+void serialize(const XrRenderModelPathInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelPathInfoFB, ctx);
+}
+
+void deserialize(XrRenderModelPathInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelPathInfoFB, ctx);
+}
+
+void cleanup(const XrRenderModelPathInfoFB* s) {
+    cleanup_fields(s, fields_XrRenderModelPathInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelPropertiesFB[] = {
+    FIELD_VALUE(XrRenderModelPropertiesFB, type),
+    FIELD_XR(XrRenderModelPropertiesFB, next),
+    FIELD_VALUE(XrRenderModelPropertiesFB, vendorId),
+    FIELD_STRING_ARRAY(XrRenderModelPropertiesFB, modelName),
+    FIELD_VALUE(XrRenderModelPropertiesFB, modelKey),
+    FIELD_VALUE(XrRenderModelPropertiesFB, modelVersion),
+    FIELD_VALUE(XrRenderModelPropertiesFB, flags),
+};
+
+void serialize(const XrRenderModelPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelPropertiesFB, ctx);
+}
+
+void deserialize(XrRenderModelPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelPropertiesFB, ctx);
+}
+
+void cleanup(const XrRenderModelPropertiesFB* s) {
+    cleanup_fields(s, fields_XrRenderModelPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrRenderModelPropertiesFB[] = {
+    FIELD_VALUE(XrRenderModelPropertiesFB, type),
+    FIELD_XR(XrRenderModelPropertiesFB, next),
+    FIELD_VALUE(XrRenderModelPropertiesFB, vendorId),
+    FIELD_STRING_ARRAY(XrRenderModelPropertiesFB, modelName),
+    FIELD_VALUE(XrRenderModelPropertiesFB, modelKey),
+    FIELD_VALUE(XrRenderModelPropertiesFB, modelVersion),
+    FIELD_VALUE(XrRenderModelPropertiesFB, flags),
+};
+
+void serialize(const XrRenderModelPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRenderModelPropertiesFB, ctx);
+}
+
+void deserialize(XrRenderModelPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRenderModelPropertiesFB, ctx);
+}
+
+void cleanup(const XrRenderModelPropertiesFB* s) {
+    cleanup_fields(s, fields_XrRenderModelPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemRenderModelPropertiesFB[] = {
+    FIELD_VALUE(XrSystemRenderModelPropertiesFB, type),
+    FIELD_XR(XrSystemRenderModelPropertiesFB, next),
+    FIELD_VALUE(XrSystemRenderModelPropertiesFB, supportsRenderModelLoading),
+};
+
+void serialize(const XrSystemRenderModelPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemRenderModelPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemRenderModelPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemRenderModelPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemRenderModelPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemRenderModelPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemRenderModelPropertiesFB[] = {
+    FIELD_VALUE(XrSystemRenderModelPropertiesFB, type),
+    FIELD_XR(XrSystemRenderModelPropertiesFB, next),
+    FIELD_VALUE(XrSystemRenderModelPropertiesFB, supportsRenderModelLoading),
+};
+
+void serialize(const XrSystemRenderModelPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemRenderModelPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemRenderModelPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemRenderModelPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemRenderModelPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemRenderModelPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_render_model
+#ifdef XRTRANSPORT_EXT_XR_FB_scene
+constexpr FieldDescriptor fields_XrBoundary2DFB[] = {
+    FIELD_VALUE(XrBoundary2DFB, type),
+    FIELD_XR(XrBoundary2DFB, next),
+    FIELD_VALUE(XrBoundary2DFB, vertexCapacityInput),
+    FIELD_VALUE(XrBoundary2DFB, vertexCountOutput),
+    FIELD_PTR(XrBoundary2DFB, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrBoundary2DFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBoundary2DFB, ctx);
+}
+
+void deserialize(XrBoundary2DFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBoundary2DFB, ctx);
+}
+
+void cleanup(const XrBoundary2DFB* s) {
+    cleanup_fields(s, fields_XrBoundary2DFB);
+}
+
+constexpr FieldDescriptor fields_XrBoundary2DFB[] = {
+    FIELD_VALUE(XrBoundary2DFB, type),
+    FIELD_XR(XrBoundary2DFB, next),
+    FIELD_VALUE(XrBoundary2DFB, vertexCapacityInput),
+    FIELD_VALUE(XrBoundary2DFB, vertexCountOutput),
+    FIELD_PTR(XrBoundary2DFB, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrBoundary2DFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBoundary2DFB, ctx);
+}
+
+void deserialize(XrBoundary2DFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBoundary2DFB, ctx);
+}
+
+void cleanup(const XrBoundary2DFB* s) {
+    cleanup_fields(s, fields_XrBoundary2DFB);
+}
+
+constexpr FieldDescriptor fields_XrOffset3DfFB[] = {
+    FIELD_VALUE(XrOffset3DfFB, x),
+    FIELD_VALUE(XrOffset3DfFB, y),
+    FIELD_VALUE(XrOffset3DfFB, z),
+};
+
+void serialize(const XrOffset3DfFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrOffset3DfFB, ctx);
+}
+
+void deserialize(XrOffset3DfFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrOffset3DfFB, ctx);
+}
+
+void cleanup(const XrOffset3DfFB* s) {
+    cleanup_fields(s, fields_XrOffset3DfFB);
+}
+
+constexpr FieldDescriptor fields_XrRect3DfFB[] = {
+    FIELD_VALUE(XrRect3DfFB, offset),
+    FIELD_VALUE(XrRect3DfFB, extent),
+};
+
+void serialize(const XrRect3DfFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRect3DfFB, ctx);
+}
+
+void deserialize(XrRect3DfFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRect3DfFB, ctx);
+}
+
+void cleanup(const XrRect3DfFB* s) {
+    cleanup_fields(s, fields_XrRect3DfFB);
+}
+
+constexpr FieldDescriptor fields_XrRoomLayoutFB[] = {
+    FIELD_VALUE(XrRoomLayoutFB, type),
+    FIELD_XR(XrRoomLayoutFB, next),
+    FIELD_VALUE(XrRoomLayoutFB, floorUuid),
+    FIELD_VALUE(XrRoomLayoutFB, ceilingUuid),
+    FIELD_VALUE(XrRoomLayoutFB, wallUuidCapacityInput),
+    FIELD_VALUE(XrRoomLayoutFB, wallUuidCountOutput),
+    FIELD_PTR(XrRoomLayoutFB, wallUuids, wallUuidCapacityInput),
+};
+
+void serialize(const XrRoomLayoutFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRoomLayoutFB, ctx);
+}
+
+void deserialize(XrRoomLayoutFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRoomLayoutFB, ctx);
+}
+
+void cleanup(const XrRoomLayoutFB* s) {
+    cleanup_fields(s, fields_XrRoomLayoutFB);
+}
+
+constexpr FieldDescriptor fields_XrRoomLayoutFB[] = {
+    FIELD_VALUE(XrRoomLayoutFB, type),
+    FIELD_XR(XrRoomLayoutFB, next),
+    FIELD_VALUE(XrRoomLayoutFB, floorUuid),
+    FIELD_VALUE(XrRoomLayoutFB, ceilingUuid),
+    FIELD_VALUE(XrRoomLayoutFB, wallUuidCapacityInput),
+    FIELD_VALUE(XrRoomLayoutFB, wallUuidCountOutput),
+    FIELD_PTR(XrRoomLayoutFB, wallUuids, wallUuidCapacityInput),
+};
+
+void serialize(const XrRoomLayoutFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRoomLayoutFB, ctx);
+}
+
+void deserialize(XrRoomLayoutFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRoomLayoutFB, ctx);
+}
+
+void cleanup(const XrRoomLayoutFB* s) {
+    cleanup_fields(s, fields_XrRoomLayoutFB);
+}
+
+constexpr FieldDescriptor fields_XrSemanticLabelsFB[] = {
+    FIELD_VALUE(XrSemanticLabelsFB, type),
+    FIELD_XR(XrSemanticLabelsFB, next),
+    FIELD_VALUE(XrSemanticLabelsFB, bufferCapacityInput),
+    FIELD_VALUE(XrSemanticLabelsFB, bufferCountOutput),
+    FIELD_PTR(XrSemanticLabelsFB, buffer, bufferCapacityInput),
+};
+
+void serialize(const XrSemanticLabelsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSemanticLabelsFB, ctx);
+}
+
+void deserialize(XrSemanticLabelsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSemanticLabelsFB, ctx);
+}
+
+void cleanup(const XrSemanticLabelsFB* s) {
+    cleanup_fields(s, fields_XrSemanticLabelsFB);
+}
+
+constexpr FieldDescriptor fields_XrSemanticLabelsFB[] = {
+    FIELD_VALUE(XrSemanticLabelsFB, type),
+    FIELD_XR(XrSemanticLabelsFB, next),
+    FIELD_VALUE(XrSemanticLabelsFB, bufferCapacityInput),
+    FIELD_VALUE(XrSemanticLabelsFB, bufferCountOutput),
+    FIELD_PTR(XrSemanticLabelsFB, buffer, bufferCapacityInput),
+};
+
+void serialize(const XrSemanticLabelsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSemanticLabelsFB, ctx);
+}
+
+void deserialize(XrSemanticLabelsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSemanticLabelsFB, ctx);
+}
+
+void cleanup(const XrSemanticLabelsFB* s) {
+    cleanup_fields(s, fields_XrSemanticLabelsFB);
+}
+
+constexpr FieldDescriptor fields_XrSemanticLabelsSupportInfoFB[] = {
+    FIELD_VALUE(XrSemanticLabelsSupportInfoFB, type),
+    FIELD_XR(XrSemanticLabelsSupportInfoFB, next),
+    FIELD_VALUE(XrSemanticLabelsSupportInfoFB, flags),
+    FIELD_STRING(XrSemanticLabelsSupportInfoFB, recognizedLabels),
+};
+
+void serialize(const XrSemanticLabelsSupportInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSemanticLabelsSupportInfoFB, ctx);
+}
+
+void deserialize(XrSemanticLabelsSupportInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSemanticLabelsSupportInfoFB, ctx);
+}
+
+void cleanup(const XrSemanticLabelsSupportInfoFB* s) {
+    cleanup_fields(s, fields_XrSemanticLabelsSupportInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSemanticLabelsSupportInfoFB[] = {
+    FIELD_VALUE(XrSemanticLabelsSupportInfoFB, type),
+    FIELD_XR(XrSemanticLabelsSupportInfoFB, next),
+    FIELD_VALUE(XrSemanticLabelsSupportInfoFB, flags),
+    FIELD_STRING(XrSemanticLabelsSupportInfoFB, recognizedLabels),
+};
+
+void serialize(const XrSemanticLabelsSupportInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSemanticLabelsSupportInfoFB, ctx);
+}
+
+void deserialize(XrSemanticLabelsSupportInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSemanticLabelsSupportInfoFB, ctx);
+}
+
+void cleanup(const XrSemanticLabelsSupportInfoFB* s) {
+    cleanup_fields(s, fields_XrSemanticLabelsSupportInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_scene
+#ifdef XRTRANSPORT_EXT_XR_FB_scene_capture
+constexpr FieldDescriptor fields_XrEventDataSceneCaptureCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSceneCaptureCompleteFB, type),
+    FIELD_XR(XrEventDataSceneCaptureCompleteFB, next),
+    FIELD_VALUE(XrEventDataSceneCaptureCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSceneCaptureCompleteFB, result),
+};
+
+void serialize(const XrEventDataSceneCaptureCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSceneCaptureCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSceneCaptureCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSceneCaptureCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSceneCaptureCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSceneCaptureCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSceneCaptureCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSceneCaptureCompleteFB, type),
+    FIELD_XR(XrEventDataSceneCaptureCompleteFB, next),
+    FIELD_VALUE(XrEventDataSceneCaptureCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSceneCaptureCompleteFB, result),
+};
+
+void serialize(const XrEventDataSceneCaptureCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSceneCaptureCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSceneCaptureCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSceneCaptureCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSceneCaptureCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSceneCaptureCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrSceneCaptureRequestInfoFB[] = {
+    FIELD_VALUE(XrSceneCaptureRequestInfoFB, type),
+    FIELD_XR(XrSceneCaptureRequestInfoFB, next),
+    FIELD_VALUE(XrSceneCaptureRequestInfoFB, requestByteCount),
+    FIELD_PTR(XrSceneCaptureRequestInfoFB, request, requestByteCount),
+};
+
+void serialize(const XrSceneCaptureRequestInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneCaptureRequestInfoFB, ctx);
+}
+
+void deserialize(XrSceneCaptureRequestInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneCaptureRequestInfoFB, ctx);
+}
+
+void cleanup(const XrSceneCaptureRequestInfoFB* s) {
+    cleanup_fields(s, fields_XrSceneCaptureRequestInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSceneCaptureRequestInfoFB[] = {
+    FIELD_VALUE(XrSceneCaptureRequestInfoFB, type),
+    FIELD_XR(XrSceneCaptureRequestInfoFB, next),
+    FIELD_VALUE(XrSceneCaptureRequestInfoFB, requestByteCount),
+    FIELD_PTR(XrSceneCaptureRequestInfoFB, request, requestByteCount),
+};
+
+void serialize(const XrSceneCaptureRequestInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneCaptureRequestInfoFB, ctx);
+}
+
+void deserialize(XrSceneCaptureRequestInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneCaptureRequestInfoFB, ctx);
+}
+
+void cleanup(const XrSceneCaptureRequestInfoFB* s) {
+    cleanup_fields(s, fields_XrSceneCaptureRequestInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_scene_capture
+#ifdef XRTRANSPORT_EXT_XR_FB_space_warp
+constexpr FieldDescriptor fields_XrCompositionLayerSpaceWarpInfoFB[] = {
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, type),
+    FIELD_XR(XrCompositionLayerSpaceWarpInfoFB, next),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, layerFlags),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, motionVectorSubImage),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, appSpaceDeltaPose),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, depthSubImage),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, minDepth),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, maxDepth),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, nearZ),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, farZ),
+};
+
+void serialize(const XrCompositionLayerSpaceWarpInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerSpaceWarpInfoFB, ctx);
+}
+
+void deserialize(XrCompositionLayerSpaceWarpInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerSpaceWarpInfoFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerSpaceWarpInfoFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerSpaceWarpInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerSpaceWarpInfoFB[] = {
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, type),
+    FIELD_XR(XrCompositionLayerSpaceWarpInfoFB, next),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, layerFlags),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, motionVectorSubImage),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, appSpaceDeltaPose),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, depthSubImage),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, minDepth),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, maxDepth),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, nearZ),
+    FIELD_VALUE(XrCompositionLayerSpaceWarpInfoFB, farZ),
+};
+
+void serialize(const XrCompositionLayerSpaceWarpInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerSpaceWarpInfoFB, ctx);
+}
+
+void deserialize(XrCompositionLayerSpaceWarpInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerSpaceWarpInfoFB, ctx);
+}
+
+void cleanup(const XrCompositionLayerSpaceWarpInfoFB* s) {
+    cleanup_fields(s, fields_XrCompositionLayerSpaceWarpInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpaceWarpPropertiesFB[] = {
+    FIELD_VALUE(XrSystemSpaceWarpPropertiesFB, type),
+    FIELD_XR(XrSystemSpaceWarpPropertiesFB, next),
+    FIELD_VALUE(XrSystemSpaceWarpPropertiesFB, recommendedMotionVectorImageRectWidth),
+    FIELD_VALUE(XrSystemSpaceWarpPropertiesFB, recommendedMotionVectorImageRectHeight),
+};
+
+void serialize(const XrSystemSpaceWarpPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpaceWarpPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemSpaceWarpPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpaceWarpPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemSpaceWarpPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemSpaceWarpPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpaceWarpPropertiesFB[] = {
+    FIELD_VALUE(XrSystemSpaceWarpPropertiesFB, type),
+    FIELD_XR(XrSystemSpaceWarpPropertiesFB, next),
+    FIELD_VALUE(XrSystemSpaceWarpPropertiesFB, recommendedMotionVectorImageRectWidth),
+    FIELD_VALUE(XrSystemSpaceWarpPropertiesFB, recommendedMotionVectorImageRectHeight),
+};
+
+void serialize(const XrSystemSpaceWarpPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpaceWarpPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemSpaceWarpPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpaceWarpPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemSpaceWarpPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemSpaceWarpPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_space_warp
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity
+constexpr FieldDescriptor fields_XrEventDataSpaceSetStatusCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceSetStatusCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, uuid),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, componentType),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, enabled),
+};
+
+void serialize(const XrEventDataSpaceSetStatusCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceSetStatusCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceSetStatusCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceSetStatusCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceSetStatusCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceSetStatusCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceSetStatusCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceSetStatusCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, uuid),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, componentType),
+    FIELD_VALUE(XrEventDataSpaceSetStatusCompleteFB, enabled),
+};
+
+void serialize(const XrEventDataSpaceSetStatusCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceSetStatusCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceSetStatusCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceSetStatusCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceSetStatusCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceSetStatusCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpatialAnchorCreateCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, type),
+    FIELD_XR(XrEventDataSpatialAnchorCreateCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, uuid),
+};
+
+void serialize(const XrEventDataSpatialAnchorCreateCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpatialAnchorCreateCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpatialAnchorCreateCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpatialAnchorCreateCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpatialAnchorCreateCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpatialAnchorCreateCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpatialAnchorCreateCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, type),
+    FIELD_XR(XrEventDataSpatialAnchorCreateCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpatialAnchorCreateCompleteFB, uuid),
+};
+
+void serialize(const XrEventDataSpatialAnchorCreateCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpatialAnchorCreateCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpatialAnchorCreateCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpatialAnchorCreateCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpatialAnchorCreateCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpatialAnchorCreateCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceComponentStatusFB[] = {
+    FIELD_VALUE(XrSpaceComponentStatusFB, type),
+    FIELD_XR(XrSpaceComponentStatusFB, next),
+    FIELD_VALUE(XrSpaceComponentStatusFB, enabled),
+    FIELD_VALUE(XrSpaceComponentStatusFB, changePending),
+};
+
+void serialize(const XrSpaceComponentStatusFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceComponentStatusFB, ctx);
+}
+
+void deserialize(XrSpaceComponentStatusFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceComponentStatusFB, ctx);
+}
+
+void cleanup(const XrSpaceComponentStatusFB* s) {
+    cleanup_fields(s, fields_XrSpaceComponentStatusFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceComponentStatusFB[] = {
+    FIELD_VALUE(XrSpaceComponentStatusFB, type),
+    FIELD_XR(XrSpaceComponentStatusFB, next),
+    FIELD_VALUE(XrSpaceComponentStatusFB, enabled),
+    FIELD_VALUE(XrSpaceComponentStatusFB, changePending),
+};
+
+void serialize(const XrSpaceComponentStatusFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceComponentStatusFB, ctx);
+}
+
+void deserialize(XrSpaceComponentStatusFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceComponentStatusFB, ctx);
+}
+
+void cleanup(const XrSpaceComponentStatusFB* s) {
+    cleanup_fields(s, fields_XrSpaceComponentStatusFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceComponentStatusSetInfoFB[] = {
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, type),
+    FIELD_XR(XrSpaceComponentStatusSetInfoFB, next),
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, componentType),
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, enabled),
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, timeout),
+};
+
+void serialize(const XrSpaceComponentStatusSetInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceComponentStatusSetInfoFB, ctx);
+}
+
+void deserialize(XrSpaceComponentStatusSetInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceComponentStatusSetInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceComponentStatusSetInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceComponentStatusSetInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceComponentStatusSetInfoFB[] = {
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, type),
+    FIELD_XR(XrSpaceComponentStatusSetInfoFB, next),
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, componentType),
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, enabled),
+    FIELD_VALUE(XrSpaceComponentStatusSetInfoFB, timeout),
+};
+
+void serialize(const XrSpaceComponentStatusSetInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceComponentStatusSetInfoFB, ctx);
+}
+
+void deserialize(XrSpaceComponentStatusSetInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceComponentStatusSetInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceComponentStatusSetInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceComponentStatusSetInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoFB[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoFB, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoFB, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoFB, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoFB, poseInSpace),
+    FIELD_TIME(XrSpatialAnchorCreateInfoFB, time),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoFB, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoFB, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoFB[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoFB, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoFB, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoFB, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoFB, poseInSpace),
+    FIELD_TIME(XrSpatialAnchorCreateInfoFB, time),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoFB, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoFB, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialEntityPropertiesFB[] = {
+    FIELD_VALUE(XrSystemSpatialEntityPropertiesFB, type),
+    FIELD_XR(XrSystemSpatialEntityPropertiesFB, next),
+    FIELD_VALUE(XrSystemSpatialEntityPropertiesFB, supportsSpatialEntity),
+};
+
+void serialize(const XrSystemSpatialEntityPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialEntityPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemSpatialEntityPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialEntityPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemSpatialEntityPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemSpatialEntityPropertiesFB);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialEntityPropertiesFB[] = {
+    FIELD_VALUE(XrSystemSpatialEntityPropertiesFB, type),
+    FIELD_XR(XrSystemSpatialEntityPropertiesFB, next),
+    FIELD_VALUE(XrSystemSpatialEntityPropertiesFB, supportsSpatialEntity),
+};
+
+void serialize(const XrSystemSpatialEntityPropertiesFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialEntityPropertiesFB, ctx);
+}
+
+void deserialize(XrSystemSpatialEntityPropertiesFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialEntityPropertiesFB, ctx);
+}
+
+void cleanup(const XrSystemSpatialEntityPropertiesFB* s) {
+    cleanup_fields(s, fields_XrSystemSpatialEntityPropertiesFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_container
+constexpr FieldDescriptor fields_XrSpaceContainerFB[] = {
+    FIELD_VALUE(XrSpaceContainerFB, type),
+    FIELD_XR(XrSpaceContainerFB, next),
+    FIELD_VALUE(XrSpaceContainerFB, uuidCapacityInput),
+    FIELD_VALUE(XrSpaceContainerFB, uuidCountOutput),
+    FIELD_PTR(XrSpaceContainerFB, uuids, uuidCapacityInput),
+};
+
+void serialize(const XrSpaceContainerFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceContainerFB, ctx);
+}
+
+void deserialize(XrSpaceContainerFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceContainerFB, ctx);
+}
+
+void cleanup(const XrSpaceContainerFB* s) {
+    cleanup_fields(s, fields_XrSpaceContainerFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceContainerFB[] = {
+    FIELD_VALUE(XrSpaceContainerFB, type),
+    FIELD_XR(XrSpaceContainerFB, next),
+    FIELD_VALUE(XrSpaceContainerFB, uuidCapacityInput),
+    FIELD_VALUE(XrSpaceContainerFB, uuidCountOutput),
+    FIELD_PTR(XrSpaceContainerFB, uuids, uuidCapacityInput),
+};
+
+void serialize(const XrSpaceContainerFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceContainerFB, ctx);
+}
+
+void deserialize(XrSpaceContainerFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceContainerFB, ctx);
+}
+
+void cleanup(const XrSpaceContainerFB* s) {
+    cleanup_fields(s, fields_XrSpaceContainerFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_container
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_query
+constexpr FieldDescriptor fields_XrEventDataSpaceQueryCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceQueryCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceQueryCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceQueryCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceQueryCompleteFB, result),
+};
+
+void serialize(const XrEventDataSpaceQueryCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceQueryCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceQueryCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceQueryCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceQueryCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceQueryCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceQueryCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceQueryCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceQueryCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceQueryCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceQueryCompleteFB, result),
+};
+
+void serialize(const XrEventDataSpaceQueryCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceQueryCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceQueryCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceQueryCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceQueryCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceQueryCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceQueryResultsAvailableFB[] = {
+    FIELD_VALUE(XrEventDataSpaceQueryResultsAvailableFB, type),
+    FIELD_XR(XrEventDataSpaceQueryResultsAvailableFB, next),
+    FIELD_VALUE(XrEventDataSpaceQueryResultsAvailableFB, requestId),
+};
+
+void serialize(const XrEventDataSpaceQueryResultsAvailableFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceQueryResultsAvailableFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceQueryResultsAvailableFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceQueryResultsAvailableFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceQueryResultsAvailableFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceQueryResultsAvailableFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceQueryResultsAvailableFB[] = {
+    FIELD_VALUE(XrEventDataSpaceQueryResultsAvailableFB, type),
+    FIELD_XR(XrEventDataSpaceQueryResultsAvailableFB, next),
+    FIELD_VALUE(XrEventDataSpaceQueryResultsAvailableFB, requestId),
+};
+
+void serialize(const XrEventDataSpaceQueryResultsAvailableFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceQueryResultsAvailableFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceQueryResultsAvailableFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceQueryResultsAvailableFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceQueryResultsAvailableFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceQueryResultsAvailableFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceComponentFilterInfoFB[] = {
+    FIELD_VALUE(XrSpaceComponentFilterInfoFB, type),
+    FIELD_XR(XrSpaceComponentFilterInfoFB, next),
+    FIELD_VALUE(XrSpaceComponentFilterInfoFB, componentType),
+};
+
+void serialize(const XrSpaceComponentFilterInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceComponentFilterInfoFB, ctx);
+}
+
+void deserialize(XrSpaceComponentFilterInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceComponentFilterInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceComponentFilterInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceComponentFilterInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceComponentFilterInfoFB[] = {
+    FIELD_VALUE(XrSpaceComponentFilterInfoFB, type),
+    FIELD_XR(XrSpaceComponentFilterInfoFB, next),
+    FIELD_VALUE(XrSpaceComponentFilterInfoFB, componentType),
+};
+
+void serialize(const XrSpaceComponentFilterInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceComponentFilterInfoFB, ctx);
+}
+
+void deserialize(XrSpaceComponentFilterInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceComponentFilterInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceComponentFilterInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceComponentFilterInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceFilterInfoBaseHeaderFB[] = {
+    FIELD_VALUE(XrSpaceFilterInfoBaseHeaderFB, type),
+    FIELD_XR(XrSpaceFilterInfoBaseHeaderFB, next),
+};
+
+void serialize(const XrSpaceFilterInfoBaseHeaderFB* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSpaceFilterInfoBaseHeaderFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceFilterInfoBaseHeaderFB, ctx);
+}
+
+void cleanup(const XrSpaceFilterInfoBaseHeaderFB* s) {
+    cleanup_fields(s, fields_XrSpaceFilterInfoBaseHeaderFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceQueryInfoBaseHeaderFB[] = {
+    FIELD_VALUE(XrSpaceQueryInfoBaseHeaderFB, type),
+    FIELD_XR(XrSpaceQueryInfoBaseHeaderFB, next),
+};
+
+void serialize(const XrSpaceQueryInfoBaseHeaderFB* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSpaceQueryInfoBaseHeaderFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceQueryInfoBaseHeaderFB, ctx);
+}
+
+void cleanup(const XrSpaceQueryInfoBaseHeaderFB* s) {
+    cleanup_fields(s, fields_XrSpaceQueryInfoBaseHeaderFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceQueryInfoFB[] = {
+    FIELD_VALUE(XrSpaceQueryInfoFB, type),
+    FIELD_XR(XrSpaceQueryInfoFB, next),
+    FIELD_VALUE(XrSpaceQueryInfoFB, queryAction),
+    FIELD_VALUE(XrSpaceQueryInfoFB, maxResultCount),
+    FIELD_VALUE(XrSpaceQueryInfoFB, timeout),
+    FIELD_XR(XrSpaceQueryInfoFB, filter),
+    FIELD_XR(XrSpaceQueryInfoFB, excludeFilter),
+};
+
+void serialize(const XrSpaceQueryInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceQueryInfoFB, ctx);
+}
+
+void deserialize(XrSpaceQueryInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceQueryInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceQueryInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceQueryInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceQueryInfoFB[] = {
+    FIELD_VALUE(XrSpaceQueryInfoFB, type),
+    FIELD_XR(XrSpaceQueryInfoFB, next),
+    FIELD_VALUE(XrSpaceQueryInfoFB, queryAction),
+    FIELD_VALUE(XrSpaceQueryInfoFB, maxResultCount),
+    FIELD_VALUE(XrSpaceQueryInfoFB, timeout),
+    FIELD_XR(XrSpaceQueryInfoFB, filter),
+    FIELD_XR(XrSpaceQueryInfoFB, excludeFilter),
+};
+
+void serialize(const XrSpaceQueryInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceQueryInfoFB, ctx);
+}
+
+void deserialize(XrSpaceQueryInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceQueryInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceQueryInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceQueryInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceQueryResultFB[] = {
+    FIELD_VALUE(XrSpaceQueryResultFB, space),
+    FIELD_VALUE(XrSpaceQueryResultFB, uuid),
+};
+
+void serialize(const XrSpaceQueryResultFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceQueryResultFB, ctx);
+}
+
+void deserialize(XrSpaceQueryResultFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceQueryResultFB, ctx);
+}
+
+void cleanup(const XrSpaceQueryResultFB* s) {
+    cleanup_fields(s, fields_XrSpaceQueryResultFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceQueryResultsFB[] = {
+    FIELD_VALUE(XrSpaceQueryResultsFB, type),
+    FIELD_XR(XrSpaceQueryResultsFB, next),
+    FIELD_VALUE(XrSpaceQueryResultsFB, resultCapacityInput),
+    FIELD_VALUE(XrSpaceQueryResultsFB, resultCountOutput),
+    FIELD_PTR(XrSpaceQueryResultsFB, results, resultCapacityInput),
+};
+
+void serialize(const XrSpaceQueryResultsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceQueryResultsFB, ctx);
+}
+
+void deserialize(XrSpaceQueryResultsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceQueryResultsFB, ctx);
+}
+
+void cleanup(const XrSpaceQueryResultsFB* s) {
+    cleanup_fields(s, fields_XrSpaceQueryResultsFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceQueryResultsFB[] = {
+    FIELD_VALUE(XrSpaceQueryResultsFB, type),
+    FIELD_XR(XrSpaceQueryResultsFB, next),
+    FIELD_VALUE(XrSpaceQueryResultsFB, resultCapacityInput),
+    FIELD_VALUE(XrSpaceQueryResultsFB, resultCountOutput),
+    FIELD_PTR(XrSpaceQueryResultsFB, results, resultCapacityInput),
+};
+
+void serialize(const XrSpaceQueryResultsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceQueryResultsFB, ctx);
+}
+
+void deserialize(XrSpaceQueryResultsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceQueryResultsFB, ctx);
+}
+
+void cleanup(const XrSpaceQueryResultsFB* s) {
+    cleanup_fields(s, fields_XrSpaceQueryResultsFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceStorageLocationFilterInfoFB[] = {
+    FIELD_VALUE(XrSpaceStorageLocationFilterInfoFB, type),
+    FIELD_XR(XrSpaceStorageLocationFilterInfoFB, next),
+    FIELD_VALUE(XrSpaceStorageLocationFilterInfoFB, location),
+};
+
+void serialize(const XrSpaceStorageLocationFilterInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceStorageLocationFilterInfoFB, ctx);
+}
+
+void deserialize(XrSpaceStorageLocationFilterInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceStorageLocationFilterInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceStorageLocationFilterInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceStorageLocationFilterInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceStorageLocationFilterInfoFB[] = {
+    FIELD_VALUE(XrSpaceStorageLocationFilterInfoFB, type),
+    FIELD_XR(XrSpaceStorageLocationFilterInfoFB, next),
+    FIELD_VALUE(XrSpaceStorageLocationFilterInfoFB, location),
+};
+
+void serialize(const XrSpaceStorageLocationFilterInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceStorageLocationFilterInfoFB, ctx);
+}
+
+void deserialize(XrSpaceStorageLocationFilterInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceStorageLocationFilterInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceStorageLocationFilterInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceStorageLocationFilterInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceUuidFilterInfoFB[] = {
+    FIELD_VALUE(XrSpaceUuidFilterInfoFB, type),
+    FIELD_XR(XrSpaceUuidFilterInfoFB, next),
+    FIELD_VALUE(XrSpaceUuidFilterInfoFB, uuidCount),
+    FIELD_PTR(XrSpaceUuidFilterInfoFB, uuids, uuidCount),
+};
+
+void serialize(const XrSpaceUuidFilterInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceUuidFilterInfoFB, ctx);
+}
+
+void deserialize(XrSpaceUuidFilterInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceUuidFilterInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceUuidFilterInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceUuidFilterInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceUuidFilterInfoFB[] = {
+    FIELD_VALUE(XrSpaceUuidFilterInfoFB, type),
+    FIELD_XR(XrSpaceUuidFilterInfoFB, next),
+    FIELD_VALUE(XrSpaceUuidFilterInfoFB, uuidCount),
+    FIELD_PTR(XrSpaceUuidFilterInfoFB, uuids, uuidCount),
+};
+
+void serialize(const XrSpaceUuidFilterInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceUuidFilterInfoFB, ctx);
+}
+
+void deserialize(XrSpaceUuidFilterInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceUuidFilterInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceUuidFilterInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceUuidFilterInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_query
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_sharing
+constexpr FieldDescriptor fields_XrEventDataSpaceShareCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceShareCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceShareCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceShareCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceShareCompleteFB, result),
+};
+
+void serialize(const XrEventDataSpaceShareCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceShareCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceShareCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceShareCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceShareCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceShareCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceShareCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceShareCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceShareCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceShareCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceShareCompleteFB, result),
+};
+
+void serialize(const XrEventDataSpaceShareCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceShareCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceShareCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceShareCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceShareCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceShareCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceShareInfoFB[] = {
+    FIELD_VALUE(XrSpaceShareInfoFB, type),
+    FIELD_XR(XrSpaceShareInfoFB, next),
+    FIELD_VALUE(XrSpaceShareInfoFB, spaceCount),
+    FIELD_PTR(XrSpaceShareInfoFB, spaces, spaceCount),
+    FIELD_VALUE(XrSpaceShareInfoFB, userCount),
+    FIELD_PTR(XrSpaceShareInfoFB, users, userCount),
+};
+
+void serialize(const XrSpaceShareInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceShareInfoFB, ctx);
+}
+
+void deserialize(XrSpaceShareInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceShareInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceShareInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceShareInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceShareInfoFB[] = {
+    FIELD_VALUE(XrSpaceShareInfoFB, type),
+    FIELD_XR(XrSpaceShareInfoFB, next),
+    FIELD_VALUE(XrSpaceShareInfoFB, spaceCount),
+    FIELD_PTR(XrSpaceShareInfoFB, spaces, spaceCount),
+    FIELD_VALUE(XrSpaceShareInfoFB, userCount),
+    FIELD_PTR(XrSpaceShareInfoFB, users, userCount),
+};
+
+void serialize(const XrSpaceShareInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceShareInfoFB, ctx);
+}
+
+void deserialize(XrSpaceShareInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceShareInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceShareInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceShareInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_sharing
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_storage
+constexpr FieldDescriptor fields_XrEventDataSpaceEraseCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceEraseCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, uuid),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, location),
+};
+
+void serialize(const XrEventDataSpaceEraseCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceEraseCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceEraseCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceEraseCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceEraseCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceEraseCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceEraseCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceEraseCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, uuid),
+    FIELD_VALUE(XrEventDataSpaceEraseCompleteFB, location),
+};
+
+void serialize(const XrEventDataSpaceEraseCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceEraseCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceEraseCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceEraseCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceEraseCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceEraseCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceSaveCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceSaveCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, uuid),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, location),
+};
+
+void serialize(const XrEventDataSpaceSaveCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceSaveCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceSaveCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceSaveCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceSaveCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceSaveCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceSaveCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceSaveCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, result),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, space),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, uuid),
+    FIELD_VALUE(XrEventDataSpaceSaveCompleteFB, location),
+};
+
+void serialize(const XrEventDataSpaceSaveCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceSaveCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceSaveCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceSaveCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceSaveCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceSaveCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceEraseInfoFB[] = {
+    FIELD_VALUE(XrSpaceEraseInfoFB, type),
+    FIELD_XR(XrSpaceEraseInfoFB, next),
+    FIELD_VALUE(XrSpaceEraseInfoFB, space),
+    FIELD_VALUE(XrSpaceEraseInfoFB, location),
+};
+
+void serialize(const XrSpaceEraseInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceEraseInfoFB, ctx);
+}
+
+void deserialize(XrSpaceEraseInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceEraseInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceEraseInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceEraseInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceEraseInfoFB[] = {
+    FIELD_VALUE(XrSpaceEraseInfoFB, type),
+    FIELD_XR(XrSpaceEraseInfoFB, next),
+    FIELD_VALUE(XrSpaceEraseInfoFB, space),
+    FIELD_VALUE(XrSpaceEraseInfoFB, location),
+};
+
+void serialize(const XrSpaceEraseInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceEraseInfoFB, ctx);
+}
+
+void deserialize(XrSpaceEraseInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceEraseInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceEraseInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceEraseInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceSaveInfoFB[] = {
+    FIELD_VALUE(XrSpaceSaveInfoFB, type),
+    FIELD_XR(XrSpaceSaveInfoFB, next),
+    FIELD_VALUE(XrSpaceSaveInfoFB, space),
+    FIELD_VALUE(XrSpaceSaveInfoFB, location),
+    FIELD_VALUE(XrSpaceSaveInfoFB, persistenceMode),
+};
+
+void serialize(const XrSpaceSaveInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceSaveInfoFB, ctx);
+}
+
+void deserialize(XrSpaceSaveInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceSaveInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceSaveInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceSaveInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceSaveInfoFB[] = {
+    FIELD_VALUE(XrSpaceSaveInfoFB, type),
+    FIELD_XR(XrSpaceSaveInfoFB, next),
+    FIELD_VALUE(XrSpaceSaveInfoFB, space),
+    FIELD_VALUE(XrSpaceSaveInfoFB, location),
+    FIELD_VALUE(XrSpaceSaveInfoFB, persistenceMode),
+};
+
+void serialize(const XrSpaceSaveInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceSaveInfoFB, ctx);
+}
+
+void deserialize(XrSpaceSaveInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceSaveInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceSaveInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceSaveInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_storage
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_storage_batch
+constexpr FieldDescriptor fields_XrEventDataSpaceListSaveCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceListSaveCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceListSaveCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceListSaveCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceListSaveCompleteFB, result),
+};
+
+void serialize(const XrEventDataSpaceListSaveCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceListSaveCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceListSaveCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceListSaveCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceListSaveCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceListSaveCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSpaceListSaveCompleteFB[] = {
+    FIELD_VALUE(XrEventDataSpaceListSaveCompleteFB, type),
+    FIELD_XR(XrEventDataSpaceListSaveCompleteFB, next),
+    FIELD_VALUE(XrEventDataSpaceListSaveCompleteFB, requestId),
+    FIELD_VALUE(XrEventDataSpaceListSaveCompleteFB, result),
+};
+
+void serialize(const XrEventDataSpaceListSaveCompleteFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSpaceListSaveCompleteFB, ctx);
+}
+
+void deserialize(XrEventDataSpaceListSaveCompleteFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSpaceListSaveCompleteFB, ctx);
+}
+
+void cleanup(const XrEventDataSpaceListSaveCompleteFB* s) {
+    cleanup_fields(s, fields_XrEventDataSpaceListSaveCompleteFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceListSaveInfoFB[] = {
+    FIELD_VALUE(XrSpaceListSaveInfoFB, type),
+    FIELD_XR(XrSpaceListSaveInfoFB, next),
+    FIELD_VALUE(XrSpaceListSaveInfoFB, spaceCount),
+    FIELD_PTR(XrSpaceListSaveInfoFB, spaces, spaceCount),
+    FIELD_VALUE(XrSpaceListSaveInfoFB, location),
+};
+
+void serialize(const XrSpaceListSaveInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceListSaveInfoFB, ctx);
+}
+
+void deserialize(XrSpaceListSaveInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceListSaveInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceListSaveInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceListSaveInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceListSaveInfoFB[] = {
+    FIELD_VALUE(XrSpaceListSaveInfoFB, type),
+    FIELD_XR(XrSpaceListSaveInfoFB, next),
+    FIELD_VALUE(XrSpaceListSaveInfoFB, spaceCount),
+    FIELD_PTR(XrSpaceListSaveInfoFB, spaces, spaceCount),
+    FIELD_VALUE(XrSpaceListSaveInfoFB, location),
+};
+
+void serialize(const XrSpaceListSaveInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceListSaveInfoFB, ctx);
+}
+
+void deserialize(XrSpaceListSaveInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceListSaveInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceListSaveInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceListSaveInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_storage_batch
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_user
+constexpr FieldDescriptor fields_XrSpaceUserCreateInfoFB[] = {
+    FIELD_VALUE(XrSpaceUserCreateInfoFB, type),
+    FIELD_XR(XrSpaceUserCreateInfoFB, next),
+    FIELD_VALUE(XrSpaceUserCreateInfoFB, userId),
+};
+
+void serialize(const XrSpaceUserCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceUserCreateInfoFB, ctx);
+}
+
+void deserialize(XrSpaceUserCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceUserCreateInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceUserCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceUserCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrSpaceUserCreateInfoFB[] = {
+    FIELD_VALUE(XrSpaceUserCreateInfoFB, type),
+    FIELD_XR(XrSpaceUserCreateInfoFB, next),
+    FIELD_VALUE(XrSpaceUserCreateInfoFB, userId),
+};
+
+void serialize(const XrSpaceUserCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceUserCreateInfoFB, ctx);
+}
+
+void deserialize(XrSpaceUserCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceUserCreateInfoFB, ctx);
+}
+
+void cleanup(const XrSpaceUserCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrSpaceUserCreateInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_user
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state
+constexpr FieldDescriptor fields_XrSwapchainStateBaseHeaderFB[] = {
+    FIELD_VALUE(XrSwapchainStateBaseHeaderFB, type),
+    FIELD_XR(XrSwapchainStateBaseHeaderFB, next),
+};
+
+void serialize(const XrSwapchainStateBaseHeaderFB* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSwapchainStateBaseHeaderFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateBaseHeaderFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateBaseHeaderFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateBaseHeaderFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state_android_surface
+constexpr FieldDescriptor fields_XrSwapchainStateAndroidSurfaceDimensionsFB[] = {
+    FIELD_VALUE(XrSwapchainStateAndroidSurfaceDimensionsFB, type),
+    FIELD_XR(XrSwapchainStateAndroidSurfaceDimensionsFB, next),
+    FIELD_VALUE(XrSwapchainStateAndroidSurfaceDimensionsFB, width),
+    FIELD_VALUE(XrSwapchainStateAndroidSurfaceDimensionsFB, height),
+};
+
+void serialize(const XrSwapchainStateAndroidSurfaceDimensionsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateAndroidSurfaceDimensionsFB, ctx);
+}
+
+void deserialize(XrSwapchainStateAndroidSurfaceDimensionsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateAndroidSurfaceDimensionsFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateAndroidSurfaceDimensionsFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateAndroidSurfaceDimensionsFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainStateAndroidSurfaceDimensionsFB[] = {
+    FIELD_VALUE(XrSwapchainStateAndroidSurfaceDimensionsFB, type),
+    FIELD_XR(XrSwapchainStateAndroidSurfaceDimensionsFB, next),
+    FIELD_VALUE(XrSwapchainStateAndroidSurfaceDimensionsFB, width),
+    FIELD_VALUE(XrSwapchainStateAndroidSurfaceDimensionsFB, height),
+};
+
+void serialize(const XrSwapchainStateAndroidSurfaceDimensionsFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateAndroidSurfaceDimensionsFB, ctx);
+}
+
+void deserialize(XrSwapchainStateAndroidSurfaceDimensionsFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateAndroidSurfaceDimensionsFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateAndroidSurfaceDimensionsFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateAndroidSurfaceDimensionsFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state_android_surface
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state_opengl_es
+constexpr FieldDescriptor fields_XrSwapchainStateSamplerOpenGLESFB[] = {
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, type),
+    FIELD_XR(XrSwapchainStateSamplerOpenGLESFB, next),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, minFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, magFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, wrapModeS),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, wrapModeT),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleRed),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleGreen),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleBlue),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleAlpha),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, maxAnisotropy),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, borderColor),
+};
+
+void serialize(const XrSwapchainStateSamplerOpenGLESFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateSamplerOpenGLESFB, ctx);
+}
+
+void deserialize(XrSwapchainStateSamplerOpenGLESFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateSamplerOpenGLESFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateSamplerOpenGLESFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateSamplerOpenGLESFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainStateSamplerOpenGLESFB[] = {
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, type),
+    FIELD_XR(XrSwapchainStateSamplerOpenGLESFB, next),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, minFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, magFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, wrapModeS),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, wrapModeT),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleRed),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleGreen),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleBlue),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, swizzleAlpha),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, maxAnisotropy),
+    FIELD_VALUE(XrSwapchainStateSamplerOpenGLESFB, borderColor),
+};
+
+void serialize(const XrSwapchainStateSamplerOpenGLESFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateSamplerOpenGLESFB, ctx);
+}
+
+void deserialize(XrSwapchainStateSamplerOpenGLESFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateSamplerOpenGLESFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateSamplerOpenGLESFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateSamplerOpenGLESFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state_opengl_es
+#ifdef XRTRANSPORT_EXT_XR_FB_swapchain_update_state_vulkan
+constexpr FieldDescriptor fields_XrSwapchainStateSamplerVulkanFB[] = {
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, type),
+    FIELD_XR(XrSwapchainStateSamplerVulkanFB, next),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, minFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, magFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, mipmapMode),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, wrapModeS),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, wrapModeT),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleRed),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleGreen),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleBlue),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleAlpha),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, maxAnisotropy),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, borderColor),
+};
+
+void serialize(const XrSwapchainStateSamplerVulkanFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateSamplerVulkanFB, ctx);
+}
+
+void deserialize(XrSwapchainStateSamplerVulkanFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateSamplerVulkanFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateSamplerVulkanFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateSamplerVulkanFB);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainStateSamplerVulkanFB[] = {
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, type),
+    FIELD_XR(XrSwapchainStateSamplerVulkanFB, next),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, minFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, magFilter),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, mipmapMode),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, wrapModeS),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, wrapModeT),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleRed),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleGreen),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleBlue),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, swizzleAlpha),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, maxAnisotropy),
+    FIELD_VALUE(XrSwapchainStateSamplerVulkanFB, borderColor),
+};
+
+void serialize(const XrSwapchainStateSamplerVulkanFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainStateSamplerVulkanFB, ctx);
+}
+
+void deserialize(XrSwapchainStateSamplerVulkanFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainStateSamplerVulkanFB, ctx);
+}
+
+void cleanup(const XrSwapchainStateSamplerVulkanFB* s) {
+    cleanup_fields(s, fields_XrSwapchainStateSamplerVulkanFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_swapchain_update_state_vulkan
+#ifdef XRTRANSPORT_EXT_XR_FB_triangle_mesh
+constexpr FieldDescriptor fields_XrTriangleMeshCreateInfoFB[] = {
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, type),
+    FIELD_XR(XrTriangleMeshCreateInfoFB, next),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, flags),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, windingOrder),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, vertexCount),
+    FIELD_SINGLE_PTR(XrTriangleMeshCreateInfoFB, vertexBuffer),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, triangleCount),
+    FIELD_SINGLE_PTR(XrTriangleMeshCreateInfoFB, indexBuffer),
+};
+
+void serialize(const XrTriangleMeshCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrTriangleMeshCreateInfoFB, ctx);
+}
+
+void deserialize(XrTriangleMeshCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrTriangleMeshCreateInfoFB, ctx);
+}
+
+void cleanup(const XrTriangleMeshCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrTriangleMeshCreateInfoFB);
+}
+
+constexpr FieldDescriptor fields_XrTriangleMeshCreateInfoFB[] = {
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, type),
+    FIELD_XR(XrTriangleMeshCreateInfoFB, next),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, flags),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, windingOrder),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, vertexCount),
+    FIELD_SINGLE_PTR(XrTriangleMeshCreateInfoFB, vertexBuffer),
+    FIELD_VALUE(XrTriangleMeshCreateInfoFB, triangleCount),
+    FIELD_SINGLE_PTR(XrTriangleMeshCreateInfoFB, indexBuffer),
+};
+
+void serialize(const XrTriangleMeshCreateInfoFB* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrTriangleMeshCreateInfoFB, ctx);
+}
+
+void deserialize(XrTriangleMeshCreateInfoFB* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrTriangleMeshCreateInfoFB, ctx);
+}
+
+void cleanup(const XrTriangleMeshCreateInfoFB* s) {
+    cleanup_fields(s, fields_XrTriangleMeshCreateInfoFB);
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_triangle_mesh
+#ifdef XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
+constexpr FieldDescriptor fields_XrEventDataViveTrackerConnectedHTCX[] = {
+    FIELD_VALUE(XrEventDataViveTrackerConnectedHTCX, type),
+    FIELD_XR(XrEventDataViveTrackerConnectedHTCX, next),
+    FIELD_SINGLE_PTR(XrEventDataViveTrackerConnectedHTCX, paths),
+};
+
+void serialize(const XrEventDataViveTrackerConnectedHTCX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataViveTrackerConnectedHTCX, ctx);
+}
+
+void deserialize(XrEventDataViveTrackerConnectedHTCX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataViveTrackerConnectedHTCX, ctx);
+}
+
+void cleanup(const XrEventDataViveTrackerConnectedHTCX* s) {
+    cleanup_fields(s, fields_XrEventDataViveTrackerConnectedHTCX);
+}
+
+constexpr FieldDescriptor fields_XrEventDataViveTrackerConnectedHTCX[] = {
+    FIELD_VALUE(XrEventDataViveTrackerConnectedHTCX, type),
+    FIELD_XR(XrEventDataViveTrackerConnectedHTCX, next),
+    FIELD_SINGLE_PTR(XrEventDataViveTrackerConnectedHTCX, paths),
+};
+
+void serialize(const XrEventDataViveTrackerConnectedHTCX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataViveTrackerConnectedHTCX, ctx);
+}
+
+void deserialize(XrEventDataViveTrackerConnectedHTCX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataViveTrackerConnectedHTCX, ctx);
+}
+
+void cleanup(const XrEventDataViveTrackerConnectedHTCX* s) {
+    cleanup_fields(s, fields_XrEventDataViveTrackerConnectedHTCX);
+}
+
+constexpr FieldDescriptor fields_XrViveTrackerPathsHTCX[] = {
+    FIELD_VALUE(XrViveTrackerPathsHTCX, type),
+    FIELD_XR(XrViveTrackerPathsHTCX, next),
+    FIELD_VALUE(XrViveTrackerPathsHTCX, persistentPath),
+    FIELD_VALUE(XrViveTrackerPathsHTCX, rolePath),
+};
+
+void serialize(const XrViveTrackerPathsHTCX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViveTrackerPathsHTCX, ctx);
+}
+
+void deserialize(XrViveTrackerPathsHTCX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViveTrackerPathsHTCX, ctx);
+}
+
+void cleanup(const XrViveTrackerPathsHTCX* s) {
+    cleanup_fields(s, fields_XrViveTrackerPathsHTCX);
+}
+
+constexpr FieldDescriptor fields_XrViveTrackerPathsHTCX[] = {
+    FIELD_VALUE(XrViveTrackerPathsHTCX, type),
+    FIELD_XR(XrViveTrackerPathsHTCX, next),
+    FIELD_VALUE(XrViveTrackerPathsHTCX, persistentPath),
+    FIELD_VALUE(XrViveTrackerPathsHTCX, rolePath),
+};
+
+void serialize(const XrViveTrackerPathsHTCX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViveTrackerPathsHTCX, ctx);
+}
+
+void deserialize(XrViveTrackerPathsHTCX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViveTrackerPathsHTCX, ctx);
+}
+
+void cleanup(const XrViveTrackerPathsHTCX* s) {
+    cleanup_fields(s, fields_XrViveTrackerPathsHTCX);
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTCX_vive_tracker_interaction
+#ifdef XRTRANSPORT_EXT_XR_HTC_anchor
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoHTC[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoHTC, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, poseInSpace),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, name),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoHTC, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoHTC[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoHTC, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, poseInSpace),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoHTC, name),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoHTC, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorNameHTC[] = {
+    FIELD_STRING_ARRAY(XrSpatialAnchorNameHTC, name),
+};
+
+void serialize(const XrSpatialAnchorNameHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorNameHTC, ctx);
+}
+
+void deserialize(XrSpatialAnchorNameHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorNameHTC, ctx);
+}
+
+void cleanup(const XrSpatialAnchorNameHTC* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorNameHTC);
+}
+
+constexpr FieldDescriptor fields_XrSystemAnchorPropertiesHTC[] = {
+    FIELD_VALUE(XrSystemAnchorPropertiesHTC, type),
+    FIELD_XR(XrSystemAnchorPropertiesHTC, next),
+    FIELD_VALUE(XrSystemAnchorPropertiesHTC, supportsAnchor),
+};
+
+void serialize(const XrSystemAnchorPropertiesHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemAnchorPropertiesHTC, ctx);
+}
+
+void deserialize(XrSystemAnchorPropertiesHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemAnchorPropertiesHTC, ctx);
+}
+
+void cleanup(const XrSystemAnchorPropertiesHTC* s) {
+    cleanup_fields(s, fields_XrSystemAnchorPropertiesHTC);
+}
+
+constexpr FieldDescriptor fields_XrSystemAnchorPropertiesHTC[] = {
+    FIELD_VALUE(XrSystemAnchorPropertiesHTC, type),
+    FIELD_XR(XrSystemAnchorPropertiesHTC, next),
+    FIELD_VALUE(XrSystemAnchorPropertiesHTC, supportsAnchor),
+};
+
+void serialize(const XrSystemAnchorPropertiesHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemAnchorPropertiesHTC, ctx);
+}
+
+void deserialize(XrSystemAnchorPropertiesHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemAnchorPropertiesHTC, ctx);
+}
+
+void cleanup(const XrSystemAnchorPropertiesHTC* s) {
+    cleanup_fields(s, fields_XrSystemAnchorPropertiesHTC);
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_anchor
+#ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
+constexpr FieldDescriptor fields_XrBodyJointLocationHTC[] = {
+    FIELD_VALUE(XrBodyJointLocationHTC, locationFlags),
+    FIELD_VALUE(XrBodyJointLocationHTC, pose),
+};
+
+void serialize(const XrBodyJointLocationHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationHTC, ctx);
+}
+
+void deserialize(XrBodyJointLocationHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationHTC, ctx);
+}
+
+void cleanup(const XrBodyJointLocationHTC* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointLocationsHTC[] = {
+    FIELD_VALUE(XrBodyJointLocationsHTC, type),
+    FIELD_XR(XrBodyJointLocationsHTC, next),
+    FIELD_VALUE(XrBodyJointLocationsHTC, combinedLocationFlags),
+    FIELD_VALUE(XrBodyJointLocationsHTC, confidenceLevel),
+    FIELD_VALUE(XrBodyJointLocationsHTC, jointLocationCount),
+    FIELD_QUANTIZABLE_PTR(XrBodyJointLocationsHTC, jointLocations, jointLocationCount, QUANTIZED_XR_HTC_body_tracking),
+    FIELD_VALUE(XrBodyJointLocationsHTC, skeletonGenerationId),
+};
+
+void serialize(const XrBodyJointLocationsHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationsHTC, ctx);
+}
+
+void deserialize(XrBodyJointLocationsHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationsHTC, ctx);
+}
+
+void cleanup(const XrBodyJointLocationsHTC* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationsHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointLocationsHTC[] = {
+    FIELD_VALUE(XrBodyJointLocationsHTC, type),
+    FIELD_XR(XrBodyJointLocationsHTC, next),
+    FIELD_VALUE(XrBodyJointLocationsHTC, combinedLocationFlags),
+    FIELD_VALUE(XrBodyJointLocationsHTC, confidenceLevel),
+    FIELD_VALUE(XrBodyJointLocationsHTC, jointLocationCount),
+    FIELD_QUANTIZABLE_PTR(XrBodyJointLocationsHTC, jointLocations, jointLocationCount, QUANTIZED_XR_HTC_body_tracking),
+    FIELD_VALUE(XrBodyJointLocationsHTC, skeletonGenerationId),
+};
+
+void serialize(const XrBodyJointLocationsHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointLocationsHTC, ctx);
+}
+
+void deserialize(XrBodyJointLocationsHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointLocationsHTC, ctx);
+}
+
+void cleanup(const XrBodyJointLocationsHTC* s) {
+    cleanup_fields(s, fields_XrBodyJointLocationsHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointsLocateInfoHTC[] = {
+    FIELD_VALUE(XrBodyJointsLocateInfoHTC, type),
+    FIELD_XR(XrBodyJointsLocateInfoHTC, next),
+    FIELD_VALUE(XrBodyJointsLocateInfoHTC, baseSpace),
+    FIELD_TIME(XrBodyJointsLocateInfoHTC, time),
+};
+
+void serialize(const XrBodyJointsLocateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointsLocateInfoHTC, ctx);
+}
+
+void deserialize(XrBodyJointsLocateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointsLocateInfoHTC, ctx);
+}
+
+void cleanup(const XrBodyJointsLocateInfoHTC* s) {
+    cleanup_fields(s, fields_XrBodyJointsLocateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodyJointsLocateInfoHTC[] = {
+    FIELD_VALUE(XrBodyJointsLocateInfoHTC, type),
+    FIELD_XR(XrBodyJointsLocateInfoHTC, next),
+    FIELD_VALUE(XrBodyJointsLocateInfoHTC, baseSpace),
+    FIELD_TIME(XrBodyJointsLocateInfoHTC, time),
+};
+
+void serialize(const XrBodyJointsLocateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyJointsLocateInfoHTC, ctx);
+}
+
+void deserialize(XrBodyJointsLocateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyJointsLocateInfoHTC, ctx);
+}
+
+void cleanup(const XrBodyJointsLocateInfoHTC* s) {
+    cleanup_fields(s, fields_XrBodyJointsLocateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodySkeletonHTC[] = {
+    FIELD_VALUE(XrBodySkeletonHTC, type),
+    FIELD_XR(XrBodySkeletonHTC, next),
+    FIELD_VALUE(XrBodySkeletonHTC, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrBodySkeletonHTC, joints, jointCount, QUANTIZED_XR_HTC_body_tracking),
+};
+
+void serialize(const XrBodySkeletonHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodySkeletonHTC, ctx);
+}
+
+void deserialize(XrBodySkeletonHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodySkeletonHTC, ctx);
+}
+
+void cleanup(const XrBodySkeletonHTC* s) {
+    cleanup_fields(s, fields_XrBodySkeletonHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodySkeletonHTC[] = {
+    FIELD_VALUE(XrBodySkeletonHTC, type),
+    FIELD_XR(XrBodySkeletonHTC, next),
+    FIELD_VALUE(XrBodySkeletonHTC, jointCount),
+    FIELD_QUANTIZABLE_PTR(XrBodySkeletonHTC, joints, jointCount, QUANTIZED_XR_HTC_body_tracking),
+};
+
+void serialize(const XrBodySkeletonHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodySkeletonHTC, ctx);
+}
+
+void deserialize(XrBodySkeletonHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodySkeletonHTC, ctx);
+}
+
+void cleanup(const XrBodySkeletonHTC* s) {
+    cleanup_fields(s, fields_XrBodySkeletonHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodyTrackerCreateInfoHTC[] = {
+    FIELD_VALUE(XrBodyTrackerCreateInfoHTC, type),
+    FIELD_XR(XrBodyTrackerCreateInfoHTC, next),
+    FIELD_VALUE(XrBodyTrackerCreateInfoHTC, bodyJointSet),
+};
+
+void serialize(const XrBodyTrackerCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyTrackerCreateInfoHTC, ctx);
+}
+
+void deserialize(XrBodyTrackerCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyTrackerCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrBodyTrackerCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrBodyTrackerCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrBodyTrackerCreateInfoHTC[] = {
+    FIELD_VALUE(XrBodyTrackerCreateInfoHTC, type),
+    FIELD_XR(XrBodyTrackerCreateInfoHTC, next),
+    FIELD_VALUE(XrBodyTrackerCreateInfoHTC, bodyJointSet),
+};
+
+void serialize(const XrBodyTrackerCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodyTrackerCreateInfoHTC, ctx);
+}
+
+void deserialize(XrBodyTrackerCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodyTrackerCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrBodyTrackerCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrBodyTrackerCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrSystemBodyTrackingPropertiesHTC[] = {
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesHTC, type),
+    FIELD_XR(XrSystemBodyTrackingPropertiesHTC, next),
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesHTC, supportsBodyTracking),
+};
+
+void serialize(const XrSystemBodyTrackingPropertiesHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemBodyTrackingPropertiesHTC, ctx);
+}
+
+void deserialize(XrSystemBodyTrackingPropertiesHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemBodyTrackingPropertiesHTC, ctx);
+}
+
+void cleanup(const XrSystemBodyTrackingPropertiesHTC* s) {
+    cleanup_fields(s, fields_XrSystemBodyTrackingPropertiesHTC);
+}
+
+constexpr FieldDescriptor fields_XrSystemBodyTrackingPropertiesHTC[] = {
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesHTC, type),
+    FIELD_XR(XrSystemBodyTrackingPropertiesHTC, next),
+    FIELD_VALUE(XrSystemBodyTrackingPropertiesHTC, supportsBodyTracking),
+};
+
+void serialize(const XrSystemBodyTrackingPropertiesHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemBodyTrackingPropertiesHTC, ctx);
+}
+
+void deserialize(XrSystemBodyTrackingPropertiesHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemBodyTrackingPropertiesHTC, ctx);
+}
+
+void cleanup(const XrSystemBodyTrackingPropertiesHTC* s) {
+    cleanup_fields(s, fields_XrSystemBodyTrackingPropertiesHTC);
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_facial_tracking
+constexpr FieldDescriptor fields_XrFacialExpressionsHTC[] = {
+    FIELD_VALUE(XrFacialExpressionsHTC, type),
+    FIELD_XR(XrFacialExpressionsHTC, next),
+    FIELD_VALUE(XrFacialExpressionsHTC, isActive),
+    FIELD_TIME(XrFacialExpressionsHTC, sampleTime),
+    FIELD_VALUE(XrFacialExpressionsHTC, expressionCount),
+    FIELD_SINGLE_PTR(XrFacialExpressionsHTC, expressionWeightings),
+};
+
+void serialize(const XrFacialExpressionsHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionsHTC, ctx);
+}
+
+void deserialize(XrFacialExpressionsHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionsHTC, ctx);
+}
+
+void cleanup(const XrFacialExpressionsHTC* s) {
+    cleanup_fields(s, fields_XrFacialExpressionsHTC);
+}
+
+constexpr FieldDescriptor fields_XrFacialExpressionsHTC[] = {
+    FIELD_VALUE(XrFacialExpressionsHTC, type),
+    FIELD_XR(XrFacialExpressionsHTC, next),
+    FIELD_VALUE(XrFacialExpressionsHTC, isActive),
+    FIELD_TIME(XrFacialExpressionsHTC, sampleTime),
+    FIELD_VALUE(XrFacialExpressionsHTC, expressionCount),
+    FIELD_SINGLE_PTR(XrFacialExpressionsHTC, expressionWeightings),
+};
+
+void serialize(const XrFacialExpressionsHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionsHTC, ctx);
+}
+
+void deserialize(XrFacialExpressionsHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionsHTC, ctx);
+}
+
+void cleanup(const XrFacialExpressionsHTC* s) {
+    cleanup_fields(s, fields_XrFacialExpressionsHTC);
+}
+
+constexpr FieldDescriptor fields_XrFacialTrackerCreateInfoHTC[] = {
+    FIELD_VALUE(XrFacialTrackerCreateInfoHTC, type),
+    FIELD_XR(XrFacialTrackerCreateInfoHTC, next),
+    FIELD_VALUE(XrFacialTrackerCreateInfoHTC, facialTrackingType),
+};
+
+void serialize(const XrFacialTrackerCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialTrackerCreateInfoHTC, ctx);
+}
+
+void deserialize(XrFacialTrackerCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialTrackerCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrFacialTrackerCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrFacialTrackerCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrFacialTrackerCreateInfoHTC[] = {
+    FIELD_VALUE(XrFacialTrackerCreateInfoHTC, type),
+    FIELD_XR(XrFacialTrackerCreateInfoHTC, next),
+    FIELD_VALUE(XrFacialTrackerCreateInfoHTC, facialTrackingType),
+};
+
+void serialize(const XrFacialTrackerCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialTrackerCreateInfoHTC, ctx);
+}
+
+void deserialize(XrFacialTrackerCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialTrackerCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrFacialTrackerCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrFacialTrackerCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrSystemFacialTrackingPropertiesHTC[] = {
+    FIELD_VALUE(XrSystemFacialTrackingPropertiesHTC, type),
+    FIELD_XR(XrSystemFacialTrackingPropertiesHTC, next),
+    FIELD_VALUE(XrSystemFacialTrackingPropertiesHTC, supportEyeFacialTracking),
+    FIELD_VALUE(XrSystemFacialTrackingPropertiesHTC, supportLipFacialTracking),
+};
+
+void serialize(const XrSystemFacialTrackingPropertiesHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFacialTrackingPropertiesHTC, ctx);
+}
+
+void deserialize(XrSystemFacialTrackingPropertiesHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFacialTrackingPropertiesHTC, ctx);
+}
+
+void cleanup(const XrSystemFacialTrackingPropertiesHTC* s) {
+    cleanup_fields(s, fields_XrSystemFacialTrackingPropertiesHTC);
+}
+
+constexpr FieldDescriptor fields_XrSystemFacialTrackingPropertiesHTC[] = {
+    FIELD_VALUE(XrSystemFacialTrackingPropertiesHTC, type),
+    FIELD_XR(XrSystemFacialTrackingPropertiesHTC, next),
+    FIELD_VALUE(XrSystemFacialTrackingPropertiesHTC, supportEyeFacialTracking),
+    FIELD_VALUE(XrSystemFacialTrackingPropertiesHTC, supportLipFacialTracking),
+};
+
+void serialize(const XrSystemFacialTrackingPropertiesHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFacialTrackingPropertiesHTC, ctx);
+}
+
+void deserialize(XrSystemFacialTrackingPropertiesHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFacialTrackingPropertiesHTC, ctx);
+}
+
+void cleanup(const XrSystemFacialTrackingPropertiesHTC* s) {
+    cleanup_fields(s, fields_XrSystemFacialTrackingPropertiesHTC);
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_facial_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_foveation
+constexpr FieldDescriptor fields_XrFoveationApplyInfoHTC[] = {
+    FIELD_VALUE(XrFoveationApplyInfoHTC, type),
+    FIELD_XR(XrFoveationApplyInfoHTC, next),
+    FIELD_VALUE(XrFoveationApplyInfoHTC, mode),
+    FIELD_VALUE(XrFoveationApplyInfoHTC, subImageCount),
+    FIELD_PTR(XrFoveationApplyInfoHTC, subImages, subImageCount),
+};
+
+void serialize(const XrFoveationApplyInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationApplyInfoHTC, ctx);
+}
+
+void deserialize(XrFoveationApplyInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationApplyInfoHTC, ctx);
+}
+
+void cleanup(const XrFoveationApplyInfoHTC* s) {
+    cleanup_fields(s, fields_XrFoveationApplyInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrFoveationApplyInfoHTC[] = {
+    FIELD_VALUE(XrFoveationApplyInfoHTC, type),
+    FIELD_XR(XrFoveationApplyInfoHTC, next),
+    FIELD_VALUE(XrFoveationApplyInfoHTC, mode),
+    FIELD_VALUE(XrFoveationApplyInfoHTC, subImageCount),
+    FIELD_PTR(XrFoveationApplyInfoHTC, subImages, subImageCount),
+};
+
+void serialize(const XrFoveationApplyInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationApplyInfoHTC, ctx);
+}
+
+void deserialize(XrFoveationApplyInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationApplyInfoHTC, ctx);
+}
+
+void cleanup(const XrFoveationApplyInfoHTC* s) {
+    cleanup_fields(s, fields_XrFoveationApplyInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrFoveationConfigurationHTC[] = {
+    FIELD_VALUE(XrFoveationConfigurationHTC, level),
+    FIELD_VALUE(XrFoveationConfigurationHTC, clearFovDegree),
+    FIELD_VALUE(XrFoveationConfigurationHTC, focalCenterOffset),
+};
+
+void serialize(const XrFoveationConfigurationHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationConfigurationHTC, ctx);
+}
+
+void deserialize(XrFoveationConfigurationHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationConfigurationHTC, ctx);
+}
+
+void cleanup(const XrFoveationConfigurationHTC* s) {
+    cleanup_fields(s, fields_XrFoveationConfigurationHTC);
+}
+
+constexpr FieldDescriptor fields_XrFoveationCustomModeInfoHTC[] = {
+    FIELD_VALUE(XrFoveationCustomModeInfoHTC, type),
+    FIELD_XR(XrFoveationCustomModeInfoHTC, next),
+    FIELD_VALUE(XrFoveationCustomModeInfoHTC, configCount),
+    FIELD_PTR(XrFoveationCustomModeInfoHTC, configs, configCount),
+};
+
+void serialize(const XrFoveationCustomModeInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationCustomModeInfoHTC, ctx);
+}
+
+void deserialize(XrFoveationCustomModeInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationCustomModeInfoHTC, ctx);
+}
+
+void cleanup(const XrFoveationCustomModeInfoHTC* s) {
+    cleanup_fields(s, fields_XrFoveationCustomModeInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrFoveationCustomModeInfoHTC[] = {
+    FIELD_VALUE(XrFoveationCustomModeInfoHTC, type),
+    FIELD_XR(XrFoveationCustomModeInfoHTC, next),
+    FIELD_VALUE(XrFoveationCustomModeInfoHTC, configCount),
+    FIELD_PTR(XrFoveationCustomModeInfoHTC, configs, configCount),
+};
+
+void serialize(const XrFoveationCustomModeInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationCustomModeInfoHTC, ctx);
+}
+
+void deserialize(XrFoveationCustomModeInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationCustomModeInfoHTC, ctx);
+}
+
+void cleanup(const XrFoveationCustomModeInfoHTC* s) {
+    cleanup_fields(s, fields_XrFoveationCustomModeInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrFoveationDynamicModeInfoHTC[] = {
+    FIELD_VALUE(XrFoveationDynamicModeInfoHTC, type),
+    FIELD_XR(XrFoveationDynamicModeInfoHTC, next),
+    FIELD_VALUE(XrFoveationDynamicModeInfoHTC, dynamicFlags),
+};
+
+void serialize(const XrFoveationDynamicModeInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationDynamicModeInfoHTC, ctx);
+}
+
+void deserialize(XrFoveationDynamicModeInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationDynamicModeInfoHTC, ctx);
+}
+
+void cleanup(const XrFoveationDynamicModeInfoHTC* s) {
+    cleanup_fields(s, fields_XrFoveationDynamicModeInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrFoveationDynamicModeInfoHTC[] = {
+    FIELD_VALUE(XrFoveationDynamicModeInfoHTC, type),
+    FIELD_XR(XrFoveationDynamicModeInfoHTC, next),
+    FIELD_VALUE(XrFoveationDynamicModeInfoHTC, dynamicFlags),
+};
+
+void serialize(const XrFoveationDynamicModeInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationDynamicModeInfoHTC, ctx);
+}
+
+void deserialize(XrFoveationDynamicModeInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationDynamicModeInfoHTC, ctx);
+}
+
+void cleanup(const XrFoveationDynamicModeInfoHTC* s) {
+    cleanup_fields(s, fields_XrFoveationDynamicModeInfoHTC);
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_foveation
+#ifdef XRTRANSPORT_EXT_XR_HTC_passthrough
+constexpr FieldDescriptor fields_XrCompositionLayerPassthroughHTC[] = {
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, type),
+    FIELD_XR(XrCompositionLayerPassthroughHTC, next),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, layerFlags),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, space),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, passthrough),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, color),
+};
+
+void serialize(const XrCompositionLayerPassthroughHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerPassthroughHTC, ctx);
+}
+
+void deserialize(XrCompositionLayerPassthroughHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerPassthroughHTC, ctx);
+}
+
+void cleanup(const XrCompositionLayerPassthroughHTC* s) {
+    cleanup_fields(s, fields_XrCompositionLayerPassthroughHTC);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerPassthroughHTC[] = {
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, type),
+    FIELD_XR(XrCompositionLayerPassthroughHTC, next),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, layerFlags),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, space),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, passthrough),
+    FIELD_VALUE(XrCompositionLayerPassthroughHTC, color),
+};
+
+void serialize(const XrCompositionLayerPassthroughHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerPassthroughHTC, ctx);
+}
+
+void deserialize(XrCompositionLayerPassthroughHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerPassthroughHTC, ctx);
+}
+
+void cleanup(const XrCompositionLayerPassthroughHTC* s) {
+    cleanup_fields(s, fields_XrCompositionLayerPassthroughHTC);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorHTC[] = {
+    FIELD_VALUE(XrPassthroughColorHTC, type),
+    FIELD_XR(XrPassthroughColorHTC, next),
+    FIELD_VALUE(XrPassthroughColorHTC, alpha),
+};
+
+void serialize(const XrPassthroughColorHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorHTC, ctx);
+}
+
+void deserialize(XrPassthroughColorHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorHTC, ctx);
+}
+
+void cleanup(const XrPassthroughColorHTC* s) {
+    cleanup_fields(s, fields_XrPassthroughColorHTC);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorHTC[] = {
+    FIELD_VALUE(XrPassthroughColorHTC, type),
+    FIELD_XR(XrPassthroughColorHTC, next),
+    FIELD_VALUE(XrPassthroughColorHTC, alpha),
+};
+
+void serialize(const XrPassthroughColorHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorHTC, ctx);
+}
+
+void deserialize(XrPassthroughColorHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorHTC, ctx);
+}
+
+void cleanup(const XrPassthroughColorHTC* s) {
+    cleanup_fields(s, fields_XrPassthroughColorHTC);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughCreateInfoHTC[] = {
+    FIELD_VALUE(XrPassthroughCreateInfoHTC, type),
+    FIELD_XR(XrPassthroughCreateInfoHTC, next),
+    FIELD_VALUE(XrPassthroughCreateInfoHTC, form),
+};
+
+void serialize(const XrPassthroughCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughCreateInfoHTC, ctx);
+}
+
+void deserialize(XrPassthroughCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrPassthroughCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrPassthroughCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughCreateInfoHTC[] = {
+    FIELD_VALUE(XrPassthroughCreateInfoHTC, type),
+    FIELD_XR(XrPassthroughCreateInfoHTC, next),
+    FIELD_VALUE(XrPassthroughCreateInfoHTC, form),
+};
+
+void serialize(const XrPassthroughCreateInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughCreateInfoHTC, ctx);
+}
+
+void deserialize(XrPassthroughCreateInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughCreateInfoHTC, ctx);
+}
+
+void cleanup(const XrPassthroughCreateInfoHTC* s) {
+    cleanup_fields(s, fields_XrPassthroughCreateInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughMeshTransformInfoHTC[] = {
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, type),
+    FIELD_XR(XrPassthroughMeshTransformInfoHTC, next),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, vertexCount),
+    FIELD_PTR(XrPassthroughMeshTransformInfoHTC, vertices, vertexCount),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, indexCount),
+    FIELD_PTR(XrPassthroughMeshTransformInfoHTC, indices, indexCount),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, baseSpace),
+    FIELD_TIME(XrPassthroughMeshTransformInfoHTC, time),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, pose),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, scale),
+};
+
+void serialize(const XrPassthroughMeshTransformInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughMeshTransformInfoHTC, ctx);
+}
+
+void deserialize(XrPassthroughMeshTransformInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughMeshTransformInfoHTC, ctx);
+}
+
+void cleanup(const XrPassthroughMeshTransformInfoHTC* s) {
+    cleanup_fields(s, fields_XrPassthroughMeshTransformInfoHTC);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughMeshTransformInfoHTC[] = {
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, type),
+    FIELD_XR(XrPassthroughMeshTransformInfoHTC, next),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, vertexCount),
+    FIELD_PTR(XrPassthroughMeshTransformInfoHTC, vertices, vertexCount),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, indexCount),
+    FIELD_PTR(XrPassthroughMeshTransformInfoHTC, indices, indexCount),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, baseSpace),
+    FIELD_TIME(XrPassthroughMeshTransformInfoHTC, time),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, pose),
+    FIELD_VALUE(XrPassthroughMeshTransformInfoHTC, scale),
+};
+
+void serialize(const XrPassthroughMeshTransformInfoHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughMeshTransformInfoHTC, ctx);
+}
+
+void deserialize(XrPassthroughMeshTransformInfoHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughMeshTransformInfoHTC, ctx);
+}
+
+void cleanup(const XrPassthroughMeshTransformInfoHTC* s) {
+    cleanup_fields(s, fields_XrPassthroughMeshTransformInfoHTC);
+}
+
+#endif // XRTRANSPORT_EXT_XR_HTC_passthrough
+#ifdef XRTRANSPORT_EXT_XR_KHR_D3D11_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingD3D11KHR[] = {
+    FIELD_VALUE(XrGraphicsBindingD3D11KHR, type),
+    FIELD_XR(XrGraphicsBindingD3D11KHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingD3D11KHR, device),
+};
+
+void serialize(const XrGraphicsBindingD3D11KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingD3D11KHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingD3D11KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingD3D11KHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingD3D11KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingD3D11KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingD3D11KHR[] = {
+    FIELD_VALUE(XrGraphicsBindingD3D11KHR, type),
+    FIELD_XR(XrGraphicsBindingD3D11KHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingD3D11KHR, device),
+};
+
+void serialize(const XrGraphicsBindingD3D11KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingD3D11KHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingD3D11KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingD3D11KHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingD3D11KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingD3D11KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsD3D11KHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsD3D11KHR, type),
+    FIELD_XR(XrGraphicsRequirementsD3D11KHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsD3D11KHR, adapterLuid),
+    FIELD_VALUE(XrGraphicsRequirementsD3D11KHR, minFeatureLevel),
+};
+
+void serialize(const XrGraphicsRequirementsD3D11KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsD3D11KHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsD3D11KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsD3D11KHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsD3D11KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsD3D11KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsD3D11KHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsD3D11KHR, type),
+    FIELD_XR(XrGraphicsRequirementsD3D11KHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsD3D11KHR, adapterLuid),
+    FIELD_VALUE(XrGraphicsRequirementsD3D11KHR, minFeatureLevel),
+};
+
+void serialize(const XrGraphicsRequirementsD3D11KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsD3D11KHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsD3D11KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsD3D11KHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsD3D11KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsD3D11KHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageD3D11KHR[] = {
+    FIELD_VALUE(XrSwapchainImageD3D11KHR, type),
+    FIELD_XR(XrSwapchainImageD3D11KHR, next),
+    FIELD_SINGLE_PTR(XrSwapchainImageD3D11KHR, texture),
+};
+
+void serialize(const XrSwapchainImageD3D11KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageD3D11KHR, ctx);
+}
+
+void deserialize(XrSwapchainImageD3D11KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageD3D11KHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageD3D11KHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageD3D11KHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageD3D11KHR[] = {
+    FIELD_VALUE(XrSwapchainImageD3D11KHR, type),
+    FIELD_XR(XrSwapchainImageD3D11KHR, next),
+    FIELD_SINGLE_PTR(XrSwapchainImageD3D11KHR, texture),
+};
+
+void serialize(const XrSwapchainImageD3D11KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageD3D11KHR, ctx);
+}
+
+void deserialize(XrSwapchainImageD3D11KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageD3D11KHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageD3D11KHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageD3D11KHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_D3D11_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_D3D12_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingD3D12KHR[] = {
+    FIELD_VALUE(XrGraphicsBindingD3D12KHR, type),
+    FIELD_XR(XrGraphicsBindingD3D12KHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingD3D12KHR, device),
+    FIELD_SINGLE_PTR(XrGraphicsBindingD3D12KHR, queue),
+};
+
+void serialize(const XrGraphicsBindingD3D12KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingD3D12KHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingD3D12KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingD3D12KHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingD3D12KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingD3D12KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingD3D12KHR[] = {
+    FIELD_VALUE(XrGraphicsBindingD3D12KHR, type),
+    FIELD_XR(XrGraphicsBindingD3D12KHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingD3D12KHR, device),
+    FIELD_SINGLE_PTR(XrGraphicsBindingD3D12KHR, queue),
+};
+
+void serialize(const XrGraphicsBindingD3D12KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingD3D12KHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingD3D12KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingD3D12KHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingD3D12KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingD3D12KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsD3D12KHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsD3D12KHR, type),
+    FIELD_XR(XrGraphicsRequirementsD3D12KHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsD3D12KHR, adapterLuid),
+    FIELD_VALUE(XrGraphicsRequirementsD3D12KHR, minFeatureLevel),
+};
+
+void serialize(const XrGraphicsRequirementsD3D12KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsD3D12KHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsD3D12KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsD3D12KHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsD3D12KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsD3D12KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsD3D12KHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsD3D12KHR, type),
+    FIELD_XR(XrGraphicsRequirementsD3D12KHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsD3D12KHR, adapterLuid),
+    FIELD_VALUE(XrGraphicsRequirementsD3D12KHR, minFeatureLevel),
+};
+
+void serialize(const XrGraphicsRequirementsD3D12KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsD3D12KHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsD3D12KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsD3D12KHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsD3D12KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsD3D12KHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageD3D12KHR[] = {
+    FIELD_VALUE(XrSwapchainImageD3D12KHR, type),
+    FIELD_XR(XrSwapchainImageD3D12KHR, next),
+    FIELD_SINGLE_PTR(XrSwapchainImageD3D12KHR, texture),
+};
+
+void serialize(const XrSwapchainImageD3D12KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageD3D12KHR, ctx);
+}
+
+void deserialize(XrSwapchainImageD3D12KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageD3D12KHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageD3D12KHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageD3D12KHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageD3D12KHR[] = {
+    FIELD_VALUE(XrSwapchainImageD3D12KHR, type),
+    FIELD_XR(XrSwapchainImageD3D12KHR, next),
+    FIELD_SINGLE_PTR(XrSwapchainImageD3D12KHR, texture),
+};
+
+void serialize(const XrSwapchainImageD3D12KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageD3D12KHR, ctx);
+}
+
+void deserialize(XrSwapchainImageD3D12KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageD3D12KHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageD3D12KHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageD3D12KHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_D3D12_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_android_create_instance
+constexpr FieldDescriptor fields_XrInstanceCreateInfoAndroidKHR[] = {
+    FIELD_VALUE(XrInstanceCreateInfoAndroidKHR, type),
+    FIELD_XR(XrInstanceCreateInfoAndroidKHR, next),
+    FIELD_SINGLE_PTR(XrInstanceCreateInfoAndroidKHR, applicationVM),
+    FIELD_SINGLE_PTR(XrInstanceCreateInfoAndroidKHR, applicationActivity),
+};
+
+void serialize(const XrInstanceCreateInfoAndroidKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInstanceCreateInfoAndroidKHR, ctx);
+}
+
+void deserialize(XrInstanceCreateInfoAndroidKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInstanceCreateInfoAndroidKHR, ctx);
+}
+
+void cleanup(const XrInstanceCreateInfoAndroidKHR* s) {
+    cleanup_fields(s, fields_XrInstanceCreateInfoAndroidKHR);
+}
+
+constexpr FieldDescriptor fields_XrInstanceCreateInfoAndroidKHR[] = {
+    FIELD_VALUE(XrInstanceCreateInfoAndroidKHR, type),
+    FIELD_XR(XrInstanceCreateInfoAndroidKHR, next),
+    FIELD_SINGLE_PTR(XrInstanceCreateInfoAndroidKHR, applicationVM),
+    FIELD_SINGLE_PTR(XrInstanceCreateInfoAndroidKHR, applicationActivity),
+};
+
+void serialize(const XrInstanceCreateInfoAndroidKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInstanceCreateInfoAndroidKHR, ctx);
+}
+
+void deserialize(XrInstanceCreateInfoAndroidKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInstanceCreateInfoAndroidKHR, ctx);
+}
+
+void cleanup(const XrInstanceCreateInfoAndroidKHR* s) {
+    cleanup_fields(s, fields_XrInstanceCreateInfoAndroidKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_android_create_instance
+#ifdef XRTRANSPORT_EXT_XR_KHR_binding_modification
+constexpr FieldDescriptor fields_XrBindingModificationBaseHeaderKHR[] = {
+    FIELD_VALUE(XrBindingModificationBaseHeaderKHR, type),
+    FIELD_XR(XrBindingModificationBaseHeaderKHR, next),
+};
+
+void serialize(const XrBindingModificationBaseHeaderKHR* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrBindingModificationBaseHeaderKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBindingModificationBaseHeaderKHR, ctx);
+}
+
+void cleanup(const XrBindingModificationBaseHeaderKHR* s) {
+    cleanup_fields(s, fields_XrBindingModificationBaseHeaderKHR);
+}
+
+constexpr FieldDescriptor fields_XrBindingModificationsKHR[] = {
+    FIELD_VALUE(XrBindingModificationsKHR, type),
+    FIELD_XR(XrBindingModificationsKHR, next),
+    FIELD_VALUE(XrBindingModificationsKHR, bindingModificationCount),
+    #error "auto-generator doesn't support double pointers (XrBindingModificationsKHR::bindingModifications)"
+};
+
+void serialize(const XrBindingModificationsKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBindingModificationsKHR, ctx);
+}
+
+void deserialize(XrBindingModificationsKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBindingModificationsKHR, ctx);
+}
+
+void cleanup(const XrBindingModificationsKHR* s) {
+    cleanup_fields(s, fields_XrBindingModificationsKHR);
+}
+
+constexpr FieldDescriptor fields_XrBindingModificationsKHR[] = {
+    FIELD_VALUE(XrBindingModificationsKHR, type),
+    FIELD_XR(XrBindingModificationsKHR, next),
+    FIELD_VALUE(XrBindingModificationsKHR, bindingModificationCount),
+    #error "auto-generator doesn't support double pointers (XrBindingModificationsKHR::bindingModifications)"
+};
+
+void serialize(const XrBindingModificationsKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBindingModificationsKHR, ctx);
+}
+
+void deserialize(XrBindingModificationsKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBindingModificationsKHR, ctx);
+}
+
+void cleanup(const XrBindingModificationsKHR* s) {
+    cleanup_fields(s, fields_XrBindingModificationsKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_binding_modification
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_color_scale_bias
+constexpr FieldDescriptor fields_XrCompositionLayerColorScaleBiasKHR[] = {
+    FIELD_VALUE(XrCompositionLayerColorScaleBiasKHR, type),
+    FIELD_XR(XrCompositionLayerColorScaleBiasKHR, next),
+    FIELD_VALUE(XrCompositionLayerColorScaleBiasKHR, colorScale),
+    FIELD_VALUE(XrCompositionLayerColorScaleBiasKHR, colorBias),
+};
+
+void serialize(const XrCompositionLayerColorScaleBiasKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerColorScaleBiasKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerColorScaleBiasKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerColorScaleBiasKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerColorScaleBiasKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerColorScaleBiasKHR);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerColorScaleBiasKHR[] = {
+    FIELD_VALUE(XrCompositionLayerColorScaleBiasKHR, type),
+    FIELD_XR(XrCompositionLayerColorScaleBiasKHR, next),
+    FIELD_VALUE(XrCompositionLayerColorScaleBiasKHR, colorScale),
+    FIELD_VALUE(XrCompositionLayerColorScaleBiasKHR, colorBias),
+};
+
+void serialize(const XrCompositionLayerColorScaleBiasKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerColorScaleBiasKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerColorScaleBiasKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerColorScaleBiasKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerColorScaleBiasKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerColorScaleBiasKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_color_scale_bias
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_cube
+constexpr FieldDescriptor fields_XrCompositionLayerCubeKHR[] = {
+    FIELD_VALUE(XrCompositionLayerCubeKHR, type),
+    FIELD_XR(XrCompositionLayerCubeKHR, next),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, space),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, swapchain),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, imageArrayIndex),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, orientation),
+};
+
+void serialize(const XrCompositionLayerCubeKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerCubeKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerCubeKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerCubeKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerCubeKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerCubeKHR);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerCubeKHR[] = {
+    FIELD_VALUE(XrCompositionLayerCubeKHR, type),
+    FIELD_XR(XrCompositionLayerCubeKHR, next),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, space),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, swapchain),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, imageArrayIndex),
+    FIELD_VALUE(XrCompositionLayerCubeKHR, orientation),
+};
+
+void serialize(const XrCompositionLayerCubeKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerCubeKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerCubeKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerCubeKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerCubeKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerCubeKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_cube
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_cylinder
+constexpr FieldDescriptor fields_XrCompositionLayerCylinderKHR[] = {
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, type),
+    FIELD_XR(XrCompositionLayerCylinderKHR, next),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, space),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, subImage),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, pose),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, radius),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, centralAngle),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, aspectRatio),
+};
+
+void serialize(const XrCompositionLayerCylinderKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerCylinderKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerCylinderKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerCylinderKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerCylinderKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerCylinderKHR);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerCylinderKHR[] = {
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, type),
+    FIELD_XR(XrCompositionLayerCylinderKHR, next),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, space),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, subImage),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, pose),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, radius),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, centralAngle),
+    FIELD_VALUE(XrCompositionLayerCylinderKHR, aspectRatio),
+};
+
+void serialize(const XrCompositionLayerCylinderKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerCylinderKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerCylinderKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerCylinderKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerCylinderKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerCylinderKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_cylinder
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_depth
+constexpr FieldDescriptor fields_XrCompositionLayerDepthInfoKHR[] = {
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, type),
+    FIELD_XR(XrCompositionLayerDepthInfoKHR, next),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, subImage),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, minDepth),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, maxDepth),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, nearZ),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, farZ),
+};
+
+void serialize(const XrCompositionLayerDepthInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerDepthInfoKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerDepthInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerDepthInfoKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerDepthInfoKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerDepthInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerDepthInfoKHR[] = {
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, type),
+    FIELD_XR(XrCompositionLayerDepthInfoKHR, next),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, subImage),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, minDepth),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, maxDepth),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, nearZ),
+    FIELD_VALUE(XrCompositionLayerDepthInfoKHR, farZ),
+};
+
+void serialize(const XrCompositionLayerDepthInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerDepthInfoKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerDepthInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerDepthInfoKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerDepthInfoKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerDepthInfoKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_depth
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect
+constexpr FieldDescriptor fields_XrCompositionLayerEquirectKHR[] = {
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, type),
+    FIELD_XR(XrCompositionLayerEquirectKHR, next),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, space),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, subImage),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, pose),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, radius),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, scale),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, bias),
+};
+
+void serialize(const XrCompositionLayerEquirectKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerEquirectKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerEquirectKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerEquirectKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerEquirectKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerEquirectKHR);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerEquirectKHR[] = {
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, type),
+    FIELD_XR(XrCompositionLayerEquirectKHR, next),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, space),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, subImage),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, pose),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, radius),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, scale),
+    FIELD_VALUE(XrCompositionLayerEquirectKHR, bias),
+};
+
+void serialize(const XrCompositionLayerEquirectKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerEquirectKHR, ctx);
+}
+
+void deserialize(XrCompositionLayerEquirectKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerEquirectKHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerEquirectKHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerEquirectKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect
+#ifdef XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect2
+constexpr FieldDescriptor fields_XrCompositionLayerEquirect2KHR[] = {
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, type),
+    FIELD_XR(XrCompositionLayerEquirect2KHR, next),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, space),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, subImage),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, pose),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, radius),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, centralHorizontalAngle),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, upperVerticalAngle),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, lowerVerticalAngle),
+};
+
+void serialize(const XrCompositionLayerEquirect2KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerEquirect2KHR, ctx);
+}
+
+void deserialize(XrCompositionLayerEquirect2KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerEquirect2KHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerEquirect2KHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerEquirect2KHR);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerEquirect2KHR[] = {
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, type),
+    FIELD_XR(XrCompositionLayerEquirect2KHR, next),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, layerFlags),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, space),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, subImage),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, pose),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, radius),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, centralHorizontalAngle),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, upperVerticalAngle),
+    FIELD_VALUE(XrCompositionLayerEquirect2KHR, lowerVerticalAngle),
+};
+
+void serialize(const XrCompositionLayerEquirect2KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerEquirect2KHR, ctx);
+}
+
+void deserialize(XrCompositionLayerEquirect2KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerEquirect2KHR, ctx);
+}
+
+void cleanup(const XrCompositionLayerEquirect2KHR* s) {
+    cleanup_fields(s, fields_XrCompositionLayerEquirect2KHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_composition_layer_equirect2
+#ifdef XRTRANSPORT_EXT_XR_KHR_loader_init
+constexpr FieldDescriptor fields_XrLoaderInitInfoBaseHeaderKHR[] = {
+    FIELD_VALUE(XrLoaderInitInfoBaseHeaderKHR, type),
+    FIELD_XR(XrLoaderInitInfoBaseHeaderKHR, next),
+};
+
+void serialize(const XrLoaderInitInfoBaseHeaderKHR* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrLoaderInitInfoBaseHeaderKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLoaderInitInfoBaseHeaderKHR, ctx);
+}
+
+void cleanup(const XrLoaderInitInfoBaseHeaderKHR* s) {
+    cleanup_fields(s, fields_XrLoaderInitInfoBaseHeaderKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_loader_init
+#ifdef XRTRANSPORT_EXT_XR_KHR_loader_init_android
+constexpr FieldDescriptor fields_XrLoaderInitInfoAndroidKHR[] = {
+    FIELD_VALUE(XrLoaderInitInfoAndroidKHR, type),
+    FIELD_XR(XrLoaderInitInfoAndroidKHR, next),
+    FIELD_SINGLE_PTR(XrLoaderInitInfoAndroidKHR, applicationVM),
+    FIELD_SINGLE_PTR(XrLoaderInitInfoAndroidKHR, applicationContext),
+};
+
+void serialize(const XrLoaderInitInfoAndroidKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLoaderInitInfoAndroidKHR, ctx);
+}
+
+void deserialize(XrLoaderInitInfoAndroidKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLoaderInitInfoAndroidKHR, ctx);
+}
+
+void cleanup(const XrLoaderInitInfoAndroidKHR* s) {
+    cleanup_fields(s, fields_XrLoaderInitInfoAndroidKHR);
+}
+
+constexpr FieldDescriptor fields_XrLoaderInitInfoAndroidKHR[] = {
+    FIELD_VALUE(XrLoaderInitInfoAndroidKHR, type),
+    FIELD_XR(XrLoaderInitInfoAndroidKHR, next),
+    FIELD_SINGLE_PTR(XrLoaderInitInfoAndroidKHR, applicationVM),
+    FIELD_SINGLE_PTR(XrLoaderInitInfoAndroidKHR, applicationContext),
+};
+
+void serialize(const XrLoaderInitInfoAndroidKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLoaderInitInfoAndroidKHR, ctx);
+}
+
+void deserialize(XrLoaderInitInfoAndroidKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLoaderInitInfoAndroidKHR, ctx);
+}
+
+void cleanup(const XrLoaderInitInfoAndroidKHR* s) {
+    cleanup_fields(s, fields_XrLoaderInitInfoAndroidKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_loader_init_android
+#ifdef XRTRANSPORT_EXT_XR_KHR_metal_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingMetalKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingMetalKHR, type),
+    FIELD_XR(XrGraphicsBindingMetalKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingMetalKHR, commandQueue),
+};
+
+void serialize(const XrGraphicsBindingMetalKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingMetalKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingMetalKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingMetalKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingMetalKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingMetalKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingMetalKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingMetalKHR, type),
+    FIELD_XR(XrGraphicsBindingMetalKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingMetalKHR, commandQueue),
+};
+
+void serialize(const XrGraphicsBindingMetalKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingMetalKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingMetalKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingMetalKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingMetalKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingMetalKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsMetalKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsMetalKHR, type),
+    FIELD_XR(XrGraphicsRequirementsMetalKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsRequirementsMetalKHR, metalDevice),
+};
+
+void serialize(const XrGraphicsRequirementsMetalKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsMetalKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsMetalKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsMetalKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsMetalKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsMetalKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsMetalKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsMetalKHR, type),
+    FIELD_XR(XrGraphicsRequirementsMetalKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsRequirementsMetalKHR, metalDevice),
+};
+
+void serialize(const XrGraphicsRequirementsMetalKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsMetalKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsMetalKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsMetalKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsMetalKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsMetalKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageMetalKHR[] = {
+    FIELD_VALUE(XrSwapchainImageMetalKHR, type),
+    FIELD_XR(XrSwapchainImageMetalKHR, next),
+    FIELD_SINGLE_PTR(XrSwapchainImageMetalKHR, texture),
+};
+
+void serialize(const XrSwapchainImageMetalKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageMetalKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageMetalKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageMetalKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageMetalKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageMetalKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageMetalKHR[] = {
+    FIELD_VALUE(XrSwapchainImageMetalKHR, type),
+    FIELD_XR(XrSwapchainImageMetalKHR, next),
+    FIELD_SINGLE_PTR(XrSwapchainImageMetalKHR, texture),
+};
+
+void serialize(const XrSwapchainImageMetalKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageMetalKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageMetalKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageMetalKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageMetalKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageMetalKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_metal_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_opengl_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLWaylandKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLWaylandKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLWaylandKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingOpenGLWaylandKHR, display),
+};
+
+void serialize(const XrGraphicsBindingOpenGLWaylandKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLWaylandKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLWaylandKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLWaylandKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLWaylandKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLWaylandKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLWaylandKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLWaylandKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLWaylandKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingOpenGLWaylandKHR, display),
+};
+
+void serialize(const XrGraphicsBindingOpenGLWaylandKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLWaylandKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLWaylandKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLWaylandKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLWaylandKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLWaylandKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLWin32KHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLWin32KHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLWin32KHR, next),
+    FIELD_VALUE(XrGraphicsBindingOpenGLWin32KHR, hDC),
+    FIELD_VALUE(XrGraphicsBindingOpenGLWin32KHR, hGLRC),
+};
+
+void serialize(const XrGraphicsBindingOpenGLWin32KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLWin32KHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLWin32KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLWin32KHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLWin32KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLWin32KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLWin32KHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLWin32KHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLWin32KHR, next),
+    FIELD_VALUE(XrGraphicsBindingOpenGLWin32KHR, hDC),
+    FIELD_VALUE(XrGraphicsBindingOpenGLWin32KHR, hGLRC),
+};
+
+void serialize(const XrGraphicsBindingOpenGLWin32KHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLWin32KHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLWin32KHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLWin32KHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLWin32KHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLWin32KHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLXcbKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLXcbKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingOpenGLXcbKHR, connection),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, screenNumber),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, fbconfigid),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, visualid),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, glxDrawable),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, glxContext),
+};
+
+void serialize(const XrGraphicsBindingOpenGLXcbKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLXcbKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLXcbKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLXcbKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLXcbKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLXcbKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLXcbKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLXcbKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingOpenGLXcbKHR, connection),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, screenNumber),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, fbconfigid),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, visualid),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, glxDrawable),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXcbKHR, glxContext),
+};
+
+void serialize(const XrGraphicsBindingOpenGLXcbKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLXcbKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLXcbKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLXcbKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLXcbKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLXcbKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLXlibKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLXlibKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingOpenGLXlibKHR, xDisplay),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, visualid),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, glxFBConfig),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, glxDrawable),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, glxContext),
+};
+
+void serialize(const XrGraphicsBindingOpenGLXlibKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLXlibKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLXlibKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLXlibKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLXlibKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLXlibKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLXlibKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLXlibKHR, next),
+    FIELD_SINGLE_PTR(XrGraphicsBindingOpenGLXlibKHR, xDisplay),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, visualid),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, glxFBConfig),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, glxDrawable),
+    FIELD_VALUE(XrGraphicsBindingOpenGLXlibKHR, glxContext),
+};
+
+void serialize(const XrGraphicsBindingOpenGLXlibKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLXlibKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLXlibKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLXlibKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLXlibKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLXlibKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsOpenGLKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLKHR, type),
+    FIELD_XR(XrGraphicsRequirementsOpenGLKHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLKHR, minApiVersionSupported),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLKHR, maxApiVersionSupported),
+};
+
+void serialize(const XrGraphicsRequirementsOpenGLKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsOpenGLKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsOpenGLKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsOpenGLKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsOpenGLKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsOpenGLKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsOpenGLKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLKHR, type),
+    FIELD_XR(XrGraphicsRequirementsOpenGLKHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLKHR, minApiVersionSupported),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLKHR, maxApiVersionSupported),
+};
+
+void serialize(const XrGraphicsRequirementsOpenGLKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsOpenGLKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsOpenGLKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsOpenGLKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsOpenGLKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsOpenGLKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageOpenGLKHR[] = {
+    FIELD_VALUE(XrSwapchainImageOpenGLKHR, type),
+    FIELD_XR(XrSwapchainImageOpenGLKHR, next),
+    FIELD_VALUE(XrSwapchainImageOpenGLKHR, image),
+};
+
+void serialize(const XrSwapchainImageOpenGLKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageOpenGLKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageOpenGLKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageOpenGLKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageOpenGLKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageOpenGLKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageOpenGLKHR[] = {
+    FIELD_VALUE(XrSwapchainImageOpenGLKHR, type),
+    FIELD_XR(XrSwapchainImageOpenGLKHR, next),
+    FIELD_VALUE(XrSwapchainImageOpenGLKHR, image),
+};
+
+void serialize(const XrSwapchainImageOpenGLKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageOpenGLKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageOpenGLKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageOpenGLKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageOpenGLKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageOpenGLKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_opengl_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_opengl_es_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLESAndroidKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLESAndroidKHR, next),
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, display),
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, config),
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, context),
+};
+
+void serialize(const XrGraphicsBindingOpenGLESAndroidKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLESAndroidKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLESAndroidKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLESAndroidKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLESAndroidKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLESAndroidKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingOpenGLESAndroidKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, type),
+    FIELD_XR(XrGraphicsBindingOpenGLESAndroidKHR, next),
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, display),
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, config),
+    FIELD_VALUE(XrGraphicsBindingOpenGLESAndroidKHR, context),
+};
+
+void serialize(const XrGraphicsBindingOpenGLESAndroidKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingOpenGLESAndroidKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingOpenGLESAndroidKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingOpenGLESAndroidKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingOpenGLESAndroidKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingOpenGLESAndroidKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsOpenGLESKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLESKHR, type),
+    FIELD_XR(XrGraphicsRequirementsOpenGLESKHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLESKHR, minApiVersionSupported),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLESKHR, maxApiVersionSupported),
+};
+
+void serialize(const XrGraphicsRequirementsOpenGLESKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsOpenGLESKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsOpenGLESKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsOpenGLESKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsOpenGLESKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsOpenGLESKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsOpenGLESKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLESKHR, type),
+    FIELD_XR(XrGraphicsRequirementsOpenGLESKHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLESKHR, minApiVersionSupported),
+    FIELD_VALUE(XrGraphicsRequirementsOpenGLESKHR, maxApiVersionSupported),
+};
+
+void serialize(const XrGraphicsRequirementsOpenGLESKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsOpenGLESKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsOpenGLESKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsOpenGLESKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsOpenGLESKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsOpenGLESKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageOpenGLESKHR[] = {
+    FIELD_VALUE(XrSwapchainImageOpenGLESKHR, type),
+    FIELD_XR(XrSwapchainImageOpenGLESKHR, next),
+    FIELD_VALUE(XrSwapchainImageOpenGLESKHR, image),
+};
+
+void serialize(const XrSwapchainImageOpenGLESKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageOpenGLESKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageOpenGLESKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageOpenGLESKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageOpenGLESKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageOpenGLESKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageOpenGLESKHR[] = {
+    FIELD_VALUE(XrSwapchainImageOpenGLESKHR, type),
+    FIELD_XR(XrSwapchainImageOpenGLESKHR, next),
+    FIELD_VALUE(XrSwapchainImageOpenGLESKHR, image),
+};
+
+void serialize(const XrSwapchainImageOpenGLESKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageOpenGLESKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageOpenGLESKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageOpenGLESKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageOpenGLESKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageOpenGLESKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_opengl_es_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_visibility_mask
+constexpr FieldDescriptor fields_XrEventDataVisibilityMaskChangedKHR[] = {
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, type),
+    FIELD_XR(XrEventDataVisibilityMaskChangedKHR, next),
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, session),
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, viewConfigurationType),
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, viewIndex),
+};
+
+void serialize(const XrEventDataVisibilityMaskChangedKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVisibilityMaskChangedKHR, ctx);
+}
+
+void deserialize(XrEventDataVisibilityMaskChangedKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVisibilityMaskChangedKHR, ctx);
+}
+
+void cleanup(const XrEventDataVisibilityMaskChangedKHR* s) {
+    cleanup_fields(s, fields_XrEventDataVisibilityMaskChangedKHR);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVisibilityMaskChangedKHR[] = {
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, type),
+    FIELD_XR(XrEventDataVisibilityMaskChangedKHR, next),
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, session),
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, viewConfigurationType),
+    FIELD_VALUE(XrEventDataVisibilityMaskChangedKHR, viewIndex),
+};
+
+void serialize(const XrEventDataVisibilityMaskChangedKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVisibilityMaskChangedKHR, ctx);
+}
+
+void deserialize(XrEventDataVisibilityMaskChangedKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVisibilityMaskChangedKHR, ctx);
+}
+
+void cleanup(const XrEventDataVisibilityMaskChangedKHR* s) {
+    cleanup_fields(s, fields_XrEventDataVisibilityMaskChangedKHR);
+}
+
+constexpr FieldDescriptor fields_XrVisibilityMaskKHR[] = {
+    FIELD_VALUE(XrVisibilityMaskKHR, type),
+    FIELD_XR(XrVisibilityMaskKHR, next),
+    FIELD_VALUE(XrVisibilityMaskKHR, vertexCapacityInput),
+    FIELD_VALUE(XrVisibilityMaskKHR, vertexCountOutput),
+    FIELD_PTR(XrVisibilityMaskKHR, vertices, vertexCapacityInput),
+    FIELD_VALUE(XrVisibilityMaskKHR, indexCapacityInput),
+    FIELD_VALUE(XrVisibilityMaskKHR, indexCountOutput),
+    FIELD_PTR(XrVisibilityMaskKHR, indices, indexCapacityInput),
+};
+
+void serialize(const XrVisibilityMaskKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVisibilityMaskKHR, ctx);
+}
+
+void deserialize(XrVisibilityMaskKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVisibilityMaskKHR, ctx);
+}
+
+void cleanup(const XrVisibilityMaskKHR* s) {
+    cleanup_fields(s, fields_XrVisibilityMaskKHR);
+}
+
+constexpr FieldDescriptor fields_XrVisibilityMaskKHR[] = {
+    FIELD_VALUE(XrVisibilityMaskKHR, type),
+    FIELD_XR(XrVisibilityMaskKHR, next),
+    FIELD_VALUE(XrVisibilityMaskKHR, vertexCapacityInput),
+    FIELD_VALUE(XrVisibilityMaskKHR, vertexCountOutput),
+    FIELD_PTR(XrVisibilityMaskKHR, vertices, vertexCapacityInput),
+    FIELD_VALUE(XrVisibilityMaskKHR, indexCapacityInput),
+    FIELD_VALUE(XrVisibilityMaskKHR, indexCountOutput),
+    FIELD_PTR(XrVisibilityMaskKHR, indices, indexCapacityInput),
+};
+
+void serialize(const XrVisibilityMaskKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVisibilityMaskKHR, ctx);
+}
+
+void deserialize(XrVisibilityMaskKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVisibilityMaskKHR, ctx);
+}
+
+void cleanup(const XrVisibilityMaskKHR* s) {
+    cleanup_fields(s, fields_XrVisibilityMaskKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_visibility_mask
+#ifdef XRTRANSPORT_EXT_XR_KHR_vulkan_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingVulkanKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, type),
+    FIELD_XR(XrGraphicsBindingVulkanKHR, next),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, instance),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, physicalDevice),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, device),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, queueFamilyIndex),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, queueIndex),
+};
+
+void serialize(const XrGraphicsBindingVulkanKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingVulkanKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingVulkanKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingVulkanKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingVulkanKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingVulkanKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingVulkanKHR[] = {
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, type),
+    FIELD_XR(XrGraphicsBindingVulkanKHR, next),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, instance),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, physicalDevice),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, device),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, queueFamilyIndex),
+    FIELD_VALUE(XrGraphicsBindingVulkanKHR, queueIndex),
+};
+
+void serialize(const XrGraphicsBindingVulkanKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingVulkanKHR, ctx);
+}
+
+void deserialize(XrGraphicsBindingVulkanKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingVulkanKHR, ctx);
+}
+
+void cleanup(const XrGraphicsBindingVulkanKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingVulkanKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsVulkanKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsVulkanKHR, type),
+    FIELD_XR(XrGraphicsRequirementsVulkanKHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsVulkanKHR, minApiVersionSupported),
+    FIELD_VALUE(XrGraphicsRequirementsVulkanKHR, maxApiVersionSupported),
+};
+
+void serialize(const XrGraphicsRequirementsVulkanKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsVulkanKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsVulkanKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsVulkanKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsVulkanKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsVulkanKHR);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsRequirementsVulkanKHR[] = {
+    FIELD_VALUE(XrGraphicsRequirementsVulkanKHR, type),
+    FIELD_XR(XrGraphicsRequirementsVulkanKHR, next),
+    FIELD_VALUE(XrGraphicsRequirementsVulkanKHR, minApiVersionSupported),
+    FIELD_VALUE(XrGraphicsRequirementsVulkanKHR, maxApiVersionSupported),
+};
+
+void serialize(const XrGraphicsRequirementsVulkanKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsRequirementsVulkanKHR, ctx);
+}
+
+void deserialize(XrGraphicsRequirementsVulkanKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsRequirementsVulkanKHR, ctx);
+}
+
+void cleanup(const XrGraphicsRequirementsVulkanKHR* s) {
+    cleanup_fields(s, fields_XrGraphicsRequirementsVulkanKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageVulkanKHR[] = {
+    FIELD_VALUE(XrSwapchainImageVulkanKHR, type),
+    FIELD_XR(XrSwapchainImageVulkanKHR, next),
+    FIELD_VALUE(XrSwapchainImageVulkanKHR, image),
+};
+
+void serialize(const XrSwapchainImageVulkanKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageVulkanKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageVulkanKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageVulkanKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageVulkanKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageVulkanKHR);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageVulkanKHR[] = {
+    FIELD_VALUE(XrSwapchainImageVulkanKHR, type),
+    FIELD_XR(XrSwapchainImageVulkanKHR, next),
+    FIELD_VALUE(XrSwapchainImageVulkanKHR, image),
+};
+
+void serialize(const XrSwapchainImageVulkanKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageVulkanKHR, ctx);
+}
+
+void deserialize(XrSwapchainImageVulkanKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageVulkanKHR, ctx);
+}
+
+void cleanup(const XrSwapchainImageVulkanKHR* s) {
+    cleanup_fields(s, fields_XrSwapchainImageVulkanKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_vulkan_enable
+#ifdef XRTRANSPORT_EXT_XR_KHR_vulkan_enable2
+constexpr FieldDescriptor fields_XrVulkanDeviceCreateInfoKHR[] = {
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, type),
+    FIELD_XR(XrVulkanDeviceCreateInfoKHR, next),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, systemId),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, createFlags),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, pfnGetInstanceProcAddr),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, vulkanPhysicalDevice),
+    FIELD_SINGLE_PTR(XrVulkanDeviceCreateInfoKHR, vulkanCreateInfo),
+    FIELD_SINGLE_PTR(XrVulkanDeviceCreateInfoKHR, vulkanAllocator),
+};
+
+void serialize(const XrVulkanDeviceCreateInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanDeviceCreateInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanDeviceCreateInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanDeviceCreateInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanDeviceCreateInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanDeviceCreateInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrVulkanDeviceCreateInfoKHR[] = {
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, type),
+    FIELD_XR(XrVulkanDeviceCreateInfoKHR, next),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, systemId),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, createFlags),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, pfnGetInstanceProcAddr),
+    FIELD_VALUE(XrVulkanDeviceCreateInfoKHR, vulkanPhysicalDevice),
+    FIELD_SINGLE_PTR(XrVulkanDeviceCreateInfoKHR, vulkanCreateInfo),
+    FIELD_SINGLE_PTR(XrVulkanDeviceCreateInfoKHR, vulkanAllocator),
+};
+
+void serialize(const XrVulkanDeviceCreateInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanDeviceCreateInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanDeviceCreateInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanDeviceCreateInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanDeviceCreateInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanDeviceCreateInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrVulkanGraphicsDeviceGetInfoKHR[] = {
+    FIELD_VALUE(XrVulkanGraphicsDeviceGetInfoKHR, type),
+    FIELD_XR(XrVulkanGraphicsDeviceGetInfoKHR, next),
+    FIELD_VALUE(XrVulkanGraphicsDeviceGetInfoKHR, systemId),
+    FIELD_VALUE(XrVulkanGraphicsDeviceGetInfoKHR, vulkanInstance),
+};
+
+void serialize(const XrVulkanGraphicsDeviceGetInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanGraphicsDeviceGetInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanGraphicsDeviceGetInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanGraphicsDeviceGetInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanGraphicsDeviceGetInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanGraphicsDeviceGetInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrVulkanGraphicsDeviceGetInfoKHR[] = {
+    FIELD_VALUE(XrVulkanGraphicsDeviceGetInfoKHR, type),
+    FIELD_XR(XrVulkanGraphicsDeviceGetInfoKHR, next),
+    FIELD_VALUE(XrVulkanGraphicsDeviceGetInfoKHR, systemId),
+    FIELD_VALUE(XrVulkanGraphicsDeviceGetInfoKHR, vulkanInstance),
+};
+
+void serialize(const XrVulkanGraphicsDeviceGetInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanGraphicsDeviceGetInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanGraphicsDeviceGetInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanGraphicsDeviceGetInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanGraphicsDeviceGetInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanGraphicsDeviceGetInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrVulkanInstanceCreateInfoKHR[] = {
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, type),
+    FIELD_XR(XrVulkanInstanceCreateInfoKHR, next),
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, systemId),
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, createFlags),
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, pfnGetInstanceProcAddr),
+    FIELD_SINGLE_PTR(XrVulkanInstanceCreateInfoKHR, vulkanCreateInfo),
+    FIELD_SINGLE_PTR(XrVulkanInstanceCreateInfoKHR, vulkanAllocator),
+};
+
+void serialize(const XrVulkanInstanceCreateInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanInstanceCreateInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanInstanceCreateInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanInstanceCreateInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanInstanceCreateInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanInstanceCreateInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrVulkanInstanceCreateInfoKHR[] = {
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, type),
+    FIELD_XR(XrVulkanInstanceCreateInfoKHR, next),
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, systemId),
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, createFlags),
+    FIELD_VALUE(XrVulkanInstanceCreateInfoKHR, pfnGetInstanceProcAddr),
+    FIELD_SINGLE_PTR(XrVulkanInstanceCreateInfoKHR, vulkanCreateInfo),
+    FIELD_SINGLE_PTR(XrVulkanInstanceCreateInfoKHR, vulkanAllocator),
+};
+
+void serialize(const XrVulkanInstanceCreateInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanInstanceCreateInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanInstanceCreateInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanInstanceCreateInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanInstanceCreateInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanInstanceCreateInfoKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_vulkan_enable2
+#ifdef XRTRANSPORT_EXT_XR_KHR_vulkan_swapchain_format_list
+constexpr FieldDescriptor fields_XrVulkanSwapchainFormatListCreateInfoKHR[] = {
+    FIELD_VALUE(XrVulkanSwapchainFormatListCreateInfoKHR, type),
+    FIELD_XR(XrVulkanSwapchainFormatListCreateInfoKHR, next),
+    FIELD_VALUE(XrVulkanSwapchainFormatListCreateInfoKHR, viewFormatCount),
+    FIELD_PTR(XrVulkanSwapchainFormatListCreateInfoKHR, viewFormats, viewFormatCount),
+};
+
+void serialize(const XrVulkanSwapchainFormatListCreateInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanSwapchainFormatListCreateInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanSwapchainFormatListCreateInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanSwapchainFormatListCreateInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanSwapchainFormatListCreateInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanSwapchainFormatListCreateInfoKHR);
+}
+
+constexpr FieldDescriptor fields_XrVulkanSwapchainFormatListCreateInfoKHR[] = {
+    FIELD_VALUE(XrVulkanSwapchainFormatListCreateInfoKHR, type),
+    FIELD_XR(XrVulkanSwapchainFormatListCreateInfoKHR, next),
+    FIELD_VALUE(XrVulkanSwapchainFormatListCreateInfoKHR, viewFormatCount),
+    FIELD_PTR(XrVulkanSwapchainFormatListCreateInfoKHR, viewFormats, viewFormatCount),
+};
+
+void serialize(const XrVulkanSwapchainFormatListCreateInfoKHR* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanSwapchainFormatListCreateInfoKHR, ctx);
+}
+
+void deserialize(XrVulkanSwapchainFormatListCreateInfoKHR* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanSwapchainFormatListCreateInfoKHR, ctx);
+}
+
+void cleanup(const XrVulkanSwapchainFormatListCreateInfoKHR* s) {
+    cleanup_fields(s, fields_XrVulkanSwapchainFormatListCreateInfoKHR);
+}
+
+#endif // XRTRANSPORT_EXT_XR_KHR_vulkan_swapchain_format_list
+#ifdef XRTRANSPORT_EXT_XR_META_body_tracking_full_body
+constexpr FieldDescriptor fields_XrSystemPropertiesBodyTrackingFullBodyMETA[] = {
+    FIELD_VALUE(XrSystemPropertiesBodyTrackingFullBodyMETA, type),
+    FIELD_XR(XrSystemPropertiesBodyTrackingFullBodyMETA, next),
+    FIELD_VALUE(XrSystemPropertiesBodyTrackingFullBodyMETA, supportsFullBodyTracking),
+};
+
+void serialize(const XrSystemPropertiesBodyTrackingFullBodyMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPropertiesBodyTrackingFullBodyMETA, ctx);
+}
+
+void deserialize(XrSystemPropertiesBodyTrackingFullBodyMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPropertiesBodyTrackingFullBodyMETA, ctx);
+}
+
+void cleanup(const XrSystemPropertiesBodyTrackingFullBodyMETA* s) {
+    cleanup_fields(s, fields_XrSystemPropertiesBodyTrackingFullBodyMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemPropertiesBodyTrackingFullBodyMETA[] = {
+    FIELD_VALUE(XrSystemPropertiesBodyTrackingFullBodyMETA, type),
+    FIELD_XR(XrSystemPropertiesBodyTrackingFullBodyMETA, next),
+    FIELD_VALUE(XrSystemPropertiesBodyTrackingFullBodyMETA, supportsFullBodyTracking),
+};
+
+void serialize(const XrSystemPropertiesBodyTrackingFullBodyMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPropertiesBodyTrackingFullBodyMETA, ctx);
+}
+
+void deserialize(XrSystemPropertiesBodyTrackingFullBodyMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPropertiesBodyTrackingFullBodyMETA, ctx);
+}
+
+void cleanup(const XrSystemPropertiesBodyTrackingFullBodyMETA* s) {
+    cleanup_fields(s, fields_XrSystemPropertiesBodyTrackingFullBodyMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_body_tracking_full_body
+#ifdef XRTRANSPORT_EXT_XR_META_colocation_discovery
+constexpr FieldDescriptor fields_XrColocationAdvertisementStartInfoMETA[] = {
+    FIELD_VALUE(XrColocationAdvertisementStartInfoMETA, type),
+    FIELD_XR(XrColocationAdvertisementStartInfoMETA, next),
+    FIELD_VALUE(XrColocationAdvertisementStartInfoMETA, bufferSize),
+    FIELD_PTR(XrColocationAdvertisementStartInfoMETA, buffer, bufferSize),
+};
+
+void serialize(const XrColocationAdvertisementStartInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationAdvertisementStartInfoMETA, ctx);
+}
+
+void deserialize(XrColocationAdvertisementStartInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationAdvertisementStartInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationAdvertisementStartInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationAdvertisementStartInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationAdvertisementStartInfoMETA[] = {
+    FIELD_VALUE(XrColocationAdvertisementStartInfoMETA, type),
+    FIELD_XR(XrColocationAdvertisementStartInfoMETA, next),
+    FIELD_VALUE(XrColocationAdvertisementStartInfoMETA, bufferSize),
+    FIELD_PTR(XrColocationAdvertisementStartInfoMETA, buffer, bufferSize),
+};
+
+void serialize(const XrColocationAdvertisementStartInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationAdvertisementStartInfoMETA, ctx);
+}
+
+void deserialize(XrColocationAdvertisementStartInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationAdvertisementStartInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationAdvertisementStartInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationAdvertisementStartInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationAdvertisementStopInfoMETA[] = {
+    FIELD_VALUE(XrColocationAdvertisementStopInfoMETA, type),
+    FIELD_XR(XrColocationAdvertisementStopInfoMETA, next),
+};
+
+void serialize(const XrColocationAdvertisementStopInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationAdvertisementStopInfoMETA, ctx);
+}
+
+void deserialize(XrColocationAdvertisementStopInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationAdvertisementStopInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationAdvertisementStopInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationAdvertisementStopInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationAdvertisementStopInfoMETA[] = {
+    FIELD_VALUE(XrColocationAdvertisementStopInfoMETA, type),
+    FIELD_XR(XrColocationAdvertisementStopInfoMETA, next),
+};
+
+void serialize(const XrColocationAdvertisementStopInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationAdvertisementStopInfoMETA, ctx);
+}
+
+void deserialize(XrColocationAdvertisementStopInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationAdvertisementStopInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationAdvertisementStopInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationAdvertisementStopInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationDiscoveryStartInfoMETA[] = {
+    FIELD_VALUE(XrColocationDiscoveryStartInfoMETA, type),
+    FIELD_XR(XrColocationDiscoveryStartInfoMETA, next),
+};
+
+void serialize(const XrColocationDiscoveryStartInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationDiscoveryStartInfoMETA, ctx);
+}
+
+void deserialize(XrColocationDiscoveryStartInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationDiscoveryStartInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationDiscoveryStartInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationDiscoveryStartInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationDiscoveryStartInfoMETA[] = {
+    FIELD_VALUE(XrColocationDiscoveryStartInfoMETA, type),
+    FIELD_XR(XrColocationDiscoveryStartInfoMETA, next),
+};
+
+void serialize(const XrColocationDiscoveryStartInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationDiscoveryStartInfoMETA, ctx);
+}
+
+void deserialize(XrColocationDiscoveryStartInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationDiscoveryStartInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationDiscoveryStartInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationDiscoveryStartInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationDiscoveryStopInfoMETA[] = {
+    FIELD_VALUE(XrColocationDiscoveryStopInfoMETA, type),
+    FIELD_XR(XrColocationDiscoveryStopInfoMETA, next),
+};
+
+void serialize(const XrColocationDiscoveryStopInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationDiscoveryStopInfoMETA, ctx);
+}
+
+void deserialize(XrColocationDiscoveryStopInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationDiscoveryStopInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationDiscoveryStopInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationDiscoveryStopInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrColocationDiscoveryStopInfoMETA[] = {
+    FIELD_VALUE(XrColocationDiscoveryStopInfoMETA, type),
+    FIELD_XR(XrColocationDiscoveryStopInfoMETA, next),
+};
+
+void serialize(const XrColocationDiscoveryStopInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColocationDiscoveryStopInfoMETA, ctx);
+}
+
+void deserialize(XrColocationDiscoveryStopInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColocationDiscoveryStopInfoMETA, ctx);
+}
+
+void cleanup(const XrColocationDiscoveryStopInfoMETA* s) {
+    cleanup_fields(s, fields_XrColocationDiscoveryStopInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataColocationAdvertisementCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataColocationAdvertisementCompleteMETA, type),
+    FIELD_XR(XrEventDataColocationAdvertisementCompleteMETA, next),
+    FIELD_VALUE(XrEventDataColocationAdvertisementCompleteMETA, advertisementRequestId),
+    FIELD_VALUE(XrEventDataColocationAdvertisementCompleteMETA, result),
+};
+
+void serialize(const XrEventDataColocationAdvertisementCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataColocationAdvertisementCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataColocationAdvertisementCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataColocationAdvertisementCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataColocationAdvertisementCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataColocationAdvertisementCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataColocationAdvertisementCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataColocationAdvertisementCompleteMETA, type),
+    FIELD_XR(XrEventDataColocationAdvertisementCompleteMETA, next),
+    FIELD_VALUE(XrEventDataColocationAdvertisementCompleteMETA, advertisementRequestId),
+    FIELD_VALUE(XrEventDataColocationAdvertisementCompleteMETA, result),
+};
+
+void serialize(const XrEventDataColocationAdvertisementCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataColocationAdvertisementCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataColocationAdvertisementCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataColocationAdvertisementCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataColocationAdvertisementCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataColocationAdvertisementCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataColocationDiscoveryCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataColocationDiscoveryCompleteMETA, type),
+    FIELD_XR(XrEventDataColocationDiscoveryCompleteMETA, next),
+    FIELD_VALUE(XrEventDataColocationDiscoveryCompleteMETA, discoveryRequestId),
+    FIELD_VALUE(XrEventDataColocationDiscoveryCompleteMETA, result),
+};
+
+void serialize(const XrEventDataColocationDiscoveryCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataColocationDiscoveryCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataColocationDiscoveryCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataColocationDiscoveryCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataColocationDiscoveryCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataColocationDiscoveryCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataColocationDiscoveryCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataColocationDiscoveryCompleteMETA, type),
+    FIELD_XR(XrEventDataColocationDiscoveryCompleteMETA, next),
+    FIELD_VALUE(XrEventDataColocationDiscoveryCompleteMETA, discoveryRequestId),
+    FIELD_VALUE(XrEventDataColocationDiscoveryCompleteMETA, result),
+};
+
+void serialize(const XrEventDataColocationDiscoveryCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataColocationDiscoveryCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataColocationDiscoveryCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataColocationDiscoveryCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataColocationDiscoveryCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataColocationDiscoveryCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataColocationDiscoveryResultMETA[] = {
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, type),
+    FIELD_XR(XrEventDataColocationDiscoveryResultMETA, next),
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, discoveryRequestId),
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, advertisementUuid),
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, bufferSize),
+    FIELD_ARRAY(XrEventDataColocationDiscoveryResultMETA, buffer),
+};
+
+void serialize(const XrEventDataColocationDiscoveryResultMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataColocationDiscoveryResultMETA, ctx);
+}
+
+void deserialize(XrEventDataColocationDiscoveryResultMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataColocationDiscoveryResultMETA, ctx);
+}
+
+void cleanup(const XrEventDataColocationDiscoveryResultMETA* s) {
+    cleanup_fields(s, fields_XrEventDataColocationDiscoveryResultMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataColocationDiscoveryResultMETA[] = {
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, type),
+    FIELD_XR(XrEventDataColocationDiscoveryResultMETA, next),
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, discoveryRequestId),
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, advertisementUuid),
+    FIELD_VALUE(XrEventDataColocationDiscoveryResultMETA, bufferSize),
+    FIELD_ARRAY(XrEventDataColocationDiscoveryResultMETA, buffer),
+};
+
+void serialize(const XrEventDataColocationDiscoveryResultMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataColocationDiscoveryResultMETA, ctx);
+}
+
+void deserialize(XrEventDataColocationDiscoveryResultMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataColocationDiscoveryResultMETA, ctx);
+}
+
+void cleanup(const XrEventDataColocationDiscoveryResultMETA* s) {
+    cleanup_fields(s, fields_XrEventDataColocationDiscoveryResultMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStartColocationAdvertisementCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, type),
+    FIELD_XR(XrEventDataStartColocationAdvertisementCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, advertisementRequestId),
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, result),
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, advertisementUuid),
+};
+
+void serialize(const XrEventDataStartColocationAdvertisementCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStartColocationAdvertisementCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStartColocationAdvertisementCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStartColocationAdvertisementCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStartColocationAdvertisementCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStartColocationAdvertisementCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStartColocationAdvertisementCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, type),
+    FIELD_XR(XrEventDataStartColocationAdvertisementCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, advertisementRequestId),
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, result),
+    FIELD_VALUE(XrEventDataStartColocationAdvertisementCompleteMETA, advertisementUuid),
+};
+
+void serialize(const XrEventDataStartColocationAdvertisementCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStartColocationAdvertisementCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStartColocationAdvertisementCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStartColocationAdvertisementCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStartColocationAdvertisementCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStartColocationAdvertisementCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStartColocationDiscoveryCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStartColocationDiscoveryCompleteMETA, type),
+    FIELD_XR(XrEventDataStartColocationDiscoveryCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStartColocationDiscoveryCompleteMETA, discoveryRequestId),
+    FIELD_VALUE(XrEventDataStartColocationDiscoveryCompleteMETA, result),
+};
+
+void serialize(const XrEventDataStartColocationDiscoveryCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStartColocationDiscoveryCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStartColocationDiscoveryCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStartColocationDiscoveryCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStartColocationDiscoveryCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStartColocationDiscoveryCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStartColocationDiscoveryCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStartColocationDiscoveryCompleteMETA, type),
+    FIELD_XR(XrEventDataStartColocationDiscoveryCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStartColocationDiscoveryCompleteMETA, discoveryRequestId),
+    FIELD_VALUE(XrEventDataStartColocationDiscoveryCompleteMETA, result),
+};
+
+void serialize(const XrEventDataStartColocationDiscoveryCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStartColocationDiscoveryCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStartColocationDiscoveryCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStartColocationDiscoveryCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStartColocationDiscoveryCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStartColocationDiscoveryCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStopColocationAdvertisementCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStopColocationAdvertisementCompleteMETA, type),
+    FIELD_XR(XrEventDataStopColocationAdvertisementCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStopColocationAdvertisementCompleteMETA, requestId),
+    FIELD_VALUE(XrEventDataStopColocationAdvertisementCompleteMETA, result),
+};
+
+void serialize(const XrEventDataStopColocationAdvertisementCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStopColocationAdvertisementCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStopColocationAdvertisementCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStopColocationAdvertisementCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStopColocationAdvertisementCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStopColocationAdvertisementCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStopColocationAdvertisementCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStopColocationAdvertisementCompleteMETA, type),
+    FIELD_XR(XrEventDataStopColocationAdvertisementCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStopColocationAdvertisementCompleteMETA, requestId),
+    FIELD_VALUE(XrEventDataStopColocationAdvertisementCompleteMETA, result),
+};
+
+void serialize(const XrEventDataStopColocationAdvertisementCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStopColocationAdvertisementCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStopColocationAdvertisementCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStopColocationAdvertisementCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStopColocationAdvertisementCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStopColocationAdvertisementCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStopColocationDiscoveryCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStopColocationDiscoveryCompleteMETA, type),
+    FIELD_XR(XrEventDataStopColocationDiscoveryCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStopColocationDiscoveryCompleteMETA, requestId),
+    FIELD_VALUE(XrEventDataStopColocationDiscoveryCompleteMETA, result),
+};
+
+void serialize(const XrEventDataStopColocationDiscoveryCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStopColocationDiscoveryCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStopColocationDiscoveryCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStopColocationDiscoveryCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStopColocationDiscoveryCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStopColocationDiscoveryCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataStopColocationDiscoveryCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataStopColocationDiscoveryCompleteMETA, type),
+    FIELD_XR(XrEventDataStopColocationDiscoveryCompleteMETA, next),
+    FIELD_VALUE(XrEventDataStopColocationDiscoveryCompleteMETA, requestId),
+    FIELD_VALUE(XrEventDataStopColocationDiscoveryCompleteMETA, result),
+};
+
+void serialize(const XrEventDataStopColocationDiscoveryCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataStopColocationDiscoveryCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataStopColocationDiscoveryCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataStopColocationDiscoveryCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataStopColocationDiscoveryCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataStopColocationDiscoveryCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemColocationDiscoveryPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemColocationDiscoveryPropertiesMETA, type),
+    FIELD_XR(XrSystemColocationDiscoveryPropertiesMETA, next),
+    FIELD_VALUE(XrSystemColocationDiscoveryPropertiesMETA, supportsColocationDiscovery),
+};
+
+void serialize(const XrSystemColocationDiscoveryPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemColocationDiscoveryPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemColocationDiscoveryPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemColocationDiscoveryPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemColocationDiscoveryPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemColocationDiscoveryPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemColocationDiscoveryPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemColocationDiscoveryPropertiesMETA, type),
+    FIELD_XR(XrSystemColocationDiscoveryPropertiesMETA, next),
+    FIELD_VALUE(XrSystemColocationDiscoveryPropertiesMETA, supportsColocationDiscovery),
+};
+
+void serialize(const XrSystemColocationDiscoveryPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemColocationDiscoveryPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemColocationDiscoveryPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemColocationDiscoveryPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemColocationDiscoveryPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemColocationDiscoveryPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_colocation_discovery
+#ifdef XRTRANSPORT_EXT_XR_META_environment_depth
+constexpr FieldDescriptor fields_XrEnvironmentDepthHandRemovalSetInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthHandRemovalSetInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthHandRemovalSetInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthHandRemovalSetInfoMETA, enabled),
+};
+
+void serialize(const XrEnvironmentDepthHandRemovalSetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthHandRemovalSetInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthHandRemovalSetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthHandRemovalSetInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthHandRemovalSetInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthHandRemovalSetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthHandRemovalSetInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthHandRemovalSetInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthHandRemovalSetInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthHandRemovalSetInfoMETA, enabled),
+};
+
+void serialize(const XrEnvironmentDepthHandRemovalSetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthHandRemovalSetInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthHandRemovalSetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthHandRemovalSetInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthHandRemovalSetInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthHandRemovalSetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthImageAcquireInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthImageAcquireInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthImageAcquireInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthImageAcquireInfoMETA, space),
+    FIELD_TIME(XrEnvironmentDepthImageAcquireInfoMETA, displayTime),
+};
+
+void serialize(const XrEnvironmentDepthImageAcquireInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthImageAcquireInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthImageAcquireInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthImageAcquireInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthImageAcquireInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthImageAcquireInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthImageAcquireInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthImageAcquireInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthImageAcquireInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthImageAcquireInfoMETA, space),
+    FIELD_TIME(XrEnvironmentDepthImageAcquireInfoMETA, displayTime),
+};
+
+void serialize(const XrEnvironmentDepthImageAcquireInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthImageAcquireInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthImageAcquireInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthImageAcquireInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthImageAcquireInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthImageAcquireInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthImageMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, type),
+    FIELD_XR(XrEnvironmentDepthImageMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, swapchainIndex),
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, nearZ),
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, farZ),
+    FIELD_ARRAY(XrEnvironmentDepthImageMETA, views),
+};
+
+void serialize(const XrEnvironmentDepthImageMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthImageMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthImageMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthImageMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthImageMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthImageMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthImageMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, type),
+    FIELD_XR(XrEnvironmentDepthImageMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, swapchainIndex),
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, nearZ),
+    FIELD_VALUE(XrEnvironmentDepthImageMETA, farZ),
+    FIELD_ARRAY(XrEnvironmentDepthImageMETA, views),
+};
+
+void serialize(const XrEnvironmentDepthImageMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthImageMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthImageMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthImageMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthImageMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthImageMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthImageViewMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthImageViewMETA, type),
+    FIELD_XR(XrEnvironmentDepthImageViewMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthImageViewMETA, fov),
+    FIELD_VALUE(XrEnvironmentDepthImageViewMETA, pose),
+};
+
+void serialize(const XrEnvironmentDepthImageViewMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthImageViewMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthImageViewMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthImageViewMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthImageViewMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthImageViewMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthImageViewMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthImageViewMETA, type),
+    FIELD_XR(XrEnvironmentDepthImageViewMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthImageViewMETA, fov),
+    FIELD_VALUE(XrEnvironmentDepthImageViewMETA, pose),
+};
+
+void serialize(const XrEnvironmentDepthImageViewMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthImageViewMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthImageViewMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthImageViewMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthImageViewMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthImageViewMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthProviderCreateInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthProviderCreateInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthProviderCreateInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthProviderCreateInfoMETA, createFlags),
+};
+
+void serialize(const XrEnvironmentDepthProviderCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthProviderCreateInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthProviderCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthProviderCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthProviderCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthProviderCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthProviderCreateInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthProviderCreateInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthProviderCreateInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthProviderCreateInfoMETA, createFlags),
+};
+
+void serialize(const XrEnvironmentDepthProviderCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthProviderCreateInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthProviderCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthProviderCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthProviderCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthProviderCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthSwapchainCreateInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthSwapchainCreateInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthSwapchainCreateInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthSwapchainCreateInfoMETA, createFlags),
+};
+
+void serialize(const XrEnvironmentDepthSwapchainCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthSwapchainCreateInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthSwapchainCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthSwapchainCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthSwapchainCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthSwapchainCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthSwapchainCreateInfoMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthSwapchainCreateInfoMETA, type),
+    FIELD_XR(XrEnvironmentDepthSwapchainCreateInfoMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthSwapchainCreateInfoMETA, createFlags),
+};
+
+void serialize(const XrEnvironmentDepthSwapchainCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthSwapchainCreateInfoMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthSwapchainCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthSwapchainCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthSwapchainCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthSwapchainCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthSwapchainStateMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthSwapchainStateMETA, type),
+    FIELD_XR(XrEnvironmentDepthSwapchainStateMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthSwapchainStateMETA, width),
+    FIELD_VALUE(XrEnvironmentDepthSwapchainStateMETA, height),
+};
+
+void serialize(const XrEnvironmentDepthSwapchainStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthSwapchainStateMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthSwapchainStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthSwapchainStateMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthSwapchainStateMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthSwapchainStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrEnvironmentDepthSwapchainStateMETA[] = {
+    FIELD_VALUE(XrEnvironmentDepthSwapchainStateMETA, type),
+    FIELD_XR(XrEnvironmentDepthSwapchainStateMETA, next),
+    FIELD_VALUE(XrEnvironmentDepthSwapchainStateMETA, width),
+    FIELD_VALUE(XrEnvironmentDepthSwapchainStateMETA, height),
+};
+
+void serialize(const XrEnvironmentDepthSwapchainStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEnvironmentDepthSwapchainStateMETA, ctx);
+}
+
+void deserialize(XrEnvironmentDepthSwapchainStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEnvironmentDepthSwapchainStateMETA, ctx);
+}
+
+void cleanup(const XrEnvironmentDepthSwapchainStateMETA* s) {
+    cleanup_fields(s, fields_XrEnvironmentDepthSwapchainStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemEnvironmentDepthPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemEnvironmentDepthPropertiesMETA, type),
+    FIELD_XR(XrSystemEnvironmentDepthPropertiesMETA, next),
+    FIELD_VALUE(XrSystemEnvironmentDepthPropertiesMETA, supportsEnvironmentDepth),
+    FIELD_VALUE(XrSystemEnvironmentDepthPropertiesMETA, supportsHandRemoval),
+};
+
+void serialize(const XrSystemEnvironmentDepthPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemEnvironmentDepthPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemEnvironmentDepthPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemEnvironmentDepthPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemEnvironmentDepthPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemEnvironmentDepthPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemEnvironmentDepthPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemEnvironmentDepthPropertiesMETA, type),
+    FIELD_XR(XrSystemEnvironmentDepthPropertiesMETA, next),
+    FIELD_VALUE(XrSystemEnvironmentDepthPropertiesMETA, supportsEnvironmentDepth),
+    FIELD_VALUE(XrSystemEnvironmentDepthPropertiesMETA, supportsHandRemoval),
+};
+
+void serialize(const XrSystemEnvironmentDepthPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemEnvironmentDepthPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemEnvironmentDepthPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemEnvironmentDepthPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemEnvironmentDepthPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemEnvironmentDepthPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_environment_depth
+#ifdef XRTRANSPORT_EXT_XR_META_foveation_eye_tracked
+constexpr FieldDescriptor fields_XrFoveationEyeTrackedProfileCreateInfoMETA[] = {
+    FIELD_VALUE(XrFoveationEyeTrackedProfileCreateInfoMETA, type),
+    FIELD_XR(XrFoveationEyeTrackedProfileCreateInfoMETA, next),
+    FIELD_VALUE(XrFoveationEyeTrackedProfileCreateInfoMETA, flags),
+};
+
+void serialize(const XrFoveationEyeTrackedProfileCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationEyeTrackedProfileCreateInfoMETA, ctx);
+}
+
+void deserialize(XrFoveationEyeTrackedProfileCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationEyeTrackedProfileCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrFoveationEyeTrackedProfileCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrFoveationEyeTrackedProfileCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrFoveationEyeTrackedProfileCreateInfoMETA[] = {
+    FIELD_VALUE(XrFoveationEyeTrackedProfileCreateInfoMETA, type),
+    FIELD_XR(XrFoveationEyeTrackedProfileCreateInfoMETA, next),
+    FIELD_VALUE(XrFoveationEyeTrackedProfileCreateInfoMETA, flags),
+};
+
+void serialize(const XrFoveationEyeTrackedProfileCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationEyeTrackedProfileCreateInfoMETA, ctx);
+}
+
+void deserialize(XrFoveationEyeTrackedProfileCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationEyeTrackedProfileCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrFoveationEyeTrackedProfileCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrFoveationEyeTrackedProfileCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrFoveationEyeTrackedStateMETA[] = {
+    FIELD_VALUE(XrFoveationEyeTrackedStateMETA, type),
+    FIELD_XR(XrFoveationEyeTrackedStateMETA, next),
+    FIELD_ARRAY(XrFoveationEyeTrackedStateMETA, foveationCenter),
+    FIELD_VALUE(XrFoveationEyeTrackedStateMETA, flags),
+};
+
+void serialize(const XrFoveationEyeTrackedStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationEyeTrackedStateMETA, ctx);
+}
+
+void deserialize(XrFoveationEyeTrackedStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationEyeTrackedStateMETA, ctx);
+}
+
+void cleanup(const XrFoveationEyeTrackedStateMETA* s) {
+    cleanup_fields(s, fields_XrFoveationEyeTrackedStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrFoveationEyeTrackedStateMETA[] = {
+    FIELD_VALUE(XrFoveationEyeTrackedStateMETA, type),
+    FIELD_XR(XrFoveationEyeTrackedStateMETA, next),
+    FIELD_ARRAY(XrFoveationEyeTrackedStateMETA, foveationCenter),
+    FIELD_VALUE(XrFoveationEyeTrackedStateMETA, flags),
+};
+
+void serialize(const XrFoveationEyeTrackedStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveationEyeTrackedStateMETA, ctx);
+}
+
+void deserialize(XrFoveationEyeTrackedStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveationEyeTrackedStateMETA, ctx);
+}
+
+void cleanup(const XrFoveationEyeTrackedStateMETA* s) {
+    cleanup_fields(s, fields_XrFoveationEyeTrackedStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemFoveationEyeTrackedPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemFoveationEyeTrackedPropertiesMETA, type),
+    FIELD_XR(XrSystemFoveationEyeTrackedPropertiesMETA, next),
+    FIELD_VALUE(XrSystemFoveationEyeTrackedPropertiesMETA, supportsFoveationEyeTracked),
+};
+
+void serialize(const XrSystemFoveationEyeTrackedPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFoveationEyeTrackedPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemFoveationEyeTrackedPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFoveationEyeTrackedPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemFoveationEyeTrackedPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemFoveationEyeTrackedPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemFoveationEyeTrackedPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemFoveationEyeTrackedPropertiesMETA, type),
+    FIELD_XR(XrSystemFoveationEyeTrackedPropertiesMETA, next),
+    FIELD_VALUE(XrSystemFoveationEyeTrackedPropertiesMETA, supportsFoveationEyeTracked),
+};
+
+void serialize(const XrSystemFoveationEyeTrackedPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFoveationEyeTrackedPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemFoveationEyeTrackedPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFoveationEyeTrackedPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemFoveationEyeTrackedPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemFoveationEyeTrackedPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_foveation_eye_tracked
+#ifdef XRTRANSPORT_EXT_XR_META_headset_id
+constexpr FieldDescriptor fields_XrSystemHeadsetIdPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemHeadsetIdPropertiesMETA, type),
+    FIELD_XR(XrSystemHeadsetIdPropertiesMETA, next),
+    FIELD_VALUE(XrSystemHeadsetIdPropertiesMETA, id),
+};
+
+void serialize(const XrSystemHeadsetIdPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemHeadsetIdPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemHeadsetIdPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemHeadsetIdPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemHeadsetIdPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemHeadsetIdPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemHeadsetIdPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemHeadsetIdPropertiesMETA, type),
+    FIELD_XR(XrSystemHeadsetIdPropertiesMETA, next),
+    FIELD_VALUE(XrSystemHeadsetIdPropertiesMETA, id),
+};
+
+void serialize(const XrSystemHeadsetIdPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemHeadsetIdPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemHeadsetIdPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemHeadsetIdPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemHeadsetIdPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemHeadsetIdPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_headset_id
+#ifdef XRTRANSPORT_EXT_XR_META_local_dimming
+constexpr FieldDescriptor fields_XrLocalDimmingFrameEndInfoMETA[] = {
+    FIELD_VALUE(XrLocalDimmingFrameEndInfoMETA, type),
+    FIELD_XR(XrLocalDimmingFrameEndInfoMETA, next),
+    FIELD_VALUE(XrLocalDimmingFrameEndInfoMETA, localDimmingMode),
+};
+
+void serialize(const XrLocalDimmingFrameEndInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalDimmingFrameEndInfoMETA, ctx);
+}
+
+void deserialize(XrLocalDimmingFrameEndInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalDimmingFrameEndInfoMETA, ctx);
+}
+
+void cleanup(const XrLocalDimmingFrameEndInfoMETA* s) {
+    cleanup_fields(s, fields_XrLocalDimmingFrameEndInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrLocalDimmingFrameEndInfoMETA[] = {
+    FIELD_VALUE(XrLocalDimmingFrameEndInfoMETA, type),
+    FIELD_XR(XrLocalDimmingFrameEndInfoMETA, next),
+    FIELD_VALUE(XrLocalDimmingFrameEndInfoMETA, localDimmingMode),
+};
+
+void serialize(const XrLocalDimmingFrameEndInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalDimmingFrameEndInfoMETA, ctx);
+}
+
+void deserialize(XrLocalDimmingFrameEndInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalDimmingFrameEndInfoMETA, ctx);
+}
+
+void cleanup(const XrLocalDimmingFrameEndInfoMETA* s) {
+    cleanup_fields(s, fields_XrLocalDimmingFrameEndInfoMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_local_dimming
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_color_lut
+constexpr FieldDescriptor fields_XrPassthroughColorLutCreateInfoMETA[] = {
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, type),
+    FIELD_XR(XrPassthroughColorLutCreateInfoMETA, next),
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, channels),
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, resolution),
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, data),
+};
+
+void serialize(const XrPassthroughColorLutCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorLutCreateInfoMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorLutCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorLutCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorLutCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorLutCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorLutCreateInfoMETA[] = {
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, type),
+    FIELD_XR(XrPassthroughColorLutCreateInfoMETA, next),
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, channels),
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, resolution),
+    FIELD_VALUE(XrPassthroughColorLutCreateInfoMETA, data),
+};
+
+void serialize(const XrPassthroughColorLutCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorLutCreateInfoMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorLutCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorLutCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorLutCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorLutCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorLutDataMETA[] = {
+    FIELD_VALUE(XrPassthroughColorLutDataMETA, bufferSize),
+    FIELD_PTR(XrPassthroughColorLutDataMETA, buffer, bufferSize),
+};
+
+void serialize(const XrPassthroughColorLutDataMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorLutDataMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorLutDataMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorLutDataMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorLutDataMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorLutDataMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorLutUpdateInfoMETA[] = {
+    FIELD_VALUE(XrPassthroughColorLutUpdateInfoMETA, type),
+    FIELD_XR(XrPassthroughColorLutUpdateInfoMETA, next),
+    FIELD_VALUE(XrPassthroughColorLutUpdateInfoMETA, data),
+};
+
+void serialize(const XrPassthroughColorLutUpdateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorLutUpdateInfoMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorLutUpdateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorLutUpdateInfoMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorLutUpdateInfoMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorLutUpdateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorLutUpdateInfoMETA[] = {
+    FIELD_VALUE(XrPassthroughColorLutUpdateInfoMETA, type),
+    FIELD_XR(XrPassthroughColorLutUpdateInfoMETA, next),
+    FIELD_VALUE(XrPassthroughColorLutUpdateInfoMETA, data),
+};
+
+void serialize(const XrPassthroughColorLutUpdateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorLutUpdateInfoMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorLutUpdateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorLutUpdateInfoMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorLutUpdateInfoMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorLutUpdateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapInterpolatedLutMETA[] = {
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, type),
+    FIELD_XR(XrPassthroughColorMapInterpolatedLutMETA, next),
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, sourceColorLut),
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, targetColorLut),
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, weight),
+};
+
+void serialize(const XrPassthroughColorMapInterpolatedLutMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapInterpolatedLutMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorMapInterpolatedLutMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapInterpolatedLutMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapInterpolatedLutMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapInterpolatedLutMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapInterpolatedLutMETA[] = {
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, type),
+    FIELD_XR(XrPassthroughColorMapInterpolatedLutMETA, next),
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, sourceColorLut),
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, targetColorLut),
+    FIELD_VALUE(XrPassthroughColorMapInterpolatedLutMETA, weight),
+};
+
+void serialize(const XrPassthroughColorMapInterpolatedLutMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapInterpolatedLutMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorMapInterpolatedLutMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapInterpolatedLutMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapInterpolatedLutMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapInterpolatedLutMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapLutMETA[] = {
+    FIELD_VALUE(XrPassthroughColorMapLutMETA, type),
+    FIELD_XR(XrPassthroughColorMapLutMETA, next),
+    FIELD_VALUE(XrPassthroughColorMapLutMETA, colorLut),
+    FIELD_VALUE(XrPassthroughColorMapLutMETA, weight),
+};
+
+void serialize(const XrPassthroughColorMapLutMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapLutMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorMapLutMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapLutMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapLutMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapLutMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughColorMapLutMETA[] = {
+    FIELD_VALUE(XrPassthroughColorMapLutMETA, type),
+    FIELD_XR(XrPassthroughColorMapLutMETA, next),
+    FIELD_VALUE(XrPassthroughColorMapLutMETA, colorLut),
+    FIELD_VALUE(XrPassthroughColorMapLutMETA, weight),
+};
+
+void serialize(const XrPassthroughColorMapLutMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughColorMapLutMETA, ctx);
+}
+
+void deserialize(XrPassthroughColorMapLutMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughColorMapLutMETA, ctx);
+}
+
+void cleanup(const XrPassthroughColorMapLutMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughColorMapLutMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemPassthroughColorLutPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemPassthroughColorLutPropertiesMETA, type),
+    FIELD_XR(XrSystemPassthroughColorLutPropertiesMETA, next),
+    FIELD_VALUE(XrSystemPassthroughColorLutPropertiesMETA, maxColorLutResolution),
+};
+
+void serialize(const XrSystemPassthroughColorLutPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPassthroughColorLutPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemPassthroughColorLutPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPassthroughColorLutPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemPassthroughColorLutPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemPassthroughColorLutPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemPassthroughColorLutPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemPassthroughColorLutPropertiesMETA, type),
+    FIELD_XR(XrSystemPassthroughColorLutPropertiesMETA, next),
+    FIELD_VALUE(XrSystemPassthroughColorLutPropertiesMETA, maxColorLutResolution),
+};
+
+void serialize(const XrSystemPassthroughColorLutPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemPassthroughColorLutPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemPassthroughColorLutPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemPassthroughColorLutPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemPassthroughColorLutPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemPassthroughColorLutPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_color_lut
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_layer_resumed_event
+constexpr FieldDescriptor fields_XrEventDataPassthroughLayerResumedMETA[] = {
+    FIELD_VALUE(XrEventDataPassthroughLayerResumedMETA, type),
+    FIELD_XR(XrEventDataPassthroughLayerResumedMETA, next),
+    FIELD_VALUE(XrEventDataPassthroughLayerResumedMETA, layer),
+};
+
+void serialize(const XrEventDataPassthroughLayerResumedMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataPassthroughLayerResumedMETA, ctx);
+}
+
+void deserialize(XrEventDataPassthroughLayerResumedMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataPassthroughLayerResumedMETA, ctx);
+}
+
+void cleanup(const XrEventDataPassthroughLayerResumedMETA* s) {
+    cleanup_fields(s, fields_XrEventDataPassthroughLayerResumedMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataPassthroughLayerResumedMETA[] = {
+    FIELD_VALUE(XrEventDataPassthroughLayerResumedMETA, type),
+    FIELD_XR(XrEventDataPassthroughLayerResumedMETA, next),
+    FIELD_VALUE(XrEventDataPassthroughLayerResumedMETA, layer),
+};
+
+void serialize(const XrEventDataPassthroughLayerResumedMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataPassthroughLayerResumedMETA, ctx);
+}
+
+void deserialize(XrEventDataPassthroughLayerResumedMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataPassthroughLayerResumedMETA, ctx);
+}
+
+void cleanup(const XrEventDataPassthroughLayerResumedMETA* s) {
+    cleanup_fields(s, fields_XrEventDataPassthroughLayerResumedMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_layer_resumed_event
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_preferences
+constexpr FieldDescriptor fields_XrPassthroughPreferencesMETA[] = {
+    FIELD_VALUE(XrPassthroughPreferencesMETA, type),
+    FIELD_XR(XrPassthroughPreferencesMETA, next),
+    FIELD_VALUE(XrPassthroughPreferencesMETA, flags),
+};
+
+void serialize(const XrPassthroughPreferencesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughPreferencesMETA, ctx);
+}
+
+void deserialize(XrPassthroughPreferencesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughPreferencesMETA, ctx);
+}
+
+void cleanup(const XrPassthroughPreferencesMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughPreferencesMETA);
+}
+
+constexpr FieldDescriptor fields_XrPassthroughPreferencesMETA[] = {
+    FIELD_VALUE(XrPassthroughPreferencesMETA, type),
+    FIELD_XR(XrPassthroughPreferencesMETA, next),
+    FIELD_VALUE(XrPassthroughPreferencesMETA, flags),
+};
+
+void serialize(const XrPassthroughPreferencesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPassthroughPreferencesMETA, ctx);
+}
+
+void deserialize(XrPassthroughPreferencesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPassthroughPreferencesMETA, ctx);
+}
+
+void cleanup(const XrPassthroughPreferencesMETA* s) {
+    cleanup_fields(s, fields_XrPassthroughPreferencesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_preferences
+#ifdef XRTRANSPORT_EXT_XR_META_performance_metrics
+constexpr FieldDescriptor fields_XrPerformanceMetricsCounterMETA[] = {
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, type),
+    FIELD_XR(XrPerformanceMetricsCounterMETA, next),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, counterFlags),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, counterUnit),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, uintValue),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, floatValue),
+};
+
+void serialize(const XrPerformanceMetricsCounterMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPerformanceMetricsCounterMETA, ctx);
+}
+
+void deserialize(XrPerformanceMetricsCounterMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPerformanceMetricsCounterMETA, ctx);
+}
+
+void cleanup(const XrPerformanceMetricsCounterMETA* s) {
+    cleanup_fields(s, fields_XrPerformanceMetricsCounterMETA);
+}
+
+constexpr FieldDescriptor fields_XrPerformanceMetricsCounterMETA[] = {
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, type),
+    FIELD_XR(XrPerformanceMetricsCounterMETA, next),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, counterFlags),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, counterUnit),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, uintValue),
+    FIELD_VALUE(XrPerformanceMetricsCounterMETA, floatValue),
+};
+
+void serialize(const XrPerformanceMetricsCounterMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPerformanceMetricsCounterMETA, ctx);
+}
+
+void deserialize(XrPerformanceMetricsCounterMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPerformanceMetricsCounterMETA, ctx);
+}
+
+void cleanup(const XrPerformanceMetricsCounterMETA* s) {
+    cleanup_fields(s, fields_XrPerformanceMetricsCounterMETA);
+}
+
+constexpr FieldDescriptor fields_XrPerformanceMetricsStateMETA[] = {
+    FIELD_VALUE(XrPerformanceMetricsStateMETA, type),
+    FIELD_XR(XrPerformanceMetricsStateMETA, next),
+    FIELD_VALUE(XrPerformanceMetricsStateMETA, enabled),
+};
+
+void serialize(const XrPerformanceMetricsStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPerformanceMetricsStateMETA, ctx);
+}
+
+void deserialize(XrPerformanceMetricsStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPerformanceMetricsStateMETA, ctx);
+}
+
+void cleanup(const XrPerformanceMetricsStateMETA* s) {
+    cleanup_fields(s, fields_XrPerformanceMetricsStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrPerformanceMetricsStateMETA[] = {
+    FIELD_VALUE(XrPerformanceMetricsStateMETA, type),
+    FIELD_XR(XrPerformanceMetricsStateMETA, next),
+    FIELD_VALUE(XrPerformanceMetricsStateMETA, enabled),
+};
+
+void serialize(const XrPerformanceMetricsStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPerformanceMetricsStateMETA, ctx);
+}
+
+void deserialize(XrPerformanceMetricsStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPerformanceMetricsStateMETA, ctx);
+}
+
+void cleanup(const XrPerformanceMetricsStateMETA* s) {
+    cleanup_fields(s, fields_XrPerformanceMetricsStateMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_performance_metrics
+#ifdef XRTRANSPORT_EXT_XR_META_recommended_layer_resolution
+constexpr FieldDescriptor fields_XrRecommendedLayerResolutionGetInfoMETA[] = {
+    FIELD_VALUE(XrRecommendedLayerResolutionGetInfoMETA, type),
+    FIELD_XR(XrRecommendedLayerResolutionGetInfoMETA, next),
+    FIELD_XR(XrRecommendedLayerResolutionGetInfoMETA, layer),
+    FIELD_TIME(XrRecommendedLayerResolutionGetInfoMETA, predictedDisplayTime),
+};
+
+void serialize(const XrRecommendedLayerResolutionGetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRecommendedLayerResolutionGetInfoMETA, ctx);
+}
+
+void deserialize(XrRecommendedLayerResolutionGetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRecommendedLayerResolutionGetInfoMETA, ctx);
+}
+
+void cleanup(const XrRecommendedLayerResolutionGetInfoMETA* s) {
+    cleanup_fields(s, fields_XrRecommendedLayerResolutionGetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrRecommendedLayerResolutionGetInfoMETA[] = {
+    FIELD_VALUE(XrRecommendedLayerResolutionGetInfoMETA, type),
+    FIELD_XR(XrRecommendedLayerResolutionGetInfoMETA, next),
+    FIELD_XR(XrRecommendedLayerResolutionGetInfoMETA, layer),
+    FIELD_TIME(XrRecommendedLayerResolutionGetInfoMETA, predictedDisplayTime),
+};
+
+void serialize(const XrRecommendedLayerResolutionGetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRecommendedLayerResolutionGetInfoMETA, ctx);
+}
+
+void deserialize(XrRecommendedLayerResolutionGetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRecommendedLayerResolutionGetInfoMETA, ctx);
+}
+
+void cleanup(const XrRecommendedLayerResolutionGetInfoMETA* s) {
+    cleanup_fields(s, fields_XrRecommendedLayerResolutionGetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrRecommendedLayerResolutionMETA[] = {
+    FIELD_VALUE(XrRecommendedLayerResolutionMETA, type),
+    FIELD_XR(XrRecommendedLayerResolutionMETA, next),
+    FIELD_VALUE(XrRecommendedLayerResolutionMETA, recommendedImageDimensions),
+    FIELD_VALUE(XrRecommendedLayerResolutionMETA, isValid),
+};
+
+void serialize(const XrRecommendedLayerResolutionMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRecommendedLayerResolutionMETA, ctx);
+}
+
+void deserialize(XrRecommendedLayerResolutionMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRecommendedLayerResolutionMETA, ctx);
+}
+
+void cleanup(const XrRecommendedLayerResolutionMETA* s) {
+    cleanup_fields(s, fields_XrRecommendedLayerResolutionMETA);
+}
+
+constexpr FieldDescriptor fields_XrRecommendedLayerResolutionMETA[] = {
+    FIELD_VALUE(XrRecommendedLayerResolutionMETA, type),
+    FIELD_XR(XrRecommendedLayerResolutionMETA, next),
+    FIELD_VALUE(XrRecommendedLayerResolutionMETA, recommendedImageDimensions),
+    FIELD_VALUE(XrRecommendedLayerResolutionMETA, isValid),
+};
+
+void serialize(const XrRecommendedLayerResolutionMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRecommendedLayerResolutionMETA, ctx);
+}
+
+void deserialize(XrRecommendedLayerResolutionMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRecommendedLayerResolutionMETA, ctx);
+}
+
+void cleanup(const XrRecommendedLayerResolutionMETA* s) {
+    cleanup_fields(s, fields_XrRecommendedLayerResolutionMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_recommended_layer_resolution
+#ifdef XRTRANSPORT_EXT_XR_META_simultaneous_hands_and_controllers
+constexpr FieldDescriptor fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA[] = {
+    FIELD_VALUE(XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, type),
+    FIELD_XR(XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, next),
+};
+
+void serialize(const XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, ctx);
+}
+
+void deserialize(XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, ctx);
+}
+
+void cleanup(const XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* s) {
+    cleanup_fields(s, fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA[] = {
+    FIELD_VALUE(XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, type),
+    FIELD_XR(XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, next),
+};
+
+void serialize(const XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, ctx);
+}
+
+void deserialize(XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA, ctx);
+}
+
+void cleanup(const XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* s) {
+    cleanup_fields(s, fields_XrSimultaneousHandsAndControllersTrackingPauseInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA[] = {
+    FIELD_VALUE(XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, type),
+    FIELD_XR(XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, next),
+};
+
+void serialize(const XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, ctx);
+}
+
+void deserialize(XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, ctx);
+}
+
+void cleanup(const XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* s) {
+    cleanup_fields(s, fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA[] = {
+    FIELD_VALUE(XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, type),
+    FIELD_XR(XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, next),
+};
+
+void serialize(const XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, ctx);
+}
+
+void deserialize(XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA, ctx);
+}
+
+void cleanup(const XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* s) {
+    cleanup_fields(s, fields_XrSimultaneousHandsAndControllersTrackingResumeInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemSimultaneousHandsAndControllersPropertiesMETA, type),
+    FIELD_XR(XrSystemSimultaneousHandsAndControllersPropertiesMETA, next),
+    FIELD_VALUE(XrSystemSimultaneousHandsAndControllersPropertiesMETA, supportsSimultaneousHandsAndControllers),
+};
+
+void serialize(const XrSystemSimultaneousHandsAndControllersPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemSimultaneousHandsAndControllersPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemSimultaneousHandsAndControllersPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemSimultaneousHandsAndControllersPropertiesMETA, type),
+    FIELD_XR(XrSystemSimultaneousHandsAndControllersPropertiesMETA, next),
+    FIELD_VALUE(XrSystemSimultaneousHandsAndControllersPropertiesMETA, supportsSimultaneousHandsAndControllers),
+};
+
+void serialize(const XrSystemSimultaneousHandsAndControllersPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemSimultaneousHandsAndControllersPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemSimultaneousHandsAndControllersPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemSimultaneousHandsAndControllersPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_simultaneous_hands_and_controllers
+#ifdef XRTRANSPORT_EXT_XR_META_spatial_entity_group_sharing
+constexpr FieldDescriptor fields_XrShareSpacesRecipientGroupsMETA[] = {
+    FIELD_VALUE(XrShareSpacesRecipientGroupsMETA, type),
+    FIELD_XR(XrShareSpacesRecipientGroupsMETA, next),
+    FIELD_VALUE(XrShareSpacesRecipientGroupsMETA, groupCount),
+    FIELD_PTR(XrShareSpacesRecipientGroupsMETA, groups, groupCount),
+};
+
+void serialize(const XrShareSpacesRecipientGroupsMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrShareSpacesRecipientGroupsMETA, ctx);
+}
+
+void deserialize(XrShareSpacesRecipientGroupsMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrShareSpacesRecipientGroupsMETA, ctx);
+}
+
+void cleanup(const XrShareSpacesRecipientGroupsMETA* s) {
+    cleanup_fields(s, fields_XrShareSpacesRecipientGroupsMETA);
+}
+
+constexpr FieldDescriptor fields_XrShareSpacesRecipientGroupsMETA[] = {
+    FIELD_VALUE(XrShareSpacesRecipientGroupsMETA, type),
+    FIELD_XR(XrShareSpacesRecipientGroupsMETA, next),
+    FIELD_VALUE(XrShareSpacesRecipientGroupsMETA, groupCount),
+    FIELD_PTR(XrShareSpacesRecipientGroupsMETA, groups, groupCount),
+};
+
+void serialize(const XrShareSpacesRecipientGroupsMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrShareSpacesRecipientGroupsMETA, ctx);
+}
+
+void deserialize(XrShareSpacesRecipientGroupsMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrShareSpacesRecipientGroupsMETA, ctx);
+}
+
+void cleanup(const XrShareSpacesRecipientGroupsMETA* s) {
+    cleanup_fields(s, fields_XrShareSpacesRecipientGroupsMETA);
+}
+
+constexpr FieldDescriptor fields_XrSpaceGroupUuidFilterInfoMETA[] = {
+    FIELD_VALUE(XrSpaceGroupUuidFilterInfoMETA, type),
+    FIELD_XR(XrSpaceGroupUuidFilterInfoMETA, next),
+    FIELD_VALUE(XrSpaceGroupUuidFilterInfoMETA, groupUuid),
+};
+
+void serialize(const XrSpaceGroupUuidFilterInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceGroupUuidFilterInfoMETA, ctx);
+}
+
+void deserialize(XrSpaceGroupUuidFilterInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceGroupUuidFilterInfoMETA, ctx);
+}
+
+void cleanup(const XrSpaceGroupUuidFilterInfoMETA* s) {
+    cleanup_fields(s, fields_XrSpaceGroupUuidFilterInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSpaceGroupUuidFilterInfoMETA[] = {
+    FIELD_VALUE(XrSpaceGroupUuidFilterInfoMETA, type),
+    FIELD_XR(XrSpaceGroupUuidFilterInfoMETA, next),
+    FIELD_VALUE(XrSpaceGroupUuidFilterInfoMETA, groupUuid),
+};
+
+void serialize(const XrSpaceGroupUuidFilterInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceGroupUuidFilterInfoMETA, ctx);
+}
+
+void deserialize(XrSpaceGroupUuidFilterInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceGroupUuidFilterInfoMETA, ctx);
+}
+
+void cleanup(const XrSpaceGroupUuidFilterInfoMETA* s) {
+    cleanup_fields(s, fields_XrSpaceGroupUuidFilterInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialEntityGroupSharingPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemSpatialEntityGroupSharingPropertiesMETA, type),
+    FIELD_XR(XrSystemSpatialEntityGroupSharingPropertiesMETA, next),
+    FIELD_VALUE(XrSystemSpatialEntityGroupSharingPropertiesMETA, supportsSpatialEntityGroupSharing),
+};
+
+void serialize(const XrSystemSpatialEntityGroupSharingPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialEntityGroupSharingPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemSpatialEntityGroupSharingPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialEntityGroupSharingPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemSpatialEntityGroupSharingPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemSpatialEntityGroupSharingPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialEntityGroupSharingPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemSpatialEntityGroupSharingPropertiesMETA, type),
+    FIELD_XR(XrSystemSpatialEntityGroupSharingPropertiesMETA, next),
+    FIELD_VALUE(XrSystemSpatialEntityGroupSharingPropertiesMETA, supportsSpatialEntityGroupSharing),
+};
+
+void serialize(const XrSystemSpatialEntityGroupSharingPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialEntityGroupSharingPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemSpatialEntityGroupSharingPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialEntityGroupSharingPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemSpatialEntityGroupSharingPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemSpatialEntityGroupSharingPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_spatial_entity_group_sharing
+#ifdef XRTRANSPORT_EXT_XR_META_spatial_entity_mesh
+constexpr FieldDescriptor fields_XrSpaceTriangleMeshGetInfoMETA[] = {
+    FIELD_VALUE(XrSpaceTriangleMeshGetInfoMETA, type),
+    FIELD_XR(XrSpaceTriangleMeshGetInfoMETA, next),
+};
+
+void serialize(const XrSpaceTriangleMeshGetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceTriangleMeshGetInfoMETA, ctx);
+}
+
+void deserialize(XrSpaceTriangleMeshGetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceTriangleMeshGetInfoMETA, ctx);
+}
+
+void cleanup(const XrSpaceTriangleMeshGetInfoMETA* s) {
+    cleanup_fields(s, fields_XrSpaceTriangleMeshGetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSpaceTriangleMeshGetInfoMETA[] = {
+    FIELD_VALUE(XrSpaceTriangleMeshGetInfoMETA, type),
+    FIELD_XR(XrSpaceTriangleMeshGetInfoMETA, next),
+};
+
+void serialize(const XrSpaceTriangleMeshGetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceTriangleMeshGetInfoMETA, ctx);
+}
+
+void deserialize(XrSpaceTriangleMeshGetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceTriangleMeshGetInfoMETA, ctx);
+}
+
+void cleanup(const XrSpaceTriangleMeshGetInfoMETA* s) {
+    cleanup_fields(s, fields_XrSpaceTriangleMeshGetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrSpaceTriangleMeshMETA[] = {
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, type),
+    FIELD_XR(XrSpaceTriangleMeshMETA, next),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, vertexCapacityInput),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, vertexCountOutput),
+    FIELD_PTR(XrSpaceTriangleMeshMETA, vertices, vertexCapacityInput),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, indexCapacityInput),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, indexCountOutput),
+    FIELD_PTR(XrSpaceTriangleMeshMETA, indices, indexCapacityInput),
+};
+
+void serialize(const XrSpaceTriangleMeshMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceTriangleMeshMETA, ctx);
+}
+
+void deserialize(XrSpaceTriangleMeshMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceTriangleMeshMETA, ctx);
+}
+
+void cleanup(const XrSpaceTriangleMeshMETA* s) {
+    cleanup_fields(s, fields_XrSpaceTriangleMeshMETA);
+}
+
+constexpr FieldDescriptor fields_XrSpaceTriangleMeshMETA[] = {
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, type),
+    FIELD_XR(XrSpaceTriangleMeshMETA, next),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, vertexCapacityInput),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, vertexCountOutput),
+    FIELD_PTR(XrSpaceTriangleMeshMETA, vertices, vertexCapacityInput),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, indexCapacityInput),
+    FIELD_VALUE(XrSpaceTriangleMeshMETA, indexCountOutput),
+    FIELD_PTR(XrSpaceTriangleMeshMETA, indices, indexCapacityInput),
+};
+
+void serialize(const XrSpaceTriangleMeshMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceTriangleMeshMETA, ctx);
+}
+
+void deserialize(XrSpaceTriangleMeshMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceTriangleMeshMETA, ctx);
+}
+
+void cleanup(const XrSpaceTriangleMeshMETA* s) {
+    cleanup_fields(s, fields_XrSpaceTriangleMeshMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_spatial_entity_mesh
+#ifdef XRTRANSPORT_EXT_XR_META_spatial_entity_sharing
+constexpr FieldDescriptor fields_XrEventDataShareSpacesCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataShareSpacesCompleteMETA, type),
+    FIELD_XR(XrEventDataShareSpacesCompleteMETA, next),
+    FIELD_VALUE(XrEventDataShareSpacesCompleteMETA, requestId),
+    FIELD_VALUE(XrEventDataShareSpacesCompleteMETA, result),
+};
+
+void serialize(const XrEventDataShareSpacesCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataShareSpacesCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataShareSpacesCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataShareSpacesCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataShareSpacesCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataShareSpacesCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataShareSpacesCompleteMETA[] = {
+    FIELD_VALUE(XrEventDataShareSpacesCompleteMETA, type),
+    FIELD_XR(XrEventDataShareSpacesCompleteMETA, next),
+    FIELD_VALUE(XrEventDataShareSpacesCompleteMETA, requestId),
+    FIELD_VALUE(XrEventDataShareSpacesCompleteMETA, result),
+};
+
+void serialize(const XrEventDataShareSpacesCompleteMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataShareSpacesCompleteMETA, ctx);
+}
+
+void deserialize(XrEventDataShareSpacesCompleteMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataShareSpacesCompleteMETA, ctx);
+}
+
+void cleanup(const XrEventDataShareSpacesCompleteMETA* s) {
+    cleanup_fields(s, fields_XrEventDataShareSpacesCompleteMETA);
+}
+
+constexpr FieldDescriptor fields_XrShareSpacesInfoMETA[] = {
+    FIELD_VALUE(XrShareSpacesInfoMETA, type),
+    FIELD_XR(XrShareSpacesInfoMETA, next),
+    FIELD_VALUE(XrShareSpacesInfoMETA, spaceCount),
+    FIELD_PTR(XrShareSpacesInfoMETA, spaces, spaceCount),
+    FIELD_XR(XrShareSpacesInfoMETA, recipientInfo),
+};
+
+void serialize(const XrShareSpacesInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrShareSpacesInfoMETA, ctx);
+}
+
+void deserialize(XrShareSpacesInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrShareSpacesInfoMETA, ctx);
+}
+
+void cleanup(const XrShareSpacesInfoMETA* s) {
+    cleanup_fields(s, fields_XrShareSpacesInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrShareSpacesInfoMETA[] = {
+    FIELD_VALUE(XrShareSpacesInfoMETA, type),
+    FIELD_XR(XrShareSpacesInfoMETA, next),
+    FIELD_VALUE(XrShareSpacesInfoMETA, spaceCount),
+    FIELD_PTR(XrShareSpacesInfoMETA, spaces, spaceCount),
+    FIELD_XR(XrShareSpacesInfoMETA, recipientInfo),
+};
+
+void serialize(const XrShareSpacesInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrShareSpacesInfoMETA, ctx);
+}
+
+void deserialize(XrShareSpacesInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrShareSpacesInfoMETA, ctx);
+}
+
+void cleanup(const XrShareSpacesInfoMETA* s) {
+    cleanup_fields(s, fields_XrShareSpacesInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrShareSpacesRecipientBaseHeaderMETA[] = {
+    FIELD_VALUE(XrShareSpacesRecipientBaseHeaderMETA, type),
+    FIELD_XR(XrShareSpacesRecipientBaseHeaderMETA, next),
+};
+
+void serialize(const XrShareSpacesRecipientBaseHeaderMETA* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrShareSpacesRecipientBaseHeaderMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrShareSpacesRecipientBaseHeaderMETA, ctx);
+}
+
+void cleanup(const XrShareSpacesRecipientBaseHeaderMETA* s) {
+    cleanup_fields(s, fields_XrShareSpacesRecipientBaseHeaderMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialEntitySharingPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemSpatialEntitySharingPropertiesMETA, type),
+    FIELD_XR(XrSystemSpatialEntitySharingPropertiesMETA, next),
+    FIELD_VALUE(XrSystemSpatialEntitySharingPropertiesMETA, supportsSpatialEntitySharing),
+};
+
+void serialize(const XrSystemSpatialEntitySharingPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialEntitySharingPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemSpatialEntitySharingPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialEntitySharingPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemSpatialEntitySharingPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemSpatialEntitySharingPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemSpatialEntitySharingPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemSpatialEntitySharingPropertiesMETA, type),
+    FIELD_XR(XrSystemSpatialEntitySharingPropertiesMETA, next),
+    FIELD_VALUE(XrSystemSpatialEntitySharingPropertiesMETA, supportsSpatialEntitySharing),
+};
+
+void serialize(const XrSystemSpatialEntitySharingPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemSpatialEntitySharingPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemSpatialEntitySharingPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemSpatialEntitySharingPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemSpatialEntitySharingPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemSpatialEntitySharingPropertiesMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_spatial_entity_sharing
+#ifdef XRTRANSPORT_EXT_XR_META_virtual_keyboard
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardBackspaceMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardBackspaceMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardBackspaceMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardBackspaceMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardBackspaceMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardBackspaceMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardBackspaceMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardBackspaceMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardBackspaceMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardBackspaceMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardBackspaceMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardBackspaceMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardBackspaceMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardBackspaceMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardBackspaceMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardBackspaceMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardBackspaceMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardBackspaceMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardBackspaceMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardBackspaceMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardCommitTextMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardCommitTextMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardCommitTextMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardCommitTextMETA, keyboard),
+    FIELD_STRING_ARRAY(XrEventDataVirtualKeyboardCommitTextMETA, text),
+};
+
+void serialize(const XrEventDataVirtualKeyboardCommitTextMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardCommitTextMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardCommitTextMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardCommitTextMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardCommitTextMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardCommitTextMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardCommitTextMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardCommitTextMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardCommitTextMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardCommitTextMETA, keyboard),
+    FIELD_STRING_ARRAY(XrEventDataVirtualKeyboardCommitTextMETA, text),
+};
+
+void serialize(const XrEventDataVirtualKeyboardCommitTextMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardCommitTextMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardCommitTextMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardCommitTextMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardCommitTextMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardCommitTextMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardEnterMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardEnterMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardEnterMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardEnterMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardEnterMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardEnterMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardEnterMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardEnterMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardEnterMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardEnterMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardEnterMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardEnterMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardEnterMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardEnterMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardEnterMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardEnterMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardEnterMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardEnterMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardEnterMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardEnterMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardHiddenMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardHiddenMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardHiddenMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardHiddenMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardHiddenMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardHiddenMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardHiddenMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardHiddenMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardHiddenMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardHiddenMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardHiddenMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardHiddenMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardHiddenMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardHiddenMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardHiddenMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardHiddenMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardHiddenMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardHiddenMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardHiddenMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardHiddenMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardShownMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardShownMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardShownMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardShownMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardShownMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardShownMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardShownMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardShownMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardShownMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardShownMETA);
+}
+
+constexpr FieldDescriptor fields_XrEventDataVirtualKeyboardShownMETA[] = {
+    FIELD_VALUE(XrEventDataVirtualKeyboardShownMETA, type),
+    FIELD_XR(XrEventDataVirtualKeyboardShownMETA, next),
+    FIELD_VALUE(XrEventDataVirtualKeyboardShownMETA, keyboard),
+};
+
+void serialize(const XrEventDataVirtualKeyboardShownMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataVirtualKeyboardShownMETA, ctx);
+}
+
+void deserialize(XrEventDataVirtualKeyboardShownMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataVirtualKeyboardShownMETA, ctx);
+}
+
+void cleanup(const XrEventDataVirtualKeyboardShownMETA* s) {
+    cleanup_fields(s, fields_XrEventDataVirtualKeyboardShownMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemVirtualKeyboardPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemVirtualKeyboardPropertiesMETA, type),
+    FIELD_XR(XrSystemVirtualKeyboardPropertiesMETA, next),
+    FIELD_VALUE(XrSystemVirtualKeyboardPropertiesMETA, supportsVirtualKeyboard),
+};
+
+void serialize(const XrSystemVirtualKeyboardPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemVirtualKeyboardPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemVirtualKeyboardPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemVirtualKeyboardPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemVirtualKeyboardPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemVirtualKeyboardPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrSystemVirtualKeyboardPropertiesMETA[] = {
+    FIELD_VALUE(XrSystemVirtualKeyboardPropertiesMETA, type),
+    FIELD_XR(XrSystemVirtualKeyboardPropertiesMETA, next),
+    FIELD_VALUE(XrSystemVirtualKeyboardPropertiesMETA, supportsVirtualKeyboard),
+};
+
+void serialize(const XrSystemVirtualKeyboardPropertiesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemVirtualKeyboardPropertiesMETA, ctx);
+}
+
+void deserialize(XrSystemVirtualKeyboardPropertiesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemVirtualKeyboardPropertiesMETA, ctx);
+}
+
+void cleanup(const XrSystemVirtualKeyboardPropertiesMETA* s) {
+    cleanup_fields(s, fields_XrSystemVirtualKeyboardPropertiesMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardAnimationStateMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardAnimationStateMETA, type),
+    FIELD_XR(XrVirtualKeyboardAnimationStateMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardAnimationStateMETA, animationIndex),
+    FIELD_VALUE(XrVirtualKeyboardAnimationStateMETA, fraction),
+};
+
+void serialize(const XrVirtualKeyboardAnimationStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardAnimationStateMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardAnimationStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardAnimationStateMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardAnimationStateMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardAnimationStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardAnimationStateMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardAnimationStateMETA, type),
+    FIELD_XR(XrVirtualKeyboardAnimationStateMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardAnimationStateMETA, animationIndex),
+    FIELD_VALUE(XrVirtualKeyboardAnimationStateMETA, fraction),
+};
+
+void serialize(const XrVirtualKeyboardAnimationStateMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardAnimationStateMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardAnimationStateMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardAnimationStateMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardAnimationStateMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardAnimationStateMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardCreateInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardCreateInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardCreateInfoMETA, next),
+};
+
+void serialize(const XrVirtualKeyboardCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardCreateInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardCreateInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardCreateInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardCreateInfoMETA, next),
+};
+
+void serialize(const XrVirtualKeyboardCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardCreateInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardInputInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardInputInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputSource),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputSpace),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputPoseInSpace),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputState),
+};
+
+void serialize(const XrVirtualKeyboardInputInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardInputInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardInputInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardInputInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardInputInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardInputInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardInputInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardInputInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputSource),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputSpace),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputPoseInSpace),
+    FIELD_VALUE(XrVirtualKeyboardInputInfoMETA, inputState),
+};
+
+void serialize(const XrVirtualKeyboardInputInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardInputInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardInputInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardInputInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardInputInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardInputInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardLocationInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardLocationInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, locationType),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, space),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, poseInSpace),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, scale),
+};
+
+void serialize(const XrVirtualKeyboardLocationInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardLocationInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardLocationInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardLocationInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardLocationInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardLocationInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardLocationInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardLocationInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, locationType),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, space),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, poseInSpace),
+    FIELD_VALUE(XrVirtualKeyboardLocationInfoMETA, scale),
+};
+
+void serialize(const XrVirtualKeyboardLocationInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardLocationInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardLocationInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardLocationInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardLocationInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardLocationInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardModelAnimationStatesMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardModelAnimationStatesMETA, type),
+    FIELD_XR(XrVirtualKeyboardModelAnimationStatesMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardModelAnimationStatesMETA, stateCapacityInput),
+    FIELD_VALUE(XrVirtualKeyboardModelAnimationStatesMETA, stateCountOutput),
+    FIELD_PTR(XrVirtualKeyboardModelAnimationStatesMETA, states, stateCapacityInput),
+};
+
+void serialize(const XrVirtualKeyboardModelAnimationStatesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardModelAnimationStatesMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardModelAnimationStatesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardModelAnimationStatesMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardModelAnimationStatesMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardModelAnimationStatesMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardModelAnimationStatesMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardModelAnimationStatesMETA, type),
+    FIELD_XR(XrVirtualKeyboardModelAnimationStatesMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardModelAnimationStatesMETA, stateCapacityInput),
+    FIELD_VALUE(XrVirtualKeyboardModelAnimationStatesMETA, stateCountOutput),
+    FIELD_PTR(XrVirtualKeyboardModelAnimationStatesMETA, states, stateCapacityInput),
+};
+
+void serialize(const XrVirtualKeyboardModelAnimationStatesMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardModelAnimationStatesMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardModelAnimationStatesMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardModelAnimationStatesMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardModelAnimationStatesMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardModelAnimationStatesMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardModelVisibilitySetInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardModelVisibilitySetInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardModelVisibilitySetInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardModelVisibilitySetInfoMETA, visible),
+};
+
+void serialize(const XrVirtualKeyboardModelVisibilitySetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardModelVisibilitySetInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardModelVisibilitySetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardModelVisibilitySetInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardModelVisibilitySetInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardModelVisibilitySetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardModelVisibilitySetInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardModelVisibilitySetInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardModelVisibilitySetInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardModelVisibilitySetInfoMETA, visible),
+};
+
+void serialize(const XrVirtualKeyboardModelVisibilitySetInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardModelVisibilitySetInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardModelVisibilitySetInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardModelVisibilitySetInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardModelVisibilitySetInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardModelVisibilitySetInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardSpaceCreateInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardSpaceCreateInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, locationType),
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, space),
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, poseInSpace),
+};
+
+void serialize(const XrVirtualKeyboardSpaceCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardSpaceCreateInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardSpaceCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardSpaceCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardSpaceCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardSpaceCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardSpaceCreateInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardSpaceCreateInfoMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, locationType),
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, space),
+    FIELD_VALUE(XrVirtualKeyboardSpaceCreateInfoMETA, poseInSpace),
+};
+
+void serialize(const XrVirtualKeyboardSpaceCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardSpaceCreateInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardSpaceCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardSpaceCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardSpaceCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardSpaceCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardTextContextChangeInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardTextContextChangeInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardTextContextChangeInfoMETA, next),
+    FIELD_STRING(XrVirtualKeyboardTextContextChangeInfoMETA, textContext),
+};
+
+void serialize(const XrVirtualKeyboardTextContextChangeInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardTextContextChangeInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardTextContextChangeInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardTextContextChangeInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardTextContextChangeInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardTextContextChangeInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardTextContextChangeInfoMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardTextContextChangeInfoMETA, type),
+    FIELD_XR(XrVirtualKeyboardTextContextChangeInfoMETA, next),
+    FIELD_STRING(XrVirtualKeyboardTextContextChangeInfoMETA, textContext),
+};
+
+void serialize(const XrVirtualKeyboardTextContextChangeInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardTextContextChangeInfoMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardTextContextChangeInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardTextContextChangeInfoMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardTextContextChangeInfoMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardTextContextChangeInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardTextureDataMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, type),
+    FIELD_XR(XrVirtualKeyboardTextureDataMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, textureWidth),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, textureHeight),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, bufferCapacityInput),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, bufferCountOutput),
+    FIELD_PTR(XrVirtualKeyboardTextureDataMETA, buffer, bufferCapacityInput),
+};
+
+void serialize(const XrVirtualKeyboardTextureDataMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardTextureDataMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardTextureDataMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardTextureDataMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardTextureDataMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardTextureDataMETA);
+}
+
+constexpr FieldDescriptor fields_XrVirtualKeyboardTextureDataMETA[] = {
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, type),
+    FIELD_XR(XrVirtualKeyboardTextureDataMETA, next),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, textureWidth),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, textureHeight),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, bufferCapacityInput),
+    FIELD_VALUE(XrVirtualKeyboardTextureDataMETA, bufferCountOutput),
+    FIELD_PTR(XrVirtualKeyboardTextureDataMETA, buffer, bufferCapacityInput),
+};
+
+void serialize(const XrVirtualKeyboardTextureDataMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVirtualKeyboardTextureDataMETA, ctx);
+}
+
+void deserialize(XrVirtualKeyboardTextureDataMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVirtualKeyboardTextureDataMETA, ctx);
+}
+
+void cleanup(const XrVirtualKeyboardTextureDataMETA* s) {
+    cleanup_fields(s, fields_XrVirtualKeyboardTextureDataMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_virtual_keyboard
+#ifdef XRTRANSPORT_EXT_XR_META_vulkan_swapchain_create_info
+constexpr FieldDescriptor fields_XrVulkanSwapchainCreateInfoMETA[] = {
+    FIELD_VALUE(XrVulkanSwapchainCreateInfoMETA, type),
+    FIELD_XR(XrVulkanSwapchainCreateInfoMETA, next),
+    FIELD_VALUE(XrVulkanSwapchainCreateInfoMETA, additionalCreateFlags),
+    FIELD_VALUE(XrVulkanSwapchainCreateInfoMETA, additionalUsageFlags),
+};
+
+void serialize(const XrVulkanSwapchainCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanSwapchainCreateInfoMETA, ctx);
+}
+
+void deserialize(XrVulkanSwapchainCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanSwapchainCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrVulkanSwapchainCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrVulkanSwapchainCreateInfoMETA);
+}
+
+constexpr FieldDescriptor fields_XrVulkanSwapchainCreateInfoMETA[] = {
+    FIELD_VALUE(XrVulkanSwapchainCreateInfoMETA, type),
+    FIELD_XR(XrVulkanSwapchainCreateInfoMETA, next),
+    FIELD_VALUE(XrVulkanSwapchainCreateInfoMETA, additionalCreateFlags),
+    FIELD_VALUE(XrVulkanSwapchainCreateInfoMETA, additionalUsageFlags),
+};
+
+void serialize(const XrVulkanSwapchainCreateInfoMETA* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVulkanSwapchainCreateInfoMETA, ctx);
+}
+
+void deserialize(XrVulkanSwapchainCreateInfoMETA* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVulkanSwapchainCreateInfoMETA, ctx);
+}
+
+void cleanup(const XrVulkanSwapchainCreateInfoMETA* s) {
+    cleanup_fields(s, fields_XrVulkanSwapchainCreateInfoMETA);
+}
+
+#endif // XRTRANSPORT_EXT_XR_META_vulkan_swapchain_create_info
+#ifdef XRTRANSPORT_EXT_XR_ML_compat
+constexpr FieldDescriptor fields_XrCoordinateSpaceCreateInfoML[] = {
+    FIELD_VALUE(XrCoordinateSpaceCreateInfoML, type),
+    FIELD_XR(XrCoordinateSpaceCreateInfoML, next),
+    FIELD_VALUE(XrCoordinateSpaceCreateInfoML, cfuid),
+    FIELD_VALUE(XrCoordinateSpaceCreateInfoML, poseInCoordinateSpace),
+};
+
+void serialize(const XrCoordinateSpaceCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCoordinateSpaceCreateInfoML, ctx);
+}
+
+void deserialize(XrCoordinateSpaceCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCoordinateSpaceCreateInfoML, ctx);
+}
+
+void cleanup(const XrCoordinateSpaceCreateInfoML* s) {
+    cleanup_fields(s, fields_XrCoordinateSpaceCreateInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_compat
+#ifdef XRTRANSPORT_EXT_XR_ML_facial_expression
+constexpr FieldDescriptor fields_XrFacialExpressionBlendShapeGetInfoML[] = {
+    FIELD_VALUE(XrFacialExpressionBlendShapeGetInfoML, type),
+    FIELD_XR(XrFacialExpressionBlendShapeGetInfoML, next),
+};
+
+void serialize(const XrFacialExpressionBlendShapeGetInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionBlendShapeGetInfoML, ctx);
+}
+
+void deserialize(XrFacialExpressionBlendShapeGetInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionBlendShapeGetInfoML, ctx);
+}
+
+void cleanup(const XrFacialExpressionBlendShapeGetInfoML* s) {
+    cleanup_fields(s, fields_XrFacialExpressionBlendShapeGetInfoML);
+}
+
+constexpr FieldDescriptor fields_XrFacialExpressionBlendShapeGetInfoML[] = {
+    FIELD_VALUE(XrFacialExpressionBlendShapeGetInfoML, type),
+    FIELD_XR(XrFacialExpressionBlendShapeGetInfoML, next),
+};
+
+void serialize(const XrFacialExpressionBlendShapeGetInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionBlendShapeGetInfoML, ctx);
+}
+
+void deserialize(XrFacialExpressionBlendShapeGetInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionBlendShapeGetInfoML, ctx);
+}
+
+void cleanup(const XrFacialExpressionBlendShapeGetInfoML* s) {
+    cleanup_fields(s, fields_XrFacialExpressionBlendShapeGetInfoML);
+}
+
+constexpr FieldDescriptor fields_XrFacialExpressionBlendShapePropertiesML[] = {
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, type),
+    FIELD_XR(XrFacialExpressionBlendShapePropertiesML, next),
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, requestedFacialBlendShape),
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, weight),
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, flags),
+    FIELD_TIME(XrFacialExpressionBlendShapePropertiesML, time),
+};
+
+void serialize(const XrFacialExpressionBlendShapePropertiesML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionBlendShapePropertiesML, ctx);
+}
+
+void deserialize(XrFacialExpressionBlendShapePropertiesML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionBlendShapePropertiesML, ctx);
+}
+
+void cleanup(const XrFacialExpressionBlendShapePropertiesML* s) {
+    cleanup_fields(s, fields_XrFacialExpressionBlendShapePropertiesML);
+}
+
+constexpr FieldDescriptor fields_XrFacialExpressionBlendShapePropertiesML[] = {
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, type),
+    FIELD_XR(XrFacialExpressionBlendShapePropertiesML, next),
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, requestedFacialBlendShape),
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, weight),
+    FIELD_VALUE(XrFacialExpressionBlendShapePropertiesML, flags),
+    FIELD_TIME(XrFacialExpressionBlendShapePropertiesML, time),
+};
+
+void serialize(const XrFacialExpressionBlendShapePropertiesML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionBlendShapePropertiesML, ctx);
+}
+
+void deserialize(XrFacialExpressionBlendShapePropertiesML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionBlendShapePropertiesML, ctx);
+}
+
+void cleanup(const XrFacialExpressionBlendShapePropertiesML* s) {
+    cleanup_fields(s, fields_XrFacialExpressionBlendShapePropertiesML);
+}
+
+constexpr FieldDescriptor fields_XrFacialExpressionClientCreateInfoML[] = {
+    FIELD_VALUE(XrFacialExpressionClientCreateInfoML, type),
+    FIELD_XR(XrFacialExpressionClientCreateInfoML, next),
+    FIELD_VALUE(XrFacialExpressionClientCreateInfoML, requestedCount),
+    FIELD_PTR(XrFacialExpressionClientCreateInfoML, requestedFacialBlendShapes, requestedCount),
+};
+
+void serialize(const XrFacialExpressionClientCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionClientCreateInfoML, ctx);
+}
+
+void deserialize(XrFacialExpressionClientCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionClientCreateInfoML, ctx);
+}
+
+void cleanup(const XrFacialExpressionClientCreateInfoML* s) {
+    cleanup_fields(s, fields_XrFacialExpressionClientCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrFacialExpressionClientCreateInfoML[] = {
+    FIELD_VALUE(XrFacialExpressionClientCreateInfoML, type),
+    FIELD_XR(XrFacialExpressionClientCreateInfoML, next),
+    FIELD_VALUE(XrFacialExpressionClientCreateInfoML, requestedCount),
+    FIELD_PTR(XrFacialExpressionClientCreateInfoML, requestedFacialBlendShapes, requestedCount),
+};
+
+void serialize(const XrFacialExpressionClientCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFacialExpressionClientCreateInfoML, ctx);
+}
+
+void deserialize(XrFacialExpressionClientCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFacialExpressionClientCreateInfoML, ctx);
+}
+
+void cleanup(const XrFacialExpressionClientCreateInfoML* s) {
+    cleanup_fields(s, fields_XrFacialExpressionClientCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSystemFacialExpressionPropertiesML[] = {
+    FIELD_VALUE(XrSystemFacialExpressionPropertiesML, type),
+    FIELD_XR(XrSystemFacialExpressionPropertiesML, next),
+    FIELD_VALUE(XrSystemFacialExpressionPropertiesML, supportsFacialExpression),
+};
+
+void serialize(const XrSystemFacialExpressionPropertiesML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFacialExpressionPropertiesML, ctx);
+}
+
+void deserialize(XrSystemFacialExpressionPropertiesML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFacialExpressionPropertiesML, ctx);
+}
+
+void cleanup(const XrSystemFacialExpressionPropertiesML* s) {
+    cleanup_fields(s, fields_XrSystemFacialExpressionPropertiesML);
+}
+
+constexpr FieldDescriptor fields_XrSystemFacialExpressionPropertiesML[] = {
+    FIELD_VALUE(XrSystemFacialExpressionPropertiesML, type),
+    FIELD_XR(XrSystemFacialExpressionPropertiesML, next),
+    FIELD_VALUE(XrSystemFacialExpressionPropertiesML, supportsFacialExpression),
+};
+
+void serialize(const XrSystemFacialExpressionPropertiesML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFacialExpressionPropertiesML, ctx);
+}
+
+void deserialize(XrSystemFacialExpressionPropertiesML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFacialExpressionPropertiesML, ctx);
+}
+
+void cleanup(const XrSystemFacialExpressionPropertiesML* s) {
+    cleanup_fields(s, fields_XrSystemFacialExpressionPropertiesML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_facial_expression
+#ifdef XRTRANSPORT_EXT_XR_ML_frame_end_info
+constexpr FieldDescriptor fields_XrFrameEndInfoML[] = {
+    FIELD_VALUE(XrFrameEndInfoML, type),
+    FIELD_XR(XrFrameEndInfoML, next),
+    FIELD_VALUE(XrFrameEndInfoML, focusDistance),
+    FIELD_VALUE(XrFrameEndInfoML, flags),
+};
+
+void serialize(const XrFrameEndInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameEndInfoML, ctx);
+}
+
+void deserialize(XrFrameEndInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameEndInfoML, ctx);
+}
+
+void cleanup(const XrFrameEndInfoML* s) {
+    cleanup_fields(s, fields_XrFrameEndInfoML);
+}
+
+constexpr FieldDescriptor fields_XrFrameEndInfoML[] = {
+    FIELD_VALUE(XrFrameEndInfoML, type),
+    FIELD_XR(XrFrameEndInfoML, next),
+    FIELD_VALUE(XrFrameEndInfoML, focusDistance),
+    FIELD_VALUE(XrFrameEndInfoML, flags),
+};
+
+void serialize(const XrFrameEndInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameEndInfoML, ctx);
+}
+
+void deserialize(XrFrameEndInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameEndInfoML, ctx);
+}
+
+void cleanup(const XrFrameEndInfoML* s) {
+    cleanup_fields(s, fields_XrFrameEndInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_frame_end_info
+#ifdef XRTRANSPORT_EXT_XR_ML_global_dimmer
+constexpr FieldDescriptor fields_XrGlobalDimmerFrameEndInfoML[] = {
+    FIELD_VALUE(XrGlobalDimmerFrameEndInfoML, type),
+    FIELD_XR(XrGlobalDimmerFrameEndInfoML, next),
+    FIELD_VALUE(XrGlobalDimmerFrameEndInfoML, dimmerValue),
+    FIELD_VALUE(XrGlobalDimmerFrameEndInfoML, flags),
+};
+
+void serialize(const XrGlobalDimmerFrameEndInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGlobalDimmerFrameEndInfoML, ctx);
+}
+
+void deserialize(XrGlobalDimmerFrameEndInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGlobalDimmerFrameEndInfoML, ctx);
+}
+
+void cleanup(const XrGlobalDimmerFrameEndInfoML* s) {
+    cleanup_fields(s, fields_XrGlobalDimmerFrameEndInfoML);
+}
+
+constexpr FieldDescriptor fields_XrGlobalDimmerFrameEndInfoML[] = {
+    FIELD_VALUE(XrGlobalDimmerFrameEndInfoML, type),
+    FIELD_XR(XrGlobalDimmerFrameEndInfoML, next),
+    FIELD_VALUE(XrGlobalDimmerFrameEndInfoML, dimmerValue),
+    FIELD_VALUE(XrGlobalDimmerFrameEndInfoML, flags),
+};
+
+void serialize(const XrGlobalDimmerFrameEndInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGlobalDimmerFrameEndInfoML, ctx);
+}
+
+void deserialize(XrGlobalDimmerFrameEndInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGlobalDimmerFrameEndInfoML, ctx);
+}
+
+void cleanup(const XrGlobalDimmerFrameEndInfoML* s) {
+    cleanup_fields(s, fields_XrGlobalDimmerFrameEndInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_global_dimmer
+#ifdef XRTRANSPORT_EXT_XR_ML_localization_map
+constexpr FieldDescriptor fields_XrEventDataLocalizationChangedML[] = {
+    FIELD_VALUE(XrEventDataLocalizationChangedML, type),
+    FIELD_XR(XrEventDataLocalizationChangedML, next),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, session),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, state),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, map),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, confidence),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, errorFlags),
+};
+
+void serialize(const XrEventDataLocalizationChangedML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataLocalizationChangedML, ctx);
+}
+
+void deserialize(XrEventDataLocalizationChangedML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataLocalizationChangedML, ctx);
+}
+
+void cleanup(const XrEventDataLocalizationChangedML* s) {
+    cleanup_fields(s, fields_XrEventDataLocalizationChangedML);
+}
+
+constexpr FieldDescriptor fields_XrEventDataLocalizationChangedML[] = {
+    FIELD_VALUE(XrEventDataLocalizationChangedML, type),
+    FIELD_XR(XrEventDataLocalizationChangedML, next),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, session),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, state),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, map),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, confidence),
+    FIELD_VALUE(XrEventDataLocalizationChangedML, errorFlags),
+};
+
+void serialize(const XrEventDataLocalizationChangedML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataLocalizationChangedML, ctx);
+}
+
+void deserialize(XrEventDataLocalizationChangedML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataLocalizationChangedML, ctx);
+}
+
+void cleanup(const XrEventDataLocalizationChangedML* s) {
+    cleanup_fields(s, fields_XrEventDataLocalizationChangedML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationEnableEventsInfoML[] = {
+    FIELD_VALUE(XrLocalizationEnableEventsInfoML, type),
+    FIELD_XR(XrLocalizationEnableEventsInfoML, next),
+    FIELD_VALUE(XrLocalizationEnableEventsInfoML, enabled),
+};
+
+void serialize(const XrLocalizationEnableEventsInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalizationEnableEventsInfoML, ctx);
+}
+
+void deserialize(XrLocalizationEnableEventsInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationEnableEventsInfoML, ctx);
+}
+
+void cleanup(const XrLocalizationEnableEventsInfoML* s) {
+    cleanup_fields(s, fields_XrLocalizationEnableEventsInfoML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationEnableEventsInfoML[] = {
+    FIELD_VALUE(XrLocalizationEnableEventsInfoML, type),
+    FIELD_XR(XrLocalizationEnableEventsInfoML, next),
+    FIELD_VALUE(XrLocalizationEnableEventsInfoML, enabled),
+};
+
+void serialize(const XrLocalizationEnableEventsInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalizationEnableEventsInfoML, ctx);
+}
+
+void deserialize(XrLocalizationEnableEventsInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationEnableEventsInfoML, ctx);
+}
+
+void cleanup(const XrLocalizationEnableEventsInfoML* s) {
+    cleanup_fields(s, fields_XrLocalizationEnableEventsInfoML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationMapImportInfoML[] = {
+    FIELD_VALUE(XrLocalizationMapImportInfoML, type),
+    FIELD_XR(XrLocalizationMapImportInfoML, next),
+    FIELD_VALUE(XrLocalizationMapImportInfoML, size),
+    FIELD_PTR(XrLocalizationMapImportInfoML, data, size),
+};
+
+void serialize(const XrLocalizationMapImportInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalizationMapImportInfoML, ctx);
+}
+
+void deserialize(XrLocalizationMapImportInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationMapImportInfoML, ctx);
+}
+
+void cleanup(const XrLocalizationMapImportInfoML* s) {
+    cleanup_fields(s, fields_XrLocalizationMapImportInfoML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationMapImportInfoML[] = {
+    FIELD_VALUE(XrLocalizationMapImportInfoML, type),
+    FIELD_XR(XrLocalizationMapImportInfoML, next),
+    FIELD_VALUE(XrLocalizationMapImportInfoML, size),
+    FIELD_PTR(XrLocalizationMapImportInfoML, data, size),
+};
+
+void serialize(const XrLocalizationMapImportInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalizationMapImportInfoML, ctx);
+}
+
+void deserialize(XrLocalizationMapImportInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationMapImportInfoML, ctx);
+}
+
+void cleanup(const XrLocalizationMapImportInfoML* s) {
+    cleanup_fields(s, fields_XrLocalizationMapImportInfoML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationMapML[] = {
+    FIELD_VALUE(XrLocalizationMapML, type),
+    FIELD_XR(XrLocalizationMapML, next),
+    FIELD_STRING_ARRAY(XrLocalizationMapML, name),
+    FIELD_VALUE(XrLocalizationMapML, mapUuid),
+    FIELD_VALUE(XrLocalizationMapML, mapType),
+};
+
+void serialize(const XrLocalizationMapML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalizationMapML, ctx);
+}
+
+void deserialize(XrLocalizationMapML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationMapML, ctx);
+}
+
+void cleanup(const XrLocalizationMapML* s) {
+    cleanup_fields(s, fields_XrLocalizationMapML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationMapML[] = {
+    FIELD_VALUE(XrLocalizationMapML, type),
+    FIELD_XR(XrLocalizationMapML, next),
+    FIELD_STRING_ARRAY(XrLocalizationMapML, name),
+    FIELD_VALUE(XrLocalizationMapML, mapUuid),
+    FIELD_VALUE(XrLocalizationMapML, mapType),
+};
+
+void serialize(const XrLocalizationMapML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrLocalizationMapML, ctx);
+}
+
+void deserialize(XrLocalizationMapML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationMapML, ctx);
+}
+
+void cleanup(const XrLocalizationMapML* s) {
+    cleanup_fields(s, fields_XrLocalizationMapML);
+}
+
+constexpr FieldDescriptor fields_XrLocalizationMapQueryInfoBaseHeaderML[] = {
+    FIELD_VALUE(XrLocalizationMapQueryInfoBaseHeaderML, type),
+    FIELD_XR(XrLocalizationMapQueryInfoBaseHeaderML, next),
+};
+
+void serialize(const XrLocalizationMapQueryInfoBaseHeaderML* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrLocalizationMapQueryInfoBaseHeaderML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrLocalizationMapQueryInfoBaseHeaderML, ctx);
+}
+
+void cleanup(const XrLocalizationMapQueryInfoBaseHeaderML* s) {
+    cleanup_fields(s, fields_XrLocalizationMapQueryInfoBaseHeaderML);
+}
+
+constexpr FieldDescriptor fields_XrMapLocalizationRequestInfoML[] = {
+    FIELD_VALUE(XrMapLocalizationRequestInfoML, type),
+    FIELD_XR(XrMapLocalizationRequestInfoML, next),
+    FIELD_VALUE(XrMapLocalizationRequestInfoML, mapUuid),
+};
+
+void serialize(const XrMapLocalizationRequestInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMapLocalizationRequestInfoML, ctx);
+}
+
+void deserialize(XrMapLocalizationRequestInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMapLocalizationRequestInfoML, ctx);
+}
+
+void cleanup(const XrMapLocalizationRequestInfoML* s) {
+    cleanup_fields(s, fields_XrMapLocalizationRequestInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMapLocalizationRequestInfoML[] = {
+    FIELD_VALUE(XrMapLocalizationRequestInfoML, type),
+    FIELD_XR(XrMapLocalizationRequestInfoML, next),
+    FIELD_VALUE(XrMapLocalizationRequestInfoML, mapUuid),
+};
+
+void serialize(const XrMapLocalizationRequestInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMapLocalizationRequestInfoML, ctx);
+}
+
+void deserialize(XrMapLocalizationRequestInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMapLocalizationRequestInfoML, ctx);
+}
+
+void cleanup(const XrMapLocalizationRequestInfoML* s) {
+    cleanup_fields(s, fields_XrMapLocalizationRequestInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_localization_map
+#ifdef XRTRANSPORT_EXT_XR_ML_marker_understanding
+constexpr FieldDescriptor fields_XrMarkerDetectorAprilTagInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorAprilTagInfoML, type),
+    FIELD_XR(XrMarkerDetectorAprilTagInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorAprilTagInfoML, aprilTagDict),
+};
+
+void serialize(const XrMarkerDetectorAprilTagInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorAprilTagInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorAprilTagInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorAprilTagInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorAprilTagInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorAprilTagInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorAprilTagInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorAprilTagInfoML, type),
+    FIELD_XR(XrMarkerDetectorAprilTagInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorAprilTagInfoML, aprilTagDict),
+};
+
+void serialize(const XrMarkerDetectorAprilTagInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorAprilTagInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorAprilTagInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorAprilTagInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorAprilTagInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorAprilTagInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorArucoInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorArucoInfoML, type),
+    FIELD_XR(XrMarkerDetectorArucoInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorArucoInfoML, arucoDict),
+};
+
+void serialize(const XrMarkerDetectorArucoInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorArucoInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorArucoInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorArucoInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorArucoInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorArucoInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorArucoInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorArucoInfoML, type),
+    FIELD_XR(XrMarkerDetectorArucoInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorArucoInfoML, arucoDict),
+};
+
+void serialize(const XrMarkerDetectorArucoInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorArucoInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorArucoInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorArucoInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorArucoInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorArucoInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorCreateInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorCreateInfoML, type),
+    FIELD_XR(XrMarkerDetectorCreateInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorCreateInfoML, profile),
+    FIELD_VALUE(XrMarkerDetectorCreateInfoML, markerType),
+};
+
+void serialize(const XrMarkerDetectorCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorCreateInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorCreateInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorCreateInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorCreateInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorCreateInfoML, type),
+    FIELD_XR(XrMarkerDetectorCreateInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorCreateInfoML, profile),
+    FIELD_VALUE(XrMarkerDetectorCreateInfoML, markerType),
+};
+
+void serialize(const XrMarkerDetectorCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorCreateInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorCreateInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorCreateInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorCustomProfileInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, type),
+    FIELD_XR(XrMarkerDetectorCustomProfileInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, fpsHint),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, resolutionHint),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, cameraHint),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, cornerRefineMethod),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, useEdgeRefinement),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, fullAnalysisIntervalHint),
+};
+
+void serialize(const XrMarkerDetectorCustomProfileInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorCustomProfileInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorCustomProfileInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorCustomProfileInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorCustomProfileInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorCustomProfileInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorCustomProfileInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, type),
+    FIELD_XR(XrMarkerDetectorCustomProfileInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, fpsHint),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, resolutionHint),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, cameraHint),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, cornerRefineMethod),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, useEdgeRefinement),
+    FIELD_VALUE(XrMarkerDetectorCustomProfileInfoML, fullAnalysisIntervalHint),
+};
+
+void serialize(const XrMarkerDetectorCustomProfileInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorCustomProfileInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorCustomProfileInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorCustomProfileInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorCustomProfileInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorCustomProfileInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorSizeInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorSizeInfoML, type),
+    FIELD_XR(XrMarkerDetectorSizeInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorSizeInfoML, markerLength),
+};
+
+void serialize(const XrMarkerDetectorSizeInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorSizeInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorSizeInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorSizeInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorSizeInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorSizeInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorSizeInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorSizeInfoML, type),
+    FIELD_XR(XrMarkerDetectorSizeInfoML, next),
+    FIELD_VALUE(XrMarkerDetectorSizeInfoML, markerLength),
+};
+
+void serialize(const XrMarkerDetectorSizeInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorSizeInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorSizeInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorSizeInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorSizeInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorSizeInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorSnapshotInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorSnapshotInfoML, type),
+    FIELD_XR(XrMarkerDetectorSnapshotInfoML, next),
+};
+
+void serialize(const XrMarkerDetectorSnapshotInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorSnapshotInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorSnapshotInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorSnapshotInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorSnapshotInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorSnapshotInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorSnapshotInfoML[] = {
+    FIELD_VALUE(XrMarkerDetectorSnapshotInfoML, type),
+    FIELD_XR(XrMarkerDetectorSnapshotInfoML, next),
+};
+
+void serialize(const XrMarkerDetectorSnapshotInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorSnapshotInfoML, ctx);
+}
+
+void deserialize(XrMarkerDetectorSnapshotInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorSnapshotInfoML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorSnapshotInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorSnapshotInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorStateML[] = {
+    FIELD_VALUE(XrMarkerDetectorStateML, type),
+    FIELD_XR(XrMarkerDetectorStateML, next),
+    FIELD_VALUE(XrMarkerDetectorStateML, state),
+};
+
+void serialize(const XrMarkerDetectorStateML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorStateML, ctx);
+}
+
+void deserialize(XrMarkerDetectorStateML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorStateML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorStateML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorStateML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerDetectorStateML[] = {
+    FIELD_VALUE(XrMarkerDetectorStateML, type),
+    FIELD_XR(XrMarkerDetectorStateML, next),
+    FIELD_VALUE(XrMarkerDetectorStateML, state),
+};
+
+void serialize(const XrMarkerDetectorStateML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerDetectorStateML, ctx);
+}
+
+void deserialize(XrMarkerDetectorStateML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerDetectorStateML, ctx);
+}
+
+void cleanup(const XrMarkerDetectorStateML* s) {
+    cleanup_fields(s, fields_XrMarkerDetectorStateML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerSpaceCreateInfoML[] = {
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, type),
+    FIELD_XR(XrMarkerSpaceCreateInfoML, next),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, markerDetector),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, marker),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, poseInMarkerSpace),
+};
+
+void serialize(const XrMarkerSpaceCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerSpaceCreateInfoML, ctx);
+}
+
+void deserialize(XrMarkerSpaceCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerSpaceCreateInfoML, ctx);
+}
+
+void cleanup(const XrMarkerSpaceCreateInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerSpaceCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrMarkerSpaceCreateInfoML[] = {
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, type),
+    FIELD_XR(XrMarkerSpaceCreateInfoML, next),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, markerDetector),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, marker),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoML, poseInMarkerSpace),
+};
+
+void serialize(const XrMarkerSpaceCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerSpaceCreateInfoML, ctx);
+}
+
+void deserialize(XrMarkerSpaceCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerSpaceCreateInfoML, ctx);
+}
+
+void cleanup(const XrMarkerSpaceCreateInfoML* s) {
+    cleanup_fields(s, fields_XrMarkerSpaceCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSystemMarkerUnderstandingPropertiesML[] = {
+    FIELD_VALUE(XrSystemMarkerUnderstandingPropertiesML, type),
+    FIELD_XR(XrSystemMarkerUnderstandingPropertiesML, next),
+    FIELD_VALUE(XrSystemMarkerUnderstandingPropertiesML, supportsMarkerUnderstanding),
+};
+
+void serialize(const XrSystemMarkerUnderstandingPropertiesML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemMarkerUnderstandingPropertiesML, ctx);
+}
+
+void deserialize(XrSystemMarkerUnderstandingPropertiesML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemMarkerUnderstandingPropertiesML, ctx);
+}
+
+void cleanup(const XrSystemMarkerUnderstandingPropertiesML* s) {
+    cleanup_fields(s, fields_XrSystemMarkerUnderstandingPropertiesML);
+}
+
+constexpr FieldDescriptor fields_XrSystemMarkerUnderstandingPropertiesML[] = {
+    FIELD_VALUE(XrSystemMarkerUnderstandingPropertiesML, type),
+    FIELD_XR(XrSystemMarkerUnderstandingPropertiesML, next),
+    FIELD_VALUE(XrSystemMarkerUnderstandingPropertiesML, supportsMarkerUnderstanding),
+};
+
+void serialize(const XrSystemMarkerUnderstandingPropertiesML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemMarkerUnderstandingPropertiesML, ctx);
+}
+
+void deserialize(XrSystemMarkerUnderstandingPropertiesML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemMarkerUnderstandingPropertiesML, ctx);
+}
+
+void cleanup(const XrSystemMarkerUnderstandingPropertiesML* s) {
+    cleanup_fields(s, fields_XrSystemMarkerUnderstandingPropertiesML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_marker_understanding
+#ifdef XRTRANSPORT_EXT_XR_ML_spatial_anchors
+constexpr FieldDescriptor fields_XrCreateSpatialAnchorsCompletionML[] = {
+    FIELD_VALUE(XrCreateSpatialAnchorsCompletionML, type),
+    FIELD_XR(XrCreateSpatialAnchorsCompletionML, next),
+    FIELD_VALUE(XrCreateSpatialAnchorsCompletionML, futureResult),
+    FIELD_VALUE(XrCreateSpatialAnchorsCompletionML, spaceCount),
+    FIELD_PTR(XrCreateSpatialAnchorsCompletionML, spaces, spaceCount),
+};
+
+void serialize(const XrCreateSpatialAnchorsCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCreateSpatialAnchorsCompletionML, ctx);
+}
+
+void deserialize(XrCreateSpatialAnchorsCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCreateSpatialAnchorsCompletionML, ctx);
+}
+
+void cleanup(const XrCreateSpatialAnchorsCompletionML* s) {
+    cleanup_fields(s, fields_XrCreateSpatialAnchorsCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrCreateSpatialAnchorsCompletionML[] = {
+    FIELD_VALUE(XrCreateSpatialAnchorsCompletionML, type),
+    FIELD_XR(XrCreateSpatialAnchorsCompletionML, next),
+    FIELD_VALUE(XrCreateSpatialAnchorsCompletionML, futureResult),
+    FIELD_VALUE(XrCreateSpatialAnchorsCompletionML, spaceCount),
+    FIELD_PTR(XrCreateSpatialAnchorsCompletionML, spaces, spaceCount),
+};
+
+void serialize(const XrCreateSpatialAnchorsCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCreateSpatialAnchorsCompletionML, ctx);
+}
+
+void deserialize(XrCreateSpatialAnchorsCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCreateSpatialAnchorsCompletionML, ctx);
+}
+
+void cleanup(const XrCreateSpatialAnchorsCompletionML* s) {
+    cleanup_fields(s, fields_XrCreateSpatialAnchorsCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorStateML[] = {
+    FIELD_VALUE(XrSpatialAnchorStateML, type),
+    FIELD_XR(XrSpatialAnchorStateML, next),
+    FIELD_VALUE(XrSpatialAnchorStateML, confidence),
+};
+
+void serialize(const XrSpatialAnchorStateML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorStateML, ctx);
+}
+
+void deserialize(XrSpatialAnchorStateML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorStateML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorStateML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorStateML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorStateML[] = {
+    FIELD_VALUE(XrSpatialAnchorStateML, type),
+    FIELD_XR(XrSpatialAnchorStateML, next),
+    FIELD_VALUE(XrSpatialAnchorStateML, confidence),
+};
+
+void serialize(const XrSpatialAnchorStateML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorStateML, ctx);
+}
+
+void deserialize(XrSpatialAnchorStateML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorStateML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorStateML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorStateML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateInfoBaseHeaderML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoBaseHeaderML, type),
+    FIELD_XR(XrSpatialAnchorsCreateInfoBaseHeaderML, next),
+};
+
+void serialize(const XrSpatialAnchorsCreateInfoBaseHeaderML* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateInfoBaseHeaderML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateInfoBaseHeaderML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateInfoBaseHeaderML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateInfoBaseHeaderML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateInfoFromPoseML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromPoseML, type),
+    FIELD_XR(XrSpatialAnchorsCreateInfoFromPoseML, next),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromPoseML, baseSpace),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromPoseML, poseInBaseSpace),
+    FIELD_TIME(XrSpatialAnchorsCreateInfoFromPoseML, time),
+};
+
+void serialize(const XrSpatialAnchorsCreateInfoFromPoseML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromPoseML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateInfoFromPoseML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromPoseML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateInfoFromPoseML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateInfoFromPoseML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateInfoFromPoseML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromPoseML, type),
+    FIELD_XR(XrSpatialAnchorsCreateInfoFromPoseML, next),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromPoseML, baseSpace),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromPoseML, poseInBaseSpace),
+    FIELD_TIME(XrSpatialAnchorsCreateInfoFromPoseML, time),
+};
+
+void serialize(const XrSpatialAnchorsCreateInfoFromPoseML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromPoseML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateInfoFromPoseML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromPoseML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateInfoFromPoseML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateInfoFromPoseML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_spatial_anchors
+#ifdef XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
+constexpr FieldDescriptor fields_XrSpatialAnchorCompletionResultML[] = {
+    FIELD_VALUE(XrSpatialAnchorCompletionResultML, uuid),
+    FIELD_VALUE(XrSpatialAnchorCompletionResultML, result),
+};
+
+void serialize(const XrSpatialAnchorCompletionResultML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCompletionResultML, ctx);
+}
+
+void deserialize(XrSpatialAnchorCompletionResultML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCompletionResultML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCompletionResultML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCompletionResultML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateInfoFromUuidsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromUuidsML, type),
+    FIELD_XR(XrSpatialAnchorsCreateInfoFromUuidsML, next),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromUuidsML, storage),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromUuidsML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsCreateInfoFromUuidsML, uuids, uuidCount),
+};
+
+void serialize(const XrSpatialAnchorsCreateInfoFromUuidsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromUuidsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateInfoFromUuidsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromUuidsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateInfoFromUuidsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateInfoFromUuidsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateInfoFromUuidsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromUuidsML, type),
+    FIELD_XR(XrSpatialAnchorsCreateInfoFromUuidsML, next),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromUuidsML, storage),
+    FIELD_VALUE(XrSpatialAnchorsCreateInfoFromUuidsML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsCreateInfoFromUuidsML, uuids, uuidCount),
+};
+
+void serialize(const XrSpatialAnchorsCreateInfoFromUuidsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromUuidsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateInfoFromUuidsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateInfoFromUuidsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateInfoFromUuidsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateInfoFromUuidsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateStorageInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateStorageInfoML, type),
+    FIELD_XR(XrSpatialAnchorsCreateStorageInfoML, next),
+};
+
+void serialize(const XrSpatialAnchorsCreateStorageInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsCreateStorageInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateStorageInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateStorageInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateStorageInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateStorageInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsCreateStorageInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsCreateStorageInfoML, type),
+    FIELD_XR(XrSpatialAnchorsCreateStorageInfoML, next),
+};
+
+void serialize(const XrSpatialAnchorsCreateStorageInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsCreateStorageInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsCreateStorageInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsCreateStorageInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsCreateStorageInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsCreateStorageInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsDeleteCompletionDetailsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionDetailsML, type),
+    FIELD_XR(XrSpatialAnchorsDeleteCompletionDetailsML, next),
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionDetailsML, resultCount),
+    FIELD_PTR(XrSpatialAnchorsDeleteCompletionDetailsML, results, resultCount),
+};
+
+void serialize(const XrSpatialAnchorsDeleteCompletionDetailsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionDetailsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsDeleteCompletionDetailsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionDetailsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsDeleteCompletionDetailsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsDeleteCompletionDetailsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsDeleteCompletionDetailsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionDetailsML, type),
+    FIELD_XR(XrSpatialAnchorsDeleteCompletionDetailsML, next),
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionDetailsML, resultCount),
+    FIELD_PTR(XrSpatialAnchorsDeleteCompletionDetailsML, results, resultCount),
+};
+
+void serialize(const XrSpatialAnchorsDeleteCompletionDetailsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionDetailsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsDeleteCompletionDetailsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionDetailsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsDeleteCompletionDetailsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsDeleteCompletionDetailsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsDeleteCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsDeleteCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionML, futureResult),
+};
+
+void serialize(const XrSpatialAnchorsDeleteCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsDeleteCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsDeleteCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsDeleteCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsDeleteCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsDeleteCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsDeleteCompletionML, futureResult),
+};
+
+void serialize(const XrSpatialAnchorsDeleteCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsDeleteCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsDeleteCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsDeleteCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsDeleteCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsDeleteInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsDeleteInfoML, type),
+    FIELD_XR(XrSpatialAnchorsDeleteInfoML, next),
+    FIELD_VALUE(XrSpatialAnchorsDeleteInfoML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsDeleteInfoML, uuids, uuidCount),
+};
+
+void serialize(const XrSpatialAnchorsDeleteInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsDeleteInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsDeleteInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsDeleteInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsDeleteInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsDeleteInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsDeleteInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsDeleteInfoML, type),
+    FIELD_XR(XrSpatialAnchorsDeleteInfoML, next),
+    FIELD_VALUE(XrSpatialAnchorsDeleteInfoML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsDeleteInfoML, uuids, uuidCount),
+};
+
+void serialize(const XrSpatialAnchorsDeleteInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsDeleteInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsDeleteInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsDeleteInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsDeleteInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsDeleteInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsPublishCompletionDetailsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionDetailsML, type),
+    FIELD_XR(XrSpatialAnchorsPublishCompletionDetailsML, next),
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionDetailsML, resultCount),
+    FIELD_PTR(XrSpatialAnchorsPublishCompletionDetailsML, results, resultCount),
+};
+
+void serialize(const XrSpatialAnchorsPublishCompletionDetailsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsPublishCompletionDetailsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsPublishCompletionDetailsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsPublishCompletionDetailsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsPublishCompletionDetailsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsPublishCompletionDetailsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsPublishCompletionDetailsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionDetailsML, type),
+    FIELD_XR(XrSpatialAnchorsPublishCompletionDetailsML, next),
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionDetailsML, resultCount),
+    FIELD_PTR(XrSpatialAnchorsPublishCompletionDetailsML, results, resultCount),
+};
+
+void serialize(const XrSpatialAnchorsPublishCompletionDetailsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsPublishCompletionDetailsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsPublishCompletionDetailsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsPublishCompletionDetailsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsPublishCompletionDetailsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsPublishCompletionDetailsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsPublishCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsPublishCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionML, futureResult),
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsPublishCompletionML, uuids, uuidCount),
+};
+
+void serialize(const XrSpatialAnchorsPublishCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsPublishCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsPublishCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsPublishCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsPublishCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsPublishCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsPublishCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsPublishCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionML, futureResult),
+    FIELD_VALUE(XrSpatialAnchorsPublishCompletionML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsPublishCompletionML, uuids, uuidCount),
+};
+
+void serialize(const XrSpatialAnchorsPublishCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsPublishCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsPublishCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsPublishCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsPublishCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsPublishCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsPublishInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsPublishInfoML, type),
+    FIELD_XR(XrSpatialAnchorsPublishInfoML, next),
+    FIELD_VALUE(XrSpatialAnchorsPublishInfoML, anchorCount),
+    FIELD_PTR(XrSpatialAnchorsPublishInfoML, anchors, anchorCount),
+    FIELD_VALUE(XrSpatialAnchorsPublishInfoML, expiration),
+};
+
+void serialize(const XrSpatialAnchorsPublishInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsPublishInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsPublishInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsPublishInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsPublishInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsPublishInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsPublishInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsPublishInfoML, type),
+    FIELD_XR(XrSpatialAnchorsPublishInfoML, next),
+    FIELD_VALUE(XrSpatialAnchorsPublishInfoML, anchorCount),
+    FIELD_PTR(XrSpatialAnchorsPublishInfoML, anchors, anchorCount),
+    FIELD_VALUE(XrSpatialAnchorsPublishInfoML, expiration),
+};
+
+void serialize(const XrSpatialAnchorsPublishInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsPublishInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsPublishInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsPublishInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsPublishInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsPublishInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsQueryCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsQueryCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, futureResult),
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, uuidCapacityInput),
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, uuidCountOutput),
+    FIELD_PTR(XrSpatialAnchorsQueryCompletionML, uuids, uuidCapacityInput),
+};
+
+void serialize(const XrSpatialAnchorsQueryCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsQueryCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsQueryCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsQueryCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsQueryCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsQueryCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsQueryCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsQueryCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, futureResult),
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, uuidCapacityInput),
+    FIELD_VALUE(XrSpatialAnchorsQueryCompletionML, uuidCountOutput),
+    FIELD_PTR(XrSpatialAnchorsQueryCompletionML, uuids, uuidCapacityInput),
+};
+
+void serialize(const XrSpatialAnchorsQueryCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsQueryCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsQueryCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsQueryCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsQueryCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsQueryCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsQueryInfoBaseHeaderML[] = {
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoBaseHeaderML, type),
+    FIELD_XR(XrSpatialAnchorsQueryInfoBaseHeaderML, next),
+};
+
+void serialize(const XrSpatialAnchorsQueryInfoBaseHeaderML* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSpatialAnchorsQueryInfoBaseHeaderML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsQueryInfoBaseHeaderML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsQueryInfoBaseHeaderML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsQueryInfoBaseHeaderML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsQueryInfoRadiusML[] = {
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, type),
+    FIELD_XR(XrSpatialAnchorsQueryInfoRadiusML, next),
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, baseSpace),
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, center),
+    FIELD_TIME(XrSpatialAnchorsQueryInfoRadiusML, time),
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, radius),
+};
+
+void serialize(const XrSpatialAnchorsQueryInfoRadiusML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsQueryInfoRadiusML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsQueryInfoRadiusML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsQueryInfoRadiusML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsQueryInfoRadiusML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsQueryInfoRadiusML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsQueryInfoRadiusML[] = {
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, type),
+    FIELD_XR(XrSpatialAnchorsQueryInfoRadiusML, next),
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, baseSpace),
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, center),
+    FIELD_TIME(XrSpatialAnchorsQueryInfoRadiusML, time),
+    FIELD_VALUE(XrSpatialAnchorsQueryInfoRadiusML, radius),
+};
+
+void serialize(const XrSpatialAnchorsQueryInfoRadiusML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsQueryInfoRadiusML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsQueryInfoRadiusML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsQueryInfoRadiusML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsQueryInfoRadiusML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsQueryInfoRadiusML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, type),
+    FIELD_XR(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, next),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, resultCount),
+    FIELD_PTR(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, results, resultCount),
+};
+
+void serialize(const XrSpatialAnchorsUpdateExpirationCompletionDetailsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsUpdateExpirationCompletionDetailsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsUpdateExpirationCompletionDetailsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML[] = {
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, type),
+    FIELD_XR(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, next),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, resultCount),
+    FIELD_PTR(XrSpatialAnchorsUpdateExpirationCompletionDetailsML, results, resultCount),
+};
+
+void serialize(const XrSpatialAnchorsUpdateExpirationCompletionDetailsML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsUpdateExpirationCompletionDetailsML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsUpdateExpirationCompletionDetailsML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionDetailsML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsUpdateExpirationCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsUpdateExpirationCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionML, futureResult),
+};
+
+void serialize(const XrSpatialAnchorsUpdateExpirationCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsUpdateExpirationCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsUpdateExpirationCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsUpdateExpirationCompletionML[] = {
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionML, type),
+    FIELD_XR(XrSpatialAnchorsUpdateExpirationCompletionML, next),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationCompletionML, futureResult),
+};
+
+void serialize(const XrSpatialAnchorsUpdateExpirationCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsUpdateExpirationCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsUpdateExpirationCompletionML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsUpdateExpirationCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsUpdateExpirationInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationInfoML, type),
+    FIELD_XR(XrSpatialAnchorsUpdateExpirationInfoML, next),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationInfoML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsUpdateExpirationInfoML, uuids, uuidCount),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationInfoML, expiration),
+};
+
+void serialize(const XrSpatialAnchorsUpdateExpirationInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsUpdateExpirationInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsUpdateExpirationInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsUpdateExpirationInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorsUpdateExpirationInfoML[] = {
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationInfoML, type),
+    FIELD_XR(XrSpatialAnchorsUpdateExpirationInfoML, next),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationInfoML, uuidCount),
+    FIELD_PTR(XrSpatialAnchorsUpdateExpirationInfoML, uuids, uuidCount),
+    FIELD_VALUE(XrSpatialAnchorsUpdateExpirationInfoML, expiration),
+};
+
+void serialize(const XrSpatialAnchorsUpdateExpirationInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationInfoML, ctx);
+}
+
+void deserialize(XrSpatialAnchorsUpdateExpirationInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorsUpdateExpirationInfoML, ctx);
+}
+
+void cleanup(const XrSpatialAnchorsUpdateExpirationInfoML* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorsUpdateExpirationInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
+#ifdef XRTRANSPORT_EXT_XR_ML_system_notifications
+constexpr FieldDescriptor fields_XrSystemNotificationsSetInfoML[] = {
+    FIELD_VALUE(XrSystemNotificationsSetInfoML, type),
+    FIELD_XR(XrSystemNotificationsSetInfoML, next),
+    FIELD_VALUE(XrSystemNotificationsSetInfoML, suppressNotifications),
+};
+
+void serialize(const XrSystemNotificationsSetInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemNotificationsSetInfoML, ctx);
+}
+
+void deserialize(XrSystemNotificationsSetInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemNotificationsSetInfoML, ctx);
+}
+
+void cleanup(const XrSystemNotificationsSetInfoML* s) {
+    cleanup_fields(s, fields_XrSystemNotificationsSetInfoML);
+}
+
+constexpr FieldDescriptor fields_XrSystemNotificationsSetInfoML[] = {
+    FIELD_VALUE(XrSystemNotificationsSetInfoML, type),
+    FIELD_XR(XrSystemNotificationsSetInfoML, next),
+    FIELD_VALUE(XrSystemNotificationsSetInfoML, suppressNotifications),
+};
+
+void serialize(const XrSystemNotificationsSetInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemNotificationsSetInfoML, ctx);
+}
+
+void deserialize(XrSystemNotificationsSetInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemNotificationsSetInfoML, ctx);
+}
+
+void cleanup(const XrSystemNotificationsSetInfoML* s) {
+    cleanup_fields(s, fields_XrSystemNotificationsSetInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_system_notifications
+#ifdef XRTRANSPORT_EXT_XR_ML_user_calibration
+constexpr FieldDescriptor fields_XrEventDataEyeCalibrationChangedML[] = {
+    FIELD_VALUE(XrEventDataEyeCalibrationChangedML, type),
+    FIELD_XR(XrEventDataEyeCalibrationChangedML, next),
+    FIELD_VALUE(XrEventDataEyeCalibrationChangedML, status),
+};
+
+void serialize(const XrEventDataEyeCalibrationChangedML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataEyeCalibrationChangedML, ctx);
+}
+
+void deserialize(XrEventDataEyeCalibrationChangedML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataEyeCalibrationChangedML, ctx);
+}
+
+void cleanup(const XrEventDataEyeCalibrationChangedML* s) {
+    cleanup_fields(s, fields_XrEventDataEyeCalibrationChangedML);
+}
+
+constexpr FieldDescriptor fields_XrEventDataEyeCalibrationChangedML[] = {
+    FIELD_VALUE(XrEventDataEyeCalibrationChangedML, type),
+    FIELD_XR(XrEventDataEyeCalibrationChangedML, next),
+    FIELD_VALUE(XrEventDataEyeCalibrationChangedML, status),
+};
+
+void serialize(const XrEventDataEyeCalibrationChangedML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataEyeCalibrationChangedML, ctx);
+}
+
+void deserialize(XrEventDataEyeCalibrationChangedML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataEyeCalibrationChangedML, ctx);
+}
+
+void cleanup(const XrEventDataEyeCalibrationChangedML* s) {
+    cleanup_fields(s, fields_XrEventDataEyeCalibrationChangedML);
+}
+
+constexpr FieldDescriptor fields_XrEventDataHeadsetFitChangedML[] = {
+    FIELD_VALUE(XrEventDataHeadsetFitChangedML, type),
+    FIELD_XR(XrEventDataHeadsetFitChangedML, next),
+    FIELD_VALUE(XrEventDataHeadsetFitChangedML, status),
+    FIELD_TIME(XrEventDataHeadsetFitChangedML, time),
+};
+
+void serialize(const XrEventDataHeadsetFitChangedML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataHeadsetFitChangedML, ctx);
+}
+
+void deserialize(XrEventDataHeadsetFitChangedML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataHeadsetFitChangedML, ctx);
+}
+
+void cleanup(const XrEventDataHeadsetFitChangedML* s) {
+    cleanup_fields(s, fields_XrEventDataHeadsetFitChangedML);
+}
+
+constexpr FieldDescriptor fields_XrEventDataHeadsetFitChangedML[] = {
+    FIELD_VALUE(XrEventDataHeadsetFitChangedML, type),
+    FIELD_XR(XrEventDataHeadsetFitChangedML, next),
+    FIELD_VALUE(XrEventDataHeadsetFitChangedML, status),
+    FIELD_TIME(XrEventDataHeadsetFitChangedML, time),
+};
+
+void serialize(const XrEventDataHeadsetFitChangedML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataHeadsetFitChangedML, ctx);
+}
+
+void deserialize(XrEventDataHeadsetFitChangedML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataHeadsetFitChangedML, ctx);
+}
+
+void cleanup(const XrEventDataHeadsetFitChangedML* s) {
+    cleanup_fields(s, fields_XrEventDataHeadsetFitChangedML);
+}
+
+constexpr FieldDescriptor fields_XrUserCalibrationEnableEventsInfoML[] = {
+    FIELD_VALUE(XrUserCalibrationEnableEventsInfoML, type),
+    FIELD_XR(XrUserCalibrationEnableEventsInfoML, next),
+    FIELD_VALUE(XrUserCalibrationEnableEventsInfoML, enabled),
+};
+
+void serialize(const XrUserCalibrationEnableEventsInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrUserCalibrationEnableEventsInfoML, ctx);
+}
+
+void deserialize(XrUserCalibrationEnableEventsInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrUserCalibrationEnableEventsInfoML, ctx);
+}
+
+void cleanup(const XrUserCalibrationEnableEventsInfoML* s) {
+    cleanup_fields(s, fields_XrUserCalibrationEnableEventsInfoML);
+}
+
+constexpr FieldDescriptor fields_XrUserCalibrationEnableEventsInfoML[] = {
+    FIELD_VALUE(XrUserCalibrationEnableEventsInfoML, type),
+    FIELD_XR(XrUserCalibrationEnableEventsInfoML, next),
+    FIELD_VALUE(XrUserCalibrationEnableEventsInfoML, enabled),
+};
+
+void serialize(const XrUserCalibrationEnableEventsInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrUserCalibrationEnableEventsInfoML, ctx);
+}
+
+void deserialize(XrUserCalibrationEnableEventsInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrUserCalibrationEnableEventsInfoML, ctx);
+}
+
+void cleanup(const XrUserCalibrationEnableEventsInfoML* s) {
+    cleanup_fields(s, fields_XrUserCalibrationEnableEventsInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_user_calibration
+#ifdef XRTRANSPORT_EXT_XR_ML_world_mesh_detection
+constexpr FieldDescriptor fields_XrWorldMeshBlockML[] = {
+    FIELD_VALUE(XrWorldMeshBlockML, type),
+    FIELD_XR(XrWorldMeshBlockML, next),
+    FIELD_VALUE(XrWorldMeshBlockML, uuid),
+    FIELD_VALUE(XrWorldMeshBlockML, blockResult),
+    FIELD_VALUE(XrWorldMeshBlockML, lod),
+    FIELD_VALUE(XrWorldMeshBlockML, flags),
+    FIELD_VALUE(XrWorldMeshBlockML, indexCount),
+    FIELD_PTR(XrWorldMeshBlockML, indexBuffer, indexCount),
+    FIELD_VALUE(XrWorldMeshBlockML, vertexCount),
+    FIELD_PTR(XrWorldMeshBlockML, vertexBuffer, vertexCount),
+    FIELD_VALUE(XrWorldMeshBlockML, normalCount),
+    FIELD_PTR(XrWorldMeshBlockML, normalBuffer, normalCount),
+    FIELD_VALUE(XrWorldMeshBlockML, confidenceCount),
+    FIELD_PTR(XrWorldMeshBlockML, confidenceBuffer, confidenceCount),
+};
+
+void serialize(const XrWorldMeshBlockML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBlockML, ctx);
+}
+
+void deserialize(XrWorldMeshBlockML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBlockML, ctx);
+}
+
+void cleanup(const XrWorldMeshBlockML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBlockML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBlockML[] = {
+    FIELD_VALUE(XrWorldMeshBlockML, type),
+    FIELD_XR(XrWorldMeshBlockML, next),
+    FIELD_VALUE(XrWorldMeshBlockML, uuid),
+    FIELD_VALUE(XrWorldMeshBlockML, blockResult),
+    FIELD_VALUE(XrWorldMeshBlockML, lod),
+    FIELD_VALUE(XrWorldMeshBlockML, flags),
+    FIELD_VALUE(XrWorldMeshBlockML, indexCount),
+    FIELD_PTR(XrWorldMeshBlockML, indexBuffer, indexCount),
+    FIELD_VALUE(XrWorldMeshBlockML, vertexCount),
+    FIELD_PTR(XrWorldMeshBlockML, vertexBuffer, vertexCount),
+    FIELD_VALUE(XrWorldMeshBlockML, normalCount),
+    FIELD_PTR(XrWorldMeshBlockML, normalBuffer, normalCount),
+    FIELD_VALUE(XrWorldMeshBlockML, confidenceCount),
+    FIELD_PTR(XrWorldMeshBlockML, confidenceBuffer, confidenceCount),
+};
+
+void serialize(const XrWorldMeshBlockML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBlockML, ctx);
+}
+
+void deserialize(XrWorldMeshBlockML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBlockML, ctx);
+}
+
+void cleanup(const XrWorldMeshBlockML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBlockML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBlockRequestML[] = {
+    FIELD_VALUE(XrWorldMeshBlockRequestML, type),
+    FIELD_XR(XrWorldMeshBlockRequestML, next),
+    FIELD_VALUE(XrWorldMeshBlockRequestML, uuid),
+    FIELD_VALUE(XrWorldMeshBlockRequestML, lod),
+};
+
+void serialize(const XrWorldMeshBlockRequestML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBlockRequestML, ctx);
+}
+
+void deserialize(XrWorldMeshBlockRequestML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBlockRequestML, ctx);
+}
+
+void cleanup(const XrWorldMeshBlockRequestML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBlockRequestML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBlockRequestML[] = {
+    FIELD_VALUE(XrWorldMeshBlockRequestML, type),
+    FIELD_XR(XrWorldMeshBlockRequestML, next),
+    FIELD_VALUE(XrWorldMeshBlockRequestML, uuid),
+    FIELD_VALUE(XrWorldMeshBlockRequestML, lod),
+};
+
+void serialize(const XrWorldMeshBlockRequestML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBlockRequestML, ctx);
+}
+
+void deserialize(XrWorldMeshBlockRequestML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBlockRequestML, ctx);
+}
+
+void cleanup(const XrWorldMeshBlockRequestML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBlockRequestML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBlockStateML[] = {
+    FIELD_VALUE(XrWorldMeshBlockStateML, type),
+    FIELD_XR(XrWorldMeshBlockStateML, next),
+    FIELD_VALUE(XrWorldMeshBlockStateML, uuid),
+    FIELD_VALUE(XrWorldMeshBlockStateML, meshBoundingBoxCenter),
+    FIELD_VALUE(XrWorldMeshBlockStateML, meshBoundingBoxExtents),
+    FIELD_TIME(XrWorldMeshBlockStateML, lastUpdateTime),
+    FIELD_VALUE(XrWorldMeshBlockStateML, status),
+};
+
+void serialize(const XrWorldMeshBlockStateML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBlockStateML, ctx);
+}
+
+void deserialize(XrWorldMeshBlockStateML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBlockStateML, ctx);
+}
+
+void cleanup(const XrWorldMeshBlockStateML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBlockStateML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBlockStateML[] = {
+    FIELD_VALUE(XrWorldMeshBlockStateML, type),
+    FIELD_XR(XrWorldMeshBlockStateML, next),
+    FIELD_VALUE(XrWorldMeshBlockStateML, uuid),
+    FIELD_VALUE(XrWorldMeshBlockStateML, meshBoundingBoxCenter),
+    FIELD_VALUE(XrWorldMeshBlockStateML, meshBoundingBoxExtents),
+    FIELD_TIME(XrWorldMeshBlockStateML, lastUpdateTime),
+    FIELD_VALUE(XrWorldMeshBlockStateML, status),
+};
+
+void serialize(const XrWorldMeshBlockStateML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBlockStateML, ctx);
+}
+
+void deserialize(XrWorldMeshBlockStateML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBlockStateML, ctx);
+}
+
+void cleanup(const XrWorldMeshBlockStateML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBlockStateML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBufferML[] = {
+    FIELD_VALUE(XrWorldMeshBufferML, type),
+    FIELD_XR(XrWorldMeshBufferML, next),
+    FIELD_VALUE(XrWorldMeshBufferML, bufferSize),
+    FIELD_PTR(XrWorldMeshBufferML, buffer, bufferSize),
+};
+
+void serialize(const XrWorldMeshBufferML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBufferML, ctx);
+}
+
+void deserialize(XrWorldMeshBufferML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBufferML, ctx);
+}
+
+void cleanup(const XrWorldMeshBufferML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBufferML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBufferML[] = {
+    FIELD_VALUE(XrWorldMeshBufferML, type),
+    FIELD_XR(XrWorldMeshBufferML, next),
+    FIELD_VALUE(XrWorldMeshBufferML, bufferSize),
+    FIELD_PTR(XrWorldMeshBufferML, buffer, bufferSize),
+};
+
+void serialize(const XrWorldMeshBufferML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBufferML, ctx);
+}
+
+void deserialize(XrWorldMeshBufferML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBufferML, ctx);
+}
+
+void cleanup(const XrWorldMeshBufferML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBufferML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBufferRecommendedSizeInfoML[] = {
+    FIELD_VALUE(XrWorldMeshBufferRecommendedSizeInfoML, type),
+    FIELD_XR(XrWorldMeshBufferRecommendedSizeInfoML, next),
+    FIELD_VALUE(XrWorldMeshBufferRecommendedSizeInfoML, maxBlockCount),
+};
+
+void serialize(const XrWorldMeshBufferRecommendedSizeInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBufferRecommendedSizeInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshBufferRecommendedSizeInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBufferRecommendedSizeInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshBufferRecommendedSizeInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBufferRecommendedSizeInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBufferRecommendedSizeInfoML[] = {
+    FIELD_VALUE(XrWorldMeshBufferRecommendedSizeInfoML, type),
+    FIELD_XR(XrWorldMeshBufferRecommendedSizeInfoML, next),
+    FIELD_VALUE(XrWorldMeshBufferRecommendedSizeInfoML, maxBlockCount),
+};
+
+void serialize(const XrWorldMeshBufferRecommendedSizeInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBufferRecommendedSizeInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshBufferRecommendedSizeInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBufferRecommendedSizeInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshBufferRecommendedSizeInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBufferRecommendedSizeInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBufferSizeML[] = {
+    FIELD_VALUE(XrWorldMeshBufferSizeML, type),
+    FIELD_XR(XrWorldMeshBufferSizeML, next),
+    FIELD_VALUE(XrWorldMeshBufferSizeML, size),
+};
+
+void serialize(const XrWorldMeshBufferSizeML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBufferSizeML, ctx);
+}
+
+void deserialize(XrWorldMeshBufferSizeML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBufferSizeML, ctx);
+}
+
+void cleanup(const XrWorldMeshBufferSizeML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBufferSizeML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshBufferSizeML[] = {
+    FIELD_VALUE(XrWorldMeshBufferSizeML, type),
+    FIELD_XR(XrWorldMeshBufferSizeML, next),
+    FIELD_VALUE(XrWorldMeshBufferSizeML, size),
+};
+
+void serialize(const XrWorldMeshBufferSizeML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshBufferSizeML, ctx);
+}
+
+void deserialize(XrWorldMeshBufferSizeML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshBufferSizeML, ctx);
+}
+
+void cleanup(const XrWorldMeshBufferSizeML* s) {
+    cleanup_fields(s, fields_XrWorldMeshBufferSizeML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshDetectorCreateInfoML[] = {
+    FIELD_VALUE(XrWorldMeshDetectorCreateInfoML, type),
+    FIELD_XR(XrWorldMeshDetectorCreateInfoML, next),
+};
+
+void serialize(const XrWorldMeshDetectorCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshDetectorCreateInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshDetectorCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshDetectorCreateInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshDetectorCreateInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshDetectorCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshDetectorCreateInfoML[] = {
+    FIELD_VALUE(XrWorldMeshDetectorCreateInfoML, type),
+    FIELD_XR(XrWorldMeshDetectorCreateInfoML, next),
+};
+
+void serialize(const XrWorldMeshDetectorCreateInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshDetectorCreateInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshDetectorCreateInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshDetectorCreateInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshDetectorCreateInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshDetectorCreateInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshGetInfoML[] = {
+    FIELD_VALUE(XrWorldMeshGetInfoML, type),
+    FIELD_XR(XrWorldMeshGetInfoML, next),
+    FIELD_VALUE(XrWorldMeshGetInfoML, flags),
+    FIELD_VALUE(XrWorldMeshGetInfoML, fillHoleLength),
+    FIELD_VALUE(XrWorldMeshGetInfoML, disconnectedComponentArea),
+    FIELD_VALUE(XrWorldMeshGetInfoML, blockCount),
+    FIELD_PTR(XrWorldMeshGetInfoML, blocks, blockCount),
+};
+
+void serialize(const XrWorldMeshGetInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshGetInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshGetInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshGetInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshGetInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshGetInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshGetInfoML[] = {
+    FIELD_VALUE(XrWorldMeshGetInfoML, type),
+    FIELD_XR(XrWorldMeshGetInfoML, next),
+    FIELD_VALUE(XrWorldMeshGetInfoML, flags),
+    FIELD_VALUE(XrWorldMeshGetInfoML, fillHoleLength),
+    FIELD_VALUE(XrWorldMeshGetInfoML, disconnectedComponentArea),
+    FIELD_VALUE(XrWorldMeshGetInfoML, blockCount),
+    FIELD_PTR(XrWorldMeshGetInfoML, blocks, blockCount),
+};
+
+void serialize(const XrWorldMeshGetInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshGetInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshGetInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshGetInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshGetInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshGetInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshRequestCompletionInfoML[] = {
+    FIELD_VALUE(XrWorldMeshRequestCompletionInfoML, type),
+    FIELD_XR(XrWorldMeshRequestCompletionInfoML, next),
+    FIELD_VALUE(XrWorldMeshRequestCompletionInfoML, meshSpace),
+    FIELD_TIME(XrWorldMeshRequestCompletionInfoML, meshSpaceLocateTime),
+};
+
+void serialize(const XrWorldMeshRequestCompletionInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshRequestCompletionInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshRequestCompletionInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshRequestCompletionInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshRequestCompletionInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshRequestCompletionInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshRequestCompletionInfoML[] = {
+    FIELD_VALUE(XrWorldMeshRequestCompletionInfoML, type),
+    FIELD_XR(XrWorldMeshRequestCompletionInfoML, next),
+    FIELD_VALUE(XrWorldMeshRequestCompletionInfoML, meshSpace),
+    FIELD_TIME(XrWorldMeshRequestCompletionInfoML, meshSpaceLocateTime),
+};
+
+void serialize(const XrWorldMeshRequestCompletionInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshRequestCompletionInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshRequestCompletionInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshRequestCompletionInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshRequestCompletionInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshRequestCompletionInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshRequestCompletionML[] = {
+    FIELD_VALUE(XrWorldMeshRequestCompletionML, type),
+    FIELD_XR(XrWorldMeshRequestCompletionML, next),
+    FIELD_VALUE(XrWorldMeshRequestCompletionML, futureResult),
+    FIELD_VALUE(XrWorldMeshRequestCompletionML, blockCount),
+    FIELD_PTR(XrWorldMeshRequestCompletionML, blocks, blockCount),
+};
+
+void serialize(const XrWorldMeshRequestCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshRequestCompletionML, ctx);
+}
+
+void deserialize(XrWorldMeshRequestCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshRequestCompletionML, ctx);
+}
+
+void cleanup(const XrWorldMeshRequestCompletionML* s) {
+    cleanup_fields(s, fields_XrWorldMeshRequestCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshRequestCompletionML[] = {
+    FIELD_VALUE(XrWorldMeshRequestCompletionML, type),
+    FIELD_XR(XrWorldMeshRequestCompletionML, next),
+    FIELD_VALUE(XrWorldMeshRequestCompletionML, futureResult),
+    FIELD_VALUE(XrWorldMeshRequestCompletionML, blockCount),
+    FIELD_PTR(XrWorldMeshRequestCompletionML, blocks, blockCount),
+};
+
+void serialize(const XrWorldMeshRequestCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshRequestCompletionML, ctx);
+}
+
+void deserialize(XrWorldMeshRequestCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshRequestCompletionML, ctx);
+}
+
+void cleanup(const XrWorldMeshRequestCompletionML* s) {
+    cleanup_fields(s, fields_XrWorldMeshRequestCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshStateRequestCompletionML[] = {
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, type),
+    FIELD_XR(XrWorldMeshStateRequestCompletionML, next),
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, futureResult),
+    FIELD_TIME(XrWorldMeshStateRequestCompletionML, timestamp),
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, meshBlockStateCapacityInput),
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, meshBlockStateCountOutput),
+    FIELD_PTR(XrWorldMeshStateRequestCompletionML, meshBlockStates, meshBlockStateCapacityInput),
+};
+
+void serialize(const XrWorldMeshStateRequestCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshStateRequestCompletionML, ctx);
+}
+
+void deserialize(XrWorldMeshStateRequestCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshStateRequestCompletionML, ctx);
+}
+
+void cleanup(const XrWorldMeshStateRequestCompletionML* s) {
+    cleanup_fields(s, fields_XrWorldMeshStateRequestCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshStateRequestCompletionML[] = {
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, type),
+    FIELD_XR(XrWorldMeshStateRequestCompletionML, next),
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, futureResult),
+    FIELD_TIME(XrWorldMeshStateRequestCompletionML, timestamp),
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, meshBlockStateCapacityInput),
+    FIELD_VALUE(XrWorldMeshStateRequestCompletionML, meshBlockStateCountOutput),
+    FIELD_PTR(XrWorldMeshStateRequestCompletionML, meshBlockStates, meshBlockStateCapacityInput),
+};
+
+void serialize(const XrWorldMeshStateRequestCompletionML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshStateRequestCompletionML, ctx);
+}
+
+void deserialize(XrWorldMeshStateRequestCompletionML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshStateRequestCompletionML, ctx);
+}
+
+void cleanup(const XrWorldMeshStateRequestCompletionML* s) {
+    cleanup_fields(s, fields_XrWorldMeshStateRequestCompletionML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshStateRequestInfoML[] = {
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, type),
+    FIELD_XR(XrWorldMeshStateRequestInfoML, next),
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, baseSpace),
+    FIELD_TIME(XrWorldMeshStateRequestInfoML, time),
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, boundingBoxCenter),
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, boundingBoxExtents),
+};
+
+void serialize(const XrWorldMeshStateRequestInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshStateRequestInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshStateRequestInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshStateRequestInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshStateRequestInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshStateRequestInfoML);
+}
+
+constexpr FieldDescriptor fields_XrWorldMeshStateRequestInfoML[] = {
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, type),
+    FIELD_XR(XrWorldMeshStateRequestInfoML, next),
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, baseSpace),
+    FIELD_TIME(XrWorldMeshStateRequestInfoML, time),
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, boundingBoxCenter),
+    FIELD_VALUE(XrWorldMeshStateRequestInfoML, boundingBoxExtents),
+};
+
+void serialize(const XrWorldMeshStateRequestInfoML* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrWorldMeshStateRequestInfoML, ctx);
+}
+
+void deserialize(XrWorldMeshStateRequestInfoML* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrWorldMeshStateRequestInfoML, ctx);
+}
+
+void cleanup(const XrWorldMeshStateRequestInfoML* s) {
+    cleanup_fields(s, fields_XrWorldMeshStateRequestInfoML);
+}
+
+#endif // XRTRANSPORT_EXT_XR_ML_world_mesh_detection
+#ifdef XRTRANSPORT_EXT_XR_MNDX_egl_enable
+constexpr FieldDescriptor fields_XrGraphicsBindingEGLMNDX[] = {
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, type),
+    FIELD_XR(XrGraphicsBindingEGLMNDX, next),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, getProcAddress),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, display),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, config),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, context),
+};
+
+void serialize(const XrGraphicsBindingEGLMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingEGLMNDX, ctx);
+}
+
+void deserialize(XrGraphicsBindingEGLMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingEGLMNDX, ctx);
+}
+
+void cleanup(const XrGraphicsBindingEGLMNDX* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingEGLMNDX);
+}
+
+constexpr FieldDescriptor fields_XrGraphicsBindingEGLMNDX[] = {
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, type),
+    FIELD_XR(XrGraphicsBindingEGLMNDX, next),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, getProcAddress),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, display),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, config),
+    FIELD_VALUE(XrGraphicsBindingEGLMNDX, context),
+};
+
+void serialize(const XrGraphicsBindingEGLMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrGraphicsBindingEGLMNDX, ctx);
+}
+
+void deserialize(XrGraphicsBindingEGLMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrGraphicsBindingEGLMNDX, ctx);
+}
+
+void cleanup(const XrGraphicsBindingEGLMNDX* s) {
+    cleanup_fields(s, fields_XrGraphicsBindingEGLMNDX);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MNDX_egl_enable
+#ifdef XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl
+constexpr FieldDescriptor fields_XrForceFeedbackCurlApplyLocationMNDX[] = {
+    FIELD_VALUE(XrForceFeedbackCurlApplyLocationMNDX, location),
+    FIELD_VALUE(XrForceFeedbackCurlApplyLocationMNDX, value),
+};
+
+void serialize(const XrForceFeedbackCurlApplyLocationMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrForceFeedbackCurlApplyLocationMNDX, ctx);
+}
+
+void deserialize(XrForceFeedbackCurlApplyLocationMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrForceFeedbackCurlApplyLocationMNDX, ctx);
+}
+
+void cleanup(const XrForceFeedbackCurlApplyLocationMNDX* s) {
+    cleanup_fields(s, fields_XrForceFeedbackCurlApplyLocationMNDX);
+}
+
+constexpr FieldDescriptor fields_XrForceFeedbackCurlApplyLocationsMNDX[] = {
+    FIELD_VALUE(XrForceFeedbackCurlApplyLocationsMNDX, type),
+    FIELD_XR(XrForceFeedbackCurlApplyLocationsMNDX, next),
+    FIELD_VALUE(XrForceFeedbackCurlApplyLocationsMNDX, locationCount),
+    FIELD_PTR(XrForceFeedbackCurlApplyLocationsMNDX, locations, locationCount),
+};
+
+void serialize(const XrForceFeedbackCurlApplyLocationsMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrForceFeedbackCurlApplyLocationsMNDX, ctx);
+}
+
+void deserialize(XrForceFeedbackCurlApplyLocationsMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrForceFeedbackCurlApplyLocationsMNDX, ctx);
+}
+
+void cleanup(const XrForceFeedbackCurlApplyLocationsMNDX* s) {
+    cleanup_fields(s, fields_XrForceFeedbackCurlApplyLocationsMNDX);
+}
+
+constexpr FieldDescriptor fields_XrForceFeedbackCurlApplyLocationsMNDX[] = {
+    FIELD_VALUE(XrForceFeedbackCurlApplyLocationsMNDX, type),
+    FIELD_XR(XrForceFeedbackCurlApplyLocationsMNDX, next),
+    FIELD_VALUE(XrForceFeedbackCurlApplyLocationsMNDX, locationCount),
+    FIELD_PTR(XrForceFeedbackCurlApplyLocationsMNDX, locations, locationCount),
+};
+
+void serialize(const XrForceFeedbackCurlApplyLocationsMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrForceFeedbackCurlApplyLocationsMNDX, ctx);
+}
+
+void deserialize(XrForceFeedbackCurlApplyLocationsMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrForceFeedbackCurlApplyLocationsMNDX, ctx);
+}
+
+void cleanup(const XrForceFeedbackCurlApplyLocationsMNDX* s) {
+    cleanup_fields(s, fields_XrForceFeedbackCurlApplyLocationsMNDX);
+}
+
+constexpr FieldDescriptor fields_XrSystemForceFeedbackCurlPropertiesMNDX[] = {
+    FIELD_VALUE(XrSystemForceFeedbackCurlPropertiesMNDX, type),
+    FIELD_XR(XrSystemForceFeedbackCurlPropertiesMNDX, next),
+    FIELD_VALUE(XrSystemForceFeedbackCurlPropertiesMNDX, supportsForceFeedbackCurl),
+};
+
+void serialize(const XrSystemForceFeedbackCurlPropertiesMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemForceFeedbackCurlPropertiesMNDX, ctx);
+}
+
+void deserialize(XrSystemForceFeedbackCurlPropertiesMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemForceFeedbackCurlPropertiesMNDX, ctx);
+}
+
+void cleanup(const XrSystemForceFeedbackCurlPropertiesMNDX* s) {
+    cleanup_fields(s, fields_XrSystemForceFeedbackCurlPropertiesMNDX);
+}
+
+constexpr FieldDescriptor fields_XrSystemForceFeedbackCurlPropertiesMNDX[] = {
+    FIELD_VALUE(XrSystemForceFeedbackCurlPropertiesMNDX, type),
+    FIELD_XR(XrSystemForceFeedbackCurlPropertiesMNDX, next),
+    FIELD_VALUE(XrSystemForceFeedbackCurlPropertiesMNDX, supportsForceFeedbackCurl),
+};
+
+void serialize(const XrSystemForceFeedbackCurlPropertiesMNDX* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemForceFeedbackCurlPropertiesMNDX, ctx);
+}
+
+void deserialize(XrSystemForceFeedbackCurlPropertiesMNDX* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemForceFeedbackCurlPropertiesMNDX, ctx);
+}
+
+void cleanup(const XrSystemForceFeedbackCurlPropertiesMNDX* s) {
+    cleanup_fields(s, fields_XrSystemForceFeedbackCurlPropertiesMNDX);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MNDX_force_feedback_curl
+#ifdef XRTRANSPORT_EXT_XR_MSFT_composition_layer_reprojection
+constexpr FieldDescriptor fields_XrCompositionLayerReprojectionInfoMSFT[] = {
+    FIELD_VALUE(XrCompositionLayerReprojectionInfoMSFT, type),
+    FIELD_XR(XrCompositionLayerReprojectionInfoMSFT, next),
+    FIELD_VALUE(XrCompositionLayerReprojectionInfoMSFT, reprojectionMode),
+};
+
+void serialize(const XrCompositionLayerReprojectionInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerReprojectionInfoMSFT, ctx);
+}
+
+void deserialize(XrCompositionLayerReprojectionInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerReprojectionInfoMSFT, ctx);
+}
+
+void cleanup(const XrCompositionLayerReprojectionInfoMSFT* s) {
+    cleanup_fields(s, fields_XrCompositionLayerReprojectionInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerReprojectionInfoMSFT[] = {
+    FIELD_VALUE(XrCompositionLayerReprojectionInfoMSFT, type),
+    FIELD_XR(XrCompositionLayerReprojectionInfoMSFT, next),
+    FIELD_VALUE(XrCompositionLayerReprojectionInfoMSFT, reprojectionMode),
+};
+
+void serialize(const XrCompositionLayerReprojectionInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerReprojectionInfoMSFT, ctx);
+}
+
+void deserialize(XrCompositionLayerReprojectionInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerReprojectionInfoMSFT, ctx);
+}
+
+void cleanup(const XrCompositionLayerReprojectionInfoMSFT* s) {
+    cleanup_fields(s, fields_XrCompositionLayerReprojectionInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerReprojectionPlaneOverrideMSFT[] = {
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, type),
+    FIELD_XR(XrCompositionLayerReprojectionPlaneOverrideMSFT, next),
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, position),
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, normal),
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, velocity),
+};
+
+void serialize(const XrCompositionLayerReprojectionPlaneOverrideMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerReprojectionPlaneOverrideMSFT, ctx);
+}
+
+void deserialize(XrCompositionLayerReprojectionPlaneOverrideMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerReprojectionPlaneOverrideMSFT, ctx);
+}
+
+void cleanup(const XrCompositionLayerReprojectionPlaneOverrideMSFT* s) {
+    cleanup_fields(s, fields_XrCompositionLayerReprojectionPlaneOverrideMSFT);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerReprojectionPlaneOverrideMSFT[] = {
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, type),
+    FIELD_XR(XrCompositionLayerReprojectionPlaneOverrideMSFT, next),
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, position),
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, normal),
+    FIELD_VALUE(XrCompositionLayerReprojectionPlaneOverrideMSFT, velocity),
+};
+
+void serialize(const XrCompositionLayerReprojectionPlaneOverrideMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerReprojectionPlaneOverrideMSFT, ctx);
+}
+
+void deserialize(XrCompositionLayerReprojectionPlaneOverrideMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerReprojectionPlaneOverrideMSFT, ctx);
+}
+
+void cleanup(const XrCompositionLayerReprojectionPlaneOverrideMSFT* s) {
+    cleanup_fields(s, fields_XrCompositionLayerReprojectionPlaneOverrideMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_composition_layer_reprojection
+#ifdef XRTRANSPORT_EXT_XR_MSFT_controller_model
+constexpr FieldDescriptor fields_XrControllerModelKeyStateMSFT[] = {
+    FIELD_VALUE(XrControllerModelKeyStateMSFT, type),
+    FIELD_XR(XrControllerModelKeyStateMSFT, next),
+    FIELD_VALUE(XrControllerModelKeyStateMSFT, modelKey),
+};
+
+void serialize(const XrControllerModelKeyStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelKeyStateMSFT, ctx);
+}
+
+void deserialize(XrControllerModelKeyStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelKeyStateMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelKeyStateMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelKeyStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelKeyStateMSFT[] = {
+    FIELD_VALUE(XrControllerModelKeyStateMSFT, type),
+    FIELD_XR(XrControllerModelKeyStateMSFT, next),
+    FIELD_VALUE(XrControllerModelKeyStateMSFT, modelKey),
+};
+
+void serialize(const XrControllerModelKeyStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelKeyStateMSFT, ctx);
+}
+
+void deserialize(XrControllerModelKeyStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelKeyStateMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelKeyStateMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelKeyStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelNodePropertiesMSFT[] = {
+    FIELD_VALUE(XrControllerModelNodePropertiesMSFT, type),
+    FIELD_XR(XrControllerModelNodePropertiesMSFT, next),
+    FIELD_STRING_ARRAY(XrControllerModelNodePropertiesMSFT, parentNodeName),
+    FIELD_STRING_ARRAY(XrControllerModelNodePropertiesMSFT, nodeName),
+};
+
+void serialize(const XrControllerModelNodePropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelNodePropertiesMSFT, ctx);
+}
+
+void deserialize(XrControllerModelNodePropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelNodePropertiesMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelNodePropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelNodePropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelNodePropertiesMSFT[] = {
+    FIELD_VALUE(XrControllerModelNodePropertiesMSFT, type),
+    FIELD_XR(XrControllerModelNodePropertiesMSFT, next),
+    FIELD_STRING_ARRAY(XrControllerModelNodePropertiesMSFT, parentNodeName),
+    FIELD_STRING_ARRAY(XrControllerModelNodePropertiesMSFT, nodeName),
+};
+
+void serialize(const XrControllerModelNodePropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelNodePropertiesMSFT, ctx);
+}
+
+void deserialize(XrControllerModelNodePropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelNodePropertiesMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelNodePropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelNodePropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelNodeStateMSFT[] = {
+    FIELD_VALUE(XrControllerModelNodeStateMSFT, type),
+    FIELD_XR(XrControllerModelNodeStateMSFT, next),
+    FIELD_VALUE(XrControllerModelNodeStateMSFT, nodePose),
+};
+
+void serialize(const XrControllerModelNodeStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelNodeStateMSFT, ctx);
+}
+
+void deserialize(XrControllerModelNodeStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelNodeStateMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelNodeStateMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelNodeStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelNodeStateMSFT[] = {
+    FIELD_VALUE(XrControllerModelNodeStateMSFT, type),
+    FIELD_XR(XrControllerModelNodeStateMSFT, next),
+    FIELD_VALUE(XrControllerModelNodeStateMSFT, nodePose),
+};
+
+void serialize(const XrControllerModelNodeStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelNodeStateMSFT, ctx);
+}
+
+void deserialize(XrControllerModelNodeStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelNodeStateMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelNodeStateMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelNodeStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelPropertiesMSFT[] = {
+    FIELD_VALUE(XrControllerModelPropertiesMSFT, type),
+    FIELD_XR(XrControllerModelPropertiesMSFT, next),
+    FIELD_VALUE(XrControllerModelPropertiesMSFT, nodeCapacityInput),
+    FIELD_VALUE(XrControllerModelPropertiesMSFT, nodeCountOutput),
+    FIELD_PTR(XrControllerModelPropertiesMSFT, nodeProperties, nodeCapacityInput),
+};
+
+void serialize(const XrControllerModelPropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelPropertiesMSFT, ctx);
+}
+
+void deserialize(XrControllerModelPropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelPropertiesMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelPropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelPropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelPropertiesMSFT[] = {
+    FIELD_VALUE(XrControllerModelPropertiesMSFT, type),
+    FIELD_XR(XrControllerModelPropertiesMSFT, next),
+    FIELD_VALUE(XrControllerModelPropertiesMSFT, nodeCapacityInput),
+    FIELD_VALUE(XrControllerModelPropertiesMSFT, nodeCountOutput),
+    FIELD_PTR(XrControllerModelPropertiesMSFT, nodeProperties, nodeCapacityInput),
+};
+
+void serialize(const XrControllerModelPropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelPropertiesMSFT, ctx);
+}
+
+void deserialize(XrControllerModelPropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelPropertiesMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelPropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelPropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelStateMSFT[] = {
+    FIELD_VALUE(XrControllerModelStateMSFT, type),
+    FIELD_XR(XrControllerModelStateMSFT, next),
+    FIELD_VALUE(XrControllerModelStateMSFT, nodeCapacityInput),
+    FIELD_VALUE(XrControllerModelStateMSFT, nodeCountOutput),
+    FIELD_PTR(XrControllerModelStateMSFT, nodeStates, nodeCapacityInput),
+};
+
+void serialize(const XrControllerModelStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelStateMSFT, ctx);
+}
+
+void deserialize(XrControllerModelStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelStateMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelStateMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrControllerModelStateMSFT[] = {
+    FIELD_VALUE(XrControllerModelStateMSFT, type),
+    FIELD_XR(XrControllerModelStateMSFT, next),
+    FIELD_VALUE(XrControllerModelStateMSFT, nodeCapacityInput),
+    FIELD_VALUE(XrControllerModelStateMSFT, nodeCountOutput),
+    FIELD_PTR(XrControllerModelStateMSFT, nodeStates, nodeCapacityInput),
+};
+
+void serialize(const XrControllerModelStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrControllerModelStateMSFT, ctx);
+}
+
+void deserialize(XrControllerModelStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrControllerModelStateMSFT, ctx);
+}
+
+void cleanup(const XrControllerModelStateMSFT* s) {
+    cleanup_fields(s, fields_XrControllerModelStateMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_controller_model
+#ifdef XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+constexpr FieldDescriptor fields_XrHandMeshIndexBufferMSFT[] = {
+    FIELD_VALUE(XrHandMeshIndexBufferMSFT, indexBufferKey),
+    FIELD_VALUE(XrHandMeshIndexBufferMSFT, indexCapacityInput),
+    FIELD_VALUE(XrHandMeshIndexBufferMSFT, indexCountOutput),
+    FIELD_PTR(XrHandMeshIndexBufferMSFT, indices, indexCapacityInput),
+};
+
+void serialize(const XrHandMeshIndexBufferMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshIndexBufferMSFT, ctx);
+}
+
+void deserialize(XrHandMeshIndexBufferMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshIndexBufferMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshIndexBufferMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshIndexBufferMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshMSFT[] = {
+    FIELD_VALUE(XrHandMeshMSFT, type),
+    FIELD_XR(XrHandMeshMSFT, next),
+    FIELD_VALUE(XrHandMeshMSFT, isActive),
+    FIELD_VALUE(XrHandMeshMSFT, indexBufferChanged),
+    FIELD_VALUE(XrHandMeshMSFT, vertexBufferChanged),
+    FIELD_VALUE(XrHandMeshMSFT, indexBuffer),
+    FIELD_VALUE(XrHandMeshMSFT, vertexBuffer),
+};
+
+void serialize(const XrHandMeshMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshMSFT, ctx);
+}
+
+void deserialize(XrHandMeshMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshMSFT[] = {
+    FIELD_VALUE(XrHandMeshMSFT, type),
+    FIELD_XR(XrHandMeshMSFT, next),
+    FIELD_VALUE(XrHandMeshMSFT, isActive),
+    FIELD_VALUE(XrHandMeshMSFT, indexBufferChanged),
+    FIELD_VALUE(XrHandMeshMSFT, vertexBufferChanged),
+    FIELD_VALUE(XrHandMeshMSFT, indexBuffer),
+    FIELD_VALUE(XrHandMeshMSFT, vertexBuffer),
+};
+
+void serialize(const XrHandMeshMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshMSFT, ctx);
+}
+
+void deserialize(XrHandMeshMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshSpaceCreateInfoMSFT[] = {
+    FIELD_VALUE(XrHandMeshSpaceCreateInfoMSFT, type),
+    FIELD_XR(XrHandMeshSpaceCreateInfoMSFT, next),
+    FIELD_VALUE(XrHandMeshSpaceCreateInfoMSFT, handPoseType),
+    FIELD_VALUE(XrHandMeshSpaceCreateInfoMSFT, poseInHandMeshSpace),
+};
+
+void serialize(const XrHandMeshSpaceCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshSpaceCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrHandMeshSpaceCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshSpaceCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshSpaceCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshSpaceCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshSpaceCreateInfoMSFT[] = {
+    FIELD_VALUE(XrHandMeshSpaceCreateInfoMSFT, type),
+    FIELD_XR(XrHandMeshSpaceCreateInfoMSFT, next),
+    FIELD_VALUE(XrHandMeshSpaceCreateInfoMSFT, handPoseType),
+    FIELD_VALUE(XrHandMeshSpaceCreateInfoMSFT, poseInHandMeshSpace),
+};
+
+void serialize(const XrHandMeshSpaceCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshSpaceCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrHandMeshSpaceCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshSpaceCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshSpaceCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshSpaceCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshUpdateInfoMSFT[] = {
+    FIELD_VALUE(XrHandMeshUpdateInfoMSFT, type),
+    FIELD_XR(XrHandMeshUpdateInfoMSFT, next),
+    FIELD_TIME(XrHandMeshUpdateInfoMSFT, time),
+    FIELD_VALUE(XrHandMeshUpdateInfoMSFT, handPoseType),
+};
+
+void serialize(const XrHandMeshUpdateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshUpdateInfoMSFT, ctx);
+}
+
+void deserialize(XrHandMeshUpdateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshUpdateInfoMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshUpdateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshUpdateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshUpdateInfoMSFT[] = {
+    FIELD_VALUE(XrHandMeshUpdateInfoMSFT, type),
+    FIELD_XR(XrHandMeshUpdateInfoMSFT, next),
+    FIELD_TIME(XrHandMeshUpdateInfoMSFT, time),
+    FIELD_VALUE(XrHandMeshUpdateInfoMSFT, handPoseType),
+};
+
+void serialize(const XrHandMeshUpdateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshUpdateInfoMSFT, ctx);
+}
+
+void deserialize(XrHandMeshUpdateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshUpdateInfoMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshUpdateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshUpdateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshVertexBufferMSFT[] = {
+    FIELD_TIME(XrHandMeshVertexBufferMSFT, vertexUpdateTime),
+    FIELD_VALUE(XrHandMeshVertexBufferMSFT, vertexCapacityInput),
+    FIELD_VALUE(XrHandMeshVertexBufferMSFT, vertexCountOutput),
+    FIELD_QUANTIZABLE_PTR(XrHandMeshVertexBufferMSFT, vertices, vertexCapacityInput, QUANTIZED_XR_MSFT_hand_tracking_mesh),
+};
+
+void serialize(const XrHandMeshVertexBufferMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshVertexBufferMSFT, ctx);
+}
+
+void deserialize(XrHandMeshVertexBufferMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshVertexBufferMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshVertexBufferMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshVertexBufferMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandMeshVertexMSFT[] = {
+    FIELD_VALUE(XrHandMeshVertexMSFT, position),
+    FIELD_VALUE(XrHandMeshVertexMSFT, normal),
+};
+
+void serialize(const XrHandMeshVertexMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandMeshVertexMSFT, ctx);
+}
+
+void deserialize(XrHandMeshVertexMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandMeshVertexMSFT, ctx);
+}
+
+void cleanup(const XrHandMeshVertexMSFT* s) {
+    cleanup_fields(s, fields_XrHandMeshVertexMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandPoseTypeInfoMSFT[] = {
+    FIELD_VALUE(XrHandPoseTypeInfoMSFT, type),
+    FIELD_XR(XrHandPoseTypeInfoMSFT, next),
+    FIELD_VALUE(XrHandPoseTypeInfoMSFT, handPoseType),
+};
+
+void serialize(const XrHandPoseTypeInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandPoseTypeInfoMSFT, ctx);
+}
+
+void deserialize(XrHandPoseTypeInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandPoseTypeInfoMSFT, ctx);
+}
+
+void cleanup(const XrHandPoseTypeInfoMSFT* s) {
+    cleanup_fields(s, fields_XrHandPoseTypeInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHandPoseTypeInfoMSFT[] = {
+    FIELD_VALUE(XrHandPoseTypeInfoMSFT, type),
+    FIELD_XR(XrHandPoseTypeInfoMSFT, next),
+    FIELD_VALUE(XrHandPoseTypeInfoMSFT, handPoseType),
+};
+
+void serialize(const XrHandPoseTypeInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHandPoseTypeInfoMSFT, ctx);
+}
+
+void deserialize(XrHandPoseTypeInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHandPoseTypeInfoMSFT, ctx);
+}
+
+void cleanup(const XrHandPoseTypeInfoMSFT* s) {
+    cleanup_fields(s, fields_XrHandPoseTypeInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSystemHandTrackingMeshPropertiesMSFT[] = {
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, type),
+    FIELD_XR(XrSystemHandTrackingMeshPropertiesMSFT, next),
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, supportsHandTrackingMesh),
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, maxHandMeshIndexCount),
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, maxHandMeshVertexCount),
+};
+
+void serialize(const XrSystemHandTrackingMeshPropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemHandTrackingMeshPropertiesMSFT, ctx);
+}
+
+void deserialize(XrSystemHandTrackingMeshPropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemHandTrackingMeshPropertiesMSFT, ctx);
+}
+
+void cleanup(const XrSystemHandTrackingMeshPropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrSystemHandTrackingMeshPropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSystemHandTrackingMeshPropertiesMSFT[] = {
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, type),
+    FIELD_XR(XrSystemHandTrackingMeshPropertiesMSFT, next),
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, supportsHandTrackingMesh),
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, maxHandMeshIndexCount),
+    FIELD_VALUE(XrSystemHandTrackingMeshPropertiesMSFT, maxHandMeshVertexCount),
+};
+
+void serialize(const XrSystemHandTrackingMeshPropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemHandTrackingMeshPropertiesMSFT, ctx);
+}
+
+void deserialize(XrSystemHandTrackingMeshPropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemHandTrackingMeshPropertiesMSFT, ctx);
+}
+
+void cleanup(const XrSystemHandTrackingMeshPropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrSystemHandTrackingMeshPropertiesMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_hand_tracking_mesh
+#ifdef XRTRANSPORT_EXT_XR_MSFT_holographic_window_attachment
+constexpr FieldDescriptor fields_XrHolographicWindowAttachmentMSFT[] = {
+    FIELD_VALUE(XrHolographicWindowAttachmentMSFT, type),
+    FIELD_XR(XrHolographicWindowAttachmentMSFT, next),
+    FIELD_SINGLE_PTR(XrHolographicWindowAttachmentMSFT, holographicSpace),
+    FIELD_SINGLE_PTR(XrHolographicWindowAttachmentMSFT, coreWindow),
+};
+
+void serialize(const XrHolographicWindowAttachmentMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHolographicWindowAttachmentMSFT, ctx);
+}
+
+void deserialize(XrHolographicWindowAttachmentMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHolographicWindowAttachmentMSFT, ctx);
+}
+
+void cleanup(const XrHolographicWindowAttachmentMSFT* s) {
+    cleanup_fields(s, fields_XrHolographicWindowAttachmentMSFT);
+}
+
+constexpr FieldDescriptor fields_XrHolographicWindowAttachmentMSFT[] = {
+    FIELD_VALUE(XrHolographicWindowAttachmentMSFT, type),
+    FIELD_XR(XrHolographicWindowAttachmentMSFT, next),
+    FIELD_SINGLE_PTR(XrHolographicWindowAttachmentMSFT, holographicSpace),
+    FIELD_SINGLE_PTR(XrHolographicWindowAttachmentMSFT, coreWindow),
+};
+
+void serialize(const XrHolographicWindowAttachmentMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHolographicWindowAttachmentMSFT, ctx);
+}
+
+void deserialize(XrHolographicWindowAttachmentMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHolographicWindowAttachmentMSFT, ctx);
+}
+
+void cleanup(const XrHolographicWindowAttachmentMSFT* s) {
+    cleanup_fields(s, fields_XrHolographicWindowAttachmentMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_holographic_window_attachment
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_marker
+constexpr FieldDescriptor fields_XrSceneMarkerMSFT[] = {
+    FIELD_VALUE(XrSceneMarkerMSFT, markerType),
+    FIELD_TIME(XrSceneMarkerMSFT, lastSeenTime),
+    FIELD_VALUE(XrSceneMarkerMSFT, center),
+    FIELD_VALUE(XrSceneMarkerMSFT, size),
+};
+
+void serialize(const XrSceneMarkerMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkerMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkerMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkerMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkerMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkerMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkerQRCodeMSFT[] = {
+    FIELD_VALUE(XrSceneMarkerQRCodeMSFT, symbolType),
+    FIELD_VALUE(XrSceneMarkerQRCodeMSFT, version),
+};
+
+void serialize(const XrSceneMarkerQRCodeMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkerQRCodeMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkerQRCodeMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkerQRCodeMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkerQRCodeMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkerQRCodeMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkerQRCodesMSFT[] = {
+    FIELD_VALUE(XrSceneMarkerQRCodesMSFT, type),
+    FIELD_XR(XrSceneMarkerQRCodesMSFT, next),
+    FIELD_VALUE(XrSceneMarkerQRCodesMSFT, qrCodeCapacityInput),
+    FIELD_PTR(XrSceneMarkerQRCodesMSFT, qrCodes, qrCodeCapacityInput),
+};
+
+void serialize(const XrSceneMarkerQRCodesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkerQRCodesMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkerQRCodesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkerQRCodesMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkerQRCodesMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkerQRCodesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkerQRCodesMSFT[] = {
+    FIELD_VALUE(XrSceneMarkerQRCodesMSFT, type),
+    FIELD_XR(XrSceneMarkerQRCodesMSFT, next),
+    FIELD_VALUE(XrSceneMarkerQRCodesMSFT, qrCodeCapacityInput),
+    FIELD_PTR(XrSceneMarkerQRCodesMSFT, qrCodes, qrCodeCapacityInput),
+};
+
+void serialize(const XrSceneMarkerQRCodesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkerQRCodesMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkerQRCodesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkerQRCodesMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkerQRCodesMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkerQRCodesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkerTypeFilterMSFT[] = {
+    FIELD_VALUE(XrSceneMarkerTypeFilterMSFT, type),
+    FIELD_XR(XrSceneMarkerTypeFilterMSFT, next),
+    FIELD_VALUE(XrSceneMarkerTypeFilterMSFT, markerTypeCount),
+    FIELD_PTR(XrSceneMarkerTypeFilterMSFT, markerTypes, markerTypeCount),
+};
+
+void serialize(const XrSceneMarkerTypeFilterMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkerTypeFilterMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkerTypeFilterMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkerTypeFilterMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkerTypeFilterMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkerTypeFilterMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkerTypeFilterMSFT[] = {
+    FIELD_VALUE(XrSceneMarkerTypeFilterMSFT, type),
+    FIELD_XR(XrSceneMarkerTypeFilterMSFT, next),
+    FIELD_VALUE(XrSceneMarkerTypeFilterMSFT, markerTypeCount),
+    FIELD_PTR(XrSceneMarkerTypeFilterMSFT, markerTypes, markerTypeCount),
+};
+
+void serialize(const XrSceneMarkerTypeFilterMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkerTypeFilterMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkerTypeFilterMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkerTypeFilterMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkerTypeFilterMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkerTypeFilterMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkersMSFT[] = {
+    FIELD_VALUE(XrSceneMarkersMSFT, type),
+    FIELD_XR(XrSceneMarkersMSFT, next),
+    FIELD_VALUE(XrSceneMarkersMSFT, sceneMarkerCapacityInput),
+    FIELD_PTR(XrSceneMarkersMSFT, sceneMarkers, sceneMarkerCapacityInput),
+};
+
+void serialize(const XrSceneMarkersMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkersMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkersMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkersMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkersMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkersMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMarkersMSFT[] = {
+    FIELD_VALUE(XrSceneMarkersMSFT, type),
+    FIELD_XR(XrSceneMarkersMSFT, next),
+    FIELD_VALUE(XrSceneMarkersMSFT, sceneMarkerCapacityInput),
+    FIELD_PTR(XrSceneMarkersMSFT, sceneMarkers, sceneMarkerCapacityInput),
+};
+
+void serialize(const XrSceneMarkersMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMarkersMSFT, ctx);
+}
+
+void deserialize(XrSceneMarkersMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMarkersMSFT, ctx);
+}
+
+void cleanup(const XrSceneMarkersMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMarkersMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_marker
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+constexpr FieldDescriptor fields_XrNewSceneComputeInfoMSFT[] = {
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, type),
+    FIELD_XR(XrNewSceneComputeInfoMSFT, next),
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, requestedFeatureCount),
+    FIELD_PTR(XrNewSceneComputeInfoMSFT, requestedFeatures, requestedFeatureCount),
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, consistency),
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, bounds),
+};
+
+void serialize(const XrNewSceneComputeInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrNewSceneComputeInfoMSFT, ctx);
+}
+
+void deserialize(XrNewSceneComputeInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrNewSceneComputeInfoMSFT, ctx);
+}
+
+void cleanup(const XrNewSceneComputeInfoMSFT* s) {
+    cleanup_fields(s, fields_XrNewSceneComputeInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrNewSceneComputeInfoMSFT[] = {
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, type),
+    FIELD_XR(XrNewSceneComputeInfoMSFT, next),
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, requestedFeatureCount),
+    FIELD_PTR(XrNewSceneComputeInfoMSFT, requestedFeatures, requestedFeatureCount),
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, consistency),
+    FIELD_VALUE(XrNewSceneComputeInfoMSFT, bounds),
+};
+
+void serialize(const XrNewSceneComputeInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrNewSceneComputeInfoMSFT, ctx);
+}
+
+void deserialize(XrNewSceneComputeInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrNewSceneComputeInfoMSFT, ctx);
+}
+
+void cleanup(const XrNewSceneComputeInfoMSFT* s) {
+    cleanup_fields(s, fields_XrNewSceneComputeInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneBoundsMSFT[] = {
+    FIELD_VALUE(XrSceneBoundsMSFT, space),
+    FIELD_TIME(XrSceneBoundsMSFT, time),
+    FIELD_VALUE(XrSceneBoundsMSFT, sphereCount),
+    FIELD_QUANTIZABLE_PTR(XrSceneBoundsMSFT, spheres, sphereCount, QUANTIZED_XR_MSFT_scene_understanding),
+    FIELD_VALUE(XrSceneBoundsMSFT, boxCount),
+    FIELD_QUANTIZABLE_PTR(XrSceneBoundsMSFT, boxes, boxCount, QUANTIZED_XR_MSFT_scene_understanding),
+    FIELD_VALUE(XrSceneBoundsMSFT, frustumCount),
+    FIELD_PTR(XrSceneBoundsMSFT, frustums, frustumCount),
+};
+
+void serialize(const XrSceneBoundsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneBoundsMSFT, ctx);
+}
+
+void deserialize(XrSceneBoundsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneBoundsMSFT, ctx);
+}
+
+void cleanup(const XrSceneBoundsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneBoundsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentLocationMSFT[] = {
+    FIELD_VALUE(XrSceneComponentLocationMSFT, flags),
+    FIELD_VALUE(XrSceneComponentLocationMSFT, pose),
+};
+
+void serialize(const XrSceneComponentLocationMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentLocationMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentLocationMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentLocationMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentLocationMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentLocationMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentLocationsMSFT[] = {
+    FIELD_VALUE(XrSceneComponentLocationsMSFT, type),
+    FIELD_XR(XrSceneComponentLocationsMSFT, next),
+    FIELD_VALUE(XrSceneComponentLocationsMSFT, locationCount),
+    FIELD_QUANTIZABLE_PTR(XrSceneComponentLocationsMSFT, locations, locationCount, QUANTIZED_XR_MSFT_scene_understanding),
+};
+
+void serialize(const XrSceneComponentLocationsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentLocationsMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentLocationsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentLocationsMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentLocationsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentLocationsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentLocationsMSFT[] = {
+    FIELD_VALUE(XrSceneComponentLocationsMSFT, type),
+    FIELD_XR(XrSceneComponentLocationsMSFT, next),
+    FIELD_VALUE(XrSceneComponentLocationsMSFT, locationCount),
+    FIELD_QUANTIZABLE_PTR(XrSceneComponentLocationsMSFT, locations, locationCount, QUANTIZED_XR_MSFT_scene_understanding),
+};
+
+void serialize(const XrSceneComponentLocationsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentLocationsMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentLocationsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentLocationsMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentLocationsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentLocationsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentMSFT[] = {
+    FIELD_VALUE(XrSceneComponentMSFT, componentType),
+    FIELD_VALUE(XrSceneComponentMSFT, id),
+    FIELD_VALUE(XrSceneComponentMSFT, parentId),
+    FIELD_TIME(XrSceneComponentMSFT, updateTime),
+};
+
+void serialize(const XrSceneComponentMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentParentFilterInfoMSFT[] = {
+    FIELD_VALUE(XrSceneComponentParentFilterInfoMSFT, type),
+    FIELD_XR(XrSceneComponentParentFilterInfoMSFT, next),
+    FIELD_VALUE(XrSceneComponentParentFilterInfoMSFT, parentId),
+};
+
+void serialize(const XrSceneComponentParentFilterInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentParentFilterInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentParentFilterInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentParentFilterInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentParentFilterInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentParentFilterInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentParentFilterInfoMSFT[] = {
+    FIELD_VALUE(XrSceneComponentParentFilterInfoMSFT, type),
+    FIELD_XR(XrSceneComponentParentFilterInfoMSFT, next),
+    FIELD_VALUE(XrSceneComponentParentFilterInfoMSFT, parentId),
+};
+
+void serialize(const XrSceneComponentParentFilterInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentParentFilterInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentParentFilterInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentParentFilterInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentParentFilterInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentParentFilterInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentsGetInfoMSFT[] = {
+    FIELD_VALUE(XrSceneComponentsGetInfoMSFT, type),
+    FIELD_XR(XrSceneComponentsGetInfoMSFT, next),
+    FIELD_VALUE(XrSceneComponentsGetInfoMSFT, componentType),
+};
+
+void serialize(const XrSceneComponentsGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentsGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentsGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentsGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentsGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentsGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentsGetInfoMSFT[] = {
+    FIELD_VALUE(XrSceneComponentsGetInfoMSFT, type),
+    FIELD_XR(XrSceneComponentsGetInfoMSFT, next),
+    FIELD_VALUE(XrSceneComponentsGetInfoMSFT, componentType),
+};
+
+void serialize(const XrSceneComponentsGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentsGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentsGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentsGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentsGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentsGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentsLocateInfoMSFT[] = {
+    FIELD_VALUE(XrSceneComponentsLocateInfoMSFT, type),
+    FIELD_XR(XrSceneComponentsLocateInfoMSFT, next),
+    FIELD_VALUE(XrSceneComponentsLocateInfoMSFT, baseSpace),
+    FIELD_TIME(XrSceneComponentsLocateInfoMSFT, time),
+    FIELD_VALUE(XrSceneComponentsLocateInfoMSFT, componentIdCount),
+    FIELD_PTR(XrSceneComponentsLocateInfoMSFT, componentIds, componentIdCount),
+};
+
+void serialize(const XrSceneComponentsLocateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentsLocateInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentsLocateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentsLocateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentsLocateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentsLocateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentsLocateInfoMSFT[] = {
+    FIELD_VALUE(XrSceneComponentsLocateInfoMSFT, type),
+    FIELD_XR(XrSceneComponentsLocateInfoMSFT, next),
+    FIELD_VALUE(XrSceneComponentsLocateInfoMSFT, baseSpace),
+    FIELD_TIME(XrSceneComponentsLocateInfoMSFT, time),
+    FIELD_VALUE(XrSceneComponentsLocateInfoMSFT, componentIdCount),
+    FIELD_PTR(XrSceneComponentsLocateInfoMSFT, componentIds, componentIdCount),
+};
+
+void serialize(const XrSceneComponentsLocateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentsLocateInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentsLocateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentsLocateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentsLocateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentsLocateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentsMSFT[] = {
+    FIELD_VALUE(XrSceneComponentsMSFT, type),
+    FIELD_XR(XrSceneComponentsMSFT, next),
+    FIELD_VALUE(XrSceneComponentsMSFT, componentCapacityInput),
+    FIELD_VALUE(XrSceneComponentsMSFT, componentCountOutput),
+    FIELD_PTR(XrSceneComponentsMSFT, components, componentCapacityInput),
+};
+
+void serialize(const XrSceneComponentsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentsMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentsMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneComponentsMSFT[] = {
+    FIELD_VALUE(XrSceneComponentsMSFT, type),
+    FIELD_XR(XrSceneComponentsMSFT, next),
+    FIELD_VALUE(XrSceneComponentsMSFT, componentCapacityInput),
+    FIELD_VALUE(XrSceneComponentsMSFT, componentCountOutput),
+    FIELD_PTR(XrSceneComponentsMSFT, components, componentCapacityInput),
+};
+
+void serialize(const XrSceneComponentsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneComponentsMSFT, ctx);
+}
+
+void deserialize(XrSceneComponentsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneComponentsMSFT, ctx);
+}
+
+void cleanup(const XrSceneComponentsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneComponentsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSceneCreateInfoMSFT, type),
+    FIELD_XR(XrSceneCreateInfoMSFT, next),
+};
+
+void serialize(const XrSceneCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSceneCreateInfoMSFT, type),
+    FIELD_XR(XrSceneCreateInfoMSFT, next),
+};
+
+void serialize(const XrSceneCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneFrustumBoundMSFT[] = {
+    FIELD_VALUE(XrSceneFrustumBoundMSFT, pose),
+    FIELD_VALUE(XrSceneFrustumBoundMSFT, fov),
+    FIELD_VALUE(XrSceneFrustumBoundMSFT, farDistance),
+};
+
+void serialize(const XrSceneFrustumBoundMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneFrustumBoundMSFT, ctx);
+}
+
+void deserialize(XrSceneFrustumBoundMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneFrustumBoundMSFT, ctx);
+}
+
+void cleanup(const XrSceneFrustumBoundMSFT* s) {
+    cleanup_fields(s, fields_XrSceneFrustumBoundMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshBuffersGetInfoMSFT[] = {
+    FIELD_VALUE(XrSceneMeshBuffersGetInfoMSFT, type),
+    FIELD_XR(XrSceneMeshBuffersGetInfoMSFT, next),
+    FIELD_VALUE(XrSceneMeshBuffersGetInfoMSFT, meshBufferId),
+};
+
+void serialize(const XrSceneMeshBuffersGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshBuffersGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshBuffersGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshBuffersGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshBuffersGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshBuffersGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshBuffersGetInfoMSFT[] = {
+    FIELD_VALUE(XrSceneMeshBuffersGetInfoMSFT, type),
+    FIELD_XR(XrSceneMeshBuffersGetInfoMSFT, next),
+    FIELD_VALUE(XrSceneMeshBuffersGetInfoMSFT, meshBufferId),
+};
+
+void serialize(const XrSceneMeshBuffersGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshBuffersGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshBuffersGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshBuffersGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshBuffersGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshBuffersGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshBuffersMSFT[] = {
+    FIELD_VALUE(XrSceneMeshBuffersMSFT, type),
+    FIELD_XR(XrSceneMeshBuffersMSFT, next),
+};
+
+void serialize(const XrSceneMeshBuffersMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshBuffersMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshBuffersMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshBuffersMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshBuffersMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshBuffersMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshBuffersMSFT[] = {
+    FIELD_VALUE(XrSceneMeshBuffersMSFT, type),
+    FIELD_XR(XrSceneMeshBuffersMSFT, next),
+};
+
+void serialize(const XrSceneMeshBuffersMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshBuffersMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshBuffersMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshBuffersMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshBuffersMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshBuffersMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshIndicesUint16MSFT[] = {
+    FIELD_VALUE(XrSceneMeshIndicesUint16MSFT, type),
+    FIELD_XR(XrSceneMeshIndicesUint16MSFT, next),
+    FIELD_VALUE(XrSceneMeshIndicesUint16MSFT, indexCapacityInput),
+    FIELD_VALUE(XrSceneMeshIndicesUint16MSFT, indexCountOutput),
+    FIELD_PTR(XrSceneMeshIndicesUint16MSFT, indices, indexCapacityInput),
+};
+
+void serialize(const XrSceneMeshIndicesUint16MSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshIndicesUint16MSFT, ctx);
+}
+
+void deserialize(XrSceneMeshIndicesUint16MSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshIndicesUint16MSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshIndicesUint16MSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshIndicesUint16MSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshIndicesUint16MSFT[] = {
+    FIELD_VALUE(XrSceneMeshIndicesUint16MSFT, type),
+    FIELD_XR(XrSceneMeshIndicesUint16MSFT, next),
+    FIELD_VALUE(XrSceneMeshIndicesUint16MSFT, indexCapacityInput),
+    FIELD_VALUE(XrSceneMeshIndicesUint16MSFT, indexCountOutput),
+    FIELD_PTR(XrSceneMeshIndicesUint16MSFT, indices, indexCapacityInput),
+};
+
+void serialize(const XrSceneMeshIndicesUint16MSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshIndicesUint16MSFT, ctx);
+}
+
+void deserialize(XrSceneMeshIndicesUint16MSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshIndicesUint16MSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshIndicesUint16MSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshIndicesUint16MSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshIndicesUint32MSFT[] = {
+    FIELD_VALUE(XrSceneMeshIndicesUint32MSFT, type),
+    FIELD_XR(XrSceneMeshIndicesUint32MSFT, next),
+    FIELD_VALUE(XrSceneMeshIndicesUint32MSFT, indexCapacityInput),
+    FIELD_VALUE(XrSceneMeshIndicesUint32MSFT, indexCountOutput),
+    FIELD_PTR(XrSceneMeshIndicesUint32MSFT, indices, indexCapacityInput),
+};
+
+void serialize(const XrSceneMeshIndicesUint32MSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshIndicesUint32MSFT, ctx);
+}
+
+void deserialize(XrSceneMeshIndicesUint32MSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshIndicesUint32MSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshIndicesUint32MSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshIndicesUint32MSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshIndicesUint32MSFT[] = {
+    FIELD_VALUE(XrSceneMeshIndicesUint32MSFT, type),
+    FIELD_XR(XrSceneMeshIndicesUint32MSFT, next),
+    FIELD_VALUE(XrSceneMeshIndicesUint32MSFT, indexCapacityInput),
+    FIELD_VALUE(XrSceneMeshIndicesUint32MSFT, indexCountOutput),
+    FIELD_PTR(XrSceneMeshIndicesUint32MSFT, indices, indexCapacityInput),
+};
+
+void serialize(const XrSceneMeshIndicesUint32MSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshIndicesUint32MSFT, ctx);
+}
+
+void deserialize(XrSceneMeshIndicesUint32MSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshIndicesUint32MSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshIndicesUint32MSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshIndicesUint32MSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshMSFT[] = {
+    FIELD_VALUE(XrSceneMeshMSFT, meshBufferId),
+    FIELD_VALUE(XrSceneMeshMSFT, supportsIndicesUint16),
+};
+
+void serialize(const XrSceneMeshMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshVertexBufferMSFT[] = {
+    FIELD_VALUE(XrSceneMeshVertexBufferMSFT, type),
+    FIELD_XR(XrSceneMeshVertexBufferMSFT, next),
+    FIELD_VALUE(XrSceneMeshVertexBufferMSFT, vertexCapacityInput),
+    FIELD_VALUE(XrSceneMeshVertexBufferMSFT, vertexCountOutput),
+    FIELD_PTR(XrSceneMeshVertexBufferMSFT, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrSceneMeshVertexBufferMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshVertexBufferMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshVertexBufferMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshVertexBufferMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshVertexBufferMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshVertexBufferMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshVertexBufferMSFT[] = {
+    FIELD_VALUE(XrSceneMeshVertexBufferMSFT, type),
+    FIELD_XR(XrSceneMeshVertexBufferMSFT, next),
+    FIELD_VALUE(XrSceneMeshVertexBufferMSFT, vertexCapacityInput),
+    FIELD_VALUE(XrSceneMeshVertexBufferMSFT, vertexCountOutput),
+    FIELD_PTR(XrSceneMeshVertexBufferMSFT, vertices, vertexCapacityInput),
+};
+
+void serialize(const XrSceneMeshVertexBufferMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshVertexBufferMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshVertexBufferMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshVertexBufferMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshVertexBufferMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshVertexBufferMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshesMSFT[] = {
+    FIELD_VALUE(XrSceneMeshesMSFT, type),
+    FIELD_XR(XrSceneMeshesMSFT, next),
+    FIELD_VALUE(XrSceneMeshesMSFT, sceneMeshCount),
+    FIELD_PTR(XrSceneMeshesMSFT, sceneMeshes, sceneMeshCount),
+};
+
+void serialize(const XrSceneMeshesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshesMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshesMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshesMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneMeshesMSFT[] = {
+    FIELD_VALUE(XrSceneMeshesMSFT, type),
+    FIELD_XR(XrSceneMeshesMSFT, next),
+    FIELD_VALUE(XrSceneMeshesMSFT, sceneMeshCount),
+    FIELD_PTR(XrSceneMeshesMSFT, sceneMeshes, sceneMeshCount),
+};
+
+void serialize(const XrSceneMeshesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneMeshesMSFT, ctx);
+}
+
+void deserialize(XrSceneMeshesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneMeshesMSFT, ctx);
+}
+
+void cleanup(const XrSceneMeshesMSFT* s) {
+    cleanup_fields(s, fields_XrSceneMeshesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObjectMSFT[] = {
+    FIELD_VALUE(XrSceneObjectMSFT, objectType),
+};
+
+void serialize(const XrSceneObjectMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObjectMSFT, ctx);
+}
+
+void deserialize(XrSceneObjectMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObjectMSFT, ctx);
+}
+
+void cleanup(const XrSceneObjectMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObjectMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObjectTypesFilterInfoMSFT[] = {
+    FIELD_VALUE(XrSceneObjectTypesFilterInfoMSFT, type),
+    FIELD_XR(XrSceneObjectTypesFilterInfoMSFT, next),
+    FIELD_VALUE(XrSceneObjectTypesFilterInfoMSFT, objectTypeCount),
+    FIELD_PTR(XrSceneObjectTypesFilterInfoMSFT, objectTypes, objectTypeCount),
+};
+
+void serialize(const XrSceneObjectTypesFilterInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObjectTypesFilterInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneObjectTypesFilterInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObjectTypesFilterInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneObjectTypesFilterInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObjectTypesFilterInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObjectTypesFilterInfoMSFT[] = {
+    FIELD_VALUE(XrSceneObjectTypesFilterInfoMSFT, type),
+    FIELD_XR(XrSceneObjectTypesFilterInfoMSFT, next),
+    FIELD_VALUE(XrSceneObjectTypesFilterInfoMSFT, objectTypeCount),
+    FIELD_PTR(XrSceneObjectTypesFilterInfoMSFT, objectTypes, objectTypeCount),
+};
+
+void serialize(const XrSceneObjectTypesFilterInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObjectTypesFilterInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneObjectTypesFilterInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObjectTypesFilterInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneObjectTypesFilterInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObjectTypesFilterInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObjectsMSFT[] = {
+    FIELD_VALUE(XrSceneObjectsMSFT, type),
+    FIELD_XR(XrSceneObjectsMSFT, next),
+    FIELD_VALUE(XrSceneObjectsMSFT, sceneObjectCount),
+    FIELD_PTR(XrSceneObjectsMSFT, sceneObjects, sceneObjectCount),
+};
+
+void serialize(const XrSceneObjectsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObjectsMSFT, ctx);
+}
+
+void deserialize(XrSceneObjectsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObjectsMSFT, ctx);
+}
+
+void cleanup(const XrSceneObjectsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObjectsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObjectsMSFT[] = {
+    FIELD_VALUE(XrSceneObjectsMSFT, type),
+    FIELD_XR(XrSceneObjectsMSFT, next),
+    FIELD_VALUE(XrSceneObjectsMSFT, sceneObjectCount),
+    FIELD_PTR(XrSceneObjectsMSFT, sceneObjects, sceneObjectCount),
+};
+
+void serialize(const XrSceneObjectsMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObjectsMSFT, ctx);
+}
+
+void deserialize(XrSceneObjectsMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObjectsMSFT, ctx);
+}
+
+void cleanup(const XrSceneObjectsMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObjectsMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObserverCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSceneObserverCreateInfoMSFT, type),
+    FIELD_XR(XrSceneObserverCreateInfoMSFT, next),
+};
+
+void serialize(const XrSceneObserverCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObserverCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneObserverCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObserverCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneObserverCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObserverCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneObserverCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSceneObserverCreateInfoMSFT, type),
+    FIELD_XR(XrSceneObserverCreateInfoMSFT, next),
+};
+
+void serialize(const XrSceneObserverCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneObserverCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneObserverCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneObserverCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneObserverCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneObserverCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneOrientedBoxBoundMSFT[] = {
+    FIELD_VALUE(XrSceneOrientedBoxBoundMSFT, pose),
+    FIELD_VALUE(XrSceneOrientedBoxBoundMSFT, extents),
+};
+
+void serialize(const XrSceneOrientedBoxBoundMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneOrientedBoxBoundMSFT, ctx);
+}
+
+void deserialize(XrSceneOrientedBoxBoundMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneOrientedBoxBoundMSFT, ctx);
+}
+
+void cleanup(const XrSceneOrientedBoxBoundMSFT* s) {
+    cleanup_fields(s, fields_XrSceneOrientedBoxBoundMSFT);
+}
+
+constexpr FieldDescriptor fields_XrScenePlaneAlignmentFilterInfoMSFT[] = {
+    FIELD_VALUE(XrScenePlaneAlignmentFilterInfoMSFT, type),
+    FIELD_XR(XrScenePlaneAlignmentFilterInfoMSFT, next),
+    FIELD_VALUE(XrScenePlaneAlignmentFilterInfoMSFT, alignmentCount),
+    FIELD_PTR(XrScenePlaneAlignmentFilterInfoMSFT, alignments, alignmentCount),
+};
+
+void serialize(const XrScenePlaneAlignmentFilterInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrScenePlaneAlignmentFilterInfoMSFT, ctx);
+}
+
+void deserialize(XrScenePlaneAlignmentFilterInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrScenePlaneAlignmentFilterInfoMSFT, ctx);
+}
+
+void cleanup(const XrScenePlaneAlignmentFilterInfoMSFT* s) {
+    cleanup_fields(s, fields_XrScenePlaneAlignmentFilterInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrScenePlaneAlignmentFilterInfoMSFT[] = {
+    FIELD_VALUE(XrScenePlaneAlignmentFilterInfoMSFT, type),
+    FIELD_XR(XrScenePlaneAlignmentFilterInfoMSFT, next),
+    FIELD_VALUE(XrScenePlaneAlignmentFilterInfoMSFT, alignmentCount),
+    FIELD_PTR(XrScenePlaneAlignmentFilterInfoMSFT, alignments, alignmentCount),
+};
+
+void serialize(const XrScenePlaneAlignmentFilterInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrScenePlaneAlignmentFilterInfoMSFT, ctx);
+}
+
+void deserialize(XrScenePlaneAlignmentFilterInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrScenePlaneAlignmentFilterInfoMSFT, ctx);
+}
+
+void cleanup(const XrScenePlaneAlignmentFilterInfoMSFT* s) {
+    cleanup_fields(s, fields_XrScenePlaneAlignmentFilterInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrScenePlaneMSFT[] = {
+    FIELD_VALUE(XrScenePlaneMSFT, alignment),
+    FIELD_VALUE(XrScenePlaneMSFT, size),
+    FIELD_VALUE(XrScenePlaneMSFT, meshBufferId),
+    FIELD_VALUE(XrScenePlaneMSFT, supportsIndicesUint16),
+};
+
+void serialize(const XrScenePlaneMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrScenePlaneMSFT, ctx);
+}
+
+void deserialize(XrScenePlaneMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrScenePlaneMSFT, ctx);
+}
+
+void cleanup(const XrScenePlaneMSFT* s) {
+    cleanup_fields(s, fields_XrScenePlaneMSFT);
+}
+
+constexpr FieldDescriptor fields_XrScenePlanesMSFT[] = {
+    FIELD_VALUE(XrScenePlanesMSFT, type),
+    FIELD_XR(XrScenePlanesMSFT, next),
+    FIELD_VALUE(XrScenePlanesMSFT, scenePlaneCount),
+    FIELD_PTR(XrScenePlanesMSFT, scenePlanes, scenePlaneCount),
+};
+
+void serialize(const XrScenePlanesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrScenePlanesMSFT, ctx);
+}
+
+void deserialize(XrScenePlanesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrScenePlanesMSFT, ctx);
+}
+
+void cleanup(const XrScenePlanesMSFT* s) {
+    cleanup_fields(s, fields_XrScenePlanesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrScenePlanesMSFT[] = {
+    FIELD_VALUE(XrScenePlanesMSFT, type),
+    FIELD_XR(XrScenePlanesMSFT, next),
+    FIELD_VALUE(XrScenePlanesMSFT, scenePlaneCount),
+    FIELD_PTR(XrScenePlanesMSFT, scenePlanes, scenePlaneCount),
+};
+
+void serialize(const XrScenePlanesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrScenePlanesMSFT, ctx);
+}
+
+void deserialize(XrScenePlanesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrScenePlanesMSFT, ctx);
+}
+
+void cleanup(const XrScenePlanesMSFT* s) {
+    cleanup_fields(s, fields_XrScenePlanesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneSphereBoundMSFT[] = {
+    FIELD_VALUE(XrSceneSphereBoundMSFT, center),
+    FIELD_VALUE(XrSceneSphereBoundMSFT, radius),
+};
+
+void serialize(const XrSceneSphereBoundMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneSphereBoundMSFT, ctx);
+}
+
+void deserialize(XrSceneSphereBoundMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneSphereBoundMSFT, ctx);
+}
+
+void cleanup(const XrSceneSphereBoundMSFT* s) {
+    cleanup_fields(s, fields_XrSceneSphereBoundMSFT);
+}
+
+constexpr FieldDescriptor fields_XrUuidMSFT[] = {
+    FIELD_ARRAY(XrUuidMSFT, bytes),
+};
+
+void serialize(const XrUuidMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrUuidMSFT, ctx);
+}
+
+void deserialize(XrUuidMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrUuidMSFT, ctx);
+}
+
+void cleanup(const XrUuidMSFT* s) {
+    cleanup_fields(s, fields_XrUuidMSFT);
+}
+
+constexpr FieldDescriptor fields_XrVisualMeshComputeLodInfoMSFT[] = {
+    FIELD_VALUE(XrVisualMeshComputeLodInfoMSFT, type),
+    FIELD_XR(XrVisualMeshComputeLodInfoMSFT, next),
+    FIELD_VALUE(XrVisualMeshComputeLodInfoMSFT, lod),
+};
+
+void serialize(const XrVisualMeshComputeLodInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVisualMeshComputeLodInfoMSFT, ctx);
+}
+
+void deserialize(XrVisualMeshComputeLodInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVisualMeshComputeLodInfoMSFT, ctx);
+}
+
+void cleanup(const XrVisualMeshComputeLodInfoMSFT* s) {
+    cleanup_fields(s, fields_XrVisualMeshComputeLodInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrVisualMeshComputeLodInfoMSFT[] = {
+    FIELD_VALUE(XrVisualMeshComputeLodInfoMSFT, type),
+    FIELD_XR(XrVisualMeshComputeLodInfoMSFT, next),
+    FIELD_VALUE(XrVisualMeshComputeLodInfoMSFT, lod),
+};
+
+void serialize(const XrVisualMeshComputeLodInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVisualMeshComputeLodInfoMSFT, ctx);
+}
+
+void deserialize(XrVisualMeshComputeLodInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVisualMeshComputeLodInfoMSFT, ctx);
+}
+
+void cleanup(const XrVisualMeshComputeLodInfoMSFT* s) {
+    cleanup_fields(s, fields_XrVisualMeshComputeLodInfoMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding_serialization
+constexpr FieldDescriptor fields_XrDeserializeSceneFragmentMSFT[] = {
+    FIELD_VALUE(XrDeserializeSceneFragmentMSFT, bufferSize),
+    FIELD_PTR(XrDeserializeSceneFragmentMSFT, buffer, bufferSize),
+};
+
+void serialize(const XrDeserializeSceneFragmentMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrDeserializeSceneFragmentMSFT, ctx);
+}
+
+void deserialize(XrDeserializeSceneFragmentMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrDeserializeSceneFragmentMSFT, ctx);
+}
+
+void cleanup(const XrDeserializeSceneFragmentMSFT* s) {
+    cleanup_fields(s, fields_XrDeserializeSceneFragmentMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneDeserializeInfoMSFT[] = {
+    FIELD_VALUE(XrSceneDeserializeInfoMSFT, type),
+    FIELD_XR(XrSceneDeserializeInfoMSFT, next),
+    FIELD_VALUE(XrSceneDeserializeInfoMSFT, fragmentCount),
+    FIELD_PTR(XrSceneDeserializeInfoMSFT, fragments, fragmentCount),
+};
+
+void serialize(const XrSceneDeserializeInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneDeserializeInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneDeserializeInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneDeserializeInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneDeserializeInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneDeserializeInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSceneDeserializeInfoMSFT[] = {
+    FIELD_VALUE(XrSceneDeserializeInfoMSFT, type),
+    FIELD_XR(XrSceneDeserializeInfoMSFT, next),
+    FIELD_VALUE(XrSceneDeserializeInfoMSFT, fragmentCount),
+    FIELD_PTR(XrSceneDeserializeInfoMSFT, fragments, fragmentCount),
+};
+
+void serialize(const XrSceneDeserializeInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSceneDeserializeInfoMSFT, ctx);
+}
+
+void deserialize(XrSceneDeserializeInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSceneDeserializeInfoMSFT, ctx);
+}
+
+void cleanup(const XrSceneDeserializeInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSceneDeserializeInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSerializedSceneFragmentDataGetInfoMSFT[] = {
+    FIELD_VALUE(XrSerializedSceneFragmentDataGetInfoMSFT, type),
+    FIELD_XR(XrSerializedSceneFragmentDataGetInfoMSFT, next),
+    FIELD_VALUE(XrSerializedSceneFragmentDataGetInfoMSFT, sceneFragmentId),
+};
+
+void serialize(const XrSerializedSceneFragmentDataGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSerializedSceneFragmentDataGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSerializedSceneFragmentDataGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSerializedSceneFragmentDataGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSerializedSceneFragmentDataGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSerializedSceneFragmentDataGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSerializedSceneFragmentDataGetInfoMSFT[] = {
+    FIELD_VALUE(XrSerializedSceneFragmentDataGetInfoMSFT, type),
+    FIELD_XR(XrSerializedSceneFragmentDataGetInfoMSFT, next),
+    FIELD_VALUE(XrSerializedSceneFragmentDataGetInfoMSFT, sceneFragmentId),
+};
+
+void serialize(const XrSerializedSceneFragmentDataGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSerializedSceneFragmentDataGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSerializedSceneFragmentDataGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSerializedSceneFragmentDataGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSerializedSceneFragmentDataGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSerializedSceneFragmentDataGetInfoMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding_serialization
+#ifdef XRTRANSPORT_EXT_XR_MSFT_secondary_view_configuration
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationFrameEndInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameEndInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationFrameEndInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameEndInfoMSFT, viewConfigurationCount),
+    FIELD_PTR(XrSecondaryViewConfigurationFrameEndInfoMSFT, viewConfigurationLayersInfo, viewConfigurationCount),
+};
+
+void serialize(const XrSecondaryViewConfigurationFrameEndInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationFrameEndInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationFrameEndInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationFrameEndInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationFrameEndInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationFrameEndInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationFrameEndInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameEndInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationFrameEndInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameEndInfoMSFT, viewConfigurationCount),
+    FIELD_PTR(XrSecondaryViewConfigurationFrameEndInfoMSFT, viewConfigurationLayersInfo, viewConfigurationCount),
+};
+
+void serialize(const XrSecondaryViewConfigurationFrameEndInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationFrameEndInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationFrameEndInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationFrameEndInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationFrameEndInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationFrameEndInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationFrameStateMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameStateMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationFrameStateMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameStateMSFT, viewConfigurationCount),
+    FIELD_PTR(XrSecondaryViewConfigurationFrameStateMSFT, viewConfigurationStates, viewConfigurationCount),
+};
+
+void serialize(const XrSecondaryViewConfigurationFrameStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationFrameStateMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationFrameStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationFrameStateMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationFrameStateMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationFrameStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationFrameStateMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameStateMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationFrameStateMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationFrameStateMSFT, viewConfigurationCount),
+    FIELD_PTR(XrSecondaryViewConfigurationFrameStateMSFT, viewConfigurationStates, viewConfigurationCount),
+};
+
+void serialize(const XrSecondaryViewConfigurationFrameStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationFrameStateMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationFrameStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationFrameStateMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationFrameStateMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationFrameStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationLayerInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationLayerInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, viewConfigurationType),
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, environmentBlendMode),
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, layerCount),
+    #error "auto-generator doesn't support double pointers (XrSecondaryViewConfigurationLayerInfoMSFT::layers)"
+};
+
+void serialize(const XrSecondaryViewConfigurationLayerInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationLayerInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationLayerInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationLayerInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationLayerInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationLayerInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationLayerInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationLayerInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, viewConfigurationType),
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, environmentBlendMode),
+    FIELD_VALUE(XrSecondaryViewConfigurationLayerInfoMSFT, layerCount),
+    #error "auto-generator doesn't support double pointers (XrSecondaryViewConfigurationLayerInfoMSFT::layers)"
+};
+
+void serialize(const XrSecondaryViewConfigurationLayerInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationLayerInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationLayerInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationLayerInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationLayerInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationLayerInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationSessionBeginInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationSessionBeginInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationSessionBeginInfoMSFT, viewConfigurationCount),
+    FIELD_PTR(XrSecondaryViewConfigurationSessionBeginInfoMSFT, enabledViewConfigurationTypes, viewConfigurationCount),
+};
+
+void serialize(const XrSecondaryViewConfigurationSessionBeginInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationSessionBeginInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationSessionBeginInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationSessionBeginInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationSessionBeginInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationSessionBeginInfoMSFT, viewConfigurationCount),
+    FIELD_PTR(XrSecondaryViewConfigurationSessionBeginInfoMSFT, enabledViewConfigurationTypes, viewConfigurationCount),
+};
+
+void serialize(const XrSecondaryViewConfigurationSessionBeginInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationSessionBeginInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationSessionBeginInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationSessionBeginInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationStateMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationStateMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationStateMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationStateMSFT, viewConfigurationType),
+    FIELD_VALUE(XrSecondaryViewConfigurationStateMSFT, active),
+};
+
+void serialize(const XrSecondaryViewConfigurationStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationStateMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationStateMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationStateMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationStateMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationStateMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationStateMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationStateMSFT, viewConfigurationType),
+    FIELD_VALUE(XrSecondaryViewConfigurationStateMSFT, active),
+};
+
+void serialize(const XrSecondaryViewConfigurationStateMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationStateMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationStateMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationStateMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationStateMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationStateMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, viewConfigurationType),
+};
+
+void serialize(const XrSecondaryViewConfigurationSwapchainCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationSwapchainCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, type),
+    FIELD_XR(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, next),
+    FIELD_VALUE(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, viewConfigurationType),
+};
+
+void serialize(const XrSecondaryViewConfigurationSwapchainCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSecondaryViewConfigurationSwapchainCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSecondaryViewConfigurationSwapchainCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSecondaryViewConfigurationSwapchainCreateInfoMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_secondary_view_configuration
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_anchor
+constexpr FieldDescriptor fields_XrSpatialAnchorCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialAnchorCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialAnchorCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoMSFT, space),
+    FIELD_VALUE(XrSpatialAnchorCreateInfoMSFT, pose),
+    FIELD_TIME(XrSpatialAnchorCreateInfoMSFT, time),
+};
+
+void serialize(const XrSpatialAnchorCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorSpaceCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialAnchorSpaceCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialAnchorSpaceCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialAnchorSpaceCreateInfoMSFT, anchor),
+    FIELD_VALUE(XrSpatialAnchorSpaceCreateInfoMSFT, poseInAnchorSpace),
+};
+
+void serialize(const XrSpatialAnchorSpaceCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorSpaceCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorSpaceCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorSpaceCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorSpaceCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorSpaceCreateInfoMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
+constexpr FieldDescriptor fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, spatialAnchorStore),
+    FIELD_VALUE(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, spatialAnchorPersistenceName),
+};
+
+void serialize(const XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, spatialAnchorStore),
+    FIELD_VALUE(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, spatialAnchorPersistenceName),
+};
+
+void serialize(const XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorPersistenceInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialAnchorPersistenceInfoMSFT, type),
+    FIELD_XR(XrSpatialAnchorPersistenceInfoMSFT, next),
+    FIELD_VALUE(XrSpatialAnchorPersistenceInfoMSFT, spatialAnchorPersistenceName),
+    FIELD_VALUE(XrSpatialAnchorPersistenceInfoMSFT, spatialAnchor),
+};
+
+void serialize(const XrSpatialAnchorPersistenceInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorPersistenceInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorPersistenceInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorPersistenceInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorPersistenceInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorPersistenceInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorPersistenceInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialAnchorPersistenceInfoMSFT, type),
+    FIELD_XR(XrSpatialAnchorPersistenceInfoMSFT, next),
+    FIELD_VALUE(XrSpatialAnchorPersistenceInfoMSFT, spatialAnchorPersistenceName),
+    FIELD_VALUE(XrSpatialAnchorPersistenceInfoMSFT, spatialAnchor),
+};
+
+void serialize(const XrSpatialAnchorPersistenceInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorPersistenceInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorPersistenceInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorPersistenceInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorPersistenceInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorPersistenceInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialAnchorPersistenceNameMSFT[] = {
+    FIELD_STRING_ARRAY(XrSpatialAnchorPersistenceNameMSFT, name),
+};
+
+void serialize(const XrSpatialAnchorPersistenceNameMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialAnchorPersistenceNameMSFT, ctx);
+}
+
+void deserialize(XrSpatialAnchorPersistenceNameMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialAnchorPersistenceNameMSFT, ctx);
+}
+
+void cleanup(const XrSpatialAnchorPersistenceNameMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialAnchorPersistenceNameMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_graph_bridge
+constexpr FieldDescriptor fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, type),
+    FIELD_XR(XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, next),
+};
+
+void serialize(const XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, type),
+    FIELD_XR(XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, next),
+};
+
+void serialize(const XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphNodeBindingPropertiesGetInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphNodeBindingPropertiesMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphNodeBindingPropertiesMSFT, type),
+    FIELD_XR(XrSpatialGraphNodeBindingPropertiesMSFT, next),
+    FIELD_ARRAY(XrSpatialGraphNodeBindingPropertiesMSFT, nodeId),
+    FIELD_VALUE(XrSpatialGraphNodeBindingPropertiesMSFT, poseInNodeSpace),
+};
+
+void serialize(const XrSpatialGraphNodeBindingPropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphNodeBindingPropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphNodeBindingPropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphNodeBindingPropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphNodeBindingPropertiesMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphNodeBindingPropertiesMSFT, type),
+    FIELD_XR(XrSpatialGraphNodeBindingPropertiesMSFT, next),
+    FIELD_ARRAY(XrSpatialGraphNodeBindingPropertiesMSFT, nodeId),
+    FIELD_VALUE(XrSpatialGraphNodeBindingPropertiesMSFT, poseInNodeSpace),
+};
+
+void serialize(const XrSpatialGraphNodeBindingPropertiesMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphNodeBindingPropertiesMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphNodeBindingPropertiesMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphNodeBindingPropertiesMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphNodeBindingPropertiesMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphNodeSpaceCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphNodeSpaceCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialGraphNodeSpaceCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialGraphNodeSpaceCreateInfoMSFT, nodeType),
+    FIELD_ARRAY(XrSpatialGraphNodeSpaceCreateInfoMSFT, nodeId),
+    FIELD_VALUE(XrSpatialGraphNodeSpaceCreateInfoMSFT, pose),
+};
+
+void serialize(const XrSpatialGraphNodeSpaceCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphNodeSpaceCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphNodeSpaceCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphNodeSpaceCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphNodeSpaceCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphNodeSpaceCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphNodeSpaceCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphNodeSpaceCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialGraphNodeSpaceCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialGraphNodeSpaceCreateInfoMSFT, nodeType),
+    FIELD_ARRAY(XrSpatialGraphNodeSpaceCreateInfoMSFT, nodeId),
+    FIELD_VALUE(XrSpatialGraphNodeSpaceCreateInfoMSFT, pose),
+};
+
+void serialize(const XrSpatialGraphNodeSpaceCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphNodeSpaceCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphNodeSpaceCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphNodeSpaceCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphNodeSpaceCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphNodeSpaceCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, space),
+    FIELD_VALUE(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, poseInSpace),
+    FIELD_TIME(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, time),
+};
+
+void serialize(const XrSpatialGraphStaticNodeBindingCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphStaticNodeBindingCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphStaticNodeBindingCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT);
+}
+
+constexpr FieldDescriptor fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT[] = {
+    FIELD_VALUE(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, type),
+    FIELD_XR(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, next),
+    FIELD_VALUE(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, space),
+    FIELD_VALUE(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, poseInSpace),
+    FIELD_TIME(XrSpatialGraphStaticNodeBindingCreateInfoMSFT, time),
+};
+
+void serialize(const XrSpatialGraphStaticNodeBindingCreateInfoMSFT* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT, ctx);
+}
+
+void deserialize(XrSpatialGraphStaticNodeBindingCreateInfoMSFT* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT, ctx);
+}
+
+void cleanup(const XrSpatialGraphStaticNodeBindingCreateInfoMSFT* s) {
+    cleanup_fields(s, fields_XrSpatialGraphStaticNodeBindingCreateInfoMSFT);
+}
+
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_graph_bridge
+#ifdef XRTRANSPORT_EXT_XR_OCULUS_external_camera
+constexpr FieldDescriptor fields_XrExternalCameraExtrinsicsOCULUS[] = {
+    FIELD_TIME(XrExternalCameraExtrinsicsOCULUS, lastChangeTime),
+    FIELD_VALUE(XrExternalCameraExtrinsicsOCULUS, cameraStatusFlags),
+    FIELD_VALUE(XrExternalCameraExtrinsicsOCULUS, attachedToDevice),
+    FIELD_VALUE(XrExternalCameraExtrinsicsOCULUS, relativePose),
+};
+
+void serialize(const XrExternalCameraExtrinsicsOCULUS* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExternalCameraExtrinsicsOCULUS, ctx);
+}
+
+void deserialize(XrExternalCameraExtrinsicsOCULUS* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExternalCameraExtrinsicsOCULUS, ctx);
+}
+
+void cleanup(const XrExternalCameraExtrinsicsOCULUS* s) {
+    cleanup_fields(s, fields_XrExternalCameraExtrinsicsOCULUS);
+}
+
+constexpr FieldDescriptor fields_XrExternalCameraIntrinsicsOCULUS[] = {
+    FIELD_TIME(XrExternalCameraIntrinsicsOCULUS, lastChangeTime),
+    FIELD_VALUE(XrExternalCameraIntrinsicsOCULUS, fov),
+    FIELD_VALUE(XrExternalCameraIntrinsicsOCULUS, virtualNearPlaneDistance),
+    FIELD_VALUE(XrExternalCameraIntrinsicsOCULUS, virtualFarPlaneDistance),
+    FIELD_VALUE(XrExternalCameraIntrinsicsOCULUS, imageSensorPixelResolution),
+};
+
+void serialize(const XrExternalCameraIntrinsicsOCULUS* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExternalCameraIntrinsicsOCULUS, ctx);
+}
+
+void deserialize(XrExternalCameraIntrinsicsOCULUS* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExternalCameraIntrinsicsOCULUS, ctx);
+}
+
+void cleanup(const XrExternalCameraIntrinsicsOCULUS* s) {
+    cleanup_fields(s, fields_XrExternalCameraIntrinsicsOCULUS);
+}
+
+constexpr FieldDescriptor fields_XrExternalCameraOCULUS[] = {
+    FIELD_VALUE(XrExternalCameraOCULUS, type),
+    FIELD_XR(XrExternalCameraOCULUS, next),
+    FIELD_STRING_ARRAY(XrExternalCameraOCULUS, name),
+    FIELD_VALUE(XrExternalCameraOCULUS, intrinsics),
+    FIELD_VALUE(XrExternalCameraOCULUS, extrinsics),
+};
+
+void serialize(const XrExternalCameraOCULUS* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExternalCameraOCULUS, ctx);
+}
+
+void deserialize(XrExternalCameraOCULUS* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExternalCameraOCULUS, ctx);
+}
+
+void cleanup(const XrExternalCameraOCULUS* s) {
+    cleanup_fields(s, fields_XrExternalCameraOCULUS);
+}
+
+constexpr FieldDescriptor fields_XrExternalCameraOCULUS[] = {
+    FIELD_VALUE(XrExternalCameraOCULUS, type),
+    FIELD_XR(XrExternalCameraOCULUS, next),
+    FIELD_STRING_ARRAY(XrExternalCameraOCULUS, name),
+    FIELD_VALUE(XrExternalCameraOCULUS, intrinsics),
+    FIELD_VALUE(XrExternalCameraOCULUS, extrinsics),
+};
+
+void serialize(const XrExternalCameraOCULUS* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExternalCameraOCULUS, ctx);
+}
+
+void deserialize(XrExternalCameraOCULUS* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExternalCameraOCULUS, ctx);
+}
+
+void cleanup(const XrExternalCameraOCULUS* s) {
+    cleanup_fields(s, fields_XrExternalCameraOCULUS);
+}
+
+#endif // XRTRANSPORT_EXT_XR_OCULUS_external_camera
+#ifdef XRTRANSPORT_EXT_XR_VALVE_analog_threshold
+constexpr FieldDescriptor fields_XrInteractionProfileAnalogThresholdVALVE[] = {
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, type),
+    FIELD_XR(XrInteractionProfileAnalogThresholdVALVE, next),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, action),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, binding),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, onThreshold),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, offThreshold),
+    FIELD_XR(XrInteractionProfileAnalogThresholdVALVE, onHaptic),
+    FIELD_XR(XrInteractionProfileAnalogThresholdVALVE, offHaptic),
+};
+
+void serialize(const XrInteractionProfileAnalogThresholdVALVE* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInteractionProfileAnalogThresholdVALVE, ctx);
+}
+
+void deserialize(XrInteractionProfileAnalogThresholdVALVE* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInteractionProfileAnalogThresholdVALVE, ctx);
+}
+
+void cleanup(const XrInteractionProfileAnalogThresholdVALVE* s) {
+    cleanup_fields(s, fields_XrInteractionProfileAnalogThresholdVALVE);
+}
+
+constexpr FieldDescriptor fields_XrInteractionProfileAnalogThresholdVALVE[] = {
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, type),
+    FIELD_XR(XrInteractionProfileAnalogThresholdVALVE, next),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, action),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, binding),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, onThreshold),
+    FIELD_VALUE(XrInteractionProfileAnalogThresholdVALVE, offThreshold),
+    FIELD_XR(XrInteractionProfileAnalogThresholdVALVE, onHaptic),
+    FIELD_XR(XrInteractionProfileAnalogThresholdVALVE, offHaptic),
+};
+
+void serialize(const XrInteractionProfileAnalogThresholdVALVE* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInteractionProfileAnalogThresholdVALVE, ctx);
+}
+
+void deserialize(XrInteractionProfileAnalogThresholdVALVE* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInteractionProfileAnalogThresholdVALVE, ctx);
+}
+
+void cleanup(const XrInteractionProfileAnalogThresholdVALVE* s) {
+    cleanup_fields(s, fields_XrInteractionProfileAnalogThresholdVALVE);
+}
+
+#endif // XRTRANSPORT_EXT_XR_VALVE_analog_threshold
+#ifdef XRTRANSPORT_EXT_XR_VARJO_composition_layer_depth_test
+constexpr FieldDescriptor fields_XrCompositionLayerDepthTestVARJO[] = {
+    FIELD_VALUE(XrCompositionLayerDepthTestVARJO, type),
+    FIELD_XR(XrCompositionLayerDepthTestVARJO, next),
+    FIELD_VALUE(XrCompositionLayerDepthTestVARJO, depthTestRangeNearZ),
+    FIELD_VALUE(XrCompositionLayerDepthTestVARJO, depthTestRangeFarZ),
+};
+
+void serialize(const XrCompositionLayerDepthTestVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerDepthTestVARJO, ctx);
+}
+
+void deserialize(XrCompositionLayerDepthTestVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerDepthTestVARJO, ctx);
+}
+
+void cleanup(const XrCompositionLayerDepthTestVARJO* s) {
+    cleanup_fields(s, fields_XrCompositionLayerDepthTestVARJO);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerDepthTestVARJO[] = {
+    FIELD_VALUE(XrCompositionLayerDepthTestVARJO, type),
+    FIELD_XR(XrCompositionLayerDepthTestVARJO, next),
+    FIELD_VALUE(XrCompositionLayerDepthTestVARJO, depthTestRangeNearZ),
+    FIELD_VALUE(XrCompositionLayerDepthTestVARJO, depthTestRangeFarZ),
+};
+
+void serialize(const XrCompositionLayerDepthTestVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerDepthTestVARJO, ctx);
+}
+
+void deserialize(XrCompositionLayerDepthTestVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerDepthTestVARJO, ctx);
+}
+
+void cleanup(const XrCompositionLayerDepthTestVARJO* s) {
+    cleanup_fields(s, fields_XrCompositionLayerDepthTestVARJO);
+}
+
+#endif // XRTRANSPORT_EXT_XR_VARJO_composition_layer_depth_test
+#ifdef XRTRANSPORT_EXT_XR_VARJO_foveated_rendering
+constexpr FieldDescriptor fields_XrFoveatedViewConfigurationViewVARJO[] = {
+    FIELD_VALUE(XrFoveatedViewConfigurationViewVARJO, type),
+    FIELD_XR(XrFoveatedViewConfigurationViewVARJO, next),
+    FIELD_VALUE(XrFoveatedViewConfigurationViewVARJO, foveatedRenderingActive),
+};
+
+void serialize(const XrFoveatedViewConfigurationViewVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveatedViewConfigurationViewVARJO, ctx);
+}
+
+void deserialize(XrFoveatedViewConfigurationViewVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveatedViewConfigurationViewVARJO, ctx);
+}
+
+void cleanup(const XrFoveatedViewConfigurationViewVARJO* s) {
+    cleanup_fields(s, fields_XrFoveatedViewConfigurationViewVARJO);
+}
+
+constexpr FieldDescriptor fields_XrFoveatedViewConfigurationViewVARJO[] = {
+    FIELD_VALUE(XrFoveatedViewConfigurationViewVARJO, type),
+    FIELD_XR(XrFoveatedViewConfigurationViewVARJO, next),
+    FIELD_VALUE(XrFoveatedViewConfigurationViewVARJO, foveatedRenderingActive),
+};
+
+void serialize(const XrFoveatedViewConfigurationViewVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFoveatedViewConfigurationViewVARJO, ctx);
+}
+
+void deserialize(XrFoveatedViewConfigurationViewVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFoveatedViewConfigurationViewVARJO, ctx);
+}
+
+void cleanup(const XrFoveatedViewConfigurationViewVARJO* s) {
+    cleanup_fields(s, fields_XrFoveatedViewConfigurationViewVARJO);
+}
+
+constexpr FieldDescriptor fields_XrSystemFoveatedRenderingPropertiesVARJO[] = {
+    FIELD_VALUE(XrSystemFoveatedRenderingPropertiesVARJO, type),
+    FIELD_XR(XrSystemFoveatedRenderingPropertiesVARJO, next),
+    FIELD_VALUE(XrSystemFoveatedRenderingPropertiesVARJO, supportsFoveatedRendering),
+};
+
+void serialize(const XrSystemFoveatedRenderingPropertiesVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFoveatedRenderingPropertiesVARJO, ctx);
+}
+
+void deserialize(XrSystemFoveatedRenderingPropertiesVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFoveatedRenderingPropertiesVARJO, ctx);
+}
+
+void cleanup(const XrSystemFoveatedRenderingPropertiesVARJO* s) {
+    cleanup_fields(s, fields_XrSystemFoveatedRenderingPropertiesVARJO);
+}
+
+constexpr FieldDescriptor fields_XrSystemFoveatedRenderingPropertiesVARJO[] = {
+    FIELD_VALUE(XrSystemFoveatedRenderingPropertiesVARJO, type),
+    FIELD_XR(XrSystemFoveatedRenderingPropertiesVARJO, next),
+    FIELD_VALUE(XrSystemFoveatedRenderingPropertiesVARJO, supportsFoveatedRendering),
+};
+
+void serialize(const XrSystemFoveatedRenderingPropertiesVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemFoveatedRenderingPropertiesVARJO, ctx);
+}
+
+void deserialize(XrSystemFoveatedRenderingPropertiesVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemFoveatedRenderingPropertiesVARJO, ctx);
+}
+
+void cleanup(const XrSystemFoveatedRenderingPropertiesVARJO* s) {
+    cleanup_fields(s, fields_XrSystemFoveatedRenderingPropertiesVARJO);
+}
+
+constexpr FieldDescriptor fields_XrViewLocateFoveatedRenderingVARJO[] = {
+    FIELD_VALUE(XrViewLocateFoveatedRenderingVARJO, type),
+    FIELD_XR(XrViewLocateFoveatedRenderingVARJO, next),
+    FIELD_VALUE(XrViewLocateFoveatedRenderingVARJO, foveatedRenderingActive),
+};
+
+void serialize(const XrViewLocateFoveatedRenderingVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewLocateFoveatedRenderingVARJO, ctx);
+}
+
+void deserialize(XrViewLocateFoveatedRenderingVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewLocateFoveatedRenderingVARJO, ctx);
+}
+
+void cleanup(const XrViewLocateFoveatedRenderingVARJO* s) {
+    cleanup_fields(s, fields_XrViewLocateFoveatedRenderingVARJO);
+}
+
+constexpr FieldDescriptor fields_XrViewLocateFoveatedRenderingVARJO[] = {
+    FIELD_VALUE(XrViewLocateFoveatedRenderingVARJO, type),
+    FIELD_XR(XrViewLocateFoveatedRenderingVARJO, next),
+    FIELD_VALUE(XrViewLocateFoveatedRenderingVARJO, foveatedRenderingActive),
+};
+
+void serialize(const XrViewLocateFoveatedRenderingVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewLocateFoveatedRenderingVARJO, ctx);
+}
+
+void deserialize(XrViewLocateFoveatedRenderingVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewLocateFoveatedRenderingVARJO, ctx);
+}
+
+void cleanup(const XrViewLocateFoveatedRenderingVARJO* s) {
+    cleanup_fields(s, fields_XrViewLocateFoveatedRenderingVARJO);
+}
+
+#endif // XRTRANSPORT_EXT_XR_VARJO_foveated_rendering
+#ifdef XRTRANSPORT_EXT_XR_VARJO_marker_tracking
+constexpr FieldDescriptor fields_XrEventDataMarkerTrackingUpdateVARJO[] = {
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, type),
+    FIELD_XR(XrEventDataMarkerTrackingUpdateVARJO, next),
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, markerId),
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, isActive),
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, isPredicted),
+    FIELD_TIME(XrEventDataMarkerTrackingUpdateVARJO, time),
+};
+
+void serialize(const XrEventDataMarkerTrackingUpdateVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataMarkerTrackingUpdateVARJO, ctx);
+}
+
+void deserialize(XrEventDataMarkerTrackingUpdateVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataMarkerTrackingUpdateVARJO, ctx);
+}
+
+void cleanup(const XrEventDataMarkerTrackingUpdateVARJO* s) {
+    cleanup_fields(s, fields_XrEventDataMarkerTrackingUpdateVARJO);
+}
+
+constexpr FieldDescriptor fields_XrEventDataMarkerTrackingUpdateVARJO[] = {
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, type),
+    FIELD_XR(XrEventDataMarkerTrackingUpdateVARJO, next),
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, markerId),
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, isActive),
+    FIELD_VALUE(XrEventDataMarkerTrackingUpdateVARJO, isPredicted),
+    FIELD_TIME(XrEventDataMarkerTrackingUpdateVARJO, time),
+};
+
+void serialize(const XrEventDataMarkerTrackingUpdateVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataMarkerTrackingUpdateVARJO, ctx);
+}
+
+void deserialize(XrEventDataMarkerTrackingUpdateVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataMarkerTrackingUpdateVARJO, ctx);
+}
+
+void cleanup(const XrEventDataMarkerTrackingUpdateVARJO* s) {
+    cleanup_fields(s, fields_XrEventDataMarkerTrackingUpdateVARJO);
+}
+
+constexpr FieldDescriptor fields_XrMarkerSpaceCreateInfoVARJO[] = {
+    FIELD_VALUE(XrMarkerSpaceCreateInfoVARJO, type),
+    FIELD_XR(XrMarkerSpaceCreateInfoVARJO, next),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoVARJO, markerId),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoVARJO, poseInMarkerSpace),
+};
+
+void serialize(const XrMarkerSpaceCreateInfoVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerSpaceCreateInfoVARJO, ctx);
+}
+
+void deserialize(XrMarkerSpaceCreateInfoVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerSpaceCreateInfoVARJO, ctx);
+}
+
+void cleanup(const XrMarkerSpaceCreateInfoVARJO* s) {
+    cleanup_fields(s, fields_XrMarkerSpaceCreateInfoVARJO);
+}
+
+constexpr FieldDescriptor fields_XrMarkerSpaceCreateInfoVARJO[] = {
+    FIELD_VALUE(XrMarkerSpaceCreateInfoVARJO, type),
+    FIELD_XR(XrMarkerSpaceCreateInfoVARJO, next),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoVARJO, markerId),
+    FIELD_VALUE(XrMarkerSpaceCreateInfoVARJO, poseInMarkerSpace),
+};
+
+void serialize(const XrMarkerSpaceCreateInfoVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrMarkerSpaceCreateInfoVARJO, ctx);
+}
+
+void deserialize(XrMarkerSpaceCreateInfoVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrMarkerSpaceCreateInfoVARJO, ctx);
+}
+
+void cleanup(const XrMarkerSpaceCreateInfoVARJO* s) {
+    cleanup_fields(s, fields_XrMarkerSpaceCreateInfoVARJO);
+}
+
+constexpr FieldDescriptor fields_XrSystemMarkerTrackingPropertiesVARJO[] = {
+    FIELD_VALUE(XrSystemMarkerTrackingPropertiesVARJO, type),
+    FIELD_XR(XrSystemMarkerTrackingPropertiesVARJO, next),
+    FIELD_VALUE(XrSystemMarkerTrackingPropertiesVARJO, supportsMarkerTracking),
+};
+
+void serialize(const XrSystemMarkerTrackingPropertiesVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemMarkerTrackingPropertiesVARJO, ctx);
+}
+
+void deserialize(XrSystemMarkerTrackingPropertiesVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemMarkerTrackingPropertiesVARJO, ctx);
+}
+
+void cleanup(const XrSystemMarkerTrackingPropertiesVARJO* s) {
+    cleanup_fields(s, fields_XrSystemMarkerTrackingPropertiesVARJO);
+}
+
+constexpr FieldDescriptor fields_XrSystemMarkerTrackingPropertiesVARJO[] = {
+    FIELD_VALUE(XrSystemMarkerTrackingPropertiesVARJO, type),
+    FIELD_XR(XrSystemMarkerTrackingPropertiesVARJO, next),
+    FIELD_VALUE(XrSystemMarkerTrackingPropertiesVARJO, supportsMarkerTracking),
+};
+
+void serialize(const XrSystemMarkerTrackingPropertiesVARJO* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemMarkerTrackingPropertiesVARJO, ctx);
+}
+
+void deserialize(XrSystemMarkerTrackingPropertiesVARJO* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemMarkerTrackingPropertiesVARJO, ctx);
+}
+
+void cleanup(const XrSystemMarkerTrackingPropertiesVARJO* s) {
+    cleanup_fields(s, fields_XrSystemMarkerTrackingPropertiesVARJO);
+}
+
+#endif // XRTRANSPORT_EXT_XR_VARJO_marker_tracking
+constexpr FieldDescriptor fields_XrActionCreateInfo[] = {
+    FIELD_VALUE(XrActionCreateInfo, type),
+    FIELD_XR(XrActionCreateInfo, next),
+    FIELD_STRING_ARRAY(XrActionCreateInfo, actionName),
+    FIELD_VALUE(XrActionCreateInfo, actionType),
+    FIELD_VALUE(XrActionCreateInfo, countSubactionPaths),
+    FIELD_PTR(XrActionCreateInfo, subactionPaths, countSubactionPaths),
+    FIELD_STRING_ARRAY(XrActionCreateInfo, localizedActionName),
+};
+
+void serialize(const XrActionCreateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionCreateInfo, ctx);
+}
+
+void deserialize(XrActionCreateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionCreateInfo, ctx);
+}
+
+void cleanup(const XrActionCreateInfo* s) {
+    cleanup_fields(s, fields_XrActionCreateInfo);
+}
+
+constexpr FieldDescriptor fields_XrActionSetCreateInfo[] = {
+    FIELD_VALUE(XrActionSetCreateInfo, type),
+    FIELD_XR(XrActionSetCreateInfo, next),
+    FIELD_STRING_ARRAY(XrActionSetCreateInfo, actionSetName),
+    FIELD_STRING_ARRAY(XrActionSetCreateInfo, localizedActionSetName),
+    FIELD_VALUE(XrActionSetCreateInfo, priority),
+};
+
+void serialize(const XrActionSetCreateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionSetCreateInfo, ctx);
+}
+
+void deserialize(XrActionSetCreateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionSetCreateInfo, ctx);
+}
+
+void cleanup(const XrActionSetCreateInfo* s) {
+    cleanup_fields(s, fields_XrActionSetCreateInfo);
+}
+
+constexpr FieldDescriptor fields_XrActionSpaceCreateInfo[] = {
+    FIELD_VALUE(XrActionSpaceCreateInfo, type),
+    FIELD_XR(XrActionSpaceCreateInfo, next),
+    FIELD_VALUE(XrActionSpaceCreateInfo, action),
+    FIELD_VALUE(XrActionSpaceCreateInfo, subactionPath),
+    FIELD_VALUE(XrActionSpaceCreateInfo, poseInActionSpace),
+};
+
+void serialize(const XrActionSpaceCreateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionSpaceCreateInfo, ctx);
+}
+
+void deserialize(XrActionSpaceCreateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionSpaceCreateInfo, ctx);
+}
+
+void cleanup(const XrActionSpaceCreateInfo* s) {
+    cleanup_fields(s, fields_XrActionSpaceCreateInfo);
+}
+
+constexpr FieldDescriptor fields_XrActionStateBoolean[] = {
+    FIELD_VALUE(XrActionStateBoolean, type),
+    FIELD_XR(XrActionStateBoolean, next),
+    FIELD_VALUE(XrActionStateBoolean, currentState),
+    FIELD_VALUE(XrActionStateBoolean, changedSinceLastSync),
+    FIELD_TIME(XrActionStateBoolean, lastChangeTime),
+    FIELD_VALUE(XrActionStateBoolean, isActive),
+};
+
+void serialize(const XrActionStateBoolean* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionStateBoolean, ctx);
+}
+
+void deserialize(XrActionStateBoolean* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionStateBoolean, ctx);
+}
+
+void cleanup(const XrActionStateBoolean* s) {
+    cleanup_fields(s, fields_XrActionStateBoolean);
+}
+
+constexpr FieldDescriptor fields_XrActionStateFloat[] = {
+    FIELD_VALUE(XrActionStateFloat, type),
+    FIELD_XR(XrActionStateFloat, next),
+    FIELD_VALUE(XrActionStateFloat, currentState),
+    FIELD_VALUE(XrActionStateFloat, changedSinceLastSync),
+    FIELD_TIME(XrActionStateFloat, lastChangeTime),
+    FIELD_VALUE(XrActionStateFloat, isActive),
+};
+
+void serialize(const XrActionStateFloat* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionStateFloat, ctx);
+}
+
+void deserialize(XrActionStateFloat* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionStateFloat, ctx);
+}
+
+void cleanup(const XrActionStateFloat* s) {
+    cleanup_fields(s, fields_XrActionStateFloat);
+}
+
+constexpr FieldDescriptor fields_XrActionStateGetInfo[] = {
+    FIELD_VALUE(XrActionStateGetInfo, type),
+    FIELD_XR(XrActionStateGetInfo, next),
+    FIELD_VALUE(XrActionStateGetInfo, action),
+    FIELD_VALUE(XrActionStateGetInfo, subactionPath),
+};
+
+void serialize(const XrActionStateGetInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionStateGetInfo, ctx);
+}
+
+void deserialize(XrActionStateGetInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionStateGetInfo, ctx);
+}
+
+void cleanup(const XrActionStateGetInfo* s) {
+    cleanup_fields(s, fields_XrActionStateGetInfo);
+}
+
+constexpr FieldDescriptor fields_XrActionStatePose[] = {
+    FIELD_VALUE(XrActionStatePose, type),
+    FIELD_XR(XrActionStatePose, next),
+    FIELD_VALUE(XrActionStatePose, isActive),
+};
+
+void serialize(const XrActionStatePose* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionStatePose, ctx);
+}
+
+void deserialize(XrActionStatePose* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionStatePose, ctx);
+}
+
+void cleanup(const XrActionStatePose* s) {
+    cleanup_fields(s, fields_XrActionStatePose);
+}
+
+constexpr FieldDescriptor fields_XrActionStateVector2f[] = {
+    FIELD_VALUE(XrActionStateVector2f, type),
+    FIELD_XR(XrActionStateVector2f, next),
+    FIELD_VALUE(XrActionStateVector2f, currentState),
+    FIELD_VALUE(XrActionStateVector2f, changedSinceLastSync),
+    FIELD_TIME(XrActionStateVector2f, lastChangeTime),
+    FIELD_VALUE(XrActionStateVector2f, isActive),
+};
+
+void serialize(const XrActionStateVector2f* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionStateVector2f, ctx);
+}
+
+void deserialize(XrActionStateVector2f* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionStateVector2f, ctx);
+}
+
+void cleanup(const XrActionStateVector2f* s) {
+    cleanup_fields(s, fields_XrActionStateVector2f);
+}
+
+constexpr FieldDescriptor fields_XrActionSuggestedBinding[] = {
+    FIELD_VALUE(XrActionSuggestedBinding, action),
+    FIELD_VALUE(XrActionSuggestedBinding, binding),
+};
+
+void serialize(const XrActionSuggestedBinding* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionSuggestedBinding, ctx);
+}
+
+void deserialize(XrActionSuggestedBinding* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionSuggestedBinding, ctx);
+}
+
+void cleanup(const XrActionSuggestedBinding* s) {
+    cleanup_fields(s, fields_XrActionSuggestedBinding);
+}
+
+constexpr FieldDescriptor fields_XrActionsSyncInfo[] = {
+    FIELD_VALUE(XrActionsSyncInfo, type),
+    FIELD_XR(XrActionsSyncInfo, next),
+    FIELD_VALUE(XrActionsSyncInfo, countActiveActionSets),
+    FIELD_PTR(XrActionsSyncInfo, activeActionSets, countActiveActionSets),
+};
+
+void serialize(const XrActionsSyncInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActionsSyncInfo, ctx);
+}
+
+void deserialize(XrActionsSyncInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActionsSyncInfo, ctx);
+}
+
+void cleanup(const XrActionsSyncInfo* s) {
+    cleanup_fields(s, fields_XrActionsSyncInfo);
+}
+
+constexpr FieldDescriptor fields_XrActiveActionSet[] = {
+    FIELD_VALUE(XrActiveActionSet, actionSet),
+    FIELD_VALUE(XrActiveActionSet, subactionPath),
+};
+
+void serialize(const XrActiveActionSet* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrActiveActionSet, ctx);
+}
+
+void deserialize(XrActiveActionSet* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrActiveActionSet, ctx);
+}
+
+void cleanup(const XrActiveActionSet* s) {
+    cleanup_fields(s, fields_XrActiveActionSet);
+}
+
+constexpr FieldDescriptor fields_XrApiLayerProperties[] = {
+    FIELD_VALUE(XrApiLayerProperties, type),
+    FIELD_XR(XrApiLayerProperties, next),
+    FIELD_STRING_ARRAY(XrApiLayerProperties, layerName),
+    FIELD_VALUE(XrApiLayerProperties, specVersion),
+    FIELD_VALUE(XrApiLayerProperties, layerVersion),
+    FIELD_STRING_ARRAY(XrApiLayerProperties, description),
+};
+
+void serialize(const XrApiLayerProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrApiLayerProperties, ctx);
+}
+
+void deserialize(XrApiLayerProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrApiLayerProperties, ctx);
+}
+
+void cleanup(const XrApiLayerProperties* s) {
+    cleanup_fields(s, fields_XrApiLayerProperties);
+}
+
+constexpr FieldDescriptor fields_XrApplicationInfo[] = {
+    FIELD_STRING_ARRAY(XrApplicationInfo, applicationName),
+    FIELD_VALUE(XrApplicationInfo, applicationVersion),
+    FIELD_STRING_ARRAY(XrApplicationInfo, engineName),
+    FIELD_VALUE(XrApplicationInfo, engineVersion),
+    FIELD_VALUE(XrApplicationInfo, apiVersion),
+};
+
+void serialize(const XrApplicationInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrApplicationInfo, ctx);
+}
+
+void deserialize(XrApplicationInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrApplicationInfo, ctx);
+}
+
+void cleanup(const XrApplicationInfo* s) {
+    cleanup_fields(s, fields_XrApplicationInfo);
+}
+
+constexpr FieldDescriptor fields_XrBodySkeletonJointHTC[] = {
+    FIELD_VALUE(XrBodySkeletonJointHTC, pose),
+};
+
+void serialize(const XrBodySkeletonJointHTC* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBodySkeletonJointHTC, ctx);
+}
+
+void deserialize(XrBodySkeletonJointHTC* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBodySkeletonJointHTC, ctx);
+}
+
+void cleanup(const XrBodySkeletonJointHTC* s) {
+    cleanup_fields(s, fields_XrBodySkeletonJointHTC);
+}
+
+constexpr FieldDescriptor fields_XrBoundSourcesForActionEnumerateInfo[] = {
+    FIELD_VALUE(XrBoundSourcesForActionEnumerateInfo, type),
+    FIELD_XR(XrBoundSourcesForActionEnumerateInfo, next),
+    FIELD_VALUE(XrBoundSourcesForActionEnumerateInfo, action),
+};
+
+void serialize(const XrBoundSourcesForActionEnumerateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBoundSourcesForActionEnumerateInfo, ctx);
+}
+
+void deserialize(XrBoundSourcesForActionEnumerateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBoundSourcesForActionEnumerateInfo, ctx);
+}
+
+void cleanup(const XrBoundSourcesForActionEnumerateInfo* s) {
+    cleanup_fields(s, fields_XrBoundSourcesForActionEnumerateInfo);
+}
+
+constexpr FieldDescriptor fields_XrBoxf[] = {
+    FIELD_VALUE(XrBoxf, center),
+    FIELD_VALUE(XrBoxf, extents),
+};
+
+void serialize(const XrBoxf* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrBoxf, ctx);
+}
+
+void deserialize(XrBoxf* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrBoxf, ctx);
+}
+
+void cleanup(const XrBoxf* s) {
+    cleanup_fields(s, fields_XrBoxf);
+}
+
+constexpr FieldDescriptor fields_XrColor3f[] = {
+    FIELD_VALUE(XrColor3f, r),
+    FIELD_VALUE(XrColor3f, g),
+    FIELD_VALUE(XrColor3f, b),
+};
+
+void serialize(const XrColor3f* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColor3f, ctx);
+}
+
+void deserialize(XrColor3f* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColor3f, ctx);
+}
+
+void cleanup(const XrColor3f* s) {
+    cleanup_fields(s, fields_XrColor3f);
+}
+
+constexpr FieldDescriptor fields_XrColor4f[] = {
+    FIELD_VALUE(XrColor4f, r),
+    FIELD_VALUE(XrColor4f, g),
+    FIELD_VALUE(XrColor4f, b),
+    FIELD_VALUE(XrColor4f, a),
+};
+
+void serialize(const XrColor4f* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrColor4f, ctx);
+}
+
+void deserialize(XrColor4f* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrColor4f, ctx);
+}
+
+void cleanup(const XrColor4f* s) {
+    cleanup_fields(s, fields_XrColor4f);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerBaseHeader[] = {
+    FIELD_VALUE(XrCompositionLayerBaseHeader, type),
+    FIELD_XR(XrCompositionLayerBaseHeader, next),
+    FIELD_VALUE(XrCompositionLayerBaseHeader, layerFlags),
+    FIELD_VALUE(XrCompositionLayerBaseHeader, space),
+};
+
+void serialize(const XrCompositionLayerBaseHeader* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrCompositionLayerBaseHeader* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerBaseHeader, ctx);
+}
+
+void cleanup(const XrCompositionLayerBaseHeader* s) {
+    cleanup_fields(s, fields_XrCompositionLayerBaseHeader);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerProjection[] = {
+    FIELD_VALUE(XrCompositionLayerProjection, type),
+    FIELD_XR(XrCompositionLayerProjection, next),
+    FIELD_VALUE(XrCompositionLayerProjection, layerFlags),
+    FIELD_VALUE(XrCompositionLayerProjection, space),
+    FIELD_VALUE(XrCompositionLayerProjection, viewCount),
+    FIELD_PTR(XrCompositionLayerProjection, views, viewCount),
+};
+
+void serialize(const XrCompositionLayerProjection* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerProjection, ctx);
+}
+
+void deserialize(XrCompositionLayerProjection* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerProjection, ctx);
+}
+
+void cleanup(const XrCompositionLayerProjection* s) {
+    cleanup_fields(s, fields_XrCompositionLayerProjection);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerProjectionView[] = {
+    FIELD_VALUE(XrCompositionLayerProjectionView, type),
+    FIELD_XR(XrCompositionLayerProjectionView, next),
+    FIELD_VALUE(XrCompositionLayerProjectionView, pose),
+    FIELD_VALUE(XrCompositionLayerProjectionView, fov),
+    FIELD_VALUE(XrCompositionLayerProjectionView, subImage),
+};
+
+void serialize(const XrCompositionLayerProjectionView* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerProjectionView, ctx);
+}
+
+void deserialize(XrCompositionLayerProjectionView* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerProjectionView, ctx);
+}
+
+void cleanup(const XrCompositionLayerProjectionView* s) {
+    cleanup_fields(s, fields_XrCompositionLayerProjectionView);
+}
+
+constexpr FieldDescriptor fields_XrCompositionLayerQuad[] = {
+    FIELD_VALUE(XrCompositionLayerQuad, type),
+    FIELD_XR(XrCompositionLayerQuad, next),
+    FIELD_VALUE(XrCompositionLayerQuad, layerFlags),
+    FIELD_VALUE(XrCompositionLayerQuad, space),
+    FIELD_VALUE(XrCompositionLayerQuad, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerQuad, subImage),
+    FIELD_VALUE(XrCompositionLayerQuad, pose),
+    FIELD_VALUE(XrCompositionLayerQuad, size),
+};
+
+void serialize(const XrCompositionLayerQuad* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrCompositionLayerQuad, ctx);
+}
+
+void deserialize(XrCompositionLayerQuad* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrCompositionLayerQuad, ctx);
+}
+
+void cleanup(const XrCompositionLayerQuad* s) {
+    cleanup_fields(s, fields_XrCompositionLayerQuad);
+}
+
+constexpr FieldDescriptor fields_XrEventDataBaseHeader[] = {
+    FIELD_VALUE(XrEventDataBaseHeader, type),
+    FIELD_XR(XrEventDataBaseHeader, next),
+};
+
+void serialize(const XrEventDataBaseHeader* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrEventDataBaseHeader* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataBaseHeader, ctx);
+}
+
+void cleanup(const XrEventDataBaseHeader* s) {
+    cleanup_fields(s, fields_XrEventDataBaseHeader);
+}
+
+constexpr FieldDescriptor fields_XrEventDataBuffer[] = {
+    FIELD_VALUE(XrEventDataBuffer, type),
+    FIELD_XR(XrEventDataBuffer, next),
+    FIELD_ARRAY(XrEventDataBuffer, varying),
+};
+
+void serialize(const XrEventDataBuffer* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataBuffer, ctx);
+}
+
+void deserialize(XrEventDataBuffer* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataBuffer, ctx);
+}
+
+void cleanup(const XrEventDataBuffer* s) {
+    cleanup_fields(s, fields_XrEventDataBuffer);
+}
+
+constexpr FieldDescriptor fields_XrEventDataEventsLost[] = {
+    FIELD_VALUE(XrEventDataEventsLost, type),
+    FIELD_XR(XrEventDataEventsLost, next),
+    FIELD_VALUE(XrEventDataEventsLost, lostEventCount),
+};
+
+void serialize(const XrEventDataEventsLost* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataEventsLost, ctx);
+}
+
+void deserialize(XrEventDataEventsLost* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataEventsLost, ctx);
+}
+
+void cleanup(const XrEventDataEventsLost* s) {
+    cleanup_fields(s, fields_XrEventDataEventsLost);
+}
+
+constexpr FieldDescriptor fields_XrEventDataInstanceLossPending[] = {
+    FIELD_VALUE(XrEventDataInstanceLossPending, type),
+    FIELD_XR(XrEventDataInstanceLossPending, next),
+    FIELD_TIME(XrEventDataInstanceLossPending, lossTime),
+};
+
+void serialize(const XrEventDataInstanceLossPending* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataInstanceLossPending, ctx);
+}
+
+void deserialize(XrEventDataInstanceLossPending* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataInstanceLossPending, ctx);
+}
+
+void cleanup(const XrEventDataInstanceLossPending* s) {
+    cleanup_fields(s, fields_XrEventDataInstanceLossPending);
+}
+
+constexpr FieldDescriptor fields_XrEventDataInteractionProfileChanged[] = {
+    FIELD_VALUE(XrEventDataInteractionProfileChanged, type),
+    FIELD_XR(XrEventDataInteractionProfileChanged, next),
+    FIELD_VALUE(XrEventDataInteractionProfileChanged, session),
+};
+
+void serialize(const XrEventDataInteractionProfileChanged* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataInteractionProfileChanged, ctx);
+}
+
+void deserialize(XrEventDataInteractionProfileChanged* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataInteractionProfileChanged, ctx);
+}
+
+void cleanup(const XrEventDataInteractionProfileChanged* s) {
+    cleanup_fields(s, fields_XrEventDataInteractionProfileChanged);
+}
+
+constexpr FieldDescriptor fields_XrEventDataReferenceSpaceChangePending[] = {
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, type),
+    FIELD_XR(XrEventDataReferenceSpaceChangePending, next),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, session),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, referenceSpaceType),
+    FIELD_TIME(XrEventDataReferenceSpaceChangePending, changeTime),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, poseValid),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, poseInPreviousSpace),
+};
+
+void serialize(const XrEventDataReferenceSpaceChangePending* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataReferenceSpaceChangePending, ctx);
+}
+
+void deserialize(XrEventDataReferenceSpaceChangePending* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataReferenceSpaceChangePending, ctx);
+}
+
+void cleanup(const XrEventDataReferenceSpaceChangePending* s) {
+    cleanup_fields(s, fields_XrEventDataReferenceSpaceChangePending);
+}
+
+constexpr FieldDescriptor fields_XrEventDataSessionStateChanged[] = {
+    FIELD_VALUE(XrEventDataSessionStateChanged, type),
+    FIELD_XR(XrEventDataSessionStateChanged, next),
+    FIELD_VALUE(XrEventDataSessionStateChanged, session),
+    FIELD_VALUE(XrEventDataSessionStateChanged, state),
+    FIELD_TIME(XrEventDataSessionStateChanged, time),
+};
+
+void serialize(const XrEventDataSessionStateChanged* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrEventDataSessionStateChanged, ctx);
+}
+
+void deserialize(XrEventDataSessionStateChanged* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrEventDataSessionStateChanged, ctx);
+}
+
+void cleanup(const XrEventDataSessionStateChanged* s) {
+    cleanup_fields(s, fields_XrEventDataSessionStateChanged);
+}
+
+constexpr FieldDescriptor fields_XrExtensionProperties[] = {
+    FIELD_VALUE(XrExtensionProperties, type),
+    FIELD_XR(XrExtensionProperties, next),
+    FIELD_STRING_ARRAY(XrExtensionProperties, extensionName),
+    FIELD_VALUE(XrExtensionProperties, extensionVersion),
+};
+
+void serialize(const XrExtensionProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExtensionProperties, ctx);
+}
+
+void deserialize(XrExtensionProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExtensionProperties, ctx);
+}
+
+void cleanup(const XrExtensionProperties* s) {
+    cleanup_fields(s, fields_XrExtensionProperties);
+}
+
+constexpr FieldDescriptor fields_XrExtent2Df[] = {
+    FIELD_VALUE(XrExtent2Df, width),
+    FIELD_VALUE(XrExtent2Df, height),
+};
+
+void serialize(const XrExtent2Df* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExtent2Df, ctx);
+}
+
+void deserialize(XrExtent2Df* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExtent2Df, ctx);
+}
+
+void cleanup(const XrExtent2Df* s) {
+    cleanup_fields(s, fields_XrExtent2Df);
+}
+
+constexpr FieldDescriptor fields_XrExtent2Di[] = {
+    FIELD_VALUE(XrExtent2Di, width),
+    FIELD_VALUE(XrExtent2Di, height),
+};
+
+void serialize(const XrExtent2Di* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExtent2Di, ctx);
+}
+
+void deserialize(XrExtent2Di* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExtent2Di, ctx);
+}
+
+void cleanup(const XrExtent2Di* s) {
+    cleanup_fields(s, fields_XrExtent2Di);
+}
+
+constexpr FieldDescriptor fields_XrExtent3Df[] = {
+    FIELD_VALUE(XrExtent3Df, width),
+    FIELD_VALUE(XrExtent3Df, height),
+    FIELD_VALUE(XrExtent3Df, depth),
+};
+
+void serialize(const XrExtent3Df* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrExtent3Df, ctx);
+}
+
+void deserialize(XrExtent3Df* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrExtent3Df, ctx);
+}
+
+void cleanup(const XrExtent3Df* s) {
+    cleanup_fields(s, fields_XrExtent3Df);
+}
+
+constexpr FieldDescriptor fields_XrFovf[] = {
+    FIELD_VALUE(XrFovf, angleLeft),
+    FIELD_VALUE(XrFovf, angleRight),
+    FIELD_VALUE(XrFovf, angleUp),
+    FIELD_VALUE(XrFovf, angleDown),
+};
+
+void serialize(const XrFovf* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFovf, ctx);
+}
+
+void deserialize(XrFovf* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFovf, ctx);
+}
+
+void cleanup(const XrFovf* s) {
+    cleanup_fields(s, fields_XrFovf);
+}
+
+constexpr FieldDescriptor fields_XrFrameBeginInfo[] = {
+    FIELD_VALUE(XrFrameBeginInfo, type),
+    FIELD_XR(XrFrameBeginInfo, next),
+};
+
+void serialize(const XrFrameBeginInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameBeginInfo, ctx);
+}
+
+void deserialize(XrFrameBeginInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameBeginInfo, ctx);
+}
+
+void cleanup(const XrFrameBeginInfo* s) {
+    cleanup_fields(s, fields_XrFrameBeginInfo);
+}
+
+constexpr FieldDescriptor fields_XrFrameState[] = {
+    FIELD_VALUE(XrFrameState, type),
+    FIELD_XR(XrFrameState, next),
+    FIELD_TIME(XrFrameState, predictedDisplayTime),
+    FIELD_VALUE(XrFrameState, predictedDisplayPeriod),
+    FIELD_VALUE(XrFrameState, shouldRender),
+};
+
+void serialize(const XrFrameState* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameState, ctx);
+}
+
+void deserialize(XrFrameState* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameState, ctx);
+}
+
+void cleanup(const XrFrameState* s) {
+    cleanup_fields(s, fields_XrFrameState);
+}
+
+constexpr FieldDescriptor fields_XrFrameWaitInfo[] = {
+    FIELD_VALUE(XrFrameWaitInfo, type),
+    FIELD_XR(XrFrameWaitInfo, next),
+};
+
+void serialize(const XrFrameWaitInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrameWaitInfo, ctx);
+}
+
+void deserialize(XrFrameWaitInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrameWaitInfo, ctx);
+}
+
+void cleanup(const XrFrameWaitInfo* s) {
+    cleanup_fields(s, fields_XrFrameWaitInfo);
+}
+
+constexpr FieldDescriptor fields_XrFrustumf[] = {
+    FIELD_VALUE(XrFrustumf, pose),
+    FIELD_VALUE(XrFrustumf, fov),
+    FIELD_VALUE(XrFrustumf, nearZ),
+    FIELD_VALUE(XrFrustumf, farZ),
+};
+
+void serialize(const XrFrustumf* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrFrustumf, ctx);
+}
+
+void deserialize(XrFrustumf* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrFrustumf, ctx);
+}
+
+void cleanup(const XrFrustumf* s) {
+    cleanup_fields(s, fields_XrFrustumf);
+}
+
+constexpr FieldDescriptor fields_XrHapticActionInfo[] = {
+    FIELD_VALUE(XrHapticActionInfo, type),
+    FIELD_XR(XrHapticActionInfo, next),
+    FIELD_VALUE(XrHapticActionInfo, action),
+    FIELD_VALUE(XrHapticActionInfo, subactionPath),
+};
+
+void serialize(const XrHapticActionInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHapticActionInfo, ctx);
+}
+
+void deserialize(XrHapticActionInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticActionInfo, ctx);
+}
+
+void cleanup(const XrHapticActionInfo* s) {
+    cleanup_fields(s, fields_XrHapticActionInfo);
+}
+
+constexpr FieldDescriptor fields_XrHapticBaseHeader[] = {
+    FIELD_VALUE(XrHapticBaseHeader, type),
+    FIELD_XR(XrHapticBaseHeader, next),
+};
+
+void serialize(const XrHapticBaseHeader* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrHapticBaseHeader* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticBaseHeader, ctx);
+}
+
+void cleanup(const XrHapticBaseHeader* s) {
+    cleanup_fields(s, fields_XrHapticBaseHeader);
+}
+
+constexpr FieldDescriptor fields_XrHapticVibration[] = {
+    FIELD_VALUE(XrHapticVibration, type),
+    FIELD_XR(XrHapticVibration, next),
+    FIELD_VALUE(XrHapticVibration, duration),
+    FIELD_VALUE(XrHapticVibration, frequency),
+    FIELD_VALUE(XrHapticVibration, amplitude),
+};
+
+void serialize(const XrHapticVibration* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrHapticVibration, ctx);
+}
+
+void deserialize(XrHapticVibration* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrHapticVibration, ctx);
+}
+
+void cleanup(const XrHapticVibration* s) {
+    cleanup_fields(s, fields_XrHapticVibration);
+}
+
+constexpr FieldDescriptor fields_XrInputSourceLocalizedNameGetInfo[] = {
+    FIELD_VALUE(XrInputSourceLocalizedNameGetInfo, type),
+    FIELD_XR(XrInputSourceLocalizedNameGetInfo, next),
+    FIELD_VALUE(XrInputSourceLocalizedNameGetInfo, sourcePath),
+    FIELD_VALUE(XrInputSourceLocalizedNameGetInfo, whichComponents),
+};
+
+void serialize(const XrInputSourceLocalizedNameGetInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInputSourceLocalizedNameGetInfo, ctx);
+}
+
+void deserialize(XrInputSourceLocalizedNameGetInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInputSourceLocalizedNameGetInfo, ctx);
+}
+
+void cleanup(const XrInputSourceLocalizedNameGetInfo* s) {
+    cleanup_fields(s, fields_XrInputSourceLocalizedNameGetInfo);
+}
+
+constexpr FieldDescriptor fields_XrInstanceProperties[] = {
+    FIELD_VALUE(XrInstanceProperties, type),
+    FIELD_XR(XrInstanceProperties, next),
+    FIELD_VALUE(XrInstanceProperties, runtimeVersion),
+    FIELD_STRING_ARRAY(XrInstanceProperties, runtimeName),
+};
+
+void serialize(const XrInstanceProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInstanceProperties, ctx);
+}
+
+void deserialize(XrInstanceProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInstanceProperties, ctx);
+}
+
+void cleanup(const XrInstanceProperties* s) {
+    cleanup_fields(s, fields_XrInstanceProperties);
+}
+
+constexpr FieldDescriptor fields_XrInteractionProfileState[] = {
+    FIELD_VALUE(XrInteractionProfileState, type),
+    FIELD_XR(XrInteractionProfileState, next),
+    FIELD_VALUE(XrInteractionProfileState, interactionProfile),
+};
+
+void serialize(const XrInteractionProfileState* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInteractionProfileState, ctx);
+}
+
+void deserialize(XrInteractionProfileState* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInteractionProfileState, ctx);
+}
+
+void cleanup(const XrInteractionProfileState* s) {
+    cleanup_fields(s, fields_XrInteractionProfileState);
+}
+
+constexpr FieldDescriptor fields_XrInteractionProfileSuggestedBinding[] = {
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, type),
+    FIELD_XR(XrInteractionProfileSuggestedBinding, next),
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, interactionProfile),
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, countSuggestedBindings),
+    FIELD_PTR(XrInteractionProfileSuggestedBinding, suggestedBindings, countSuggestedBindings),
+};
+
+void serialize(const XrInteractionProfileSuggestedBinding* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrInteractionProfileSuggestedBinding, ctx);
+}
+
+void deserialize(XrInteractionProfileSuggestedBinding* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrInteractionProfileSuggestedBinding, ctx);
+}
+
+void cleanup(const XrInteractionProfileSuggestedBinding* s) {
+    cleanup_fields(s, fields_XrInteractionProfileSuggestedBinding);
+}
+
+constexpr FieldDescriptor fields_XrOffset2Df[] = {
+    FIELD_VALUE(XrOffset2Df, x),
+    FIELD_VALUE(XrOffset2Df, y),
+};
+
+void serialize(const XrOffset2Df* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrOffset2Df, ctx);
+}
+
+void deserialize(XrOffset2Df* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrOffset2Df, ctx);
+}
+
+void cleanup(const XrOffset2Df* s) {
+    cleanup_fields(s, fields_XrOffset2Df);
+}
+
+constexpr FieldDescriptor fields_XrOffset2Di[] = {
+    FIELD_VALUE(XrOffset2Di, x),
+    FIELD_VALUE(XrOffset2Di, y),
+};
+
+void serialize(const XrOffset2Di* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrOffset2Di, ctx);
+}
+
+void deserialize(XrOffset2Di* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrOffset2Di, ctx);
+}
+
+void cleanup(const XrOffset2Di* s) {
+    cleanup_fields(s, fields_XrOffset2Di);
+}
+
+constexpr FieldDescriptor fields_XrPosef[] = {
+    FIELD_VALUE(XrPosef, orientation),
+    FIELD_VALUE(XrPosef, position),
+};
+
+void serialize(const XrPosef* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrPosef, ctx);
+}
+
+void deserialize(XrPosef* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrPosef, ctx);
+}
+
+void cleanup(const XrPosef* s) {
+    cleanup_fields(s, fields_XrPosef);
+}
+
+constexpr FieldDescriptor fields_XrQuaternionf[] = {
+    FIELD_VALUE(XrQuaternionf, x),
+    FIELD_VALUE(XrQuaternionf, y),
+    FIELD_VALUE(XrQuaternionf, z),
+    FIELD_VALUE(XrQuaternionf, w),
+};
+
+void serialize(const XrQuaternionf* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrQuaternionf, ctx);
+}
+
+void deserialize(XrQuaternionf* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrQuaternionf, ctx);
+}
+
+void cleanup(const XrQuaternionf* s) {
+    cleanup_fields(s, fields_XrQuaternionf);
+}
+
+constexpr FieldDescriptor fields_XrRect2Df[] = {
+    FIELD_VALUE(XrRect2Df, offset),
+    FIELD_VALUE(XrRect2Df, extent),
+};
+
+void serialize(const XrRect2Df* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRect2Df, ctx);
+}
+
+void deserialize(XrRect2Df* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRect2Df, ctx);
+}
+
+void cleanup(const XrRect2Df* s) {
+    cleanup_fields(s, fields_XrRect2Df);
+}
+
+constexpr FieldDescriptor fields_XrRect2Di[] = {
+    FIELD_VALUE(XrRect2Di, offset),
+    FIELD_VALUE(XrRect2Di, extent),
+};
+
+void serialize(const XrRect2Di* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrRect2Di, ctx);
+}
+
+void deserialize(XrRect2Di* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrRect2Di, ctx);
+}
+
+void cleanup(const XrRect2Di* s) {
+    cleanup_fields(s, fields_XrRect2Di);
+}
+
+constexpr FieldDescriptor fields_XrReferenceSpaceCreateInfo[] = {
+    FIELD_VALUE(XrReferenceSpaceCreateInfo, type),
+    FIELD_XR(XrReferenceSpaceCreateInfo, next),
+    FIELD_VALUE(XrReferenceSpaceCreateInfo, referenceSpaceType),
+    FIELD_VALUE(XrReferenceSpaceCreateInfo, poseInReferenceSpace),
+};
+
+void serialize(const XrReferenceSpaceCreateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrReferenceSpaceCreateInfo, ctx);
+}
+
+void deserialize(XrReferenceSpaceCreateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrReferenceSpaceCreateInfo, ctx);
+}
+
+void cleanup(const XrReferenceSpaceCreateInfo* s) {
+    cleanup_fields(s, fields_XrReferenceSpaceCreateInfo);
+}
+
+constexpr FieldDescriptor fields_XrSessionActionSetsAttachInfo[] = {
+    FIELD_VALUE(XrSessionActionSetsAttachInfo, type),
+    FIELD_XR(XrSessionActionSetsAttachInfo, next),
+    FIELD_VALUE(XrSessionActionSetsAttachInfo, countActionSets),
+    FIELD_PTR(XrSessionActionSetsAttachInfo, actionSets, countActionSets),
+};
+
+void serialize(const XrSessionActionSetsAttachInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSessionActionSetsAttachInfo, ctx);
+}
+
+void deserialize(XrSessionActionSetsAttachInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSessionActionSetsAttachInfo, ctx);
+}
+
+void cleanup(const XrSessionActionSetsAttachInfo* s) {
+    cleanup_fields(s, fields_XrSessionActionSetsAttachInfo);
+}
+
+constexpr FieldDescriptor fields_XrSessionBeginInfo[] = {
+    FIELD_VALUE(XrSessionBeginInfo, type),
+    FIELD_XR(XrSessionBeginInfo, next),
+    FIELD_VALUE(XrSessionBeginInfo, primaryViewConfigurationType),
+};
+
+void serialize(const XrSessionBeginInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSessionBeginInfo, ctx);
+}
+
+void deserialize(XrSessionBeginInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSessionBeginInfo, ctx);
+}
+
+void cleanup(const XrSessionBeginInfo* s) {
+    cleanup_fields(s, fields_XrSessionBeginInfo);
+}
+
+constexpr FieldDescriptor fields_XrSessionCreateInfo[] = {
+    FIELD_VALUE(XrSessionCreateInfo, type),
+    FIELD_XR(XrSessionCreateInfo, next),
+    FIELD_VALUE(XrSessionCreateInfo, createFlags),
+    FIELD_VALUE(XrSessionCreateInfo, systemId),
+};
+
+void serialize(const XrSessionCreateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSessionCreateInfo, ctx);
+}
+
+void deserialize(XrSessionCreateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSessionCreateInfo, ctx);
+}
+
+void cleanup(const XrSessionCreateInfo* s) {
+    cleanup_fields(s, fields_XrSessionCreateInfo);
+}
+
+constexpr FieldDescriptor fields_XrSpaceLocation[] = {
+    FIELD_VALUE(XrSpaceLocation, type),
+    FIELD_XR(XrSpaceLocation, next),
+    FIELD_VALUE(XrSpaceLocation, locationFlags),
+    FIELD_VALUE(XrSpaceLocation, pose),
+};
+
+void serialize(const XrSpaceLocation* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceLocation, ctx);
+}
+
+void deserialize(XrSpaceLocation* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceLocation, ctx);
+}
+
+void cleanup(const XrSpaceLocation* s) {
+    cleanup_fields(s, fields_XrSpaceLocation);
+}
+
+constexpr FieldDescriptor fields_XrSpaceLocationData[] = {
+    FIELD_VALUE(XrSpaceLocationData, locationFlags),
+    FIELD_VALUE(XrSpaceLocationData, pose),
+};
+
+void serialize(const XrSpaceLocationData* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceLocationData, ctx);
+}
+
+void deserialize(XrSpaceLocationData* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceLocationData, ctx);
+}
+
+void cleanup(const XrSpaceLocationData* s) {
+    cleanup_fields(s, fields_XrSpaceLocationData);
+}
+
+constexpr FieldDescriptor fields_XrSpaceLocations[] = {
+    FIELD_VALUE(XrSpaceLocations, type),
+    FIELD_XR(XrSpaceLocations, next),
+    FIELD_VALUE(XrSpaceLocations, locationCount),
+    FIELD_PTR(XrSpaceLocations, locations, locationCount),
+};
+
+void serialize(const XrSpaceLocations* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceLocations, ctx);
+}
+
+void deserialize(XrSpaceLocations* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceLocations, ctx);
+}
+
+void cleanup(const XrSpaceLocations* s) {
+    cleanup_fields(s, fields_XrSpaceLocations);
+}
+
+constexpr FieldDescriptor fields_XrSpaceVelocities[] = {
+    FIELD_VALUE(XrSpaceVelocities, type),
+    FIELD_XR(XrSpaceVelocities, next),
+    FIELD_VALUE(XrSpaceVelocities, velocityCount),
+    FIELD_PTR(XrSpaceVelocities, velocities, velocityCount),
+};
+
+void serialize(const XrSpaceVelocities* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceVelocities, ctx);
+}
+
+void deserialize(XrSpaceVelocities* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceVelocities, ctx);
+}
+
+void cleanup(const XrSpaceVelocities* s) {
+    cleanup_fields(s, fields_XrSpaceVelocities);
+}
+
+constexpr FieldDescriptor fields_XrSpaceVelocity[] = {
+    FIELD_VALUE(XrSpaceVelocity, type),
+    FIELD_XR(XrSpaceVelocity, next),
+    FIELD_VALUE(XrSpaceVelocity, velocityFlags),
+    FIELD_VALUE(XrSpaceVelocity, linearVelocity),
+    FIELD_VALUE(XrSpaceVelocity, angularVelocity),
+};
+
+void serialize(const XrSpaceVelocity* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceVelocity, ctx);
+}
+
+void deserialize(XrSpaceVelocity* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceVelocity, ctx);
+}
+
+void cleanup(const XrSpaceVelocity* s) {
+    cleanup_fields(s, fields_XrSpaceVelocity);
+}
+
+constexpr FieldDescriptor fields_XrSpaceVelocityData[] = {
+    FIELD_VALUE(XrSpaceVelocityData, velocityFlags),
+    FIELD_VALUE(XrSpaceVelocityData, linearVelocity),
+    FIELD_VALUE(XrSpaceVelocityData, angularVelocity),
+};
+
+void serialize(const XrSpaceVelocityData* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpaceVelocityData, ctx);
+}
+
+void deserialize(XrSpaceVelocityData* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpaceVelocityData, ctx);
+}
+
+void cleanup(const XrSpaceVelocityData* s) {
+    cleanup_fields(s, fields_XrSpaceVelocityData);
+}
+
+constexpr FieldDescriptor fields_XrSpacesLocateInfo[] = {
+    FIELD_VALUE(XrSpacesLocateInfo, type),
+    FIELD_XR(XrSpacesLocateInfo, next),
+    FIELD_VALUE(XrSpacesLocateInfo, baseSpace),
+    FIELD_TIME(XrSpacesLocateInfo, time),
+    FIELD_VALUE(XrSpacesLocateInfo, spaceCount),
+    FIELD_PTR(XrSpacesLocateInfo, spaces, spaceCount),
+};
+
+void serialize(const XrSpacesLocateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpacesLocateInfo, ctx);
+}
+
+void deserialize(XrSpacesLocateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpacesLocateInfo, ctx);
+}
+
+void cleanup(const XrSpacesLocateInfo* s) {
+    cleanup_fields(s, fields_XrSpacesLocateInfo);
+}
+
+constexpr FieldDescriptor fields_XrSpheref[] = {
+    FIELD_VALUE(XrSpheref, center),
+    FIELD_VALUE(XrSpheref, radius),
+};
+
+void serialize(const XrSpheref* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSpheref, ctx);
+}
+
+void deserialize(XrSpheref* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSpheref, ctx);
+}
+
+void cleanup(const XrSpheref* s) {
+    cleanup_fields(s, fields_XrSpheref);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainCreateInfo[] = {
+    FIELD_VALUE(XrSwapchainCreateInfo, type),
+    FIELD_XR(XrSwapchainCreateInfo, next),
+    FIELD_VALUE(XrSwapchainCreateInfo, createFlags),
+    FIELD_VALUE(XrSwapchainCreateInfo, usageFlags),
+    FIELD_VALUE(XrSwapchainCreateInfo, format),
+    FIELD_VALUE(XrSwapchainCreateInfo, sampleCount),
+    FIELD_VALUE(XrSwapchainCreateInfo, width),
+    FIELD_VALUE(XrSwapchainCreateInfo, height),
+    FIELD_VALUE(XrSwapchainCreateInfo, faceCount),
+    FIELD_VALUE(XrSwapchainCreateInfo, arraySize),
+    FIELD_VALUE(XrSwapchainCreateInfo, mipCount),
+};
+
+void serialize(const XrSwapchainCreateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainCreateInfo, ctx);
+}
+
+void deserialize(XrSwapchainCreateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainCreateInfo, ctx);
+}
+
+void cleanup(const XrSwapchainCreateInfo* s) {
+    cleanup_fields(s, fields_XrSwapchainCreateInfo);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageAcquireInfo[] = {
+    FIELD_VALUE(XrSwapchainImageAcquireInfo, type),
+    FIELD_XR(XrSwapchainImageAcquireInfo, next),
+};
+
+void serialize(const XrSwapchainImageAcquireInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageAcquireInfo, ctx);
+}
+
+void deserialize(XrSwapchainImageAcquireInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageAcquireInfo, ctx);
+}
+
+void cleanup(const XrSwapchainImageAcquireInfo* s) {
+    cleanup_fields(s, fields_XrSwapchainImageAcquireInfo);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageBaseHeader[] = {
+    FIELD_VALUE(XrSwapchainImageBaseHeader, type),
+    FIELD_XR(XrSwapchainImageBaseHeader, next),
+};
+
+void serialize(const XrSwapchainImageBaseHeader* s, SerializeContext& ctx) {
+    serialize_xr(s, ctx);
+}
+
+void deserialize(XrSwapchainImageBaseHeader* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageBaseHeader, ctx);
+}
+
+void cleanup(const XrSwapchainImageBaseHeader* s) {
+    cleanup_fields(s, fields_XrSwapchainImageBaseHeader);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageReleaseInfo[] = {
+    FIELD_VALUE(XrSwapchainImageReleaseInfo, type),
+    FIELD_XR(XrSwapchainImageReleaseInfo, next),
+};
+
+void serialize(const XrSwapchainImageReleaseInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageReleaseInfo, ctx);
+}
+
+void deserialize(XrSwapchainImageReleaseInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageReleaseInfo, ctx);
+}
+
+void cleanup(const XrSwapchainImageReleaseInfo* s) {
+    cleanup_fields(s, fields_XrSwapchainImageReleaseInfo);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainImageWaitInfo[] = {
+    FIELD_VALUE(XrSwapchainImageWaitInfo, type),
+    FIELD_XR(XrSwapchainImageWaitInfo, next),
+    FIELD_VALUE(XrSwapchainImageWaitInfo, timeout),
+};
+
+void serialize(const XrSwapchainImageWaitInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainImageWaitInfo, ctx);
+}
+
+void deserialize(XrSwapchainImageWaitInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainImageWaitInfo, ctx);
+}
+
+void cleanup(const XrSwapchainImageWaitInfo* s) {
+    cleanup_fields(s, fields_XrSwapchainImageWaitInfo);
+}
+
+constexpr FieldDescriptor fields_XrSwapchainSubImage[] = {
+    FIELD_VALUE(XrSwapchainSubImage, swapchain),
+    FIELD_VALUE(XrSwapchainSubImage, imageRect),
+    FIELD_VALUE(XrSwapchainSubImage, imageArrayIndex),
+};
+
+void serialize(const XrSwapchainSubImage* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSwapchainSubImage, ctx);
+}
+
+void deserialize(XrSwapchainSubImage* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSwapchainSubImage, ctx);
+}
+
+void cleanup(const XrSwapchainSubImage* s) {
+    cleanup_fields(s, fields_XrSwapchainSubImage);
+}
+
+constexpr FieldDescriptor fields_XrSystemGetInfo[] = {
+    FIELD_VALUE(XrSystemGetInfo, type),
+    FIELD_XR(XrSystemGetInfo, next),
+    FIELD_VALUE(XrSystemGetInfo, formFactor),
+};
+
+void serialize(const XrSystemGetInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemGetInfo, ctx);
+}
+
+void deserialize(XrSystemGetInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemGetInfo, ctx);
+}
+
+void cleanup(const XrSystemGetInfo* s) {
+    cleanup_fields(s, fields_XrSystemGetInfo);
+}
+
+constexpr FieldDescriptor fields_XrSystemGraphicsProperties[] = {
+    FIELD_VALUE(XrSystemGraphicsProperties, maxSwapchainImageHeight),
+    FIELD_VALUE(XrSystemGraphicsProperties, maxSwapchainImageWidth),
+    FIELD_VALUE(XrSystemGraphicsProperties, maxLayerCount),
+};
+
+void serialize(const XrSystemGraphicsProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemGraphicsProperties, ctx);
+}
+
+void deserialize(XrSystemGraphicsProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemGraphicsProperties, ctx);
+}
+
+void cleanup(const XrSystemGraphicsProperties* s) {
+    cleanup_fields(s, fields_XrSystemGraphicsProperties);
+}
+
+constexpr FieldDescriptor fields_XrSystemProperties[] = {
+    FIELD_VALUE(XrSystemProperties, type),
+    FIELD_XR(XrSystemProperties, next),
+    FIELD_VALUE(XrSystemProperties, systemId),
+    FIELD_VALUE(XrSystemProperties, vendorId),
+    FIELD_STRING_ARRAY(XrSystemProperties, systemName),
+    FIELD_VALUE(XrSystemProperties, graphicsProperties),
+    FIELD_VALUE(XrSystemProperties, trackingProperties),
+};
+
+void serialize(const XrSystemProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemProperties, ctx);
+}
+
+void deserialize(XrSystemProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemProperties, ctx);
+}
+
+void cleanup(const XrSystemProperties* s) {
+    cleanup_fields(s, fields_XrSystemProperties);
+}
+
+constexpr FieldDescriptor fields_XrSystemTrackingProperties[] = {
+    FIELD_VALUE(XrSystemTrackingProperties, orientationTracking),
+    FIELD_VALUE(XrSystemTrackingProperties, positionTracking),
+};
+
+void serialize(const XrSystemTrackingProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrSystemTrackingProperties, ctx);
+}
+
+void deserialize(XrSystemTrackingProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrSystemTrackingProperties, ctx);
+}
+
+void cleanup(const XrSystemTrackingProperties* s) {
+    cleanup_fields(s, fields_XrSystemTrackingProperties);
+}
+
+constexpr FieldDescriptor fields_XrUuid[] = {
+    FIELD_ARRAY(XrUuid, data),
+};
+
+void serialize(const XrUuid* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrUuid, ctx);
+}
+
+void deserialize(XrUuid* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrUuid, ctx);
+}
+
+void cleanup(const XrUuid* s) {
+    cleanup_fields(s, fields_XrUuid);
+}
+
+constexpr FieldDescriptor fields_XrVector2f[] = {
+    FIELD_VALUE(XrVector2f, x),
+    FIELD_VALUE(XrVector2f, y),
+};
+
+void serialize(const XrVector2f* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVector2f, ctx);
+}
+
+void deserialize(XrVector2f* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVector2f, ctx);
+}
+
+void cleanup(const XrVector2f* s) {
+    cleanup_fields(s, fields_XrVector2f);
+}
+
+constexpr FieldDescriptor fields_XrVector3f[] = {
+    FIELD_VALUE(XrVector3f, x),
+    FIELD_VALUE(XrVector3f, y),
+    FIELD_VALUE(XrVector3f, z),
+};
+
+void serialize(const XrVector3f* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVector3f, ctx);
+}
+
+void deserialize(XrVector3f* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVector3f, ctx);
+}
+
+void cleanup(const XrVector3f* s) {
+    cleanup_fields(s, fields_XrVector3f);
+}
+
+constexpr FieldDescriptor fields_XrVector4f[] = {
+    FIELD_VALUE(XrVector4f, x),
+    FIELD_VALUE(XrVector4f, y),
+    FIELD_VALUE(XrVector4f, z),
+    FIELD_VALUE(XrVector4f, w),
+};
+
+void serialize(const XrVector4f* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrVector4f, ctx);
+}
+
+void deserialize(XrVector4f* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrVector4f, ctx);
+}
+
+void cleanup(const XrVector4f* s) {
+    cleanup_fields(s, fields_XrVector4f);
+}
+
+constexpr FieldDescriptor fields_XrView[] = {
+    FIELD_VALUE(XrView, type),
+    FIELD_XR(XrView, next),
+    FIELD_VALUE(XrView, pose),
+    FIELD_VALUE(XrView, fov),
+};
+
+void serialize(const XrView* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrView, ctx);
+}
+
+void deserialize(XrView* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrView, ctx);
+}
+
+void cleanup(const XrView* s) {
+    cleanup_fields(s, fields_XrView);
+}
+
+constexpr FieldDescriptor fields_XrViewConfigurationProperties[] = {
+    FIELD_VALUE(XrViewConfigurationProperties, type),
+    FIELD_XR(XrViewConfigurationProperties, next),
+    FIELD_VALUE(XrViewConfigurationProperties, viewConfigurationType),
+    FIELD_VALUE(XrViewConfigurationProperties, fovMutable),
+};
+
+void serialize(const XrViewConfigurationProperties* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewConfigurationProperties, ctx);
+}
+
+void deserialize(XrViewConfigurationProperties* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewConfigurationProperties, ctx);
+}
+
+void cleanup(const XrViewConfigurationProperties* s) {
+    cleanup_fields(s, fields_XrViewConfigurationProperties);
+}
+
+constexpr FieldDescriptor fields_XrViewConfigurationView[] = {
+    FIELD_VALUE(XrViewConfigurationView, type),
+    FIELD_XR(XrViewConfigurationView, next),
+    FIELD_VALUE(XrViewConfigurationView, recommendedImageRectWidth),
+    FIELD_VALUE(XrViewConfigurationView, maxImageRectWidth),
+    FIELD_VALUE(XrViewConfigurationView, recommendedImageRectHeight),
+    FIELD_VALUE(XrViewConfigurationView, maxImageRectHeight),
+    FIELD_VALUE(XrViewConfigurationView, recommendedSwapchainSampleCount),
+    FIELD_VALUE(XrViewConfigurationView, maxSwapchainSampleCount),
+};
+
+void serialize(const XrViewConfigurationView* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewConfigurationView, ctx);
+}
+
+void deserialize(XrViewConfigurationView* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewConfigurationView, ctx);
+}
+
+void cleanup(const XrViewConfigurationView* s) {
+    cleanup_fields(s, fields_XrViewConfigurationView);
+}
+
+constexpr FieldDescriptor fields_XrViewLocateInfo[] = {
+    FIELD_VALUE(XrViewLocateInfo, type),
+    FIELD_XR(XrViewLocateInfo, next),
+    FIELD_VALUE(XrViewLocateInfo, viewConfigurationType),
+    FIELD_TIME(XrViewLocateInfo, displayTime),
+    FIELD_VALUE(XrViewLocateInfo, space),
+};
+
+void serialize(const XrViewLocateInfo* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewLocateInfo, ctx);
+}
+
+void deserialize(XrViewLocateInfo* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewLocateInfo, ctx);
+}
+
+void cleanup(const XrViewLocateInfo* s) {
+    cleanup_fields(s, fields_XrViewLocateInfo);
+}
+
+constexpr FieldDescriptor fields_XrViewState[] = {
+    FIELD_VALUE(XrViewState, type),
+    FIELD_XR(XrViewState, next),
+    FIELD_VALUE(XrViewState, viewStateFlags),
+};
+
+void serialize(const XrViewState* s, SerializeContext& ctx) {
+    serialize_fields(s, fields_XrViewState, ctx);
+}
+
+void deserialize(XrViewState* s, DeserializeContext& ctx) {
+    deserialize_fields(s, fields_XrViewState, ctx);
+}
+
+void cleanup(const XrViewState* s) {
+    cleanup_fields(s, fields_XrViewState);
+}
+
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
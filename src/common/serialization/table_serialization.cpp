@@ -0,0 +1,363 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "xrtransport/serialization/table_serialization.h"
+
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::uint8_t;
+using std::uint16_t;
+using std::uint32_t;
+using std::uint64_t;
+using std::int32_t;
+using std::int64_t;
+
+namespace xrtransport {
+
+static const uint8_t* field_ptr(const void* s, const FieldDescriptor& field) {
+    return static_cast<const uint8_t*>(s) + field.offset;
+}
+
+static uint8_t* field_ptr(void* s, const FieldDescriptor& field) {
+    return static_cast<uint8_t*>(s) + field.offset;
+}
+
+// value of a pointer member
+static const void* load_ptr(const uint8_t* member) {
+    const void* ptr{};
+    std::memcpy(&ptr, member, sizeof(ptr));
+    return ptr;
+}
+
+static void store_ptr(uint8_t* member, const void* ptr) {
+    std::memcpy(member, &ptr, sizeof(ptr));
+}
+
+// value of the len member of a PTR, QUANTIZABLE_PTR or XR_ARRAY field
+static std::size_t field_len(const void* s, const FieldDescriptor& field) {
+    const uint8_t* member = static_cast<const uint8_t*>(s) + field.len_offset;
+    switch (field.len_size) {
+        case 0:
+            return 1;
+        case sizeof(uint8_t):
+            return *member;
+        case sizeof(uint16_t): {
+            uint16_t len{};
+            std::memcpy(&len, member, sizeof(len));
+            return len;
+        }
+        case sizeof(uint32_t): {
+            uint32_t len{};
+            std::memcpy(&len, member, sizeof(len));
+            return len;
+        }
+        case sizeof(uint64_t): {
+            uint64_t len{};
+            std::memcpy(&len, member, sizeof(len));
+            return static_cast<std::size_t>(len);
+        }
+        default:
+            throw std::runtime_error("Unsupported len member size: " + std::to_string(field.len_size));
+    }
+}
+
+static void serialize_compact_value(const uint8_t* x, ValueKind value, SerializeContext& ctx) {
+    switch (value) {
+        case ValueKind::UINT32: {
+            uint32_t v{};
+            std::memcpy(&v, x, sizeof(v));
+            serialize_compact_uint(v, ctx);
+            break;
+        }
+        case ValueKind::ENUM: {
+            int32_t v{};
+            std::memcpy(&v, x, sizeof(v));
+            serialize_compact_enum(v, ctx);
+            break;
+        }
+        case ValueKind::STRUCT_TYPE: {
+            XrStructureType v{};
+            std::memcpy(&v, x, sizeof(v));
+            serialize_compact_struct_type(v, ctx);
+            break;
+        }
+        case ValueKind::HANDLE: {
+            std::uintptr_t v{};
+            std::memcpy(&v, x, sizeof(v));
+            serialize_compact_handle(v, ctx);
+            break;
+        }
+        default:
+            throw std::runtime_error("Value kind has no compact encoding");
+    }
+}
+
+static void deserialize_compact_value(uint8_t* x, ValueKind value, DeserializeContext& ctx) {
+    switch (value) {
+        case ValueKind::UINT32: {
+            uint64_t v = deserialize_compact_uint(ctx);
+            if (v > UINT32_MAX) {
+                throw std::runtime_error("Compact value out of range: " + std::to_string(v));
+            }
+            uint32_t narrowed = static_cast<uint32_t>(v);
+            std::memcpy(x, &narrowed, sizeof(narrowed));
+            break;
+        }
+        case ValueKind::ENUM: {
+            int32_t v = static_cast<int32_t>(deserialize_compact_enum(ctx));
+            std::memcpy(x, &v, sizeof(v));
+            break;
+        }
+        case ValueKind::STRUCT_TYPE: {
+            XrStructureType v = deserialize_compact_struct_type(ctx);
+            std::memcpy(x, &v, sizeof(v));
+            break;
+        }
+        case ValueKind::HANDLE: {
+            std::uintptr_t v = static_cast<std::uintptr_t>(deserialize_compact_handle(ctx));
+            std::memcpy(x, &v, sizeof(v));
+            break;
+        }
+        default:
+            throw std::runtime_error("Value kind has no compact encoding");
+    }
+}
+
+// Elements that are sent as their bytes: raw values, any value without compact encoding, and flat
+// structs, which have no padding, times or anything that could be interned
+static bool is_bulk(const FieldDescriptor& field, const SerializeContext& ctx) {
+    if (field.value == ValueKind::STRUCT) {
+        return (field.flags & FIELD_FLAT) && !ctx.handles && !ctx.strings;
+    }
+    return field.value == ValueKind::RAW || !ctx.handles;
+}
+
+static bool is_bulk(const FieldDescriptor& field, const DeserializeContext& ctx) {
+    if (field.value == ValueKind::STRUCT) {
+        return (field.flags & FIELD_FLAT) && !ctx.handles && !ctx.strings && !ctx.virtual_handles;
+    }
+    return field.value == ValueKind::RAW || !ctx.handles;
+}
+
+static void serialize_elements(const uint8_t* x, std::size_t count, const FieldDescriptor& field, SerializeContext& ctx) {
+    if (is_bulk(field, ctx)) {
+        asio::write(ctx.out, asio::buffer(x, field.size * count));
+        return;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        const uint8_t* element = x + field.size * i;
+        if (field.value == ValueKind::STRUCT) {
+            field.ops->serialize(element, ctx);
+        }
+        else {
+            serialize_compact_value(element, field.value, ctx);
+        }
+    }
+}
+
+static void deserialize_elements(uint8_t* x, std::size_t count, const FieldDescriptor& field, DeserializeContext& ctx) {
+    if (is_bulk(field, ctx)) {
+        asio::read(ctx.in, asio::buffer(x, field.size * count));
+        if (field.value == ValueKind::HANDLE && ctx.virtual_handles) {
+            for (std::size_t i = 0; i < count; i++) {
+                uint8_t* element = x + field.size * i;
+                std::uintptr_t v{};
+                std::memcpy(&v, element, sizeof(v));
+                v = static_cast<std::uintptr_t>(ctx.virtual_handles->resolve(uint64_t{v}));
+                std::memcpy(element, &v, sizeof(v));
+            }
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        uint8_t* element = x + field.size * i;
+        if (field.value == ValueKind::STRUCT) {
+            field.ops->deserialize(element, ctx);
+        }
+        else {
+            deserialize_compact_value(element, field.value, ctx);
+        }
+    }
+}
+
+static void cleanup_elements(const uint8_t* x, std::size_t count, const FieldDescriptor& field) {
+    if (field.value != ValueKind::STRUCT) {
+        return; // no-op for primitive types
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        field.ops->cleanup(x + field.size * i);
+    }
+}
+
+// matches deserialize_ptr
+static void deserialize_field_ptr(uint8_t* member, const FieldDescriptor& field, DeserializeContext& ctx) {
+    uint32_t len{};
+    deserialize(&len, ctx);
+    const void* current = load_ptr(member);
+    if (len) {
+        if (ctx.in_place) {
+            if (!current) {
+                throw std::runtime_error("Attempted to deserialize in-place into nullptr");
+            }
+            deserialize_elements(static_cast<uint8_t*>(const_cast<void*>(current)), len, field, ctx);
+            return;
+        }
+        if ((field.flags & FIELD_CONST) && (field.flags & FIELD_FLAT)) {
+            BorrowScope* scope = BorrowScope::active();
+            if (scope && !ctx.handles && !ctx.virtual_handles) {
+                if (const void* borrowed = scope->borrow(ctx.in, std::size_t{field.size} * len, field.alignment)) {
+                    store_ptr(member, borrowed);
+                    return;
+                }
+            }
+        }
+        uint8_t* data = static_cast<uint8_t*>(std::malloc(std::size_t{field.size} * len));
+        deserialize_elements(data, len, field, ctx);
+        store_ptr(member, data);
+    }
+    else {
+        if (ctx.in_place) {
+            if (current) {
+                throw std::runtime_error("Attempted to deserialize in-place nullptr but pointer is allocated");
+            }
+        }
+        else {
+            store_ptr(member, nullptr);
+        }
+    }
+}
+
+// matches cleanup_ptr
+static void free_unless_borrowed(const void* x) {
+    BorrowScope* scope = BorrowScope::active();
+    if (scope && scope->is_borrowed(x)) {
+        return; // points into the message
+    }
+    std::free(const_cast<void*>(x));
+}
+
+void serialize_fields(const void* s, const FieldDescriptor* fields, std::size_t field_count, SerializeContext& ctx) {
+    for (std::size_t i = 0; i < field_count; i++) {
+        const FieldDescriptor& field = fields[i];
+        const uint8_t* member = field_ptr(s, field);
+        switch (field.kind) {
+            case FieldKind::VALUE:
+            case FieldKind::ARRAY:
+                serialize_elements(member, field.count, field, ctx);
+                break;
+            case FieldKind::TIME:
+                serialize_time(reinterpret_cast<const XrTime*>(member), ctx);
+                break;
+            case FieldKind::STRING_ARRAY:
+                serialize_string_array(reinterpret_cast<const char*>(member), field.count, ctx);
+                break;
+            case FieldKind::STRING:
+                serialize_string(static_cast<const char*>(load_ptr(member)), ctx);
+                break;
+            case FieldKind::PTR: {
+                const uint8_t* x = static_cast<const uint8_t*>(load_ptr(member));
+                std::size_t len = field_len(s, field);
+                uint32_t marker = x != nullptr ? static_cast<uint32_t>(len) : 0;
+                serialize(&marker, ctx);
+                if (marker) {
+                    serialize_elements(x, len, field, ctx);
+                }
+                break;
+            }
+            case FieldKind::QUANTIZABLE_PTR:
+                field.quantized->serialize(load_ptr(member), field_len(s, field), field.quantized->extension_bit, ctx);
+                break;
+            case FieldKind::XR:
+                serialize_xr(static_cast<const XrBaseInStructure*>(load_ptr(member)), ctx);
+                break;
+            case FieldKind::XR_ARRAY:
+                serialize_xr_array(static_cast<const XrBaseInStructure*>(load_ptr(member)), field_len(s, field), ctx);
+                break;
+        }
+    }
+}
+
+void deserialize_fields(void* s, const FieldDescriptor* fields, std::size_t field_count, DeserializeContext& ctx) {
+    for (std::size_t i = 0; i < field_count; i++) {
+        const FieldDescriptor& field = fields[i];
+        uint8_t* member = field_ptr(s, field);
+        switch (field.kind) {
+            case FieldKind::VALUE:
+            case FieldKind::ARRAY:
+                deserialize_elements(member, field.count, field, ctx);
+                break;
+            case FieldKind::TIME:
+                deserialize_time(reinterpret_cast<XrTime*>(member), ctx);
+                break;
+            case FieldKind::STRING_ARRAY:
+                deserialize_string_array(reinterpret_cast<char*>(member), field.count, ctx);
+                break;
+            case FieldKind::STRING:
+                if (field.flags & FIELD_CONST) {
+                    deserialize_string(reinterpret_cast<const char**>(member), ctx);
+                }
+                else {
+                    deserialize_string(reinterpret_cast<char**>(member), ctx);
+                }
+                break;
+            case FieldKind::PTR:
+                deserialize_field_ptr(member, field, ctx);
+                break;
+            case FieldKind::QUANTIZABLE_PTR:
+                field.quantized->deserialize(member, ctx);
+                break;
+            case FieldKind::XR:
+                if (field.flags & FIELD_CONST) {
+                    deserialize_xr(reinterpret_cast<const XrBaseInStructure**>(member), ctx);
+                }
+                else {
+                    deserialize_xr(reinterpret_cast<XrBaseOutStructure**>(member), ctx);
+                }
+                break;
+            case FieldKind::XR_ARRAY:
+                deserialize_xr_array(reinterpret_cast<XrBaseOutStructure**>(member), ctx);
+                break;
+        }
+    }
+}
+
+void cleanup_fields(const void* s, const FieldDescriptor* fields, std::size_t field_count) {
+    for (std::size_t i = 0; i < field_count; i++) {
+        const FieldDescriptor& field = fields[i];
+        const uint8_t* member = field_ptr(s, field);
+        switch (field.kind) {
+            case FieldKind::VALUE:
+            case FieldKind::ARRAY:
+                cleanup_elements(member, field.count, field);
+                break;
+            case FieldKind::TIME:
+            case FieldKind::STRING_ARRAY:
+                break;
+            case FieldKind::STRING:
+            case FieldKind::PTR:
+            case FieldKind::QUANTIZABLE_PTR: {
+                const uint8_t* x = static_cast<const uint8_t*>(load_ptr(member));
+                if (!x) {
+                    break; // do not clean up null pointer
+                }
+                if (field.kind != FieldKind::STRING) {
+                    cleanup_elements(x, field_len(s, field), field);
+                }
+                free_unless_borrowed(x);
+                break;
+            }
+            case FieldKind::XR:
+                cleanup_xr(static_cast<const XrBaseOutStructure*>(load_ptr(member)));
+                break;
+            case FieldKind::XR_ARRAY:
+                cleanup_xr_array(static_cast<const XrBaseOutStructure*>(load_ptr(member)), field_len(s, field));
+                break;
+        }
+    }
+}
+
+} // namespace xrtransport
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "xrtransport/serialization/virtual_handles.h"
+#include "xrtransport/serialization/error.h"
+
+#include <string>
+
+using std::uint64_t;
+
+namespace xrtransport {
+
+static constexpr uint64_t VIRTUAL_HANDLE_INDEX_MASK = ~VIRTUAL_HANDLE_TAG_MASK;
+
+uint64_t VirtualHandleAllocator::allocate() {
+    if (next > VIRTUAL_HANDLE_INDEX_MASK) {
+        throw VirtualHandleException("out of virtual handles");
+    }
+    return VIRTUAL_HANDLE_TAG | next++;
+}
+
+void VirtualHandleMap::bind(uint64_t real_handle) {
+    handles.push_back(real_handle);
+}
+
+uint64_t VirtualHandleMap::resolve(uint64_t handle) const {
+    if (!is_virtual_handle(handle)) {
+        return handle;
+    }
+    uint64_t index = handle & VIRTUAL_HANDLE_INDEX_MASK;
+    if (index >= handles.size()) {
+        throw VirtualHandleException("unbound virtual handle: " + std::to_string(index));
+    }
+    return handles[index];
+}
+
+} // namespace xrtransport
@@ -214,6 +214,30 @@ XRTP_TRY
 }
 XRTP_CATCH_HANDLER
 
+xrtp_Result xrtp_msg_in_borrow(
+    xrtp_MessageLockIn msg_in,
+    uint64_t size,
+    uint64_t alignment,
+    const void** data)
+XRTP_TRY
+{
+    auto msg_in_impl = reinterpret_cast<MessageLockInImpl*>(msg_in);
+    *data = msg_in_impl->buffer.borrow(size, alignment);
+    return 0;
+}
+XRTP_CATCH_HANDLER
+
+xrtp_Result xrtp_msg_in_get_receive_time(
+    xrtp_MessageLockIn msg_in,
+    int64_t* receive_time)
+XRTP_TRY
+{
+    auto msg_in_impl = reinterpret_cast<MessageLockInImpl*>(msg_in);
+    *receive_time = msg_in_impl->receive_time;
+    return 0;
+}
+XRTP_CATCH_HANDLER
+
 xrtp_Result xrtp_msg_in_release(
     xrtp_MessageLockIn msg_in)
 XRTP_TRY
@@ -265,4 +289,64 @@ XRTP_TRY
     delete lock_impl;
     return 0;
 }
+XRTP_CATCH_HANDLER
+
+xrtp_Result xrtp_batch_begin(
+    xrtp_Transport transport,
+    xrtp_CallBatch* batch_out)
+XRTP_TRY
+{
+    auto transport_impl = reinterpret_cast<TransportImpl*>(transport);
+    auto p_batch_impl = new CallBatchImpl(transport_impl);
+    *batch_out = reinterpret_cast<xrtp_CallBatch>(p_batch_impl);
+    return 0;
+}
+XRTP_CATCH_HANDLER
+
+xrtp_Result xrtp_batch_append_call(
+    xrtp_CallBatch batch,
+    uint32_t function_id,
+    const void* params,
+    uint64_t size)
+XRTP_TRY
+{
+    auto batch_impl = reinterpret_cast<CallBatchImpl*>(batch);
+    batch_impl->append_call(function_id, params, size);
+    return 0;
+}
+XRTP_CATCH_HANDLER
+
+xrtp_Result xrtp_batch_submit(
+    xrtp_CallBatch batch)
+XRTP_TRY
+{
+    auto batch_impl = reinterpret_cast<CallBatchImpl*>(batch);
+    batch_impl->submit();
+    return 0;
+}
+XRTP_CATCH_HANDLER
+
+xrtp_Result xrtp_batch_get_result(
+    xrtp_CallBatch batch,
+    uint32_t index,
+    const void** data,
+    uint64_t* size)
+XRTP_TRY
+{
+    auto batch_impl = reinterpret_cast<CallBatchImpl*>(batch);
+    auto [result_data, result_size] = batch_impl->get_result(index);
+    *data = result_data;
+    *size = result_size;
+    return 0;
+}
+XRTP_CATCH_HANDLER
+
+xrtp_Result xrtp_batch_release(
+    xrtp_CallBatch batch)
+XRTP_TRY
+{
+    auto batch_impl = reinterpret_cast<CallBatchImpl*>(batch);
+    delete batch_impl;
+    return 0;
+}
 XRTP_CATCH_HANDLER
\ No newline at end of file
@@ -4,9 +4,12 @@
 
 #include "xrtransport/transport/transport_c_api.h" // for message headers and status
 #include "xrtransport/transport/error.h" // for TransportException
+#include "xrtransport/time.h"
 
 #include <spdlog/spdlog.h>
 #include <chrono>
+#include <cstring>
+#include <string>
 #include <thread>
 
 namespace xrtransport {
@@ -53,11 +56,12 @@ void TransportImpl::producer_loop() {
         while (status != XRTP_STATUS_CLOSED) {
             MessageHeader header{};
             asio::read(*stream, asio::buffer(&header, sizeof(MessageHeader)));
+            int64_t receive_time = get_time();
             
             std::vector<uint8_t> payload(header.size);
             asio::read(*stream, asio::buffer(payload.data(), header.size));
 
-            MessageIn msg_in(header.header, std::move(payload));
+            MessageIn msg_in(header.header, std::move(payload), receive_time);
             {
                 std::lock_guard<std::mutex> lock(queue_mutex);
                 queue.emplace(std::move(msg_in));
@@ -198,7 +202,7 @@ MessageLockInImpl TransportImpl::await_message(uint16_t header) {
 
         // keep reading and handling messages synchronously until we find the one we want
         if (msg_in.header == header) {
-            return MessageLockInImpl(std::move(msg_in.payload), std::move(message_lock));
+            return MessageLockInImpl(std::move(msg_in.payload), msg_in.receive_time, std::move(message_lock));
         }
         else {
             dispatch_to_handler(std::move(msg_in));
@@ -248,7 +252,7 @@ void TransportImpl::dispatch_to_handler(MessageIn msg_in) {
         if (it != handlers.end()) {
             try {
                 // Create MessageLockInImpl and call handler
-                it->second(MessageLockInImpl(std::move(msg_in.payload), std::move(lock)));
+                it->second(MessageLockInImpl(std::move(msg_in.payload), msg_in.receive_time, std::move(lock)));
             }
             catch (const std::exception& e) {
                 spdlog::error("Unhandled exception in handler for message {}: {}", msg_in.header, e.what());
@@ -308,4 +312,69 @@ void TransportImpl::close() {
     stream->close();
 }
 
+// CallBatchImpl implementation
+void CallBatchImpl::append_call(std::uint32_t function_id, const void* params, std::size_t size) {
+    if (submitted)
+        throw TransportException("cannot append call: batch was already submitted");
+    if (size > UINT32_MAX)
+        throw TransportException("cannot append call: params are too large");
+
+    std::uint32_t params_size = static_cast<std::uint32_t>(size);
+    asio::write(calls, asio::buffer(&function_id, sizeof(function_id)));
+    asio::write(calls, asio::buffer(&params_size, sizeof(params_size)));
+    asio::write(calls, asio::buffer(params, size));
+    call_count++;
+}
+
+void CallBatchImpl::submit() {
+    if (submitted)
+        throw TransportException("batch was already submitted");
+    submitted = true;
+    if (call_count == 0) {
+        return;
+    }
+
+    // the message lock is held until the results arrive, like for a single call
+    auto msg_out = transport->start_message(XRTP_MSG_FUNCTION_CALL_BATCH);
+    asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(call_count)));
+    asio::write(msg_out.buffer, asio::buffer(calls.data(), calls.size()));
+    msg_out.flush();
+    calls.clear();
+
+    auto msg_in = transport->await_message(XRTP_MSG_FUNCTION_RETURN_BATCH);
+    results_payload.assign(msg_in.buffer.data(), msg_in.buffer.data() + msg_in.buffer.size());
+
+    auto read_uint32 = [this](std::size_t& offset) {
+        if (results_payload.size() - offset < sizeof(std::uint32_t))
+            throw TransportException("truncated batch results");
+        std::uint32_t value{};
+        std::memcpy(&value, results_payload.data() + offset, sizeof(value));
+        offset += sizeof(value);
+        return value;
+    };
+
+    std::size_t offset = 0;
+    std::uint32_t result_count = read_uint32(offset);
+    if (result_count != call_count)
+        throw TransportException("batch of " + std::to_string(call_count) + " calls returned " + std::to_string(result_count) + " results");
+    results.reserve(result_count);
+    for (std::uint32_t i = 0; i < result_count; i++) {
+        std::size_t size = read_uint32(offset);
+        if (results_payload.size() - offset < size)
+            throw TransportException("truncated batch results");
+        results.emplace_back(offset, size);
+        offset += size;
+    }
+}
+
+std::pair<const std::uint8_t*, std::size_t> CallBatchImpl::get_result(std::uint32_t index) const {
+    if (!submitted)
+        throw TransportException("cannot get result: batch was not submitted");
+    if (index >= results.size())
+        throw TransportException("cannot get result: index " + std::to_string(index) + " is out of range");
+
+    auto [offset, size] = results[index];
+    return {results_payload.data() + offset, size};
+}
+
 } // namespace xrtransport
\ No newline at end of file
@@ -38,8 +38,11 @@ struct MessageIn {
     // (payload does not include size, size is stored as an attribute of the vector)
     std::vector<uint8_t> payload;
 
-    explicit MessageIn(uint16_t header, std::vector<uint8_t> payload)
-        : header(header), payload(std::move(payload))
+    // get_time() when the header was read, before the message waited in the queue
+    int64_t receive_time;
+
+    explicit MessageIn(uint16_t header, std::vector<uint8_t> payload, int64_t receive_time)
+        : header(header), payload(std::move(payload)), receive_time(receive_time)
     {}
 };
 
@@ -74,6 +77,19 @@ public:
         return n;
     }
 
+    // Borrowed bytes are valid until the buffer is destroyed
+    const void* borrow(std::size_t size, std::size_t alignment) override {
+        if (buffer_.size() - read_head < size) {
+            return nullptr;
+        }
+        const std::uint8_t* borrowed = buffer_.data() + read_head;
+        if (reinterpret_cast<std::uintptr_t>(borrowed) % alignment != 0) {
+            return nullptr;
+        }
+        read_head += size;
+        return borrowed;
+    }
+
     void close() override {}
     void close(asio::error_code& ec) override { ec.clear(); }
 
@@ -215,9 +231,10 @@ struct [[nodiscard]] MessageLockInImpl {
 public:
     std::unique_lock<std::recursive_mutex> lock;
     ReceiveBuffer buffer;
+    int64_t receive_time;
 
-    MessageLockInImpl(std::vector<uint8_t> payload, std::unique_lock<std::recursive_mutex>&& lock)
-        : buffer(std::move(payload)), lock(std::move(lock))
+    MessageLockInImpl(std::vector<uint8_t> payload, int64_t receive_time, std::unique_lock<std::recursive_mutex>&& lock)
+        : buffer(std::move(payload)), receive_time(receive_time), lock(std::move(lock))
     {}
 
     MessageLockInImpl(const MessageLockInImpl&) = delete;
@@ -268,6 +285,33 @@ struct [[nodiscard]] MessageLockImpl {
     {}
 };
 
+// Function calls sent as one XRTP_MSG_FUNCTION_CALL_BATCH, and the results of its XRTP_MSG_FUNCTION_RETURN_BATCH
+class CallBatchImpl {
+private:
+    TransportImpl* transport;
+    std::uint32_t call_count = 0;
+    // function id, size and params of each call
+    SendBuffer calls;
+    bool submitted = false;
+
+    std::vector<std::uint8_t> results_payload;
+    // offset and size of each result in results_payload
+    std::vector<std::pair<std::size_t, std::size_t>> results;
+
+public:
+    explicit CallBatchImpl(TransportImpl* transport)
+        : transport(transport)
+    {}
+
+    void append_call(std::uint32_t function_id, const void* params, std::size_t size);
+
+    // Sends the calls and waits for the results
+    void submit();
+
+    // Bytes of a result, valid until the batch is destroyed
+    std::pair<const std::uint8_t*, std::size_t> get_result(std::uint32_t index) const;
+};
+
 } // namespace xrtransport
 
 #endif // XRTRANSPORT_TRANSPORT_IMPL_H
\ No newline at end of file
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "frame_waiter.h"
+
+#include "xrtransport/serialization/virtual_handles.h"
+#include "xrtransport/asio_compat.h"
+
+#include <spdlog/spdlog.h>
+
+using std::uint8_t;
+using std::uint32_t;
+using std::uint64_t;
+
+namespace xrtransport {
+
+FrameWaiter::FrameWaiter(Transport& transport, FunctionLoader& function_loader, bool view_prefetch, bool space_prefetch,
+    const VirtualHandleMap* virtual_handles, FunctionDispatch* function_dispatch) :
+    transport(transport),
+    function_loader(function_loader),
+    view_prefetch(view_prefetch),
+    space_prefetch(space_prefetch),
+    virtual_handles(virtual_handles),
+    function_dispatch(function_dispatch)
+{}
+
+FrameWaiter::~FrameWaiter() {
+    stop();
+}
+
+void FrameWaiter::handle_message(MessageLockIn msg_in) {
+    uint64_t session{};
+    asio::read(msg_in.buffer, asio::buffer(&session, sizeof(uint64_t)));
+    WaitRequest request{handle_from_value<XrSession>(session), XR_VIEW_CONFIGURATION_TYPE_MAX_ENUM, XR_NULL_HANDLE, {}, {}};
+    // pipelined calls are bound on this thread
+    auto read_space = [&]{
+        uint64_t space{};
+        asio::read(msg_in.buffer, asio::buffer(&space, sizeof(uint64_t)));
+        return handle_from_value<XrSpace>(virtual_handles ? virtual_handles->resolve(space) : space);
+    };
+    if (view_prefetch) {
+        asio::read(msg_in.buffer, asio::buffer(&request.view_configuration_type, sizeof(XrViewConfigurationType)));
+        request.space = read_space();
+    }
+    if (space_prefetch) {
+        uint32_t pair_count{};
+        asio::read(msg_in.buffer, asio::buffer(&pair_count, sizeof(uint32_t)));
+        for (uint32_t i = 0; i < pair_count; i++) {
+            XrSpace space = read_space();
+            XrSpace base_space = read_space();
+            request.spaces.emplace_back(space, base_space);
+        }
+    }
+    if (function_dispatch) {
+        uint32_t call_count{};
+        asio::read(msg_in.buffer, asio::buffer(&call_count, sizeof(uint32_t)));
+        request.calls.resize(call_count);
+        for (SampledCall& call : request.calls) {
+            asio::read(msg_in.buffer, asio::buffer(&call.function_id, sizeof(uint32_t)));
+            uint32_t params_size{};
+            asio::read(msg_in.buffer, asio::buffer(&params_size, sizeof(uint32_t)));
+            call.params.resize(params_size);
+            asio::read(msg_in.buffer, asio::buffer(call.params.data(), call.params.size()));
+        }
+    }
+
+    // the function loader is only used with the message lock held, which sampled calls take as well
+    function_loader.ensure_function_loaded("xrWaitFrame", function_loader.WaitFrame);
+    if (view_prefetch) {
+        function_loader.ensure_function_loaded("xrLocateViews", function_loader.LocateViews);
+    }
+    if (!request.spaces.empty()) {
+        function_loader.ensure_function_loaded("xrLocateSpace", function_loader.LocateSpace);
+        if (!locate_spaces_loaded) {
+            locate_spaces_loaded = true;
+            try {
+                // only in OpenXR 1.1 and later
+                function_loader.ensure_function_loaded("xrLocateSpaces", function_loader.LocateSpaces);
+            }
+            catch (const FunctionLoaderException&) {
+                spdlog::info("xrLocateSpaces is not available, prefetched spaces are located one at a time");
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!thread.joinable()) {
+        thread = std::thread(&FrameWaiter::wait_loop, this);
+    }
+    requests.push(std::move(request));
+    cv.notify_one();
+}
+
+void FrameWaiter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        cv.notify_one();
+    }
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void FrameWaiter::wait_loop() {
+    while (true) {
+        WaitRequest request{};
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this]{ return stopping || !requests.empty(); });
+            if (requests.empty()) {
+                return;
+            }
+            request = std::move(requests.front());
+            requests.pop();
+        }
+        try {
+            wait_frame(request);
+        }
+        catch (const std::exception& e) {
+            spdlog::error("Speculative xrWaitFrame failed: {}", e.what());
+        }
+    }
+}
+
+void FrameWaiter::wait_frame(const WaitRequest& request) {
+    XrFrameWaitInfo frame_wait_info{XR_TYPE_FRAME_WAIT_INFO};
+    XrFrameState frame_state{XR_TYPE_FRAME_STATE};
+    XrResult result = function_loader.WaitFrame(request.session, &frame_wait_info, &frame_state);
+
+    XrViewState view_state{XR_TYPE_VIEW_STATE};
+    std::vector<XrView> views;
+    if (XR_SUCCEEDED(result) && request.space != XR_NULL_HANDLE) {
+        locate_views(request, frame_state.predictedDisplayTime, view_state, views);
+    }
+    std::vector<SpaceLocation> space_locations;
+    if (XR_SUCCEEDED(result)) {
+        locate_spaces(request, frame_state.predictedDisplayTime, space_locations);
+    }
+    ResponseBuffer samples;
+    uint32_t sample_count = 0;
+    if (XR_SUCCEEDED(result) && !request.calls.empty()) {
+        MessageLock lock = transport.acquire_message_lock();
+        function_dispatch->sample_calls(request.calls, frame_state.predictedDisplayTime, samples);
+        sample_count = static_cast<uint32_t>(request.calls.size());
+    }
+
+    uint64_t session = handle_value(request.session);
+    auto msg_out = transport.start_message(XRTP_MSG_FRAME_STATE);
+    asio::write(msg_out.buffer, asio::buffer(&session, sizeof(uint64_t)));
+    asio::write(msg_out.buffer, asio::buffer(&result, sizeof(XrResult)));
+    asio::write(msg_out.buffer, asio::buffer(&frame_state.predictedDisplayTime, sizeof(XrTime)));
+    asio::write(msg_out.buffer, asio::buffer(&frame_state.predictedDisplayPeriod, sizeof(XrDuration)));
+    asio::write(msg_out.buffer, asio::buffer(&frame_state.shouldRender, sizeof(XrBool32)));
+    if (view_prefetch) {
+        uint8_t has_views = !views.empty();
+        asio::write(msg_out.buffer, asio::buffer(&has_views, sizeof(uint8_t)));
+        if (has_views) {
+            asio::write(msg_out.buffer, asio::buffer(&view_state.viewStateFlags, sizeof(XrViewStateFlags)));
+            uint32_t view_count = static_cast<uint32_t>(views.size());
+            asio::write(msg_out.buffer, asio::buffer(&view_count, sizeof(uint32_t)));
+            for (const XrView& view : views) {
+                asio::write(msg_out.buffer, asio::buffer(&view.pose, sizeof(XrPosef)));
+                asio::write(msg_out.buffer, asio::buffer(&view.fov, sizeof(XrFovf)));
+            }
+        }
+    }
+    if (space_prefetch) {
+        uint32_t location_count = static_cast<uint32_t>(space_locations.size());
+        asio::write(msg_out.buffer, asio::buffer(&location_count, sizeof(uint32_t)));
+        for (const SpaceLocation& location : space_locations) {
+            asio::write(msg_out.buffer, asio::buffer(&location.result, sizeof(XrResult)));
+            asio::write(msg_out.buffer, asio::buffer(&location.location_flags, sizeof(XrSpaceLocationFlags)));
+            asio::write(msg_out.buffer, asio::buffer(&location.pose, sizeof(XrPosef)));
+        }
+    }
+    if (function_dispatch) {
+        asio::write(msg_out.buffer, asio::buffer(&sample_count, sizeof(uint32_t)));
+        asio::write(msg_out.buffer, asio::buffer(samples.bytes.data(), samples.bytes.size()));
+    }
+    msg_out.flush();
+}
+
+void FrameWaiter::locate_views(const WaitRequest& request, XrTime display_time, XrViewState& view_state, std::vector<XrView>& views) {
+    XrViewLocateInfo view_locate_info{XR_TYPE_VIEW_LOCATE_INFO};
+    view_locate_info.viewConfigurationType = request.view_configuration_type;
+    view_locate_info.displayTime = display_time;
+    view_locate_info.space = request.space;
+
+    uint32_t view_count{};
+    XrResult result = function_loader.LocateViews(request.session, &view_locate_info, &view_state, 0, &view_count, nullptr);
+    if (XR_SUCCEEDED(result)) {
+        views.resize(view_count, {XR_TYPE_VIEW});
+        result = function_loader.LocateViews(request.session, &view_locate_info, &view_state, view_count, &view_count, views.data());
+    }
+    if (XR_FAILED(result)) {
+        // the client calls the server instead, which reports the error
+        spdlog::debug("Prefetching views failed with {}", (int)result);
+        views.clear();
+    }
+}
+
+void FrameWaiter::locate_spaces(const WaitRequest& request, XrTime time, std::vector<SpaceLocation>& locations) {
+    locations.resize(request.spaces.size(), {XR_ERROR_HANDLE_INVALID, 0, {}});
+
+    if (!function_loader.LocateSpaces) {
+        for (std::size_t i = 0; i < request.spaces.size(); i++) {
+            auto [space, base_space] = request.spaces[i];
+            if (space == XR_NULL_HANDLE || base_space == XR_NULL_HANDLE) {
+                continue;
+            }
+            XrSpaceLocation location{XR_TYPE_SPACE_LOCATION};
+            locations[i].result = function_loader.LocateSpace(space, base_space, time, &location);
+            locations[i].location_flags = location.locationFlags;
+            locations[i].pose = location.pose;
+        }
+        return;
+    }
+
+    // one call for each base space, most applications only use one
+    std::vector<bool> located(request.spaces.size());
+    for (std::size_t first = 0; first < request.spaces.size(); first++) {
+        XrSpace base_space = request.spaces[first].second;
+        if (located[first] || base_space == XR_NULL_HANDLE) {
+            continue;
+        }
+        std::vector<std::size_t> indices;
+        std::vector<XrSpace> spaces;
+        for (std::size_t i = first; i < request.spaces.size(); i++) {
+            if (!located[i] && request.spaces[i].second == base_space && request.spaces[i].first != XR_NULL_HANDLE) {
+                located[i] = true;
+                indices.push_back(i);
+                spaces.push_back(request.spaces[i].first);
+            }
+        }
+        if (spaces.empty()) {
+            continue;
+        }
+
+        XrSpacesLocateInfo locate_info{XR_TYPE_SPACES_LOCATE_INFO};
+        locate_info.baseSpace = base_space;
+        locate_info.time = time;
+        locate_info.spaceCount = static_cast<uint32_t>(spaces.size());
+        locate_info.spaces = spaces.data();
+        std::vector<XrSpaceLocationData> location_data(spaces.size());
+        XrSpaceLocations space_locations{XR_TYPE_SPACE_LOCATIONS};
+        space_locations.locationCount = static_cast<uint32_t>(location_data.size());
+        space_locations.locations = location_data.data();
+        XrResult result = function_loader.LocateSpaces(request.session, &locate_info, &space_locations);
+
+        for (std::size_t j = 0; j < indices.size(); j++) {
+            locations[indices[j]] = {result, location_data[j].locationFlags, location_data[j].pose};
+        }
+    }
+}
+
+} // namespace xrtransport
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_SERVER_FRAME_WAITER_H
+#define XRTRANSPORT_SERVER_FRAME_WAITER_H
+
+#include "function_dispatch.h"
+
+#include "xrtransport/transport/transport.h"
+#include "xrtransport/server/function_loader.h"
+#include "xrtransport/serialization/virtual_handles.h"
+
+#include "openxr/openxr.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace xrtransport {
+
+/*
+ * Server side of frame loop fusion (see src/client/frame_loop.h)
+ *
+ * xrWaitFrame blocks until the runtime releases the next frame, so speculative waits are made on a
+ * thread of their own instead of the handler thread, which keeps handling the calls the client makes
+ * in the meantime. The frame state is sent back in an XRTP_MSG_FRAME_STATE as soon as xrWaitFrame
+ * returns, along with the views and spaces the client asked for if view or space prefetch was negotiated.
+ * Spaces that share a base space are located with one call to xrLocateSpaces if the runtime has it.
+ *
+ * With tracker sampling, the sampled calls of a request are run by FunctionDispatch::sample_calls at the
+ * display time of the frame, which holds the message lock so that they don't run at the same time as the
+ * calls on the handler thread.
+ */
+class FrameWaiter {
+private:
+    struct WaitRequest {
+        XrSession session;
+        XrViewConfigurationType view_configuration_type;
+        XrSpace space; // XR_NULL_HANDLE if no views are located
+        std::vector<std::pair<XrSpace, XrSpace>> spaces; // and their base spaces
+        std::vector<SampledCall> calls;
+    };
+
+    struct SpaceLocation {
+        XrResult result;
+        XrSpaceLocationFlags location_flags;
+        XrPosef pose;
+    };
+
+    Transport& transport;
+    FunctionLoader& function_loader;
+    bool view_prefetch;
+    bool space_prefetch;
+    const VirtualHandleMap* virtual_handles;
+    FunctionDispatch* function_dispatch;
+    bool locate_spaces_loaded = false; // whether loading xrLocateSpaces was tried, only used on the handler thread
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::queue<WaitRequest> requests; // protected by mutex
+    bool stopping = false; // protected by mutex
+    std::thread thread;
+
+    void wait_loop();
+    void wait_frame(const WaitRequest& request);
+    void locate_views(const WaitRequest& request, XrTime display_time, XrViewState& view_state, std::vector<XrView>& views);
+    void locate_spaces(const WaitRequest& request, XrTime time, std::vector<SpaceLocation>& locations);
+
+public:
+    /**
+     * @param view_prefetch Whether XRTP_FEATURE_VIEW_PREFETCH was negotiated
+     * @param space_prefetch Whether XRTP_FEATURE_SPACE_PREFETCH was negotiated
+     * @param virtual_handles Used to resolve the spaces in requests, nullptr if pipelined creation was not negotiated
+     * @param function_dispatch Runs the sampled calls in requests, nullptr if XRTP_FEATURE_TRACKER_SAMPLING was not negotiated
+     */
+    FrameWaiter(Transport& transport, FunctionLoader& function_loader, bool view_prefetch, bool space_prefetch,
+        const VirtualHandleMap* virtual_handles, FunctionDispatch* function_dispatch);
+    ~FrameWaiter();
+
+    FrameWaiter(const FrameWaiter&) = delete;
+    FrameWaiter& operator=(const FrameWaiter&) = delete;
+
+    /**
+     * Queues the wait requested by an XRTP_MSG_SPECULATIVE_WAIT_FRAME.
+     */
+    void handle_message(MessageLockIn msg_in);
+
+    /**
+     * Finishes the waits that were already queued and stops the thread.
+     */
+    void stop();
+};
+
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_SERVER_FRAME_WAITER_H
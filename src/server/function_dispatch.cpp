@@ -15,6 +15,10 @@
 #include "xrtransport/transport/transport.h"
 #include "xrtransport/serialization/serializer.h"
 #include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/packed_calls.h"
+#include "xrtransport/serialization/virtual_handles.h"
 #include "xrtransport/util.h"
 #include "xrtransport/time.h"
 
@@ -41,21 +45,31 @@ static XrDuration end_runtime_timer(XrTime start_time) {
 void FunctionDispatch::handle_xrSetDigitalLensControlALMALENCE(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetDigitalLensControlALMALENCE", function_loader.SetDigitalLensControlALMALENCE);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrDigitalLensControlALMALENCE* digitalLensControl{};
+    const XrDigitalLensControlALMALENCE* digitalLensControl{};
     deserialize_ptr(&digitalLensControl, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetDigitalLensControlALMALENCE(session, digitalLensControl);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(digitalLensControl, 1);
@@ -66,24 +80,34 @@ void FunctionDispatch::handle_xrSetDigitalLensControlALMALENCE(MessageLockIn msg
 void FunctionDispatch::handle_xrCreateBodyTrackerBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateBodyTrackerBD", function_loader.CreateBodyTrackerBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrBodyTrackerCreateInfoBD* createInfo{};
+    const XrBodyTrackerCreateInfoBD* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrBodyTrackerBD* bodyTracker{};
-    deserialize_ptr(&bodyTracker, d_ctx);
+    deserialize_output_ptr(&bodyTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateBodyTrackerBD(session, createInfo, bodyTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bodyTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -93,19 +117,38 @@ void FunctionDispatch::handle_xrCreateBodyTrackerBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyBodyTrackerBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyBodyTrackerBD", function_loader.DestroyBodyTrackerBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrBodyTrackerBD bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyBodyTrackerBD(bodyTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(386002, _result);
+        }
+        cleanup(&bodyTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
 }
@@ -113,10 +156,16 @@ void FunctionDispatch::handle_xrDestroyBodyTrackerBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateBodyJointsBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateBodyJointsBD", function_loader.LocateBodyJointsBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    d_ctx.time_offset = sample_time;
     XrBodyTrackerBD bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
-    XrBodyJointsLocateInfoBD* locateInfo{};
+    const XrBodyJointsLocateInfoBD* locateInfo{};
     deserialize_ptr(&locateInfo, d_ctx);
     XrBodyJointLocationsBD* locations{};
     deserialize_ptr(&locations, d_ctx);
@@ -125,12 +174,17 @@ void FunctionDispatch::handle_xrLocateBodyJointsBD(MessageLockIn msg_in) {
     XrResult _result = function_loader.LocateBodyJointsBD(bodyTracker, locateInfo, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
     cleanup_ptr(locateInfo, 1);
@@ -142,24 +196,34 @@ void FunctionDispatch::handle_xrLocateBodyJointsBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpatialAnchorAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorAsyncBD", function_loader.CreateSpatialAnchorAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSpatialAnchorCreateInfoBD* info{};
+    const XrSpatialAnchorCreateInfoBD* info{};
     deserialize_ptr(&info, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorAsyncBD(provider, info, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(info, 1);
@@ -169,24 +233,34 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorAsyncBD(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCreateSpatialAnchorCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorCompleteBD", function_loader.CreateSpatialAnchorCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrSpatialAnchorCreateCompletionBD* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -196,24 +270,34 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorCompleteBD(MessageLockIn msg_
 void FunctionDispatch::handle_xrPersistSpatialAnchorAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPersistSpatialAnchorAsyncBD", function_loader.PersistSpatialAnchorAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSpatialAnchorPersistInfoBD* info{};
+    const XrSpatialAnchorPersistInfoBD* info{};
     deserialize_ptr(&info, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PersistSpatialAnchorAsyncBD(provider, info, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(info, 1);
@@ -223,24 +307,34 @@ void FunctionDispatch::handle_xrPersistSpatialAnchorAsyncBD(MessageLockIn msg_in
 void FunctionDispatch::handle_xrPersistSpatialAnchorCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPersistSpatialAnchorCompleteBD", function_loader.PersistSpatialAnchorCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrFutureCompletionEXT* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PersistSpatialAnchorCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -250,24 +344,34 @@ void FunctionDispatch::handle_xrPersistSpatialAnchorCompleteBD(MessageLockIn msg
 void FunctionDispatch::handle_xrUnpersistSpatialAnchorAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUnpersistSpatialAnchorAsyncBD", function_loader.UnpersistSpatialAnchorAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSpatialAnchorUnpersistInfoBD* info{};
+    const XrSpatialAnchorUnpersistInfoBD* info{};
     deserialize_ptr(&info, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UnpersistSpatialAnchorAsyncBD(provider, info, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(info, 1);
@@ -277,24 +381,34 @@ void FunctionDispatch::handle_xrUnpersistSpatialAnchorAsyncBD(MessageLockIn msg_
 void FunctionDispatch::handle_xrUnpersistSpatialAnchorCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUnpersistSpatialAnchorCompleteBD", function_loader.UnpersistSpatialAnchorCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrFutureCompletionEXT* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UnpersistSpatialAnchorCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -306,24 +420,34 @@ void FunctionDispatch::handle_xrUnpersistSpatialAnchorCompleteBD(MessageLockIn m
 void FunctionDispatch::handle_xrDownloadSharedSpatialAnchorAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDownloadSharedSpatialAnchorAsyncBD", function_loader.DownloadSharedSpatialAnchorAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSharedSpatialAnchorDownloadInfoBD* info{};
+    const XrSharedSpatialAnchorDownloadInfoBD* info{};
     deserialize_ptr(&info, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DownloadSharedSpatialAnchorAsyncBD(provider, info, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(info, 1);
@@ -333,24 +457,34 @@ void FunctionDispatch::handle_xrDownloadSharedSpatialAnchorAsyncBD(MessageLockIn
 void FunctionDispatch::handle_xrDownloadSharedSpatialAnchorCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDownloadSharedSpatialAnchorCompleteBD", function_loader.DownloadSharedSpatialAnchorCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrFutureCompletionEXT* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DownloadSharedSpatialAnchorCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -360,24 +494,34 @@ void FunctionDispatch::handle_xrDownloadSharedSpatialAnchorCompleteBD(MessageLoc
 void FunctionDispatch::handle_xrShareSpatialAnchorAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrShareSpatialAnchorAsyncBD", function_loader.ShareSpatialAnchorAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSpatialAnchorShareInfoBD* info{};
+    const XrSpatialAnchorShareInfoBD* info{};
     deserialize_ptr(&info, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ShareSpatialAnchorAsyncBD(provider, info, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(info, 1);
@@ -387,24 +531,34 @@ void FunctionDispatch::handle_xrShareSpatialAnchorAsyncBD(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrShareSpatialAnchorCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrShareSpatialAnchorCompleteBD", function_loader.ShareSpatialAnchorCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrFutureCompletionEXT* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ShareSpatialAnchorCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -416,24 +570,34 @@ void FunctionDispatch::handle_xrShareSpatialAnchorCompleteBD(MessageLockIn msg_i
 void FunctionDispatch::handle_xrCaptureSceneAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCaptureSceneAsyncBD", function_loader.CaptureSceneAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSceneCaptureInfoBD* info{};
+    const XrSceneCaptureInfoBD* info{};
     deserialize_ptr(&info, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CaptureSceneAsyncBD(provider, info, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(info, 1);
@@ -443,24 +607,34 @@ void FunctionDispatch::handle_xrCaptureSceneAsyncBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCaptureSceneCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCaptureSceneCompleteBD", function_loader.CaptureSceneCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrFutureCompletionEXT* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CaptureSceneCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -472,24 +646,34 @@ void FunctionDispatch::handle_xrCaptureSceneCompleteBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateAnchorSpaceBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateAnchorSpaceBD", function_loader.CreateAnchorSpaceBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrAnchorSpaceCreateInfoBD* createInfo{};
+    const XrAnchorSpaceCreateInfoBD* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateAnchorSpaceBD(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -499,24 +683,34 @@ void FunctionDispatch::handle_xrCreateAnchorSpaceBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSenseDataProviderBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSenseDataProviderBD", function_loader.CreateSenseDataProviderBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSenseDataProviderCreateInfoBD* createInfo{};
+    const XrSenseDataProviderCreateInfoBD* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSenseDataProviderBD* provider{};
-    deserialize_ptr(&provider, d_ctx);
+    deserialize_output_ptr(&provider, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSenseDataProviderBD(session, createInfo, provider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(provider, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -526,24 +720,34 @@ void FunctionDispatch::handle_xrCreateSenseDataProviderBD(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCreateSpatialEntityAnchorBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialEntityAnchorBD", function_loader.CreateSpatialEntityAnchorBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSpatialEntityAnchorCreateInfoBD* createInfo{};
+    const XrSpatialEntityAnchorCreateInfoBD* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrAnchorBD* anchor{};
-    deserialize_ptr(&anchor, d_ctx);
+    deserialize_output_ptr(&anchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialEntityAnchorBD(provider, createInfo, anchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(anchor, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(createInfo, 1);
@@ -553,19 +757,38 @@ void FunctionDispatch::handle_xrCreateSpatialEntityAnchorBD(MessageLockIn msg_in
 void FunctionDispatch::handle_xrDestroyAnchorBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyAnchorBD", function_loader.DestroyAnchorBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrAnchorBD anchor{};
     deserialize(&anchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyAnchorBD(anchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(390004, _result);
+        }
+        cleanup(&anchor);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&anchor);
 }
@@ -573,19 +796,38 @@ void FunctionDispatch::handle_xrDestroyAnchorBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySenseDataProviderBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySenseDataProviderBD", function_loader.DestroySenseDataProviderBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySenseDataProviderBD(provider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(390005, _result);
+        }
+        cleanup(&provider);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
 }
@@ -593,19 +835,38 @@ void FunctionDispatch::handle_xrDestroySenseDataProviderBD(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrDestroySenseDataSnapshotBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySenseDataSnapshotBD", function_loader.DestroySenseDataSnapshotBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataSnapshotBD snapshot{};
     deserialize(&snapshot, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySenseDataSnapshotBD(snapshot);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(390006, _result);
+        }
+        cleanup(&snapshot);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&snapshot);
 }
@@ -613,7 +874,12 @@ void FunctionDispatch::handle_xrDestroySenseDataSnapshotBD(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrEnumerateSpatialEntityComponentTypesBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateSpatialEntityComponentTypesBD", function_loader.EnumerateSpatialEntityComponentTypesBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataSnapshotBD snapshot{};
     deserialize(&snapshot, d_ctx);
     XrSpatialEntityIdBD entityId{};
@@ -621,21 +887,26 @@ void FunctionDispatch::handle_xrEnumerateSpatialEntityComponentTypesBD(MessageLo
     uint32_t componentTypeCapacityInput{};
     deserialize(&componentTypeCapacityInput, d_ctx);
     uint32_t* componentTypeCountOutput{};
-    deserialize_ptr(&componentTypeCountOutput, d_ctx);
+    deserialize_output_ptr(&componentTypeCountOutput, d_ctx);
     XrSpatialEntityComponentTypeBD* componentTypes{};
-    deserialize_ptr(&componentTypes, d_ctx);
+    deserialize_output_ptr(&componentTypes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateSpatialEntityComponentTypesBD(snapshot, entityId, componentTypeCapacityInput, componentTypeCountOutput, componentTypes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(componentTypeCountOutput, 1, s_ctx);
-    serialize_ptr(componentTypes, componentTypeCapacityInput, s_ctx);
+    serialize_filled_ptr(componentTypes, componentTypeCapacityInput, XR_SUCCEEDED(_result) && componentTypeCountOutput ? *componentTypeCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&snapshot);
     cleanup(&entityId);
@@ -647,22 +918,32 @@ void FunctionDispatch::handle_xrEnumerateSpatialEntityComponentTypesBD(MessageLo
 void FunctionDispatch::handle_xrGetAnchorUuidBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetAnchorUuidBD", function_loader.GetAnchorUuidBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrAnchorBD anchor{};
     deserialize(&anchor, d_ctx);
     XrUuidEXT* uuid{};
-    deserialize_ptr(&uuid, d_ctx);
+    deserialize_output_ptr(&uuid, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetAnchorUuidBD(anchor, uuid);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(uuid, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&anchor);
     cleanup_ptr(uuid, 1);
@@ -671,11 +952,16 @@ void FunctionDispatch::handle_xrGetAnchorUuidBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetQueriedSenseDataBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetQueriedSenseDataBD", function_loader.GetQueriedSenseDataBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataSnapshotBD snapshot{};
     deserialize(&snapshot, d_ctx);
     XrQueriedSenseDataGetInfoBD* getInfo{};
-    deserialize_ptr(&getInfo, d_ctx);
+    deserialize_output_xr_ptr(&getInfo, d_ctx);
     XrQueriedSenseDataBD* queriedSenseData{};
     deserialize_ptr(&queriedSenseData, d_ctx);
 
@@ -683,13 +969,18 @@ void FunctionDispatch::handle_xrGetQueriedSenseDataBD(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetQueriedSenseDataBD(snapshot, getInfo, queriedSenseData);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(getInfo, 1, s_ctx);
     serialize_ptr(queriedSenseData, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&snapshot);
     cleanup_ptr(getInfo, 1);
@@ -699,22 +990,32 @@ void FunctionDispatch::handle_xrGetQueriedSenseDataBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSenseDataProviderStateBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSenseDataProviderStateBD", function_loader.GetSenseDataProviderStateBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrSenseDataProviderStateBD* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSenseDataProviderStateBD(provider, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(state, 1);
@@ -723,10 +1024,15 @@ void FunctionDispatch::handle_xrGetSenseDataProviderStateBD(MessageLockIn msg_in
 void FunctionDispatch::handle_xrGetSpatialEntityComponentDataBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpatialEntityComponentDataBD", function_loader.GetSpatialEntityComponentDataBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataSnapshotBD snapshot{};
     deserialize(&snapshot, d_ctx);
-    XrSpatialEntityComponentGetInfoBD* getInfo{};
+    const XrSpatialEntityComponentGetInfoBD* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrSpatialEntityComponentDataBaseHeaderBD* componentData{};
     deserialize_xr(&componentData, d_ctx);
@@ -735,12 +1041,17 @@ void FunctionDispatch::handle_xrGetSpatialEntityComponentDataBD(MessageLockIn ms
     XrResult _result = function_loader.GetSpatialEntityComponentDataBD(snapshot, getInfo, componentData);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(componentData, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&snapshot);
     cleanup_ptr(getInfo, 1);
@@ -750,24 +1061,34 @@ void FunctionDispatch::handle_xrGetSpatialEntityComponentDataBD(MessageLockIn ms
 void FunctionDispatch::handle_xrGetSpatialEntityUuidBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpatialEntityUuidBD", function_loader.GetSpatialEntityUuidBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataSnapshotBD snapshot{};
     deserialize(&snapshot, d_ctx);
     XrSpatialEntityIdBD entityId{};
     deserialize(&entityId, d_ctx);
     XrUuidEXT* uuid{};
-    deserialize_ptr(&uuid, d_ctx);
+    deserialize_output_ptr(&uuid, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpatialEntityUuidBD(snapshot, entityId, uuid);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(uuid, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&snapshot);
     cleanup(&entityId);
@@ -777,24 +1098,34 @@ void FunctionDispatch::handle_xrGetSpatialEntityUuidBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrQuerySenseDataAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQuerySenseDataAsyncBD", function_loader.QuerySenseDataAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSenseDataQueryInfoBD* queryInfo{};
+    const XrSenseDataQueryInfoBD* queryInfo{};
     deserialize_ptr(&queryInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QuerySenseDataAsyncBD(provider, queryInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(queryInfo, 1);
@@ -804,24 +1135,34 @@ void FunctionDispatch::handle_xrQuerySenseDataAsyncBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrQuerySenseDataCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQuerySenseDataCompleteBD", function_loader.QuerySenseDataCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrSenseDataQueryCompletionBD* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QuerySenseDataCompleteBD(provider, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup(&future);
@@ -831,24 +1172,34 @@ void FunctionDispatch::handle_xrQuerySenseDataCompleteBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrStartSenseDataProviderAsyncBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStartSenseDataProviderAsyncBD", function_loader.StartSenseDataProviderAsyncBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
-    XrSenseDataProviderStartInfoBD* startInfo{};
+    const XrSenseDataProviderStartInfoBD* startInfo{};
     deserialize_ptr(&startInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StartSenseDataProviderAsyncBD(provider, startInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
     cleanup_ptr(startInfo, 1);
@@ -858,24 +1209,34 @@ void FunctionDispatch::handle_xrStartSenseDataProviderAsyncBD(MessageLockIn msg_
 void FunctionDispatch::handle_xrStartSenseDataProviderCompleteBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStartSenseDataProviderCompleteBD", function_loader.StartSenseDataProviderCompleteBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrFutureCompletionEXT* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StartSenseDataProviderCompleteBD(session, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&future);
@@ -885,7 +1246,12 @@ void FunctionDispatch::handle_xrStartSenseDataProviderCompleteBD(MessageLockIn m
 void FunctionDispatch::handle_xrStopSenseDataProviderBD(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStopSenseDataProviderBD", function_loader.StopSenseDataProviderBD);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSenseDataProviderBD provider{};
     deserialize(&provider, d_ctx);
 
@@ -893,11 +1259,16 @@ void FunctionDispatch::handle_xrStopSenseDataProviderBD(MessageLockIn msg_in) {
     XrResult _result = function_loader.StopSenseDataProviderBD(provider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&provider);
 }
@@ -907,7 +1278,12 @@ void FunctionDispatch::handle_xrStopSenseDataProviderBD(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSetInputDeviceActiveEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetInputDeviceActiveEXT", function_loader.SetInputDeviceActiveEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath interactionProfile{};
@@ -921,11 +1297,16 @@ void FunctionDispatch::handle_xrSetInputDeviceActiveEXT(MessageLockIn msg_in) {
     XrResult _result = function_loader.SetInputDeviceActiveEXT(session, interactionProfile, topLevelPath, isActive);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&interactionProfile);
@@ -936,7 +1317,12 @@ void FunctionDispatch::handle_xrSetInputDeviceActiveEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSetInputDeviceLocationEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetInputDeviceLocationEXT", function_loader.SetInputDeviceLocationEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath topLevelPath{};
@@ -952,11 +1338,16 @@ void FunctionDispatch::handle_xrSetInputDeviceLocationEXT(MessageLockIn msg_in)
     XrResult _result = function_loader.SetInputDeviceLocationEXT(session, topLevelPath, inputSourcePath, space, pose);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&topLevelPath);
@@ -968,7 +1359,12 @@ void FunctionDispatch::handle_xrSetInputDeviceLocationEXT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrSetInputDeviceStateBoolEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetInputDeviceStateBoolEXT", function_loader.SetInputDeviceStateBoolEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath topLevelPath{};
@@ -982,11 +1378,16 @@ void FunctionDispatch::handle_xrSetInputDeviceStateBoolEXT(MessageLockIn msg_in)
     XrResult _result = function_loader.SetInputDeviceStateBoolEXT(session, topLevelPath, inputSourcePath, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&topLevelPath);
@@ -997,7 +1398,12 @@ void FunctionDispatch::handle_xrSetInputDeviceStateBoolEXT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrSetInputDeviceStateFloatEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetInputDeviceStateFloatEXT", function_loader.SetInputDeviceStateFloatEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath topLevelPath{};
@@ -1011,11 +1417,16 @@ void FunctionDispatch::handle_xrSetInputDeviceStateFloatEXT(MessageLockIn msg_in
     XrResult _result = function_loader.SetInputDeviceStateFloatEXT(session, topLevelPath, inputSourcePath, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&topLevelPath);
@@ -1026,7 +1437,12 @@ void FunctionDispatch::handle_xrSetInputDeviceStateFloatEXT(MessageLockIn msg_in
 void FunctionDispatch::handle_xrSetInputDeviceStateVector2fEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetInputDeviceStateVector2fEXT", function_loader.SetInputDeviceStateVector2fEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath topLevelPath{};
@@ -1040,11 +1456,16 @@ void FunctionDispatch::handle_xrSetInputDeviceStateVector2fEXT(MessageLockIn msg
     XrResult _result = function_loader.SetInputDeviceStateVector2fEXT(session, topLevelPath, inputSourcePath, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&topLevelPath);
@@ -1057,25 +1478,35 @@ void FunctionDispatch::handle_xrSetInputDeviceStateVector2fEXT(MessageLockIn msg
 void FunctionDispatch::handle_xrCreateDebugUtilsMessengerEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateDebugUtilsMessengerEXT", function_loader.CreateDebugUtilsMessengerEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrDebugUtilsMessengerCreateInfoEXT* createInfo{};
+    const XrDebugUtilsMessengerCreateInfoEXT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrDebugUtilsMessengerEXT* messenger{};
-    deserialize_ptr(&messenger, d_ctx);
+    deserialize_output_ptr(&messenger, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateDebugUtilsMessengerEXT(instance, createInfo, messenger);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(createInfo->userData, 1, s_ctx);
     serialize_ptr(messenger, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(createInfo, 1);
@@ -1085,19 +1516,38 @@ void FunctionDispatch::handle_xrCreateDebugUtilsMessengerEXT(MessageLockIn msg_i
 void FunctionDispatch::handle_xrDestroyDebugUtilsMessengerEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyDebugUtilsMessengerEXT", function_loader.DestroyDebugUtilsMessengerEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrDebugUtilsMessengerEXT messenger{};
     deserialize(&messenger, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyDebugUtilsMessengerEXT(messenger);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(20002, _result);
+        }
+        cleanup(&messenger);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&messenger);
 }
@@ -1105,21 +1555,41 @@ void FunctionDispatch::handle_xrDestroyDebugUtilsMessengerEXT(MessageLockIn msg_
 void FunctionDispatch::handle_xrSessionBeginDebugUtilsLabelRegionEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSessionBeginDebugUtilsLabelRegionEXT", function_loader.SessionBeginDebugUtilsLabelRegionEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrDebugUtilsLabelEXT* labelInfo{};
+    const XrDebugUtilsLabelEXT* labelInfo{};
     deserialize_ptr(&labelInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SessionBeginDebugUtilsLabelRegionEXT(session, labelInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(20003, _result);
+        }
+        cleanup(&session);
+        cleanup_ptr(labelInfo, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(labelInfo, 1);
@@ -1128,19 +1598,38 @@ void FunctionDispatch::handle_xrSessionBeginDebugUtilsLabelRegionEXT(MessageLock
 void FunctionDispatch::handle_xrSessionEndDebugUtilsLabelRegionEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSessionEndDebugUtilsLabelRegionEXT", function_loader.SessionEndDebugUtilsLabelRegionEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SessionEndDebugUtilsLabelRegionEXT(session);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(20004, _result);
+        }
+        cleanup(&session);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
 }
@@ -1148,21 +1637,41 @@ void FunctionDispatch::handle_xrSessionEndDebugUtilsLabelRegionEXT(MessageLockIn
 void FunctionDispatch::handle_xrSessionInsertDebugUtilsLabelEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSessionInsertDebugUtilsLabelEXT", function_loader.SessionInsertDebugUtilsLabelEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrDebugUtilsLabelEXT* labelInfo{};
+    const XrDebugUtilsLabelEXT* labelInfo{};
     deserialize_ptr(&labelInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SessionInsertDebugUtilsLabelEXT(session, labelInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(20005, _result);
+        }
+        cleanup(&session);
+        cleanup_ptr(labelInfo, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(labelInfo, 1);
@@ -1171,21 +1680,41 @@ void FunctionDispatch::handle_xrSessionInsertDebugUtilsLabelEXT(MessageLockIn ms
 void FunctionDispatch::handle_xrSetDebugUtilsObjectNameEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetDebugUtilsObjectNameEXT", function_loader.SetDebugUtilsObjectNameEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrDebugUtilsObjectNameInfoEXT* nameInfo{};
+    const XrDebugUtilsObjectNameInfoEXT* nameInfo{};
     deserialize_ptr(&nameInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetDebugUtilsObjectNameEXT(instance, nameInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(20006, _result);
+        }
+        cleanup(&instance);
+        cleanup_ptr(nameInfo, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(nameInfo, 1);
@@ -1194,27 +1723,37 @@ void FunctionDispatch::handle_xrSetDebugUtilsObjectNameEXT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrSubmitDebugUtilsMessageEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSubmitDebugUtilsMessageEXT", function_loader.SubmitDebugUtilsMessageEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrDebugUtilsMessageSeverityFlagsEXT messageSeverity{};
     deserialize(&messageSeverity, d_ctx);
     XrDebugUtilsMessageTypeFlagsEXT messageTypes{};
     deserialize(&messageTypes, d_ctx);
-    XrDebugUtilsMessengerCallbackDataEXT* callbackData{};
+    const XrDebugUtilsMessengerCallbackDataEXT* callbackData{};
     deserialize_ptr(&callbackData, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, callbackData);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(callbackData->objects, callbackData->objectCount, s_ctx);
     serialize_ptr(callbackData->sessionLabels, callbackData->sessionLabelCount, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&messageSeverity);
@@ -1227,21 +1766,31 @@ void FunctionDispatch::handle_xrSubmitDebugUtilsMessageEXT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCancelFutureEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCancelFutureEXT", function_loader.CancelFutureEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrFutureCancelInfoEXT* cancelInfo{};
+    const XrFutureCancelInfoEXT* cancelInfo{};
     deserialize_ptr(&cancelInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CancelFutureEXT(instance, cancelInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(cancelInfo, 1);
@@ -1250,24 +1799,34 @@ void FunctionDispatch::handle_xrCancelFutureEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPollFutureEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPollFutureEXT", function_loader.PollFutureEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrFuturePollInfoEXT* pollInfo{};
+    const XrFuturePollInfoEXT* pollInfo{};
     deserialize_ptr(&pollInfo, d_ctx);
     XrFuturePollResultEXT* pollResult{};
-    deserialize_ptr(&pollResult, d_ctx);
+    deserialize_output_xr_ptr(&pollResult, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PollFutureEXT(instance, pollInfo, pollResult);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(pollResult, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(pollInfo, 1);
@@ -1279,24 +1838,34 @@ void FunctionDispatch::handle_xrPollFutureEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateHandTrackerEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateHandTrackerEXT", function_loader.CreateHandTrackerEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrHandTrackerCreateInfoEXT* createInfo{};
+    const XrHandTrackerCreateInfoEXT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrHandTrackerEXT* handTracker{};
-    deserialize_ptr(&handTracker, d_ctx);
+    deserialize_output_ptr(&handTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateHandTrackerEXT(session, createInfo, handTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(handTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -1306,19 +1875,38 @@ void FunctionDispatch::handle_xrCreateHandTrackerEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyHandTrackerEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyHandTrackerEXT", function_loader.DestroyHandTrackerEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrHandTrackerEXT handTracker{};
     deserialize(&handTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyHandTrackerEXT(handTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(52002, _result);
+        }
+        cleanup(&handTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&handTracker);
 }
@@ -1326,10 +1914,16 @@ void FunctionDispatch::handle_xrDestroyHandTrackerEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateHandJointsEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateHandJointsEXT", function_loader.LocateHandJointsEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    d_ctx.time_offset = sample_time;
     XrHandTrackerEXT handTracker{};
     deserialize(&handTracker, d_ctx);
-    XrHandJointsLocateInfoEXT* locateInfo{};
+    const XrHandJointsLocateInfoEXT* locateInfo{};
     deserialize_ptr(&locateInfo, d_ctx);
     XrHandJointLocationsEXT* locations{};
     deserialize_ptr(&locations, d_ctx);
@@ -1338,12 +1932,17 @@ void FunctionDispatch::handle_xrLocateHandJointsEXT(MessageLockIn msg_in) {
     XrResult _result = function_loader.LocateHandJointsEXT(handTracker, locateInfo, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&handTracker);
     cleanup_ptr(locateInfo, 1);
@@ -1355,7 +1954,12 @@ void FunctionDispatch::handle_xrLocateHandJointsEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPerfSettingsSetPerformanceLevelEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPerfSettingsSetPerformanceLevelEXT", function_loader.PerfSettingsSetPerformanceLevelEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPerfSettingsDomainEXT domain{};
@@ -1366,12 +1970,28 @@ void FunctionDispatch::handle_xrPerfSettingsSetPerformanceLevelEXT(MessageLockIn
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PerfSettingsSetPerformanceLevelEXT(session, domain, level);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(16001, _result);
+        }
+        cleanup(&session);
+        cleanup(&domain);
+        cleanup(&level);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&domain);
@@ -1383,21 +2003,31 @@ void FunctionDispatch::handle_xrPerfSettingsSetPerformanceLevelEXT(MessageLockIn
 void FunctionDispatch::handle_xrBeginPlaneDetectionEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrBeginPlaneDetectionEXT", function_loader.BeginPlaneDetectionEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPlaneDetectorEXT planeDetector{};
     deserialize(&planeDetector, d_ctx);
-    XrPlaneDetectorBeginInfoEXT* beginInfo{};
+    const XrPlaneDetectorBeginInfoEXT* beginInfo{};
     deserialize_ptr(&beginInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.BeginPlaneDetectionEXT(planeDetector, beginInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&planeDetector);
     cleanup_ptr(beginInfo, 1);
@@ -1406,24 +2036,34 @@ void FunctionDispatch::handle_xrBeginPlaneDetectionEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreatePlaneDetectorEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreatePlaneDetectorEXT", function_loader.CreatePlaneDetectorEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrPlaneDetectorCreateInfoEXT* createInfo{};
+    const XrPlaneDetectorCreateInfoEXT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrPlaneDetectorEXT* planeDetector{};
-    deserialize_ptr(&planeDetector, d_ctx);
+    deserialize_output_ptr(&planeDetector, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreatePlaneDetectorEXT(session, createInfo, planeDetector);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(planeDetector, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -1433,19 +2073,38 @@ void FunctionDispatch::handle_xrCreatePlaneDetectorEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyPlaneDetectorEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyPlaneDetectorEXT", function_loader.DestroyPlaneDetectorEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPlaneDetectorEXT planeDetector{};
     deserialize(&planeDetector, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyPlaneDetectorEXT(planeDetector);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(430003, _result);
+        }
+        cleanup(&planeDetector);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&planeDetector);
 }
@@ -1453,22 +2112,32 @@ void FunctionDispatch::handle_xrDestroyPlaneDetectorEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetPlaneDetectionStateEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetPlaneDetectionStateEXT", function_loader.GetPlaneDetectionStateEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPlaneDetectorEXT planeDetector{};
     deserialize(&planeDetector, d_ctx);
     XrPlaneDetectionStateEXT* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetPlaneDetectionStateEXT(planeDetector, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&planeDetector);
     cleanup_ptr(state, 1);
@@ -1477,10 +2146,15 @@ void FunctionDispatch::handle_xrGetPlaneDetectionStateEXT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetPlaneDetectionsEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetPlaneDetectionsEXT", function_loader.GetPlaneDetectionsEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPlaneDetectorEXT planeDetector{};
     deserialize(&planeDetector, d_ctx);
-    XrPlaneDetectorGetInfoEXT* info{};
+    const XrPlaneDetectorGetInfoEXT* info{};
     deserialize_ptr(&info, d_ctx);
     XrPlaneDetectorLocationsEXT* locations{};
     deserialize_ptr(&locations, d_ctx);
@@ -1489,12 +2163,17 @@ void FunctionDispatch::handle_xrGetPlaneDetectionsEXT(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetPlaneDetectionsEXT(planeDetector, info, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&planeDetector);
     cleanup_ptr(info, 1);
@@ -1504,7 +2183,12 @@ void FunctionDispatch::handle_xrGetPlaneDetectionsEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetPlanePolygonBufferEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetPlanePolygonBufferEXT", function_loader.GetPlanePolygonBufferEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPlaneDetectorEXT planeDetector{};
     deserialize(&planeDetector, d_ctx);
     uint64_t planeId{};
@@ -1518,12 +2202,17 @@ void FunctionDispatch::handle_xrGetPlanePolygonBufferEXT(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetPlanePolygonBufferEXT(planeDetector, planeId, polygonBufferIndex, polygonBuffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(polygonBuffer, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&planeDetector);
     cleanup(&planeId);
@@ -1536,30 +2225,40 @@ void FunctionDispatch::handle_xrGetPlanePolygonBufferEXT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrThermalGetTemperatureTrendEXT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrThermalGetTemperatureTrendEXT", function_loader.ThermalGetTemperatureTrendEXT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPerfSettingsDomainEXT domain{};
     deserialize(&domain, d_ctx);
     XrPerfSettingsNotificationLevelEXT* notificationLevel{};
-    deserialize_ptr(&notificationLevel, d_ctx);
+    deserialize_output_ptr(&notificationLevel, d_ctx);
     float* tempHeadroom{};
-    deserialize_ptr(&tempHeadroom, d_ctx);
+    deserialize_output_ptr(&tempHeadroom, d_ctx);
     float* tempSlope{};
-    deserialize_ptr(&tempSlope, d_ctx);
+    deserialize_output_ptr(&tempSlope, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ThermalGetTemperatureTrendEXT(session, domain, notificationLevel, tempHeadroom, tempSlope);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(notificationLevel, 1, s_ctx);
     serialize_ptr(tempHeadroom, 1, s_ctx);
     serialize_ptr(tempSlope, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&domain);
@@ -1573,24 +2272,34 @@ void FunctionDispatch::handle_xrThermalGetTemperatureTrendEXT(MessageLockIn msg_
 void FunctionDispatch::handle_xrCreateBodyTrackerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateBodyTrackerFB", function_loader.CreateBodyTrackerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrBodyTrackerCreateInfoFB* createInfo{};
+    const XrBodyTrackerCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrBodyTrackerFB* bodyTracker{};
-    deserialize_ptr(&bodyTracker, d_ctx);
+    deserialize_output_ptr(&bodyTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateBodyTrackerFB(session, createInfo, bodyTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bodyTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -1600,19 +2309,38 @@ void FunctionDispatch::handle_xrCreateBodyTrackerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyBodyTrackerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyBodyTrackerFB", function_loader.DestroyBodyTrackerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrBodyTrackerFB bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyBodyTrackerFB(bodyTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(77002, _result);
+        }
+        cleanup(&bodyTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
 }
@@ -1620,7 +2348,12 @@ void FunctionDispatch::handle_xrDestroyBodyTrackerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetBodySkeletonFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetBodySkeletonFB", function_loader.GetBodySkeletonFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrBodyTrackerFB bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
     XrBodySkeletonFB* skeleton{};
@@ -1630,12 +2363,17 @@ void FunctionDispatch::handle_xrGetBodySkeletonFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetBodySkeletonFB(bodyTracker, skeleton);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(skeleton, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
     cleanup_ptr(skeleton, 1);
@@ -1644,10 +2382,16 @@ void FunctionDispatch::handle_xrGetBodySkeletonFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateBodyJointsFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateBodyJointsFB", function_loader.LocateBodyJointsFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    d_ctx.time_offset = sample_time;
     XrBodyTrackerFB bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
-    XrBodyJointsLocateInfoFB* locateInfo{};
+    const XrBodyJointsLocateInfoFB* locateInfo{};
     deserialize_ptr(&locateInfo, d_ctx);
     XrBodyJointLocationsFB* locations{};
     deserialize_ptr(&locations, d_ctx);
@@ -1656,12 +2400,17 @@ void FunctionDispatch::handle_xrLocateBodyJointsFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.LocateBodyJointsFB(bodyTracker, locateInfo, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
     cleanup_ptr(locateInfo, 1);
@@ -1673,27 +2422,37 @@ void FunctionDispatch::handle_xrLocateBodyJointsFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateColorSpacesFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateColorSpacesFB", function_loader.EnumerateColorSpacesFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint32_t colorSpaceCapacityInput{};
     deserialize(&colorSpaceCapacityInput, d_ctx);
     uint32_t* colorSpaceCountOutput{};
-    deserialize_ptr(&colorSpaceCountOutput, d_ctx);
+    deserialize_output_ptr(&colorSpaceCountOutput, d_ctx);
     XrColorSpaceFB* colorSpaces{};
-    deserialize_ptr(&colorSpaces, d_ctx);
+    deserialize_output_ptr(&colorSpaces, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateColorSpacesFB(session, colorSpaceCapacityInput, colorSpaceCountOutput, colorSpaces);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(colorSpaceCountOutput, 1, s_ctx);
-    serialize_ptr(colorSpaces, colorSpaceCapacityInput, s_ctx);
+    serialize_filled_ptr(colorSpaces, colorSpaceCapacityInput, XR_SUCCEEDED(_result) && colorSpaceCountOutput ? *colorSpaceCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&colorSpaceCapacityInput);
@@ -1704,7 +2463,12 @@ void FunctionDispatch::handle_xrEnumerateColorSpacesFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSetColorSpaceFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetColorSpaceFB", function_loader.SetColorSpaceFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrColorSpaceFB colorSpace{};
@@ -1714,11 +2478,16 @@ void FunctionDispatch::handle_xrSetColorSpaceFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.SetColorSpaceFB(session, colorSpace);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&colorSpace);
@@ -1729,27 +2498,37 @@ void FunctionDispatch::handle_xrSetColorSpaceFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateDisplayRefreshRatesFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateDisplayRefreshRatesFB", function_loader.EnumerateDisplayRefreshRatesFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint32_t displayRefreshRateCapacityInput{};
     deserialize(&displayRefreshRateCapacityInput, d_ctx);
     uint32_t* displayRefreshRateCountOutput{};
-    deserialize_ptr(&displayRefreshRateCountOutput, d_ctx);
+    deserialize_output_ptr(&displayRefreshRateCountOutput, d_ctx);
     float* displayRefreshRates{};
-    deserialize_ptr(&displayRefreshRates, d_ctx);
+    deserialize_output_ptr(&displayRefreshRates, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateDisplayRefreshRatesFB(session, displayRefreshRateCapacityInput, displayRefreshRateCountOutput, displayRefreshRates);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(displayRefreshRateCountOutput, 1, s_ctx);
-    serialize_ptr(displayRefreshRates, displayRefreshRateCapacityInput, s_ctx);
+    serialize_filled_ptr(displayRefreshRates, displayRefreshRateCapacityInput, XR_SUCCEEDED(_result) && displayRefreshRateCountOutput ? *displayRefreshRateCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&displayRefreshRateCapacityInput);
@@ -1760,22 +2539,32 @@ void FunctionDispatch::handle_xrEnumerateDisplayRefreshRatesFB(MessageLockIn msg
 void FunctionDispatch::handle_xrGetDisplayRefreshRateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetDisplayRefreshRateFB", function_loader.GetDisplayRefreshRateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     float* displayRefreshRate{};
-    deserialize_ptr(&displayRefreshRate, d_ctx);
+    deserialize_output_ptr(&displayRefreshRate, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetDisplayRefreshRateFB(session, displayRefreshRate);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(displayRefreshRate, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(displayRefreshRate, 1);
@@ -1784,7 +2573,12 @@ void FunctionDispatch::handle_xrGetDisplayRefreshRateFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrRequestDisplayRefreshRateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestDisplayRefreshRateFB", function_loader.RequestDisplayRefreshRateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     float displayRefreshRate{};
@@ -1794,11 +2588,16 @@ void FunctionDispatch::handle_xrRequestDisplayRefreshRateFB(MessageLockIn msg_in
     XrResult _result = function_loader.RequestDisplayRefreshRateFB(session, displayRefreshRate);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&displayRefreshRate);
@@ -1809,24 +2608,34 @@ void FunctionDispatch::handle_xrRequestDisplayRefreshRateFB(MessageLockIn msg_in
 void FunctionDispatch::handle_xrCreateEyeTrackerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateEyeTrackerFB", function_loader.CreateEyeTrackerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrEyeTrackerCreateInfoFB* createInfo{};
+    const XrEyeTrackerCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrEyeTrackerFB* eyeTracker{};
-    deserialize_ptr(&eyeTracker, d_ctx);
+    deserialize_output_ptr(&eyeTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateEyeTrackerFB(session, createInfo, eyeTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(eyeTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -1836,19 +2645,38 @@ void FunctionDispatch::handle_xrCreateEyeTrackerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyEyeTrackerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyEyeTrackerFB", function_loader.DestroyEyeTrackerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEyeTrackerFB eyeTracker{};
     deserialize(&eyeTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyEyeTrackerFB(eyeTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(203002, _result);
+        }
+        cleanup(&eyeTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&eyeTracker);
 }
@@ -1856,24 +2684,35 @@ void FunctionDispatch::handle_xrDestroyEyeTrackerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetEyeGazesFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetEyeGazesFB", function_loader.GetEyeGazesFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    d_ctx.time_offset = sample_time;
     XrEyeTrackerFB eyeTracker{};
     deserialize(&eyeTracker, d_ctx);
-    XrEyeGazesInfoFB* gazeInfo{};
+    const XrEyeGazesInfoFB* gazeInfo{};
     deserialize_ptr(&gazeInfo, d_ctx);
     XrEyeGazesFB* eyeGazes{};
-    deserialize_ptr(&eyeGazes, d_ctx);
+    deserialize_output_xr_ptr(&eyeGazes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetEyeGazesFB(eyeTracker, gazeInfo, eyeGazes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(eyeGazes, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&eyeTracker);
     cleanup_ptr(gazeInfo, 1);
@@ -1885,24 +2724,34 @@ void FunctionDispatch::handle_xrGetEyeGazesFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateFaceTrackerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateFaceTrackerFB", function_loader.CreateFaceTrackerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFaceTrackerCreateInfoFB* createInfo{};
+    const XrFaceTrackerCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrFaceTrackerFB* faceTracker{};
-    deserialize_ptr(&faceTracker, d_ctx);
+    deserialize_output_ptr(&faceTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateFaceTrackerFB(session, createInfo, faceTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(faceTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -1912,19 +2761,38 @@ void FunctionDispatch::handle_xrCreateFaceTrackerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyFaceTrackerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyFaceTrackerFB", function_loader.DestroyFaceTrackerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFaceTrackerFB faceTracker{};
     deserialize(&faceTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyFaceTrackerFB(faceTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(202002, _result);
+        }
+        cleanup(&faceTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&faceTracker);
 }
@@ -1932,10 +2800,15 @@ void FunctionDispatch::handle_xrDestroyFaceTrackerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetFaceExpressionWeightsFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetFaceExpressionWeightsFB", function_loader.GetFaceExpressionWeightsFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFaceTrackerFB faceTracker{};
     deserialize(&faceTracker, d_ctx);
-    XrFaceExpressionInfoFB* expressionInfo{};
+    const XrFaceExpressionInfoFB* expressionInfo{};
     deserialize_ptr(&expressionInfo, d_ctx);
     XrFaceExpressionWeightsFB* expressionWeights{};
     deserialize_ptr(&expressionWeights, d_ctx);
@@ -1944,12 +2817,17 @@ void FunctionDispatch::handle_xrGetFaceExpressionWeightsFB(MessageLockIn msg_in)
     XrResult _result = function_loader.GetFaceExpressionWeightsFB(faceTracker, expressionInfo, expressionWeights);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(expressionWeights, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&faceTracker);
     cleanup_ptr(expressionInfo, 1);
@@ -1961,25 +2839,35 @@ void FunctionDispatch::handle_xrGetFaceExpressionWeightsFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCreateFaceTracker2FB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateFaceTracker2FB", function_loader.CreateFaceTracker2FB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFaceTrackerCreateInfo2FB* createInfo{};
+    const XrFaceTrackerCreateInfo2FB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrFaceTracker2FB* faceTracker{};
-    deserialize_ptr(&faceTracker, d_ctx);
+    deserialize_output_ptr(&faceTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateFaceTracker2FB(session, createInfo, faceTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(createInfo->requestedDataSources, createInfo->requestedDataSourceCount, s_ctx);
     serialize_ptr(faceTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -1989,19 +2877,38 @@ void FunctionDispatch::handle_xrCreateFaceTracker2FB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyFaceTracker2FB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyFaceTracker2FB", function_loader.DestroyFaceTracker2FB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFaceTracker2FB faceTracker{};
     deserialize(&faceTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyFaceTracker2FB(faceTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(288002, _result);
+        }
+        cleanup(&faceTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&faceTracker);
 }
@@ -2009,10 +2916,16 @@ void FunctionDispatch::handle_xrDestroyFaceTracker2FB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetFaceExpressionWeights2FB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetFaceExpressionWeights2FB", function_loader.GetFaceExpressionWeights2FB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    d_ctx.time_offset = sample_time;
     XrFaceTracker2FB faceTracker{};
     deserialize(&faceTracker, d_ctx);
-    XrFaceExpressionInfo2FB* expressionInfo{};
+    const XrFaceExpressionInfo2FB* expressionInfo{};
     deserialize_ptr(&expressionInfo, d_ctx);
     XrFaceExpressionWeights2FB* expressionWeights{};
     deserialize_ptr(&expressionWeights, d_ctx);
@@ -2021,12 +2934,17 @@ void FunctionDispatch::handle_xrGetFaceExpressionWeights2FB(MessageLockIn msg_in
     XrResult _result = function_loader.GetFaceExpressionWeights2FB(faceTracker, expressionInfo, expressionWeights);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(expressionWeights, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&faceTracker);
     cleanup_ptr(expressionInfo, 1);
@@ -2038,25 +2956,35 @@ void FunctionDispatch::handle_xrGetFaceExpressionWeights2FB(MessageLockIn msg_in
 void FunctionDispatch::handle_xrCreateFoveationProfileFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateFoveationProfileFB", function_loader.CreateFoveationProfileFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFoveationProfileCreateInfoFB* createInfo{};
+    const XrFoveationProfileCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrFoveationProfileFB* profile{};
-    deserialize_ptr(&profile, d_ctx);
+    deserialize_output_ptr(&profile, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateFoveationProfileFB(session, createInfo, profile);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(createInfo->next, s_ctx);
     serialize_ptr(profile, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -2066,19 +2994,38 @@ void FunctionDispatch::handle_xrCreateFoveationProfileFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyFoveationProfileFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyFoveationProfileFB", function_loader.DestroyFoveationProfileFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFoveationProfileFB profile{};
     deserialize(&profile, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyFoveationProfileFB(profile);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(115002, _result);
+        }
+        cleanup(&profile);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&profile);
 }
@@ -2088,7 +3035,12 @@ void FunctionDispatch::handle_xrDestroyFoveationProfileFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetHandMeshFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetHandMeshFB", function_loader.GetHandMeshFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrHandTrackerEXT handTracker{};
     deserialize(&handTracker, d_ctx);
     XrHandTrackingMeshFB* mesh{};
@@ -2098,12 +3050,17 @@ void FunctionDispatch::handle_xrGetHandMeshFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetHandMeshFB(handTracker, mesh);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(mesh, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&handTracker);
     cleanup_ptr(mesh, 1);
@@ -2114,24 +3071,34 @@ void FunctionDispatch::handle_xrGetHandMeshFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetDeviceSampleRateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetDeviceSampleRateFB", function_loader.GetDeviceSampleRateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrHapticActionInfo* hapticActionInfo{};
+    const XrHapticActionInfo* hapticActionInfo{};
     deserialize_ptr(&hapticActionInfo, d_ctx);
     XrDevicePcmSampleRateGetInfoFB* deviceSampleRate{};
-    deserialize_ptr(&deviceSampleRate, d_ctx);
+    deserialize_output_ptr(&deviceSampleRate, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetDeviceSampleRateFB(session, hapticActionInfo, deviceSampleRate);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(deviceSampleRate, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(hapticActionInfo, 1);
@@ -2143,25 +3110,35 @@ void FunctionDispatch::handle_xrGetDeviceSampleRateFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateKeyboardSpaceFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateKeyboardSpaceFB", function_loader.CreateKeyboardSpaceFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrKeyboardSpaceCreateInfoFB* createInfo{};
+    const XrKeyboardSpaceCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* keyboardSpace{};
-    deserialize_ptr(&keyboardSpace, d_ctx);
+    deserialize_output_ptr(&keyboardSpace, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateKeyboardSpaceFB(session, createInfo, keyboardSpace);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(createInfo->next, s_ctx);
     serialize_ptr(keyboardSpace, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -2171,25 +3148,35 @@ void FunctionDispatch::handle_xrCreateKeyboardSpaceFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrQuerySystemTrackedKeyboardFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQuerySystemTrackedKeyboardFB", function_loader.QuerySystemTrackedKeyboardFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrKeyboardTrackingQueryFB* queryInfo{};
+    const XrKeyboardTrackingQueryFB* queryInfo{};
     deserialize_ptr(&queryInfo, d_ctx);
     XrKeyboardTrackingDescriptionFB* keyboard{};
-    deserialize_ptr(&keyboard, d_ctx);
+    deserialize_output_ptr(&keyboard, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QuerySystemTrackedKeyboardFB(session, queryInfo, keyboard);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(queryInfo->next, s_ctx);
     serialize_ptr(keyboard, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(queryInfo, 1);
@@ -2201,24 +3188,34 @@ void FunctionDispatch::handle_xrQuerySystemTrackedKeyboardFB(MessageLockIn msg_i
 void FunctionDispatch::handle_xrCreateGeometryInstanceFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateGeometryInstanceFB", function_loader.CreateGeometryInstanceFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrGeometryInstanceCreateInfoFB* createInfo{};
+    const XrGeometryInstanceCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrGeometryInstanceFB* outGeometryInstance{};
-    deserialize_ptr(&outGeometryInstance, d_ctx);
+    deserialize_output_ptr(&outGeometryInstance, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateGeometryInstanceFB(session, createInfo, outGeometryInstance);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outGeometryInstance, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -2228,24 +3225,34 @@ void FunctionDispatch::handle_xrCreateGeometryInstanceFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreatePassthroughFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreatePassthroughFB", function_loader.CreatePassthroughFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrPassthroughCreateInfoFB* createInfo{};
+    const XrPassthroughCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrPassthroughFB* outPassthrough{};
-    deserialize_ptr(&outPassthrough, d_ctx);
+    deserialize_output_ptr(&outPassthrough, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreatePassthroughFB(session, createInfo, outPassthrough);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outPassthrough, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -2255,24 +3262,34 @@ void FunctionDispatch::handle_xrCreatePassthroughFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreatePassthroughLayerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreatePassthroughLayerFB", function_loader.CreatePassthroughLayerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrPassthroughLayerCreateInfoFB* createInfo{};
+    const XrPassthroughLayerCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrPassthroughLayerFB* outLayer{};
-    deserialize_ptr(&outLayer, d_ctx);
+    deserialize_output_ptr(&outLayer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreatePassthroughLayerFB(session, createInfo, outLayer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outLayer, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -2282,19 +3299,38 @@ void FunctionDispatch::handle_xrCreatePassthroughLayerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyGeometryInstanceFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyGeometryInstanceFB", function_loader.DestroyGeometryInstanceFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrGeometryInstanceFB instance{};
     deserialize(&instance, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyGeometryInstanceFB(instance);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(119004, _result);
+        }
+        cleanup(&instance);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
 }
@@ -2302,19 +3338,38 @@ void FunctionDispatch::handle_xrDestroyGeometryInstanceFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrDestroyPassthroughFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyPassthroughFB", function_loader.DestroyPassthroughFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughFB passthrough{};
     deserialize(&passthrough, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyPassthroughFB(passthrough);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(119005, _result);
+        }
+        cleanup(&passthrough);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&passthrough);
 }
@@ -2322,19 +3377,38 @@ void FunctionDispatch::handle_xrDestroyPassthroughFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyPassthroughLayerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyPassthroughLayerFB", function_loader.DestroyPassthroughLayerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughLayerFB layer{};
     deserialize(&layer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyPassthroughLayerFB(layer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(119006, _result);
+        }
+        cleanup(&layer);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&layer);
 }
@@ -2342,21 +3416,31 @@ void FunctionDispatch::handle_xrDestroyPassthroughLayerFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGeometryInstanceSetTransformFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGeometryInstanceSetTransformFB", function_loader.GeometryInstanceSetTransformFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrGeometryInstanceFB instance{};
     deserialize(&instance, d_ctx);
-    XrGeometryInstanceTransformFB* transformation{};
+    const XrGeometryInstanceTransformFB* transformation{};
     deserialize_ptr(&transformation, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GeometryInstanceSetTransformFB(instance, transformation);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(transformation, 1);
@@ -2365,7 +3449,12 @@ void FunctionDispatch::handle_xrGeometryInstanceSetTransformFB(MessageLockIn msg
 void FunctionDispatch::handle_xrPassthroughLayerPauseFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPassthroughLayerPauseFB", function_loader.PassthroughLayerPauseFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughLayerFB layer{};
     deserialize(&layer, d_ctx);
 
@@ -2373,11 +3462,16 @@ void FunctionDispatch::handle_xrPassthroughLayerPauseFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.PassthroughLayerPauseFB(layer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&layer);
 }
@@ -2385,7 +3479,12 @@ void FunctionDispatch::handle_xrPassthroughLayerPauseFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPassthroughLayerResumeFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPassthroughLayerResumeFB", function_loader.PassthroughLayerResumeFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughLayerFB layer{};
     deserialize(&layer, d_ctx);
 
@@ -2393,11 +3492,16 @@ void FunctionDispatch::handle_xrPassthroughLayerResumeFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.PassthroughLayerResumeFB(layer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&layer);
 }
@@ -2405,21 +3509,31 @@ void FunctionDispatch::handle_xrPassthroughLayerResumeFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPassthroughLayerSetStyleFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPassthroughLayerSetStyleFB", function_loader.PassthroughLayerSetStyleFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughLayerFB layer{};
     deserialize(&layer, d_ctx);
-    XrPassthroughStyleFB* style{};
+    const XrPassthroughStyleFB* style{};
     deserialize_ptr(&style, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PassthroughLayerSetStyleFB(layer, style);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&layer);
     cleanup_ptr(style, 1);
@@ -2428,7 +3542,12 @@ void FunctionDispatch::handle_xrPassthroughLayerSetStyleFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrPassthroughPauseFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPassthroughPauseFB", function_loader.PassthroughPauseFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughFB passthrough{};
     deserialize(&passthrough, d_ctx);
 
@@ -2436,11 +3555,16 @@ void FunctionDispatch::handle_xrPassthroughPauseFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.PassthroughPauseFB(passthrough);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&passthrough);
 }
@@ -2448,7 +3572,12 @@ void FunctionDispatch::handle_xrPassthroughPauseFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPassthroughStartFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPassthroughStartFB", function_loader.PassthroughStartFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughFB passthrough{};
     deserialize(&passthrough, d_ctx);
 
@@ -2456,11 +3585,16 @@ void FunctionDispatch::handle_xrPassthroughStartFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.PassthroughStartFB(passthrough);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&passthrough);
 }
@@ -2470,21 +3604,31 @@ void FunctionDispatch::handle_xrPassthroughStartFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPassthroughLayerSetKeyboardHandsIntensityFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPassthroughLayerSetKeyboardHandsIntensityFB", function_loader.PassthroughLayerSetKeyboardHandsIntensityFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughLayerFB layer{};
     deserialize(&layer, d_ctx);
-    XrPassthroughKeyboardHandsIntensityFB* intensity{};
+    const XrPassthroughKeyboardHandsIntensityFB* intensity{};
     deserialize_ptr(&intensity, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PassthroughLayerSetKeyboardHandsIntensityFB(layer, intensity);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&layer);
     cleanup_ptr(intensity, 1);
@@ -2495,27 +3639,37 @@ void FunctionDispatch::handle_xrPassthroughLayerSetKeyboardHandsIntensityFB(Mess
 void FunctionDispatch::handle_xrEnumerateRenderModelPathsFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateRenderModelPathsFB", function_loader.EnumerateRenderModelPathsFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint32_t pathCapacityInput{};
     deserialize(&pathCapacityInput, d_ctx);
     uint32_t* pathCountOutput{};
-    deserialize_ptr(&pathCountOutput, d_ctx);
+    deserialize_output_ptr(&pathCountOutput, d_ctx);
     XrRenderModelPathInfoFB* paths{};
-    deserialize_ptr(&paths, d_ctx);
+    deserialize_output_xr_ptr(&paths, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateRenderModelPathsFB(session, pathCapacityInput, pathCountOutput, paths);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(pathCountOutput, 1, s_ctx);
-    serialize_ptr(paths, pathCapacityInput, s_ctx);
+    serialize_filled_ptr(paths, pathCapacityInput, XR_SUCCEEDED(_result) && pathCountOutput ? *pathCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&pathCapacityInput);
@@ -2526,24 +3680,34 @@ void FunctionDispatch::handle_xrEnumerateRenderModelPathsFB(MessageLockIn msg_in
 void FunctionDispatch::handle_xrGetRenderModelPropertiesFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetRenderModelPropertiesFB", function_loader.GetRenderModelPropertiesFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath path{};
     deserialize(&path, d_ctx);
     XrRenderModelPropertiesFB* properties{};
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_output_xr_ptr(&properties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetRenderModelPropertiesFB(session, path, properties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(properties, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&path);
@@ -2553,10 +3717,15 @@ void FunctionDispatch::handle_xrGetRenderModelPropertiesFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrLoadRenderModelFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLoadRenderModelFB", function_loader.LoadRenderModelFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrRenderModelLoadInfoFB* info{};
+    const XrRenderModelLoadInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrRenderModelBufferFB* buffer{};
     deserialize_ptr(&buffer, d_ctx);
@@ -2565,13 +3734,18 @@ void FunctionDispatch::handle_xrLoadRenderModelFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.LoadRenderModelFB(session, info, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(info->next, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -2583,7 +3757,12 @@ void FunctionDispatch::handle_xrLoadRenderModelFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpaceBoundary2DFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceBoundary2DFB", function_loader.GetSpaceBoundary2DFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpace space{};
@@ -2595,12 +3774,17 @@ void FunctionDispatch::handle_xrGetSpaceBoundary2DFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSpaceBoundary2DFB(session, space, boundary2DOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(boundary2DOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&space);
@@ -2610,24 +3794,34 @@ void FunctionDispatch::handle_xrGetSpaceBoundary2DFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpaceBoundingBox2DFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceBoundingBox2DFB", function_loader.GetSpaceBoundingBox2DFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpace space{};
     deserialize(&space, d_ctx);
     XrRect2Df* boundingBox2DOutput{};
-    deserialize_ptr(&boundingBox2DOutput, d_ctx);
+    deserialize_output_ptr(&boundingBox2DOutput, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpaceBoundingBox2DFB(session, space, boundingBox2DOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(boundingBox2DOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&space);
@@ -2637,24 +3831,34 @@ void FunctionDispatch::handle_xrGetSpaceBoundingBox2DFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpaceBoundingBox3DFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceBoundingBox3DFB", function_loader.GetSpaceBoundingBox3DFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpace space{};
     deserialize(&space, d_ctx);
     XrRect3DfFB* boundingBox3DOutput{};
-    deserialize_ptr(&boundingBox3DOutput, d_ctx);
+    deserialize_output_ptr(&boundingBox3DOutput, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpaceBoundingBox3DFB(session, space, boundingBox3DOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(boundingBox3DOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&space);
@@ -2664,7 +3868,12 @@ void FunctionDispatch::handle_xrGetSpaceBoundingBox3DFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpaceRoomLayoutFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceRoomLayoutFB", function_loader.GetSpaceRoomLayoutFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpace space{};
@@ -2676,12 +3885,17 @@ void FunctionDispatch::handle_xrGetSpaceRoomLayoutFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSpaceRoomLayoutFB(session, space, roomLayoutOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(roomLayoutOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&space);
@@ -2691,7 +3905,12 @@ void FunctionDispatch::handle_xrGetSpaceRoomLayoutFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpaceSemanticLabelsFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceSemanticLabelsFB", function_loader.GetSpaceSemanticLabelsFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpace space{};
@@ -2703,12 +3922,17 @@ void FunctionDispatch::handle_xrGetSpaceSemanticLabelsFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSpaceSemanticLabelsFB(session, space, semanticLabelsOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(semanticLabelsOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&space);
@@ -2720,24 +3944,34 @@ void FunctionDispatch::handle_xrGetSpaceSemanticLabelsFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrRequestSceneCaptureFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestSceneCaptureFB", function_loader.RequestSceneCaptureFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSceneCaptureRequestInfoFB* info{};
+    const XrSceneCaptureRequestInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.RequestSceneCaptureFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -2749,24 +3983,34 @@ void FunctionDispatch::handle_xrRequestSceneCaptureFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpatialAnchorFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorFB", function_loader.CreateSpatialAnchorFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorCreateInfoFB* info{};
+    const XrSpatialAnchorCreateInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -2776,27 +4020,37 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateSpaceSupportedComponentsFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateSpaceSupportedComponentsFB", function_loader.EnumerateSpaceSupportedComponentsFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
     uint32_t componentTypeCapacityInput{};
     deserialize(&componentTypeCapacityInput, d_ctx);
     uint32_t* componentTypeCountOutput{};
-    deserialize_ptr(&componentTypeCountOutput, d_ctx);
+    deserialize_output_ptr(&componentTypeCountOutput, d_ctx);
     XrSpaceComponentTypeFB* componentTypes{};
-    deserialize_ptr(&componentTypes, d_ctx);
+    deserialize_output_ptr(&componentTypes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateSpaceSupportedComponentsFB(space, componentTypeCapacityInput, componentTypeCountOutput, componentTypes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(componentTypeCountOutput, 1, s_ctx);
-    serialize_ptr(componentTypes, componentTypeCapacityInput, s_ctx);
+    serialize_filled_ptr(componentTypes, componentTypeCapacityInput, XR_SUCCEEDED(_result) && componentTypeCountOutput ? *componentTypeCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
     cleanup(&componentTypeCapacityInput);
@@ -2807,24 +4061,34 @@ void FunctionDispatch::handle_xrEnumerateSpaceSupportedComponentsFB(MessageLockI
 void FunctionDispatch::handle_xrGetSpaceComponentStatusFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceComponentStatusFB", function_loader.GetSpaceComponentStatusFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
     XrSpaceComponentTypeFB componentType{};
     deserialize(&componentType, d_ctx);
     XrSpaceComponentStatusFB* status{};
-    deserialize_ptr(&status, d_ctx);
+    deserialize_output_xr_ptr(&status, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpaceComponentStatusFB(space, componentType, status);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(status, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
     cleanup(&componentType);
@@ -2834,22 +4098,32 @@ void FunctionDispatch::handle_xrGetSpaceComponentStatusFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetSpaceUuidFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceUuidFB", function_loader.GetSpaceUuidFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
     XrUuidEXT* uuid{};
-    deserialize_ptr(&uuid, d_ctx);
+    deserialize_output_ptr(&uuid, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpaceUuidFB(space, uuid);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(uuid, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
     cleanup_ptr(uuid, 1);
@@ -2858,24 +4132,34 @@ void FunctionDispatch::handle_xrGetSpaceUuidFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSetSpaceComponentStatusFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetSpaceComponentStatusFB", function_loader.SetSpaceComponentStatusFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
-    XrSpaceComponentStatusSetInfoFB* info{};
+    const XrSpaceComponentStatusSetInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetSpaceComponentStatusFB(space, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
     cleanup_ptr(info, 1);
@@ -2887,7 +4171,12 @@ void FunctionDispatch::handle_xrSetSpaceComponentStatusFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetSpaceContainerFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceContainerFB", function_loader.GetSpaceContainerFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpace space{};
@@ -2899,12 +4188,17 @@ void FunctionDispatch::handle_xrGetSpaceContainerFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSpaceContainerFB(session, space, spaceContainerOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(spaceContainerOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&space);
@@ -2916,24 +4210,34 @@ void FunctionDispatch::handle_xrGetSpaceContainerFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrQuerySpacesFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQuerySpacesFB", function_loader.QuerySpacesFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpaceQueryInfoBaseHeaderFB* info{};
+    const XrSpaceQueryInfoBaseHeaderFB* info{};
     deserialize_xr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QuerySpacesFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_xr(info);
@@ -2943,7 +4247,12 @@ void FunctionDispatch::handle_xrQuerySpacesFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrRetrieveSpaceQueryResultsFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRetrieveSpaceQueryResultsFB", function_loader.RetrieveSpaceQueryResultsFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrAsyncRequestIdFB requestId{};
@@ -2955,12 +4264,17 @@ void FunctionDispatch::handle_xrRetrieveSpaceQueryResultsFB(MessageLockIn msg_in
     XrResult _result = function_loader.RetrieveSpaceQueryResultsFB(session, requestId, results);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(results, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&requestId);
@@ -2972,26 +4286,36 @@ void FunctionDispatch::handle_xrRetrieveSpaceQueryResultsFB(MessageLockIn msg_in
 void FunctionDispatch::handle_xrShareSpacesFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrShareSpacesFB", function_loader.ShareSpacesFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpaceShareInfoFB* info{};
+    const XrSpaceShareInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ShareSpacesFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(info->spaces, info->spaceCount, s_ctx);
     serialize_ptr(info->users, info->userCount, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -3003,24 +4327,34 @@ void FunctionDispatch::handle_xrShareSpacesFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEraseSpaceFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEraseSpaceFB", function_loader.EraseSpaceFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpaceEraseInfoFB* info{};
+    const XrSpaceEraseInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EraseSpaceFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -3030,24 +4364,34 @@ void FunctionDispatch::handle_xrEraseSpaceFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSaveSpaceFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSaveSpaceFB", function_loader.SaveSpaceFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpaceSaveInfoFB* info{};
+    const XrSpaceSaveInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SaveSpaceFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -3059,25 +4403,35 @@ void FunctionDispatch::handle_xrSaveSpaceFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSaveSpaceListFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSaveSpaceListFB", function_loader.SaveSpaceListFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpaceListSaveInfoFB* info{};
+    const XrSpaceListSaveInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SaveSpaceListFB(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(info->spaces, info->spaceCount, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -3089,24 +4443,34 @@ void FunctionDispatch::handle_xrSaveSpaceListFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpaceUserFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpaceUserFB", function_loader.CreateSpaceUserFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpaceUserCreateInfoFB* info{};
+    const XrSpaceUserCreateInfoFB* info{};
     deserialize_ptr(&info, d_ctx);
     XrSpaceUserFB* user{};
-    deserialize_ptr(&user, d_ctx);
+    deserialize_output_ptr(&user, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpaceUserFB(session, info, user);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(user, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -3116,19 +4480,38 @@ void FunctionDispatch::handle_xrCreateSpaceUserFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySpaceUserFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySpaceUserFB", function_loader.DestroySpaceUserFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpaceUserFB user{};
     deserialize(&user, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySpaceUserFB(user);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(242002, _result);
+        }
+        cleanup(&user);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&user);
 }
@@ -3136,22 +4519,32 @@ void FunctionDispatch::handle_xrDestroySpaceUserFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpaceUserIdFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceUserIdFB", function_loader.GetSpaceUserIdFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpaceUserFB user{};
     deserialize(&user, d_ctx);
     XrSpaceUserIdFB* userId{};
-    deserialize_ptr(&userId, d_ctx);
+    deserialize_output_ptr(&userId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpaceUserIdFB(user, userId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(userId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&user);
     cleanup_ptr(userId, 1);
@@ -3162,7 +4555,12 @@ void FunctionDispatch::handle_xrGetSpaceUserIdFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSwapchainStateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSwapchainStateFB", function_loader.GetSwapchainStateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
     XrSwapchainStateBaseHeaderFB* state{};
@@ -3172,12 +4570,17 @@ void FunctionDispatch::handle_xrGetSwapchainStateFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSwapchainStateFB(swapchain, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(state, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup_xr(state);
@@ -3186,21 +4589,31 @@ void FunctionDispatch::handle_xrGetSwapchainStateFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrUpdateSwapchainFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUpdateSwapchainFB", function_loader.UpdateSwapchainFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
-    XrSwapchainStateBaseHeaderFB* state{};
+    const XrSwapchainStateBaseHeaderFB* state{};
     deserialize_xr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UpdateSwapchainFB(swapchain, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup_xr(state);
@@ -3211,24 +4624,34 @@ void FunctionDispatch::handle_xrUpdateSwapchainFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateTriangleMeshFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateTriangleMeshFB", function_loader.CreateTriangleMeshFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrTriangleMeshCreateInfoFB* createInfo{};
+    const XrTriangleMeshCreateInfoFB* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrTriangleMeshFB* outTriangleMesh{};
-    deserialize_ptr(&outTriangleMesh, d_ctx);
+    deserialize_output_ptr(&outTriangleMesh, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateTriangleMeshFB(session, createInfo, outTriangleMesh);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outTriangleMesh, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -3238,19 +4661,38 @@ void FunctionDispatch::handle_xrCreateTriangleMeshFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyTriangleMeshFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyTriangleMeshFB", function_loader.DestroyTriangleMeshFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyTriangleMeshFB(mesh);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(118002, _result);
+        }
+        cleanup(&mesh);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
 }
@@ -3258,7 +4700,12 @@ void FunctionDispatch::handle_xrDestroyTriangleMeshFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrTriangleMeshBeginUpdateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTriangleMeshBeginUpdateFB", function_loader.TriangleMeshBeginUpdateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
 
@@ -3266,11 +4713,16 @@ void FunctionDispatch::handle_xrTriangleMeshBeginUpdateFB(MessageLockIn msg_in)
     XrResult _result = function_loader.TriangleMeshBeginUpdateFB(mesh);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
 }
@@ -3278,22 +4730,32 @@ void FunctionDispatch::handle_xrTriangleMeshBeginUpdateFB(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrTriangleMeshBeginVertexBufferUpdateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTriangleMeshBeginVertexBufferUpdateFB", function_loader.TriangleMeshBeginVertexBufferUpdateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
     uint32_t* outVertexCount{};
-    deserialize_ptr(&outVertexCount, d_ctx);
+    deserialize_output_ptr(&outVertexCount, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.TriangleMeshBeginVertexBufferUpdateFB(mesh, outVertexCount);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outVertexCount, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
     cleanup_ptr(outVertexCount, 1);
@@ -3302,7 +4764,12 @@ void FunctionDispatch::handle_xrTriangleMeshBeginVertexBufferUpdateFB(MessageLoc
 void FunctionDispatch::handle_xrTriangleMeshEndUpdateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTriangleMeshEndUpdateFB", function_loader.TriangleMeshEndUpdateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
     uint32_t vertexCount{};
@@ -3314,11 +4781,16 @@ void FunctionDispatch::handle_xrTriangleMeshEndUpdateFB(MessageLockIn msg_in) {
     XrResult _result = function_loader.TriangleMeshEndUpdateFB(mesh, vertexCount, triangleCount);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
     cleanup(&vertexCount);
@@ -3328,7 +4800,12 @@ void FunctionDispatch::handle_xrTriangleMeshEndUpdateFB(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrTriangleMeshEndVertexBufferUpdateFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTriangleMeshEndVertexBufferUpdateFB", function_loader.TriangleMeshEndVertexBufferUpdateFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
 
@@ -3336,11 +4813,16 @@ void FunctionDispatch::handle_xrTriangleMeshEndVertexBufferUpdateFB(MessageLockI
     XrResult _result = function_loader.TriangleMeshEndVertexBufferUpdateFB(mesh);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
 }
@@ -3348,7 +4830,12 @@ void FunctionDispatch::handle_xrTriangleMeshEndVertexBufferUpdateFB(MessageLockI
 void FunctionDispatch::handle_xrTriangleMeshGetIndexBufferFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTriangleMeshGetIndexBufferFB", function_loader.TriangleMeshGetIndexBufferFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
     uint32_t** outIndexBuffer{};
@@ -3358,12 +4845,17 @@ void FunctionDispatch::handle_xrTriangleMeshGetIndexBufferFB(MessageLockIn msg_i
     XrResult _result = function_loader.TriangleMeshGetIndexBufferFB(mesh, outIndexBuffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outIndexBuffer, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
     #error "auto-generator doesn't support double pointers (outIndexBuffer)"None
@@ -3372,7 +4864,12 @@ void FunctionDispatch::handle_xrTriangleMeshGetIndexBufferFB(MessageLockIn msg_i
 void FunctionDispatch::handle_xrTriangleMeshGetVertexBufferFB(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTriangleMeshGetVertexBufferFB", function_loader.TriangleMeshGetVertexBufferFB);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrTriangleMeshFB mesh{};
     deserialize(&mesh, d_ctx);
     XrVector3f** outVertexBuffer{};
@@ -3382,12 +4879,17 @@ void FunctionDispatch::handle_xrTriangleMeshGetVertexBufferFB(MessageLockIn msg_
     XrResult _result = function_loader.TriangleMeshGetVertexBufferFB(mesh, outVertexBuffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(outVertexBuffer, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&mesh);
     #error "auto-generator doesn't support double pointers (outVertexBuffer)"None
@@ -3398,27 +4900,37 @@ void FunctionDispatch::handle_xrTriangleMeshGetVertexBufferFB(MessageLockIn msg_
 void FunctionDispatch::handle_xrEnumerateViveTrackerPathsHTCX(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateViveTrackerPathsHTCX", function_loader.EnumerateViveTrackerPathsHTCX);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     uint32_t pathCapacityInput{};
     deserialize(&pathCapacityInput, d_ctx);
     uint32_t* pathCountOutput{};
-    deserialize_ptr(&pathCountOutput, d_ctx);
+    deserialize_output_ptr(&pathCountOutput, d_ctx);
     XrViveTrackerPathsHTCX* paths{};
-    deserialize_ptr(&paths, d_ctx);
+    deserialize_output_xr_ptr(&paths, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateViveTrackerPathsHTCX(instance, pathCapacityInput, pathCountOutput, paths);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(pathCountOutput, 1, s_ctx);
-    serialize_ptr(paths, pathCapacityInput, s_ctx);
+    serialize_filled_ptr(paths, pathCapacityInput, XR_SUCCEEDED(_result) && pathCountOutput ? *pathCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&pathCapacityInput);
@@ -3431,24 +4943,34 @@ void FunctionDispatch::handle_xrEnumerateViveTrackerPathsHTCX(MessageLockIn msg_
 void FunctionDispatch::handle_xrCreateSpatialAnchorHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorHTC", function_loader.CreateSpatialAnchorHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorCreateInfoHTC* createInfo{};
+    const XrSpatialAnchorCreateInfoHTC* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* anchor{};
-    deserialize_ptr(&anchor, d_ctx);
+    deserialize_output_ptr(&anchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorHTC(session, createInfo, anchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(anchor, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -3458,22 +4980,32 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSpatialAnchorNameHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpatialAnchorNameHTC", function_loader.GetSpatialAnchorNameHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace anchor{};
     deserialize(&anchor, d_ctx);
     XrSpatialAnchorNameHTC* name{};
-    deserialize_ptr(&name, d_ctx);
+    deserialize_output_ptr(&name, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpatialAnchorNameHTC(anchor, name);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(name, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&anchor);
     cleanup_ptr(name, 1);
@@ -3484,24 +5016,34 @@ void FunctionDispatch::handle_xrGetSpatialAnchorNameHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateBodyTrackerHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateBodyTrackerHTC", function_loader.CreateBodyTrackerHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrBodyTrackerCreateInfoHTC* createInfo{};
+    const XrBodyTrackerCreateInfoHTC* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrBodyTrackerHTC* bodyTracker{};
-    deserialize_ptr(&bodyTracker, d_ctx);
+    deserialize_output_ptr(&bodyTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateBodyTrackerHTC(session, createInfo, bodyTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bodyTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -3511,19 +5053,38 @@ void FunctionDispatch::handle_xrCreateBodyTrackerHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyBodyTrackerHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyBodyTrackerHTC", function_loader.DestroyBodyTrackerHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrBodyTrackerHTC bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyBodyTrackerHTC(bodyTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(321002, _result);
+        }
+        cleanup(&bodyTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
 }
@@ -3531,7 +5092,12 @@ void FunctionDispatch::handle_xrDestroyBodyTrackerHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetBodySkeletonHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetBodySkeletonHTC", function_loader.GetBodySkeletonHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrBodyTrackerHTC bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
     XrSpace baseSpace{};
@@ -3545,12 +5111,17 @@ void FunctionDispatch::handle_xrGetBodySkeletonHTC(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetBodySkeletonHTC(bodyTracker, baseSpace, skeletonGenerationId, skeleton);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(skeleton, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
     cleanup(&baseSpace);
@@ -3561,10 +5132,16 @@ void FunctionDispatch::handle_xrGetBodySkeletonHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateBodyJointsHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateBodyJointsHTC", function_loader.LocateBodyJointsHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    d_ctx.time_offset = sample_time;
     XrBodyTrackerHTC bodyTracker{};
     deserialize(&bodyTracker, d_ctx);
-    XrBodyJointsLocateInfoHTC* locateInfo{};
+    const XrBodyJointsLocateInfoHTC* locateInfo{};
     deserialize_ptr(&locateInfo, d_ctx);
     XrBodyJointLocationsHTC* locations{};
     deserialize_ptr(&locations, d_ctx);
@@ -3573,12 +5150,17 @@ void FunctionDispatch::handle_xrLocateBodyJointsHTC(MessageLockIn msg_in) {
     XrResult _result = function_loader.LocateBodyJointsHTC(bodyTracker, locateInfo, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&bodyTracker);
     cleanup_ptr(locateInfo, 1);
@@ -3590,24 +5172,34 @@ void FunctionDispatch::handle_xrLocateBodyJointsHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateFacialTrackerHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateFacialTrackerHTC", function_loader.CreateFacialTrackerHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFacialTrackerCreateInfoHTC* createInfo{};
+    const XrFacialTrackerCreateInfoHTC* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrFacialTrackerHTC* facialTracker{};
-    deserialize_ptr(&facialTracker, d_ctx);
+    deserialize_output_ptr(&facialTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateFacialTrackerHTC(session, createInfo, facialTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(facialTracker, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -3617,19 +5209,38 @@ void FunctionDispatch::handle_xrCreateFacialTrackerHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyFacialTrackerHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyFacialTrackerHTC", function_loader.DestroyFacialTrackerHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFacialTrackerHTC facialTracker{};
     deserialize(&facialTracker, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyFacialTrackerHTC(facialTracker);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(105002, _result);
+        }
+        cleanup(&facialTracker);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&facialTracker);
 }
@@ -3637,7 +5248,12 @@ void FunctionDispatch::handle_xrDestroyFacialTrackerHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetFacialExpressionsHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetFacialExpressionsHTC", function_loader.GetFacialExpressionsHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFacialTrackerHTC facialTracker{};
     deserialize(&facialTracker, d_ctx);
     XrFacialExpressionsHTC* facialExpressions{};
@@ -3647,12 +5263,17 @@ void FunctionDispatch::handle_xrGetFacialExpressionsHTC(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetFacialExpressionsHTC(facialTracker, facialExpressions);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(facialExpressions, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&facialTracker);
     cleanup_ptr(facialExpressions, 1);
@@ -3663,22 +5284,32 @@ void FunctionDispatch::handle_xrGetFacialExpressionsHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrApplyFoveationHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrApplyFoveationHTC", function_loader.ApplyFoveationHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFoveationApplyInfoHTC* applyInfo{};
+    const XrFoveationApplyInfoHTC* applyInfo{};
     deserialize_ptr(&applyInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ApplyFoveationHTC(session, applyInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(applyInfo->subImages, applyInfo->subImageCount, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(applyInfo, 1);
@@ -3689,24 +5320,34 @@ void FunctionDispatch::handle_xrApplyFoveationHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreatePassthroughHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreatePassthroughHTC", function_loader.CreatePassthroughHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrPassthroughCreateInfoHTC* createInfo{};
+    const XrPassthroughCreateInfoHTC* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrPassthroughHTC* passthrough{};
-    deserialize_ptr(&passthrough, d_ctx);
+    deserialize_output_ptr(&passthrough, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreatePassthroughHTC(session, createInfo, passthrough);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(passthrough, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -3716,19 +5357,38 @@ void FunctionDispatch::handle_xrCreatePassthroughHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyPassthroughHTC(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyPassthroughHTC", function_loader.DestroyPassthroughHTC);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughHTC passthrough{};
     deserialize(&passthrough, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyPassthroughHTC(passthrough);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(318002, _result);
+        }
+        cleanup(&passthrough);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&passthrough);
 }
@@ -3738,24 +5398,34 @@ void FunctionDispatch::handle_xrDestroyPassthroughHTC(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetD3D11GraphicsRequirementsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetD3D11GraphicsRequirementsKHR", function_loader.GetD3D11GraphicsRequirementsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
     deserialize(&systemId, d_ctx);
     XrGraphicsRequirementsD3D11KHR* graphicsRequirements{};
-    deserialize_ptr(&graphicsRequirements, d_ctx);
+    deserialize_output_xr_ptr(&graphicsRequirements, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetD3D11GraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -3767,24 +5437,34 @@ void FunctionDispatch::handle_xrGetD3D11GraphicsRequirementsKHR(MessageLockIn ms
 void FunctionDispatch::handle_xrGetD3D12GraphicsRequirementsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetD3D12GraphicsRequirementsKHR", function_loader.GetD3D12GraphicsRequirementsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
     deserialize(&systemId, d_ctx);
     XrGraphicsRequirementsD3D12KHR* graphicsRequirements{};
-    deserialize_ptr(&graphicsRequirements, d_ctx);
+    deserialize_output_xr_ptr(&graphicsRequirements, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetD3D12GraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -3796,27 +5476,37 @@ void FunctionDispatch::handle_xrGetD3D12GraphicsRequirementsKHR(MessageLockIn ms
 void FunctionDispatch::handle_xrCreateSwapchainAndroidSurfaceKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSwapchainAndroidSurfaceKHR", function_loader.CreateSwapchainAndroidSurfaceKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSwapchainCreateInfo* info{};
+    const XrSwapchainCreateInfo* info{};
     deserialize_ptr(&info, d_ctx);
     XrSwapchain* swapchain{};
-    deserialize_ptr(&swapchain, d_ctx);
+    deserialize_output_ptr(&swapchain, d_ctx);
     jobject* surface{};
-    deserialize_ptr(&surface, d_ctx);
+    deserialize_output_ptr(&surface, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSwapchainAndroidSurfaceKHR(session, info, swapchain, surface);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(swapchain, 1, s_ctx);
     serialize_ptr(surface, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -3829,7 +5519,12 @@ void FunctionDispatch::handle_xrCreateSwapchainAndroidSurfaceKHR(MessageLockIn m
 void FunctionDispatch::handle_xrSetAndroidApplicationThreadKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetAndroidApplicationThreadKHR", function_loader.SetAndroidApplicationThreadKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrAndroidThreadTypeKHR threadType{};
@@ -3841,11 +5536,16 @@ void FunctionDispatch::handle_xrSetAndroidApplicationThreadKHR(MessageLockIn msg
     XrResult _result = function_loader.SetAndroidApplicationThreadKHR(session, threadType, threadId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&threadType);
@@ -3857,24 +5557,34 @@ void FunctionDispatch::handle_xrSetAndroidApplicationThreadKHR(MessageLockIn msg
 void FunctionDispatch::handle_xrConvertTimeToTimespecTimeKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrConvertTimeToTimespecTimeKHR", function_loader.ConvertTimeToTimespecTimeKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrTime time{};
     deserialize_time(&time, d_ctx);
     timespec* timespecTime{};
-    deserialize_ptr(&timespecTime, d_ctx);
+    deserialize_output_ptr(&timespecTime, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ConvertTimeToTimespecTimeKHR(instance, time, timespecTime);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(timespecTime, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&time);
@@ -3884,25 +5594,35 @@ void FunctionDispatch::handle_xrConvertTimeToTimespecTimeKHR(MessageLockIn msg_i
 void FunctionDispatch::handle_xrConvertTimespecTimeToTimeKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrConvertTimespecTimeToTimeKHR", function_loader.ConvertTimespecTimeToTimeKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     timespec* timespecTime{};
     deserialize_ptr(&timespecTime, d_ctx);
     XrTime* time{};
-    deserialize_ptr(&time, d_ctx);
+    deserialize_output_ptr(&time, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ConvertTimespecTimeToTimeKHR(instance, timespecTime, time);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(timespecTime, 1, s_ctx);
     serialize_ptr(time, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(timespecTime, 1);
@@ -3914,24 +5634,34 @@ void FunctionDispatch::handle_xrConvertTimespecTimeToTimeKHR(MessageLockIn msg_i
 void FunctionDispatch::handle_xrStructureTypeToString2KHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStructureTypeToString2KHR", function_loader.StructureTypeToString2KHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrStructureType value{};
     deserialize(&value, d_ctx);
     char buffer[XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR]{};
-    deserialize_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, d_ctx);
+    deserialize_string_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StructureTypeToString2KHR(instance, value, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
-    serialize_ptr(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, s_ctx);
+    serialize_string_buffer(buffer, XR_MAX_STRUCTURE_NAME_SIZE_EXTENDED_KHR, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&value);
@@ -3943,19 +5673,29 @@ void FunctionDispatch::handle_xrStructureTypeToString2KHR(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrInitializeLoaderKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrInitializeLoaderKHR", function_loader.InitializeLoaderKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
-    XrLoaderInitInfoBaseHeaderKHR* loaderInitInfo{};
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    const XrLoaderInitInfoBaseHeaderKHR* loaderInitInfo{};
     deserialize_xr(&loaderInitInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.InitializeLoaderKHR(loaderInitInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup_xr(loaderInitInfo);
 }
@@ -3965,7 +5705,12 @@ void FunctionDispatch::handle_xrInitializeLoaderKHR(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMetalGraphicsRequirementsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMetalGraphicsRequirementsKHR", function_loader.GetMetalGraphicsRequirementsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -3977,12 +5722,17 @@ void FunctionDispatch::handle_xrGetMetalGraphicsRequirementsKHR(MessageLockIn ms
     XrResult _result = function_loader.GetMetalGraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -3994,24 +5744,34 @@ void FunctionDispatch::handle_xrGetMetalGraphicsRequirementsKHR(MessageLockIn ms
 void FunctionDispatch::handle_xrGetOpenGLGraphicsRequirementsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetOpenGLGraphicsRequirementsKHR", function_loader.GetOpenGLGraphicsRequirementsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
     deserialize(&systemId, d_ctx);
     XrGraphicsRequirementsOpenGLKHR* graphicsRequirements{};
-    deserialize_ptr(&graphicsRequirements, d_ctx);
+    deserialize_output_xr_ptr(&graphicsRequirements, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetOpenGLGraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -4023,24 +5783,34 @@ void FunctionDispatch::handle_xrGetOpenGLGraphicsRequirementsKHR(MessageLockIn m
 void FunctionDispatch::handle_xrGetOpenGLESGraphicsRequirementsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetOpenGLESGraphicsRequirementsKHR", function_loader.GetOpenGLESGraphicsRequirementsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
     deserialize(&systemId, d_ctx);
     XrGraphicsRequirementsOpenGLESKHR* graphicsRequirements{};
-    deserialize_ptr(&graphicsRequirements, d_ctx);
+    deserialize_output_xr_ptr(&graphicsRequirements, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetOpenGLESGraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -4052,7 +5822,12 @@ void FunctionDispatch::handle_xrGetOpenGLESGraphicsRequirementsKHR(MessageLockIn
 void FunctionDispatch::handle_xrGetVisibilityMaskKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVisibilityMaskKHR", function_loader.GetVisibilityMaskKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrViewConfigurationType viewConfigurationType{};
@@ -4068,12 +5843,17 @@ void FunctionDispatch::handle_xrGetVisibilityMaskKHR(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetVisibilityMaskKHR(session, viewConfigurationType, viewIndex, visibilityMaskType, visibilityMask);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(visibilityMask, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&viewConfigurationType);
@@ -4087,7 +5867,12 @@ void FunctionDispatch::handle_xrGetVisibilityMaskKHR(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetVulkanDeviceExtensionsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVulkanDeviceExtensionsKHR", function_loader.GetVulkanDeviceExtensionsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -4095,21 +5880,26 @@ void FunctionDispatch::handle_xrGetVulkanDeviceExtensionsKHR(MessageLockIn msg_i
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVulkanDeviceExtensionsKHR(instance, systemId, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -4121,7 +5911,12 @@ void FunctionDispatch::handle_xrGetVulkanDeviceExtensionsKHR(MessageLockIn msg_i
 void FunctionDispatch::handle_xrGetVulkanGraphicsDeviceKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVulkanGraphicsDeviceKHR", function_loader.GetVulkanGraphicsDeviceKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -4129,18 +5924,23 @@ void FunctionDispatch::handle_xrGetVulkanGraphicsDeviceKHR(MessageLockIn msg_in)
     VkInstance vkInstance{};
     deserialize(&vkInstance, d_ctx);
     VkPhysicalDevice* vkPhysicalDevice{};
-    deserialize_ptr(&vkPhysicalDevice, d_ctx);
+    deserialize_output_ptr(&vkPhysicalDevice, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVulkanGraphicsDeviceKHR(instance, systemId, vkInstance, vkPhysicalDevice);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(vkPhysicalDevice, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -4151,24 +5951,34 @@ void FunctionDispatch::handle_xrGetVulkanGraphicsDeviceKHR(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetVulkanGraphicsRequirementsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVulkanGraphicsRequirementsKHR", function_loader.GetVulkanGraphicsRequirementsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
     deserialize(&systemId, d_ctx);
     XrGraphicsRequirementsVulkanKHR* graphicsRequirements{};
-    deserialize_ptr(&graphicsRequirements, d_ctx);
+    deserialize_output_xr_ptr(&graphicsRequirements, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVulkanGraphicsRequirementsKHR(instance, systemId, graphicsRequirements);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(graphicsRequirements, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -4178,7 +5988,12 @@ void FunctionDispatch::handle_xrGetVulkanGraphicsRequirementsKHR(MessageLockIn m
 void FunctionDispatch::handle_xrGetVulkanInstanceExtensionsKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVulkanInstanceExtensionsKHR", function_loader.GetVulkanInstanceExtensionsKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -4186,21 +6001,26 @@ void FunctionDispatch::handle_xrGetVulkanInstanceExtensionsKHR(MessageLockIn msg
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVulkanInstanceExtensionsKHR(instance, systemId, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -4214,27 +6034,37 @@ void FunctionDispatch::handle_xrGetVulkanInstanceExtensionsKHR(MessageLockIn msg
 void FunctionDispatch::handle_xrCreateVulkanDeviceKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateVulkanDeviceKHR", function_loader.CreateVulkanDeviceKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrVulkanDeviceCreateInfoKHR* createInfo{};
+    const XrVulkanDeviceCreateInfoKHR* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     VkDevice* vulkanDevice{};
-    deserialize_ptr(&vulkanDevice, d_ctx);
+    deserialize_output_ptr(&vulkanDevice, d_ctx);
     VkResult* vulkanResult{};
-    deserialize_ptr(&vulkanResult, d_ctx);
+    deserialize_output_ptr(&vulkanResult, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateVulkanDeviceKHR(instance, createInfo, vulkanDevice, vulkanResult);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(vulkanDevice, 1, s_ctx);
     serialize_ptr(vulkanResult, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(createInfo, 1);
@@ -4245,27 +6075,37 @@ void FunctionDispatch::handle_xrCreateVulkanDeviceKHR(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateVulkanInstanceKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateVulkanInstanceKHR", function_loader.CreateVulkanInstanceKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrVulkanInstanceCreateInfoKHR* createInfo{};
+    const XrVulkanInstanceCreateInfoKHR* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     VkInstance* vulkanInstance{};
-    deserialize_ptr(&vulkanInstance, d_ctx);
+    deserialize_output_ptr(&vulkanInstance, d_ctx);
     VkResult* vulkanResult{};
-    deserialize_ptr(&vulkanResult, d_ctx);
+    deserialize_output_ptr(&vulkanResult, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateVulkanInstanceKHR(instance, createInfo, vulkanInstance, vulkanResult);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(vulkanInstance, 1, s_ctx);
     serialize_ptr(vulkanResult, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(createInfo, 1);
@@ -4276,24 +6116,34 @@ void FunctionDispatch::handle_xrCreateVulkanInstanceKHR(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetVulkanGraphicsDevice2KHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVulkanGraphicsDevice2KHR", function_loader.GetVulkanGraphicsDevice2KHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrVulkanGraphicsDeviceGetInfoKHR* getInfo{};
+    const XrVulkanGraphicsDeviceGetInfoKHR* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     VkPhysicalDevice* vulkanPhysicalDevice{};
-    deserialize_ptr(&vulkanPhysicalDevice, d_ctx);
+    deserialize_output_ptr(&vulkanPhysicalDevice, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVulkanGraphicsDevice2KHR(instance, getInfo, vulkanPhysicalDevice);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(vulkanPhysicalDevice, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(getInfo, 1);
@@ -4305,24 +6155,34 @@ void FunctionDispatch::handle_xrGetVulkanGraphicsDevice2KHR(MessageLockIn msg_in
 void FunctionDispatch::handle_xrConvertTimeToWin32PerformanceCounterKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrConvertTimeToWin32PerformanceCounterKHR", function_loader.ConvertTimeToWin32PerformanceCounterKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrTime time{};
     deserialize_time(&time, d_ctx);
     LARGE_INTEGER* performanceCounter{};
-    deserialize_ptr(&performanceCounter, d_ctx);
+    deserialize_output_ptr(&performanceCounter, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ConvertTimeToWin32PerformanceCounterKHR(instance, time, performanceCounter);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(performanceCounter, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&time);
@@ -4332,24 +6192,34 @@ void FunctionDispatch::handle_xrConvertTimeToWin32PerformanceCounterKHR(MessageL
 void FunctionDispatch::handle_xrConvertWin32PerformanceCounterToTimeKHR(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrConvertWin32PerformanceCounterToTimeKHR", function_loader.ConvertWin32PerformanceCounterToTimeKHR);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    LARGE_INTEGER* performanceCounter{};
+    const LARGE_INTEGER* performanceCounter{};
     deserialize_ptr(&performanceCounter, d_ctx);
     XrTime* time{};
-    deserialize_ptr(&time, d_ctx);
+    deserialize_output_ptr(&time, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ConvertWin32PerformanceCounterToTimeKHR(instance, performanceCounter, time);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(time, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(performanceCounter, 1);
@@ -4361,25 +6231,35 @@ void FunctionDispatch::handle_xrConvertWin32PerformanceCounterToTimeKHR(MessageL
 void FunctionDispatch::handle_xrStartColocationAdvertisementMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStartColocationAdvertisementMETA", function_loader.StartColocationAdvertisementMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrColocationAdvertisementStartInfoMETA* info{};
+    const XrColocationAdvertisementStartInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* advertisementRequestId{};
-    deserialize_ptr(&advertisementRequestId, d_ctx);
+    deserialize_output_ptr(&advertisementRequestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StartColocationAdvertisementMETA(session, info, advertisementRequestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(info->buffer, info->bufferSize, s_ctx);
     serialize_ptr(advertisementRequestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -4389,24 +6269,34 @@ void FunctionDispatch::handle_xrStartColocationAdvertisementMETA(MessageLockIn m
 void FunctionDispatch::handle_xrStartColocationDiscoveryMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStartColocationDiscoveryMETA", function_loader.StartColocationDiscoveryMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrColocationDiscoveryStartInfoMETA* info{};
+    const XrColocationDiscoveryStartInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* discoveryRequestId{};
-    deserialize_ptr(&discoveryRequestId, d_ctx);
+    deserialize_output_ptr(&discoveryRequestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StartColocationDiscoveryMETA(session, info, discoveryRequestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(discoveryRequestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -4416,24 +6306,34 @@ void FunctionDispatch::handle_xrStartColocationDiscoveryMETA(MessageLockIn msg_i
 void FunctionDispatch::handle_xrStopColocationAdvertisementMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStopColocationAdvertisementMETA", function_loader.StopColocationAdvertisementMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrColocationAdvertisementStopInfoMETA* info{};
+    const XrColocationAdvertisementStopInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StopColocationAdvertisementMETA(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -4443,24 +6343,34 @@ void FunctionDispatch::handle_xrStopColocationAdvertisementMETA(MessageLockIn ms
 void FunctionDispatch::handle_xrStopColocationDiscoveryMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStopColocationDiscoveryMETA", function_loader.StopColocationDiscoveryMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrColocationDiscoveryStopInfoMETA* info{};
+    const XrColocationDiscoveryStopInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StopColocationDiscoveryMETA(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -4472,24 +6382,34 @@ void FunctionDispatch::handle_xrStopColocationDiscoveryMETA(MessageLockIn msg_in
 void FunctionDispatch::handle_xrAcquireEnvironmentDepthImageMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrAcquireEnvironmentDepthImageMETA", function_loader.AcquireEnvironmentDepthImageMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthProviderMETA environmentDepthProvider{};
     deserialize(&environmentDepthProvider, d_ctx);
-    XrEnvironmentDepthImageAcquireInfoMETA* acquireInfo{};
+    const XrEnvironmentDepthImageAcquireInfoMETA* acquireInfo{};
     deserialize_ptr(&acquireInfo, d_ctx);
     XrEnvironmentDepthImageMETA* environmentDepthImage{};
-    deserialize_ptr(&environmentDepthImage, d_ctx);
+    deserialize_output_xr_ptr(&environmentDepthImage, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.AcquireEnvironmentDepthImageMETA(environmentDepthProvider, acquireInfo, environmentDepthImage);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(environmentDepthImage, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&environmentDepthProvider);
     cleanup_ptr(acquireInfo, 1);
@@ -4499,24 +6419,34 @@ void FunctionDispatch::handle_xrAcquireEnvironmentDepthImageMETA(MessageLockIn m
 void FunctionDispatch::handle_xrCreateEnvironmentDepthProviderMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateEnvironmentDepthProviderMETA", function_loader.CreateEnvironmentDepthProviderMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrEnvironmentDepthProviderCreateInfoMETA* createInfo{};
+    const XrEnvironmentDepthProviderCreateInfoMETA* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrEnvironmentDepthProviderMETA* environmentDepthProvider{};
-    deserialize_ptr(&environmentDepthProvider, d_ctx);
+    deserialize_output_ptr(&environmentDepthProvider, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateEnvironmentDepthProviderMETA(session, createInfo, environmentDepthProvider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(environmentDepthProvider, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -4526,24 +6456,34 @@ void FunctionDispatch::handle_xrCreateEnvironmentDepthProviderMETA(MessageLockIn
 void FunctionDispatch::handle_xrCreateEnvironmentDepthSwapchainMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateEnvironmentDepthSwapchainMETA", function_loader.CreateEnvironmentDepthSwapchainMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthProviderMETA environmentDepthProvider{};
     deserialize(&environmentDepthProvider, d_ctx);
-    XrEnvironmentDepthSwapchainCreateInfoMETA* createInfo{};
+    const XrEnvironmentDepthSwapchainCreateInfoMETA* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrEnvironmentDepthSwapchainMETA* swapchain{};
-    deserialize_ptr(&swapchain, d_ctx);
+    deserialize_output_ptr(&swapchain, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateEnvironmentDepthSwapchainMETA(environmentDepthProvider, createInfo, swapchain);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(swapchain, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&environmentDepthProvider);
     cleanup_ptr(createInfo, 1);
@@ -4553,19 +6493,38 @@ void FunctionDispatch::handle_xrCreateEnvironmentDepthSwapchainMETA(MessageLockI
 void FunctionDispatch::handle_xrDestroyEnvironmentDepthProviderMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyEnvironmentDepthProviderMETA", function_loader.DestroyEnvironmentDepthProviderMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthProviderMETA environmentDepthProvider{};
     deserialize(&environmentDepthProvider, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyEnvironmentDepthProviderMETA(environmentDepthProvider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(292004, _result);
+        }
+        cleanup(&environmentDepthProvider);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&environmentDepthProvider);
 }
@@ -4573,19 +6532,38 @@ void FunctionDispatch::handle_xrDestroyEnvironmentDepthProviderMETA(MessageLockI
 void FunctionDispatch::handle_xrDestroyEnvironmentDepthSwapchainMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyEnvironmentDepthSwapchainMETA", function_loader.DestroyEnvironmentDepthSwapchainMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthSwapchainMETA swapchain{};
     deserialize(&swapchain, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyEnvironmentDepthSwapchainMETA(swapchain);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(292005, _result);
+        }
+        cleanup(&swapchain);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
 }
@@ -4593,13 +6571,18 @@ void FunctionDispatch::handle_xrDestroyEnvironmentDepthSwapchainMETA(MessageLock
 void FunctionDispatch::handle_xrEnumerateEnvironmentDepthSwapchainImagesMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateEnvironmentDepthSwapchainImagesMETA", function_loader.EnumerateEnvironmentDepthSwapchainImagesMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthSwapchainMETA swapchain{};
     deserialize(&swapchain, d_ctx);
     uint32_t imageCapacityInput{};
     deserialize(&imageCapacityInput, d_ctx);
     uint32_t* imageCountOutput{};
-    deserialize_ptr(&imageCountOutput, d_ctx);
+    deserialize_output_ptr(&imageCountOutput, d_ctx);
     XrSwapchainImageBaseHeader* images{};
     deserialize_xr_array(&images, d_ctx);
 
@@ -4607,13 +6590,18 @@ void FunctionDispatch::handle_xrEnumerateEnvironmentDepthSwapchainImagesMETA(Mes
     XrResult _result = function_loader.EnumerateEnvironmentDepthSwapchainImagesMETA(swapchain, imageCapacityInput, imageCountOutput, images);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(imageCountOutput, 1, s_ctx);
-    serialize_xr_array(images, imageCapacityInput, s_ctx);
+    serialize_filled_xr_array(images, imageCapacityInput, XR_SUCCEEDED(_result) && imageCountOutput ? *imageCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup(&imageCapacityInput);
@@ -4624,22 +6612,32 @@ void FunctionDispatch::handle_xrEnumerateEnvironmentDepthSwapchainImagesMETA(Mes
 void FunctionDispatch::handle_xrGetEnvironmentDepthSwapchainStateMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetEnvironmentDepthSwapchainStateMETA", function_loader.GetEnvironmentDepthSwapchainStateMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthSwapchainMETA swapchain{};
     deserialize(&swapchain, d_ctx);
     XrEnvironmentDepthSwapchainStateMETA* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetEnvironmentDepthSwapchainStateMETA(swapchain, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup_ptr(state, 1);
@@ -4648,21 +6646,31 @@ void FunctionDispatch::handle_xrGetEnvironmentDepthSwapchainStateMETA(MessageLoc
 void FunctionDispatch::handle_xrSetEnvironmentDepthHandRemovalMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetEnvironmentDepthHandRemovalMETA", function_loader.SetEnvironmentDepthHandRemovalMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthProviderMETA environmentDepthProvider{};
     deserialize(&environmentDepthProvider, d_ctx);
-    XrEnvironmentDepthHandRemovalSetInfoMETA* setInfo{};
+    const XrEnvironmentDepthHandRemovalSetInfoMETA* setInfo{};
     deserialize_ptr(&setInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetEnvironmentDepthHandRemovalMETA(environmentDepthProvider, setInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&environmentDepthProvider);
     cleanup_ptr(setInfo, 1);
@@ -4671,7 +6679,12 @@ void FunctionDispatch::handle_xrSetEnvironmentDepthHandRemovalMETA(MessageLockIn
 void FunctionDispatch::handle_xrStartEnvironmentDepthProviderMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStartEnvironmentDepthProviderMETA", function_loader.StartEnvironmentDepthProviderMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthProviderMETA environmentDepthProvider{};
     deserialize(&environmentDepthProvider, d_ctx);
 
@@ -4679,11 +6692,16 @@ void FunctionDispatch::handle_xrStartEnvironmentDepthProviderMETA(MessageLockIn
     XrResult _result = function_loader.StartEnvironmentDepthProviderMETA(environmentDepthProvider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&environmentDepthProvider);
 }
@@ -4691,7 +6709,12 @@ void FunctionDispatch::handle_xrStartEnvironmentDepthProviderMETA(MessageLockIn
 void FunctionDispatch::handle_xrStopEnvironmentDepthProviderMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStopEnvironmentDepthProviderMETA", function_loader.StopEnvironmentDepthProviderMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrEnvironmentDepthProviderMETA environmentDepthProvider{};
     deserialize(&environmentDepthProvider, d_ctx);
 
@@ -4699,11 +6722,16 @@ void FunctionDispatch::handle_xrStopEnvironmentDepthProviderMETA(MessageLockIn m
     XrResult _result = function_loader.StopEnvironmentDepthProviderMETA(environmentDepthProvider);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&environmentDepthProvider);
 }
@@ -4713,22 +6741,32 @@ void FunctionDispatch::handle_xrStopEnvironmentDepthProviderMETA(MessageLockIn m
 void FunctionDispatch::handle_xrGetFoveationEyeTrackedStateMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetFoveationEyeTrackedStateMETA", function_loader.GetFoveationEyeTrackedStateMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrFoveationEyeTrackedStateMETA* foveationState{};
-    deserialize_ptr(&foveationState, d_ctx);
+    deserialize_output_xr_ptr(&foveationState, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetFoveationEyeTrackedStateMETA(session, foveationState);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(foveationState, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(foveationState, 1);
@@ -4739,24 +6777,34 @@ void FunctionDispatch::handle_xrGetFoveationEyeTrackedStateMETA(MessageLockIn ms
 void FunctionDispatch::handle_xrCreatePassthroughColorLutMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreatePassthroughColorLutMETA", function_loader.CreatePassthroughColorLutMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughFB passthrough{};
     deserialize(&passthrough, d_ctx);
-    XrPassthroughColorLutCreateInfoMETA* createInfo{};
+    const XrPassthroughColorLutCreateInfoMETA* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrPassthroughColorLutMETA* colorLut{};
-    deserialize_ptr(&colorLut, d_ctx);
+    deserialize_output_ptr(&colorLut, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreatePassthroughColorLutMETA(passthrough, createInfo, colorLut);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(colorLut, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&passthrough);
     cleanup_ptr(createInfo, 1);
@@ -4766,19 +6814,38 @@ void FunctionDispatch::handle_xrCreatePassthroughColorLutMETA(MessageLockIn msg_
 void FunctionDispatch::handle_xrDestroyPassthroughColorLutMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyPassthroughColorLutMETA", function_loader.DestroyPassthroughColorLutMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughColorLutMETA colorLut{};
     deserialize(&colorLut, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyPassthroughColorLutMETA(colorLut);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(267002, _result);
+        }
+        cleanup(&colorLut);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&colorLut);
 }
@@ -4786,21 +6853,31 @@ void FunctionDispatch::handle_xrDestroyPassthroughColorLutMETA(MessageLockIn msg
 void FunctionDispatch::handle_xrUpdatePassthroughColorLutMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUpdatePassthroughColorLutMETA", function_loader.UpdatePassthroughColorLutMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrPassthroughColorLutMETA colorLut{};
     deserialize(&colorLut, d_ctx);
-    XrPassthroughColorLutUpdateInfoMETA* updateInfo{};
+    const XrPassthroughColorLutUpdateInfoMETA* updateInfo{};
     deserialize_ptr(&updateInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UpdatePassthroughColorLutMETA(colorLut, updateInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&colorLut);
     cleanup_ptr(updateInfo, 1);
@@ -4811,22 +6888,32 @@ void FunctionDispatch::handle_xrUpdatePassthroughColorLutMETA(MessageLockIn msg_
 void FunctionDispatch::handle_xrGetPassthroughPreferencesMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetPassthroughPreferencesMETA", function_loader.GetPassthroughPreferencesMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPassthroughPreferencesMETA* preferences{};
-    deserialize_ptr(&preferences, d_ctx);
+    deserialize_output_xr_ptr(&preferences, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetPassthroughPreferencesMETA(session, preferences);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(preferences, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(preferences, 1);
@@ -4837,27 +6924,37 @@ void FunctionDispatch::handle_xrGetPassthroughPreferencesMETA(MessageLockIn msg_
 void FunctionDispatch::handle_xrEnumeratePerformanceMetricsCounterPathsMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumeratePerformanceMetricsCounterPathsMETA", function_loader.EnumeratePerformanceMetricsCounterPathsMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     uint32_t counterPathCapacityInput{};
     deserialize(&counterPathCapacityInput, d_ctx);
     uint32_t* counterPathCountOutput{};
-    deserialize_ptr(&counterPathCountOutput, d_ctx);
+    deserialize_output_ptr(&counterPathCountOutput, d_ctx);
     XrPath* counterPaths{};
-    deserialize_ptr(&counterPaths, d_ctx);
+    deserialize_output_ptr(&counterPaths, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumeratePerformanceMetricsCounterPathsMETA(instance, counterPathCapacityInput, counterPathCountOutput, counterPaths);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(counterPathCountOutput, 1, s_ctx);
-    serialize_ptr(counterPaths, counterPathCapacityInput, s_ctx);
+    serialize_filled_ptr(counterPaths, counterPathCapacityInput, XR_SUCCEEDED(_result) && counterPathCountOutput ? *counterPathCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&counterPathCapacityInput);
@@ -4868,22 +6965,32 @@ void FunctionDispatch::handle_xrEnumeratePerformanceMetricsCounterPathsMETA(Mess
 void FunctionDispatch::handle_xrGetPerformanceMetricsStateMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetPerformanceMetricsStateMETA", function_loader.GetPerformanceMetricsStateMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPerformanceMetricsStateMETA* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetPerformanceMetricsStateMETA(session, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(state, 1);
@@ -4892,24 +6999,34 @@ void FunctionDispatch::handle_xrGetPerformanceMetricsStateMETA(MessageLockIn msg
 void FunctionDispatch::handle_xrQueryPerformanceMetricsCounterMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQueryPerformanceMetricsCounterMETA", function_loader.QueryPerformanceMetricsCounterMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath counterPath{};
     deserialize(&counterPath, d_ctx);
     XrPerformanceMetricsCounterMETA* counter{};
-    deserialize_ptr(&counter, d_ctx);
+    deserialize_output_xr_ptr(&counter, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QueryPerformanceMetricsCounterMETA(session, counterPath, counter);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(counter, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&counterPath);
@@ -4919,21 +7036,31 @@ void FunctionDispatch::handle_xrQueryPerformanceMetricsCounterMETA(MessageLockIn
 void FunctionDispatch::handle_xrSetPerformanceMetricsStateMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetPerformanceMetricsStateMETA", function_loader.SetPerformanceMetricsStateMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrPerformanceMetricsStateMETA* state{};
+    const XrPerformanceMetricsStateMETA* state{};
     deserialize_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetPerformanceMetricsStateMETA(session, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(state, 1);
@@ -4944,24 +7071,34 @@ void FunctionDispatch::handle_xrSetPerformanceMetricsStateMETA(MessageLockIn msg
 void FunctionDispatch::handle_xrGetRecommendedLayerResolutionMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetRecommendedLayerResolutionMETA", function_loader.GetRecommendedLayerResolutionMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrRecommendedLayerResolutionGetInfoMETA* info{};
+    const XrRecommendedLayerResolutionGetInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrRecommendedLayerResolutionMETA* resolution{};
-    deserialize_ptr(&resolution, d_ctx);
+    deserialize_output_xr_ptr(&resolution, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetRecommendedLayerResolutionMETA(session, info, resolution);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(resolution, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -4973,21 +7110,31 @@ void FunctionDispatch::handle_xrGetRecommendedLayerResolutionMETA(MessageLockIn
 void FunctionDispatch::handle_xrPauseSimultaneousHandsAndControllersTrackingMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPauseSimultaneousHandsAndControllersTrackingMETA", function_loader.PauseSimultaneousHandsAndControllersTrackingMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* pauseInfo{};
+    const XrSimultaneousHandsAndControllersTrackingPauseInfoMETA* pauseInfo{};
     deserialize_ptr(&pauseInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PauseSimultaneousHandsAndControllersTrackingMETA(session, pauseInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(pauseInfo, 1);
@@ -4996,21 +7143,31 @@ void FunctionDispatch::handle_xrPauseSimultaneousHandsAndControllersTrackingMETA
 void FunctionDispatch::handle_xrResumeSimultaneousHandsAndControllersTrackingMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrResumeSimultaneousHandsAndControllersTrackingMETA", function_loader.ResumeSimultaneousHandsAndControllersTrackingMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* resumeInfo{};
+    const XrSimultaneousHandsAndControllersTrackingResumeInfoMETA* resumeInfo{};
     deserialize_ptr(&resumeInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ResumeSimultaneousHandsAndControllersTrackingMETA(session, resumeInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(resumeInfo, 1);
@@ -5021,10 +7178,15 @@ void FunctionDispatch::handle_xrResumeSimultaneousHandsAndControllersTrackingMET
 void FunctionDispatch::handle_xrGetSpaceTriangleMeshMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpaceTriangleMeshMETA", function_loader.GetSpaceTriangleMeshMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
-    XrSpaceTriangleMeshGetInfoMETA* getInfo{};
+    const XrSpaceTriangleMeshGetInfoMETA* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrSpaceTriangleMeshMETA* triangleMeshOutput{};
     deserialize_ptr(&triangleMeshOutput, d_ctx);
@@ -5033,12 +7195,17 @@ void FunctionDispatch::handle_xrGetSpaceTriangleMeshMETA(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSpaceTriangleMeshMETA(space, getInfo, triangleMeshOutput);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(triangleMeshOutput, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
     cleanup_ptr(getInfo, 1);
@@ -5050,25 +7217,35 @@ void FunctionDispatch::handle_xrGetSpaceTriangleMeshMETA(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrShareSpacesMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrShareSpacesMETA", function_loader.ShareSpacesMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrShareSpacesInfoMETA* info{};
+    const XrShareSpacesInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrAsyncRequestIdFB* requestId{};
-    deserialize_ptr(&requestId, d_ctx);
+    deserialize_output_ptr(&requestId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ShareSpacesMETA(session, info, requestId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(info->spaces, info->spaceCount, s_ctx);
     serialize_ptr(requestId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -5080,21 +7257,31 @@ void FunctionDispatch::handle_xrShareSpacesMETA(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrChangeVirtualKeyboardTextContextMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrChangeVirtualKeyboardTextContextMETA", function_loader.ChangeVirtualKeyboardTextContextMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
-    XrVirtualKeyboardTextContextChangeInfoMETA* changeInfo{};
+    const XrVirtualKeyboardTextContextChangeInfoMETA* changeInfo{};
     deserialize_ptr(&changeInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ChangeVirtualKeyboardTextContextMETA(keyboard, changeInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup_ptr(changeInfo, 1);
@@ -5103,24 +7290,34 @@ void FunctionDispatch::handle_xrChangeVirtualKeyboardTextContextMETA(MessageLock
 void FunctionDispatch::handle_xrCreateVirtualKeyboardMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateVirtualKeyboardMETA", function_loader.CreateVirtualKeyboardMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrVirtualKeyboardCreateInfoMETA* createInfo{};
+    const XrVirtualKeyboardCreateInfoMETA* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrVirtualKeyboardMETA* keyboard{};
-    deserialize_ptr(&keyboard, d_ctx);
+    deserialize_output_ptr(&keyboard, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateVirtualKeyboardMETA(session, createInfo, keyboard);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(keyboard, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -5130,26 +7327,36 @@ void FunctionDispatch::handle_xrCreateVirtualKeyboardMETA(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCreateVirtualKeyboardSpaceMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateVirtualKeyboardSpaceMETA", function_loader.CreateVirtualKeyboardSpaceMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
-    XrVirtualKeyboardSpaceCreateInfoMETA* createInfo{};
+    const XrVirtualKeyboardSpaceCreateInfoMETA* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* keyboardSpace{};
-    deserialize_ptr(&keyboardSpace, d_ctx);
+    deserialize_output_ptr(&keyboardSpace, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateVirtualKeyboardSpaceMETA(session, keyboard, createInfo, keyboardSpace);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(keyboardSpace, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&keyboard);
@@ -5160,19 +7367,38 @@ void FunctionDispatch::handle_xrCreateVirtualKeyboardSpaceMETA(MessageLockIn msg
 void FunctionDispatch::handle_xrDestroyVirtualKeyboardMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyVirtualKeyboardMETA", function_loader.DestroyVirtualKeyboardMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyVirtualKeyboardMETA(keyboard);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(220004, _result);
+        }
+        cleanup(&keyboard);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
 }
@@ -5180,27 +7406,37 @@ void FunctionDispatch::handle_xrDestroyVirtualKeyboardMETA(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetVirtualKeyboardDirtyTexturesMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVirtualKeyboardDirtyTexturesMETA", function_loader.GetVirtualKeyboardDirtyTexturesMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
     uint32_t textureIdCapacityInput{};
     deserialize(&textureIdCapacityInput, d_ctx);
     uint32_t* textureIdCountOutput{};
-    deserialize_ptr(&textureIdCountOutput, d_ctx);
+    deserialize_output_ptr(&textureIdCountOutput, d_ctx);
     uint64_t* textureIds{};
-    deserialize_ptr(&textureIds, d_ctx);
+    deserialize_output_ptr(&textureIds, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVirtualKeyboardDirtyTexturesMETA(keyboard, textureIdCapacityInput, textureIdCountOutput, textureIds);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(textureIdCountOutput, 1, s_ctx);
-    serialize_ptr(textureIds, textureIdCapacityInput, s_ctx);
+    serialize_filled_ptr(textureIds, textureIdCapacityInput, XR_SUCCEEDED(_result) && textureIdCountOutput ? *textureIdCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup(&textureIdCapacityInput);
@@ -5211,7 +7447,12 @@ void FunctionDispatch::handle_xrGetVirtualKeyboardDirtyTexturesMETA(MessageLockI
 void FunctionDispatch::handle_xrGetVirtualKeyboardModelAnimationStatesMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVirtualKeyboardModelAnimationStatesMETA", function_loader.GetVirtualKeyboardModelAnimationStatesMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
     XrVirtualKeyboardModelAnimationStatesMETA* animationStates{};
@@ -5221,12 +7462,17 @@ void FunctionDispatch::handle_xrGetVirtualKeyboardModelAnimationStatesMETA(Messa
     XrResult _result = function_loader.GetVirtualKeyboardModelAnimationStatesMETA(keyboard, animationStates);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(animationStates, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup_ptr(animationStates, 1);
@@ -5235,22 +7481,32 @@ void FunctionDispatch::handle_xrGetVirtualKeyboardModelAnimationStatesMETA(Messa
 void FunctionDispatch::handle_xrGetVirtualKeyboardScaleMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVirtualKeyboardScaleMETA", function_loader.GetVirtualKeyboardScaleMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
     float* scale{};
-    deserialize_ptr(&scale, d_ctx);
+    deserialize_output_ptr(&scale, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetVirtualKeyboardScaleMETA(keyboard, scale);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(scale, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup_ptr(scale, 1);
@@ -5259,7 +7515,12 @@ void FunctionDispatch::handle_xrGetVirtualKeyboardScaleMETA(MessageLockIn msg_in
 void FunctionDispatch::handle_xrGetVirtualKeyboardTextureDataMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetVirtualKeyboardTextureDataMETA", function_loader.GetVirtualKeyboardTextureDataMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
     uint64_t textureId{};
@@ -5271,12 +7532,17 @@ void FunctionDispatch::handle_xrGetVirtualKeyboardTextureDataMETA(MessageLockIn
     XrResult _result = function_loader.GetVirtualKeyboardTextureDataMETA(keyboard, textureId, textureData);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(textureData, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup(&textureId);
@@ -5286,24 +7552,34 @@ void FunctionDispatch::handle_xrGetVirtualKeyboardTextureDataMETA(MessageLockIn
 void FunctionDispatch::handle_xrSendVirtualKeyboardInputMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSendVirtualKeyboardInputMETA", function_loader.SendVirtualKeyboardInputMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
-    XrVirtualKeyboardInputInfoMETA* info{};
+    const XrVirtualKeyboardInputInfoMETA* info{};
     deserialize_ptr(&info, d_ctx);
     XrPosef* interactorRootPose{};
-    deserialize_ptr(&interactorRootPose, d_ctx);
+    deserialize_output_ptr(&interactorRootPose, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SendVirtualKeyboardInputMETA(keyboard, info, interactorRootPose);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(interactorRootPose, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup_ptr(info, 1);
@@ -5313,21 +7589,31 @@ void FunctionDispatch::handle_xrSendVirtualKeyboardInputMETA(MessageLockIn msg_i
 void FunctionDispatch::handle_xrSetVirtualKeyboardModelVisibilityMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetVirtualKeyboardModelVisibilityMETA", function_loader.SetVirtualKeyboardModelVisibilityMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
-    XrVirtualKeyboardModelVisibilitySetInfoMETA* modelVisibility{};
+    const XrVirtualKeyboardModelVisibilitySetInfoMETA* modelVisibility{};
     deserialize_ptr(&modelVisibility, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetVirtualKeyboardModelVisibilityMETA(keyboard, modelVisibility);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup_ptr(modelVisibility, 1);
@@ -5336,21 +7622,31 @@ void FunctionDispatch::handle_xrSetVirtualKeyboardModelVisibilityMETA(MessageLoc
 void FunctionDispatch::handle_xrSuggestVirtualKeyboardLocationMETA(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSuggestVirtualKeyboardLocationMETA", function_loader.SuggestVirtualKeyboardLocationMETA);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrVirtualKeyboardMETA keyboard{};
     deserialize(&keyboard, d_ctx);
-    XrVirtualKeyboardLocationInfoMETA* locationInfo{};
+    const XrVirtualKeyboardLocationInfoMETA* locationInfo{};
     deserialize_ptr(&locationInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SuggestVirtualKeyboardLocationMETA(keyboard, locationInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&keyboard);
     cleanup_ptr(locationInfo, 1);
@@ -5361,24 +7657,34 @@ void FunctionDispatch::handle_xrSuggestVirtualKeyboardLocationMETA(MessageLockIn
 void FunctionDispatch::handle_xrCreateSpaceFromCoordinateFrameUIDML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpaceFromCoordinateFrameUIDML", function_loader.CreateSpaceFromCoordinateFrameUIDML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrCoordinateSpaceCreateInfoML* createInfo{};
+    const XrCoordinateSpaceCreateInfoML* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpaceFromCoordinateFrameUIDML(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -5390,24 +7696,34 @@ void FunctionDispatch::handle_xrCreateSpaceFromCoordinateFrameUIDML(MessageLockI
 void FunctionDispatch::handle_xrCreateFacialExpressionClientML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateFacialExpressionClientML", function_loader.CreateFacialExpressionClientML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFacialExpressionClientCreateInfoML* createInfo{};
+    const XrFacialExpressionClientCreateInfoML* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrFacialExpressionClientML* facialExpressionClient{};
-    deserialize_ptr(&facialExpressionClient, d_ctx);
+    deserialize_output_ptr(&facialExpressionClient, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateFacialExpressionClientML(session, createInfo, facialExpressionClient);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(facialExpressionClient, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -5417,19 +7733,38 @@ void FunctionDispatch::handle_xrCreateFacialExpressionClientML(MessageLockIn msg
 void FunctionDispatch::handle_xrDestroyFacialExpressionClientML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyFacialExpressionClientML", function_loader.DestroyFacialExpressionClientML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFacialExpressionClientML facialExpressionClient{};
     deserialize(&facialExpressionClient, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyFacialExpressionClientML(facialExpressionClient);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(483002, _result);
+        }
+        cleanup(&facialExpressionClient);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&facialExpressionClient);
 }
@@ -5437,26 +7772,36 @@ void FunctionDispatch::handle_xrDestroyFacialExpressionClientML(MessageLockIn ms
 void FunctionDispatch::handle_xrGetFacialExpressionBlendShapePropertiesML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetFacialExpressionBlendShapePropertiesML", function_loader.GetFacialExpressionBlendShapePropertiesML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrFacialExpressionClientML facialExpressionClient{};
     deserialize(&facialExpressionClient, d_ctx);
-    XrFacialExpressionBlendShapeGetInfoML* blendShapeGetInfo{};
+    const XrFacialExpressionBlendShapeGetInfoML* blendShapeGetInfo{};
     deserialize_ptr(&blendShapeGetInfo, d_ctx);
     uint32_t blendShapeCount{};
     deserialize(&blendShapeCount, d_ctx);
     XrFacialExpressionBlendShapePropertiesML* blendShapes{};
-    deserialize_ptr(&blendShapes, d_ctx);
+    deserialize_output_xr_ptr(&blendShapes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetFacialExpressionBlendShapePropertiesML(facialExpressionClient, blendShapeGetInfo, blendShapeCount, blendShapes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(blendShapes, blendShapeCount, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&facialExpressionClient);
     cleanup_ptr(blendShapeGetInfo, 1);
@@ -5469,24 +7814,34 @@ void FunctionDispatch::handle_xrGetFacialExpressionBlendShapePropertiesML(Messag
 void FunctionDispatch::handle_xrCreateExportedLocalizationMapML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateExportedLocalizationMapML", function_loader.CreateExportedLocalizationMapML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrUuidEXT* mapUuid{};
+    const XrUuidEXT* mapUuid{};
     deserialize_ptr(&mapUuid, d_ctx);
     XrExportedLocalizationMapML* map{};
-    deserialize_ptr(&map, d_ctx);
+    deserialize_output_ptr(&map, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateExportedLocalizationMapML(session, mapUuid, map);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(map, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(mapUuid, 1);
@@ -5496,19 +7851,38 @@ void FunctionDispatch::handle_xrCreateExportedLocalizationMapML(MessageLockIn ms
 void FunctionDispatch::handle_xrDestroyExportedLocalizationMapML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyExportedLocalizationMapML", function_loader.DestroyExportedLocalizationMapML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrExportedLocalizationMapML map{};
     deserialize(&map, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyExportedLocalizationMapML(map);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(140002, _result);
+        }
+        cleanup(&map);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&map);
 }
@@ -5516,21 +7890,31 @@ void FunctionDispatch::handle_xrDestroyExportedLocalizationMapML(MessageLockIn m
 void FunctionDispatch::handle_xrEnableLocalizationEventsML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnableLocalizationEventsML", function_loader.EnableLocalizationEventsML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrLocalizationEnableEventsInfoML* info{};
+    const XrLocalizationEnableEventsInfoML* info{};
     deserialize_ptr(&info, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnableLocalizationEventsML(session, info);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(info, 1);
@@ -5539,27 +7923,37 @@ void FunctionDispatch::handle_xrEnableLocalizationEventsML(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetExportedLocalizationMapDataML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetExportedLocalizationMapDataML", function_loader.GetExportedLocalizationMapDataML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrExportedLocalizationMapML map{};
     deserialize(&map, d_ctx);
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetExportedLocalizationMapDataML(map, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&map);
     cleanup(&bufferCapacityInput);
@@ -5570,25 +7964,35 @@ void FunctionDispatch::handle_xrGetExportedLocalizationMapDataML(MessageLockIn m
 void FunctionDispatch::handle_xrImportLocalizationMapML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrImportLocalizationMapML", function_loader.ImportLocalizationMapML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrLocalizationMapImportInfoML* importInfo{};
+    const XrLocalizationMapImportInfoML* importInfo{};
     deserialize_ptr(&importInfo, d_ctx);
     XrUuidEXT* mapUuid{};
-    deserialize_ptr(&mapUuid, d_ctx);
+    deserialize_output_ptr(&mapUuid, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ImportLocalizationMapML(session, importInfo, mapUuid);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(importInfo->data, importInfo->size, s_ctx);
     serialize_ptr(mapUuid, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(importInfo, 1);
@@ -5598,29 +8002,39 @@ void FunctionDispatch::handle_xrImportLocalizationMapML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrQueryLocalizationMapsML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQueryLocalizationMapsML", function_loader.QueryLocalizationMapsML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrLocalizationMapQueryInfoBaseHeaderML* queryInfo{};
+    const XrLocalizationMapQueryInfoBaseHeaderML* queryInfo{};
     deserialize_xr(&queryInfo, d_ctx);
     uint32_t mapCapacityInput{};
     deserialize(&mapCapacityInput, d_ctx);
     uint32_t* mapCountOutput{};
-    deserialize_ptr(&mapCountOutput, d_ctx);
+    deserialize_output_ptr(&mapCountOutput, d_ctx);
     XrLocalizationMapML* maps{};
-    deserialize_ptr(&maps, d_ctx);
+    deserialize_output_xr_ptr(&maps, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QueryLocalizationMapsML(session, queryInfo, mapCapacityInput, mapCountOutput, maps);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(mapCountOutput, 1, s_ctx);
-    serialize_ptr(maps, mapCapacityInput, s_ctx);
+    serialize_filled_ptr(maps, mapCapacityInput, XR_SUCCEEDED(_result) && mapCountOutput ? *mapCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_xr(queryInfo);
@@ -5632,21 +8046,31 @@ void FunctionDispatch::handle_xrQueryLocalizationMapsML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrRequestMapLocalizationML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestMapLocalizationML", function_loader.RequestMapLocalizationML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrMapLocalizationRequestInfoML* requestInfo{};
+    const XrMapLocalizationRequestInfoML* requestInfo{};
     deserialize_ptr(&requestInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.RequestMapLocalizationML(session, requestInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(requestInfo, 1);
@@ -5657,24 +8081,34 @@ void FunctionDispatch::handle_xrRequestMapLocalizationML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateMarkerDetectorML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateMarkerDetectorML", function_loader.CreateMarkerDetectorML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrMarkerDetectorCreateInfoML* createInfo{};
+    const XrMarkerDetectorCreateInfoML* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrMarkerDetectorML* markerDetector{};
-    deserialize_ptr(&markerDetector, d_ctx);
+    deserialize_output_ptr(&markerDetector, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateMarkerDetectorML(session, createInfo, markerDetector);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(markerDetector, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -5684,24 +8118,34 @@ void FunctionDispatch::handle_xrCreateMarkerDetectorML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateMarkerSpaceML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateMarkerSpaceML", function_loader.CreateMarkerSpaceML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrMarkerSpaceCreateInfoML* createInfo{};
+    const XrMarkerSpaceCreateInfoML* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateMarkerSpaceML(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -5711,19 +8155,38 @@ void FunctionDispatch::handle_xrCreateMarkerSpaceML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyMarkerDetectorML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyMarkerDetectorML", function_loader.DestroyMarkerDetectorML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyMarkerDetectorML(markerDetector);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(139003, _result);
+        }
+        cleanup(&markerDetector);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
 }
@@ -5731,22 +8194,32 @@ void FunctionDispatch::handle_xrDestroyMarkerDetectorML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMarkerDetectorStateML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkerDetectorStateML", function_loader.GetMarkerDetectorStateML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     XrMarkerDetectorStateML* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkerDetectorStateML(markerDetector, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup_ptr(state, 1);
@@ -5755,24 +8228,34 @@ void FunctionDispatch::handle_xrGetMarkerDetectorStateML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMarkerLengthML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkerLengthML", function_loader.GetMarkerLengthML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     XrMarkerML marker{};
     deserialize(&marker, d_ctx);
     float* meters{};
-    deserialize_ptr(&meters, d_ctx);
+    deserialize_output_ptr(&meters, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkerLengthML(markerDetector, marker, meters);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(meters, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup(&marker);
@@ -5782,24 +8265,34 @@ void FunctionDispatch::handle_xrGetMarkerLengthML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMarkerNumberML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkerNumberML", function_loader.GetMarkerNumberML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     XrMarkerML marker{};
     deserialize(&marker, d_ctx);
     uint64_t* number{};
-    deserialize_ptr(&number, d_ctx);
+    deserialize_output_ptr(&number, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkerNumberML(markerDetector, marker, number);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(number, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup(&marker);
@@ -5809,24 +8302,34 @@ void FunctionDispatch::handle_xrGetMarkerNumberML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMarkerReprojectionErrorML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkerReprojectionErrorML", function_loader.GetMarkerReprojectionErrorML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     XrMarkerML marker{};
     deserialize(&marker, d_ctx);
     float* reprojectionErrorMeters{};
-    deserialize_ptr(&reprojectionErrorMeters, d_ctx);
+    deserialize_output_ptr(&reprojectionErrorMeters, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkerReprojectionErrorML(markerDetector, marker, reprojectionErrorMeters);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(reprojectionErrorMeters, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup(&marker);
@@ -5836,7 +8339,12 @@ void FunctionDispatch::handle_xrGetMarkerReprojectionErrorML(MessageLockIn msg_i
 void FunctionDispatch::handle_xrGetMarkerStringML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkerStringML", function_loader.GetMarkerStringML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     XrMarkerML marker{};
@@ -5844,21 +8352,26 @@ void FunctionDispatch::handle_xrGetMarkerStringML(MessageLockIn msg_in) {
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkerStringML(markerDetector, marker, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup(&marker);
@@ -5870,27 +8383,37 @@ void FunctionDispatch::handle_xrGetMarkerStringML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMarkersML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkersML", function_loader.GetMarkersML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     uint32_t markerCapacityInput{};
     deserialize(&markerCapacityInput, d_ctx);
     uint32_t* markerCountOutput{};
-    deserialize_ptr(&markerCountOutput, d_ctx);
+    deserialize_output_ptr(&markerCountOutput, d_ctx);
     XrMarkerML* markers{};
-    deserialize_ptr(&markers, d_ctx);
+    deserialize_output_ptr(&markers, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkersML(markerDetector, markerCapacityInput, markerCountOutput, markers);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(markerCountOutput, 1, s_ctx);
-    serialize_ptr(markers, markerCapacityInput, s_ctx);
+    serialize_filled_ptr(markers, markerCapacityInput, XR_SUCCEEDED(_result) && markerCountOutput ? *markerCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup(&markerCapacityInput);
@@ -5901,22 +8424,32 @@ void FunctionDispatch::handle_xrGetMarkersML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSnapshotMarkerDetectorML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSnapshotMarkerDetectorML", function_loader.SnapshotMarkerDetectorML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrMarkerDetectorML markerDetector{};
     deserialize(&markerDetector, d_ctx);
     XrMarkerDetectorSnapshotInfoML* snapshotInfo{};
-    deserialize_ptr(&snapshotInfo, d_ctx);
+    deserialize_output_xr_ptr(&snapshotInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SnapshotMarkerDetectorML(markerDetector, snapshotInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(snapshotInfo, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&markerDetector);
     cleanup_ptr(snapshotInfo, 1);
@@ -5927,24 +8460,34 @@ void FunctionDispatch::handle_xrSnapshotMarkerDetectorML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpatialAnchorsAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorsAsyncML", function_loader.CreateSpatialAnchorsAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorsCreateInfoBaseHeaderML* createInfo{};
+    const XrSpatialAnchorsCreateInfoBaseHeaderML* createInfo{};
     deserialize_xr(&createInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorsAsyncML(session, createInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_xr(createInfo);
@@ -5954,7 +8497,12 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorsAsyncML(MessageLockIn msg_in
 void FunctionDispatch::handle_xrCreateSpatialAnchorsCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorsCompleteML", function_loader.CreateSpatialAnchorsCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrFutureEXT future{};
@@ -5966,12 +8514,17 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorsCompleteML(MessageLockIn msg
     XrResult _result = function_loader.CreateSpatialAnchorsCompleteML(session, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&future);
@@ -5981,22 +8534,32 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorsCompleteML(MessageLockIn msg
 void FunctionDispatch::handle_xrGetSpatialAnchorStateML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpatialAnchorStateML", function_loader.GetSpatialAnchorStateML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace anchor{};
     deserialize(&anchor, d_ctx);
     XrSpatialAnchorStateML* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpatialAnchorStateML(anchor, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&anchor);
     cleanup_ptr(state, 1);
@@ -6007,24 +8570,34 @@ void FunctionDispatch::handle_xrGetSpatialAnchorStateML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpatialAnchorsStorageML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorsStorageML", function_loader.CreateSpatialAnchorsStorageML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorsCreateStorageInfoML* createInfo{};
+    const XrSpatialAnchorsCreateStorageInfoML* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpatialAnchorsStorageML* storage{};
-    deserialize_ptr(&storage, d_ctx);
+    deserialize_output_ptr(&storage, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorsStorageML(session, createInfo, storage);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(storage, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -6034,24 +8607,34 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorsStorageML(MessageLockIn msg_
 void FunctionDispatch::handle_xrDeleteSpatialAnchorsAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDeleteSpatialAnchorsAsyncML", function_loader.DeleteSpatialAnchorsAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
-    XrSpatialAnchorsDeleteInfoML* deleteInfo{};
+    const XrSpatialAnchorsDeleteInfoML* deleteInfo{};
     deserialize_ptr(&deleteInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DeleteSpatialAnchorsAsyncML(storage, deleteInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup_ptr(deleteInfo, 1);
@@ -6061,24 +8644,34 @@ void FunctionDispatch::handle_xrDeleteSpatialAnchorsAsyncML(MessageLockIn msg_in
 void FunctionDispatch::handle_xrDeleteSpatialAnchorsCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDeleteSpatialAnchorsCompleteML", function_loader.DeleteSpatialAnchorsCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrSpatialAnchorsDeleteCompletionML* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DeleteSpatialAnchorsCompleteML(storage, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup(&future);
@@ -6088,19 +8681,38 @@ void FunctionDispatch::handle_xrDeleteSpatialAnchorsCompleteML(MessageLockIn msg
 void FunctionDispatch::handle_xrDestroySpatialAnchorsStorageML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySpatialAnchorsStorageML", function_loader.DestroySpatialAnchorsStorageML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySpatialAnchorsStorageML(storage);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(142004, _result);
+        }
+        cleanup(&storage);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
 }
@@ -6108,24 +8720,34 @@ void FunctionDispatch::handle_xrDestroySpatialAnchorsStorageML(MessageLockIn msg
 void FunctionDispatch::handle_xrPublishSpatialAnchorsAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPublishSpatialAnchorsAsyncML", function_loader.PublishSpatialAnchorsAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
-    XrSpatialAnchorsPublishInfoML* publishInfo{};
+    const XrSpatialAnchorsPublishInfoML* publishInfo{};
     deserialize_ptr(&publishInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PublishSpatialAnchorsAsyncML(storage, publishInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup_ptr(publishInfo, 1);
@@ -6135,7 +8757,12 @@ void FunctionDispatch::handle_xrPublishSpatialAnchorsAsyncML(MessageLockIn msg_i
 void FunctionDispatch::handle_xrPublishSpatialAnchorsCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPublishSpatialAnchorsCompleteML", function_loader.PublishSpatialAnchorsCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
     XrFutureEXT future{};
@@ -6147,12 +8774,17 @@ void FunctionDispatch::handle_xrPublishSpatialAnchorsCompleteML(MessageLockIn ms
     XrResult _result = function_loader.PublishSpatialAnchorsCompleteML(storage, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup(&future);
@@ -6162,24 +8794,34 @@ void FunctionDispatch::handle_xrPublishSpatialAnchorsCompleteML(MessageLockIn ms
 void FunctionDispatch::handle_xrQuerySpatialAnchorsAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQuerySpatialAnchorsAsyncML", function_loader.QuerySpatialAnchorsAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
-    XrSpatialAnchorsQueryInfoBaseHeaderML* queryInfo{};
+    const XrSpatialAnchorsQueryInfoBaseHeaderML* queryInfo{};
     deserialize_xr(&queryInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.QuerySpatialAnchorsAsyncML(storage, queryInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup_xr(queryInfo);
@@ -6189,7 +8831,12 @@ void FunctionDispatch::handle_xrQuerySpatialAnchorsAsyncML(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrQuerySpatialAnchorsCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrQuerySpatialAnchorsCompleteML", function_loader.QuerySpatialAnchorsCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
     XrFutureEXT future{};
@@ -6201,12 +8848,17 @@ void FunctionDispatch::handle_xrQuerySpatialAnchorsCompleteML(MessageLockIn msg_
     XrResult _result = function_loader.QuerySpatialAnchorsCompleteML(storage, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup(&future);
@@ -6216,24 +8868,34 @@ void FunctionDispatch::handle_xrQuerySpatialAnchorsCompleteML(MessageLockIn msg_
 void FunctionDispatch::handle_xrUpdateSpatialAnchorsExpirationAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUpdateSpatialAnchorsExpirationAsyncML", function_loader.UpdateSpatialAnchorsExpirationAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
-    XrSpatialAnchorsUpdateExpirationInfoML* updateInfo{};
+    const XrSpatialAnchorsUpdateExpirationInfoML* updateInfo{};
     deserialize_ptr(&updateInfo, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UpdateSpatialAnchorsExpirationAsyncML(storage, updateInfo, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup_ptr(updateInfo, 1);
@@ -6243,24 +8905,34 @@ void FunctionDispatch::handle_xrUpdateSpatialAnchorsExpirationAsyncML(MessageLoc
 void FunctionDispatch::handle_xrUpdateSpatialAnchorsExpirationCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUpdateSpatialAnchorsExpirationCompleteML", function_loader.UpdateSpatialAnchorsExpirationCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorsStorageML storage{};
     deserialize(&storage, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
     XrSpatialAnchorsUpdateExpirationCompletionML* completion{};
-    deserialize_ptr(&completion, d_ctx);
+    deserialize_output_xr_ptr(&completion, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UpdateSpatialAnchorsExpirationCompleteML(storage, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&storage);
     cleanup(&future);
@@ -6272,21 +8944,31 @@ void FunctionDispatch::handle_xrUpdateSpatialAnchorsExpirationCompleteML(Message
 void FunctionDispatch::handle_xrSetSystemNotificationsML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetSystemNotificationsML", function_loader.SetSystemNotificationsML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrSystemNotificationsSetInfoML* info{};
+    const XrSystemNotificationsSetInfoML* info{};
     deserialize_ptr(&info, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SetSystemNotificationsML(instance, info);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(info, 1);
@@ -6297,21 +8979,31 @@ void FunctionDispatch::handle_xrSetSystemNotificationsML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnableUserCalibrationEventsML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnableUserCalibrationEventsML", function_loader.EnableUserCalibrationEventsML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrUserCalibrationEnableEventsInfoML* enableInfo{};
+    const XrUserCalibrationEnableEventsInfoML* enableInfo{};
     deserialize_ptr(&enableInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnableUserCalibrationEventsML(instance, enableInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(enableInfo, 1);
@@ -6322,10 +9014,15 @@ void FunctionDispatch::handle_xrEnableUserCalibrationEventsML(MessageLockIn msg_
 void FunctionDispatch::handle_xrAllocateWorldMeshBufferML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrAllocateWorldMeshBufferML", function_loader.AllocateWorldMeshBufferML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
-    XrWorldMeshBufferSizeML* size{};
+    const XrWorldMeshBufferSizeML* size{};
     deserialize_ptr(&size, d_ctx);
     XrWorldMeshBufferML* buffer{};
     deserialize_ptr(&buffer, d_ctx);
@@ -6334,13 +9031,18 @@ void FunctionDispatch::handle_xrAllocateWorldMeshBufferML(MessageLockIn msg_in)
     XrResult _result = function_loader.AllocateWorldMeshBufferML(detector, size, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(size->next, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup_ptr(size, 1);
@@ -6350,24 +9052,34 @@ void FunctionDispatch::handle_xrAllocateWorldMeshBufferML(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCreateWorldMeshDetectorML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateWorldMeshDetectorML", function_loader.CreateWorldMeshDetectorML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrWorldMeshDetectorCreateInfoML* createInfo{};
+    const XrWorldMeshDetectorCreateInfoML* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrWorldMeshDetectorML* detector{};
-    deserialize_ptr(&detector, d_ctx);
+    deserialize_output_ptr(&detector, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateWorldMeshDetectorML(session, createInfo, detector);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(detector, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -6377,19 +9089,38 @@ void FunctionDispatch::handle_xrCreateWorldMeshDetectorML(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrDestroyWorldMeshDetectorML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyWorldMeshDetectorML", function_loader.DestroyWorldMeshDetectorML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyWorldMeshDetectorML(detector);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(475003, _result);
+        }
+        cleanup(&detector);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
 }
@@ -6397,23 +9128,33 @@ void FunctionDispatch::handle_xrDestroyWorldMeshDetectorML(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrFreeWorldMeshBufferML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrFreeWorldMeshBufferML", function_loader.FreeWorldMeshBufferML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
-    XrWorldMeshBufferML* buffer{};
+    const XrWorldMeshBufferML* buffer{};
     deserialize_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.FreeWorldMeshBufferML(detector, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_xr(buffer->next, s_ctx);
     serialize_ptr(buffer->buffer, buffer->bufferSize, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup_ptr(buffer, 1);
@@ -6422,24 +9163,34 @@ void FunctionDispatch::handle_xrFreeWorldMeshBufferML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetWorldMeshBufferRecommendSizeML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetWorldMeshBufferRecommendSizeML", function_loader.GetWorldMeshBufferRecommendSizeML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
-    XrWorldMeshBufferRecommendedSizeInfoML* sizeInfo{};
+    const XrWorldMeshBufferRecommendedSizeInfoML* sizeInfo{};
     deserialize_ptr(&sizeInfo, d_ctx);
     XrWorldMeshBufferSizeML* size{};
-    deserialize_ptr(&size, d_ctx);
+    deserialize_output_xr_ptr(&size, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetWorldMeshBufferRecommendSizeML(detector, sizeInfo, size);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(size, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup_ptr(sizeInfo, 1);
@@ -6449,28 +9200,38 @@ void FunctionDispatch::handle_xrGetWorldMeshBufferRecommendSizeML(MessageLockIn
 void FunctionDispatch::handle_xrRequestWorldMeshAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestWorldMeshAsyncML", function_loader.RequestWorldMeshAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
-    XrWorldMeshGetInfoML* getInfo{};
+    const XrWorldMeshGetInfoML* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrWorldMeshBufferML* buffer{};
     deserialize_ptr(&buffer, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.RequestWorldMeshAsyncML(detector, getInfo, buffer, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(getInfo->blocks, getInfo->blockCount, s_ctx);
     serialize_ptr(buffer, 1, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup_ptr(getInfo, 1);
@@ -6481,10 +9242,15 @@ void FunctionDispatch::handle_xrRequestWorldMeshAsyncML(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrRequestWorldMeshCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestWorldMeshCompleteML", function_loader.RequestWorldMeshCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
-    XrWorldMeshRequestCompletionInfoML* completionInfo{};
+    const XrWorldMeshRequestCompletionInfoML* completionInfo{};
     deserialize_ptr(&completionInfo, d_ctx);
     XrFutureEXT future{};
     deserialize(&future, d_ctx);
@@ -6495,12 +9261,17 @@ void FunctionDispatch::handle_xrRequestWorldMeshCompleteML(MessageLockIn msg_in)
     XrResult _result = function_loader.RequestWorldMeshCompleteML(detector, completionInfo, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup_ptr(completionInfo, 1);
@@ -6511,24 +9282,34 @@ void FunctionDispatch::handle_xrRequestWorldMeshCompleteML(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrRequestWorldMeshStateAsyncML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestWorldMeshStateAsyncML", function_loader.RequestWorldMeshStateAsyncML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
-    XrWorldMeshStateRequestInfoML* stateRequest{};
+    const XrWorldMeshStateRequestInfoML* stateRequest{};
     deserialize_ptr(&stateRequest, d_ctx);
     XrFutureEXT* future{};
-    deserialize_ptr(&future, d_ctx);
+    deserialize_output_ptr(&future, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.RequestWorldMeshStateAsyncML(detector, stateRequest, future);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(future, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup_ptr(stateRequest, 1);
@@ -6538,7 +9319,12 @@ void FunctionDispatch::handle_xrRequestWorldMeshStateAsyncML(MessageLockIn msg_i
 void FunctionDispatch::handle_xrRequestWorldMeshStateCompleteML(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestWorldMeshStateCompleteML", function_loader.RequestWorldMeshStateCompleteML);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrWorldMeshDetectorML detector{};
     deserialize(&detector, d_ctx);
     XrFutureEXT future{};
@@ -6550,12 +9336,17 @@ void FunctionDispatch::handle_xrRequestWorldMeshStateCompleteML(MessageLockIn ms
     XrResult _result = function_loader.RequestWorldMeshStateCompleteML(detector, future, completion);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(completion, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&detector);
     cleanup(&future);
@@ -6567,22 +9358,32 @@ void FunctionDispatch::handle_xrRequestWorldMeshStateCompleteML(MessageLockIn ms
 void FunctionDispatch::handle_xrApplyForceFeedbackCurlMNDX(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrApplyForceFeedbackCurlMNDX", function_loader.ApplyForceFeedbackCurlMNDX);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrHandTrackerEXT handTracker{};
     deserialize(&handTracker, d_ctx);
-    XrForceFeedbackCurlApplyLocationsMNDX* locations{};
+    const XrForceFeedbackCurlApplyLocationsMNDX* locations{};
     deserialize_ptr(&locations, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ApplyForceFeedbackCurlMNDX(handTracker, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations->locations, locations->locationCount, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&handTracker);
     cleanup_ptr(locations, 1);
@@ -6593,7 +9394,12 @@ void FunctionDispatch::handle_xrApplyForceFeedbackCurlMNDX(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrEnumerateReprojectionModesMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateReprojectionModesMSFT", function_loader.EnumerateReprojectionModesMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -6603,21 +9409,26 @@ void FunctionDispatch::handle_xrEnumerateReprojectionModesMSFT(MessageLockIn msg
     uint32_t modeCapacityInput{};
     deserialize(&modeCapacityInput, d_ctx);
     uint32_t* modeCountOutput{};
-    deserialize_ptr(&modeCountOutput, d_ctx);
+    deserialize_output_ptr(&modeCountOutput, d_ctx);
     XrReprojectionModeMSFT* modes{};
-    deserialize_ptr(&modes, d_ctx);
+    deserialize_output_ptr(&modes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateReprojectionModesMSFT(instance, systemId, viewConfigurationType, modeCapacityInput, modeCountOutput, modes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(modeCountOutput, 1, s_ctx);
-    serialize_ptr(modes, modeCapacityInput, s_ctx);
+    serialize_filled_ptr(modes, modeCapacityInput, XR_SUCCEEDED(_result) && modeCountOutput ? *modeCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -6632,24 +9443,34 @@ void FunctionDispatch::handle_xrEnumerateReprojectionModesMSFT(MessageLockIn msg
 void FunctionDispatch::handle_xrGetControllerModelKeyMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetControllerModelKeyMSFT", function_loader.GetControllerModelKeyMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath topLevelUserPath{};
     deserialize(&topLevelUserPath, d_ctx);
     XrControllerModelKeyStateMSFT* controllerModelKeyState{};
-    deserialize_ptr(&controllerModelKeyState, d_ctx);
+    deserialize_output_xr_ptr(&controllerModelKeyState, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetControllerModelKeyMSFT(session, topLevelUserPath, controllerModelKeyState);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(controllerModelKeyState, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&topLevelUserPath);
@@ -6659,7 +9480,12 @@ void FunctionDispatch::handle_xrGetControllerModelKeyMSFT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrGetControllerModelPropertiesMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetControllerModelPropertiesMSFT", function_loader.GetControllerModelPropertiesMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrControllerModelKeyMSFT modelKey{};
@@ -6671,12 +9497,17 @@ void FunctionDispatch::handle_xrGetControllerModelPropertiesMSFT(MessageLockIn m
     XrResult _result = function_loader.GetControllerModelPropertiesMSFT(session, modelKey, properties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(properties, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&modelKey);
@@ -6686,7 +9517,12 @@ void FunctionDispatch::handle_xrGetControllerModelPropertiesMSFT(MessageLockIn m
 void FunctionDispatch::handle_xrGetControllerModelStateMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetControllerModelStateMSFT", function_loader.GetControllerModelStateMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrControllerModelKeyMSFT modelKey{};
@@ -6698,12 +9534,17 @@ void FunctionDispatch::handle_xrGetControllerModelStateMSFT(MessageLockIn msg_in
     XrResult _result = function_loader.GetControllerModelStateMSFT(session, modelKey, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&modelKey);
@@ -6713,7 +9554,12 @@ void FunctionDispatch::handle_xrGetControllerModelStateMSFT(MessageLockIn msg_in
 void FunctionDispatch::handle_xrLoadControllerModelMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLoadControllerModelMSFT", function_loader.LoadControllerModelMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrControllerModelKeyMSFT modelKey{};
@@ -6721,21 +9567,26 @@ void FunctionDispatch::handle_xrLoadControllerModelMSFT(MessageLockIn msg_in) {
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     uint8_t* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.LoadControllerModelMSFT(session, modelKey, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_filled_ptr(buffer, bufferCapacityInput, XR_SUCCEEDED(_result) && bufferCountOutput ? *bufferCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&modelKey);
@@ -6749,24 +9600,34 @@ void FunctionDispatch::handle_xrLoadControllerModelMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateHandMeshSpaceMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateHandMeshSpaceMSFT", function_loader.CreateHandMeshSpaceMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrHandTrackerEXT handTracker{};
     deserialize(&handTracker, d_ctx);
-    XrHandMeshSpaceCreateInfoMSFT* createInfo{};
+    const XrHandMeshSpaceCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateHandMeshSpaceMSFT(handTracker, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&handTracker);
     cleanup_ptr(createInfo, 1);
@@ -6776,24 +9637,34 @@ void FunctionDispatch::handle_xrCreateHandMeshSpaceMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrUpdateHandMeshMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUpdateHandMeshMSFT", function_loader.UpdateHandMeshMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrHandTrackerEXT handTracker{};
     deserialize(&handTracker, d_ctx);
-    XrHandMeshUpdateInfoMSFT* updateInfo{};
+    const XrHandMeshUpdateInfoMSFT* updateInfo{};
     deserialize_ptr(&updateInfo, d_ctx);
     XrHandMeshMSFT* handMesh{};
-    deserialize_ptr(&handMesh, d_ctx);
+    deserialize_output_xr_ptr(&handMesh, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UpdateHandMeshMSFT(handTracker, updateInfo, handMesh);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(handMesh, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&handTracker);
     cleanup_ptr(updateInfo, 1);
@@ -6805,25 +9676,35 @@ void FunctionDispatch::handle_xrUpdateHandMeshMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpatialAnchorFromPerceptionAnchorMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorFromPerceptionAnchorMSFT", function_loader.CreateSpatialAnchorFromPerceptionAnchorMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     IUnknown* perceptionAnchor{};
-    deserialize_ptr(&perceptionAnchor, d_ctx);
+    deserialize_output_ptr(&perceptionAnchor, d_ctx);
     XrSpatialAnchorMSFT* anchor{};
-    deserialize_ptr(&anchor, d_ctx);
+    deserialize_output_ptr(&anchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorFromPerceptionAnchorMSFT(session, perceptionAnchor, anchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(perceptionAnchor, 1, s_ctx);
     serialize_ptr(anchor, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(perceptionAnchor, 1);
@@ -6833,7 +9714,12 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorFromPerceptionAnchorMSFT(Mess
 void FunctionDispatch::handle_xrTryGetPerceptionAnchorFromSpatialAnchorMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTryGetPerceptionAnchorFromSpatialAnchorMSFT", function_loader.TryGetPerceptionAnchorFromSpatialAnchorMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpatialAnchorMSFT anchor{};
@@ -6845,12 +9731,17 @@ void FunctionDispatch::handle_xrTryGetPerceptionAnchorFromSpatialAnchorMSFT(Mess
     XrResult _result = function_loader.TryGetPerceptionAnchorFromSpatialAnchorMSFT(session, anchor, perceptionAnchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(perceptionAnchor, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&anchor);
@@ -6862,29 +9753,39 @@ void FunctionDispatch::handle_xrTryGetPerceptionAnchorFromSpatialAnchorMSFT(Mess
 void FunctionDispatch::handle_xrGetSceneMarkerDecodedStringMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSceneMarkerDecodedStringMSFT", function_loader.GetSceneMarkerDecodedStringMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
-    XrUuidMSFT* markerId{};
+    const XrUuidMSFT* markerId{};
     deserialize_ptr(&markerId, d_ctx);
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSceneMarkerDecodedStringMSFT(scene, markerId, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
     cleanup_ptr(markerId, 1);
@@ -6896,29 +9797,39 @@ void FunctionDispatch::handle_xrGetSceneMarkerDecodedStringMSFT(MessageLockIn ms
 void FunctionDispatch::handle_xrGetSceneMarkerRawDataMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSceneMarkerRawDataMSFT", function_loader.GetSceneMarkerRawDataMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
-    XrUuidMSFT* markerId{};
+    const XrUuidMSFT* markerId{};
     deserialize_ptr(&markerId, d_ctx);
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     uint8_t* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSceneMarkerRawDataMSFT(scene, markerId, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_filled_ptr(buffer, bufferCapacityInput, XR_SUCCEEDED(_result) && bufferCountOutput ? *bufferCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
     cleanup_ptr(markerId, 1);
@@ -6932,21 +9843,31 @@ void FunctionDispatch::handle_xrGetSceneMarkerRawDataMSFT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrComputeNewSceneMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrComputeNewSceneMSFT", function_loader.ComputeNewSceneMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneObserverMSFT sceneObserver{};
     deserialize(&sceneObserver, d_ctx);
-    XrNewSceneComputeInfoMSFT* computeInfo{};
+    const XrNewSceneComputeInfoMSFT* computeInfo{};
     deserialize_ptr(&computeInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ComputeNewSceneMSFT(sceneObserver, computeInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&sceneObserver);
     cleanup_ptr(computeInfo, 1);
@@ -6955,24 +9876,34 @@ void FunctionDispatch::handle_xrComputeNewSceneMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSceneMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSceneMSFT", function_loader.CreateSceneMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneObserverMSFT sceneObserver{};
     deserialize(&sceneObserver, d_ctx);
-    XrSceneCreateInfoMSFT* createInfo{};
+    const XrSceneCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSceneMSFT* scene{};
-    deserialize_ptr(&scene, d_ctx);
+    deserialize_output_ptr(&scene, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSceneMSFT(sceneObserver, createInfo, scene);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(scene, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&sceneObserver);
     cleanup_ptr(createInfo, 1);
@@ -6982,24 +9913,34 @@ void FunctionDispatch::handle_xrCreateSceneMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSceneObserverMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSceneObserverMSFT", function_loader.CreateSceneObserverMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSceneObserverCreateInfoMSFT* createInfo{};
+    const XrSceneObserverCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSceneObserverMSFT* sceneObserver{};
-    deserialize_ptr(&sceneObserver, d_ctx);
+    deserialize_output_ptr(&sceneObserver, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSceneObserverMSFT(session, createInfo, sceneObserver);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(sceneObserver, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -7009,19 +9950,38 @@ void FunctionDispatch::handle_xrCreateSceneObserverMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySceneMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySceneMSFT", function_loader.DestroySceneMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySceneMSFT(scene);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(98004, _result);
+        }
+        cleanup(&scene);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
 }
@@ -7029,19 +9989,38 @@ void FunctionDispatch::handle_xrDestroySceneMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySceneObserverMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySceneObserverMSFT", function_loader.DestroySceneObserverMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneObserverMSFT sceneObserver{};
     deserialize(&sceneObserver, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySceneObserverMSFT(sceneObserver);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(98005, _result);
+        }
+        cleanup(&sceneObserver);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&sceneObserver);
 }
@@ -7049,7 +10028,12 @@ void FunctionDispatch::handle_xrDestroySceneObserverMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateSceneComputeFeaturesMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateSceneComputeFeaturesMSFT", function_loader.EnumerateSceneComputeFeaturesMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -7057,21 +10041,26 @@ void FunctionDispatch::handle_xrEnumerateSceneComputeFeaturesMSFT(MessageLockIn
     uint32_t featureCapacityInput{};
     deserialize(&featureCapacityInput, d_ctx);
     uint32_t* featureCountOutput{};
-    deserialize_ptr(&featureCountOutput, d_ctx);
+    deserialize_output_ptr(&featureCountOutput, d_ctx);
     XrSceneComputeFeatureMSFT* features{};
-    deserialize_ptr(&features, d_ctx);
+    deserialize_output_ptr(&features, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateSceneComputeFeaturesMSFT(instance, systemId, featureCapacityInput, featureCountOutput, features);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(featureCountOutput, 1, s_ctx);
-    serialize_ptr(features, featureCapacityInput, s_ctx);
+    serialize_filled_ptr(features, featureCapacityInput, XR_SUCCEEDED(_result) && featureCountOutput ? *featureCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -7083,10 +10072,15 @@ void FunctionDispatch::handle_xrEnumerateSceneComputeFeaturesMSFT(MessageLockIn
 void FunctionDispatch::handle_xrGetSceneComponentsMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSceneComponentsMSFT", function_loader.GetSceneComponentsMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
-    XrSceneComponentsGetInfoMSFT* getInfo{};
+    const XrSceneComponentsGetInfoMSFT* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrSceneComponentsMSFT* components{};
     deserialize_ptr(&components, d_ctx);
@@ -7095,12 +10089,17 @@ void FunctionDispatch::handle_xrGetSceneComponentsMSFT(MessageLockIn msg_in) {
     XrResult _result = function_loader.GetSceneComponentsMSFT(scene, getInfo, components);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(components, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
     cleanup_ptr(getInfo, 1);
@@ -7110,22 +10109,32 @@ void FunctionDispatch::handle_xrGetSceneComponentsMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSceneComputeStateMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSceneComputeStateMSFT", function_loader.GetSceneComputeStateMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneObserverMSFT sceneObserver{};
     deserialize(&sceneObserver, d_ctx);
     XrSceneComputeStateMSFT* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSceneComputeStateMSFT(sceneObserver, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&sceneObserver);
     cleanup_ptr(state, 1);
@@ -7134,24 +10143,34 @@ void FunctionDispatch::handle_xrGetSceneComputeStateMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSceneMeshBuffersMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSceneMeshBuffersMSFT", function_loader.GetSceneMeshBuffersMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
-    XrSceneMeshBuffersGetInfoMSFT* getInfo{};
+    const XrSceneMeshBuffersGetInfoMSFT* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrSceneMeshBuffersMSFT* buffers{};
-    deserialize_ptr(&buffers, d_ctx);
+    deserialize_output_xr_ptr(&buffers, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSceneMeshBuffersMSFT(scene, getInfo, buffers);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(buffers, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
     cleanup_ptr(getInfo, 1);
@@ -7161,10 +10180,15 @@ void FunctionDispatch::handle_xrGetSceneMeshBuffersMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateSceneComponentsMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateSceneComponentsMSFT", function_loader.LocateSceneComponentsMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
-    XrSceneComponentsLocateInfoMSFT* locateInfo{};
+    const XrSceneComponentsLocateInfoMSFT* locateInfo{};
     deserialize_ptr(&locateInfo, d_ctx);
     XrSceneComponentLocationsMSFT* locations{};
     deserialize_ptr(&locations, d_ctx);
@@ -7173,12 +10197,17 @@ void FunctionDispatch::handle_xrLocateSceneComponentsMSFT(MessageLockIn msg_in)
     XrResult _result = function_loader.LocateSceneComponentsMSFT(scene, locateInfo, locations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(locations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
     cleanup_ptr(locateInfo, 1);
@@ -7190,21 +10219,31 @@ void FunctionDispatch::handle_xrLocateSceneComponentsMSFT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrDeserializeSceneMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDeserializeSceneMSFT", function_loader.DeserializeSceneMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneObserverMSFT sceneObserver{};
     deserialize(&sceneObserver, d_ctx);
-    XrSceneDeserializeInfoMSFT* deserializeInfo{};
+    const XrSceneDeserializeInfoMSFT* deserializeInfo{};
     deserialize_ptr(&deserializeInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DeserializeSceneMSFT(sceneObserver, deserializeInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&sceneObserver);
     cleanup_ptr(deserializeInfo, 1);
@@ -7213,29 +10252,39 @@ void FunctionDispatch::handle_xrDeserializeSceneMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSerializedSceneFragmentDataMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSerializedSceneFragmentDataMSFT", function_loader.GetSerializedSceneFragmentDataMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSceneMSFT scene{};
     deserialize(&scene, d_ctx);
-    XrSerializedSceneFragmentDataGetInfoMSFT* getInfo{};
+    const XrSerializedSceneFragmentDataGetInfoMSFT* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     uint32_t countInput{};
     deserialize(&countInput, d_ctx);
     uint32_t* readOutput{};
-    deserialize_ptr(&readOutput, d_ctx);
+    deserialize_output_ptr(&readOutput, d_ctx);
     uint8_t* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSerializedSceneFragmentDataMSFT(scene, getInfo, countInput, readOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(readOutput, 1, s_ctx);
     serialize_ptr(buffer, countInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&scene);
     cleanup_ptr(getInfo, 1);
@@ -7249,24 +10298,34 @@ void FunctionDispatch::handle_xrGetSerializedSceneFragmentDataMSFT(MessageLockIn
 void FunctionDispatch::handle_xrCreateSpatialAnchorMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorMSFT", function_loader.CreateSpatialAnchorMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorCreateInfoMSFT* createInfo{};
+    const XrSpatialAnchorCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpatialAnchorMSFT* anchor{};
-    deserialize_ptr(&anchor, d_ctx);
+    deserialize_output_ptr(&anchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorMSFT(session, createInfo, anchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(anchor, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -7276,24 +10335,34 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSpatialAnchorSpaceMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorSpaceMSFT", function_loader.CreateSpatialAnchorSpaceMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorSpaceCreateInfoMSFT* createInfo{};
+    const XrSpatialAnchorSpaceCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorSpaceMSFT(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -7303,19 +10372,38 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorSpaceMSFT(MessageLockIn msg_i
 void FunctionDispatch::handle_xrDestroySpatialAnchorMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySpatialAnchorMSFT", function_loader.DestroySpatialAnchorMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorMSFT anchor{};
     deserialize(&anchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySpatialAnchorMSFT(anchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(40003, _result);
+        }
+        cleanup(&anchor);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&anchor);
 }
@@ -7325,7 +10413,12 @@ void FunctionDispatch::handle_xrDestroySpatialAnchorMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrClearSpatialAnchorStoreMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrClearSpatialAnchorStoreMSFT", function_loader.ClearSpatialAnchorStoreMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore{};
     deserialize(&spatialAnchorStore, d_ctx);
 
@@ -7333,11 +10426,16 @@ void FunctionDispatch::handle_xrClearSpatialAnchorStoreMSFT(MessageLockIn msg_in
     XrResult _result = function_loader.ClearSpatialAnchorStoreMSFT(spatialAnchorStore);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&spatialAnchorStore);
 }
@@ -7345,24 +10443,34 @@ void FunctionDispatch::handle_xrClearSpatialAnchorStoreMSFT(MessageLockIn msg_in
 void FunctionDispatch::handle_xrCreateSpatialAnchorFromPersistedNameMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorFromPersistedNameMSFT", function_loader.CreateSpatialAnchorFromPersistedNameMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* spatialAnchorCreateInfo{};
+    const XrSpatialAnchorFromPersistedAnchorCreateInfoMSFT* spatialAnchorCreateInfo{};
     deserialize_ptr(&spatialAnchorCreateInfo, d_ctx);
     XrSpatialAnchorMSFT* spatialAnchor{};
-    deserialize_ptr(&spatialAnchor, d_ctx);
+    deserialize_output_ptr(&spatialAnchor, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorFromPersistedNameMSFT(session, spatialAnchorCreateInfo, spatialAnchor);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(spatialAnchor, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(spatialAnchorCreateInfo, 1);
@@ -7372,22 +10480,32 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorFromPersistedNameMSFT(Message
 void FunctionDispatch::handle_xrCreateSpatialAnchorStoreConnectionMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialAnchorStoreConnectionMSFT", function_loader.CreateSpatialAnchorStoreConnectionMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrSpatialAnchorStoreConnectionMSFT* spatialAnchorStore{};
-    deserialize_ptr(&spatialAnchorStore, d_ctx);
+    deserialize_output_ptr(&spatialAnchorStore, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialAnchorStoreConnectionMSFT(session, spatialAnchorStore);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(spatialAnchorStore, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(spatialAnchorStore, 1);
@@ -7396,19 +10514,38 @@ void FunctionDispatch::handle_xrCreateSpatialAnchorStoreConnectionMSFT(MessageLo
 void FunctionDispatch::handle_xrDestroySpatialAnchorStoreConnectionMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySpatialAnchorStoreConnectionMSFT", function_loader.DestroySpatialAnchorStoreConnectionMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore{};
     deserialize(&spatialAnchorStore, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySpatialAnchorStoreConnectionMSFT(spatialAnchorStore);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(143004, _result);
+        }
+        cleanup(&spatialAnchorStore);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&spatialAnchorStore);
 }
@@ -7416,27 +10553,37 @@ void FunctionDispatch::handle_xrDestroySpatialAnchorStoreConnectionMSFT(MessageL
 void FunctionDispatch::handle_xrEnumeratePersistedSpatialAnchorNamesMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumeratePersistedSpatialAnchorNamesMSFT", function_loader.EnumeratePersistedSpatialAnchorNamesMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore{};
     deserialize(&spatialAnchorStore, d_ctx);
     uint32_t spatialAnchorNameCapacityInput{};
     deserialize(&spatialAnchorNameCapacityInput, d_ctx);
     uint32_t* spatialAnchorNameCountOutput{};
-    deserialize_ptr(&spatialAnchorNameCountOutput, d_ctx);
+    deserialize_output_ptr(&spatialAnchorNameCountOutput, d_ctx);
     XrSpatialAnchorPersistenceNameMSFT* spatialAnchorNames{};
-    deserialize_ptr(&spatialAnchorNames, d_ctx);
+    deserialize_output_ptr(&spatialAnchorNames, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumeratePersistedSpatialAnchorNamesMSFT(spatialAnchorStore, spatialAnchorNameCapacityInput, spatialAnchorNameCountOutput, spatialAnchorNames);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(spatialAnchorNameCountOutput, 1, s_ctx);
-    serialize_ptr(spatialAnchorNames, spatialAnchorNameCapacityInput, s_ctx);
+    serialize_filled_ptr(spatialAnchorNames, spatialAnchorNameCapacityInput, XR_SUCCEEDED(_result) && spatialAnchorNameCountOutput ? *spatialAnchorNameCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&spatialAnchorStore);
     cleanup(&spatialAnchorNameCapacityInput);
@@ -7447,21 +10594,31 @@ void FunctionDispatch::handle_xrEnumeratePersistedSpatialAnchorNamesMSFT(Message
 void FunctionDispatch::handle_xrPersistSpatialAnchorMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPersistSpatialAnchorMSFT", function_loader.PersistSpatialAnchorMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore{};
     deserialize(&spatialAnchorStore, d_ctx);
-    XrSpatialAnchorPersistenceInfoMSFT* spatialAnchorPersistenceInfo{};
+    const XrSpatialAnchorPersistenceInfoMSFT* spatialAnchorPersistenceInfo{};
     deserialize_ptr(&spatialAnchorPersistenceInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PersistSpatialAnchorMSFT(spatialAnchorStore, spatialAnchorPersistenceInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&spatialAnchorStore);
     cleanup_ptr(spatialAnchorPersistenceInfo, 1);
@@ -7470,21 +10627,31 @@ void FunctionDispatch::handle_xrPersistSpatialAnchorMSFT(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrUnpersistSpatialAnchorMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrUnpersistSpatialAnchorMSFT", function_loader.UnpersistSpatialAnchorMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialAnchorStoreConnectionMSFT spatialAnchorStore{};
     deserialize(&spatialAnchorStore, d_ctx);
-    XrSpatialAnchorPersistenceNameMSFT* spatialAnchorPersistenceName{};
+    const XrSpatialAnchorPersistenceNameMSFT* spatialAnchorPersistenceName{};
     deserialize_ptr(&spatialAnchorPersistenceName, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.UnpersistSpatialAnchorMSFT(spatialAnchorStore, spatialAnchorPersistenceName);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&spatialAnchorStore);
     cleanup_ptr(spatialAnchorPersistenceName, 1);
@@ -7495,24 +10662,34 @@ void FunctionDispatch::handle_xrUnpersistSpatialAnchorMSFT(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrCreateSpatialGraphNodeSpaceMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSpatialGraphNodeSpaceMSFT", function_loader.CreateSpatialGraphNodeSpaceMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialGraphNodeSpaceCreateInfoMSFT* createInfo{};
+    const XrSpatialGraphNodeSpaceCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSpatialGraphNodeSpaceMSFT(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -7522,19 +10699,38 @@ void FunctionDispatch::handle_xrCreateSpatialGraphNodeSpaceMSFT(MessageLockIn ms
 void FunctionDispatch::handle_xrDestroySpatialGraphNodeBindingMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySpatialGraphNodeBindingMSFT", function_loader.DestroySpatialGraphNodeBindingMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialGraphNodeBindingMSFT nodeBinding{};
     deserialize(&nodeBinding, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySpatialGraphNodeBindingMSFT(nodeBinding);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(50002, _result);
+        }
+        cleanup(&nodeBinding);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&nodeBinding);
 }
@@ -7542,24 +10738,34 @@ void FunctionDispatch::handle_xrDestroySpatialGraphNodeBindingMSFT(MessageLockIn
 void FunctionDispatch::handle_xrGetSpatialGraphNodeBindingPropertiesMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSpatialGraphNodeBindingPropertiesMSFT", function_loader.GetSpatialGraphNodeBindingPropertiesMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpatialGraphNodeBindingMSFT nodeBinding{};
     deserialize(&nodeBinding, d_ctx);
-    XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* getInfo{};
+    const XrSpatialGraphNodeBindingPropertiesGetInfoMSFT* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrSpatialGraphNodeBindingPropertiesMSFT* properties{};
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_output_xr_ptr(&properties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSpatialGraphNodeBindingPropertiesMSFT(nodeBinding, getInfo, properties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(properties, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&nodeBinding);
     cleanup_ptr(getInfo, 1);
@@ -7569,24 +10775,34 @@ void FunctionDispatch::handle_xrGetSpatialGraphNodeBindingPropertiesMSFT(Message
 void FunctionDispatch::handle_xrTryCreateSpatialGraphStaticNodeBindingMSFT(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrTryCreateSpatialGraphStaticNodeBindingMSFT", function_loader.TryCreateSpatialGraphStaticNodeBindingMSFT);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpatialGraphStaticNodeBindingCreateInfoMSFT* createInfo{};
+    const XrSpatialGraphStaticNodeBindingCreateInfoMSFT* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpatialGraphNodeBindingMSFT* nodeBinding{};
-    deserialize_ptr(&nodeBinding, d_ctx);
+    deserialize_output_ptr(&nodeBinding, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.TryCreateSpatialGraphStaticNodeBindingMSFT(session, createInfo, nodeBinding);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(nodeBinding, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -7598,7 +10814,12 @@ void FunctionDispatch::handle_xrTryCreateSpatialGraphStaticNodeBindingMSFT(Messa
 void FunctionDispatch::handle_xrGetAudioInputDeviceGuidOculus(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetAudioInputDeviceGuidOculus", function_loader.GetAudioInputDeviceGuidOculus);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     wchar_t buffer[XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS]{};
@@ -7608,12 +10829,17 @@ void FunctionDispatch::handle_xrGetAudioInputDeviceGuidOculus(MessageLockIn msg_
     XrResult _result = function_loader.GetAudioInputDeviceGuidOculus(instance, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(buffer, XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_array(buffer, XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS);
@@ -7622,7 +10848,12 @@ void FunctionDispatch::handle_xrGetAudioInputDeviceGuidOculus(MessageLockIn msg_
 void FunctionDispatch::handle_xrGetAudioOutputDeviceGuidOculus(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetAudioOutputDeviceGuidOculus", function_loader.GetAudioOutputDeviceGuidOculus);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     wchar_t buffer[XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS]{};
@@ -7632,12 +10863,17 @@ void FunctionDispatch::handle_xrGetAudioOutputDeviceGuidOculus(MessageLockIn msg
     XrResult _result = function_loader.GetAudioOutputDeviceGuidOculus(instance, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(buffer, XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_array(buffer, XR_MAX_AUDIO_DEVICE_STR_SIZE_OCULUS);
@@ -7648,27 +10884,37 @@ void FunctionDispatch::handle_xrGetAudioOutputDeviceGuidOculus(MessageLockIn msg
 void FunctionDispatch::handle_xrEnumerateExternalCamerasOCULUS(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateExternalCamerasOCULUS", function_loader.EnumerateExternalCamerasOCULUS);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint32_t cameraCapacityInput{};
     deserialize(&cameraCapacityInput, d_ctx);
     uint32_t* cameraCountOutput{};
-    deserialize_ptr(&cameraCountOutput, d_ctx);
+    deserialize_output_ptr(&cameraCountOutput, d_ctx);
     XrExternalCameraOCULUS* cameras{};
-    deserialize_ptr(&cameras, d_ctx);
+    deserialize_output_xr_ptr(&cameras, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateExternalCamerasOCULUS(session, cameraCapacityInput, cameraCountOutput, cameras);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(cameraCountOutput, 1, s_ctx);
-    serialize_ptr(cameras, cameraCapacityInput, s_ctx);
+    serialize_filled_ptr(cameras, cameraCapacityInput, XR_SUCCEEDED(_result) && cameraCountOutput ? *cameraCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&cameraCapacityInput);
@@ -7681,7 +10927,12 @@ void FunctionDispatch::handle_xrEnumerateExternalCamerasOCULUS(MessageLockIn msg
 void FunctionDispatch::handle_xrSetTrackingOptimizationSettingsHintQCOM(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetTrackingOptimizationSettingsHintQCOM", function_loader.SetTrackingOptimizationSettingsHintQCOM);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrTrackingOptimizationSettingsDomainQCOM domain{};
@@ -7693,11 +10944,16 @@ void FunctionDispatch::handle_xrSetTrackingOptimizationSettingsHintQCOM(MessageL
     XrResult _result = function_loader.SetTrackingOptimizationSettingsHintQCOM(session, domain, hint);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&domain);
@@ -7709,7 +10965,12 @@ void FunctionDispatch::handle_xrSetTrackingOptimizationSettingsHintQCOM(MessageL
 void FunctionDispatch::handle_xrSetEnvironmentDepthEstimationVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetEnvironmentDepthEstimationVARJO", function_loader.SetEnvironmentDepthEstimationVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrBool32 enabled{};
@@ -7719,11 +10980,16 @@ void FunctionDispatch::handle_xrSetEnvironmentDepthEstimationVARJO(MessageLockIn
     XrResult _result = function_loader.SetEnvironmentDepthEstimationVARJO(session, enabled);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&enabled);
@@ -7734,24 +11000,34 @@ void FunctionDispatch::handle_xrSetEnvironmentDepthEstimationVARJO(MessageLockIn
 void FunctionDispatch::handle_xrCreateMarkerSpaceVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateMarkerSpaceVARJO", function_loader.CreateMarkerSpaceVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrMarkerSpaceCreateInfoVARJO* createInfo{};
+    const XrMarkerSpaceCreateInfoVARJO* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateMarkerSpaceVARJO(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -7761,24 +11037,34 @@ void FunctionDispatch::handle_xrCreateMarkerSpaceVARJO(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetMarkerSizeVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetMarkerSizeVARJO", function_loader.GetMarkerSizeVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint64_t markerId{};
     deserialize(&markerId, d_ctx);
     XrExtent2Df* size{};
-    deserialize_ptr(&size, d_ctx);
+    deserialize_output_ptr(&size, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetMarkerSizeVARJO(session, markerId, size);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(size, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&markerId);
@@ -7788,7 +11074,12 @@ void FunctionDispatch::handle_xrGetMarkerSizeVARJO(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSetMarkerTrackingPredictionVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetMarkerTrackingPredictionVARJO", function_loader.SetMarkerTrackingPredictionVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint64_t markerId{};
@@ -7800,11 +11091,16 @@ void FunctionDispatch::handle_xrSetMarkerTrackingPredictionVARJO(MessageLockIn m
     XrResult _result = function_loader.SetMarkerTrackingPredictionVARJO(session, markerId, enable);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&markerId);
@@ -7814,7 +11110,12 @@ void FunctionDispatch::handle_xrSetMarkerTrackingPredictionVARJO(MessageLockIn m
 void FunctionDispatch::handle_xrSetMarkerTrackingTimeoutVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetMarkerTrackingTimeoutVARJO", function_loader.SetMarkerTrackingTimeoutVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint64_t markerId{};
@@ -7826,11 +11127,16 @@ void FunctionDispatch::handle_xrSetMarkerTrackingTimeoutVARJO(MessageLockIn msg_
     XrResult _result = function_loader.SetMarkerTrackingTimeoutVARJO(session, markerId, timeout);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&markerId);
@@ -7840,7 +11146,12 @@ void FunctionDispatch::handle_xrSetMarkerTrackingTimeoutVARJO(MessageLockIn msg_
 void FunctionDispatch::handle_xrSetMarkerTrackingVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetMarkerTrackingVARJO", function_loader.SetMarkerTrackingVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrBool32 enabled{};
@@ -7850,11 +11161,16 @@ void FunctionDispatch::handle_xrSetMarkerTrackingVARJO(MessageLockIn msg_in) {
     XrResult _result = function_loader.SetMarkerTrackingVARJO(session, enabled);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&enabled);
@@ -7865,7 +11181,12 @@ void FunctionDispatch::handle_xrSetMarkerTrackingVARJO(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSetViewOffsetVARJO(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSetViewOffsetVARJO", function_loader.SetViewOffsetVARJO);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     float offset{};
@@ -7875,11 +11196,16 @@ void FunctionDispatch::handle_xrSetViewOffsetVARJO(MessageLockIn msg_in) {
     XrResult _result = function_loader.SetViewOffsetVARJO(session, offset);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&offset);
@@ -7889,24 +11215,34 @@ void FunctionDispatch::handle_xrSetViewOffsetVARJO(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrAcquireSwapchainImage(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrAcquireSwapchainImage", function_loader.AcquireSwapchainImage);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
-    XrSwapchainImageAcquireInfo* acquireInfo{};
+    const XrSwapchainImageAcquireInfo* acquireInfo{};
     deserialize_ptr(&acquireInfo, d_ctx);
     uint32_t* index{};
-    deserialize_ptr(&index, d_ctx);
+    deserialize_output_ptr(&index, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.AcquireSwapchainImage(swapchain, acquireInfo, index);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(index, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup_ptr(acquireInfo, 1);
@@ -7916,23 +11252,44 @@ void FunctionDispatch::handle_xrAcquireSwapchainImage(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrApplyHapticFeedback(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrApplyHapticFeedback", function_loader.ApplyHapticFeedback);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrHapticActionInfo* hapticActionInfo{};
+    const XrHapticActionInfo* hapticActionInfo{};
     deserialize_ptr(&hapticActionInfo, d_ctx);
-    XrHapticBaseHeader* hapticFeedback{};
+    const XrHapticBaseHeader* hapticFeedback{};
     deserialize_xr(&hapticFeedback, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ApplyHapticFeedback(session, hapticActionInfo, hapticFeedback);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(2, _result);
+        }
+        cleanup(&session);
+        cleanup_ptr(hapticActionInfo, 1);
+        cleanup_xr(hapticFeedback);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(hapticActionInfo, 1);
@@ -7942,21 +11299,31 @@ void FunctionDispatch::handle_xrApplyHapticFeedback(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrAttachSessionActionSets(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrAttachSessionActionSets", function_loader.AttachSessionActionSets);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSessionActionSetsAttachInfo* attachInfo{};
+    const XrSessionActionSetsAttachInfo* attachInfo{};
     deserialize_ptr(&attachInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.AttachSessionActionSets(session, attachInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(attachInfo, 1);
@@ -7965,21 +11332,41 @@ void FunctionDispatch::handle_xrAttachSessionActionSets(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrBeginFrame(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrBeginFrame", function_loader.BeginFrame);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFrameBeginInfo* frameBeginInfo{};
+    const XrFrameBeginInfo* frameBeginInfo{};
     deserialize_ptr(&frameBeginInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.BeginFrame(session, frameBeginInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(4, _result);
+        }
+        cleanup(&session);
+        cleanup_ptr(frameBeginInfo, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(frameBeginInfo, 1);
@@ -7988,21 +11375,31 @@ void FunctionDispatch::handle_xrBeginFrame(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrBeginSession(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrBeginSession", function_loader.BeginSession);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSessionBeginInfo* beginInfo{};
+    const XrSessionBeginInfo* beginInfo{};
     deserialize_ptr(&beginInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.BeginSession(session, beginInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(beginInfo, 1);
@@ -8011,24 +11408,43 @@ void FunctionDispatch::handle_xrBeginSession(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateAction(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateAction", function_loader.CreateAction);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrActionSet actionSet{};
     deserialize(&actionSet, d_ctx);
-    XrActionCreateInfo* createInfo{};
+    const XrActionCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrAction* action{};
-    deserialize_ptr(&action, d_ctx);
+    deserialize_output_ptr(&action, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateAction(actionSet, createInfo, action);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (pipelined_call) {
+        // the client already returned a virtual handle, which is bound to the one that was created
+        finish_pipelined_call(6, _result, action ? handle_value(*action) : 0);
+        cleanup(&actionSet);
+        cleanup_ptr(createInfo, 1);
+        cleanup_ptr(action, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(action, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&actionSet);
     cleanup_ptr(createInfo, 1);
@@ -8038,24 +11454,43 @@ void FunctionDispatch::handle_xrCreateAction(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateActionSet(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateActionSet", function_loader.CreateActionSet);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrActionSetCreateInfo* createInfo{};
+    const XrActionSetCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrActionSet* actionSet{};
-    deserialize_ptr(&actionSet, d_ctx);
+    deserialize_output_ptr(&actionSet, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateActionSet(instance, createInfo, actionSet);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (pipelined_call) {
+        // the client already returned a virtual handle, which is bound to the one that was created
+        finish_pipelined_call(7, _result, actionSet ? handle_value(*actionSet) : 0);
+        cleanup(&instance);
+        cleanup_ptr(createInfo, 1);
+        cleanup_ptr(actionSet, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(actionSet, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(createInfo, 1);
@@ -8065,24 +11500,43 @@ void FunctionDispatch::handle_xrCreateActionSet(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateActionSpace(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateActionSpace", function_loader.CreateActionSpace);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrActionSpaceCreateInfo* createInfo{};
+    const XrActionSpaceCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateActionSpace(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (pipelined_call) {
+        // the client already returned a virtual handle, which is bound to the one that was created
+        finish_pipelined_call(8, _result, space ? handle_value(*space) : 0);
+        cleanup(&session);
+        cleanup_ptr(createInfo, 1);
+        cleanup_ptr(space, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -8097,24 +11551,43 @@ void FunctionDispatch::handle_xrCreateInstance(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateReferenceSpace(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateReferenceSpace", function_loader.CreateReferenceSpace);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrReferenceSpaceCreateInfo* createInfo{};
+    const XrReferenceSpaceCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSpace* space{};
-    deserialize_ptr(&space, d_ctx);
+    deserialize_output_ptr(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateReferenceSpace(session, createInfo, space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (pipelined_call) {
+        // the client already returned a virtual handle, which is bound to the one that was created
+        finish_pipelined_call(10, _result, space ? handle_value(*space) : 0);
+        cleanup(&session);
+        cleanup_ptr(createInfo, 1);
+        cleanup_ptr(space, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(space, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -8124,24 +11597,34 @@ void FunctionDispatch::handle_xrCreateReferenceSpace(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSession(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSession", function_loader.CreateSession);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrSessionCreateInfo* createInfo{};
+    const XrSessionCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSession* session{};
-    deserialize_ptr(&session, d_ctx);
+    deserialize_output_ptr(&session, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSession(instance, createInfo, session);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(session, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(createInfo, 1);
@@ -8151,24 +11634,34 @@ void FunctionDispatch::handle_xrCreateSession(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrCreateSwapchain(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateSwapchain", function_loader.CreateSwapchain);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSwapchainCreateInfo* createInfo{};
+    const XrSwapchainCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrSwapchain* swapchain{};
-    deserialize_ptr(&swapchain, d_ctx);
+    deserialize_output_ptr(&swapchain, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.CreateSwapchain(session, createInfo, swapchain);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(swapchain, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(createInfo, 1);
@@ -8178,19 +11671,38 @@ void FunctionDispatch::handle_xrCreateSwapchain(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyAction(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyAction", function_loader.DestroyAction);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrAction action{};
     deserialize(&action, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyAction(action);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(13, _result);
+        }
+        cleanup(&action);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&action);
 }
@@ -8198,19 +11710,38 @@ void FunctionDispatch::handle_xrDestroyAction(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroyActionSet(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyActionSet", function_loader.DestroyActionSet);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrActionSet actionSet{};
     deserialize(&actionSet, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroyActionSet(actionSet);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(14, _result);
+        }
+        cleanup(&actionSet);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&actionSet);
 }
@@ -8223,19 +11754,38 @@ void FunctionDispatch::handle_xrDestroyInstance(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySession(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySession", function_loader.DestroySession);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySession(session);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(16, _result);
+        }
+        cleanup(&session);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
 }
@@ -8243,19 +11793,38 @@ void FunctionDispatch::handle_xrDestroySession(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySpace(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySpace", function_loader.DestroySpace);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySpace(space);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(17, _result);
+        }
+        cleanup(&space);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
 }
@@ -8263,19 +11832,38 @@ void FunctionDispatch::handle_xrDestroySpace(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrDestroySwapchain(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroySwapchain", function_loader.DestroySwapchain);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.DestroySwapchain(swapchain);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(18, _result);
+        }
+        cleanup(&swapchain);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
 }
@@ -8283,21 +11871,31 @@ void FunctionDispatch::handle_xrDestroySwapchain(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEndFrame(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEndFrame", function_loader.EndFrame);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFrameEndInfo* frameEndInfo{};
+    const XrFrameEndInfo* frameEndInfo{};
     deserialize_ptr(&frameEndInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EndFrame(session, frameEndInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(frameEndInfo, 1);
@@ -8306,7 +11904,12 @@ void FunctionDispatch::handle_xrEndFrame(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEndSession(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEndSession", function_loader.EndSession);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
 
@@ -8314,11 +11917,16 @@ void FunctionDispatch::handle_xrEndSession(MessageLockIn msg_in) {
     XrResult _result = function_loader.EndSession(session);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
 }
@@ -8326,25 +11934,35 @@ void FunctionDispatch::handle_xrEndSession(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateApiLayerProperties(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateApiLayerProperties", function_loader.EnumerateApiLayerProperties);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     uint32_t propertyCapacityInput{};
     deserialize(&propertyCapacityInput, d_ctx);
     uint32_t* propertyCountOutput{};
-    deserialize_ptr(&propertyCountOutput, d_ctx);
+    deserialize_output_ptr(&propertyCountOutput, d_ctx);
     XrApiLayerProperties* properties{};
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_output_xr_ptr(&properties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateApiLayerProperties(propertyCapacityInput, propertyCountOutput, properties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(propertyCountOutput, 1, s_ctx);
-    serialize_ptr(properties, propertyCapacityInput, s_ctx);
+    serialize_filled_ptr(properties, propertyCapacityInput, XR_SUCCEEDED(_result) && propertyCountOutput ? *propertyCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&propertyCapacityInput);
     cleanup_ptr(propertyCountOutput, 1);
@@ -8354,29 +11972,39 @@ void FunctionDispatch::handle_xrEnumerateApiLayerProperties(MessageLockIn msg_in
 void FunctionDispatch::handle_xrEnumerateBoundSourcesForAction(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateBoundSourcesForAction", function_loader.EnumerateBoundSourcesForAction);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrBoundSourcesForActionEnumerateInfo* enumerateInfo{};
+    const XrBoundSourcesForActionEnumerateInfo* enumerateInfo{};
     deserialize_ptr(&enumerateInfo, d_ctx);
     uint32_t sourceCapacityInput{};
     deserialize(&sourceCapacityInput, d_ctx);
     uint32_t* sourceCountOutput{};
-    deserialize_ptr(&sourceCountOutput, d_ctx);
+    deserialize_output_ptr(&sourceCountOutput, d_ctx);
     XrPath* sources{};
-    deserialize_ptr(&sources, d_ctx);
+    deserialize_output_ptr(&sources, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateBoundSourcesForAction(session, enumerateInfo, sourceCapacityInput, sourceCountOutput, sources);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(sourceCountOutput, 1, s_ctx);
-    serialize_ptr(sources, sourceCapacityInput, s_ctx);
+    serialize_filled_ptr(sources, sourceCapacityInput, XR_SUCCEEDED(_result) && sourceCountOutput ? *sourceCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(enumerateInfo, 1);
@@ -8388,7 +12016,12 @@ void FunctionDispatch::handle_xrEnumerateBoundSourcesForAction(MessageLockIn msg
 void FunctionDispatch::handle_xrEnumerateEnvironmentBlendModes(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateEnvironmentBlendModes", function_loader.EnumerateEnvironmentBlendModes);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -8398,21 +12031,26 @@ void FunctionDispatch::handle_xrEnumerateEnvironmentBlendModes(MessageLockIn msg
     uint32_t environmentBlendModeCapacityInput{};
     deserialize(&environmentBlendModeCapacityInput, d_ctx);
     uint32_t* environmentBlendModeCountOutput{};
-    deserialize_ptr(&environmentBlendModeCountOutput, d_ctx);
+    deserialize_output_ptr(&environmentBlendModeCountOutput, d_ctx);
     XrEnvironmentBlendMode* environmentBlendModes{};
-    deserialize_ptr(&environmentBlendModes, d_ctx);
+    deserialize_output_ptr(&environmentBlendModes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateEnvironmentBlendModes(instance, systemId, viewConfigurationType, environmentBlendModeCapacityInput, environmentBlendModeCountOutput, environmentBlendModes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(environmentBlendModeCountOutput, 1, s_ctx);
-    serialize_ptr(environmentBlendModes, environmentBlendModeCapacityInput, s_ctx);
+    serialize_filled_ptr(environmentBlendModes, environmentBlendModeCapacityInput, XR_SUCCEEDED(_result) && environmentBlendModeCountOutput ? *environmentBlendModeCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -8425,27 +12063,37 @@ void FunctionDispatch::handle_xrEnumerateEnvironmentBlendModes(MessageLockIn msg
 void FunctionDispatch::handle_xrEnumerateInstanceExtensionProperties(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateInstanceExtensionProperties", function_loader.EnumerateInstanceExtensionProperties);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
-    char* layerName{};
-    deserialize_ptr(&layerName, d_ctx);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
+    const char* layerName{};
+    deserialize_string(&layerName, d_ctx);
     uint32_t propertyCapacityInput{};
     deserialize(&propertyCapacityInput, d_ctx);
     uint32_t* propertyCountOutput{};
-    deserialize_ptr(&propertyCountOutput, d_ctx);
+    deserialize_output_ptr(&propertyCountOutput, d_ctx);
     XrExtensionProperties* properties{};
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_output_xr_ptr(&properties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateInstanceExtensionProperties(layerName, propertyCapacityInput, propertyCountOutput, properties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(propertyCountOutput, 1, s_ctx);
-    serialize_ptr(properties, propertyCapacityInput, s_ctx);
+    serialize_filled_ptr(properties, propertyCapacityInput, XR_SUCCEEDED(_result) && propertyCountOutput ? *propertyCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup_ptr(layerName, count_null_terminated(layerName));
     cleanup(&propertyCapacityInput);
@@ -8456,27 +12104,37 @@ void FunctionDispatch::handle_xrEnumerateInstanceExtensionProperties(MessageLock
 void FunctionDispatch::handle_xrEnumerateReferenceSpaces(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateReferenceSpaces", function_loader.EnumerateReferenceSpaces);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint32_t spaceCapacityInput{};
     deserialize(&spaceCapacityInput, d_ctx);
     uint32_t* spaceCountOutput{};
-    deserialize_ptr(&spaceCountOutput, d_ctx);
+    deserialize_output_ptr(&spaceCountOutput, d_ctx);
     XrReferenceSpaceType* spaces{};
-    deserialize_ptr(&spaces, d_ctx);
+    deserialize_output_ptr(&spaces, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateReferenceSpaces(session, spaceCapacityInput, spaceCountOutput, spaces);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(spaceCountOutput, 1, s_ctx);
-    serialize_ptr(spaces, spaceCapacityInput, s_ctx);
+    serialize_filled_ptr(spaces, spaceCapacityInput, XR_SUCCEEDED(_result) && spaceCountOutput ? *spaceCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&spaceCapacityInput);
@@ -8487,27 +12145,37 @@ void FunctionDispatch::handle_xrEnumerateReferenceSpaces(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateSwapchainFormats(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateSwapchainFormats", function_loader.EnumerateSwapchainFormats);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     uint32_t formatCapacityInput{};
     deserialize(&formatCapacityInput, d_ctx);
     uint32_t* formatCountOutput{};
-    deserialize_ptr(&formatCountOutput, d_ctx);
+    deserialize_output_ptr(&formatCountOutput, d_ctx);
     int64_t* formats{};
-    deserialize_ptr(&formats, d_ctx);
+    deserialize_output_ptr(&formats, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateSwapchainFormats(session, formatCapacityInput, formatCountOutput, formats);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(formatCountOutput, 1, s_ctx);
-    serialize_ptr(formats, formatCapacityInput, s_ctx);
+    serialize_filled_ptr(formats, formatCapacityInput, XR_SUCCEEDED(_result) && formatCountOutput ? *formatCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&formatCapacityInput);
@@ -8518,13 +12186,18 @@ void FunctionDispatch::handle_xrEnumerateSwapchainFormats(MessageLockIn msg_in)
 void FunctionDispatch::handle_xrEnumerateSwapchainImages(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateSwapchainImages", function_loader.EnumerateSwapchainImages);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
     uint32_t imageCapacityInput{};
     deserialize(&imageCapacityInput, d_ctx);
     uint32_t* imageCountOutput{};
-    deserialize_ptr(&imageCountOutput, d_ctx);
+    deserialize_output_ptr(&imageCountOutput, d_ctx);
     XrSwapchainImageBaseHeader* images{};
     deserialize_xr_array(&images, d_ctx);
 
@@ -8532,13 +12205,18 @@ void FunctionDispatch::handle_xrEnumerateSwapchainImages(MessageLockIn msg_in) {
     XrResult _result = function_loader.EnumerateSwapchainImages(swapchain, imageCapacityInput, imageCountOutput, images);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(imageCountOutput, 1, s_ctx);
-    serialize_xr_array(images, imageCapacityInput, s_ctx);
+    serialize_filled_xr_array(images, imageCapacityInput, XR_SUCCEEDED(_result) && imageCountOutput ? *imageCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup(&imageCapacityInput);
@@ -8549,7 +12227,12 @@ void FunctionDispatch::handle_xrEnumerateSwapchainImages(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrEnumerateViewConfigurationViews(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateViewConfigurationViews", function_loader.EnumerateViewConfigurationViews);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -8559,21 +12242,26 @@ void FunctionDispatch::handle_xrEnumerateViewConfigurationViews(MessageLockIn ms
     uint32_t viewCapacityInput{};
     deserialize(&viewCapacityInput, d_ctx);
     uint32_t* viewCountOutput{};
-    deserialize_ptr(&viewCountOutput, d_ctx);
+    deserialize_output_ptr(&viewCountOutput, d_ctx);
     XrViewConfigurationView* views{};
-    deserialize_ptr(&views, d_ctx);
+    deserialize_output_xr_ptr(&views, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateViewConfigurationViews(instance, systemId, viewConfigurationType, viewCapacityInput, viewCountOutput, views);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(viewCountOutput, 1, s_ctx);
-    serialize_ptr(views, viewCapacityInput, s_ctx);
+    serialize_filled_ptr(views, viewCapacityInput, XR_SUCCEEDED(_result) && viewCountOutput ? *viewCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -8586,7 +12274,12 @@ void FunctionDispatch::handle_xrEnumerateViewConfigurationViews(MessageLockIn ms
 void FunctionDispatch::handle_xrEnumerateViewConfigurations(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrEnumerateViewConfigurations", function_loader.EnumerateViewConfigurations);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -8594,21 +12287,26 @@ void FunctionDispatch::handle_xrEnumerateViewConfigurations(MessageLockIn msg_in
     uint32_t viewConfigurationTypeCapacityInput{};
     deserialize(&viewConfigurationTypeCapacityInput, d_ctx);
     uint32_t* viewConfigurationTypeCountOutput{};
-    deserialize_ptr(&viewConfigurationTypeCountOutput, d_ctx);
+    deserialize_output_ptr(&viewConfigurationTypeCountOutput, d_ctx);
     XrViewConfigurationType* viewConfigurationTypes{};
-    deserialize_ptr(&viewConfigurationTypes, d_ctx);
+    deserialize_output_ptr(&viewConfigurationTypes, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.EnumerateViewConfigurations(instance, systemId, viewConfigurationTypeCapacityInput, viewConfigurationTypeCountOutput, viewConfigurationTypes);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(viewConfigurationTypeCountOutput, 1, s_ctx);
-    serialize_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, s_ctx);
+    serialize_filled_ptr(viewConfigurationTypes, viewConfigurationTypeCapacityInput, XR_SUCCEEDED(_result) && viewConfigurationTypeCountOutput ? *viewConfigurationTypeCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -8620,24 +12318,34 @@ void FunctionDispatch::handle_xrEnumerateViewConfigurations(MessageLockIn msg_in
 void FunctionDispatch::handle_xrGetActionStateBoolean(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetActionStateBoolean", function_loader.GetActionStateBoolean);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrActionStateGetInfo* getInfo{};
+    const XrActionStateGetInfo* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrActionStateBoolean* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetActionStateBoolean(session, getInfo, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(getInfo, 1);
@@ -8647,24 +12355,34 @@ void FunctionDispatch::handle_xrGetActionStateBoolean(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetActionStateFloat(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetActionStateFloat", function_loader.GetActionStateFloat);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrActionStateGetInfo* getInfo{};
+    const XrActionStateGetInfo* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrActionStateFloat* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetActionStateFloat(session, getInfo, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(getInfo, 1);
@@ -8674,24 +12392,34 @@ void FunctionDispatch::handle_xrGetActionStateFloat(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetActionStatePose(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetActionStatePose", function_loader.GetActionStatePose);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrActionStateGetInfo* getInfo{};
+    const XrActionStateGetInfo* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrActionStatePose* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetActionStatePose(session, getInfo, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(getInfo, 1);
@@ -8701,24 +12429,34 @@ void FunctionDispatch::handle_xrGetActionStatePose(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetActionStateVector2f(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetActionStateVector2f", function_loader.GetActionStateVector2f);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrActionStateGetInfo* getInfo{};
+    const XrActionStateGetInfo* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrActionStateVector2f* state{};
-    deserialize_ptr(&state, d_ctx);
+    deserialize_output_xr_ptr(&state, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetActionStateVector2f(session, getInfo, state);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(state, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(getInfo, 1);
@@ -8728,24 +12466,34 @@ void FunctionDispatch::handle_xrGetActionStateVector2f(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetCurrentInteractionProfile(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetCurrentInteractionProfile", function_loader.GetCurrentInteractionProfile);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrPath topLevelUserPath{};
     deserialize(&topLevelUserPath, d_ctx);
     XrInteractionProfileState* interactionProfile{};
-    deserialize_ptr(&interactionProfile, d_ctx);
+    deserialize_output_xr_ptr(&interactionProfile, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetCurrentInteractionProfile(session, topLevelUserPath, interactionProfile);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(interactionProfile, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&topLevelUserPath);
@@ -8755,29 +12503,39 @@ void FunctionDispatch::handle_xrGetCurrentInteractionProfile(MessageLockIn msg_i
 void FunctionDispatch::handle_xrGetInputSourceLocalizedName(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetInputSourceLocalizedName", function_loader.GetInputSourceLocalizedName);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrInputSourceLocalizedNameGetInfo* getInfo{};
+    const XrInputSourceLocalizedNameGetInfo* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetInputSourceLocalizedName(session, getInfo, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(getInfo, 1);
@@ -8789,22 +12547,32 @@ void FunctionDispatch::handle_xrGetInputSourceLocalizedName(MessageLockIn msg_in
 void FunctionDispatch::handle_xrGetInstanceProperties(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetInstanceProperties", function_loader.GetInstanceProperties);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrInstanceProperties* instanceProperties{};
-    deserialize_ptr(&instanceProperties, d_ctx);
+    deserialize_output_xr_ptr(&instanceProperties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetInstanceProperties(instance, instanceProperties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(instanceProperties, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(instanceProperties, 1);
@@ -8813,24 +12581,34 @@ void FunctionDispatch::handle_xrGetInstanceProperties(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetReferenceSpaceBoundsRect(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetReferenceSpaceBoundsRect", function_loader.GetReferenceSpaceBoundsRect);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
     XrReferenceSpaceType referenceSpaceType{};
     deserialize(&referenceSpaceType, d_ctx);
     XrExtent2Df* bounds{};
-    deserialize_ptr(&bounds, d_ctx);
+    deserialize_output_ptr(&bounds, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetReferenceSpaceBoundsRect(session, referenceSpaceType, bounds);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bounds, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup(&referenceSpaceType);
@@ -8840,24 +12618,34 @@ void FunctionDispatch::handle_xrGetReferenceSpaceBoundsRect(MessageLockIn msg_in
 void FunctionDispatch::handle_xrGetSystem(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSystem", function_loader.GetSystem);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrSystemGetInfo* getInfo{};
+    const XrSystemGetInfo* getInfo{};
     deserialize_ptr(&getInfo, d_ctx);
     XrSystemId* systemId{};
-    deserialize_ptr(&systemId, d_ctx);
+    deserialize_output_ptr(&systemId, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSystem(instance, getInfo, systemId);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(systemId, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(getInfo, 1);
@@ -8867,24 +12655,34 @@ void FunctionDispatch::handle_xrGetSystem(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetSystemProperties(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetSystemProperties", function_loader.GetSystemProperties);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
     deserialize(&systemId, d_ctx);
     XrSystemProperties* properties{};
-    deserialize_ptr(&properties, d_ctx);
+    deserialize_output_xr_ptr(&properties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetSystemProperties(instance, systemId, properties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(properties, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -8894,7 +12692,12 @@ void FunctionDispatch::handle_xrGetSystemProperties(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrGetViewConfigurationProperties(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrGetViewConfigurationProperties", function_loader.GetViewConfigurationProperties);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrSystemId systemId{};
@@ -8902,18 +12705,23 @@ void FunctionDispatch::handle_xrGetViewConfigurationProperties(MessageLockIn msg
     XrViewConfigurationType viewConfigurationType{};
     deserialize(&viewConfigurationType, d_ctx);
     XrViewConfigurationProperties* configurationProperties{};
-    deserialize_ptr(&configurationProperties, d_ctx);
+    deserialize_output_xr_ptr(&configurationProperties, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.GetViewConfigurationProperties(instance, systemId, viewConfigurationType, configurationProperties);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(configurationProperties, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&systemId);
@@ -8924,7 +12732,12 @@ void FunctionDispatch::handle_xrGetViewConfigurationProperties(MessageLockIn msg
 void FunctionDispatch::handle_xrLocateSpace(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateSpace", function_loader.LocateSpace);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSpace space{};
     deserialize(&space, d_ctx);
     XrSpace baseSpace{};
@@ -8932,18 +12745,23 @@ void FunctionDispatch::handle_xrLocateSpace(MessageLockIn msg_in) {
     XrTime time{};
     deserialize_time(&time, d_ctx);
     XrSpaceLocation* location{};
-    deserialize_ptr(&location, d_ctx);
+    deserialize_output_xr_ptr(&location, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.LocateSpace(space, baseSpace, time, location);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(location, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&space);
     cleanup(&baseSpace);
@@ -8954,10 +12772,15 @@ void FunctionDispatch::handle_xrLocateSpace(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateSpaces(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateSpaces", function_loader.LocateSpaces);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrSpacesLocateInfo* locateInfo{};
+    const XrSpacesLocateInfo* locateInfo{};
     deserialize_ptr(&locateInfo, d_ctx);
     XrSpaceLocations* spaceLocations{};
     deserialize_ptr(&spaceLocations, d_ctx);
@@ -8966,12 +12789,17 @@ void FunctionDispatch::handle_xrLocateSpaces(MessageLockIn msg_in) {
     XrResult _result = function_loader.LocateSpaces(session, locateInfo, spaceLocations);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(spaceLocations, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(locateInfo, 1);
@@ -8981,32 +12809,42 @@ void FunctionDispatch::handle_xrLocateSpaces(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrLocateViews(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrLocateViews", function_loader.LocateViews);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrViewLocateInfo* viewLocateInfo{};
+    const XrViewLocateInfo* viewLocateInfo{};
     deserialize_ptr(&viewLocateInfo, d_ctx);
     XrViewState* viewState{};
-    deserialize_ptr(&viewState, d_ctx);
+    deserialize_output_xr_ptr(&viewState, d_ctx);
     uint32_t viewCapacityInput{};
     deserialize(&viewCapacityInput, d_ctx);
     uint32_t* viewCountOutput{};
-    deserialize_ptr(&viewCountOutput, d_ctx);
+    deserialize_output_ptr(&viewCountOutput, d_ctx);
     XrView* views{};
-    deserialize_ptr(&views, d_ctx);
+    deserialize_output_xr_ptr(&views, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.LocateViews(session, viewLocateInfo, viewState, viewCapacityInput, viewCountOutput, views);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(viewState, 1, s_ctx);
     serialize_ptr(viewCountOutput, 1, s_ctx);
-    serialize_ptr(views, viewCapacityInput, s_ctx);
+    serialize_filled_ptr(views, viewCapacityInput, XR_SUCCEEDED(_result) && viewCountOutput ? *viewCountOutput : 0, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(viewLocateInfo, 1);
@@ -9019,7 +12857,12 @@ void FunctionDispatch::handle_xrLocateViews(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPathToString(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPathToString", function_loader.PathToString);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrPath path{};
@@ -9027,21 +12870,26 @@ void FunctionDispatch::handle_xrPathToString(MessageLockIn msg_in) {
     uint32_t bufferCapacityInput{};
     deserialize(&bufferCapacityInput, d_ctx);
     uint32_t* bufferCountOutput{};
-    deserialize_ptr(&bufferCountOutput, d_ctx);
+    deserialize_output_ptr(&bufferCountOutput, d_ctx);
     char* buffer{};
-    deserialize_ptr(&buffer, d_ctx);
+    deserialize_output_ptr(&buffer, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PathToString(instance, path, bufferCapacityInput, bufferCountOutput, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(bufferCountOutput, 1, s_ctx);
-    serialize_ptr(buffer, bufferCapacityInput, s_ctx);
+    serialize_string_buffer(buffer, bufferCapacityInput, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&path);
@@ -9053,22 +12901,32 @@ void FunctionDispatch::handle_xrPathToString(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrPollEvent(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrPollEvent", function_loader.PollEvent);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrEventDataBuffer* eventData{};
-    deserialize_ptr(&eventData, d_ctx);
+    deserialize_output_xr_ptr(&eventData, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.PollEvent(instance, eventData);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(eventData, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(eventData, 1);
@@ -9077,21 +12935,31 @@ void FunctionDispatch::handle_xrPollEvent(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrReleaseSwapchainImage(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrReleaseSwapchainImage", function_loader.ReleaseSwapchainImage);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
-    XrSwapchainImageReleaseInfo* releaseInfo{};
+    const XrSwapchainImageReleaseInfo* releaseInfo{};
     deserialize_ptr(&releaseInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ReleaseSwapchainImage(swapchain, releaseInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup_ptr(releaseInfo, 1);
@@ -9100,7 +12968,12 @@ void FunctionDispatch::handle_xrReleaseSwapchainImage(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrRequestExitSession(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrRequestExitSession", function_loader.RequestExitSession);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
 
@@ -9108,11 +12981,16 @@ void FunctionDispatch::handle_xrRequestExitSession(MessageLockIn msg_in) {
     XrResult _result = function_loader.RequestExitSession(session);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
 }
@@ -9120,24 +12998,34 @@ void FunctionDispatch::handle_xrRequestExitSession(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrResultToString(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrResultToString", function_loader.ResultToString);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrResult value{};
     deserialize(&value, d_ctx);
     char buffer[XR_MAX_RESULT_STRING_SIZE]{};
-    deserialize_array(buffer, XR_MAX_RESULT_STRING_SIZE, d_ctx);
+    deserialize_string_array(buffer, XR_MAX_RESULT_STRING_SIZE, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.ResultToString(instance, value, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
-    serialize_ptr(buffer, XR_MAX_RESULT_STRING_SIZE, s_ctx);
+    serialize_string_buffer(buffer, XR_MAX_RESULT_STRING_SIZE, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&value);
@@ -9147,21 +13035,41 @@ void FunctionDispatch::handle_xrResultToString(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrStopHapticFeedback(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStopHapticFeedback", function_loader.StopHapticFeedback);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrHapticActionInfo* hapticActionInfo{};
+    const XrHapticActionInfo* hapticActionInfo{};
     deserialize_ptr(&hapticActionInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StopHapticFeedback(session, hapticActionInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    if (oneway_call) {
+        // the client already returned XR_SUCCESS, failures are reported by a later call
+        if (XR_FAILED(_result)) {
+            send_deferred_error(49, _result);
+        }
+        cleanup(&session);
+        cleanup_ptr(hapticActionInfo, 1);
+        return;
+    }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(hapticActionInfo, 1);
@@ -9170,24 +13078,34 @@ void FunctionDispatch::handle_xrStopHapticFeedback(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrStringToPath(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStringToPath", function_loader.StringToPath);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    char* pathString{};
-    deserialize_ptr(&pathString, d_ctx);
+    const char* pathString{};
+    deserialize_string(&pathString, d_ctx);
     XrPath* path{};
-    deserialize_ptr(&path, d_ctx);
+    deserialize_output_ptr(&path, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StringToPath(instance, pathString, path);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(path, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(pathString, count_null_terminated(pathString));
@@ -9197,24 +13115,34 @@ void FunctionDispatch::handle_xrStringToPath(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrStructureTypeToString(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrStructureTypeToString", function_loader.StructureTypeToString);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
     XrStructureType value{};
     deserialize(&value, d_ctx);
     char buffer[XR_MAX_STRUCTURE_NAME_SIZE]{};
-    deserialize_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE, d_ctx);
+    deserialize_string_array(buffer, XR_MAX_STRUCTURE_NAME_SIZE, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.StructureTypeToString(instance, value, buffer);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
-    serialize_ptr(buffer, XR_MAX_STRUCTURE_NAME_SIZE, s_ctx);
+    serialize_string_buffer(buffer, XR_MAX_STRUCTURE_NAME_SIZE, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup(&value);
@@ -9224,21 +13152,31 @@ void FunctionDispatch::handle_xrStructureTypeToString(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrSuggestInteractionProfileBindings(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSuggestInteractionProfileBindings", function_loader.SuggestInteractionProfileBindings);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
-    XrInteractionProfileSuggestedBinding* suggestedBindings{};
+    const XrInteractionProfileSuggestedBinding* suggestedBindings{};
     deserialize_ptr(&suggestedBindings, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SuggestInteractionProfileBindings(instance, suggestedBindings);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&instance);
     cleanup_ptr(suggestedBindings, 1);
@@ -9247,21 +13185,31 @@ void FunctionDispatch::handle_xrSuggestInteractionProfileBindings(MessageLockIn
 void FunctionDispatch::handle_xrSyncActions(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrSyncActions", function_loader.SyncActions);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrActionsSyncInfo* syncInfo{};
+    const XrActionsSyncInfo* syncInfo{};
     deserialize_ptr(&syncInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.SyncActions(session, syncInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(syncInfo, 1);
@@ -9270,24 +13218,34 @@ void FunctionDispatch::handle_xrSyncActions(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrWaitFrame(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrWaitFrame", function_loader.WaitFrame);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSession session{};
     deserialize(&session, d_ctx);
-    XrFrameWaitInfo* frameWaitInfo{};
+    const XrFrameWaitInfo* frameWaitInfo{};
     deserialize_ptr(&frameWaitInfo, d_ctx);
     XrFrameState* frameState{};
-    deserialize_ptr(&frameState, d_ctx);
+    deserialize_output_xr_ptr(&frameState, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.WaitFrame(session, frameWaitInfo, frameState);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(frameState, 1, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&session);
     cleanup_ptr(frameWaitInfo, 1);
@@ -9297,21 +13255,31 @@ void FunctionDispatch::handle_xrWaitFrame(MessageLockIn msg_in) {
 void FunctionDispatch::handle_xrWaitSwapchainImage(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrWaitSwapchainImage", function_loader.WaitSwapchainImage);
     // by this point, the function id has already been read, now read the params
-    DeserializeContext d_ctx(msg_in.buffer);
+    // const inputs may point directly into the message, which lives until the end of the handler
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(params_stream(msg_in));
+    d_ctx.strings = request_strings;
+    d_ctx.handles = request_handles;
+    d_ctx.virtual_handles = virtual_handles;
     XrSwapchain swapchain{};
     deserialize(&swapchain, d_ctx);
-    XrSwapchainImageWaitInfo* waitInfo{};
+    const XrSwapchainImageWaitInfo* waitInfo{};
     deserialize_ptr(&waitInfo, d_ctx);
 
     XrTime start_time = start_runtime_timer();
     XrResult _result = function_loader.WaitSwapchainImage(swapchain, waitInfo);
     XrDuration runtime_duration = end_runtime_timer(start_time);
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.quantized_extensions = quantized_extensions;
+    s_ctx.strings = begin_strings(response_strings);
+    s_ctx.handles = begin_handles(response_handles);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_strings(s_ctx);
+    commit_handles(s_ctx);
 
     cleanup(&swapchain);
     cleanup_ptr(waitInfo, 1);
@@ -9319,6 +13287,523 @@ void FunctionDispatch::handle_xrWaitSwapchainImage(MessageLockIn msg_in) {
 
 
 
+#ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+void FunctionDispatch::handle_packed_xrGetDisplayRefreshRateFB(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrGetDisplayRefreshRateFB", function_loader.GetDisplayRefreshRateFB);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrGetDisplayRefreshRateFB request_copy;
+    auto _request = static_cast<const Request_xrGetDisplayRefreshRateFB*>(
+        msg_in.buffer.borrow(sizeof(Request_xrGetDisplayRefreshRateFB), alignof(Request_xrGetDisplayRefreshRateFB)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    float displayRefreshRate{};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.GetDisplayRefreshRateFB(_request->session, &displayRefreshRate);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrGetDisplayRefreshRateFB _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.displayRefreshRate = displayRefreshRate;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrRequestDisplayRefreshRateFB(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrRequestDisplayRefreshRateFB", function_loader.RequestDisplayRefreshRateFB);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrRequestDisplayRefreshRateFB request_copy;
+    auto _request = static_cast<const Request_xrRequestDisplayRefreshRateFB*>(
+        msg_in.buffer.borrow(sizeof(Request_xrRequestDisplayRefreshRateFB), alignof(Request_xrRequestDisplayRefreshRateFB)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.RequestDisplayRefreshRateFB(_request->session, _request->displayRefreshRate);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrRequestDisplayRefreshRateFB _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+#endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+void FunctionDispatch::handle_packed_xrAcquireSwapchainImage(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrAcquireSwapchainImage", function_loader.AcquireSwapchainImage);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrAcquireSwapchainImage request_copy;
+    auto _request = static_cast<const Request_xrAcquireSwapchainImage*>(
+        msg_in.buffer.borrow(sizeof(Request_xrAcquireSwapchainImage), alignof(Request_xrAcquireSwapchainImage)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrSwapchainImageAcquireInfo acquireInfo{XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO};
+    uint32_t index{};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.AcquireSwapchainImage(_request->swapchain, &acquireInfo, &index);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrAcquireSwapchainImage _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.index = index;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrApplyHapticFeedback(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrApplyHapticFeedback", function_loader.ApplyHapticFeedback);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrApplyHapticFeedback request_copy;
+    auto _request = static_cast<const Request_xrApplyHapticFeedback*>(
+        msg_in.buffer.borrow(sizeof(Request_xrApplyHapticFeedback), alignof(Request_xrApplyHapticFeedback)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrHapticActionInfo hapticActionInfo{XR_TYPE_HAPTIC_ACTION_INFO};
+    hapticActionInfo.action = resolve_handle(_request->hapticActionInfo_action);
+    hapticActionInfo.subactionPath = _request->hapticActionInfo_subactionPath;
+    XrHapticVibration hapticFeedback{XR_TYPE_HAPTIC_VIBRATION};
+    hapticFeedback.duration = _request->hapticFeedback_duration;
+    hapticFeedback.frequency = _request->hapticFeedback_frequency;
+    hapticFeedback.amplitude = _request->hapticFeedback_amplitude;
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.ApplyHapticFeedback(_request->session, &hapticActionInfo, reinterpret_cast<const XrHapticBaseHeader*>(&hapticFeedback));
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrApplyHapticFeedback _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrGetActionStateBoolean(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrGetActionStateBoolean", function_loader.GetActionStateBoolean);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrGetActionStateBoolean request_copy;
+    auto _request = static_cast<const Request_xrGetActionStateBoolean*>(
+        msg_in.buffer.borrow(sizeof(Request_xrGetActionStateBoolean), alignof(Request_xrGetActionStateBoolean)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrActionStateGetInfo getInfo{XR_TYPE_ACTION_STATE_GET_INFO};
+    getInfo.action = resolve_handle(_request->getInfo_action);
+    getInfo.subactionPath = _request->getInfo_subactionPath;
+    XrActionStateBoolean state{XR_TYPE_ACTION_STATE_BOOLEAN};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.GetActionStateBoolean(_request->session, &getInfo, &state);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrGetActionStateBoolean _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.state_currentState = state.currentState;
+    _response.state_changedSinceLastSync = state.changedSinceLastSync;
+    _response.state_lastChangeTime = state.lastChangeTime;
+    _response.state_isActive = state.isActive;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrGetActionStateFloat(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrGetActionStateFloat", function_loader.GetActionStateFloat);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrGetActionStateFloat request_copy;
+    auto _request = static_cast<const Request_xrGetActionStateFloat*>(
+        msg_in.buffer.borrow(sizeof(Request_xrGetActionStateFloat), alignof(Request_xrGetActionStateFloat)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrActionStateGetInfo getInfo{XR_TYPE_ACTION_STATE_GET_INFO};
+    getInfo.action = resolve_handle(_request->getInfo_action);
+    getInfo.subactionPath = _request->getInfo_subactionPath;
+    XrActionStateFloat state{XR_TYPE_ACTION_STATE_FLOAT};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.GetActionStateFloat(_request->session, &getInfo, &state);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrGetActionStateFloat _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.state_currentState = state.currentState;
+    _response.state_changedSinceLastSync = state.changedSinceLastSync;
+    _response.state_lastChangeTime = state.lastChangeTime;
+    _response.state_isActive = state.isActive;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrGetActionStatePose(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrGetActionStatePose", function_loader.GetActionStatePose);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrGetActionStatePose request_copy;
+    auto _request = static_cast<const Request_xrGetActionStatePose*>(
+        msg_in.buffer.borrow(sizeof(Request_xrGetActionStatePose), alignof(Request_xrGetActionStatePose)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrActionStateGetInfo getInfo{XR_TYPE_ACTION_STATE_GET_INFO};
+    getInfo.action = resolve_handle(_request->getInfo_action);
+    getInfo.subactionPath = _request->getInfo_subactionPath;
+    XrActionStatePose state{XR_TYPE_ACTION_STATE_POSE};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.GetActionStatePose(_request->session, &getInfo, &state);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrGetActionStatePose _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.state_isActive = state.isActive;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrGetActionStateVector2f(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrGetActionStateVector2f", function_loader.GetActionStateVector2f);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrGetActionStateVector2f request_copy;
+    auto _request = static_cast<const Request_xrGetActionStateVector2f*>(
+        msg_in.buffer.borrow(sizeof(Request_xrGetActionStateVector2f), alignof(Request_xrGetActionStateVector2f)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrActionStateGetInfo getInfo{XR_TYPE_ACTION_STATE_GET_INFO};
+    getInfo.action = resolve_handle(_request->getInfo_action);
+    getInfo.subactionPath = _request->getInfo_subactionPath;
+    XrActionStateVector2f state{XR_TYPE_ACTION_STATE_VECTOR2F};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.GetActionStateVector2f(_request->session, &getInfo, &state);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrGetActionStateVector2f _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.state_currentState = state.currentState;
+    _response.state_changedSinceLastSync = state.changedSinceLastSync;
+    _response.state_lastChangeTime = state.lastChangeTime;
+    _response.state_isActive = state.isActive;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrLocateSpace(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrLocateSpace", function_loader.LocateSpace);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrLocateSpace request_copy;
+    auto _request = static_cast<const Request_xrLocateSpace*>(
+        msg_in.buffer.borrow(sizeof(Request_xrLocateSpace), alignof(Request_xrLocateSpace)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrSpaceLocation location{XR_TYPE_SPACE_LOCATION};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.LocateSpace(resolve_handle(_request->space), resolve_handle(_request->baseSpace), _request->time, &location);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrLocateSpace _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+    _response.location_locationFlags = location.locationFlags;
+    _response.location_pose = location.pose;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrReleaseSwapchainImage(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrReleaseSwapchainImage", function_loader.ReleaseSwapchainImage);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrReleaseSwapchainImage request_copy;
+    auto _request = static_cast<const Request_xrReleaseSwapchainImage*>(
+        msg_in.buffer.borrow(sizeof(Request_xrReleaseSwapchainImage), alignof(Request_xrReleaseSwapchainImage)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrSwapchainImageReleaseInfo releaseInfo{XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO};
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.ReleaseSwapchainImage(_request->swapchain, &releaseInfo);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrReleaseSwapchainImage _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrStopHapticFeedback(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrStopHapticFeedback", function_loader.StopHapticFeedback);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrStopHapticFeedback request_copy;
+    auto _request = static_cast<const Request_xrStopHapticFeedback*>(
+        msg_in.buffer.borrow(sizeof(Request_xrStopHapticFeedback), alignof(Request_xrStopHapticFeedback)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrHapticActionInfo hapticActionInfo{XR_TYPE_HAPTIC_ACTION_INFO};
+    hapticActionInfo.action = resolve_handle(_request->hapticActionInfo_action);
+    hapticActionInfo.subactionPath = _request->hapticActionInfo_subactionPath;
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.StopHapticFeedback(_request->session, &hapticActionInfo);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrStopHapticFeedback _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_packed_xrWaitSwapchainImage(MessageLockIn msg_in) {
+    function_loader.ensure_function_loaded("xrWaitSwapchainImage", function_loader.WaitSwapchainImage);
+    // the request is used directly from the message if it is there in one piece
+    Request_xrWaitSwapchainImage request_copy;
+    auto _request = static_cast<const Request_xrWaitSwapchainImage*>(
+        msg_in.buffer.borrow(sizeof(Request_xrWaitSwapchainImage), alignof(Request_xrWaitSwapchainImage)));
+    if (!_request) {
+        asio::read(msg_in.buffer, asio::buffer(&request_copy, sizeof(request_copy)));
+        _request = &request_copy;
+    }
+
+    XrSwapchainImageWaitInfo waitInfo{XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO};
+    waitInfo.timeout = _request->waitInfo_timeout;
+
+    XrTime start_time = start_runtime_timer();
+    XrResult _result = function_loader.WaitSwapchainImage(_request->swapchain, &waitInfo);
+    XrDuration runtime_duration = end_runtime_timer(start_time);
+
+    Response_xrWaitSwapchainImage _response{};
+    _response.result = _result;
+    _response.runtime_duration = runtime_duration;
+
+    auto msg_out = start_response();
+    asio::write(msg_out.buffer, asio::buffer(&_response, sizeof(_response)));
+    msg_out.flush();
+}
+
+
+void FunctionDispatch::handle_pipelined_function(std::uint32_t function_id, MessageLockIn msg_in) {
+    if (pipelined_handlers.find(function_id) == pipelined_handlers.end()) {
+        throw UnknownFunctionIdException("Unknown function id in handle_pipelined_function: " + std::to_string(function_id));
+    }
+    if (!virtual_handles) {
+        throw std::runtime_error("Pipelined call without XRTP_FEATURE_PIPELINED_CREATION");
+    }
+    Handler handler = pipelined_handlers.at(function_id);
+    if (delta_decoder) {
+        decoded_params.reset(delta_decoder->decode(function_id, msg_in.buffer));
+    }
+    std::size_t bound = virtual_handles->size();
+    pipelined_call = true;
+    try {
+        (this->*handler)(std::move(msg_in));
+    }
+    catch (...) {
+        pipelined_call = false;
+        // keep the virtual handles in step with the client
+        if (virtual_handles->size() == bound) {
+            finish_pipelined_call(function_id, XR_ERROR_RUNTIME_FAILURE, 0);
+        }
+        throw;
+    }
+    pipelined_call = false;
+}
+
+void FunctionDispatch::finish_pipelined_call(std::uint32_t function_id, XrResult result, std::uint64_t handle) {
+    if (XR_SUCCEEDED(result) && is_virtual_handle(handle)) {
+        spdlog::error("Runtime returned handle {:#x}, which can't be told apart from a virtual handle", handle);
+    }
+    virtual_handles->bind(XR_SUCCEEDED(result) ? handle : 0);
+    if (XR_FAILED(result)) {
+        send_deferred_error(function_id, result);
+    }
+}
+
+void FunctionDispatch::handle_oneway_function(std::uint32_t function_id, MessageLockIn msg_in) {
+    if (oneway_handlers.find(function_id) == oneway_handlers.end()) {
+        throw UnknownFunctionIdException("Unknown function id in handle_oneway_function: " + std::to_string(function_id));
+    }
+    Handler handler = oneway_handlers.at(function_id);
+    if (delta_decoder) {
+        decoded_params.reset(delta_decoder->decode(function_id, msg_in.buffer));
+    }
+    oneway_call = true;
+    try {
+        (this->*handler)(std::move(msg_in));
+    }
+    catch (...) {
+        oneway_call = false;
+        throw;
+    }
+    oneway_call = false;
+}
+
+void FunctionDispatch::send_deferred_error(std::uint32_t function_id, XrResult result) {
+    auto msg_out = transport.start_message(XRTP_MSG_DEFERRED_ERROR);
+    asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(&result, sizeof(XrResult)));
+    msg_out.flush();
+}
+
+void FunctionDispatch::handle_function_batch(MessageLockIn msg_in) {
+    uint32_t call_count{};
+    asio::read(msg_in.buffer, asio::buffer(&call_count, sizeof(uint32_t)));
+
+    // batched calls are sent without interning and compact encoding, but may use virtual handles
+    StringTable* saved_request_strings = request_strings;
+    StringInterner* saved_response_strings = response_strings;
+    HandleTable* saved_request_handles = request_handles;
+    HandleInterner* saved_response_handles = response_handles;
+    auto restore = [&]() {
+        batch_call = false;
+        request_strings = saved_request_strings;
+        response_strings = saved_response_strings;
+        request_handles = saved_request_handles;
+        response_handles = saved_response_handles;
+    };
+    batch_call = true;
+    request_strings = nullptr;
+    response_strings = nullptr;
+    request_handles = nullptr;
+    response_handles = nullptr;
+
+    ResponseBuffer results;
+    std::vector<std::uint8_t> params;
+    try {
+        for (uint32_t i = 0; i < call_count; i++) {
+            uint32_t function_id{};
+            asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+            uint32_t params_size{};
+            asio::read(msg_in.buffer, asio::buffer(&params_size, sizeof(uint32_t)));
+            params.resize(params_size);
+            asio::read(msg_in.buffer, asio::buffer(params.data(), params.size()));
+
+            if (handlers.find(function_id) == handlers.end()) {
+                throw UnknownFunctionIdException("Unknown function id in handle_function_batch: " + std::to_string(function_id));
+            }
+            Handler handler = handlers.at(function_id);
+            if (handler == &FunctionDispatch::handle_xrCreateInstance || handler == &FunctionDispatch::handle_xrDestroyInstance) {
+                throw std::runtime_error("xrCreateInstance and xrDestroyInstance can't be batched");
+            }
+
+            // the handler reads its params from decoded_params, and gets no message of its own
+            decoded_params.reset(params);
+            batch_response.bytes.clear();
+            (this->*handler)(MessageLockIn(nullptr));
+
+            uint32_t result_size = static_cast<uint32_t>(batch_response.bytes.size());
+            asio::write(results, asio::buffer(&result_size, sizeof(uint32_t)));
+            asio::write(results, asio::buffer(batch_response.bytes.data(), batch_response.bytes.size()));
+        }
+    }
+    catch (...) {
+        restore();
+        throw;
+    }
+    restore();
+
+    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN_BATCH);
+    asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(uint32_t)));
+    asio::write(msg_out.buffer, asio::buffer(results.bytes.data(), results.bytes.size()));
+    msg_out.flush();
+}
+
+void FunctionDispatch::sample_calls(const std::vector<SampledCall>& calls, XrTime display_time, SyncWriteStream& results) {
+    // sampled calls are sent like batched ones
+    StringTable* saved_request_strings = request_strings;
+    StringInterner* saved_response_strings = response_strings;
+    HandleTable* saved_request_handles = request_handles;
+    HandleInterner* saved_response_handles = response_handles;
+    batch_call = true;
+    sample_time = display_time;
+    request_strings = nullptr;
+    response_strings = nullptr;
+    request_handles = nullptr;
+    response_handles = nullptr;
+
+    for (const SampledCall& call : calls) {
+        batch_response.bytes.clear();
+        auto it = sampled_handlers.find(call.function_id);
+        if (it != sampled_handlers.end()) {
+            try {
+                decoded_params.reset(call.params);
+                (this->*(it->second))(MessageLockIn(nullptr));
+            }
+            catch (const std::exception& e) {
+                spdlog::debug("Sampling function {} failed: {}", call.function_id, e.what());
+                batch_response.bytes.clear();
+            }
+        }
+        uint32_t result_size = static_cast<uint32_t>(batch_response.bytes.size());
+        asio::write(results, asio::buffer(&result_size, sizeof(uint32_t)));
+        asio::write(results, asio::buffer(batch_response.bytes.data(), batch_response.bytes.size()));
+    }
+
+    batch_call = false;
+    sample_time = 0;
+    request_strings = saved_request_strings;
+    response_strings = saved_response_strings;
+    request_handles = saved_request_handles;
+    response_handles = saved_response_handles;
+}
+
 std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::handlers = {
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
     {197001, &FunctionDispatch::handle_xrSetDigitalLensControlALMALENCE},
@@ -9862,4 +14347,159 @@ std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::handle
 
 };
 
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::packed_handlers = {
+#ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+    {102002, &FunctionDispatch::handle_packed_xrGetDisplayRefreshRateFB},
+    {102003, &FunctionDispatch::handle_packed_xrRequestDisplayRefreshRateFB},
+#endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+    {1, &FunctionDispatch::handle_packed_xrAcquireSwapchainImage},
+    {2, &FunctionDispatch::handle_packed_xrApplyHapticFeedback},
+    {30, &FunctionDispatch::handle_packed_xrGetActionStateBoolean},
+    {31, &FunctionDispatch::handle_packed_xrGetActionStateFloat},
+    {32, &FunctionDispatch::handle_packed_xrGetActionStatePose},
+    {33, &FunctionDispatch::handle_packed_xrGetActionStateVector2f},
+    {41, &FunctionDispatch::handle_packed_xrLocateSpace},
+    {46, &FunctionDispatch::handle_packed_xrReleaseSwapchainImage},
+    {49, &FunctionDispatch::handle_packed_xrStopHapticFeedback},
+    {55, &FunctionDispatch::handle_packed_xrWaitSwapchainImage},
+
+};
+
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::pipelined_handlers = {
+    {6, &FunctionDispatch::handle_xrCreateAction},
+    {7, &FunctionDispatch::handle_xrCreateActionSet},
+    {8, &FunctionDispatch::handle_xrCreateActionSpace},
+    {10, &FunctionDispatch::handle_xrCreateReferenceSpace},
+
+};
+
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::oneway_handlers = {
+#ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
+    {386002, &FunctionDispatch::handle_xrDestroyBodyTrackerBD},
+#endif // XRTRANSPORT_EXT_XR_BD_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_BD_spatial_sensing
+    {390004, &FunctionDispatch::handle_xrDestroyAnchorBD},
+    {390005, &FunctionDispatch::handle_xrDestroySenseDataProviderBD},
+    {390006, &FunctionDispatch::handle_xrDestroySenseDataSnapshotBD},
+#endif // XRTRANSPORT_EXT_XR_BD_spatial_sensing
+#ifdef XRTRANSPORT_EXT_XR_EXT_debug_utils
+    {20002, &FunctionDispatch::handle_xrDestroyDebugUtilsMessengerEXT},
+    {20003, &FunctionDispatch::handle_xrSessionBeginDebugUtilsLabelRegionEXT},
+    {20004, &FunctionDispatch::handle_xrSessionEndDebugUtilsLabelRegionEXT},
+    {20005, &FunctionDispatch::handle_xrSessionInsertDebugUtilsLabelEXT},
+    {20006, &FunctionDispatch::handle_xrSetDebugUtilsObjectNameEXT},
+#endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+    {52002, &FunctionDispatch::handle_xrDestroyHandTrackerEXT},
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+#ifdef XRTRANSPORT_EXT_XR_EXT_performance_settings
+    {16001, &FunctionDispatch::handle_xrPerfSettingsSetPerformanceLevelEXT},
+#endif // XRTRANSPORT_EXT_XR_EXT_performance_settings
+#ifdef XRTRANSPORT_EXT_XR_EXT_plane_detection
+    {430003, &FunctionDispatch::handle_xrDestroyPlaneDetectorEXT},
+#endif // XRTRANSPORT_EXT_XR_EXT_plane_detection
+#ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
+    {77002, &FunctionDispatch::handle_xrDestroyBodyTrackerFB},
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+    {203002, &FunctionDispatch::handle_xrDestroyEyeTrackerFB},
+#endif // XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking
+    {202002, &FunctionDispatch::handle_xrDestroyFaceTrackerFB},
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking2
+    {288002, &FunctionDispatch::handle_xrDestroyFaceTracker2FB},
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking2
+#ifdef XRTRANSPORT_EXT_XR_FB_foveation
+    {115002, &FunctionDispatch::handle_xrDestroyFoveationProfileFB},
+#endif // XRTRANSPORT_EXT_XR_FB_foveation
+#ifdef XRTRANSPORT_EXT_XR_FB_passthrough
+    {119004, &FunctionDispatch::handle_xrDestroyGeometryInstanceFB},
+    {119005, &FunctionDispatch::handle_xrDestroyPassthroughFB},
+    {119006, &FunctionDispatch::handle_xrDestroyPassthroughLayerFB},
+#endif // XRTRANSPORT_EXT_XR_FB_passthrough
+#ifdef XRTRANSPORT_EXT_XR_FB_spatial_entity_user
+    {242002, &FunctionDispatch::handle_xrDestroySpaceUserFB},
+#endif // XRTRANSPORT_EXT_XR_FB_spatial_entity_user
+#ifdef XRTRANSPORT_EXT_XR_FB_triangle_mesh
+    {118002, &FunctionDispatch::handle_xrDestroyTriangleMeshFB},
+#endif // XRTRANSPORT_EXT_XR_FB_triangle_mesh
+#ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
+    {321002, &FunctionDispatch::handle_xrDestroyBodyTrackerHTC},
+#endif // XRTRANSPORT_EXT_XR_HTC_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_facial_tracking
+    {105002, &FunctionDispatch::handle_xrDestroyFacialTrackerHTC},
+#endif // XRTRANSPORT_EXT_XR_HTC_facial_tracking
+#ifdef XRTRANSPORT_EXT_XR_HTC_passthrough
+    {318002, &FunctionDispatch::handle_xrDestroyPassthroughHTC},
+#endif // XRTRANSPORT_EXT_XR_HTC_passthrough
+#ifdef XRTRANSPORT_EXT_XR_META_environment_depth
+    {292004, &FunctionDispatch::handle_xrDestroyEnvironmentDepthProviderMETA},
+    {292005, &FunctionDispatch::handle_xrDestroyEnvironmentDepthSwapchainMETA},
+#endif // XRTRANSPORT_EXT_XR_META_environment_depth
+#ifdef XRTRANSPORT_EXT_XR_META_passthrough_color_lut
+    {267002, &FunctionDispatch::handle_xrDestroyPassthroughColorLutMETA},
+#endif // XRTRANSPORT_EXT_XR_META_passthrough_color_lut
+#ifdef XRTRANSPORT_EXT_XR_META_virtual_keyboard
+    {220004, &FunctionDispatch::handle_xrDestroyVirtualKeyboardMETA},
+#endif // XRTRANSPORT_EXT_XR_META_virtual_keyboard
+#ifdef XRTRANSPORT_EXT_XR_ML_facial_expression
+    {483002, &FunctionDispatch::handle_xrDestroyFacialExpressionClientML},
+#endif // XRTRANSPORT_EXT_XR_ML_facial_expression
+#ifdef XRTRANSPORT_EXT_XR_ML_localization_map
+    {140002, &FunctionDispatch::handle_xrDestroyExportedLocalizationMapML},
+#endif // XRTRANSPORT_EXT_XR_ML_localization_map
+#ifdef XRTRANSPORT_EXT_XR_ML_marker_understanding
+    {139003, &FunctionDispatch::handle_xrDestroyMarkerDetectorML},
+#endif // XRTRANSPORT_EXT_XR_ML_marker_understanding
+#ifdef XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
+    {142004, &FunctionDispatch::handle_xrDestroySpatialAnchorsStorageML},
+#endif // XRTRANSPORT_EXT_XR_ML_spatial_anchors_storage
+#ifdef XRTRANSPORT_EXT_XR_ML_world_mesh_detection
+    {475003, &FunctionDispatch::handle_xrDestroyWorldMeshDetectorML},
+#endif // XRTRANSPORT_EXT_XR_ML_world_mesh_detection
+#ifdef XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+    {98004, &FunctionDispatch::handle_xrDestroySceneMSFT},
+    {98005, &FunctionDispatch::handle_xrDestroySceneObserverMSFT},
+#endif // XRTRANSPORT_EXT_XR_MSFT_scene_understanding
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_anchor
+    {40003, &FunctionDispatch::handle_xrDestroySpatialAnchorMSFT},
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
+    {143004, &FunctionDispatch::handle_xrDestroySpatialAnchorStoreConnectionMSFT},
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_anchor_persistence
+#ifdef XRTRANSPORT_EXT_XR_MSFT_spatial_graph_bridge
+    {50002, &FunctionDispatch::handle_xrDestroySpatialGraphNodeBindingMSFT},
+#endif // XRTRANSPORT_EXT_XR_MSFT_spatial_graph_bridge
+    {2, &FunctionDispatch::handle_xrApplyHapticFeedback},
+    {4, &FunctionDispatch::handle_xrBeginFrame},
+    {13, &FunctionDispatch::handle_xrDestroyAction},
+    {14, &FunctionDispatch::handle_xrDestroyActionSet},
+    {16, &FunctionDispatch::handle_xrDestroySession},
+    {17, &FunctionDispatch::handle_xrDestroySpace},
+    {18, &FunctionDispatch::handle_xrDestroySwapchain},
+    {49, &FunctionDispatch::handle_xrStopHapticFeedback},
+};
+
+std::unordered_map<uint32_t, FunctionDispatch::Handler> FunctionDispatch::sampled_handlers = {
+#ifdef XRTRANSPORT_EXT_XR_BD_body_tracking
+    {386003, &FunctionDispatch::handle_xrLocateBodyJointsBD},
+#endif // XRTRANSPORT_EXT_XR_BD_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+    {52003, &FunctionDispatch::handle_xrLocateHandJointsEXT},
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_body_tracking
+    {77004, &FunctionDispatch::handle_xrLocateBodyJointsFB},
+#endif // XRTRANSPORT_EXT_XR_FB_body_tracking
+#ifdef XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+    {203003, &FunctionDispatch::handle_xrGetEyeGazesFB},
+#endif // XRTRANSPORT_EXT_XR_FB_eye_tracking_social
+#ifdef XRTRANSPORT_EXT_XR_FB_face_tracking2
+    {288003, &FunctionDispatch::handle_xrGetFaceExpressionWeights2FB},
+#endif // XRTRANSPORT_EXT_XR_FB_face_tracking2
+#ifdef XRTRANSPORT_EXT_XR_HTC_body_tracking
+    {321004, &FunctionDispatch::handle_xrLocateBodyJointsHTC},
+#endif // XRTRANSPORT_EXT_XR_HTC_body_tracking
+};
+
 } // namespace xrtransport
\ No newline at end of file
@@ -15,6 +15,11 @@
 #include "xrtransport/transport/transport.h"
 
 #include "xrtransport/server/function_loader.h"
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/virtual_handles.h"
+#include "xrtransport/time.h"
 
 #include "openxr/openxr.h"
 
@@ -23,6 +28,7 @@
 #include <unordered_map>
 #include <vector>
 #include <functional>
+#include <optional>
 #include <string>
 
 namespace xrtransport {
@@ -32,6 +38,74 @@ public:
     explicit UnknownFunctionIdException(const std::string& message) : std::runtime_error(message) {}
 };
 
+/**
+ * Collects the response of a call in a batch, see FunctionDispatch::handle_function_batch.
+ */
+class ResponseBuffer : public SyncWriteStream {
+public:
+    std::vector<std::uint8_t> bytes;
+
+    std::size_t write_some(const asio::const_buffer& buffer, asio::error_code& ec) override {
+        ec.clear();
+        const std::uint8_t* data = static_cast<const std::uint8_t*>(buffer.data());
+        bytes.insert(bytes.end(), data, data + buffer.size());
+        return buffer.size();
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer) override {
+        asio::error_code ec;
+        return write_some(buffer, ec);
+    }
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+};
+
+/**
+ * Where a handler writes its response: a new XRTP_MSG_FUNCTION_RETURN, or the ResponseBuffer of a batch.
+ */
+class [[nodiscard]] Response {
+private:
+    std::optional<MessageLockOut> msg_out;
+    // set if XRTP_FEATURE_INBAND_TIMESTAMPS was negotiated, see src/client/synchronization.h
+    const std::function<XrTime(XrTime)>* clock = nullptr;
+    XrTime request_time = 0;
+
+public:
+    SyncWriteStream& buffer;
+
+    explicit Response(MessageLockOut msg_out, const std::function<XrTime(XrTime)>* clock = nullptr, XrTime request_time = 0)
+        : msg_out(std::move(msg_out)), clock(clock), request_time(request_time), buffer(this->msg_out->buffer)
+    {}
+
+    explicit Response(ResponseBuffer& batch_response)
+        : buffer(batch_response)
+    {}
+
+    // buffer refers into msg_out
+    Response(const Response&) = delete;
+    Response& operator=(const Response&) = delete;
+
+    void flush() {
+        if (msg_out) {
+            if (clock) {
+                XrTime response_time = (*clock)(get_time());
+                asio::write(msg_out->buffer, asio::buffer(&request_time, sizeof(XrTime)));
+                asio::write(msg_out->buffer, asio::buffer(&response_time, sizeof(XrTime)));
+            }
+            msg_out->flush();
+        }
+    }
+};
+
+/**
+ * A call that the client makes at the display time of every frame, see FunctionDispatch::sample_calls.
+ */
+struct SampledCall {
+    std::uint32_t function_id;
+    std::vector<std::uint8_t> params;
+};
+
 class FunctionDispatch {
 public:
     using Handler = void (FunctionDispatch::*)(MessageLockIn);
@@ -43,18 +117,83 @@ private:
     std::function<void(MessageLockIn)> create_instance_handler;
     std::function<void(MessageLockIn)> destroy_instance_handler;
     static std::unordered_map<std::uint32_t, Handler> handlers;
+    // handlers for XRTP_MSG_PACKED_FUNCTION_CALL, see packed_calls.h
+    static std::unordered_map<std::uint32_t, Handler> packed_handlers;
+    // handlers for XRTP_MSG_PIPELINED_FUNCTION_CALL, see virtual_handles.h
+    static std::unordered_map<std::uint32_t, Handler> pipelined_handlers;
+    // handlers for XRTP_MSG_ONEWAY_FUNCTION_CALL, see code_generation/oneway_calls.py
+    static std::unordered_map<std::uint32_t, Handler> oneway_handlers;
+    // handlers of the calls in XRTP_MSG_SPECULATIVE_WAIT_FRAME, see code_generation/sampled_calls.py
+    static std::unordered_map<std::uint32_t, Handler> sampled_handlers;
+
+    // Set if request delta encoding was negotiated. The params of the current request are rebuilt
+    // by handle_function and read through decoded_params.
+    DeltaDecoder* delta_decoder;
+    DeltaReadStream decoded_params;
+
+    // QUANTIZED_* bits of the extensions whose arrays are sent quantized in responses
+    std::uint64_t quantized_extensions;
+
+    // Set if string interning was negotiated
+    StringTable* request_strings;
+    StringInterner* response_strings;
+
+    // Set if compact encoding was negotiated
+    HandleTable* request_handles;
+    HandleInterner* response_handles;
+
+    // Set if pipelined creation was negotiated
+    VirtualHandleMap* virtual_handles;
+    // set while handle_pipelined_function runs a handler, which then doesn't respond
+    bool pipelined_call = false;
+
+    // set while handle_oneway_function runs a handler, which then only reports failures
+    bool oneway_call = false;
+
+    // Set while handle_function_batch runs the calls of a batch. Their params are read through
+    // decoded_params, and their responses are collected in batch_response.
+    bool batch_call = false;
+    ResponseBuffer batch_response;
+
+    // set while sample_calls runs the calls of a frame, the times in their params are relative to it
+    XrTime sample_time = 0;
+
+    // Set if in-band timestamps were negotiated, converts a get_time() reading to the server time, or to 0
+    // if it can't be told yet
+    std::function<XrTime(XrTime)> clock;
+    // server time when the request currently being handled was received
+    XrTime request_time = 0;
+
+    void finish_pipelined_call(std::uint32_t function_id, XrResult result, std::uint64_t handle);
+    void send_deferred_error(std::uint32_t function_id, XrResult result);
 
 public:
     explicit FunctionDispatch(
         Transport& transport,
         FunctionLoader& function_loader,
         std::function<void(MessageLockIn)> create_instance_handler,
-        std::function<void(MessageLockIn)> destroy_instance_handler
+        std::function<void(MessageLockIn)> destroy_instance_handler,
+        DeltaDecoder* delta_decoder = nullptr,
+        std::uint64_t quantized_extensions = 0,
+        StringTable* request_strings = nullptr,
+        StringInterner* response_strings = nullptr,
+        HandleTable* request_handles = nullptr,
+        HandleInterner* response_handles = nullptr,
+        VirtualHandleMap* virtual_handles = nullptr,
+        std::function<XrTime(XrTime)> clock = nullptr
     )
         : transport(transport),
         function_loader(function_loader),
         create_instance_handler(std::move(create_instance_handler)),
-        destroy_instance_handler(std::move(destroy_instance_handler))
+        destroy_instance_handler(std::move(destroy_instance_handler)),
+        delta_decoder(delta_decoder),
+        quantized_extensions(quantized_extensions),
+        request_strings(request_strings),
+        response_strings(response_strings),
+        request_handles(request_handles),
+        response_handles(response_handles),
+        virtual_handles(virtual_handles),
+        clock(std::move(clock))
     {}
 
 #ifdef XRTRANSPORT_EXT_XR_ALMALENCE_digital_lens_control
@@ -598,13 +737,101 @@ public:
     void handle_xrWaitSwapchainImage(MessageLockIn msg_in);
 
 
+#ifdef XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+    void handle_packed_xrGetDisplayRefreshRateFB(MessageLockIn msg_in);
+    void handle_packed_xrRequestDisplayRefreshRateFB(MessageLockIn msg_in);
+#endif // XRTRANSPORT_EXT_XR_FB_display_refresh_rate
+    void handle_packed_xrAcquireSwapchainImage(MessageLockIn msg_in);
+    void handle_packed_xrApplyHapticFeedback(MessageLockIn msg_in);
+    void handle_packed_xrGetActionStateBoolean(MessageLockIn msg_in);
+    void handle_packed_xrGetActionStateFloat(MessageLockIn msg_in);
+    void handle_packed_xrGetActionStatePose(MessageLockIn msg_in);
+    void handle_packed_xrGetActionStateVector2f(MessageLockIn msg_in);
+    void handle_packed_xrLocateSpace(MessageLockIn msg_in);
+    void handle_packed_xrReleaseSwapchainImage(MessageLockIn msg_in);
+    void handle_packed_xrStopHapticFeedback(MessageLockIn msg_in);
+    void handle_packed_xrWaitSwapchainImage(MessageLockIn msg_in);
+
+
     void handle_function(std::uint32_t function_id, MessageLockIn msg_in) {
         if (handlers.find(function_id) == handlers.end()) {
             throw UnknownFunctionIdException("Unknown function id in handle_function: " + std::to_string(function_id));
         }
         Handler handler = handlers.at(function_id);
+        if (clock) {
+            // stamped by the transport, so time spent behind earlier messages isn't counted as network delay
+            request_time = clock(msg_in.get_receive_time());
+        }
+        if (delta_decoder) {
+            decoded_params.reset(delta_decoder->decode(function_id, msg_in.buffer));
+        }
         (this->*handler)(std::move(msg_in));
     }
+
+    void handle_packed_function(std::uint32_t function_id, MessageLockIn msg_in) {
+        if (packed_handlers.find(function_id) == packed_handlers.end()) {
+            throw UnknownFunctionIdException("Unknown function id in handle_packed_function: " + std::to_string(function_id));
+        }
+        Handler handler = packed_handlers.at(function_id);
+        if (clock) {
+            request_time = clock(msg_in.get_receive_time());
+        }
+        (this->*handler)(std::move(msg_in));
+    }
+
+    /**
+     * Runs a pipelined call, binding the handle it created to the next virtual handle instead of responding.
+     */
+    void handle_pipelined_function(std::uint32_t function_id, MessageLockIn msg_in);
+
+    /**
+     * Runs a oneway call, which the client doesn't wait for. Instead of responding, a failure is reported
+     * with an XRTP_MSG_DEFERRED_ERROR.
+     */
+    void handle_oneway_function(std::uint32_t function_id, MessageLockIn msg_in);
+
+    /**
+     * Runs the calls of an XRTP_MSG_FUNCTION_CALL_BATCH in order, and responds with their results in one
+     * XRTP_MSG_FUNCTION_RETURN_BATCH. Batched calls are sent without the per-connection encodings, which
+     * the modules and API layers that send them can't use.
+     */
+    void handle_function_batch(MessageLockIn msg_in);
+
+    /**
+     * Runs the sampled calls of a speculative wait at the display time of its frame, the same way as
+     * the calls of a batch, and writes their responses to results, each after its size. The size is 0
+     * if a call couldn't be run, the client then makes it itself. Used by the thread of FrameWaiter,
+     * which must hold the message lock.
+     */
+    void sample_calls(const std::vector<SampledCall>& calls, XrTime display_time, SyncWriteStream& results);
+
+    /**
+     * Real handle of a handle that was sent without compact encoding, e.g. in a packed call.
+     */
+    template <typename T>
+    T resolve_handle(T handle) const {
+        return virtual_handles ? virtual_handles->resolve(handle) : handle;
+    }
+
+    /**
+     * Stream that the params of the request currently being handled are read from.
+     */
+    SyncReadStream& params_stream(MessageLockIn& msg_in) {
+        if (delta_decoder || batch_call) {
+            return decoded_params;
+        }
+        return msg_in.buffer;
+    }
+
+    /**
+     * Stream that the response to the request currently being handled is written to.
+     */
+    Response start_response() {
+        if (batch_call) {
+            return Response(batch_response);
+        }
+        return Response(transport.start_message(XRTP_MSG_FUNCTION_RETURN), clock ? &clock : nullptr, request_time);
+    }
 };
 
 } // namespace xrtransport
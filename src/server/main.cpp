@@ -201,7 +201,8 @@ int main(int argc, char** argv) {
 
             spdlog::info("Client connected");
 
-            if (!Server::do_handshake(*stream)) {
+            ConnectionOptions options;
+            if (!Server::do_handshake(*stream, options)) {
                 // handshake failed, socket was closed, try again
                 spdlog::warn("Client handshake failed");
                 continue;
@@ -210,7 +211,8 @@ int main(int argc, char** argv) {
             Server server(
                 std::move(stream),
                 io_context,
-                collect_module_paths()
+                collect_module_paths(),
+                options
             );
 
             // Run server event loop synchronously until it stops
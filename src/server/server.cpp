@@ -21,24 +21,44 @@ using std::uint64_t;
 
 namespace xrtransport {
 
-Server::Server(std::unique_ptr<SyncDuplexStream> stream, asio::io_context& stream_io_context, std::vector<std::string> module_paths) :
+Server::Server(std::unique_ptr<SyncDuplexStream> stream, asio::io_context& stream_io_context, std::vector<std::string> module_paths, ConnectionOptions options) :
     transport(std::move(stream)),
+    options(options),
     function_loader(xrGetInstanceProcAddr),
     function_dispatch(
         transport,
         function_loader,
         [this](MessageLockIn msg_in){create_instance_handler(std::move(msg_in));},
-        [this](MessageLockIn msg_in){destroy_instance_handler(std::move(msg_in));}
+        [this](MessageLockIn msg_in){destroy_instance_handler(std::move(msg_in));},
+        has_feature(XRTP_FEATURE_DELTA_ENCODING) ? &delta_decoder : nullptr,
+        options.quantized_extensions,
+        has_feature(XRTP_FEATURE_STRING_INTERNING) ? &request_strings : nullptr,
+        has_feature(XRTP_FEATURE_STRING_INTERNING) ? &response_strings : nullptr,
+        has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &request_handles : nullptr,
+        has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &response_handles : nullptr,
+        has_feature(XRTP_FEATURE_PIPELINED_CREATION) ? &virtual_handles : nullptr,
+        has_feature(XRTP_FEATURE_INBAND_TIMESTAMPS) ? std::function<XrTime(XrTime)>([this](XrTime time){ return to_server_time(time); }) : nullptr
+    ),
+    frame_waiter(
+        transport,
+        function_loader,
+        has_feature(XRTP_FEATURE_VIEW_PREFETCH),
+        has_feature(XRTP_FEATURE_SPACE_PREFETCH),
+        has_feature(XRTP_FEATURE_PIPELINED_CREATION) ? &virtual_handles : nullptr,
+        has_feature(XRTP_FEATURE_TRACKER_SAMPLING) ? &function_dispatch : nullptr
     ),
     transport_io_context(stream_io_context)
 {
+    if (has_feature(XRTP_FEATURE_PIPELINED_CREATION)) {
+        request_handles.set_virtual_handles(&virtual_handles);
+    }
     for (auto& module_path : module_paths) {
         modules.push_back(Module(module_path));
     }
 }
 
 // static
-bool Server::do_handshake(SyncDuplexStream& stream) {
+bool Server::do_handshake(SyncDuplexStream& stream, ConnectionOptions& options) {
     uint32_t client_magic{};
     asio::read(stream, asio::buffer(&client_magic, sizeof(uint32_t)));
     uint32_t server_magic = XRTRANSPORT_MAGIC;
@@ -78,6 +98,40 @@ bool Server::do_handshake(SyncDuplexStream& stream) {
         return false;
     }
 
+    // accept whichever requested features this server supports
+    xrtp_Features requested_features{};
+    asio::read(stream, asio::buffer(&requested_features, sizeof(xrtp_Features)));
+    options.features = requested_features & XRTP_SUPPORTED_FEATURES;
+    // virtual handles are resolved through the handle table of compact encoding
+    if (!options.has_feature(XRTP_FEATURE_COMPACT_ENCODING)) {
+        options.features &= ~XRTP_FEATURE_PIPELINED_CREATION;
+    }
+    // views, spaces and trackers are located along with speculative waits
+    if (!options.has_feature(XRTP_FEATURE_FRAME_LOOP_FUSION)) {
+        options.features &= ~(XRTP_FEATURE_VIEW_PREFETCH | XRTP_FEATURE_SPACE_PREFETCH | XRTP_FEATURE_TRACKER_SAMPLING);
+    }
+    asio::write(stream, asio::buffer(&options.features, sizeof(xrtp_Features)));
+
+    if (options.has_feature(XRTP_FEATURE_QUANTIZATION)) {
+        asio::read(stream, asio::buffer(&options.quantized_extensions, sizeof(uint64_t)));
+    }
+
+    if (options.has_feature(XRTP_FEATURE_SHARED_CLOCK)) {
+        char client_boot_id[BOOT_ID_SIZE]{};
+        asio::read(stream, asio::buffer(client_boot_id, BOOT_ID_SIZE));
+        char boot_id[BOOT_ID_SIZE]{};
+        bool same_kernel = get_boot_id(boot_id) && std::memcmp(boot_id, client_boot_id, BOOT_ID_SIZE) == 0;
+        // the client checks that this falls within its round trip, 0 if the kernels differ
+        XrTime server_time = same_kernel ? get_time() : 0;
+        asio::write(stream, asio::buffer(&server_time, sizeof(XrTime)));
+
+        uint32_t shared_clock{};
+        asio::read(stream, asio::buffer(&shared_clock, sizeof(uint32_t)));
+        if (!shared_clock) {
+            options.features &= ~XRTP_FEATURE_SHARED_CLOCK;
+        }
+    }
+
     return true;
 }
 
@@ -88,31 +142,49 @@ void Server::run() {
         function_dispatch.handle_function(function_id, std::move(msg_in));
     });
 
+    transport.register_handler(XRTP_MSG_PACKED_FUNCTION_CALL, [this](MessageLockIn msg_in){
+        uint32_t function_id{};
+        asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+        function_dispatch.handle_packed_function(function_id, std::move(msg_in));
+    });
+
+    transport.register_handler(XRTP_MSG_PIPELINED_FUNCTION_CALL, [this](MessageLockIn msg_in){
+        uint32_t function_id{};
+        asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+        function_dispatch.handle_pipelined_function(function_id, std::move(msg_in));
+    });
+
+    transport.register_handler(XRTP_MSG_ONEWAY_FUNCTION_CALL, [this](MessageLockIn msg_in){
+        uint32_t function_id{};
+        asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(uint32_t)));
+        function_dispatch.handle_oneway_function(function_id, std::move(msg_in));
+    });
+
+    transport.register_handler(XRTP_MSG_FUNCTION_CALL_BATCH, [this](MessageLockIn msg_in){
+        function_dispatch.handle_function_batch(std::move(msg_in));
+    });
+
+    if (has_feature(XRTP_FEATURE_FRAME_LOOP_FUSION)) {
+        transport.register_handler(XRTP_MSG_SPECULATIVE_WAIT_FRAME, [this](MessageLockIn msg_in){
+            frame_waiter.handle_message(std::move(msg_in));
+        });
+    }
+
     transport.register_handler(XRTP_MSG_SYNCHRONIZATION_REQUEST, [this](MessageLockIn msg_in) {
-        // load timer functions
-#ifdef _WIN32
-        function_loader.ensure_function_loaded(
-            "xrConvertWin32PerformanceCounterToTimeKHR",
-            from_platform_time);
-        function_loader.ensure_function_loaded(
-            "xrConvertTimeToWin32PerformanceCounterKHR",
-            to_platform_time);
-#else
-        function_loader.ensure_function_loaded(
-            "xrConvertTimespecTimeToTimeKHR",
-            from_platform_time);
-        function_loader.ensure_function_loaded(
-            "xrConvertTimeToTimespecTimeKHR",
-            to_platform_time);
-#endif
+        load_time_functions();
 
         // read incoming time
         XrTime client_time{};
         asio::read(msg_in.buffer, asio::buffer(&client_time, sizeof(XrTime)));
 
-        // get server time
+        // get server time, or the client's time converted exactly if it was read from the same clock
         XRTRANSPORT_PLATFORM_TIME server_platform_time{};
-        get_platform_time(&server_platform_time);
+        if (has_feature(XRTP_FEATURE_SHARED_CLOCK)) {
+            convert_to_platform_time(client_time, &server_platform_time);
+        }
+        else {
+            get_platform_time(&server_platform_time);
+        }
         XrTime server_time{};
         from_platform_time(saved_instance, &server_platform_time, &server_time);
 
@@ -186,6 +258,7 @@ void Server::run() {
     // let transport run until it closes
     transport.start();
     transport.join();
+    frame_waiter.stop();
 
     // Once handler loop terminates, destroy the instance if the client didn't
     if (saved_instance) {
@@ -199,11 +272,13 @@ void Server::create_instance_handler(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrCreateInstance", function_loader.CreateInstance);
     
     // Read in args sent by client
-    DeserializeContext d_ctx(msg_in.buffer);
+    DeserializeContext d_ctx(function_dispatch.params_stream(msg_in));
+    d_ctx.strings = has_feature(XRTP_FEATURE_STRING_INTERNING) ? &request_strings : nullptr;
+    d_ctx.handles = has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &request_handles : nullptr;
     XrInstanceCreateInfo* createInfo{};
     deserialize_ptr(&createInfo, d_ctx);
     XrInstance* instance{};
-    deserialize_ptr(&instance, d_ctx);
+    deserialize_output_ptr(&instance, d_ctx);
 
     // Put existing extensions into vector
     uint32_t old_enabled_extension_count = createInfo->enabledExtensionCount;
@@ -253,12 +328,14 @@ void Server::create_instance_handler(MessageLockIn msg_in) {
     // Send response to client
     // Note: we do this after notifying modules to avoid a race condition
     // Server modules need to be fully initialized before the client returns from xrCreateInstance
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = function_dispatch.start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.handles = begin_handles(has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &response_handles : nullptr);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     serialize_ptr(instance, 1, s_ctx);
     msg_out.flush();
+    commit_handles(s_ctx);
 
     // Restore createInfo to make sure cleanup works as expected
     createInfo->enabledExtensionCount = old_enabled_extension_count;
@@ -269,9 +346,44 @@ void Server::create_instance_handler(MessageLockIn msg_in) {
     cleanup_ptr(instance, 1);
 }
 
+void Server::load_time_functions() {
+#ifdef _WIN32
+    function_loader.ensure_function_loaded(
+        "xrConvertWin32PerformanceCounterToTimeKHR",
+        from_platform_time);
+    function_loader.ensure_function_loaded(
+        "xrConvertTimeToWin32PerformanceCounterKHR",
+        to_platform_time);
+#else
+    function_loader.ensure_function_loaded(
+        "xrConvertTimespecTimeToTimeKHR",
+        from_platform_time);
+    function_loader.ensure_function_loaded(
+        "xrConvertTimeToTimespecTimeKHR",
+        to_platform_time);
+#endif
+}
+
+XrTime Server::to_server_time(XrTime time) {
+    // the runtime's timer can't be read without an instance
+    if (!saved_instance) {
+        return 0;
+    }
+    load_time_functions();
+
+    XRTRANSPORT_PLATFORM_TIME server_platform_time{};
+    convert_to_platform_time(time, &server_platform_time);
+    XrTime server_time{};
+    if (XR_FAILED(from_platform_time(saved_instance, &server_platform_time, &server_time))) {
+        return 0;
+    }
+    return server_time;
+}
+
 void Server::destroy_instance_handler(MessageLockIn msg_in) {
     function_loader.ensure_function_loaded("xrDestroyInstance", function_loader.DestroyInstance);
-    DeserializeContext d_ctx(msg_in.buffer);
+    DeserializeContext d_ctx(function_dispatch.params_stream(msg_in));
+    d_ctx.handles = has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &request_handles : nullptr;
     XrInstance instance{};
     deserialize(&instance, d_ctx);
 
@@ -291,11 +403,13 @@ void Server::destroy_instance_handler(MessageLockIn msg_in) {
         runtime_duration = 0;
     }
     
-    auto msg_out = transport.start_message(XRTP_MSG_FUNCTION_RETURN);
+    auto msg_out = function_dispatch.start_response();
     SerializeContext s_ctx(msg_out.buffer);
+    s_ctx.handles = begin_handles(has_feature(XRTP_FEATURE_COMPACT_ENCODING) ? &response_handles : nullptr);
     serialize(&_result, s_ctx);
     serialize(&runtime_duration, s_ctx);
     msg_out.flush();
+    commit_handles(s_ctx);
 }
 
 }
\ No newline at end of file
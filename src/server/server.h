@@ -4,11 +4,17 @@
 #define XRTRANSPORT_SERVER_H
 
 #include "xrtransport/transport/transport.h"
+#include "xrtransport/transport/connection_options.h"
 #include "xrtransport/server/function_loader.h"
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/virtual_handles.h"
 #include "xrtransport/time.h"
 
 #include "module.h"
 #include "function_dispatch.h"
+#include "frame_waiter.h"
 
 #include "asio/io_context.hpp"
 
@@ -21,11 +27,19 @@ namespace xrtransport {
 class Server {
 private:
     Transport transport;
+    ConnectionOptions options;
+    DeltaDecoder delta_decoder;
+    StringTable request_strings;
+    StringInterner response_strings;
+    HandleTable request_handles;
+    HandleInterner response_handles;
+    VirtualHandleMap virtual_handles;
     FunctionLoader function_loader;
     FunctionDispatch function_dispatch;
+    FrameWaiter frame_waiter;
     std::vector<Module> modules;
     asio::io_context& transport_io_context;
-    XrInstance saved_instance;
+    XrInstance saved_instance = XR_NULL_HANDLE;
 
     // Custom handler of xrCreateInstance provided to FunctionDispatch via dependency injection
     void create_instance_handler(MessageLockIn msg_in);
@@ -37,10 +51,25 @@ private:
     XrResult (*from_platform_time)(XrInstance instance, const XRTRANSPORT_PLATFORM_TIME* platform_time, XrTime* time) = nullptr;
     XrResult (*to_platform_time)(XrInstance instance, XrTime time, XRTRANSPORT_PLATFORM_TIME* platform_time) = nullptr;
 
+    void load_time_functions();
+
+    // Converts a get_time() reading to the time of the runtime, or to 0 before an instance was created.
+    // Stamped on function returns if XRTP_FEATURE_INBAND_TIMESTAMPS was negotiated.
+    XrTime to_server_time(XrTime time);
+
 public:
-    explicit Server(std::unique_ptr<SyncDuplexStream> stream, asio::io_context& stream_io_context, std::vector<std::string> module_paths);
+    explicit Server(std::unique_ptr<SyncDuplexStream> stream, asio::io_context& stream_io_context, std::vector<std::string> module_paths, ConnectionOptions options);
+
+    /**
+     * Perform the protocol handshake with a newly connected client.
+     * @param options Set to the optional features accepted for this connection
+     * @return false if the client was rejected and the stream was closed
+     */
+    static bool do_handshake(SyncDuplexStream& stream, ConnectionOptions& options);
 
-    static bool do_handshake(SyncDuplexStream& stream);
+    bool has_feature(xrtp_Features feature) const {
+        return options.has_feature(feature);
+    }
 
     void run();
 };
@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "action_states.h"
+
+#include "xrtransport/transport/transport.h"
+#include "test_duplex_stream.h"
+
+#include "asio/io_context.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include "openxr/openxr.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// the action states don't look into the calls, so any function ids do
+constexpr std::uint32_t SYNC_ACTIONS = 1;
+constexpr std::uint32_t GET_ACTION_STATE_BOOLEAN = 2;
+constexpr std::uint32_t GET_ACTION_STATE_FLOAT = 3;
+
+constexpr std::uint64_t SESSION = 0x100;
+constexpr std::uint64_t OTHER_SESSION = 0x101;
+constexpr std::uint64_t GRAB_ACTION = 0x200;
+constexpr std::uint64_t TRIGGER_ACTION = 0x201;
+
+using BatchCalls = std::vector<std::pair<std::uint32_t, std::vector<std::uint8_t>>>;
+
+/**
+ * A client connected to a fake server, which answers xrSyncActions with sync_result and each query with
+ * XR_SUCCESS, its function id and the number of successful syncs so far, which tells which sync its
+ * state is from.
+ */
+struct ActionStatesFixture {
+    asio::io_context io_context;
+    std::pair<std::unique_ptr<SyncDuplexStream>, std::unique_ptr<SyncDuplexStream>> streams;
+    Transport client;
+    Transport server;
+    ActionStates action_states;
+
+    std::mutex mutex;
+    std::vector<BatchCalls> batches; // received by the server
+    XrResult sync_result = XR_SUCCESS;
+    std::uint32_t syncs = 0;
+
+    ActionStatesFixture()
+        : streams(create_connected_streams(io_context)), client(std::move(streams.first)),
+            server(std::move(streams.second)), action_states(client)
+    {
+        server.register_handler(XRTP_MSG_FUNCTION_CALL_BATCH, [this](MessageLockIn msg_in) {
+            answer(msg_in);
+        });
+        client.start();
+        server.start();
+    }
+
+    ~ActionStatesFixture() {
+        client.shutdown();
+        client.join();
+        server.join();
+    }
+
+    void answer(MessageLockIn& msg_in) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::uint32_t call_count{};
+        asio::read(msg_in.buffer, asio::buffer(&call_count, sizeof(std::uint32_t)));
+        BatchCalls& calls = batches.emplace_back(call_count);
+
+        auto msg_out = server.start_message(XRTP_MSG_FUNCTION_RETURN_BATCH);
+        asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(std::uint32_t)));
+        for (auto& [function_id, params] : calls) {
+            std::uint32_t params_size{};
+            asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(std::uint32_t)));
+            asio::read(msg_in.buffer, asio::buffer(&params_size, sizeof(std::uint32_t)));
+            params.resize(params_size);
+            asio::read(msg_in.buffer, asio::buffer(params.data(), params.size()));
+
+            if (function_id == SYNC_ACTIONS) {
+                if (XR_SUCCEEDED(sync_result)) {
+                    syncs++;
+                }
+                std::uint32_t result_size = sizeof(XrResult);
+                asio::write(msg_out.buffer, asio::buffer(&result_size, sizeof(std::uint32_t)));
+                asio::write(msg_out.buffer, asio::buffer(&sync_result, sizeof(XrResult)));
+                continue;
+            }
+            XrResult result = XR_SUCCESS;
+            std::uint32_t result_size = sizeof(XrResult) + 2 * sizeof(std::uint32_t);
+            asio::write(msg_out.buffer, asio::buffer(&result_size, sizeof(std::uint32_t)));
+            asio::write(msg_out.buffer, asio::buffer(&result, sizeof(XrResult)));
+            asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(std::uint32_t)));
+            asio::write(msg_out.buffer, asio::buffer(&syncs, sizeof(std::uint32_t)));
+        }
+        msg_out.flush();
+    }
+
+    /**
+     * @return The calls of the count-th batch the server received
+     */
+    BatchCalls batch(std::size_t count) {
+        std::lock_guard<std::mutex> lock(mutex);
+        REQUIRE(batches.size() >= count);
+        return batches[count - 1];
+    }
+
+    XrResult sync_actions(std::uint64_t session) {
+        SampledCall call(SYNC_ACTIONS);
+        asio::write(call, asio::buffer(&session, sizeof(std::uint64_t)));
+        QueryBuffer response;
+        action_states.sync_actions(session, call, response);
+        XrResult result{};
+        asio::read(response, asio::buffer(&result, sizeof(XrResult)));
+        return result;
+    }
+
+    // The sync that the snapshot which answered the query was taken with, or 0 if it wasn't answered
+    std::uint32_t take_snapshot(std::uint64_t session, SampledCall query) {
+        std::uint32_t function_id = query.function_id;
+        QueryBuffer snapshot;
+        if (!action_states.take_snapshot(session, std::move(query), snapshot)) {
+            return 0;
+        }
+        XrResult result{};
+        std::uint32_t snapshot_function_id{};
+        std::uint32_t sync{};
+        asio::read(snapshot, asio::buffer(&result, sizeof(XrResult)));
+        asio::read(snapshot, asio::buffer(&snapshot_function_id, sizeof(std::uint32_t)));
+        asio::read(snapshot, asio::buffer(&sync, sizeof(std::uint32_t)));
+        CHECK(result == XR_SUCCESS);
+        CHECK(snapshot_function_id == function_id);
+        return sync;
+    }
+};
+
+/**
+ * Stands in for the serialized query of a stub: the action is the key, followed by a state of
+ * state_size bytes that is filled with whatever the application left in it.
+ */
+SampledCall make_query(std::uint32_t function_id, std::uint64_t action, std::size_t state_size = 24, std::uint8_t fill = 0) {
+    SampledCall query(function_id);
+    asio::write(query, asio::buffer(&action, sizeof(std::uint64_t)));
+    query.key_size = query.bytes.size();
+    std::vector<std::uint8_t> state(state_size, fill);
+    asio::write(query, asio::buffer(state));
+    return query;
+}
+
+} // namespace
+
+TEST_CASE("Action state queries are answered from the snapshot of the last xrSyncActions", "[action_states]") {
+    ActionStatesFixture fixture;
+
+    // nothing to answer from before the first sync
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 0);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_FLOAT, TRIGGER_ACTION)) == 0);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 0);
+
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    BatchCalls calls = fixture.batch(1);
+    REQUIRE(calls.size() == 3);
+    CHECK(calls[0].first == SYNC_ACTIONS);
+    CHECK(calls[1].first == GET_ACTION_STATE_BOOLEAN);
+    CHECK(calls[1].second == make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION).bytes);
+    CHECK(calls[2].first == GET_ACTION_STATE_FLOAT);
+    CHECK(calls[2].second == make_query(GET_ACTION_STATE_FLOAT, TRIGGER_ACTION).bytes);
+
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 1);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_FLOAT, TRIGGER_ACTION)) == 1);
+    // the state only has to have the same size
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION, 24, 0xCD)) == 1);
+
+    // another action, function, size or session
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, TRIGGER_ACTION)) == 0);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_FLOAT, GRAB_ACTION)) == 0);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION, 32)) == 0);
+    CHECK(fixture.take_snapshot(OTHER_SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 0);
+
+    // the next sync replaces the snapshot, with the queries made since the last one
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    calls = fixture.batch(2);
+    REQUIRE(calls.size() == 6);
+    CHECK(calls[3].second == make_query(GET_ACTION_STATE_BOOLEAN, TRIGGER_ACTION).bytes);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 2);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, TRIGGER_ACTION)) == 2);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION, 32)) == 2);
+
+    // queries that weren't made since the last sync drop out
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    calls = fixture.batch(3);
+    REQUIRE(calls.size() == 4);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_FLOAT, TRIGGER_ACTION)) == 0);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 3);
+}
+
+TEST_CASE("A failed xrSyncActions drops the snapshot and keeps the queries", "[action_states]") {
+    ActionStatesFixture fixture;
+
+    fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION));
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 1);
+
+    fixture.sync_result = XR_ERROR_RUNTIME_FAILURE;
+    CHECK(fixture.sync_actions(SESSION) == XR_ERROR_RUNTIME_FAILURE);
+    CHECK(fixture.batch(2).size() == 2);
+
+    // the queries are sent with the next sync again, without being made in between
+    fixture.sync_result = XR_SUCCESS;
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    BatchCalls calls = fixture.batch(3);
+    REQUIRE(calls.size() == 2);
+    CHECK(calls[1].second == make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION).bytes);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 2);
+
+    // the states of the last successful sync are stale
+    fixture.sync_result = XR_ERROR_RUNTIME_FAILURE;
+    CHECK(fixture.sync_actions(SESSION) == XR_ERROR_RUNTIME_FAILURE);
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 0);
+}
+
+TEST_CASE("Action state snapshots are kept per session until cleared", "[action_states]") {
+    ActionStatesFixture fixture;
+
+    fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION));
+    fixture.take_snapshot(OTHER_SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION));
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    REQUIRE(fixture.sync_actions(OTHER_SESSION) == XR_SUCCESS);
+    CHECK(fixture.batch(1).size() == 2);
+    CHECK(fixture.batch(2).size() == 2);
+
+    // the sync of one session leaves the snapshot of the other
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 1);
+    CHECK(fixture.take_snapshot(OTHER_SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 2);
+
+    // destroying an action drops everything, since the runtime may reuse its handle value
+    fixture.action_states.clear();
+    CHECK(fixture.take_snapshot(SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 0);
+    CHECK(fixture.take_snapshot(OTHER_SESSION, make_query(GET_ACTION_STATE_BOOLEAN, GRAB_ACTION)) == 0);
+
+    fixture.action_states.clear();
+    REQUIRE(fixture.sync_actions(SESSION) == XR_SUCCESS);
+    CHECK(fixture.batch(3).size() == 1);
+}
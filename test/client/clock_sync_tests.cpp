@@ -0,0 +1,367 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "synchronization.h"
+
+#include "xrtransport/transport/transport.h"
+#include "xrtransport/time.h"
+#include "test_duplex_stream.h"
+
+#include "asio/io_context.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+constexpr XrDuration MILLISECOND = 1'000'000;
+constexpr XrDuration MICROSECOND = 1'000;
+
+/**
+ * Adds the timestamps of a round trip that starts at local_time, with the server clock behind the local
+ * one by offset. up and down are the times the messages spent in transit.
+ */
+void add_round_trip(ClockSync& clock_sync, XrTime local_time, XrDuration offset, XrDuration up, XrDuration down) {
+    XrTime t1 = local_time;
+    XrTime t2 = t1 + up - offset;
+    XrTime t3 = t2 + 50 * MICROSECOND;
+    XrTime t4 = t3 + offset + down;
+    clock_sync.add_sample(t1, t2, t3, t4);
+}
+
+// Never started, the estimator doesn't use the transport
+struct Fixture {
+    asio::io_context io_context;
+    Transport transport;
+    ClockSync clock_sync;
+
+    explicit Fixture(bool shared_clock = false)
+        : transport(create_connected_streams(io_context).first), clock_sync(transport, shared_clock) {}
+};
+
+/**
+ * Server end of a loopback connection that answers XRTP_MSG_SYNCHRONIZATION_REQUEST like the real
+ * server, with its clock behind the local one by offset, and counts the probes.
+ */
+struct LoopbackFixture {
+    asio::io_context io_context;
+    std::pair<std::unique_ptr<SyncDuplexStream>, std::unique_ptr<SyncDuplexStream>> streams;
+    Transport client;
+    Transport server;
+    XrDuration offset;
+    std::atomic<int> probes{0};
+    ClockSync clock_sync;
+
+    LoopbackFixture(XrDuration offset, bool shared_clock)
+        : streams(create_connected_streams(io_context)), client(std::move(streams.first)),
+            server(std::move(streams.second)), offset(offset), clock_sync(client, shared_clock)
+    {
+        server.register_handler(XRTP_MSG_SYNCHRONIZATION_REQUEST, [this, shared_clock](MessageLockIn msg_in) {
+            XrTime client_time{};
+            asio::read(msg_in.buffer, asio::buffer(&client_time, sizeof(XrTime)));
+            XrTime server_time = (shared_clock ? client_time : get_time()) - this->offset;
+            probes++;
+
+            auto msg_out = server.start_message(XRTP_MSG_SYNCHRONIZATION_RESPONSE);
+            asio::write(msg_out.buffer, asio::buffer(&server_time, sizeof(XrTime)));
+            msg_out.flush();
+        });
+        client.start();
+        server.start();
+    }
+
+    ~LoopbackFixture() {
+        clock_sync.stop();
+        client.shutdown();
+        client.join();
+        server.join();
+    }
+};
+
+} // namespace
+
+TEST_CASE("Estimator finds a constant offset", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    const XrDuration offset = 123'456'789;
+    XrTime start = get_time() - 5000 * MILLISECOND;
+    int count = 0;
+    for (XrTime time = start; time < start + 5000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL) {
+        add_round_trip(clock_sync, time, offset, 100 * MICROSECOND, 100 * MICROSECOND);
+        count++;
+    }
+
+    CHECK(std::abs(clock_sync.get_time_offset() - offset) <= MICROSECOND);
+
+    ClockSyncStats stats = clock_sync.get_stats();
+    CHECK(std::abs(stats.offset - offset) <= MICROSECOND);
+    CHECK(std::abs(stats.drift_ppm) < 0.1);
+    CHECK(stats.uncertainty <= 200 * MICROSECOND);
+    CHECK(stats.samples == static_cast<std::uint64_t>(count));
+}
+
+TEST_CASE("Estimator follows drifting clocks", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    const XrDuration initial_offset = -40 * MILLISECOND;
+    const double drift = 100e-6; // the offset grows by 100 nanoseconds every millisecond
+    XrTime start = get_time() - 5000 * MILLISECOND;
+    XrTime last = start;
+    for (XrTime time = start; time < start + 5000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL) {
+        XrDuration offset = initial_offset + std::llround(drift * static_cast<double>(time - start));
+        add_round_trip(clock_sync, time, offset, 200 * MICROSECOND, 200 * MICROSECOND);
+        last = time;
+    }
+
+    ClockSyncStats stats = clock_sync.get_stats();
+    CHECK(std::abs(stats.drift_ppm - drift * 1e6) < 1);
+
+    // published at the end of the last round trip
+    XrTime last_end = last + 200 * MICROSECOND + 50 * MICROSECOND + 200 * MICROSECOND;
+    XrDuration expected = initial_offset + std::llround(drift * static_cast<double>(last_end - start));
+    CHECK(std::abs(clock_sync.get_time_offset() - expected) <= 5 * MICROSECOND);
+
+    // drift faster than any real clock is clamped
+    Fixture runaway_fixture;
+    ClockSync& runaway = runaway_fixture.clock_sync;
+    for (XrTime time = start; time < start + 5000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL) {
+        XrDuration offset = std::llround(0.01 * static_cast<double>(time - start));
+        add_round_trip(runaway, time, offset, 200 * MICROSECOND, 200 * MICROSECOND);
+    }
+    CHECK(runaway.get_stats().drift_ppm == ClockSync::MAX_DRIFT * 1e6);
+}
+
+TEST_CASE("Estimator ignores round trips held up on one way", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    const XrDuration offset = 7 * MILLISECOND;
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<XrDuration> jitter(MILLISECOND, 5 * MILLISECOND);
+
+    XrTime start = get_time() - 5000 * MILLISECOND;
+    int round_trip = 0;
+    for (XrTime time = start; time < start + 5000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL, round_trip++) {
+        int bin = round_trip / static_cast<int>(ClockSync::BIN_DURATION / ClockSync::PROBE_INTERVAL);
+        bool fast = round_trip % 7 == 0 && bin % 5 != 3;
+        if (fast) {
+            add_round_trip(clock_sync, time, offset, 100 * MICROSECOND, 100 * MICROSECOND);
+        }
+        else {
+            // requests wait behind other traffic, responses don't, which biases the offset of every
+            // sample, and every fifth bin has no fast round trip at all
+            add_round_trip(clock_sync, time, offset, 100 * MICROSECOND + jitter(random), 100 * MICROSECOND);
+        }
+    }
+
+    ClockSyncStats stats = clock_sync.get_stats();
+    CHECK(std::abs(stats.offset - offset) <= 10 * MICROSECOND);
+    CHECK(std::abs(stats.drift_ppm) < 5);
+    CHECK(std::abs(clock_sync.get_time_offset() - offset) <= 10 * MICROSECOND);
+}
+
+TEST_CASE("Estimator converges as bins fill", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    const XrDuration offset = 3 * MILLISECOND;
+    const double drift = -50e-6;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<XrDuration> jitter(0, 200 * MICROSECOND);
+
+    XrTime start = get_time() - 5000 * MILLISECOND;
+    XrDuration first_error = 0;
+    XrDuration last_error = 0;
+    for (XrTime time = start; time < start + 5000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL) {
+        XrDuration true_offset = offset + std::llround(drift * static_cast<double>(time - start));
+        add_round_trip(clock_sync, time, true_offset, 50 * MICROSECOND + jitter(random), 50 * MICROSECOND + jitter(random));
+
+        XrDuration error = std::abs(clock_sync.get_time_offset() - true_offset);
+        if (time < start + ClockSync::BIN_DURATION) {
+            first_error = std::max(first_error, error);
+        }
+        last_error = error;
+    }
+
+    CHECK(last_error <= 20 * MICROSECOND);
+    CHECK(last_error < first_error);
+    CHECK(std::abs(clock_sync.get_stats().drift_ppm - drift * 1e6) < 10);
+}
+
+TEST_CASE("Estimator drops samples from expired bins", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    const XrDuration old_offset = 2 * MILLISECOND;
+    const XrDuration new_offset = 9 * MILLISECOND;
+    XrTime start = get_time() - 2 * static_cast<XrDuration>(ClockSync::MAX_BINS) * ClockSync::BIN_DURATION;
+
+    // one round trip per bin
+    XrTime time = start;
+    for (std::size_t i = 0; i < ClockSync::MAX_BINS; i++, time += ClockSync::BIN_DURATION) {
+        add_round_trip(clock_sync, time, old_offset, 100 * MICROSECOND, 100 * MICROSECOND);
+    }
+    CHECK(std::abs(clock_sync.get_time_offset() - old_offset) <= MICROSECOND);
+
+    // the old bins are still part of the fit while they are in the window
+    for (std::size_t i = 0; i < ClockSync::MAX_BINS / 2; i++, time += ClockSync::BIN_DURATION) {
+        add_round_trip(clock_sync, time, new_offset, 100 * MICROSECOND, 100 * MICROSECOND);
+    }
+    CHECK(std::abs(clock_sync.get_time_offset() - new_offset) > 100 * MICROSECOND);
+
+    for (std::size_t i = ClockSync::MAX_BINS / 2; i < ClockSync::MAX_BINS; i++, time += ClockSync::BIN_DURATION) {
+        add_round_trip(clock_sync, time, new_offset, 100 * MICROSECOND, 100 * MICROSECOND);
+    }
+
+    ClockSyncStats stats = clock_sync.get_stats();
+    CHECK(std::abs(clock_sync.get_time_offset() - new_offset) <= MICROSECOND);
+    CHECK(std::abs(stats.offset - new_offset) <= MICROSECOND);
+    CHECK(std::abs(stats.drift_ppm) < 0.1);
+    CHECK(stats.samples == 2 * ClockSync::MAX_BINS);
+}
+
+TEST_CASE("Estimator restarts cleanly after reset", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    const XrDuration old_offset = -15 * MILLISECOND;
+    const XrDuration new_offset = 4 * MILLISECOND;
+    XrTime start = get_time() - 2000 * MILLISECOND;
+    for (XrTime time = start; time < start + 1000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL) {
+        // drifting, so that a leftover line would show in the new estimate
+        XrDuration offset = old_offset + std::llround(300e-6 * static_cast<double>(time - start));
+        add_round_trip(clock_sync, time, offset, 100 * MICROSECOND, 100 * MICROSECOND);
+    }
+    REQUIRE(clock_sync.get_stats().drift_ppm > 250);
+
+    clock_sync.reset();
+    ClockSyncStats stats = clock_sync.get_stats();
+    CHECK(stats.samples == 0);
+    CHECK(stats.offset == 0);
+    CHECK(stats.drift_ppm == 0);
+    CHECK(stats.uncertainty == 0);
+    // calls keep converting times with the last offset until there is a new one
+    CHECK(std::abs(clock_sync.get_time_offset() - old_offset) <= MILLISECOND);
+
+    // a single round trip replaces it
+    add_round_trip(clock_sync, start + 1000 * MILLISECOND, new_offset, 100 * MICROSECOND, 100 * MICROSECOND);
+    CHECK(clock_sync.get_time_offset() == new_offset);
+    CHECK(clock_sync.get_stats().samples == 1);
+
+    for (XrTime time = start + 1000 * MILLISECOND; time < start + 2000 * MILLISECOND; time += ClockSync::PROBE_INTERVAL) {
+        add_round_trip(clock_sync, time, new_offset, 100 * MICROSECOND, 100 * MICROSECOND);
+    }
+    stats = clock_sync.get_stats();
+    CHECK(std::abs(stats.offset - new_offset) <= MICROSECOND);
+    CHECK(std::abs(stats.drift_ppm) < 0.1);
+}
+
+TEST_CASE("Estimator rejects invalid timestamps", "[clock_sync]") {
+    Fixture fixture;
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    XrTime now = get_time();
+    // the server couldn't tell when it received the call
+    clock_sync.add_sample(now, 0, 0, now + MILLISECOND);
+    // response received before the call was sent
+    clock_sync.add_sample(now, now, now, now - MILLISECOND);
+    // response sent before the call was received
+    clock_sync.add_sample(now, now, now - MILLISECOND, now + MILLISECOND);
+
+    CHECK(clock_sync.get_stats().samples == 0);
+    CHECK(clock_sync.get_time_offset() == 0);
+
+    // with a shared clock, the offset is exact and never estimated
+    Fixture shared_fixture(true);
+    add_round_trip(shared_fixture.clock_sync, now, 5 * MILLISECOND, 100 * MICROSECOND, 100 * MICROSECOND);
+    CHECK(shared_fixture.clock_sync.get_stats().samples == 0);
+    CHECK(shared_fixture.clock_sync.get_time_offset() == 0);
+}
+
+TEST_CASE("Synchronization thread keeps probing until stopped", "[clock_sync][thread]") {
+    const XrDuration offset = 25 * MILLISECOND;
+    LoopbackFixture fixture(offset, false);
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    // the initial probes are made before start returns
+    clock_sync.start();
+    int started = fixture.probes;
+    CHECK(started >= ClockSync::INITIAL_PROBES);
+    CHECK(std::abs(clock_sync.get_time_offset() - offset) <= MILLISECOND);
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(10 * ClockSync::PROBE_INTERVAL));
+    int running = fixture.probes;
+    CHECK(running > started + 2);
+
+    clock_sync.stop();
+    int stopped = fixture.probes;
+    CHECK(clock_sync.get_stats().samples == static_cast<std::uint64_t>(stopped));
+    std::this_thread::sleep_for(std::chrono::nanoseconds(5 * ClockSync::PROBE_INTERVAL));
+    CHECK(fixture.probes == stopped);
+    CHECK(std::abs(clock_sync.get_time_offset() - offset) <= MILLISECOND);
+
+    // starting again drops the samples of the last run
+    clock_sync.start();
+    ClockSyncStats stats = clock_sync.get_stats();
+    CHECK(stats.samples >= static_cast<std::uint64_t>(ClockSync::INITIAL_PROBES));
+    CHECK(stats.samples <= static_cast<std::uint64_t>(fixture.probes - stopped));
+    std::this_thread::sleep_for(std::chrono::nanoseconds(5 * ClockSync::PROBE_INTERVAL));
+    CHECK(fixture.probes > stopped + ClockSync::INITIAL_PROBES);
+    clock_sync.stop();
+}
+
+TEST_CASE("Synchronization thread doesn't probe while calls have timestamps", "[clock_sync][thread]") {
+    const XrDuration offset = -3 * MILLISECOND;
+    LoopbackFixture fixture(offset, false);
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    clock_sync.start();
+    int started = fixture.probes;
+
+    // a call every 2 milliseconds, with the server stamping it like XRTP_FEATURE_INBAND_TIMESTAMPS
+    XrTime end = get_time() + 10 * ClockSync::PROBE_INTERVAL;
+    while (get_time() < end) {
+        XrTime t1 = get_time();
+        add_round_trip(clock_sync, t1, offset, 100 * MICROSECOND, 100 * MICROSECOND);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    // at most the tick that was already running when the calls started
+    CHECK(fixture.probes <= started + 1);
+    CHECK(std::abs(clock_sync.get_time_offset() - offset) <= MILLISECOND);
+
+    // probing resumes once the calls stop
+    std::this_thread::sleep_for(std::chrono::nanoseconds(10 * ClockSync::PROBE_INTERVAL));
+    CHECK(fixture.probes > started + 2);
+    clock_sync.stop();
+}
+
+TEST_CASE("Shared clock is converted once without a thread", "[clock_sync][thread]") {
+    const XrDuration offset = 1'234'567;
+    LoopbackFixture fixture(offset, true);
+    ClockSync& clock_sync = fixture.clock_sync;
+
+    clock_sync.start();
+    CHECK(fixture.probes == 1);
+    CHECK(clock_sync.get_time_offset() == offset);
+    CHECK(clock_sync.get_stats().offset == offset);
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(5 * ClockSync::PROBE_INTERVAL));
+    CHECK(fixture.probes == 1);
+    clock_sync.stop();
+}
@@ -0,0 +1,726 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "frame_loop.h"
+#include "deferred_errors.h"
+#include "synchronization.h"
+
+#include "xrtransport/transport/transport.h"
+#include "xrtransport/serialization/virtual_handles.h"
+#include "test_duplex_stream.h"
+
+#include "asio/io_context.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+constexpr XrTime FIRST_DISPLAY_TIME = 1'000'000'000;
+constexpr XrDuration DISPLAY_PERIOD = 11'111'111;
+
+// viewStateFlags and the y of the poses returned by the runtime, to tell where a result came from
+constexpr XrViewStateFlags UNFUSED_VIEW_STATE = 0x3;
+constexpr XrViewStateFlags PREFETCHED_VIEW_STATE = 0xF;
+constexpr float UNFUSED = -1.0f;
+constexpr float PREFETCHED = 1.0f;
+
+const XrSession SESSION = handle_from_value<XrSession>(0x100);
+const XrSpace VIEW_SPACE = handle_from_value<XrSpace>(0x200);
+const XrSpace OTHER_VIEW_SPACE = handle_from_value<XrSpace>(0x201);
+const XrSpace LEFT_HAND = handle_from_value<XrSpace>(0x300);
+const XrSpace RIGHT_HAND = handle_from_value<XrSpace>(0x301);
+const XrSpace STAGE = handle_from_value<XrSpace>(0x400);
+const XrSpace LOCAL = handle_from_value<XrSpace>(0x401);
+const XrHandTrackerEXT LEFT_TRACKER = handle_from_value<XrHandTrackerEXT>(0x500);
+const XrHandTrackerEXT RIGHT_TRACKER = handle_from_value<XrHandTrackerEXT>(0x501);
+const XrHandTrackerEXT OTHER_TRACKER = handle_from_value<XrHandTrackerEXT>(0x502);
+
+// the frame loop doesn't look into sampled calls, so any function ids do
+constexpr std::uint32_t LOCATE_HAND_JOINTS = 1;
+constexpr std::uint32_t GET_EYE_GAZES = 2;
+constexpr std::uint32_t NOT_SAMPLED = 3; // the server can't make it
+
+/**
+ * The runtime behind the client, in place of the generated stubs that would call the server. Both
+ * report the frames of one clock.
+ */
+struct Unfused {
+    std::atomic<XrTime> display_time;
+    int wait_frame;
+    int end_session;
+    int locate_views;
+    int locate_space;
+    std::atomic<int> destroy_space;
+    std::atomic<int> destroy_tracker;
+
+    void reset() {
+        display_time = FIRST_DISPLAY_TIME - DISPLAY_PERIOD;
+        wait_frame = 0;
+        end_session = 0;
+        locate_views = 0;
+        locate_space = 0;
+        destroy_space = 0;
+        destroy_tracker = 0;
+    }
+};
+
+Unfused unfused;
+
+XrTime next_display_time() {
+    return unfused.display_time += DISPLAY_PERIOD;
+}
+
+XrResult unfused_wait_frame(XrSession, const XrFrameWaitInfo*, XrFrameState* frame_state) {
+    unfused.wait_frame++;
+    frame_state->predictedDisplayTime = next_display_time();
+    frame_state->predictedDisplayPeriod = DISPLAY_PERIOD;
+    frame_state->shouldRender = XR_TRUE;
+    return XR_SUCCESS;
+}
+
+XrResult unfused_end_frame(XrSession, const XrFrameEndInfo*) {
+    return XR_SUCCESS;
+}
+
+XrResult unfused_end_session(XrSession) {
+    unfused.end_session++;
+    return XR_SUCCESS;
+}
+
+XrResult unfused_locate_views(XrSession, const XrViewLocateInfo*, XrViewState* view_state,
+    uint32_t view_capacity_input, uint32_t* view_count_output, XrView* views)
+{
+    unfused.locate_views++;
+    *view_count_output = 2;
+    view_state->viewStateFlags = UNFUSED_VIEW_STATE;
+    for (uint32_t i = 0; i < view_capacity_input && i < 2; i++) {
+        views[i].pose.position.y = UNFUSED;
+    }
+    return XR_SUCCESS;
+}
+
+XrResult unfused_locate_space(XrSpace, XrSpace, XrTime, XrSpaceLocation* location) {
+    unfused.locate_space++;
+    location->locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    location->pose.position.y = UNFUSED;
+    return XR_SUCCESS;
+}
+
+XrResult unfused_destroy_space(XrSpace) {
+    unfused.destroy_space++;
+    return XR_SUCCESS;
+}
+
+XrResult unfused_destroy_tracker(XrHandTrackerEXT) {
+    unfused.destroy_tracker++;
+    return XR_SUCCESS;
+}
+
+/**
+ * What the client sent in an XRTP_MSG_SPECULATIVE_WAIT_FRAME.
+ */
+struct SpeculativeWait {
+    std::uint64_t session = 0;
+    XrViewConfigurationType view_configuration_type = XR_VIEW_CONFIGURATION_TYPE_MAX_ENUM;
+    std::uint64_t view_space = 0;
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> spaces;
+    std::vector<std::pair<std::uint32_t, std::vector<std::uint8_t>>> calls;
+};
+
+/**
+ * A FrameLoop connected to a fake server, which answers every speculative wait with the next frame of
+ * the runtime. Its views have the index of the view as x and the space as z, its space locations the
+ * space as x and the base space as z, and its samples are the function id followed by the display time,
+ * or empty for NOT_SAMPLED.
+ */
+struct FrameLoopFixture {
+    bool view_prefetch;
+    bool space_prefetch;
+    bool tracker_sampling;
+
+    asio::io_context io_context;
+    std::pair<std::unique_ptr<SyncDuplexStream>, std::unique_ptr<SyncDuplexStream>> streams;
+    Transport client;
+    Transport server;
+    DeferredErrors deferred_errors;
+    ClockSync clock_sync; // never started, so the server's clock is the client's
+    FrameLoop frame_loop;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<SpeculativeWait> waits; // received by the server
+    bool holding = false; // the server doesn't answer while set
+    int answered = 0;
+
+    FrameLoopFixture(bool view_prefetch, bool space_prefetch, bool tracker_sampling)
+        : view_prefetch(view_prefetch), space_prefetch(space_prefetch), tracker_sampling(tracker_sampling),
+            streams(create_connected_streams(io_context)), client(std::move(streams.first)),
+            server(std::move(streams.second)), clock_sync(client, false),
+            frame_loop(client, deferred_errors, clock_sync, view_prefetch, space_prefetch, tracker_sampling)
+    {
+        unfused.reset();
+
+        client.register_handler(XRTP_MSG_FRAME_STATE, [this](MessageLockIn msg_in) {
+            frame_loop.handle_message(std::move(msg_in));
+        });
+        server.register_handler(XRTP_MSG_SPECULATIVE_WAIT_FRAME, [this](MessageLockIn msg_in) {
+            answer(read_wait(msg_in));
+        });
+        client.start();
+        server.start();
+    }
+
+    ~FrameLoopFixture() {
+        release();
+        client.shutdown();
+        client.join();
+        server.join();
+    }
+
+    SpeculativeWait read_wait(MessageLockIn& msg_in) {
+        SpeculativeWait wait;
+        asio::read(msg_in.buffer, asio::buffer(&wait.session, sizeof(std::uint64_t)));
+        if (view_prefetch) {
+            asio::read(msg_in.buffer, asio::buffer(&wait.view_configuration_type, sizeof(XrViewConfigurationType)));
+            asio::read(msg_in.buffer, asio::buffer(&wait.view_space, sizeof(std::uint64_t)));
+        }
+        if (space_prefetch) {
+            std::uint32_t pair_count{};
+            asio::read(msg_in.buffer, asio::buffer(&pair_count, sizeof(std::uint32_t)));
+            wait.spaces.resize(pair_count);
+            for (auto& [space, base_space] : wait.spaces) {
+                asio::read(msg_in.buffer, asio::buffer(&space, sizeof(std::uint64_t)));
+                asio::read(msg_in.buffer, asio::buffer(&base_space, sizeof(std::uint64_t)));
+            }
+        }
+        if (tracker_sampling) {
+            std::uint32_t call_count{};
+            asio::read(msg_in.buffer, asio::buffer(&call_count, sizeof(std::uint32_t)));
+            wait.calls.resize(call_count);
+            for (auto& [function_id, params] : wait.calls) {
+                std::uint32_t params_size{};
+                asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(std::uint32_t)));
+                asio::read(msg_in.buffer, asio::buffer(&params_size, sizeof(std::uint32_t)));
+                params.resize(params_size);
+                asio::read(msg_in.buffer, asio::buffer(params.data(), params.size()));
+            }
+        }
+        return wait;
+    }
+
+    void answer(const SpeculativeWait& wait) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            waits.push_back(wait);
+            condition.notify_all();
+            condition.wait(lock, [this]{ return !holding; });
+        }
+
+        XrResult result = XR_SUCCESS;
+        XrTime display_time = next_display_time();
+        XrBool32 should_render = XR_TRUE;
+        auto msg_out = server.start_message(XRTP_MSG_FRAME_STATE);
+        asio::write(msg_out.buffer, asio::buffer(&wait.session, sizeof(std::uint64_t)));
+        asio::write(msg_out.buffer, asio::buffer(&result, sizeof(XrResult)));
+        asio::write(msg_out.buffer, asio::buffer(&display_time, sizeof(XrTime)));
+        asio::write(msg_out.buffer, asio::buffer(&DISPLAY_PERIOD, sizeof(XrDuration)));
+        asio::write(msg_out.buffer, asio::buffer(&should_render, sizeof(XrBool32)));
+        if (view_prefetch) {
+            std::uint8_t has_views = wait.view_space != 0;
+            asio::write(msg_out.buffer, asio::buffer(&has_views, sizeof(std::uint8_t)));
+            if (has_views) {
+                asio::write(msg_out.buffer, asio::buffer(&PREFETCHED_VIEW_STATE, sizeof(XrViewStateFlags)));
+                std::uint32_t view_count = 2;
+                asio::write(msg_out.buffer, asio::buffer(&view_count, sizeof(std::uint32_t)));
+                for (std::uint32_t i = 0; i < view_count; i++) {
+                    XrPosef pose{{0, 0, 0, 1}, {static_cast<float>(i), PREFETCHED, static_cast<float>(wait.view_space)}};
+                    XrFovf fov{-1, 1, 1, -1};
+                    asio::write(msg_out.buffer, asio::buffer(&pose, sizeof(XrPosef)));
+                    asio::write(msg_out.buffer, asio::buffer(&fov, sizeof(XrFovf)));
+                }
+            }
+        }
+        if (space_prefetch) {
+            std::uint32_t location_count = static_cast<std::uint32_t>(wait.spaces.size());
+            asio::write(msg_out.buffer, asio::buffer(&location_count, sizeof(std::uint32_t)));
+            for (const auto& [space, base_space] : wait.spaces) {
+                XrResult location_result = space ? XR_SUCCESS : XR_ERROR_HANDLE_INVALID;
+                XrSpaceLocationFlags location_flags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+                XrPosef pose{{0, 0, 0, 1}, {static_cast<float>(space), PREFETCHED, static_cast<float>(base_space)}};
+                asio::write(msg_out.buffer, asio::buffer(&location_result, sizeof(XrResult)));
+                asio::write(msg_out.buffer, asio::buffer(&location_flags, sizeof(XrSpaceLocationFlags)));
+                asio::write(msg_out.buffer, asio::buffer(&pose, sizeof(XrPosef)));
+            }
+        }
+        if (tracker_sampling) {
+            std::uint32_t sample_count = static_cast<std::uint32_t>(wait.calls.size());
+            asio::write(msg_out.buffer, asio::buffer(&sample_count, sizeof(std::uint32_t)));
+            for (const auto& call : wait.calls) {
+                if (call.first == NOT_SAMPLED) {
+                    std::uint32_t sample_size = 0;
+                    asio::write(msg_out.buffer, asio::buffer(&sample_size, sizeof(std::uint32_t)));
+                    continue;
+                }
+                std::uint32_t sample_size = sizeof(std::uint32_t) + sizeof(XrTime);
+                asio::write(msg_out.buffer, asio::buffer(&sample_size, sizeof(std::uint32_t)));
+                asio::write(msg_out.buffer, asio::buffer(&call.first, sizeof(std::uint32_t)));
+                asio::write(msg_out.buffer, asio::buffer(&display_time, sizeof(XrTime)));
+            }
+        }
+        msg_out.flush();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        answered++;
+    }
+
+    /**
+     * @return The count-th speculative wait the server received, once it did
+     */
+    SpeculativeWait await_wait(std::size_t count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        bool received = condition.wait_for(lock, std::chrono::seconds(5), [&]{ return waits.size() >= count; });
+        REQUIRE(received);
+        return waits[count - 1];
+    }
+
+    std::size_t wait_count() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return waits.size();
+    }
+
+    int answer_count() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return answered;
+    }
+
+    void hold() {
+        std::lock_guard<std::mutex> lock(mutex);
+        holding = true;
+    }
+
+    void release() {
+        std::lock_guard<std::mutex> lock(mutex);
+        holding = false;
+        condition.notify_all();
+    }
+
+    XrTime wait_frame() {
+        XrFrameWaitInfo frame_wait_info{XR_TYPE_FRAME_WAIT_INFO};
+        XrFrameState frame_state{XR_TYPE_FRAME_STATE};
+        REQUIRE(frame_loop.wait_frame(SESSION, &frame_wait_info, &frame_state, unfused_wait_frame) == XR_SUCCESS);
+        CHECK(frame_state.predictedDisplayPeriod == DISPLAY_PERIOD);
+        CHECK(frame_state.shouldRender == XR_TRUE);
+        return frame_state.predictedDisplayTime;
+    }
+
+    void end_frame(XrTime display_time) {
+        XrFrameEndInfo frame_end_info{XR_TYPE_FRAME_END_INFO};
+        frame_end_info.displayTime = display_time;
+        REQUIRE(frame_loop.end_frame(SESSION, &frame_end_info, unfused_end_frame) == XR_SUCCESS);
+    }
+};
+
+struct LocatedViews {
+    XrResult result;
+    XrViewStateFlags view_state_flags;
+    std::uint32_t view_count;
+    XrView views[2];
+};
+
+LocatedViews locate_views(FrameLoopFixture& fixture, XrTime display_time, XrSpace space,
+    XrViewConfigurationType view_configuration_type = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO,
+    std::uint32_t view_capacity = 2)
+{
+    XrViewLocateInfo view_locate_info{XR_TYPE_VIEW_LOCATE_INFO};
+    view_locate_info.viewConfigurationType = view_configuration_type;
+    view_locate_info.displayTime = display_time;
+    view_locate_info.space = space;
+    XrViewState view_state{XR_TYPE_VIEW_STATE};
+    LocatedViews located{};
+    located.views[0] = {XR_TYPE_VIEW};
+    located.views[1] = {XR_TYPE_VIEW};
+    located.result = fixture.frame_loop.locate_views(SESSION, &view_locate_info, &view_state, view_capacity,
+        &located.view_count, located.views, unfused_locate_views);
+    located.view_state_flags = view_state.viewStateFlags;
+    return located;
+}
+
+XrSpaceLocation locate_space(FrameLoopFixture& fixture, XrSpace space, XrSpace base_space, XrTime time) {
+    XrSpaceLocation location{XR_TYPE_SPACE_LOCATION};
+    REQUIRE(fixture.frame_loop.locate_space(space, base_space, time, &location, unfused_locate_space) == XR_SUCCESS);
+    return location;
+}
+
+std::pair<std::uint64_t, std::uint64_t> space_pair(XrSpace space, XrSpace base_space) {
+    return {handle_value(space), handle_value(base_space)};
+}
+
+/**
+ * Stands in for the serialized call of a stub: the tracker is the key, followed by outputs of capacity
+ * bytes that are filled with whatever the application left in them.
+ */
+SampledCall make_call(std::uint32_t function_id, XrHandTrackerEXT tracker, std::size_t capacity = 16, std::uint8_t fill = 0) {
+    SampledCall call(function_id);
+    std::uint64_t tracker_value = handle_value(tracker);
+    asio::write(call, asio::buffer(&tracker_value, sizeof(std::uint64_t)));
+    call.key_size = call.bytes.size();
+    std::vector<std::uint8_t> outputs(capacity, fill);
+    asio::write(call, asio::buffer(outputs));
+    return call;
+}
+
+// The display time of the sample that answered the call, or 0 if it wasn't answered
+XrTime take_sample(FrameLoopFixture& fixture, SampledCall call, XrTime time) {
+    std::uint32_t function_id = call.function_id;
+    QueryBuffer sample;
+    if (!fixture.frame_loop.take_sample(std::move(call), time, sample)) {
+        return 0;
+    }
+    std::uint32_t sampled_function_id{};
+    XrTime sample_time{};
+    asio::read(sample, asio::buffer(&sampled_function_id, sizeof(std::uint32_t)));
+    asio::read(sample, asio::buffer(&sample_time, sizeof(XrTime)));
+    CHECK(sampled_function_id == function_id);
+    return sample_time;
+}
+
+} // namespace
+
+TEST_CASE("Speculative waits are taken by the next xrWaitFrame", "[frame_loop]") {
+    FrameLoopFixture fixture(false, false, false);
+
+    // the first frame is waited for normally
+    XrTime display_time = fixture.wait_frame();
+    CHECK(display_time == FIRST_DISPLAY_TIME);
+    CHECK(unfused.wait_frame == 1);
+
+    for (int frame = 1; frame <= 3; frame++) {
+        fixture.end_frame(display_time);
+        SpeculativeWait wait = fixture.await_wait(frame);
+        CHECK(wait.session == handle_value(SESSION));
+
+        display_time = fixture.wait_frame();
+        CHECK(display_time == FIRST_DISPLAY_TIME + frame * DISPLAY_PERIOD);
+        CHECK(unfused.wait_frame == 1);
+    }
+
+    // xrEndSession takes the speculative wait of the last frame, so the next session waits normally
+    fixture.end_frame(display_time);
+    fixture.await_wait(4);
+    REQUIRE(fixture.frame_loop.end_session(SESSION, unfused_end_session) == XR_SUCCESS);
+    CHECK(unfused.end_session == 1);
+    CHECK(fixture.answer_count() == 4);
+
+    display_time = fixture.wait_frame();
+    CHECK(unfused.wait_frame == 2);
+    CHECK(display_time == FIRST_DISPLAY_TIME + 5 * DISPLAY_PERIOD);
+    CHECK(fixture.wait_count() == 4);
+}
+
+TEST_CASE("Views are answered from the snapshot of the same display time", "[frame_loop][views]") {
+    FrameLoopFixture fixture(true, false, false);
+
+    XrTime first = fixture.wait_frame();
+    LocatedViews located = locate_views(fixture, first, VIEW_SPACE);
+    CHECK(located.result == XR_SUCCESS);
+    CHECK(unfused.locate_views == 1);
+    CHECK(located.view_state_flags == UNFUSED_VIEW_STATE);
+
+    // the views located at the display time are prefetched with the next frame
+    fixture.end_frame(first);
+    SpeculativeWait wait = fixture.await_wait(1);
+    CHECK(wait.view_configuration_type == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO);
+    CHECK(wait.view_space == handle_value(VIEW_SPACE));
+
+    XrTime second = fixture.wait_frame();
+    located = locate_views(fixture, second, VIEW_SPACE);
+    CHECK(located.result == XR_SUCCESS);
+    CHECK(unfused.locate_views == 1);
+    CHECK(located.view_state_flags == PREFETCHED_VIEW_STATE);
+    REQUIRE(located.view_count == 2);
+    for (std::uint32_t i = 0; i < 2; i++) {
+        CHECK(located.views[i].pose.position.x == static_cast<float>(i));
+        CHECK(located.views[i].pose.position.y == PREFETCHED);
+        CHECK(located.views[i].pose.position.z == static_cast<float>(handle_value(VIEW_SPACE)));
+        CHECK(located.views[i].fov.angleLeft == -1);
+    }
+
+    // two call idiom
+    located = locate_views(fixture, second, VIEW_SPACE, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, 0);
+    CHECK(located.result == XR_SUCCESS);
+    CHECK(located.view_count == 2);
+    located = locate_views(fixture, second, VIEW_SPACE, XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO, 1);
+    CHECK(located.result == XR_ERROR_SIZE_INSUFFICIENT);
+    CHECK(located.view_count == 2);
+    CHECK(unfused.locate_views == 1);
+}
+
+TEST_CASE("Views that don't match the snapshot are located normally", "[frame_loop][views]") {
+    FrameLoopFixture fixture(true, false, false);
+
+    XrTime first = fixture.wait_frame();
+    locate_views(fixture, first, VIEW_SPACE);
+    fixture.end_frame(first);
+    XrTime second = fixture.wait_frame();
+    int calls = unfused.locate_views;
+
+    // another display time
+    LocatedViews located = locate_views(fixture, second + 1, VIEW_SPACE);
+    CHECK(unfused.locate_views == ++calls);
+    CHECK(located.view_state_flags == UNFUSED_VIEW_STATE);
+    CHECK(located.views[0].pose.position.y == UNFUSED);
+
+    // another space
+    located = locate_views(fixture, second, OTHER_VIEW_SPACE);
+    CHECK(unfused.locate_views == ++calls);
+    CHECK(located.views[0].pose.position.y == UNFUSED);
+
+    // another view configuration
+    located = locate_views(fixture, second, VIEW_SPACE, static_cast<XrViewConfigurationType>(1));
+    CHECK(unfused.locate_views == ++calls);
+    CHECK(located.views[0].pose.position.y == UNFUSED);
+
+    // views with next chains can't be filled in
+    XrViewLocateInfo view_locate_info{XR_TYPE_VIEW_LOCATE_INFO};
+    view_locate_info.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+    view_locate_info.displayTime = second;
+    view_locate_info.space = VIEW_SPACE;
+    XrViewState view_state{XR_TYPE_VIEW_STATE};
+    XrViewState chained{XR_TYPE_VIEW_STATE};
+    XrView views[2] = {{XR_TYPE_VIEW, &chained}, {XR_TYPE_VIEW}};
+    std::uint32_t view_count{};
+    fixture.frame_loop.locate_views(SESSION, &view_locate_info, &view_state, 2, &view_count, views, unfused_locate_views);
+    CHECK(unfused.locate_views == ++calls);
+    CHECK(views[0].pose.position.y == UNFUSED);
+
+    // the last call at the display time decides what is prefetched for the next frame
+    fixture.end_frame(second);
+    SpeculativeWait wait = fixture.await_wait(2);
+    CHECK(wait.view_configuration_type == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO);
+    CHECK(wait.view_space == handle_value(VIEW_SPACE));
+
+    // the snapshot of the last frame is stale once the next one was waited for
+    XrTime third = fixture.wait_frame();
+    located = locate_views(fixture, second, VIEW_SPACE);
+    CHECK(unfused.locate_views == ++calls);
+    CHECK(located.views[0].pose.position.y == UNFUSED);
+    located = locate_views(fixture, third, VIEW_SPACE);
+    CHECK(unfused.locate_views == calls);
+    CHECK(located.views[0].pose.position.y == PREFETCHED);
+
+    // and so is the snapshot of an ended session
+    REQUIRE(fixture.frame_loop.end_session(SESSION, unfused_end_session) == XR_SUCCESS);
+    located = locate_views(fixture, third, VIEW_SPACE);
+    CHECK(unfused.locate_views == ++calls);
+    CHECK(located.views[0].pose.position.y == UNFUSED);
+}
+
+TEST_CASE("Spaces located at the display time are prefetched with the next frame", "[frame_loop][spaces]") {
+    FrameLoopFixture fixture(false, true, false);
+
+    XrTime first = fixture.wait_frame();
+    locate_space(fixture, LEFT_HAND, STAGE, first);
+    locate_space(fixture, RIGHT_HAND, STAGE, first);
+    locate_space(fixture, LEFT_HAND, STAGE, first);
+    // not at the display time
+    locate_space(fixture, LOCAL, STAGE, first - DISPLAY_PERIOD);
+    CHECK(unfused.locate_space == 4);
+
+    fixture.end_frame(first);
+    SpeculativeWait wait = fixture.await_wait(1);
+    REQUIRE(wait.spaces.size() == 2);
+    CHECK(wait.spaces[0] == space_pair(LEFT_HAND, STAGE));
+    CHECK(wait.spaces[1] == space_pair(RIGHT_HAND, STAGE));
+
+    XrTime second = fixture.wait_frame();
+    XrSpaceLocation location = locate_space(fixture, LEFT_HAND, STAGE, second);
+    CHECK(unfused.locate_space == 4);
+    CHECK(location.locationFlags == XR_SPACE_LOCATION_POSITION_VALID_BIT);
+    CHECK(location.pose.position.x == static_cast<float>(handle_value(LEFT_HAND)));
+    CHECK(location.pose.position.y == PREFETCHED);
+    CHECK(location.pose.position.z == static_cast<float>(handle_value(STAGE)));
+
+    // another base space, or another time
+    location = locate_space(fixture, LEFT_HAND, LOCAL, second);
+    CHECK(unfused.locate_space == 5);
+    CHECK(location.pose.position.y == UNFUSED);
+    location = locate_space(fixture, LEFT_HAND, STAGE, second + 1);
+    CHECK(unfused.locate_space == 6);
+    CHECK(location.pose.position.y == UNFUSED);
+
+    // spaces that weren't located during a frame drop out
+    fixture.end_frame(second);
+    wait = fixture.await_wait(2);
+    REQUIRE(wait.spaces.size() == 2);
+    CHECK(wait.spaces[0] == space_pair(LEFT_HAND, STAGE));
+    CHECK(wait.spaces[1] == space_pair(LEFT_HAND, LOCAL));
+
+    // the locations of the last frame are stale
+    XrTime third = fixture.wait_frame();
+    location = locate_space(fixture, RIGHT_HAND, STAGE, second);
+    CHECK(unfused.locate_space == 7);
+    CHECK(location.pose.position.y == UNFUSED);
+    location = locate_space(fixture, RIGHT_HAND, STAGE, third);
+    CHECK(unfused.locate_space == 8);
+    CHECK(location.pose.position.y == UNFUSED);
+    location = locate_space(fixture, LEFT_HAND, LOCAL, third);
+    CHECK(unfused.locate_space == 8);
+    CHECK(location.pose.position.y == PREFETCHED);
+}
+
+TEST_CASE("xrDestroySpace waits for the speculative waits that locate the space", "[frame_loop][spaces]") {
+    FrameLoopFixture fixture(false, true, false);
+
+    XrTime first = fixture.wait_frame();
+    locate_space(fixture, LEFT_HAND, STAGE, first);
+    locate_space(fixture, RIGHT_HAND, STAGE, first);
+
+    // the server is still locating the spaces
+    fixture.hold();
+    fixture.end_frame(first);
+    fixture.await_wait(1);
+
+    // spaces that aren't located don't wait
+    REQUIRE(fixture.frame_loop.destroy_space(LOCAL, unfused_destroy_space) == XR_SUCCESS);
+    CHECK(unfused.destroy_space == 1);
+
+    std::thread destroy_thread([&fixture]{
+        fixture.frame_loop.destroy_space(LEFT_HAND, unfused_destroy_space);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CHECK(unfused.destroy_space == 1);
+    CHECK(fixture.answer_count() == 0);
+
+    fixture.release();
+    destroy_thread.join();
+    CHECK(unfused.destroy_space == 2);
+    CHECK(fixture.answer_count() == 1);
+
+    // the runtime may reuse the handle value, so the location the server sent isn't used
+    XrTime second = fixture.wait_frame();
+    XrSpaceLocation location = locate_space(fixture, LEFT_HAND, STAGE, second);
+    CHECK(location.pose.position.y == UNFUSED);
+    location = locate_space(fixture, RIGHT_HAND, STAGE, second);
+    CHECK(location.pose.position.y == PREFETCHED);
+
+    // nor is the destroyed space sent again
+    fixture.end_frame(second);
+    SpeculativeWait wait = fixture.await_wait(2);
+    REQUIRE(wait.spaces.size() == 2);
+    CHECK(wait.spaces[0] == space_pair(LEFT_HAND, STAGE));
+    CHECK(wait.spaces[1] == space_pair(RIGHT_HAND, STAGE));
+}
+
+TEST_CASE("Tracker calls at the display time are sampled with the next frame", "[frame_loop][sampling]") {
+    FrameLoopFixture fixture(false, false, true);
+
+    XrTime first = fixture.wait_frame();
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER), first) == 0);
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER), first) == 0);
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER), first) == 0);
+    CHECK(take_sample(fixture, make_call(NOT_SAMPLED, LEFT_TRACKER), first) == 0);
+    // not at the display time
+    CHECK(take_sample(fixture, make_call(GET_EYE_GAZES, LEFT_TRACKER), first - DISPLAY_PERIOD) == 0);
+
+    fixture.end_frame(first);
+    SpeculativeWait wait = fixture.await_wait(1);
+    REQUIRE(wait.calls.size() == 3);
+    CHECK(wait.calls[0].first == LOCATE_HAND_JOINTS);
+    CHECK(wait.calls[0].second == make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER).bytes);
+    CHECK(wait.calls[1].first == LOCATE_HAND_JOINTS);
+    CHECK(wait.calls[1].second == make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER).bytes);
+    CHECK(wait.calls[2].first == NOT_SAMPLED);
+
+    XrTime second = fixture.wait_frame();
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER), second) == second);
+    // the outputs only have to have the same size
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER, 16, 0xCD), second) == second);
+
+    // another time, function, key or size
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER), second + 1) == 0);
+    CHECK(take_sample(fixture, make_call(GET_EYE_GAZES, LEFT_TRACKER), second) == 0);
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, OTHER_TRACKER), second) == 0);
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER, 32), second) == 0);
+    // nor is a call the server couldn't make
+    CHECK(take_sample(fixture, make_call(NOT_SAMPLED, LEFT_TRACKER), second) == 0);
+
+    // calls that weren't made during a frame drop out
+    fixture.end_frame(second);
+    wait = fixture.await_wait(2);
+    REQUIRE(wait.calls.size() == 6);
+    CHECK(wait.calls[2].first == GET_EYE_GAZES);
+
+    // the samples of the last frame are stale
+    XrTime third = fixture.wait_frame();
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER), second) == 0);
+    CHECK(take_sample(fixture, make_call(GET_EYE_GAZES, LEFT_TRACKER), third) == third);
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER, 32), third) == third);
+}
+
+TEST_CASE("Destroying a tracker waits for the speculative waits that sample calls", "[frame_loop][sampling]") {
+    FrameLoopFixture fixture(false, false, true);
+
+    XrTime first = fixture.wait_frame();
+    take_sample(fixture, make_call(LOCATE_HAND_JOINTS, LEFT_TRACKER), first);
+    take_sample(fixture, make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER), first);
+
+    // the server is still making the calls
+    fixture.hold();
+    fixture.end_frame(first);
+    fixture.await_wait(1);
+
+    std::thread destroy_thread([&fixture]{
+        fixture.frame_loop.destroy_tracker(LEFT_TRACKER, unfused_destroy_tracker);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CHECK(unfused.destroy_tracker == 0);
+    CHECK(fixture.answer_count() == 0);
+
+    fixture.release();
+    destroy_thread.join();
+    CHECK(unfused.destroy_tracker == 1);
+    CHECK(fixture.answer_count() == 1);
+
+    // the params of the calls are opaque, so none of the samples the server sent are used
+    XrTime second = fixture.wait_frame();
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER), second) == 0);
+
+    // and they are sampled again from the next frame
+    fixture.end_frame(second);
+    SpeculativeWait wait = fixture.await_wait(2);
+    REQUIRE(wait.calls.size() == 1);
+    CHECK(wait.calls[0].second == make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER).bytes);
+    XrTime third = fixture.wait_frame();
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER), third) == third);
+
+    // xrDestroySpace forgets them as well, since they may be located in the space
+    REQUIRE(fixture.frame_loop.destroy_space(STAGE, unfused_destroy_space) == XR_SUCCESS);
+    CHECK(take_sample(fixture, make_call(LOCATE_HAND_JOINTS, RIGHT_TRACKER), third) == 0);
+
+    fixture.end_frame(third);
+    fixture.await_wait(3);
+
+    // with no calls in flight, destroying a tracker doesn't wait for the server
+    XrTime fourth = fixture.wait_frame();
+    fixture.hold();
+    fixture.end_frame(fourth);
+    wait = fixture.await_wait(4);
+    CHECK(wait.calls.empty());
+    REQUIRE(fixture.frame_loop.destroy_tracker(RIGHT_TRACKER, unfused_destroy_tracker) == XR_SUCCESS);
+    CHECK(unfused.destroy_tracker == 2);
+    CHECK(fixture.answer_count() == 3);
+}
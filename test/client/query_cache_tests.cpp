@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "query_cache.h"
+
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include "openxr/openxr.h"
+
+#include <cstdint>
+
+using namespace xrtransport;
+
+namespace {
+
+// function ids of the generated stubs
+constexpr std::uint32_t GET_SYSTEM = 38;
+constexpr std::uint32_t GET_SYSTEM_PROPERTIES = 39;
+constexpr std::uint32_t ENUMERATE_REFERENCE_SPACES = 25;
+
+constexpr std::uint64_t INSTANCE = 0x1000;
+constexpr std::uint64_t OTHER_INSTANCE = 0x2000;
+constexpr std::uint64_t SESSION = 0x3000;
+
+// Stands in for the serialized params, which the cache doesn't look into
+QueryKey make_key(std::uint64_t owner, std::uint32_t function_id, std::uint64_t param) {
+    QueryKey key(owner, function_id);
+    asio::write(key, asio::buffer(&owner, sizeof(owner)));
+    asio::write(key, asio::buffer(&param, sizeof(param)));
+    return key;
+}
+
+QueryBuffer make_outputs(std::uint64_t value) {
+    QueryBuffer outputs;
+    asio::write(outputs, asio::buffer(&value, sizeof(value)));
+    return outputs;
+}
+
+// The value read back from the outputs of a hit, or 0 for a miss
+std::uint64_t lookup_value(QueryCache& cache, const QueryKey& key) {
+    XrResult result{};
+    QueryBuffer outputs;
+    if (!cache.lookup(key, result, outputs)) {
+        return 0;
+    }
+    REQUIRE(result == XR_SUCCESS);
+    std::uint64_t value{};
+    asio::read(outputs, asio::buffer(&value, sizeof(value)));
+    return value;
+}
+
+} // namespace
+
+TEST_CASE("Query cache is keyed by owner, function and params", "[query_cache]") {
+    QueryCache cache;
+
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 0);
+    cache.store(make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY), XR_SUCCESS, make_outputs(1));
+    cache.store(make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HANDHELD_DISPLAY), XR_SUCCESS, make_outputs(2));
+    cache.store(make_key(INSTANCE, GET_SYSTEM_PROPERTIES, 1), XR_SUCCESS, make_outputs(3));
+    cache.store(make_key(OTHER_INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY), XR_SUCCESS, make_outputs(4));
+
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 1);
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HANDHELD_DISPLAY)) == 2);
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM_PROPERTIES, 1)) == 3);
+    CHECK(lookup_value(cache, make_key(OTHER_INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 4);
+
+    // same params for another function, and other params for the same one
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM_PROPERTIES, XR_FORM_FACTOR_HANDHELD_DISPLAY)) == 0);
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM_PROPERTIES, 2)) == 0);
+    CHECK(lookup_value(cache, make_key(OTHER_INSTANCE, GET_SYSTEM_PROPERTIES, 1)) == 0);
+
+    // a longer key with the same prefix
+    QueryKey longer = make_key(INSTANCE, GET_SYSTEM_PROPERTIES, 1);
+    std::uint8_t extra = 0;
+    asio::write(longer, asio::buffer(&extra, sizeof(extra)));
+    CHECK(lookup_value(cache, longer) == 0);
+
+    // storing again replaces the entry
+    cache.store(make_key(INSTANCE, GET_SYSTEM_PROPERTIES, 1), XR_SUCCESS, make_outputs(5));
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM_PROPERTIES, 1)) == 5);
+
+    QueryCacheStats stats = cache.get_stats();
+    CHECK(stats.hits == 5);
+    CHECK(stats.misses == 5);
+}
+
+TEST_CASE("Query cache doesn't keep failed queries", "[query_cache]") {
+    QueryCache cache;
+
+    // xrGetSystem fails while the headset is unplugged, and succeeds once it is plugged in
+    QueryKey key = make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY);
+    cache.store(key, XR_ERROR_FORM_FACTOR_UNAVAILABLE, QueryBuffer());
+    CHECK(lookup_value(cache, key) == 0);
+
+    // neither are results that only qualify success
+    cache.store(key, XR_SESSION_LOSS_PENDING, make_outputs(1));
+    CHECK(lookup_value(cache, key) == 0);
+
+    cache.store(key, XR_SUCCESS, make_outputs(2));
+    CHECK(lookup_value(cache, key) == 2);
+}
+
+TEST_CASE("Query cache drops the entries of destroyed handles", "[query_cache]") {
+    QueryCache cache;
+
+    cache.store(make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY), XR_SUCCESS, make_outputs(1));
+    cache.store(make_key(OTHER_INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY), XR_SUCCESS, make_outputs(2));
+    cache.store(make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 0), XR_SUCCESS, make_outputs(3));
+    cache.store(make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 3), XR_SUCCESS, make_outputs(4));
+
+    // xrDestroySession drops the entries of the session only
+    cache.clear(SESSION);
+    CHECK(lookup_value(cache, make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 0)) == 0);
+    CHECK(lookup_value(cache, make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 3)) == 0);
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 1);
+    CHECK(lookup_value(cache, make_key(OTHER_INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 2);
+
+    // a runtime that reuses the handle value doesn't get the old entries
+    cache.store(make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 0), XR_SUCCESS, make_outputs(5));
+    CHECK(lookup_value(cache, make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 0)) == 5);
+
+    // xrDestroyInstance drops everything
+    cache.clear();
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 0);
+    CHECK(lookup_value(cache, make_key(OTHER_INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 0);
+    CHECK(lookup_value(cache, make_key(SESSION, ENUMERATE_REFERENCE_SPACES, 0)) == 0);
+
+    // clearing a handle without entries does nothing
+    cache.store(make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY), XR_SUCCESS, make_outputs(6));
+    cache.clear(SESSION);
+    CHECK(lookup_value(cache, make_key(INSTANCE, GET_SYSTEM, XR_FORM_FACTOR_HEAD_MOUNTED_DISPLAY)) == 6);
+}
@@ -0,0 +1,4036 @@
+/*
+ * AUTO-GENERATED FILE - DO NOT EDIT DIRECTLY
+ *
+ * This file was automatically generated by the code_generation module.
+ * Any changes made to this file will be lost when regenerated.
+ *
+ * To modify this file, edit the corresponding template in:
+ * code_generation/templates/test/serialization_benchmarks.mako
+ */
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+// Measures the serialization cost of every core struct and of the params of every core function.
+// The values are generated the same way as in fuzzer.cpp, but every pointer is filled in and no
+// next chains are added, so that each result only covers the struct itself.
+//
+// Usage: serialization_benchmarks [--iterations N] [output.json]
+// Results are written as JSON to the output file, or stdout if none is given. Build once with and once
+// without XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION to compare both modes.
+
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/asio_compat.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+
+namespace {
+
+// Simple FIFO stream buffer, like the one in fuzzer.cpp
+class BenchmarkStreamBuffer : public SyncDuplexStream {
+private:
+    std::vector<char> buffer_;
+    std::size_t read_pos_ = 0;
+
+public:
+    void close() override {}
+
+    void close(asio::error_code& ec) override {
+        ec.clear();
+    }
+
+    std::size_t read_some(const asio::mutable_buffer& buffers) override {
+        asio::error_code ec;
+        return read_some(buffers, ec);
+    }
+
+    std::size_t read_some(const asio::mutable_buffer& buffers, asio::error_code& ec) override {
+        ec.clear();
+        std::size_t to_read = std::min(buffers.size(), buffer_.size() - read_pos_);
+        std::memcpy(buffers.data(), buffer_.data() + read_pos_, to_read);
+        read_pos_ += to_read;
+        return to_read;
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffers) override {
+        asio::error_code ec;
+        return write_some(buffers, ec);
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffers, asio::error_code& ec) override {
+        ec.clear();
+        const char* data = static_cast<const char*>(buffers.data());
+        buffer_.insert(buffer_.end(), data, data + buffers.size());
+        return buffers.size();
+    }
+
+    void clear() {
+        buffer_.clear();
+        read_pos_ = 0;
+    }
+
+    std::size_t size() const {
+        return buffer_.size();
+    }
+};
+
+struct BenchmarkResult {
+    const char* name;
+    double bytes;
+    double serialize_ns;
+    double deserialize_ns;
+    double cleanup_ns;
+    // one serialize, deserialize and cleanup before any other, with cold caches
+    double first_ns;
+};
+
+#ifdef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+constexpr const char* SERIALIZATION_MODE = "table";
+#else
+constexpr const char* SERIALIZATION_MODE = "generated";
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+double ns_per_op(Clock::time_point start, Clock::time_point end, std::size_t iterations) {
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// Serializes item iterations times, then deserializes and cleans up every copy
+template <typename T, typename Serialize, typename Deserialize, typename Cleanup>
+BenchmarkResult run_benchmark(const char* name, const T& item, std::size_t iterations,
+    Serialize serialize_item, Deserialize deserialize_item, Cleanup cleanup_item)
+{
+    BenchmarkStreamBuffer buffer;
+    // the first call pays for cold instruction caches, like at startup or for rarely used structs
+    auto first_start = Clock::now();
+    {
+        SerializeContext s_ctx(buffer);
+        serialize_item(item, s_ctx);
+        T first{};
+        DeserializeContext d_ctx(buffer);
+        deserialize_item(first, d_ctx);
+        cleanup_item(first);
+    }
+    auto first_end = Clock::now();
+    buffer.clear();
+
+    // warm up, so that the buffer doesn't grow while timing
+    {
+        SerializeContext s_ctx(buffer);
+        for (std::size_t i = 0; i < iterations; i++) {
+            serialize_item(item, s_ctx);
+        }
+    }
+    buffer.clear();
+
+    SerializeContext s_ctx(buffer);
+    auto serialize_start = Clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        serialize_item(item, s_ctx);
+    }
+    auto serialize_end = Clock::now();
+
+    std::vector<T> items(iterations);
+    DeserializeContext d_ctx(buffer);
+    auto deserialize_start = Clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        deserialize_item(items[i], d_ctx);
+    }
+    auto deserialize_end = Clock::now();
+
+    auto cleanup_start = Clock::now();
+    for (std::size_t i = 0; i < iterations; i++) {
+        cleanup_item(items[i]);
+    }
+    auto cleanup_end = Clock::now();
+
+    return BenchmarkResult{
+        name,
+        static_cast<double>(buffer.size()) / iterations,
+        ns_per_op(serialize_start, serialize_end, iterations),
+        ns_per_op(deserialize_start, deserialize_end, iterations),
+        ns_per_op(cleanup_start, cleanup_end, iterations),
+        ns_per_op(first_start, first_end, 1),
+    };
+}
+
+template <typename T>
+BenchmarkResult run_struct_benchmark(const char* name, const T& item, std::size_t iterations) {
+    return run_benchmark(name, item, iterations,
+        [](const T& item, SerializeContext& ctx) { serialize(&item, ctx); },
+        [](T& item, DeserializeContext& ctx) { deserialize(&item, ctx); },
+        [](T& item) { cleanup(&item); });
+}
+
+//
+// Structs
+//
+
+BenchmarkResult benchmark_XrActionCreateInfo(std::size_t iterations) {
+    XrActionCreateInfo item{};
+    item.type = XR_TYPE_ACTION_CREATE_INFO;
+    item.next = nullptr;
+    for (int i = 0; i < XR_MAX_ACTION_NAME_SIZE; i++) {
+        item.actionName[i] = 'I';
+    }
+    item.actionType = (XrActionType) 0xbb5d75b895f628f2;
+    item.countSubactionPaths = 12;
+    XrPath item_subactionPaths[12]{};
+    item_subactionPaths[0] = (XrPath) 0xfee29f53ebf644bb;
+    item_subactionPaths[1] = (XrPath) 0xe98cd7d9dd23f7b6;
+    item_subactionPaths[2] = (XrPath) 0xccd1118fbccfb637;
+    item_subactionPaths[3] = (XrPath) 0x982e524e5a695365;
+    item_subactionPaths[4] = (XrPath) 0x9a795ff675084791;
+    item_subactionPaths[5] = (XrPath) 0xc604715793c9c8fe;
+    item_subactionPaths[6] = (XrPath) 0xacf40c450dc7f078;
+    item_subactionPaths[7] = (XrPath) 0x3262c798a28f38bd;
+    item_subactionPaths[8] = (XrPath) 0x48f0e6421ac66dea;
+    item_subactionPaths[9] = (XrPath) 0x9c5cf234efd6a13e;
+    item_subactionPaths[10] = (XrPath) 0x8cb331163a92fc19;
+    item_subactionPaths[11] = (XrPath) 0xa5504f71b9fe9f2d;
+    item.subactionPaths = item_subactionPaths;
+    for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_NAME_SIZE; i++) {
+        item.localizedActionName[i] = '2';
+    }
+    return run_struct_benchmark("XrActionCreateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionSetCreateInfo(std::size_t iterations) {
+    XrActionSetCreateInfo item{};
+    item.type = XR_TYPE_ACTION_SET_CREATE_INFO;
+    item.next = nullptr;
+    for (int i = 0; i < XR_MAX_ACTION_SET_NAME_SIZE; i++) {
+        item.actionSetName[i] = 'N';
+    }
+    for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE; i++) {
+        item.localizedActionSetName[i] = 'l';
+    }
+    item.priority = (uint32_t) 0xbf11b34d0ce941cc;
+    return run_struct_benchmark("XrActionSetCreateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionSpaceCreateInfo(std::size_t iterations) {
+    XrActionSpaceCreateInfo item{};
+    item.type = XR_TYPE_ACTION_SPACE_CREATE_INFO;
+    item.next = nullptr;
+    item.action = (XrAction) 0x41dd9a9fa508c8e8;
+    item.subactionPath = (XrPath) 0xb5710cdb11190839;
+    item.poseInActionSpace.orientation.x = (float) 0x311e18c91413b58c;
+    item.poseInActionSpace.orientation.y = (float) 0xe0a9467740c7c159;
+    item.poseInActionSpace.orientation.z = (float) 0x2663ba178df6073d;
+    item.poseInActionSpace.orientation.w = (float) 0x6e10d8ac0af84fd9;
+    item.poseInActionSpace.position.x = (float) 0xf8a82a8dbdb78c3f;
+    item.poseInActionSpace.position.y = (float) 0xa24898ef0e531c17;
+    item.poseInActionSpace.position.z = (float) 0x6164b99c58e8abfc;
+    return run_struct_benchmark("XrActionSpaceCreateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionStateBoolean(std::size_t iterations) {
+    XrActionStateBoolean item{};
+    item.type = XR_TYPE_ACTION_STATE_BOOLEAN;
+    item.next = nullptr;
+    item.currentState = (XrBool32) 0x310791bb36b87e69;
+    item.changedSinceLastSync = (XrBool32) 0x8d85b3156df9f721;
+    item.lastChangeTime = (XrTime) 0xd7b9ba35fdc95e56;
+    item.isActive = (XrBool32) 0x9fd67893649866e0;
+    return run_struct_benchmark("XrActionStateBoolean", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionStateFloat(std::size_t iterations) {
+    XrActionStateFloat item{};
+    item.type = XR_TYPE_ACTION_STATE_FLOAT;
+    item.next = nullptr;
+    item.currentState = (float) 0xef320f9e6ae31520;
+    item.changedSinceLastSync = (XrBool32) 0xa111b92eb29983bc;
+    item.lastChangeTime = (XrTime) 0xc7e29a0a50ac78e3;
+    item.isActive = (XrBool32) 0x5bd36272dfbe3b62;
+    return run_struct_benchmark("XrActionStateFloat", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionStateGetInfo(std::size_t iterations) {
+    XrActionStateGetInfo item{};
+    item.type = XR_TYPE_ACTION_STATE_GET_INFO;
+    item.next = nullptr;
+    item.action = (XrAction) 0x3c9921edbf0d1338;
+    item.subactionPath = (XrPath) 0xb556ec05d02819d9;
+    return run_struct_benchmark("XrActionStateGetInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionStatePose(std::size_t iterations) {
+    XrActionStatePose item{};
+    item.type = XR_TYPE_ACTION_STATE_POSE;
+    item.next = nullptr;
+    item.isActive = (XrBool32) 0x57adf7db00bc9d0c;
+    return run_struct_benchmark("XrActionStatePose", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionStateVector2f(std::size_t iterations) {
+    XrActionStateVector2f item{};
+    item.type = XR_TYPE_ACTION_STATE_VECTOR2F;
+    item.next = nullptr;
+    item.currentState.x = (float) 0xff195e1b63859e99;
+    item.currentState.y = (float) 0x94c6e3f48118560b;
+    item.changedSinceLastSync = (XrBool32) 0xa3b5c6c4320ffd46;
+    item.lastChangeTime = (XrTime) 0xaac04cfd1d1a63b5;
+    item.isActive = (XrBool32) 0xd606e0b4d21b0cb;
+    return run_struct_benchmark("XrActionStateVector2f", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionSuggestedBinding(std::size_t iterations) {
+    XrActionSuggestedBinding item{};
+    item.action = (XrAction) 0xb78c2f91ca726265;
+    item.binding = (XrPath) 0x88f3ae915b0c383c;
+    return run_struct_benchmark("XrActionSuggestedBinding", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActionsSyncInfo(std::size_t iterations) {
+    XrActionsSyncInfo item{};
+    item.type = XR_TYPE_ACTIONS_SYNC_INFO;
+    item.next = nullptr;
+    item.countActiveActionSets = 5;
+    XrActiveActionSet item_activeActionSets[5]{};
+    item_activeActionSets[0].actionSet = (XrActionSet) 0xa4ec780fabedb4a1;
+    item_activeActionSets[0].subactionPath = (XrPath) 0x8f78a664a41f6cf8;
+    item_activeActionSets[1].actionSet = (XrActionSet) 0x40e58254bd7ee48;
+    item_activeActionSets[1].subactionPath = (XrPath) 0xee3451827d29c6d9;
+    item_activeActionSets[2].actionSet = (XrActionSet) 0xb8c273f1bc356740;
+    item_activeActionSets[2].subactionPath = (XrPath) 0xca6cff022cde9d66;
+    item_activeActionSets[3].actionSet = (XrActionSet) 0xa5d53bc4390ae888;
+    item_activeActionSets[3].subactionPath = (XrPath) 0xc099797c4e91b1e1;
+    item_activeActionSets[4].actionSet = (XrActionSet) 0xb0f2badc066a2d52;
+    item_activeActionSets[4].subactionPath = (XrPath) 0xc8f4cee61a3aa135;
+    item.activeActionSets = item_activeActionSets;
+    return run_struct_benchmark("XrActionsSyncInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrActiveActionSet(std::size_t iterations) {
+    XrActiveActionSet item{};
+    item.actionSet = (XrActionSet) 0xb7be9b2714c7f9be;
+    item.subactionPath = (XrPath) 0xdbdfdb26a8dda2a5;
+    return run_struct_benchmark("XrActiveActionSet", item, iterations);
+}
+
+BenchmarkResult benchmark_XrApiLayerProperties(std::size_t iterations) {
+    XrApiLayerProperties item{};
+    item.type = XR_TYPE_API_LAYER_PROPERTIES;
+    item.next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        item.layerName[i] = 'm';
+    }
+    item.specVersion = (XrVersion) 0x140abfd61b463d19;
+    item.layerVersion = (uint32_t) 0xf12121be50901a3;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        item.description[i] = 'o';
+    }
+    return run_struct_benchmark("XrApiLayerProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrApplicationInfo(std::size_t iterations) {
+    XrApplicationInfo item{};
+    for (int i = 0; i < XR_MAX_APPLICATION_NAME_SIZE; i++) {
+        item.applicationName[i] = 'R';
+    }
+    item.applicationVersion = (uint32_t) 0x6a6b59c9c9c0c490;
+    for (int i = 0; i < XR_MAX_ENGINE_NAME_SIZE; i++) {
+        item.engineName[i] = '2';
+    }
+    item.engineVersion = (uint32_t) 0x762fe5758d359604;
+    item.apiVersion = (XrVersion) 0x31b56da5be9ba399;
+    return run_struct_benchmark("XrApplicationInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrBodySkeletonJointHTC(std::size_t iterations) {
+    XrBodySkeletonJointHTC item{};
+    item.pose.orientation.x = (float) 0xa94de172a6445bd3;
+    item.pose.orientation.y = (float) 0x716d68c60eef6fd;
+    item.pose.orientation.z = (float) 0xf3bf77ece9aeabe9;
+    item.pose.orientation.w = (float) 0xf9348b5ca6ebf672;
+    item.pose.position.x = (float) 0xeaa5bf768fea1597;
+    item.pose.position.y = (float) 0x4ca4cd0e6a1100bc;
+    item.pose.position.z = (float) 0x5289ab25aa0a39c2;
+    return run_struct_benchmark("XrBodySkeletonJointHTC", item, iterations);
+}
+
+BenchmarkResult benchmark_XrBoundSourcesForActionEnumerateInfo(std::size_t iterations) {
+    XrBoundSourcesForActionEnumerateInfo item{};
+    item.type = XR_TYPE_BOUND_SOURCES_FOR_ACTION_ENUMERATE_INFO;
+    item.next = nullptr;
+    item.action = (XrAction) 0x9f882ba76fa0a125;
+    return run_struct_benchmark("XrBoundSourcesForActionEnumerateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrBoxf(std::size_t iterations) {
+    XrBoxf item{};
+    item.center.orientation.x = (float) 0x7920276665ae497d;
+    item.center.orientation.y = (float) 0xda77d7f1acb7403e;
+    item.center.orientation.z = (float) 0x12cf8e3b308442bd;
+    item.center.orientation.w = (float) 0xcee1a58ec8d2520e;
+    item.center.position.x = (float) 0xd701b4a09a5bde6f;
+    item.center.position.y = (float) 0x6fd3ac3c2fa10751;
+    item.center.position.z = (float) 0xa202ada8eca547ab;
+    item.extents.width = (float) 0xe099e4dfb5a5fdeb;
+    item.extents.height = (float) 0xfd9dbfef327d42f;
+    item.extents.depth = (float) 0x875392e8b07bb153;
+    return run_struct_benchmark("XrBoxf", item, iterations);
+}
+
+BenchmarkResult benchmark_XrColor3f(std::size_t iterations) {
+    XrColor3f item{};
+    item.r = (float) 0xf84d63b79d571882;
+    item.g = (float) 0x74dbe96fb8925066;
+    item.b = (float) 0x9d5da5cb860f5959;
+    return run_struct_benchmark("XrColor3f", item, iterations);
+}
+
+BenchmarkResult benchmark_XrColor4f(std::size_t iterations) {
+    XrColor4f item{};
+    item.r = (float) 0x16ea0c7e369320c5;
+    item.g = (float) 0xc59532ecdb65c140;
+    item.b = (float) 0x5f2d6707bed86e62;
+    item.a = (float) 0x256a3091250b68ac;
+    return run_struct_benchmark("XrColor4f", item, iterations);
+}
+
+BenchmarkResult benchmark_XrCompositionLayerProjection(std::size_t iterations) {
+    XrCompositionLayerProjection item{};
+    item.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION;
+    item.next = nullptr;
+    item.layerFlags = (XrCompositionLayerFlags) 0x68a2ad5c9eed7637;
+    item.space = (XrSpace) 0x43ea6daed2a87911;
+    item.viewCount = 7;
+    XrCompositionLayerProjectionView item_views[7]{};
+    item_views[0].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[0].next = nullptr;
+    item_views[0].pose.orientation.x = (float) 0xe0bd6d10999f2b4c;
+    item_views[0].pose.orientation.y = (float) 0x47ef37c6edc65635;
+    item_views[0].pose.orientation.z = (float) 0xc37e9dda1bc95da8;
+    item_views[0].pose.orientation.w = (float) 0xe64f8febe0026ed8;
+    item_views[0].pose.position.x = (float) 0xb2fefd09b4588ab0;
+    item_views[0].pose.position.y = (float) 0xe3c364800948ef7;
+    item_views[0].pose.position.z = (float) 0x5a0a0addc992c017;
+    item_views[0].fov.angleLeft = (float) 0xec51517e927fa5fd;
+    item_views[0].fov.angleRight = (float) 0xf3fe1593bb023777;
+    item_views[0].fov.angleUp = (float) 0xb69e2dbb5c40a5c7;
+    item_views[0].fov.angleDown = (float) 0x19b5fc393e0fe3ae;
+    item_views[0].subImage.swapchain = (XrSwapchain) 0x5122540c8e528606;
+    item_views[0].subImage.imageRect.offset.x = (int32_t) 0xe023683652ffc41b;
+    item_views[0].subImage.imageRect.offset.y = (int32_t) 0xb153a85ea4259db;
+    item_views[0].subImage.imageRect.extent.width = (int32_t) 0x5212bf356ba3d765;
+    item_views[0].subImage.imageRect.extent.height = (int32_t) 0xef58301d0cc6e743;
+    item_views[0].subImage.imageArrayIndex = (uint32_t) 0x57f6039b9121919f;
+    item_views[1].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[1].next = nullptr;
+    item_views[1].pose.orientation.x = (float) 0x70a17b460561ef6e;
+    item_views[1].pose.orientation.y = (float) 0x89384475b1d79e8b;
+    item_views[1].pose.orientation.z = (float) 0x4f749f6bbca2014c;
+    item_views[1].pose.orientation.w = (float) 0x86640d6bcb51b002;
+    item_views[1].pose.position.x = (float) 0x900a5085686509b2;
+    item_views[1].pose.position.y = (float) 0x6437ad6d20b1eed5;
+    item_views[1].pose.position.z = (float) 0x635ccbc3bf037ba2;
+    item_views[1].fov.angleLeft = (float) 0x42f61c751384c355;
+    item_views[1].fov.angleRight = (float) 0x401f43638610a613;
+    item_views[1].fov.angleUp = (float) 0x9f54b21719b41cfb;
+    item_views[1].fov.angleDown = (float) 0xa7aeb95d1f18e9e4;
+    item_views[1].subImage.swapchain = (XrSwapchain) 0xeea5eae8f893c6a6;
+    item_views[1].subImage.imageRect.offset.x = (int32_t) 0x17df816c4d8df934;
+    item_views[1].subImage.imageRect.offset.y = (int32_t) 0x1a333e9807d1b965;
+    item_views[1].subImage.imageRect.extent.width = (int32_t) 0x921f8fc5ef520867;
+    item_views[1].subImage.imageRect.extent.height = (int32_t) 0x273ae094c61fdb7e;
+    item_views[1].subImage.imageArrayIndex = (uint32_t) 0xfff5c588f24f04a2;
+    item_views[2].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[2].next = nullptr;
+    item_views[2].pose.orientation.x = (float) 0x3f4674f357e7f058;
+    item_views[2].pose.orientation.y = (float) 0xb5f50c8d981a4378;
+    item_views[2].pose.orientation.z = (float) 0xb6e0dfc356a7b732;
+    item_views[2].pose.orientation.w = (float) 0xddeaf197fbd81d07;
+    item_views[2].pose.position.x = (float) 0x19a73279e90be331;
+    item_views[2].pose.position.y = (float) 0x6638b2c96c605fa9;
+    item_views[2].pose.position.z = (float) 0x3bcc47de126dfd0c;
+    item_views[2].fov.angleLeft = (float) 0x671dfb202efef734;
+    item_views[2].fov.angleRight = (float) 0x41866137572f48ed;
+    item_views[2].fov.angleUp = (float) 0x11d6a9892d43d0f9;
+    item_views[2].fov.angleDown = (float) 0xa3570ab2891296ef;
+    item_views[2].subImage.swapchain = (XrSwapchain) 0x7038ad525045d6ce;
+    item_views[2].subImage.imageRect.offset.x = (int32_t) 0x866778f238f878c3;
+    item_views[2].subImage.imageRect.offset.y = (int32_t) 0x1c42c81764b11177;
+    item_views[2].subImage.imageRect.extent.width = (int32_t) 0xc40ae2d30ca49e93;
+    item_views[2].subImage.imageRect.extent.height = (int32_t) 0xbaaa128eab882ec7;
+    item_views[2].subImage.imageArrayIndex = (uint32_t) 0x76131ee0ac1b4e27;
+    item_views[3].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[3].next = nullptr;
+    item_views[3].pose.orientation.x = (float) 0x2ff023f28af70926;
+    item_views[3].pose.orientation.y = (float) 0xe2a5d94c29dd3293;
+    item_views[3].pose.orientation.z = (float) 0xdc19353b88731bd8;
+    item_views[3].pose.orientation.w = (float) 0x86f7c7788d7312b7;
+    item_views[3].pose.position.x = (float) 0x80fbbbf6f4e6480;
+    item_views[3].pose.position.y = (float) 0xae81dd56570801fd;
+    item_views[3].pose.position.z = (float) 0x57eb923b63d9fbde;
+    item_views[3].fov.angleLeft = (float) 0xefa08bbe8fb8aa94;
+    item_views[3].fov.angleRight = (float) 0x5e68e47d3a360a80;
+    item_views[3].fov.angleUp = (float) 0xa0af8f9b2b660425;
+    item_views[3].fov.angleDown = (float) 0x1b87c80b54d1a524;
+    item_views[3].subImage.swapchain = (XrSwapchain) 0xe6c9453ab320b9ba;
+    item_views[3].subImage.imageRect.offset.x = (int32_t) 0xdfdd4106d488f678;
+    item_views[3].subImage.imageRect.offset.y = (int32_t) 0xd7274a4fe47c6c36;
+    item_views[3].subImage.imageRect.extent.width = (int32_t) 0x9f52c1fa859f7740;
+    item_views[3].subImage.imageRect.extent.height = (int32_t) 0x21e227ff803ccd93;
+    item_views[3].subImage.imageArrayIndex = (uint32_t) 0xfb6105f5d4915011;
+    item_views[4].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[4].next = nullptr;
+    item_views[4].pose.orientation.x = (float) 0x7171e4311ada11c5;
+    item_views[4].pose.orientation.y = (float) 0xf32bb2351d4d0553;
+    item_views[4].pose.orientation.z = (float) 0xf2f69e47083ee461;
+    item_views[4].pose.orientation.w = (float) 0xbc91412547d80743;
+    item_views[4].pose.position.x = (float) 0x3a2c461a204f7631;
+    item_views[4].pose.position.y = (float) 0xe224a791bb6a3e42;
+    item_views[4].pose.position.z = (float) 0x8793b3dd18c43d4d;
+    item_views[4].fov.angleLeft = (float) 0xc1269c11448669bd;
+    item_views[4].fov.angleRight = (float) 0xa0d7af822afbbb59;
+    item_views[4].fov.angleUp = (float) 0x85a42902f6e76067;
+    item_views[4].fov.angleDown = (float) 0x6debc33d4052094e;
+    item_views[4].subImage.swapchain = (XrSwapchain) 0x7f9204174694b80d;
+    item_views[4].subImage.imageRect.offset.x = (int32_t) 0x6125140cb04e0bb2;
+    item_views[4].subImage.imageRect.offset.y = (int32_t) 0x86734008fd601ebb;
+    item_views[4].subImage.imageRect.extent.width = (int32_t) 0xd1b2aaaadc31fe28;
+    item_views[4].subImage.imageRect.extent.height = (int32_t) 0xd517bab6fcdc518c;
+    item_views[4].subImage.imageArrayIndex = (uint32_t) 0x839c3b9f21af5d00;
+    item_views[5].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[5].next = nullptr;
+    item_views[5].pose.orientation.x = (float) 0x50672caa9c72a7c6;
+    item_views[5].pose.orientation.y = (float) 0x13c2215bc0d07db3;
+    item_views[5].pose.orientation.z = (float) 0x9dcabc0e8c23efcb;
+    item_views[5].pose.orientation.w = (float) 0x44f694b7cc483681;
+    item_views[5].pose.position.x = (float) 0x3de92c0a5593065d;
+    item_views[5].pose.position.y = (float) 0x8695ed30a3f9cd3a;
+    item_views[5].pose.position.z = (float) 0xa020a0b2edf1d796;
+    item_views[5].fov.angleLeft = (float) 0x68dcdfbe95ddb5be;
+    item_views[5].fov.angleRight = (float) 0xbe467d4220a1cc9e;
+    item_views[5].fov.angleUp = (float) 0x5b4a4fd2f87ae1be;
+    item_views[5].fov.angleDown = (float) 0x345758b4e011047e;
+    item_views[5].subImage.swapchain = (XrSwapchain) 0xdd58aea88f0f5148;
+    item_views[5].subImage.imageRect.offset.x = (int32_t) 0xc93bef8c6f515db;
+    item_views[5].subImage.imageRect.offset.y = (int32_t) 0x686f0db53c51c04;
+    item_views[5].subImage.imageRect.extent.width = (int32_t) 0xe315b0241edabb27;
+    item_views[5].subImage.imageRect.extent.height = (int32_t) 0x5f83322e8e609516;
+    item_views[5].subImage.imageArrayIndex = (uint32_t) 0x3b877ff62bd73aa0;
+    item_views[6].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item_views[6].next = nullptr;
+    item_views[6].pose.orientation.x = (float) 0x9361af6d2fd47e9d;
+    item_views[6].pose.orientation.y = (float) 0xe08aace8ca6f51ea;
+    item_views[6].pose.orientation.z = (float) 0x49dcb94392cf4d40;
+    item_views[6].pose.orientation.w = (float) 0x947db96d6e1bd92;
+    item_views[6].pose.position.x = (float) 0x7bb55851466fe56d;
+    item_views[6].pose.position.y = (float) 0xcd38a4305140748b;
+    item_views[6].pose.position.z = (float) 0x7940801e20adb8eb;
+    item_views[6].fov.angleLeft = (float) 0xe7c0d13f56cdc867;
+    item_views[6].fov.angleRight = (float) 0x5882fa3961f1cd27;
+    item_views[6].fov.angleUp = (float) 0x11a2ed1ca23da1c5;
+    item_views[6].fov.angleDown = (float) 0xb8290749e9411c37;
+    item_views[6].subImage.swapchain = (XrSwapchain) 0x79ed5d84199dd9cb;
+    item_views[6].subImage.imageRect.offset.x = (int32_t) 0x58214fb0826cac45;
+    item_views[6].subImage.imageRect.offset.y = (int32_t) 0x73e41cc039005b80;
+    item_views[6].subImage.imageRect.extent.width = (int32_t) 0xe9efc8a5e21b9b9e;
+    item_views[6].subImage.imageRect.extent.height = (int32_t) 0x9f9b47f81e7fedfd;
+    item_views[6].subImage.imageArrayIndex = (uint32_t) 0x3ef1331453066531;
+    item.views = item_views;
+    return run_struct_benchmark("XrCompositionLayerProjection", item, iterations);
+}
+
+BenchmarkResult benchmark_XrCompositionLayerProjectionView(std::size_t iterations) {
+    XrCompositionLayerProjectionView item{};
+    item.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+    item.next = nullptr;
+    item.pose.orientation.x = (float) 0x8c68eecbccf346c0;
+    item.pose.orientation.y = (float) 0x7afc9c4651e3a008;
+    item.pose.orientation.z = (float) 0x63e43107fc0097;
+    item.pose.orientation.w = (float) 0x5aca122218e89bdb;
+    item.pose.position.x = (float) 0xa30fe24f95c2dd25;
+    item.pose.position.y = (float) 0x8d4c8f2124957228;
+    item.pose.position.z = (float) 0x42ee672ff88c0865;
+    item.fov.angleLeft = (float) 0xc39fd47f3b944bf2;
+    item.fov.angleRight = (float) 0xfad3b1cb883ab633;
+    item.fov.angleUp = (float) 0xec377a4a16119afb;
+    item.fov.angleDown = (float) 0x3eebfb786f5c3c24;
+    item.subImage.swapchain = (XrSwapchain) 0xb25eabec68f19bb1;
+    item.subImage.imageRect.offset.x = (int32_t) 0x8cf7ae383b830dab;
+    item.subImage.imageRect.offset.y = (int32_t) 0x2e96a4b4e11cf6ed;
+    item.subImage.imageRect.extent.width = (int32_t) 0x8a5c80cf52971429;
+    item.subImage.imageRect.extent.height = (int32_t) 0x16b57bcef13c9d21;
+    item.subImage.imageArrayIndex = (uint32_t) 0x2843bb3bfd923808;
+    return run_struct_benchmark("XrCompositionLayerProjectionView", item, iterations);
+}
+
+BenchmarkResult benchmark_XrCompositionLayerQuad(std::size_t iterations) {
+    XrCompositionLayerQuad item{};
+    item.type = XR_TYPE_COMPOSITION_LAYER_QUAD;
+    item.next = nullptr;
+    item.layerFlags = (XrCompositionLayerFlags) 0x3e95a6143224d140;
+    item.space = (XrSpace) 0xddb6d903bd410212;
+    item.eyeVisibility = (XrEyeVisibility) 0xaca1b687ad9fb79a;
+    item.subImage.swapchain = (XrSwapchain) 0x9ee4a085394013d2;
+    item.subImage.imageRect.offset.x = (int32_t) 0x5d35c9d4be0fd1b6;
+    item.subImage.imageRect.offset.y = (int32_t) 0x79d4dbf9d396aaa1;
+    item.subImage.imageRect.extent.width = (int32_t) 0xd5e2f69d09b36753;
+    item.subImage.imageRect.extent.height = (int32_t) 0xa3116e3dfb3ed68b;
+    item.subImage.imageArrayIndex = (uint32_t) 0xc460a3e382fd1922;
+    item.pose.orientation.x = (float) 0xc54d8b62dfb8f1ed;
+    item.pose.orientation.y = (float) 0x8ee64b5972f0c348;
+    item.pose.orientation.z = (float) 0xb55d0404688df26c;
+    item.pose.orientation.w = (float) 0xab675690026aa3aa;
+    item.pose.position.x = (float) 0xd3bdc641379bdb23;
+    item.pose.position.y = (float) 0xc2fc56f9e08f6d14;
+    item.pose.position.z = (float) 0x233a70967a674e42;
+    item.size.width = (float) 0x400b1743c1e4e283;
+    item.size.height = (float) 0x25f194e6d9ecbbe2;
+    return run_struct_benchmark("XrCompositionLayerQuad", item, iterations);
+}
+
+BenchmarkResult benchmark_XrEventDataBuffer(std::size_t iterations) {
+    XrEventDataBuffer item{};
+    item.type = XR_TYPE_EVENT_DATA_BUFFER;
+    item.next = nullptr;
+    for (int i = 0; i < 4000; i++) {
+        item.varying[i] = (uint8_t) 0x24ae0fa4dd036bfc;
+    }
+    return run_struct_benchmark("XrEventDataBuffer", item, iterations);
+}
+
+BenchmarkResult benchmark_XrEventDataEventsLost(std::size_t iterations) {
+    XrEventDataEventsLost item{};
+    item.type = XR_TYPE_EVENT_DATA_EVENTS_LOST;
+    item.next = nullptr;
+    item.lostEventCount = (uint32_t) 0x5bae2bc07ee2f4b0;
+    return run_struct_benchmark("XrEventDataEventsLost", item, iterations);
+}
+
+BenchmarkResult benchmark_XrEventDataInstanceLossPending(std::size_t iterations) {
+    XrEventDataInstanceLossPending item{};
+    item.type = XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING;
+    item.next = nullptr;
+    item.lossTime = (XrTime) 0xcb72e68021dcd919;
+    return run_struct_benchmark("XrEventDataInstanceLossPending", item, iterations);
+}
+
+BenchmarkResult benchmark_XrEventDataInteractionProfileChanged(std::size_t iterations) {
+    XrEventDataInteractionProfileChanged item{};
+    item.type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+    item.next = nullptr;
+    item.session = (XrSession) 0x96df8176039c666;
+    return run_struct_benchmark("XrEventDataInteractionProfileChanged", item, iterations);
+}
+
+BenchmarkResult benchmark_XrEventDataReferenceSpaceChangePending(std::size_t iterations) {
+    XrEventDataReferenceSpaceChangePending item{};
+    item.type = XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING;
+    item.next = nullptr;
+    item.session = (XrSession) 0xe65cdece8c8e5136;
+    item.referenceSpaceType = (XrReferenceSpaceType) 0xeeaaec1daf2d5177;
+    item.changeTime = (XrTime) 0xcfa56359465c1318;
+    item.poseValid = (XrBool32) 0x89d0ebd8363597d4;
+    item.poseInPreviousSpace.orientation.x = (float) 0xc6b0368ee0f6d664;
+    item.poseInPreviousSpace.orientation.y = (float) 0x66830c4899c19252;
+    item.poseInPreviousSpace.orientation.z = (float) 0x12a58aec13462d8c;
+    item.poseInPreviousSpace.orientation.w = (float) 0xd4054e83b9d7dcea;
+    item.poseInPreviousSpace.position.x = (float) 0x308308f2fd4bdd67;
+    item.poseInPreviousSpace.position.y = (float) 0xd6934af6aadc56b3;
+    item.poseInPreviousSpace.position.z = (float) 0xf8cdc33cb063deb9;
+    return run_struct_benchmark("XrEventDataReferenceSpaceChangePending", item, iterations);
+}
+
+BenchmarkResult benchmark_XrEventDataSessionStateChanged(std::size_t iterations) {
+    XrEventDataSessionStateChanged item{};
+    item.type = XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED;
+    item.next = nullptr;
+    item.session = (XrSession) 0xe9e0c6bf8930fbcb;
+    item.state = (XrSessionState) 0xef393b6b4260c75c;
+    item.time = (XrTime) 0x228a994edfadf0d1;
+    return run_struct_benchmark("XrEventDataSessionStateChanged", item, iterations);
+}
+
+BenchmarkResult benchmark_XrExtensionProperties(std::size_t iterations) {
+    XrExtensionProperties item{};
+    item.type = XR_TYPE_EXTENSION_PROPERTIES;
+    item.next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        item.extensionName[i] = 'g';
+    }
+    item.extensionVersion = (uint32_t) 0x775719496f39aa5e;
+    return run_struct_benchmark("XrExtensionProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrExtent2Df(std::size_t iterations) {
+    XrExtent2Df item{};
+    item.width = (float) 0x8851a402ec5f1de6;
+    item.height = (float) 0xcd547c56124bd059;
+    return run_struct_benchmark("XrExtent2Df", item, iterations);
+}
+
+BenchmarkResult benchmark_XrExtent2Di(std::size_t iterations) {
+    XrExtent2Di item{};
+    item.width = (int32_t) 0x6c8391b5e522cf9f;
+    item.height = (int32_t) 0x95a138c463826bd0;
+    return run_struct_benchmark("XrExtent2Di", item, iterations);
+}
+
+BenchmarkResult benchmark_XrExtent3Df(std::size_t iterations) {
+    XrExtent3Df item{};
+    item.width = (float) 0xe92088c7635be419;
+    item.height = (float) 0x6d9dec93a7978a24;
+    item.depth = (float) 0x847ce1f9a68832e5;
+    return run_struct_benchmark("XrExtent3Df", item, iterations);
+}
+
+BenchmarkResult benchmark_XrFovf(std::size_t iterations) {
+    XrFovf item{};
+    item.angleLeft = (float) 0x892ebb6ecbe44a5c;
+    item.angleRight = (float) 0x31d06448519878df;
+    item.angleUp = (float) 0x24cfd2b097eac62c;
+    item.angleDown = (float) 0x9e09bede71ced048;
+    return run_struct_benchmark("XrFovf", item, iterations);
+}
+
+BenchmarkResult benchmark_XrFrameBeginInfo(std::size_t iterations) {
+    XrFrameBeginInfo item{};
+    item.type = XR_TYPE_FRAME_BEGIN_INFO;
+    item.next = nullptr;
+    return run_struct_benchmark("XrFrameBeginInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrFrameState(std::size_t iterations) {
+    XrFrameState item{};
+    item.type = XR_TYPE_FRAME_STATE;
+    item.next = nullptr;
+    item.predictedDisplayTime = (XrTime) 0x8facec5d578fc7ef;
+    item.predictedDisplayPeriod = (XrDuration) 0xed01b3ca82557ac3;
+    item.shouldRender = (XrBool32) 0xef62f3116ea7cee4;
+    return run_struct_benchmark("XrFrameState", item, iterations);
+}
+
+BenchmarkResult benchmark_XrFrameWaitInfo(std::size_t iterations) {
+    XrFrameWaitInfo item{};
+    item.type = XR_TYPE_FRAME_WAIT_INFO;
+    item.next = nullptr;
+    return run_struct_benchmark("XrFrameWaitInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrFrustumf(std::size_t iterations) {
+    XrFrustumf item{};
+    item.pose.orientation.x = (float) 0x4e1808d1d9dc75fa;
+    item.pose.orientation.y = (float) 0x2ef92294fc489d9e;
+    item.pose.orientation.z = (float) 0xfe271c1224b3f212;
+    item.pose.orientation.w = (float) 0x4cc8b018367e99e4;
+    item.pose.position.x = (float) 0xefedabb18aecbed6;
+    item.pose.position.y = (float) 0xc4973fd06e3d1a10;
+    item.pose.position.z = (float) 0xc3213c90ec0ce939;
+    item.fov.angleLeft = (float) 0x2e5fc1a14674005d;
+    item.fov.angleRight = (float) 0x5c0589dddc363d97;
+    item.fov.angleUp = (float) 0xf4d25540ed584887;
+    item.fov.angleDown = (float) 0x68954848fecc5d18;
+    item.nearZ = (float) 0x6f13d0e31103696b;
+    item.farZ = (float) 0xd39a5284b5c33239;
+    return run_struct_benchmark("XrFrustumf", item, iterations);
+}
+
+BenchmarkResult benchmark_XrHapticActionInfo(std::size_t iterations) {
+    XrHapticActionInfo item{};
+    item.type = XR_TYPE_HAPTIC_ACTION_INFO;
+    item.next = nullptr;
+    item.action = (XrAction) 0x45231f77f348ce2e;
+    item.subactionPath = (XrPath) 0x57005440f91684f7;
+    return run_struct_benchmark("XrHapticActionInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrHapticVibration(std::size_t iterations) {
+    XrHapticVibration item{};
+    item.type = XR_TYPE_HAPTIC_VIBRATION;
+    item.next = nullptr;
+    item.duration = (XrDuration) 0x48a8c43fb8d550a7;
+    item.frequency = (float) 0x5fcca9a9cb65130d;
+    item.amplitude = (float) 0x438a9720ffff5c69;
+    return run_struct_benchmark("XrHapticVibration", item, iterations);
+}
+
+BenchmarkResult benchmark_XrInputSourceLocalizedNameGetInfo(std::size_t iterations) {
+    XrInputSourceLocalizedNameGetInfo item{};
+    item.type = XR_TYPE_INPUT_SOURCE_LOCALIZED_NAME_GET_INFO;
+    item.next = nullptr;
+    item.sourcePath = (XrPath) 0xe97a6f9e9c5fffed;
+    item.whichComponents = (XrInputSourceLocalizedNameFlags) 0x636a354a379922e0;
+    return run_struct_benchmark("XrInputSourceLocalizedNameGetInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrInstanceProperties(std::size_t iterations) {
+    XrInstanceProperties item{};
+    item.type = XR_TYPE_INSTANCE_PROPERTIES;
+    item.next = nullptr;
+    item.runtimeVersion = (XrVersion) 0x93f0164ee758f281;
+    for (int i = 0; i < XR_MAX_RUNTIME_NAME_SIZE; i++) {
+        item.runtimeName[i] = 'B';
+    }
+    return run_struct_benchmark("XrInstanceProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrInteractionProfileState(std::size_t iterations) {
+    XrInteractionProfileState item{};
+    item.type = XR_TYPE_INTERACTION_PROFILE_STATE;
+    item.next = nullptr;
+    item.interactionProfile = (XrPath) 0xbbe69b7f99e0eaa5;
+    return run_struct_benchmark("XrInteractionProfileState", item, iterations);
+}
+
+BenchmarkResult benchmark_XrInteractionProfileSuggestedBinding(std::size_t iterations) {
+    XrInteractionProfileSuggestedBinding item{};
+    item.type = XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING;
+    item.next = nullptr;
+    item.interactionProfile = (XrPath) 0x4f35e867c648cc2e;
+    item.countSuggestedBindings = 16;
+    XrActionSuggestedBinding item_suggestedBindings[16]{};
+    item_suggestedBindings[0].action = (XrAction) 0x496aa4c6406f5f56;
+    item_suggestedBindings[0].binding = (XrPath) 0xaf26cf413d9394df;
+    item_suggestedBindings[1].action = (XrAction) 0x886284effb635cbf;
+    item_suggestedBindings[1].binding = (XrPath) 0xb1e1adc831c8d567;
+    item_suggestedBindings[2].action = (XrAction) 0xd586a807f1733b9c;
+    item_suggestedBindings[2].binding = (XrPath) 0x21b6c307c2c43eed;
+    item_suggestedBindings[3].action = (XrAction) 0xb3fdba7b7c370b5;
+    item_suggestedBindings[3].binding = (XrPath) 0x28c32e2f5a0a9555;
+    item_suggestedBindings[4].action = (XrAction) 0x4a9e6bfb72dcd619;
+    item_suggestedBindings[4].binding = (XrPath) 0x7a08f3151c1fce7f;
+    item_suggestedBindings[5].action = (XrAction) 0x812e4d40788fde12;
+    item_suggestedBindings[5].binding = (XrPath) 0xa95a3552f7b33c8c;
+    item_suggestedBindings[6].action = (XrAction) 0x58b45fa89521d4d4;
+    item_suggestedBindings[6].binding = (XrPath) 0x59d92885c4dd775;
+    item_suggestedBindings[7].action = (XrAction) 0xf5a0a5e9f8f60dd1;
+    item_suggestedBindings[7].binding = (XrPath) 0xb41114c2ca71b569;
+    item_suggestedBindings[8].action = (XrAction) 0x1669a8fb6a306ab5;
+    item_suggestedBindings[8].binding = (XrPath) 0x338afc92f4d7ee4c;
+    item_suggestedBindings[9].action = (XrAction) 0xace11d92d4d815d9;
+    item_suggestedBindings[9].binding = (XrPath) 0xbe9bbfab8096e509;
+    item_suggestedBindings[10].action = (XrAction) 0x5499431666b49b50;
+    item_suggestedBindings[10].binding = (XrPath) 0xe76b556ab47c99dd;
+    item_suggestedBindings[11].action = (XrAction) 0xcb6d5d9e0ab5c399;
+    item_suggestedBindings[11].binding = (XrPath) 0xb012aac2c3b0cf6;
+    item_suggestedBindings[12].action = (XrAction) 0xde50a78a20049a49;
+    item_suggestedBindings[12].binding = (XrPath) 0xb1ca4fdc21a9d57;
+    item_suggestedBindings[13].action = (XrAction) 0xdfc2259c8ad9bbf6;
+    item_suggestedBindings[13].binding = (XrPath) 0x2f9b19952513e524;
+    item_suggestedBindings[14].action = (XrAction) 0x2940ae763d828026;
+    item_suggestedBindings[14].binding = (XrPath) 0xc6c12b0d7d6b0f01;
+    item_suggestedBindings[15].action = (XrAction) 0x28dc08913e17dec2;
+    item_suggestedBindings[15].binding = (XrPath) 0x600e8ac6b6564872;
+    item.suggestedBindings = item_suggestedBindings;
+    return run_struct_benchmark("XrInteractionProfileSuggestedBinding", item, iterations);
+}
+
+BenchmarkResult benchmark_XrOffset2Df(std::size_t iterations) {
+    XrOffset2Df item{};
+    item.x = (float) 0xece0aea05ce5e2ae;
+    item.y = (float) 0xfe0ffb6c630eb07d;
+    return run_struct_benchmark("XrOffset2Df", item, iterations);
+}
+
+BenchmarkResult benchmark_XrOffset2Di(std::size_t iterations) {
+    XrOffset2Di item{};
+    item.x = (int32_t) 0x9b0266d4b244b2dd;
+    item.y = (int32_t) 0x1b9f295666816b94;
+    return run_struct_benchmark("XrOffset2Di", item, iterations);
+}
+
+BenchmarkResult benchmark_XrPosef(std::size_t iterations) {
+    XrPosef item{};
+    item.orientation.x = (float) 0x46122f6fe22c6092;
+    item.orientation.y = (float) 0xb3f5dc168d9e4ba5;
+    item.orientation.z = (float) 0xd49a655e20442db8;
+    item.orientation.w = (float) 0x12c8b52407c541b9;
+    item.position.x = (float) 0xfa73bae1bd28771a;
+    item.position.y = (float) 0x94a441d10ec1cac2;
+    item.position.z = (float) 0x874123ab35989247;
+    return run_struct_benchmark("XrPosef", item, iterations);
+}
+
+BenchmarkResult benchmark_XrQuaternionf(std::size_t iterations) {
+    XrQuaternionf item{};
+    item.x = (float) 0x6f775aa1867c22b;
+    item.y = (float) 0x5e303e9220e33172;
+    item.z = (float) 0x706828af183dd88b;
+    item.w = (float) 0x5844c8cd02eaa179;
+    return run_struct_benchmark("XrQuaternionf", item, iterations);
+}
+
+BenchmarkResult benchmark_XrRect2Df(std::size_t iterations) {
+    XrRect2Df item{};
+    item.offset.x = (float) 0xa4b5103604793a7;
+    item.offset.y = (float) 0x28064b9470eff3d9;
+    item.extent.width = (float) 0xa05a9bcd283be368;
+    item.extent.height = (float) 0x4e07b0b416e42571;
+    return run_struct_benchmark("XrRect2Df", item, iterations);
+}
+
+BenchmarkResult benchmark_XrRect2Di(std::size_t iterations) {
+    XrRect2Di item{};
+    item.offset.x = (int32_t) 0x88511a5788ba4f47;
+    item.offset.y = (int32_t) 0xb596cfe903737c78;
+    item.extent.width = (int32_t) 0x943eaa034ab01a18;
+    item.extent.height = (int32_t) 0xb893fe86af57b6d9;
+    return run_struct_benchmark("XrRect2Di", item, iterations);
+}
+
+BenchmarkResult benchmark_XrReferenceSpaceCreateInfo(std::size_t iterations) {
+    XrReferenceSpaceCreateInfo item{};
+    item.type = XR_TYPE_REFERENCE_SPACE_CREATE_INFO;
+    item.next = nullptr;
+    item.referenceSpaceType = (XrReferenceSpaceType) 0x90598927cd2afb76;
+    item.poseInReferenceSpace.orientation.x = (float) 0x5a8bb9d5d8edc852;
+    item.poseInReferenceSpace.orientation.y = (float) 0x730e5ba55af63336;
+    item.poseInReferenceSpace.orientation.z = (float) 0xddc7cbd988dea3bd;
+    item.poseInReferenceSpace.orientation.w = (float) 0x4fe0133a4161e13d;
+    item.poseInReferenceSpace.position.x = (float) 0xc12422512500c887;
+    item.poseInReferenceSpace.position.y = (float) 0x1db74666cc4f8cc0;
+    item.poseInReferenceSpace.position.z = (float) 0x8dc386cd5baebc7f;
+    return run_struct_benchmark("XrReferenceSpaceCreateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSessionActionSetsAttachInfo(std::size_t iterations) {
+    XrSessionActionSetsAttachInfo item{};
+    item.type = XR_TYPE_SESSION_ACTION_SETS_ATTACH_INFO;
+    item.next = nullptr;
+    item.countActionSets = 9;
+    XrActionSet item_actionSets[9]{};
+    item_actionSets[0] = (XrActionSet) 0x3de32939bd874830;
+    item_actionSets[1] = (XrActionSet) 0xbe9fed6a893c6abd;
+    item_actionSets[2] = (XrActionSet) 0xd37866a7ee0f427c;
+    item_actionSets[3] = (XrActionSet) 0xeb5e5adf6091be20;
+    item_actionSets[4] = (XrActionSet) 0xad05c84fdecb9837;
+    item_actionSets[5] = (XrActionSet) 0x58ce1205ab7ace5d;
+    item_actionSets[6] = (XrActionSet) 0x12cc49177cb33592;
+    item_actionSets[7] = (XrActionSet) 0x379fb571617831c0;
+    item_actionSets[8] = (XrActionSet) 0x85b9953a5ba42937;
+    item.actionSets = item_actionSets;
+    return run_struct_benchmark("XrSessionActionSetsAttachInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSessionBeginInfo(std::size_t iterations) {
+    XrSessionBeginInfo item{};
+    item.type = XR_TYPE_SESSION_BEGIN_INFO;
+    item.next = nullptr;
+    item.primaryViewConfigurationType = (XrViewConfigurationType) 0x749f03afee512d3;
+    return run_struct_benchmark("XrSessionBeginInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSessionCreateInfo(std::size_t iterations) {
+    XrSessionCreateInfo item{};
+    item.type = XR_TYPE_SESSION_CREATE_INFO;
+    item.next = nullptr;
+    item.createFlags = (XrSessionCreateFlags) 0xf0a1a9d65f1507b5;
+    item.systemId = (XrSystemId) 0xb10f6b570ae99901;
+    return run_struct_benchmark("XrSessionCreateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpaceLocation(std::size_t iterations) {
+    XrSpaceLocation item{};
+    item.type = XR_TYPE_SPACE_LOCATION;
+    item.next = nullptr;
+    item.locationFlags = (XrSpaceLocationFlags) 0x36126c97ee85accb;
+    item.pose.orientation.x = (float) 0xfbf7b48f3a1c17e8;
+    item.pose.orientation.y = (float) 0xe2a76905d2f3f60b;
+    item.pose.orientation.z = (float) 0x503da7816ed2fdfd;
+    item.pose.orientation.w = (float) 0x1e4c8e3d03689a14;
+    item.pose.position.x = (float) 0x62aafc460845aad9;
+    item.pose.position.y = (float) 0xede1223caec11060;
+    item.pose.position.z = (float) 0xf3f2bb6546df9fc4;
+    return run_struct_benchmark("XrSpaceLocation", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpaceLocationData(std::size_t iterations) {
+    XrSpaceLocationData item{};
+    item.locationFlags = (XrSpaceLocationFlags) 0xca73f38dc9f46b22;
+    item.pose.orientation.x = (float) 0x17437d6ad24b913e;
+    item.pose.orientation.y = (float) 0xf2291f6330dbc46f;
+    item.pose.orientation.z = (float) 0x8d2f55711f037e6b;
+    item.pose.orientation.w = (float) 0xcdf532c60d60e862;
+    item.pose.position.x = (float) 0x26b429801aca71c0;
+    item.pose.position.y = (float) 0xef176c83d6a9a0c5;
+    item.pose.position.z = (float) 0xa98eeec8f091a0d1;
+    return run_struct_benchmark("XrSpaceLocationData", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpaceLocations(std::size_t iterations) {
+    XrSpaceLocations item{};
+    item.type = XR_TYPE_SPACE_LOCATIONS;
+    item.next = nullptr;
+    item.locationCount = 3;
+    XrSpaceLocationData item_locations[3]{};
+    item_locations[0].locationFlags = (XrSpaceLocationFlags) 0xd7bd14d4f333d91a;
+    item_locations[0].pose.orientation.x = (float) 0xf9953845c1fd45c6;
+    item_locations[0].pose.orientation.y = (float) 0x30576f66f79ca8b7;
+    item_locations[0].pose.orientation.z = (float) 0x453e2c393d2541fe;
+    item_locations[0].pose.orientation.w = (float) 0x7d109613e4d825eb;
+    item_locations[0].pose.position.x = (float) 0xe839c8edf58efb4f;
+    item_locations[0].pose.position.y = (float) 0x2793ac5129dfb391;
+    item_locations[0].pose.position.z = (float) 0x223d252019111482;
+    item_locations[1].locationFlags = (XrSpaceLocationFlags) 0x2820be6d14ef3eed;
+    item_locations[1].pose.orientation.x = (float) 0x749e8082db34037d;
+    item_locations[1].pose.orientation.y = (float) 0x7908954c116872d7;
+    item_locations[1].pose.orientation.z = (float) 0xadd719e0fcc2d11a;
+    item_locations[1].pose.orientation.w = (float) 0x733a6d166691b51d;
+    item_locations[1].pose.position.x = (float) 0x13d464b523eea6f2;
+    item_locations[1].pose.position.y = (float) 0x6066181bb1931f84;
+    item_locations[1].pose.position.z = (float) 0x3b70f0c50ccf856f;
+    item_locations[2].locationFlags = (XrSpaceLocationFlags) 0xb772ea9e17274e4c;
+    item_locations[2].pose.orientation.x = (float) 0xa7fc99f0b881eae2;
+    item_locations[2].pose.orientation.y = (float) 0xff546a0085041459;
+    item_locations[2].pose.orientation.z = (float) 0xf89089527a4d564f;
+    item_locations[2].pose.orientation.w = (float) 0x2e3e96e5fd9238f2;
+    item_locations[2].pose.position.x = (float) 0xedb152c54ddd393c;
+    item_locations[2].pose.position.y = (float) 0xce6e56359f1853e3;
+    item_locations[2].pose.position.z = (float) 0x7c3d809119186f7c;
+    item.locations = item_locations;
+    return run_struct_benchmark("XrSpaceLocations", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpaceVelocities(std::size_t iterations) {
+    XrSpaceVelocities item{};
+    item.type = XR_TYPE_SPACE_VELOCITIES;
+    item.next = nullptr;
+    item.velocityCount = 18;
+    XrSpaceVelocityData item_velocities[18]{};
+    item_velocities[0].velocityFlags = (XrSpaceVelocityFlags) 0x52c8e5a9f744350;
+    item_velocities[0].linearVelocity.x = (float) 0xaf980508cf323ed7;
+    item_velocities[0].linearVelocity.y = (float) 0x1ca728140d865554;
+    item_velocities[0].linearVelocity.z = (float) 0xcc391141b61bc9b7;
+    item_velocities[0].angularVelocity.x = (float) 0x868789088811750;
+    item_velocities[0].angularVelocity.y = (float) 0x2eedd22f855472bd;
+    item_velocities[0].angularVelocity.z = (float) 0x40a6821d1b5e6eaf;
+    item_velocities[1].velocityFlags = (XrSpaceVelocityFlags) 0x4060ad557ba6dcc7;
+    item_velocities[1].linearVelocity.x = (float) 0x8ed7a6d15a4fa3d6;
+    item_velocities[1].linearVelocity.y = (float) 0xe4c22136dea54db1;
+    item_velocities[1].linearVelocity.z = (float) 0xb79594333ba08780;
+    item_velocities[1].angularVelocity.x = (float) 0xa2f07e72778e7945;
+    item_velocities[1].angularVelocity.y = (float) 0x1ff9e7a290990e5b;
+    item_velocities[1].angularVelocity.z = (float) 0xd43e742cfb98af56;
+    item_velocities[2].velocityFlags = (XrSpaceVelocityFlags) 0xea9cf24ef8fc5d20;
+    item_velocities[2].linearVelocity.x = (float) 0xf35d7d993b6f52db;
+    item_velocities[2].linearVelocity.y = (float) 0x23547fce18b75fc;
+    item_velocities[2].linearVelocity.z = (float) 0xeb712ce033b3be4a;
+    item_velocities[2].angularVelocity.x = (float) 0x7244088a57ed017f;
+    item_velocities[2].angularVelocity.y = (float) 0x2792e879e3734beb;
+    item_velocities[2].angularVelocity.z = (float) 0xe4a58d9d2f7c410d;
+    item_velocities[3].velocityFlags = (XrSpaceVelocityFlags) 0x995154bf5005ac77;
+    item_velocities[3].linearVelocity.x = (float) 0x829c4672c2edfa4a;
+    item_velocities[3].linearVelocity.y = (float) 0x5063e85052bf7575;
+    item_velocities[3].linearVelocity.z = (float) 0x43994a3deaf57b4d;
+    item_velocities[3].angularVelocity.x = (float) 0x762f6885faf1f16f;
+    item_velocities[3].angularVelocity.y = (float) 0x91de864a8af4bfaa;
+    item_velocities[3].angularVelocity.z = (float) 0x9cf6b84cf1b40a23;
+    item_velocities[4].velocityFlags = (XrSpaceVelocityFlags) 0x53bd155109998083;
+    item_velocities[4].linearVelocity.x = (float) 0x8c40190ad369b0fd;
+    item_velocities[4].linearVelocity.y = (float) 0x21f39069aeba7d07;
+    item_velocities[4].linearVelocity.z = (float) 0xd295dedb505c55da;
+    item_velocities[4].angularVelocity.x = (float) 0xf7400c331c535a50;
+    item_velocities[4].angularVelocity.y = (float) 0x4ab7a52825208a3a;
+    item_velocities[4].angularVelocity.z = (float) 0xc13794bb841d3ff8;
+    item_velocities[5].velocityFlags = (XrSpaceVelocityFlags) 0x716dab579c5965a4;
+    item_velocities[5].linearVelocity.x = (float) 0x247a40284027671d;
+    item_velocities[5].linearVelocity.y = (float) 0x96b45018e33a1e;
+    item_velocities[5].linearVelocity.z = (float) 0xc4bccbf02a3d4a8;
+    item_velocities[5].angularVelocity.x = (float) 0x798077e5131b43e9;
+    item_velocities[5].angularVelocity.y = (float) 0x69073f6aafabd6cf;
+    item_velocities[5].angularVelocity.z = (float) 0x9034a0beb68facbc;
+    item_velocities[6].velocityFlags = (XrSpaceVelocityFlags) 0xbe016784fa9ee04d;
+    item_velocities[6].linearVelocity.x = (float) 0x5d806b4d1e00a4b9;
+    item_velocities[6].linearVelocity.y = (float) 0xbb56008191ef7679;
+    item_velocities[6].linearVelocity.z = (float) 0x61b6d56fda0b8e9b;
+    item_velocities[6].angularVelocity.x = (float) 0x97fc751862dbbc60;
+    item_velocities[6].angularVelocity.y = (float) 0xc884030b0e568958;
+    item_velocities[6].angularVelocity.z = (float) 0xd2713fce6c0f9238;
+    item_velocities[7].velocityFlags = (XrSpaceVelocityFlags) 0xa552c78993458dba;
+    item_velocities[7].linearVelocity.x = (float) 0xe6366ad447fa5095;
+    item_velocities[7].linearVelocity.y = (float) 0x95c7741eef852311;
+    item_velocities[7].linearVelocity.z = (float) 0x120b952e9f6aa2d6;
+    item_velocities[7].angularVelocity.x = (float) 0x824c893fb591f251;
+    item_velocities[7].angularVelocity.y = (float) 0xd9d60a681cb95bae;
+    item_velocities[7].angularVelocity.z = (float) 0x64b0f336903c49b9;
+    item_velocities[8].velocityFlags = (XrSpaceVelocityFlags) 0x6954839bde981ab8;
+    item_velocities[8].linearVelocity.x = (float) 0x30e3614ed663ab54;
+    item_velocities[8].linearVelocity.y = (float) 0x9dd46ae3e320ddc;
+    item_velocities[8].linearVelocity.z = (float) 0xc3b204c99fa1dcf0;
+    item_velocities[8].angularVelocity.x = (float) 0x8e4f5c25c41fbe4c;
+    item_velocities[8].angularVelocity.y = (float) 0xf0e6da602ffdf5e7;
+    item_velocities[8].angularVelocity.z = (float) 0x145bbbd9454bf871;
+    item_velocities[9].velocityFlags = (XrSpaceVelocityFlags) 0x15f696a352f76cd4;
+    item_velocities[9].linearVelocity.x = (float) 0x9d6d42ed2188ceba;
+    item_velocities[9].linearVelocity.y = (float) 0xe189fa829657913;
+    item_velocities[9].linearVelocity.z = (float) 0xd24f3b8dc476ec17;
+    item_velocities[9].angularVelocity.x = (float) 0x7ed326319bf0973d;
+    item_velocities[9].angularVelocity.y = (float) 0x879ca2bee306e38b;
+    item_velocities[9].angularVelocity.z = (float) 0xae64208b1701bfa8;
+    item_velocities[10].velocityFlags = (XrSpaceVelocityFlags) 0x56d98e7d1bc972ca;
+    item_velocities[10].linearVelocity.x = (float) 0x37f52542983eccc4;
+    item_velocities[10].linearVelocity.y = (float) 0x1d7244c251ac0f2d;
+    item_velocities[10].linearVelocity.z = (float) 0x383df2d9844480ed;
+    item_velocities[10].angularVelocity.x = (float) 0xba6b5bcc99862e9f;
+    item_velocities[10].angularVelocity.y = (float) 0xb576030b8ff67b16;
+    item_velocities[10].angularVelocity.z = (float) 0x97edb41850fa21d5;
+    item_velocities[11].velocityFlags = (XrSpaceVelocityFlags) 0xe899f985b0a03a75;
+    item_velocities[11].linearVelocity.x = (float) 0x9b77875296193300;
+    item_velocities[11].linearVelocity.y = (float) 0x8a300fa1604caaa3;
+    item_velocities[11].linearVelocity.z = (float) 0x2728b9b6a05847e0;
+    item_velocities[11].angularVelocity.x = (float) 0xd535719573ac1559;
+    item_velocities[11].angularVelocity.y = (float) 0x40fe8795b47cf4dd;
+    item_velocities[11].angularVelocity.z = (float) 0x20f6961f8707cda1;
+    item_velocities[12].velocityFlags = (XrSpaceVelocityFlags) 0x317d6cf1b3c2e6c8;
+    item_velocities[12].linearVelocity.x = (float) 0xd0cd9c559aea1895;
+    item_velocities[12].linearVelocity.y = (float) 0x1719a872d466044b;
+    item_velocities[12].linearVelocity.z = (float) 0xeba63c104f9a970d;
+    item_velocities[12].angularVelocity.x = (float) 0xe2f1eb0e5248cd2c;
+    item_velocities[12].angularVelocity.y = (float) 0xd1cdcd0e830fedcb;
+    item_velocities[12].angularVelocity.z = (float) 0x2d2ec5f5c3dd714e;
+    item_velocities[13].velocityFlags = (XrSpaceVelocityFlags) 0xe83a7c7d96967cc9;
+    item_velocities[13].linearVelocity.x = (float) 0x6a753a6e70a83b2e;
+    item_velocities[13].linearVelocity.y = (float) 0xcb1e54f5c786b6aa;
+    item_velocities[13].linearVelocity.z = (float) 0xbcd95025d6c360e;
+    item_velocities[13].angularVelocity.x = (float) 0x7b48cc17e6de39d;
+    item_velocities[13].angularVelocity.y = (float) 0x538428f71ef83f7;
+    item_velocities[13].angularVelocity.z = (float) 0xfbff40331cedbe90;
+    item_velocities[14].velocityFlags = (XrSpaceVelocityFlags) 0xe1c0ded2468a5cd6;
+    item_velocities[14].linearVelocity.x = (float) 0x9672cd694b056557;
+    item_velocities[14].linearVelocity.y = (float) 0xb5e697741ec9f7f;
+    item_velocities[14].linearVelocity.z = (float) 0x14c7af573cb32000;
+    item_velocities[14].angularVelocity.x = (float) 0x21c89ef47bf8285d;
+    item_velocities[14].angularVelocity.y = (float) 0xfe8747c302a1d609;
+    item_velocities[14].angularVelocity.z = (float) 0xd9405c252380886b;
+    item_velocities[15].velocityFlags = (XrSpaceVelocityFlags) 0x511cb2f4b955e750;
+    item_velocities[15].linearVelocity.x = (float) 0x815370102085d385;
+    item_velocities[15].linearVelocity.y = (float) 0x97a1a37d380be8a8;
+    item_velocities[15].linearVelocity.z = (float) 0x96cd8b94d3abe3a;
+    item_velocities[15].angularVelocity.x = (float) 0x85e39b3e48cc3ae9;
+    item_velocities[15].angularVelocity.y = (float) 0xce82c50ba32b2ca1;
+    item_velocities[15].angularVelocity.z = (float) 0x354f3a6df04a3a5a;
+    item_velocities[16].velocityFlags = (XrSpaceVelocityFlags) 0x307e3b4ad725b8a0;
+    item_velocities[16].linearVelocity.x = (float) 0x2efaf3460ebec6a5;
+    item_velocities[16].linearVelocity.y = (float) 0xc12354520f8f4333;
+    item_velocities[16].linearVelocity.z = (float) 0x2d4826b5e5b13994;
+    item_velocities[16].angularVelocity.x = (float) 0x82700d6f6a986873;
+    item_velocities[16].angularVelocity.y = (float) 0x65008aa2a544eb82;
+    item_velocities[16].angularVelocity.z = (float) 0xe2cb9fe9b413f8fd;
+    item_velocities[17].velocityFlags = (XrSpaceVelocityFlags) 0xecf46ed8000d390f;
+    item_velocities[17].linearVelocity.x = (float) 0xe5faf5b0cf63b9f9;
+    item_velocities[17].linearVelocity.y = (float) 0x9c519b65ca159541;
+    item_velocities[17].linearVelocity.z = (float) 0x9786cf09200785f0;
+    item_velocities[17].angularVelocity.x = (float) 0x6f12a46139ad8263;
+    item_velocities[17].angularVelocity.y = (float) 0x1aeb8a682728a3a5;
+    item_velocities[17].angularVelocity.z = (float) 0x2da573d0f907e529;
+    item.velocities = item_velocities;
+    return run_struct_benchmark("XrSpaceVelocities", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpaceVelocity(std::size_t iterations) {
+    XrSpaceVelocity item{};
+    item.type = XR_TYPE_SPACE_VELOCITY;
+    item.next = nullptr;
+    item.velocityFlags = (XrSpaceVelocityFlags) 0xfb475f5567485469;
+    item.linearVelocity.x = (float) 0xbafec212b292a9bd;
+    item.linearVelocity.y = (float) 0x96921ebe46d4dd33;
+    item.linearVelocity.z = (float) 0x5bcb3425d150cfa7;
+    item.angularVelocity.x = (float) 0xa209e47b000ad3fb;
+    item.angularVelocity.y = (float) 0x19ced7170499e94;
+    item.angularVelocity.z = (float) 0xe435bc7fab9f16e7;
+    return run_struct_benchmark("XrSpaceVelocity", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpaceVelocityData(std::size_t iterations) {
+    XrSpaceVelocityData item{};
+    item.velocityFlags = (XrSpaceVelocityFlags) 0x1098f0ddd90a87df;
+    item.linearVelocity.x = (float) 0xdf13872fe069c162;
+    item.linearVelocity.y = (float) 0xa974c09df16cd92f;
+    item.linearVelocity.z = (float) 0xe3dd32dd4d187e50;
+    item.angularVelocity.x = (float) 0xa0d4f3dc6d5f31a5;
+    item.angularVelocity.y = (float) 0x5d035206f5d1347d;
+    item.angularVelocity.z = (float) 0x5ecb516880284193;
+    return run_struct_benchmark("XrSpaceVelocityData", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpacesLocateInfo(std::size_t iterations) {
+    XrSpacesLocateInfo item{};
+    item.type = XR_TYPE_SPACES_LOCATE_INFO;
+    item.next = nullptr;
+    item.baseSpace = (XrSpace) 0xa890fe220a5679e6;
+    item.time = (XrTime) 0x216ca887190e7268;
+    item.spaceCount = 3;
+    XrSpace item_spaces[3]{};
+    item_spaces[0] = (XrSpace) 0x5310e7f13a566549;
+    item_spaces[1] = (XrSpace) 0xe649e7a144d7f1ae;
+    item_spaces[2] = (XrSpace) 0x464f2386109ecdfe;
+    item.spaces = item_spaces;
+    return run_struct_benchmark("XrSpacesLocateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSpheref(std::size_t iterations) {
+    XrSpheref item{};
+    item.center.orientation.x = (float) 0xd4851a802fa798c6;
+    item.center.orientation.y = (float) 0x8d00a60d9134de2c;
+    item.center.orientation.z = (float) 0x6dbd6ea15a6e97d7;
+    item.center.orientation.w = (float) 0x18ab88d9d2082d18;
+    item.center.position.x = (float) 0x7cc5494c51862621;
+    item.center.position.y = (float) 0xcf5da06ee5d59b8b;
+    item.center.position.z = (float) 0xb54d1686a00fc279;
+    item.radius = (float) 0x1215291a78f0c17a;
+    return run_struct_benchmark("XrSpheref", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSwapchainCreateInfo(std::size_t iterations) {
+    XrSwapchainCreateInfo item{};
+    item.type = XR_TYPE_SWAPCHAIN_CREATE_INFO;
+    item.next = nullptr;
+    item.createFlags = (XrSwapchainCreateFlags) 0xfef015fcde40e7b3;
+    item.usageFlags = (XrSwapchainUsageFlags) 0x195a2d43ecdb8197;
+    item.format = (int64_t) 0x402fbe35cf1844de;
+    item.sampleCount = (uint32_t) 0xf3ed8d643a828a6c;
+    item.width = (uint32_t) 0x2f1fa9ad77a617ca;
+    item.height = (uint32_t) 0x8582e262a7eb2f51;
+    item.faceCount = (uint32_t) 0x9f86d63e36362291;
+    item.arraySize = (uint32_t) 0x17cd4929ae070dba;
+    item.mipCount = (uint32_t) 0xfef83cc86b831116;
+    return run_struct_benchmark("XrSwapchainCreateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSwapchainImageAcquireInfo(std::size_t iterations) {
+    XrSwapchainImageAcquireInfo item{};
+    item.type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
+    item.next = nullptr;
+    return run_struct_benchmark("XrSwapchainImageAcquireInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSwapchainImageReleaseInfo(std::size_t iterations) {
+    XrSwapchainImageReleaseInfo item{};
+    item.type = XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO;
+    item.next = nullptr;
+    return run_struct_benchmark("XrSwapchainImageReleaseInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSwapchainImageWaitInfo(std::size_t iterations) {
+    XrSwapchainImageWaitInfo item{};
+    item.type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+    item.next = nullptr;
+    item.timeout = (XrDuration) 0xc37107f96b19d1fc;
+    return run_struct_benchmark("XrSwapchainImageWaitInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSwapchainSubImage(std::size_t iterations) {
+    XrSwapchainSubImage item{};
+    item.swapchain = (XrSwapchain) 0xd0dcb1018c49475f;
+    item.imageRect.offset.x = (int32_t) 0x6ba9ec8ff1ce3ba;
+    item.imageRect.offset.y = (int32_t) 0x74af99fe62cdf756;
+    item.imageRect.extent.width = (int32_t) 0x5949995bad61e038;
+    item.imageRect.extent.height = (int32_t) 0xf0e637daad4b1588;
+    item.imageArrayIndex = (uint32_t) 0x6a2824daf67eb026;
+    return run_struct_benchmark("XrSwapchainSubImage", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSystemGetInfo(std::size_t iterations) {
+    XrSystemGetInfo item{};
+    item.type = XR_TYPE_SYSTEM_GET_INFO;
+    item.next = nullptr;
+    item.formFactor = (XrFormFactor) 0x83d472ee97d9a017;
+    return run_struct_benchmark("XrSystemGetInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSystemGraphicsProperties(std::size_t iterations) {
+    XrSystemGraphicsProperties item{};
+    item.maxSwapchainImageHeight = (uint32_t) 0xbbf5b0447bcecf93;
+    item.maxSwapchainImageWidth = (uint32_t) 0x241e5b3df37cf896;
+    item.maxLayerCount = (uint32_t) 0xfcd0b25f9f0810ae;
+    return run_struct_benchmark("XrSystemGraphicsProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSystemProperties(std::size_t iterations) {
+    XrSystemProperties item{};
+    item.type = XR_TYPE_SYSTEM_PROPERTIES;
+    item.next = nullptr;
+    item.systemId = (XrSystemId) 0xe48e7cd2aef6f781;
+    item.vendorId = (uint32_t) 0xc4b14ec38bca54db;
+    for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+        item.systemName[i] = 'X';
+    }
+    item.graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0xf192b9930e61aa2b;
+    item.graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0xac58e4ec2ff65d5a;
+    item.graphicsProperties.maxLayerCount = (uint32_t) 0x8f8a24cebeeb31f1;
+    item.trackingProperties.orientationTracking = (XrBool32) 0xabaff16af62d7736;
+    item.trackingProperties.positionTracking = (XrBool32) 0xdabdcf858a4a856e;
+    return run_struct_benchmark("XrSystemProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrSystemTrackingProperties(std::size_t iterations) {
+    XrSystemTrackingProperties item{};
+    item.orientationTracking = (XrBool32) 0xaa72ffbb9ed20b93;
+    item.positionTracking = (XrBool32) 0x644e81d6a8309dc6;
+    return run_struct_benchmark("XrSystemTrackingProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrUuid(std::size_t iterations) {
+    XrUuid item{};
+    for (int i = 0; i < XR_UUID_SIZE; i++) {
+        item.data[i] = (uint8_t) 0xb42f7bf190d05835;
+    }
+    return run_struct_benchmark("XrUuid", item, iterations);
+}
+
+BenchmarkResult benchmark_XrVector2f(std::size_t iterations) {
+    XrVector2f item{};
+    item.x = (float) 0xc214800eac48589c;
+    item.y = (float) 0x4e6b65947b2ffd40;
+    return run_struct_benchmark("XrVector2f", item, iterations);
+}
+
+BenchmarkResult benchmark_XrVector3f(std::size_t iterations) {
+    XrVector3f item{};
+    item.x = (float) 0x1f52517fd3eccd23;
+    item.y = (float) 0x16e3e0249244a1ca;
+    item.z = (float) 0x11fed6d19d9b8f0d;
+    return run_struct_benchmark("XrVector3f", item, iterations);
+}
+
+BenchmarkResult benchmark_XrVector4f(std::size_t iterations) {
+    XrVector4f item{};
+    item.x = (float) 0xb764ca193353896b;
+    item.y = (float) 0x5586199f4ee374b0;
+    item.z = (float) 0x541c7af9753fe1fe;
+    item.w = (float) 0xfe2696d60f5a2c91;
+    return run_struct_benchmark("XrVector4f", item, iterations);
+}
+
+BenchmarkResult benchmark_XrView(std::size_t iterations) {
+    XrView item{};
+    item.type = XR_TYPE_VIEW;
+    item.next = nullptr;
+    item.pose.orientation.x = (float) 0xc4d217b2e12c14c7;
+    item.pose.orientation.y = (float) 0xa5a974239a121546;
+    item.pose.orientation.z = (float) 0x5345ca4d4ac402d7;
+    item.pose.orientation.w = (float) 0x6a33ff6d5e765a40;
+    item.pose.position.x = (float) 0xcdec455e67076ed6;
+    item.pose.position.y = (float) 0x997676874f391ee7;
+    item.pose.position.z = (float) 0x8d8cad6dacdb6639;
+    item.fov.angleLeft = (float) 0xcea60cd7a0486adf;
+    item.fov.angleRight = (float) 0x9c4619a8106ac5dc;
+    item.fov.angleUp = (float) 0x4aa67a1fb37c4763;
+    item.fov.angleDown = (float) 0xeed84d1cc51a115;
+    return run_struct_benchmark("XrView", item, iterations);
+}
+
+BenchmarkResult benchmark_XrViewConfigurationProperties(std::size_t iterations) {
+    XrViewConfigurationProperties item{};
+    item.type = XR_TYPE_VIEW_CONFIGURATION_PROPERTIES;
+    item.next = nullptr;
+    item.viewConfigurationType = (XrViewConfigurationType) 0x4c2342a918111061;
+    item.fovMutable = (XrBool32) 0x551edc82991fcbbd;
+    return run_struct_benchmark("XrViewConfigurationProperties", item, iterations);
+}
+
+BenchmarkResult benchmark_XrViewConfigurationView(std::size_t iterations) {
+    XrViewConfigurationView item{};
+    item.type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    item.next = nullptr;
+    item.recommendedImageRectWidth = (uint32_t) 0x3769cbac68c764ef;
+    item.maxImageRectWidth = (uint32_t) 0x162d9f456eab2237;
+    item.recommendedImageRectHeight = (uint32_t) 0xd9286b0fdb9149d2;
+    item.maxImageRectHeight = (uint32_t) 0xb56410e1416ef97b;
+    item.recommendedSwapchainSampleCount = (uint32_t) 0x83ef7afc9d7d0c78;
+    item.maxSwapchainSampleCount = (uint32_t) 0x79ce50017f66a69e;
+    return run_struct_benchmark("XrViewConfigurationView", item, iterations);
+}
+
+BenchmarkResult benchmark_XrViewLocateInfo(std::size_t iterations) {
+    XrViewLocateInfo item{};
+    item.type = XR_TYPE_VIEW_LOCATE_INFO;
+    item.next = nullptr;
+    item.viewConfigurationType = (XrViewConfigurationType) 0xa0bbb46582a3ffb3;
+    item.displayTime = (XrTime) 0x5ed25d983366e2b7;
+    item.space = (XrSpace) 0x9128eee0687a438;
+    return run_struct_benchmark("XrViewLocateInfo", item, iterations);
+}
+
+BenchmarkResult benchmark_XrViewState(std::size_t iterations) {
+    XrViewState item{};
+    item.type = XR_TYPE_VIEW_STATE;
+    item.next = nullptr;
+    item.viewStateFlags = (XrViewStateFlags) 0x3740a5debb37f24d;
+    return run_struct_benchmark("XrViewState", item, iterations);
+}
+
+//
+// Function params, as sent in XRTP_MSG_FUNCTION_CALL
+//
+// Not benchmarked because their params contain custom or header structs:
+// - xrApplyHapticFeedback
+// - xrCreateInstance
+// - xrEndFrame
+// - xrEnumerateSwapchainImages
+
+BenchmarkResult benchmark_xrAcquireSwapchainImage(std::size_t iterations) {
+    struct Args {
+        XrSwapchain swapchain{};
+        const XrSwapchainImageAcquireInfo* acquireInfo{};
+        uint32_t* index{};
+    };
+    Args args{};
+    args.swapchain = (XrSwapchain) 0xbb1efe6870affc1f;
+    XrSwapchainImageAcquireInfo args_acquireInfo[1]{};
+    args_acquireInfo[0].type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
+    args_acquireInfo[0].next = nullptr;
+    args.acquireInfo = args_acquireInfo;
+    uint32_t args_index[1]{};
+    args_index[0] = (uint32_t) 0x2239169c83ef6fc0;
+    args.index = args_index;
+    return run_benchmark("xrAcquireSwapchainImage", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.swapchain, ctx);
+            serialize_ptr(args.acquireInfo, 1, ctx);
+            serialize_output_ptr(args.index, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.swapchain, ctx);
+            deserialize_ptr(&args.acquireInfo, ctx);
+            deserialize_output_ptr(&args.index, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.swapchain);
+            cleanup_ptr(args.acquireInfo, 1);
+            cleanup_ptr(args.index, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrAttachSessionActionSets(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrSessionActionSetsAttachInfo* attachInfo{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xc4bbe05a06ee3f38;
+    XrSessionActionSetsAttachInfo args_attachInfo[1]{};
+    args_attachInfo[0].type = XR_TYPE_SESSION_ACTION_SETS_ATTACH_INFO;
+    args_attachInfo[0].next = nullptr;
+    args_attachInfo[0].countActionSets = 17;
+    XrActionSet args_attachInfo_0_actionSets[17]{};
+    args_attachInfo_0_actionSets[0] = (XrActionSet) 0x2a49b299c3c6d0a9;
+    args_attachInfo_0_actionSets[1] = (XrActionSet) 0xa260dee26a237abd;
+    args_attachInfo_0_actionSets[2] = (XrActionSet) 0x35d27ffc38aff6c6;
+    args_attachInfo_0_actionSets[3] = (XrActionSet) 0x6df804bae239c0cf;
+    args_attachInfo_0_actionSets[4] = (XrActionSet) 0xd1c65ac338daccc9;
+    args_attachInfo_0_actionSets[5] = (XrActionSet) 0x2303118e345aff60;
+    args_attachInfo_0_actionSets[6] = (XrActionSet) 0xf452ac182af06f4;
+    args_attachInfo_0_actionSets[7] = (XrActionSet) 0xde07fff22803b06a;
+    args_attachInfo_0_actionSets[8] = (XrActionSet) 0x710ee2f69165a0a3;
+    args_attachInfo_0_actionSets[9] = (XrActionSet) 0xf1b56a9ab503b3cd;
+    args_attachInfo_0_actionSets[10] = (XrActionSet) 0xb14c7a8c7e11d7e9;
+    args_attachInfo_0_actionSets[11] = (XrActionSet) 0xc03cc5e4f4f085d4;
+    args_attachInfo_0_actionSets[12] = (XrActionSet) 0xb165226b797cdf19;
+    args_attachInfo_0_actionSets[13] = (XrActionSet) 0x59aa2ed76326bf01;
+    args_attachInfo_0_actionSets[14] = (XrActionSet) 0xf030024bc3c48705;
+    args_attachInfo_0_actionSets[15] = (XrActionSet) 0x17a16f5a89560159;
+    args_attachInfo_0_actionSets[16] = (XrActionSet) 0x66ae0508c99cc05;
+    args_attachInfo[0].actionSets = args_attachInfo_0_actionSets;
+    args.attachInfo = args_attachInfo;
+    return run_benchmark("xrAttachSessionActionSets", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.attachInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.attachInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.attachInfo, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrBeginFrame(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrFrameBeginInfo* frameBeginInfo{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xc5ac56eaf0905b8d;
+    XrFrameBeginInfo args_frameBeginInfo[1]{};
+    args_frameBeginInfo[0].type = XR_TYPE_FRAME_BEGIN_INFO;
+    args_frameBeginInfo[0].next = nullptr;
+    args.frameBeginInfo = args_frameBeginInfo;
+    return run_benchmark("xrBeginFrame", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.frameBeginInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.frameBeginInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.frameBeginInfo, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrBeginSession(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrSessionBeginInfo* beginInfo{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xcc1d43d26250ce44;
+    XrSessionBeginInfo args_beginInfo[1]{};
+    args_beginInfo[0].type = XR_TYPE_SESSION_BEGIN_INFO;
+    args_beginInfo[0].next = nullptr;
+    args_beginInfo[0].primaryViewConfigurationType = (XrViewConfigurationType) 0x24654c342cd0abde;
+    args.beginInfo = args_beginInfo;
+    return run_benchmark("xrBeginSession", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.beginInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.beginInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.beginInfo, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrCreateAction(std::size_t iterations) {
+    struct Args {
+        XrActionSet actionSet{};
+        const XrActionCreateInfo* createInfo{};
+        XrAction* action{};
+    };
+    Args args{};
+    args.actionSet = (XrActionSet) 0xf10be4efbef13d73;
+    XrActionCreateInfo args_createInfo[1]{};
+    args_createInfo[0].type = XR_TYPE_ACTION_CREATE_INFO;
+    args_createInfo[0].next = nullptr;
+    for (int i = 0; i < XR_MAX_ACTION_NAME_SIZE; i++) {
+        args_createInfo[0].actionName[i] = '9';
+    }
+    args_createInfo[0].actionType = (XrActionType) 0x6caaaa181fad098b;
+    args_createInfo[0].countSubactionPaths = 8;
+    XrPath args_createInfo_0_subactionPaths[8]{};
+    args_createInfo_0_subactionPaths[0] = (XrPath) 0xd8fce33163bdcac2;
+    args_createInfo_0_subactionPaths[1] = (XrPath) 0xa63ad56844571f72;
+    args_createInfo_0_subactionPaths[2] = (XrPath) 0xc5d8d19baea1ad76;
+    args_createInfo_0_subactionPaths[3] = (XrPath) 0x60917f42ea1d0b3d;
+    args_createInfo_0_subactionPaths[4] = (XrPath) 0x539a4be2d997c347;
+    args_createInfo_0_subactionPaths[5] = (XrPath) 0xbff22a0988e93a62;
+    args_createInfo_0_subactionPaths[6] = (XrPath) 0x9deb978739564ccb;
+    args_createInfo_0_subactionPaths[7] = (XrPath) 0x3d0ac758a3325008;
+    args_createInfo[0].subactionPaths = args_createInfo_0_subactionPaths;
+    for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_NAME_SIZE; i++) {
+        args_createInfo[0].localizedActionName[i] = 'P';
+    }
+    args.createInfo = args_createInfo;
+    XrAction args_action[1]{};
+    args_action[0] = (XrAction) 0xc1403877108b9687;
+    args.action = args_action;
+    return run_benchmark("xrCreateAction", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.actionSet, ctx);
+            serialize_ptr(args.createInfo, 1, ctx);
+            serialize_output_ptr(args.action, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.actionSet, ctx);
+            deserialize_ptr(&args.createInfo, ctx);
+            deserialize_output_ptr(&args.action, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.actionSet);
+            cleanup_ptr(args.createInfo, 1);
+            cleanup_ptr(args.action, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrCreateActionSet(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        const XrActionSetCreateInfo* createInfo{};
+        XrActionSet* actionSet{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xd546d2f66dc8ec49;
+    XrActionSetCreateInfo args_createInfo[1]{};
+    args_createInfo[0].type = XR_TYPE_ACTION_SET_CREATE_INFO;
+    args_createInfo[0].next = nullptr;
+    for (int i = 0; i < XR_MAX_ACTION_SET_NAME_SIZE; i++) {
+        args_createInfo[0].actionSetName[i] = 'z';
+    }
+    for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE; i++) {
+        args_createInfo[0].localizedActionSetName[i] = 'n';
+    }
+    args_createInfo[0].priority = (uint32_t) 0x2843b4f8f3bed721;
+    args.createInfo = args_createInfo;
+    XrActionSet args_actionSet[1]{};
+    args_actionSet[0] = (XrActionSet) 0x1ef14a9a09e4ef97;
+    args.actionSet = args_actionSet;
+    return run_benchmark("xrCreateActionSet", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_ptr(args.createInfo, 1, ctx);
+            serialize_output_ptr(args.actionSet, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_ptr(&args.createInfo, ctx);
+            deserialize_output_ptr(&args.actionSet, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.createInfo, 1);
+            cleanup_ptr(args.actionSet, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrCreateActionSpace(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrActionSpaceCreateInfo* createInfo{};
+        XrSpace* space{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x35bb46ae64db9679;
+    XrActionSpaceCreateInfo args_createInfo[1]{};
+    args_createInfo[0].type = XR_TYPE_ACTION_SPACE_CREATE_INFO;
+    args_createInfo[0].next = nullptr;
+    args_createInfo[0].action = (XrAction) 0x9c6aaa70193b0953;
+    args_createInfo[0].subactionPath = (XrPath) 0xca3e942032da25f4;
+    args_createInfo[0].poseInActionSpace.orientation.x = (float) 0x9b17ae9ebc584e0b;
+    args_createInfo[0].poseInActionSpace.orientation.y = (float) 0xafc337f1f6f1f2f0;
+    args_createInfo[0].poseInActionSpace.orientation.z = (float) 0x38a99902e4dd0aa3;
+    args_createInfo[0].poseInActionSpace.orientation.w = (float) 0xa243de6d717e6675;
+    args_createInfo[0].poseInActionSpace.position.x = (float) 0x88bd9f0904e35137;
+    args_createInfo[0].poseInActionSpace.position.y = (float) 0xbdaf094f78fccf9;
+    args_createInfo[0].poseInActionSpace.position.z = (float) 0x7410d595c0f440df;
+    args.createInfo = args_createInfo;
+    XrSpace args_space[1]{};
+    args_space[0] = (XrSpace) 0xe7cdfc8ac4f8da63;
+    args.space = args_space;
+    return run_benchmark("xrCreateActionSpace", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.createInfo, 1, ctx);
+            serialize_output_ptr(args.space, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.createInfo, ctx);
+            deserialize_output_ptr(&args.space, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.createInfo, 1);
+            cleanup_ptr(args.space, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrCreateReferenceSpace(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrReferenceSpaceCreateInfo* createInfo{};
+        XrSpace* space{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xb935c35b8cb17d9a;
+    XrReferenceSpaceCreateInfo args_createInfo[1]{};
+    args_createInfo[0].type = XR_TYPE_REFERENCE_SPACE_CREATE_INFO;
+    args_createInfo[0].next = nullptr;
+    args_createInfo[0].referenceSpaceType = (XrReferenceSpaceType) 0xdb30c3a11687c9e3;
+    args_createInfo[0].poseInReferenceSpace.orientation.x = (float) 0xd628b79541365e47;
+    args_createInfo[0].poseInReferenceSpace.orientation.y = (float) 0xaca07ba644d39048;
+    args_createInfo[0].poseInReferenceSpace.orientation.z = (float) 0x8dfb194eac61876e;
+    args_createInfo[0].poseInReferenceSpace.orientation.w = (float) 0x6f9e338cc2ec0c71;
+    args_createInfo[0].poseInReferenceSpace.position.x = (float) 0x5e55dccc63da0f80;
+    args_createInfo[0].poseInReferenceSpace.position.y = (float) 0xe22fdc7d68cf6971;
+    args_createInfo[0].poseInReferenceSpace.position.z = (float) 0x5626ad088b618bd9;
+    args.createInfo = args_createInfo;
+    XrSpace args_space[1]{};
+    args_space[0] = (XrSpace) 0x3297427a279aef6c;
+    args.space = args_space;
+    return run_benchmark("xrCreateReferenceSpace", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.createInfo, 1, ctx);
+            serialize_output_ptr(args.space, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.createInfo, ctx);
+            deserialize_output_ptr(&args.space, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.createInfo, 1);
+            cleanup_ptr(args.space, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrCreateSession(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        const XrSessionCreateInfo* createInfo{};
+        XrSession* session{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0x71f3d9066a60b28e;
+    XrSessionCreateInfo args_createInfo[1]{};
+    args_createInfo[0].type = XR_TYPE_SESSION_CREATE_INFO;
+    args_createInfo[0].next = nullptr;
+    args_createInfo[0].createFlags = (XrSessionCreateFlags) 0xf9aa2bf0d69be269;
+    args_createInfo[0].systemId = (XrSystemId) 0xd939a770e1de4658;
+    args.createInfo = args_createInfo;
+    XrSession args_session[1]{};
+    args_session[0] = (XrSession) 0x20005c7c7653c9ed;
+    args.session = args_session;
+    return run_benchmark("xrCreateSession", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_ptr(args.createInfo, 1, ctx);
+            serialize_output_ptr(args.session, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_ptr(&args.createInfo, ctx);
+            deserialize_output_ptr(&args.session, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.createInfo, 1);
+            cleanup_ptr(args.session, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrCreateSwapchain(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrSwapchainCreateInfo* createInfo{};
+        XrSwapchain* swapchain{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x2461b4a0bcb4cc03;
+    XrSwapchainCreateInfo args_createInfo[1]{};
+    args_createInfo[0].type = XR_TYPE_SWAPCHAIN_CREATE_INFO;
+    args_createInfo[0].next = nullptr;
+    args_createInfo[0].createFlags = (XrSwapchainCreateFlags) 0xe81858e9a63e7aaa;
+    args_createInfo[0].usageFlags = (XrSwapchainUsageFlags) 0x76504af2088a99a8;
+    args_createInfo[0].format = (int64_t) 0xfc8b154bcadef40b;
+    args_createInfo[0].sampleCount = (uint32_t) 0x94c726f29a645957;
+    args_createInfo[0].width = (uint32_t) 0xcfbb3e776f18ac28;
+    args_createInfo[0].height = (uint32_t) 0x959c4e08fa9daeee;
+    args_createInfo[0].faceCount = (uint32_t) 0xbb877db770c0e4ea;
+    args_createInfo[0].arraySize = (uint32_t) 0xfd97ed5afbb4db72;
+    args_createInfo[0].mipCount = (uint32_t) 0xc61fdead6598b8f;
+    args.createInfo = args_createInfo;
+    XrSwapchain args_swapchain[1]{};
+    args_swapchain[0] = (XrSwapchain) 0x58b5442158daa9a4;
+    args.swapchain = args_swapchain;
+    return run_benchmark("xrCreateSwapchain", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.createInfo, 1, ctx);
+            serialize_output_ptr(args.swapchain, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.createInfo, ctx);
+            deserialize_output_ptr(&args.swapchain, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.createInfo, 1);
+            cleanup_ptr(args.swapchain, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrDestroyAction(std::size_t iterations) {
+    struct Args {
+        XrAction action{};
+    };
+    Args args{};
+    args.action = (XrAction) 0x7a8afd852673dae3;
+    return run_benchmark("xrDestroyAction", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.action, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.action, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.action);
+        });
+}
+
+BenchmarkResult benchmark_xrDestroyActionSet(std::size_t iterations) {
+    struct Args {
+        XrActionSet actionSet{};
+    };
+    Args args{};
+    args.actionSet = (XrActionSet) 0x155debf84c17fde6;
+    return run_benchmark("xrDestroyActionSet", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.actionSet, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.actionSet, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.actionSet);
+        });
+}
+
+BenchmarkResult benchmark_xrDestroyInstance(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0x1dbe6fa406de0791;
+    return run_benchmark("xrDestroyInstance", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+        });
+}
+
+BenchmarkResult benchmark_xrDestroySession(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xb42ed447d865e680;
+    return run_benchmark("xrDestroySession", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+        });
+}
+
+BenchmarkResult benchmark_xrDestroySpace(std::size_t iterations) {
+    struct Args {
+        XrSpace space{};
+    };
+    Args args{};
+    args.space = (XrSpace) 0xc4b89d77e9b5a4dd;
+    return run_benchmark("xrDestroySpace", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.space, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.space, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.space);
+        });
+}
+
+BenchmarkResult benchmark_xrDestroySwapchain(std::size_t iterations) {
+    struct Args {
+        XrSwapchain swapchain{};
+    };
+    Args args{};
+    args.swapchain = (XrSwapchain) 0x5f1a50cd1f31d039;
+    return run_benchmark("xrDestroySwapchain", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.swapchain, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.swapchain, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.swapchain);
+        });
+}
+
+BenchmarkResult benchmark_xrEndSession(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xe6807497dcd9edde;
+    return run_benchmark("xrEndSession", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateApiLayerProperties(std::size_t iterations) {
+    struct Args {
+        uint32_t propertyCapacityInput{};
+        uint32_t* propertyCountOutput{};
+        XrApiLayerProperties* properties{};
+    };
+    Args args{};
+    args.propertyCapacityInput = 9;
+    uint32_t args_propertyCountOutput[1]{};
+    args_propertyCountOutput[0] = (uint32_t) 0xacd649d948f5c5f0;
+    args.propertyCountOutput = args_propertyCountOutput;
+    XrApiLayerProperties args_properties[9]{};
+    args_properties[0].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[0].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[0].layerName[i] = '0';
+    }
+    args_properties[0].specVersion = (XrVersion) 0x33a1d8427950c1e4;
+    args_properties[0].layerVersion = (uint32_t) 0xb4c200db6d60b07b;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[0].description[i] = 'W';
+    }
+    args_properties[1].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[1].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[1].layerName[i] = 'j';
+    }
+    args_properties[1].specVersion = (XrVersion) 0xf7c609b078499a6c;
+    args_properties[1].layerVersion = (uint32_t) 0xed1eb0ab64976ef0;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[1].description[i] = 'Q';
+    }
+    args_properties[2].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[2].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[2].layerName[i] = '1';
+    }
+    args_properties[2].specVersion = (XrVersion) 0xf5c2f586aea176e5;
+    args_properties[2].layerVersion = (uint32_t) 0x6804ba0e735f95d5;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[2].description[i] = 'l';
+    }
+    args_properties[3].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[3].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[3].layerName[i] = 'x';
+    }
+    args_properties[3].specVersion = (XrVersion) 0x22d4bba597499175;
+    args_properties[3].layerVersion = (uint32_t) 0x962d680b31e86cc;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[3].description[i] = 'D';
+    }
+    args_properties[4].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[4].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[4].layerName[i] = 'C';
+    }
+    args_properties[4].specVersion = (XrVersion) 0xf1ed9c52c7111b1d;
+    args_properties[4].layerVersion = (uint32_t) 0x87955bd9f573cf88;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[4].description[i] = 'Y';
+    }
+    args_properties[5].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[5].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[5].layerName[i] = '4';
+    }
+    args_properties[5].specVersion = (XrVersion) 0xcbe39dd7401e06a2;
+    args_properties[5].layerVersion = (uint32_t) 0x25463ab11b3b4dad;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[5].description[i] = '7';
+    }
+    args_properties[6].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[6].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[6].layerName[i] = 'G';
+    }
+    args_properties[6].specVersion = (XrVersion) 0xf6e7a2dae38f384e;
+    args_properties[6].layerVersion = (uint32_t) 0x796414e715348915;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[6].description[i] = 'w';
+    }
+    args_properties[7].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[7].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[7].layerName[i] = 'W';
+    }
+    args_properties[7].specVersion = (XrVersion) 0x2ea99bcf9b9830ed;
+    args_properties[7].layerVersion = (uint32_t) 0xb02b7fa90b1426c7;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[7].description[i] = 'T';
+    }
+    args_properties[8].type = XR_TYPE_API_LAYER_PROPERTIES;
+    args_properties[8].next = nullptr;
+    for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+        args_properties[8].layerName[i] = 'r';
+    }
+    args_properties[8].specVersion = (XrVersion) 0x12048c0575022601;
+    args_properties[8].layerVersion = (uint32_t) 0x43dac0ee105a0910;
+    for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+        args_properties[8].description[i] = 'N';
+    }
+    args.properties = args_properties;
+    return run_benchmark("xrEnumerateApiLayerProperties", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.propertyCapacityInput, ctx);
+            serialize_output_ptr(args.propertyCountOutput, 1, ctx);
+            serialize_output_xr_ptr(args.properties, args.propertyCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.propertyCapacityInput, ctx);
+            deserialize_output_ptr(&args.propertyCountOutput, ctx);
+            deserialize_output_xr_ptr(&args.properties, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.propertyCapacityInput);
+            cleanup_ptr(args.propertyCountOutput, 1);
+            cleanup_ptr(args.properties, args.propertyCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateBoundSourcesForAction(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrBoundSourcesForActionEnumerateInfo* enumerateInfo{};
+        uint32_t sourceCapacityInput{};
+        uint32_t* sourceCountOutput{};
+        XrPath* sources{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xe5a3665159c1a94a;
+    XrBoundSourcesForActionEnumerateInfo args_enumerateInfo[1]{};
+    args_enumerateInfo[0].type = XR_TYPE_BOUND_SOURCES_FOR_ACTION_ENUMERATE_INFO;
+    args_enumerateInfo[0].next = nullptr;
+    args_enumerateInfo[0].action = (XrAction) 0x4cd4d1a8d50f2eb;
+    args.enumerateInfo = args_enumerateInfo;
+    args.sourceCapacityInput = 12;
+    uint32_t args_sourceCountOutput[1]{};
+    args_sourceCountOutput[0] = (uint32_t) 0x8e21ca91553cce9b;
+    args.sourceCountOutput = args_sourceCountOutput;
+    XrPath args_sources[12]{};
+    args_sources[0] = (XrPath) 0x7767eb32e4c149b8;
+    args_sources[1] = (XrPath) 0xa241608e5e8b8690;
+    args_sources[2] = (XrPath) 0x7ac838acee083ac2;
+    args_sources[3] = (XrPath) 0xab958a1af534011a;
+    args_sources[4] = (XrPath) 0x256a8ddeca6de109;
+    args_sources[5] = (XrPath) 0xe3d75de78722ff5f;
+    args_sources[6] = (XrPath) 0x481d508cc7cd48d;
+    args_sources[7] = (XrPath) 0xfaabb0463ef21691;
+    args_sources[8] = (XrPath) 0x7176363eda7c85a3;
+    args_sources[9] = (XrPath) 0x480d5f8b201e30b6;
+    args_sources[10] = (XrPath) 0xa9dee5d2f00ced6;
+    args_sources[11] = (XrPath) 0xe0f9708737dc955c;
+    args.sources = args_sources;
+    return run_benchmark("xrEnumerateBoundSourcesForAction", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.enumerateInfo, 1, ctx);
+            serialize(&args.sourceCapacityInput, ctx);
+            serialize_output_ptr(args.sourceCountOutput, 1, ctx);
+            serialize_output_ptr(args.sources, args.sourceCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.enumerateInfo, ctx);
+            deserialize(&args.sourceCapacityInput, ctx);
+            deserialize_output_ptr(&args.sourceCountOutput, ctx);
+            deserialize_output_ptr(&args.sources, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.enumerateInfo, 1);
+            cleanup(&args.sourceCapacityInput);
+            cleanup_ptr(args.sourceCountOutput, 1);
+            cleanup_ptr(args.sources, args.sourceCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateEnvironmentBlendModes(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrSystemId systemId{};
+        XrViewConfigurationType viewConfigurationType{};
+        uint32_t environmentBlendModeCapacityInput{};
+        uint32_t* environmentBlendModeCountOutput{};
+        XrEnvironmentBlendMode* environmentBlendModes{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0x321299bf4b0365c3;
+    args.systemId = (XrSystemId) 0x6bafee5ebddb82c;
+    args.viewConfigurationType = (XrViewConfigurationType) 0x6a11e8cf2a1d40bb;
+    args.environmentBlendModeCapacityInput = 9;
+    uint32_t args_environmentBlendModeCountOutput[1]{};
+    args_environmentBlendModeCountOutput[0] = (uint32_t) 0xbe83d373a40c9dda;
+    args.environmentBlendModeCountOutput = args_environmentBlendModeCountOutput;
+    XrEnvironmentBlendMode args_environmentBlendModes[9]{};
+    args_environmentBlendModes[0] = (XrEnvironmentBlendMode) 0xf339a97fefff496;
+    args_environmentBlendModes[1] = (XrEnvironmentBlendMode) 0xef5156be92ca0c45;
+    args_environmentBlendModes[2] = (XrEnvironmentBlendMode) 0x88404f1e1907cdce;
+    args_environmentBlendModes[3] = (XrEnvironmentBlendMode) 0xc1ee09a27e61dd37;
+    args_environmentBlendModes[4] = (XrEnvironmentBlendMode) 0x614ea7c8290c2d1b;
+    args_environmentBlendModes[5] = (XrEnvironmentBlendMode) 0xa9d77303399706fc;
+    args_environmentBlendModes[6] = (XrEnvironmentBlendMode) 0x868f76161edad101;
+    args_environmentBlendModes[7] = (XrEnvironmentBlendMode) 0xaeff2231ac200f6d;
+    args_environmentBlendModes[8] = (XrEnvironmentBlendMode) 0x46bc7a54793f9eea;
+    args.environmentBlendModes = args_environmentBlendModes;
+    return run_benchmark("xrEnumerateEnvironmentBlendModes", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.systemId, ctx);
+            serialize(&args.viewConfigurationType, ctx);
+            serialize(&args.environmentBlendModeCapacityInput, ctx);
+            serialize_output_ptr(args.environmentBlendModeCountOutput, 1, ctx);
+            serialize_output_ptr(args.environmentBlendModes, args.environmentBlendModeCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.systemId, ctx);
+            deserialize(&args.viewConfigurationType, ctx);
+            deserialize(&args.environmentBlendModeCapacityInput, ctx);
+            deserialize_output_ptr(&args.environmentBlendModeCountOutput, ctx);
+            deserialize_output_ptr(&args.environmentBlendModes, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.systemId);
+            cleanup(&args.viewConfigurationType);
+            cleanup(&args.environmentBlendModeCapacityInput);
+            cleanup_ptr(args.environmentBlendModeCountOutput, 1);
+            cleanup_ptr(args.environmentBlendModes, args.environmentBlendModeCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateInstanceExtensionProperties(std::size_t iterations) {
+    struct Args {
+        const char* layerName{};
+        uint32_t propertyCapacityInput{};
+        uint32_t* propertyCountOutput{};
+        XrExtensionProperties* properties{};
+    };
+    Args args{};
+    char args_layerName[7]{};
+    args_layerName[0] = 'B';
+    args_layerName[1] = 'q';
+    args_layerName[2] = '0';
+    args_layerName[3] = 'l';
+    args_layerName[4] = 'A';
+    args_layerName[5] = 'C';
+    args_layerName[6] = char{};
+    args.layerName = args_layerName;
+    args.propertyCapacityInput = 6;
+    uint32_t args_propertyCountOutput[1]{};
+    args_propertyCountOutput[0] = (uint32_t) 0x80ca111cd957e421;
+    args.propertyCountOutput = args_propertyCountOutput;
+    XrExtensionProperties args_properties[6]{};
+    args_properties[0].type = XR_TYPE_EXTENSION_PROPERTIES;
+    args_properties[0].next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        args_properties[0].extensionName[i] = 'g';
+    }
+    args_properties[0].extensionVersion = (uint32_t) 0x2a620290c3f4836c;
+    args_properties[1].type = XR_TYPE_EXTENSION_PROPERTIES;
+    args_properties[1].next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        args_properties[1].extensionName[i] = 'U';
+    }
+    args_properties[1].extensionVersion = (uint32_t) 0xb5ba30eef3714361;
+    args_properties[2].type = XR_TYPE_EXTENSION_PROPERTIES;
+    args_properties[2].next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        args_properties[2].extensionName[i] = 'Q';
+    }
+    args_properties[2].extensionVersion = (uint32_t) 0xc772a9195e97155c;
+    args_properties[3].type = XR_TYPE_EXTENSION_PROPERTIES;
+    args_properties[3].next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        args_properties[3].extensionName[i] = 'V';
+    }
+    args_properties[3].extensionVersion = (uint32_t) 0xa3c1b97e01163b84;
+    args_properties[4].type = XR_TYPE_EXTENSION_PROPERTIES;
+    args_properties[4].next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        args_properties[4].extensionName[i] = 'U';
+    }
+    args_properties[4].extensionVersion = (uint32_t) 0x1ac7366bf9cbbfb;
+    args_properties[5].type = XR_TYPE_EXTENSION_PROPERTIES;
+    args_properties[5].next = nullptr;
+    for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+        args_properties[5].extensionName[i] = 'r';
+    }
+    args_properties[5].extensionVersion = (uint32_t) 0xeaf57f4deeddda57;
+    args.properties = args_properties;
+    return run_benchmark("xrEnumerateInstanceExtensionProperties", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize_string(args.layerName, ctx);
+            serialize(&args.propertyCapacityInput, ctx);
+            serialize_output_ptr(args.propertyCountOutput, 1, ctx);
+            serialize_output_xr_ptr(args.properties, args.propertyCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize_string(&args.layerName, ctx);
+            deserialize(&args.propertyCapacityInput, ctx);
+            deserialize_output_ptr(&args.propertyCountOutput, ctx);
+            deserialize_output_xr_ptr(&args.properties, ctx);
+        },
+        [](Args& args) {
+            cleanup_ptr(args.layerName, count_null_terminated(args.layerName));
+            cleanup(&args.propertyCapacityInput);
+            cleanup_ptr(args.propertyCountOutput, 1);
+            cleanup_ptr(args.properties, args.propertyCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateReferenceSpaces(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        uint32_t spaceCapacityInput{};
+        uint32_t* spaceCountOutput{};
+        XrReferenceSpaceType* spaces{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xc451b685e862abc2;
+    args.spaceCapacityInput = 3;
+    uint32_t args_spaceCountOutput[1]{};
+    args_spaceCountOutput[0] = (uint32_t) 0xd021a3ecdbb7a0b2;
+    args.spaceCountOutput = args_spaceCountOutput;
+    XrReferenceSpaceType args_spaces[3]{};
+    args_spaces[0] = (XrReferenceSpaceType) 0x3e106ef9fa8dfdbe;
+    args_spaces[1] = (XrReferenceSpaceType) 0xf02bdbdbf868dc2f;
+    args_spaces[2] = (XrReferenceSpaceType) 0xa15a4ed6e472c4b9;
+    args.spaces = args_spaces;
+    return run_benchmark("xrEnumerateReferenceSpaces", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize(&args.spaceCapacityInput, ctx);
+            serialize_output_ptr(args.spaceCountOutput, 1, ctx);
+            serialize_output_ptr(args.spaces, args.spaceCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize(&args.spaceCapacityInput, ctx);
+            deserialize_output_ptr(&args.spaceCountOutput, ctx);
+            deserialize_output_ptr(&args.spaces, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup(&args.spaceCapacityInput);
+            cleanup_ptr(args.spaceCountOutput, 1);
+            cleanup_ptr(args.spaces, args.spaceCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateSwapchainFormats(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        uint32_t formatCapacityInput{};
+        uint32_t* formatCountOutput{};
+        int64_t* formats{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x578e6994a320382d;
+    args.formatCapacityInput = 2;
+    uint32_t args_formatCountOutput[1]{};
+    args_formatCountOutput[0] = (uint32_t) 0x63b0ab86617db03b;
+    args.formatCountOutput = args_formatCountOutput;
+    int64_t args_formats[2]{};
+    args_formats[0] = (int64_t) 0x1143b94ed93bb9b0;
+    args_formats[1] = (int64_t) 0x98ebabbe5b57415c;
+    args.formats = args_formats;
+    return run_benchmark("xrEnumerateSwapchainFormats", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize(&args.formatCapacityInput, ctx);
+            serialize_output_ptr(args.formatCountOutput, 1, ctx);
+            serialize_output_ptr(args.formats, args.formatCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize(&args.formatCapacityInput, ctx);
+            deserialize_output_ptr(&args.formatCountOutput, ctx);
+            deserialize_output_ptr(&args.formats, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup(&args.formatCapacityInput);
+            cleanup_ptr(args.formatCountOutput, 1);
+            cleanup_ptr(args.formats, args.formatCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateViewConfigurationViews(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrSystemId systemId{};
+        XrViewConfigurationType viewConfigurationType{};
+        uint32_t viewCapacityInput{};
+        uint32_t* viewCountOutput{};
+        XrViewConfigurationView* views{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0x4623e8a90123aba0;
+    args.systemId = (XrSystemId) 0xc5925fe13f44a8ca;
+    args.viewConfigurationType = (XrViewConfigurationType) 0x80f85b81f150c4a5;
+    args.viewCapacityInput = 16;
+    uint32_t args_viewCountOutput[1]{};
+    args_viewCountOutput[0] = (uint32_t) 0x26ceb8f5b6511d79;
+    args.viewCountOutput = args_viewCountOutput;
+    XrViewConfigurationView args_views[16]{};
+    args_views[0].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[0].next = nullptr;
+    args_views[0].recommendedImageRectWidth = (uint32_t) 0xa6cb6b75049a60bd;
+    args_views[0].maxImageRectWidth = (uint32_t) 0x5561118798ff63ec;
+    args_views[0].recommendedImageRectHeight = (uint32_t) 0xbd2e172747d10784;
+    args_views[0].maxImageRectHeight = (uint32_t) 0x403d1226ed63e826;
+    args_views[0].recommendedSwapchainSampleCount = (uint32_t) 0xe4091effd3a7061d;
+    args_views[0].maxSwapchainSampleCount = (uint32_t) 0x8e606d4b95ea49af;
+    args_views[1].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[1].next = nullptr;
+    args_views[1].recommendedImageRectWidth = (uint32_t) 0x63f099590c4c63bb;
+    args_views[1].maxImageRectWidth = (uint32_t) 0xb02c1efbbd18a988;
+    args_views[1].recommendedImageRectHeight = (uint32_t) 0x45c82c6fba9548b8;
+    args_views[1].maxImageRectHeight = (uint32_t) 0x2dbb067375847d5f;
+    args_views[1].recommendedSwapchainSampleCount = (uint32_t) 0xfdda727f309b5d33;
+    args_views[1].maxSwapchainSampleCount = (uint32_t) 0x103faf359568335a;
+    args_views[2].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[2].next = nullptr;
+    args_views[2].recommendedImageRectWidth = (uint32_t) 0x73747596aacc32b;
+    args_views[2].maxImageRectWidth = (uint32_t) 0x1e65a9a9d1cf923a;
+    args_views[2].recommendedImageRectHeight = (uint32_t) 0xe1a63ef73f0ae133;
+    args_views[2].maxImageRectHeight = (uint32_t) 0x5d0fdf859bdb4a9e;
+    args_views[2].recommendedSwapchainSampleCount = (uint32_t) 0x891456db52f67481;
+    args_views[2].maxSwapchainSampleCount = (uint32_t) 0xfb7d31da7fc68595;
+    args_views[3].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[3].next = nullptr;
+    args_views[3].recommendedImageRectWidth = (uint32_t) 0x25499687da0a3be0;
+    args_views[3].maxImageRectWidth = (uint32_t) 0x4c22e98c22e893ac;
+    args_views[3].recommendedImageRectHeight = (uint32_t) 0x6c54404d2d0ff7bd;
+    args_views[3].maxImageRectHeight = (uint32_t) 0xf7dc61fa1918bb93;
+    args_views[3].recommendedSwapchainSampleCount = (uint32_t) 0x2d03f44e7b5562f8;
+    args_views[3].maxSwapchainSampleCount = (uint32_t) 0x90ed3bbef7598b86;
+    args_views[4].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[4].next = nullptr;
+    args_views[4].recommendedImageRectWidth = (uint32_t) 0xa921d00d8739be06;
+    args_views[4].maxImageRectWidth = (uint32_t) 0xe026dc5a78befd34;
+    args_views[4].recommendedImageRectHeight = (uint32_t) 0x6c36e77d393871b3;
+    args_views[4].maxImageRectHeight = (uint32_t) 0x61866abaa3e00d9d;
+    args_views[4].recommendedSwapchainSampleCount = (uint32_t) 0xf7754763d7315bf2;
+    args_views[4].maxSwapchainSampleCount = (uint32_t) 0x4c8fe4d89787211f;
+    args_views[5].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[5].next = nullptr;
+    args_views[5].recommendedImageRectWidth = (uint32_t) 0xbce686f53dc831bf;
+    args_views[5].maxImageRectWidth = (uint32_t) 0x6b7989a96c774433;
+    args_views[5].recommendedImageRectHeight = (uint32_t) 0x796261baf2b9a58b;
+    args_views[5].maxImageRectHeight = (uint32_t) 0x2ae598b7024cbd9e;
+    args_views[5].recommendedSwapchainSampleCount = (uint32_t) 0x2a1cccbedb30a20d;
+    args_views[5].maxSwapchainSampleCount = (uint32_t) 0x7c132411b7ccf5a3;
+    args_views[6].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[6].next = nullptr;
+    args_views[6].recommendedImageRectWidth = (uint32_t) 0xe461082ef507066c;
+    args_views[6].maxImageRectWidth = (uint32_t) 0xef307947c4b654ce;
+    args_views[6].recommendedImageRectHeight = (uint32_t) 0xa26c0b4f5c1e0e61;
+    args_views[6].maxImageRectHeight = (uint32_t) 0xc9805cc275d7db9;
+    args_views[6].recommendedSwapchainSampleCount = (uint32_t) 0x3b02d8dcafca1a73;
+    args_views[6].maxSwapchainSampleCount = (uint32_t) 0x682e676bfe510dc6;
+    args_views[7].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[7].next = nullptr;
+    args_views[7].recommendedImageRectWidth = (uint32_t) 0xec57af0658664b20;
+    args_views[7].maxImageRectWidth = (uint32_t) 0xb6857d54744aeb6f;
+    args_views[7].recommendedImageRectHeight = (uint32_t) 0xdf6207f5fc9fdaa5;
+    args_views[7].maxImageRectHeight = (uint32_t) 0x2bad219a2b7bf3c0;
+    args_views[7].recommendedSwapchainSampleCount = (uint32_t) 0x4f76c9c1b9c2da6f;
+    args_views[7].maxSwapchainSampleCount = (uint32_t) 0x1f1b28e07a4acf8e;
+    args_views[8].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[8].next = nullptr;
+    args_views[8].recommendedImageRectWidth = (uint32_t) 0x21bc86a875ee10e1;
+    args_views[8].maxImageRectWidth = (uint32_t) 0x3b9e0ecba4bbdf7c;
+    args_views[8].recommendedImageRectHeight = (uint32_t) 0x7097945f6db1b2ae;
+    args_views[8].maxImageRectHeight = (uint32_t) 0xc7afc89ae663ed1b;
+    args_views[8].recommendedSwapchainSampleCount = (uint32_t) 0xa36e7a027143e14;
+    args_views[8].maxSwapchainSampleCount = (uint32_t) 0x24cd76129e8f848;
+    args_views[9].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[9].next = nullptr;
+    args_views[9].recommendedImageRectWidth = (uint32_t) 0xf8c126157edc349f;
+    args_views[9].maxImageRectWidth = (uint32_t) 0x63d953666063f741;
+    args_views[9].recommendedImageRectHeight = (uint32_t) 0x814420d69bce90d2;
+    args_views[9].maxImageRectHeight = (uint32_t) 0x602e443d702a6d3f;
+    args_views[9].recommendedSwapchainSampleCount = (uint32_t) 0x32ee1137a70b312d;
+    args_views[9].maxSwapchainSampleCount = (uint32_t) 0x59332a90b812ba61;
+    args_views[10].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[10].next = nullptr;
+    args_views[10].recommendedImageRectWidth = (uint32_t) 0x9c24d2102db0ca4d;
+    args_views[10].maxImageRectWidth = (uint32_t) 0xb850b76d2e2be6a2;
+    args_views[10].recommendedImageRectHeight = (uint32_t) 0xb7efd9ae368907b1;
+    args_views[10].maxImageRectHeight = (uint32_t) 0x73de0ed6fd78a551;
+    args_views[10].recommendedSwapchainSampleCount = (uint32_t) 0x779c478c0d13703b;
+    args_views[10].maxSwapchainSampleCount = (uint32_t) 0xfa466473bf435933;
+    args_views[11].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[11].next = nullptr;
+    args_views[11].recommendedImageRectWidth = (uint32_t) 0xf66915712bae1d6f;
+    args_views[11].maxImageRectWidth = (uint32_t) 0x49d6d2da3808362f;
+    args_views[11].recommendedImageRectHeight = (uint32_t) 0x1d47984cc40469ca;
+    args_views[11].maxImageRectHeight = (uint32_t) 0x5a716e01ba3e546e;
+    args_views[11].recommendedSwapchainSampleCount = (uint32_t) 0x4276cd33c7b078d5;
+    args_views[11].maxSwapchainSampleCount = (uint32_t) 0x4336ceeced824f79;
+    args_views[12].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[12].next = nullptr;
+    args_views[12].recommendedImageRectWidth = (uint32_t) 0xe93882c41c9c7b47;
+    args_views[12].maxImageRectWidth = (uint32_t) 0xda881f06a28fec0f;
+    args_views[12].recommendedImageRectHeight = (uint32_t) 0x5fb0b3c1e67a10b4;
+    args_views[12].maxImageRectHeight = (uint32_t) 0x97804efbd8fa6c24;
+    args_views[12].recommendedSwapchainSampleCount = (uint32_t) 0x852870194fd0799c;
+    args_views[12].maxSwapchainSampleCount = (uint32_t) 0xb92091036e4de2b0;
+    args_views[13].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[13].next = nullptr;
+    args_views[13].recommendedImageRectWidth = (uint32_t) 0xbb732919cd794ae0;
+    args_views[13].maxImageRectWidth = (uint32_t) 0xb546393c773e156e;
+    args_views[13].recommendedImageRectHeight = (uint32_t) 0xe1731fd89bb02fc3;
+    args_views[13].maxImageRectHeight = (uint32_t) 0x980273a891578308;
+    args_views[13].recommendedSwapchainSampleCount = (uint32_t) 0x6818d4e9f6877368;
+    args_views[13].maxSwapchainSampleCount = (uint32_t) 0x1534900ad695a0b7;
+    args_views[14].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[14].next = nullptr;
+    args_views[14].recommendedImageRectWidth = (uint32_t) 0xc351a2a099cfe08e;
+    args_views[14].maxImageRectWidth = (uint32_t) 0xefd66119b5d757d8;
+    args_views[14].recommendedImageRectHeight = (uint32_t) 0x4d088c1f65fdd4da;
+    args_views[14].maxImageRectHeight = (uint32_t) 0x710515525ce9602c;
+    args_views[14].recommendedSwapchainSampleCount = (uint32_t) 0x7f8a89c107b06181;
+    args_views[14].maxSwapchainSampleCount = (uint32_t) 0xb327a1ee82c502ab;
+    args_views[15].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    args_views[15].next = nullptr;
+    args_views[15].recommendedImageRectWidth = (uint32_t) 0xfbc36a192a73ca00;
+    args_views[15].maxImageRectWidth = (uint32_t) 0xe160c5d5d7ac3f57;
+    args_views[15].recommendedImageRectHeight = (uint32_t) 0xdf90f83d1c431179;
+    args_views[15].maxImageRectHeight = (uint32_t) 0xe5e00c4da8ca9e79;
+    args_views[15].recommendedSwapchainSampleCount = (uint32_t) 0x5d81f9d39b01fa1d;
+    args_views[15].maxSwapchainSampleCount = (uint32_t) 0xe907146c93edf8ca;
+    args.views = args_views;
+    return run_benchmark("xrEnumerateViewConfigurationViews", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.systemId, ctx);
+            serialize(&args.viewConfigurationType, ctx);
+            serialize(&args.viewCapacityInput, ctx);
+            serialize_output_ptr(args.viewCountOutput, 1, ctx);
+            serialize_output_xr_ptr(args.views, args.viewCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.systemId, ctx);
+            deserialize(&args.viewConfigurationType, ctx);
+            deserialize(&args.viewCapacityInput, ctx);
+            deserialize_output_ptr(&args.viewCountOutput, ctx);
+            deserialize_output_xr_ptr(&args.views, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.systemId);
+            cleanup(&args.viewConfigurationType);
+            cleanup(&args.viewCapacityInput);
+            cleanup_ptr(args.viewCountOutput, 1);
+            cleanup_ptr(args.views, args.viewCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrEnumerateViewConfigurations(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrSystemId systemId{};
+        uint32_t viewConfigurationTypeCapacityInput{};
+        uint32_t* viewConfigurationTypeCountOutput{};
+        XrViewConfigurationType* viewConfigurationTypes{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xfd5dd72704c96577;
+    args.systemId = (XrSystemId) 0xae322fe41c15fc87;
+    args.viewConfigurationTypeCapacityInput = 7;
+    uint32_t args_viewConfigurationTypeCountOutput[1]{};
+    args_viewConfigurationTypeCountOutput[0] = (uint32_t) 0x842fc34f0a5af104;
+    args.viewConfigurationTypeCountOutput = args_viewConfigurationTypeCountOutput;
+    XrViewConfigurationType args_viewConfigurationTypes[7]{};
+    args_viewConfigurationTypes[0] = (XrViewConfigurationType) 0x18a2380fe6623d61;
+    args_viewConfigurationTypes[1] = (XrViewConfigurationType) 0xf19b9385dfa1a2bb;
+    args_viewConfigurationTypes[2] = (XrViewConfigurationType) 0x3bdf646c9853b281;
+    args_viewConfigurationTypes[3] = (XrViewConfigurationType) 0x4f42afce790be799;
+    args_viewConfigurationTypes[4] = (XrViewConfigurationType) 0xa8b5c0a42c01b2e8;
+    args_viewConfigurationTypes[5] = (XrViewConfigurationType) 0x4ba8c323d2a9910f;
+    args_viewConfigurationTypes[6] = (XrViewConfigurationType) 0xc770ca9d0c0314a1;
+    args.viewConfigurationTypes = args_viewConfigurationTypes;
+    return run_benchmark("xrEnumerateViewConfigurations", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.systemId, ctx);
+            serialize(&args.viewConfigurationTypeCapacityInput, ctx);
+            serialize_output_ptr(args.viewConfigurationTypeCountOutput, 1, ctx);
+            serialize_output_ptr(args.viewConfigurationTypes, args.viewConfigurationTypeCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.systemId, ctx);
+            deserialize(&args.viewConfigurationTypeCapacityInput, ctx);
+            deserialize_output_ptr(&args.viewConfigurationTypeCountOutput, ctx);
+            deserialize_output_ptr(&args.viewConfigurationTypes, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.systemId);
+            cleanup(&args.viewConfigurationTypeCapacityInput);
+            cleanup_ptr(args.viewConfigurationTypeCountOutput, 1);
+            cleanup_ptr(args.viewConfigurationTypes, args.viewConfigurationTypeCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrGetActionStateBoolean(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrActionStateGetInfo* getInfo{};
+        XrActionStateBoolean* state{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x2fc7e5b3a1a4008f;
+    XrActionStateGetInfo args_getInfo[1]{};
+    args_getInfo[0].type = XR_TYPE_ACTION_STATE_GET_INFO;
+    args_getInfo[0].next = nullptr;
+    args_getInfo[0].action = (XrAction) 0xf314097bf7b8ffc2;
+    args_getInfo[0].subactionPath = (XrPath) 0x38794e2c7ab44bc8;
+    args.getInfo = args_getInfo;
+    XrActionStateBoolean args_state[1]{};
+    args_state[0].type = XR_TYPE_ACTION_STATE_BOOLEAN;
+    args_state[0].next = nullptr;
+    args_state[0].currentState = (XrBool32) 0x11f400402d476673;
+    args_state[0].changedSinceLastSync = (XrBool32) 0x7a9d77e24d4665e0;
+    args_state[0].lastChangeTime = (XrTime) 0xe9ba30ea0aa616ff;
+    args_state[0].isActive = (XrBool32) 0x84062d69e8536516;
+    args.state = args_state;
+    return run_benchmark("xrGetActionStateBoolean", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.getInfo, 1, ctx);
+            serialize_output_xr_ptr(args.state, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.getInfo, ctx);
+            deserialize_output_xr_ptr(&args.state, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.getInfo, 1);
+            cleanup_ptr(args.state, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetActionStateFloat(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrActionStateGetInfo* getInfo{};
+        XrActionStateFloat* state{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x6818733df2d8d512;
+    XrActionStateGetInfo args_getInfo[1]{};
+    args_getInfo[0].type = XR_TYPE_ACTION_STATE_GET_INFO;
+    args_getInfo[0].next = nullptr;
+    args_getInfo[0].action = (XrAction) 0x23ce5c8ea5960c4c;
+    args_getInfo[0].subactionPath = (XrPath) 0x982b0c3bf430ae3b;
+    args.getInfo = args_getInfo;
+    XrActionStateFloat args_state[1]{};
+    args_state[0].type = XR_TYPE_ACTION_STATE_FLOAT;
+    args_state[0].next = nullptr;
+    args_state[0].currentState = (float) 0x443e4a48d0c6859e;
+    args_state[0].changedSinceLastSync = (XrBool32) 0xeab955a85bce0023;
+    args_state[0].lastChangeTime = (XrTime) 0xf46138efb30d6e59;
+    args_state[0].isActive = (XrBool32) 0x3c9066668c347316;
+    args.state = args_state;
+    return run_benchmark("xrGetActionStateFloat", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.getInfo, 1, ctx);
+            serialize_output_xr_ptr(args.state, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.getInfo, ctx);
+            deserialize_output_xr_ptr(&args.state, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.getInfo, 1);
+            cleanup_ptr(args.state, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetActionStatePose(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrActionStateGetInfo* getInfo{};
+        XrActionStatePose* state{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x8a0a762c1fe8db23;
+    XrActionStateGetInfo args_getInfo[1]{};
+    args_getInfo[0].type = XR_TYPE_ACTION_STATE_GET_INFO;
+    args_getInfo[0].next = nullptr;
+    args_getInfo[0].action = (XrAction) 0x2624e9d09d6bb82c;
+    args_getInfo[0].subactionPath = (XrPath) 0x891c3d5014b9c9fd;
+    args.getInfo = args_getInfo;
+    XrActionStatePose args_state[1]{};
+    args_state[0].type = XR_TYPE_ACTION_STATE_POSE;
+    args_state[0].next = nullptr;
+    args_state[0].isActive = (XrBool32) 0x8fd6eab9731b870d;
+    args.state = args_state;
+    return run_benchmark("xrGetActionStatePose", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.getInfo, 1, ctx);
+            serialize_output_xr_ptr(args.state, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.getInfo, ctx);
+            deserialize_output_xr_ptr(&args.state, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.getInfo, 1);
+            cleanup_ptr(args.state, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetActionStateVector2f(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrActionStateGetInfo* getInfo{};
+        XrActionStateVector2f* state{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xebd006201a9b925d;
+    XrActionStateGetInfo args_getInfo[1]{};
+    args_getInfo[0].type = XR_TYPE_ACTION_STATE_GET_INFO;
+    args_getInfo[0].next = nullptr;
+    args_getInfo[0].action = (XrAction) 0x27932ef532755cd2;
+    args_getInfo[0].subactionPath = (XrPath) 0x97e204e3ad08e82f;
+    args.getInfo = args_getInfo;
+    XrActionStateVector2f args_state[1]{};
+    args_state[0].type = XR_TYPE_ACTION_STATE_VECTOR2F;
+    args_state[0].next = nullptr;
+    args_state[0].currentState.x = (float) 0x2a604982b0016522;
+    args_state[0].currentState.y = (float) 0x164ac666999a5d86;
+    args_state[0].changedSinceLastSync = (XrBool32) 0x17cebcb49091ed17;
+    args_state[0].lastChangeTime = (XrTime) 0x7ee7d78330e112ee;
+    args_state[0].isActive = (XrBool32) 0xc124d1333c264891;
+    args.state = args_state;
+    return run_benchmark("xrGetActionStateVector2f", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.getInfo, 1, ctx);
+            serialize_output_xr_ptr(args.state, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.getInfo, ctx);
+            deserialize_output_xr_ptr(&args.state, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.getInfo, 1);
+            cleanup_ptr(args.state, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetCurrentInteractionProfile(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        XrPath topLevelUserPath{};
+        XrInteractionProfileState* interactionProfile{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x59f09607d8599db2;
+    args.topLevelUserPath = (XrPath) 0x493fa2e4a08d8f3d;
+    XrInteractionProfileState args_interactionProfile[1]{};
+    args_interactionProfile[0].type = XR_TYPE_INTERACTION_PROFILE_STATE;
+    args_interactionProfile[0].next = nullptr;
+    args_interactionProfile[0].interactionProfile = (XrPath) 0xb28b3f60ca1c55b9;
+    args.interactionProfile = args_interactionProfile;
+    return run_benchmark("xrGetCurrentInteractionProfile", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize(&args.topLevelUserPath, ctx);
+            serialize_output_xr_ptr(args.interactionProfile, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize(&args.topLevelUserPath, ctx);
+            deserialize_output_xr_ptr(&args.interactionProfile, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup(&args.topLevelUserPath);
+            cleanup_ptr(args.interactionProfile, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetInputSourceLocalizedName(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrInputSourceLocalizedNameGetInfo* getInfo{};
+        uint32_t bufferCapacityInput{};
+        uint32_t* bufferCountOutput{};
+        char* buffer{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x9bdfd1a70068c5fe;
+    XrInputSourceLocalizedNameGetInfo args_getInfo[1]{};
+    args_getInfo[0].type = XR_TYPE_INPUT_SOURCE_LOCALIZED_NAME_GET_INFO;
+    args_getInfo[0].next = nullptr;
+    args_getInfo[0].sourcePath = (XrPath) 0x72e4068899bc55d3;
+    args_getInfo[0].whichComponents = (XrInputSourceLocalizedNameFlags) 0xbf8c55bf1eed0e60;
+    args.getInfo = args_getInfo;
+    args.bufferCapacityInput = 5;
+    uint32_t args_bufferCountOutput[1]{};
+    args_bufferCountOutput[0] = (uint32_t) 0xeeb134f86055f3c3;
+    args.bufferCountOutput = args_bufferCountOutput;
+    char args_buffer[5]{};
+    args_buffer[0] = 'C';
+    args_buffer[1] = 'R';
+    args_buffer[2] = 'K';
+    args_buffer[3] = 'C';
+    args_buffer[4] = 'C';
+    args.buffer = args_buffer;
+    return run_benchmark("xrGetInputSourceLocalizedName", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.getInfo, 1, ctx);
+            serialize(&args.bufferCapacityInput, ctx);
+            serialize_output_ptr(args.bufferCountOutput, 1, ctx);
+            serialize_output_ptr(args.buffer, args.bufferCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.getInfo, ctx);
+            deserialize(&args.bufferCapacityInput, ctx);
+            deserialize_output_ptr(&args.bufferCountOutput, ctx);
+            deserialize_output_ptr(&args.buffer, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.getInfo, 1);
+            cleanup(&args.bufferCapacityInput);
+            cleanup_ptr(args.bufferCountOutput, 1);
+            cleanup_ptr(args.buffer, args.bufferCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrGetInstanceProperties(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrInstanceProperties* instanceProperties{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xbd633d34aa0f552c;
+    XrInstanceProperties args_instanceProperties[1]{};
+    args_instanceProperties[0].type = XR_TYPE_INSTANCE_PROPERTIES;
+    args_instanceProperties[0].next = nullptr;
+    args_instanceProperties[0].runtimeVersion = (XrVersion) 0xa0f451ae5379a055;
+    for (int i = 0; i < XR_MAX_RUNTIME_NAME_SIZE; i++) {
+        args_instanceProperties[0].runtimeName[i] = 'F';
+    }
+    args.instanceProperties = args_instanceProperties;
+    return run_benchmark("xrGetInstanceProperties", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_output_xr_ptr(args.instanceProperties, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_output_xr_ptr(&args.instanceProperties, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.instanceProperties, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetReferenceSpaceBoundsRect(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        XrReferenceSpaceType referenceSpaceType{};
+        XrExtent2Df* bounds{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xd4e83d760e0a98ff;
+    args.referenceSpaceType = (XrReferenceSpaceType) 0x2110db192ed51772;
+    XrExtent2Df args_bounds[1]{};
+    args_bounds[0].width = (float) 0xf7c55ca1e0350b0b;
+    args_bounds[0].height = (float) 0x467c6adac639e340;
+    args.bounds = args_bounds;
+    return run_benchmark("xrGetReferenceSpaceBoundsRect", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize(&args.referenceSpaceType, ctx);
+            serialize_output_ptr(args.bounds, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize(&args.referenceSpaceType, ctx);
+            deserialize_output_ptr(&args.bounds, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup(&args.referenceSpaceType);
+            cleanup_ptr(args.bounds, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetSystem(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        const XrSystemGetInfo* getInfo{};
+        XrSystemId* systemId{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0x3e28568492e940d0;
+    XrSystemGetInfo args_getInfo[1]{};
+    args_getInfo[0].type = XR_TYPE_SYSTEM_GET_INFO;
+    args_getInfo[0].next = nullptr;
+    args_getInfo[0].formFactor = (XrFormFactor) 0xb78863063e8988b5;
+    args.getInfo = args_getInfo;
+    XrSystemId args_systemId[1]{};
+    args_systemId[0] = (XrSystemId) 0x58145fc1caabbfc2;
+    args.systemId = args_systemId;
+    return run_benchmark("xrGetSystem", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_ptr(args.getInfo, 1, ctx);
+            serialize_output_ptr(args.systemId, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_ptr(&args.getInfo, ctx);
+            deserialize_output_ptr(&args.systemId, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.getInfo, 1);
+            cleanup_ptr(args.systemId, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetSystemProperties(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrSystemId systemId{};
+        XrSystemProperties* properties{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xc6b0099c783f7858;
+    args.systemId = (XrSystemId) 0x659e44344f189c1f;
+    XrSystemProperties args_properties[1]{};
+    args_properties[0].type = XR_TYPE_SYSTEM_PROPERTIES;
+    args_properties[0].next = nullptr;
+    args_properties[0].systemId = (XrSystemId) 0xe4e2e3cc4b6e134;
+    args_properties[0].vendorId = (uint32_t) 0x199a058eca7d0b63;
+    for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+        args_properties[0].systemName[i] = '2';
+    }
+    args_properties[0].graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0xec0d55aaaf8ec965;
+    args_properties[0].graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0xbd7fad327aea7a37;
+    args_properties[0].graphicsProperties.maxLayerCount = (uint32_t) 0x17ab09caa648782e;
+    args_properties[0].trackingProperties.orientationTracking = (XrBool32) 0x3805fd79b9720ebd;
+    args_properties[0].trackingProperties.positionTracking = (XrBool32) 0xb644b7ce1725b83e;
+    args.properties = args_properties;
+    return run_benchmark("xrGetSystemProperties", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.systemId, ctx);
+            serialize_output_xr_ptr(args.properties, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.systemId, ctx);
+            deserialize_output_xr_ptr(&args.properties, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.systemId);
+            cleanup_ptr(args.properties, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrGetViewConfigurationProperties(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrSystemId systemId{};
+        XrViewConfigurationType viewConfigurationType{};
+        XrViewConfigurationProperties* configurationProperties{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xa705972f591ef39c;
+    args.systemId = (XrSystemId) 0x251daf5b032a49a9;
+    args.viewConfigurationType = (XrViewConfigurationType) 0x3f9f5163639372a2;
+    XrViewConfigurationProperties args_configurationProperties[1]{};
+    args_configurationProperties[0].type = XR_TYPE_VIEW_CONFIGURATION_PROPERTIES;
+    args_configurationProperties[0].next = nullptr;
+    args_configurationProperties[0].viewConfigurationType = (XrViewConfigurationType) 0x227f140b7c37ca35;
+    args_configurationProperties[0].fovMutable = (XrBool32) 0x169c9bb8d34f94e5;
+    args.configurationProperties = args_configurationProperties;
+    return run_benchmark("xrGetViewConfigurationProperties", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.systemId, ctx);
+            serialize(&args.viewConfigurationType, ctx);
+            serialize_output_xr_ptr(args.configurationProperties, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.systemId, ctx);
+            deserialize(&args.viewConfigurationType, ctx);
+            deserialize_output_xr_ptr(&args.configurationProperties, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.systemId);
+            cleanup(&args.viewConfigurationType);
+            cleanup_ptr(args.configurationProperties, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrLocateSpace(std::size_t iterations) {
+    struct Args {
+        XrSpace space{};
+        XrSpace baseSpace{};
+        XrTime time{};
+        XrSpaceLocation* location{};
+    };
+    Args args{};
+    args.space = (XrSpace) 0x7d8dec667ede9406;
+    args.baseSpace = (XrSpace) 0x41bd125618c27c16;
+    args.time = (XrTime) 0x78b4bdd161688161;
+    XrSpaceLocation args_location[1]{};
+    args_location[0].type = XR_TYPE_SPACE_LOCATION;
+    args_location[0].next = nullptr;
+    args_location[0].locationFlags = (XrSpaceLocationFlags) 0xe1baf3c816672f9f;
+    args_location[0].pose.orientation.x = (float) 0xc1f9a68e4a6b4ecd;
+    args_location[0].pose.orientation.y = (float) 0xb84a5dc3668d8572;
+    args_location[0].pose.orientation.z = (float) 0xdef7bfaa198a3587;
+    args_location[0].pose.orientation.w = (float) 0x4056455551e9b5c;
+    args_location[0].pose.position.x = (float) 0x31900e5bbd5cf332;
+    args_location[0].pose.position.y = (float) 0x598f822c9577529f;
+    args_location[0].pose.position.z = (float) 0x3e60ccc50315ef9;
+    args.location = args_location;
+    return run_benchmark("xrLocateSpace", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.space, ctx);
+            serialize(&args.baseSpace, ctx);
+            serialize_time(&args.time, ctx);
+            serialize_output_xr_ptr(args.location, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.space, ctx);
+            deserialize(&args.baseSpace, ctx);
+            deserialize_time(&args.time, ctx);
+            deserialize_output_xr_ptr(&args.location, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.space);
+            cleanup(&args.baseSpace);
+            cleanup(&args.time);
+            cleanup_ptr(args.location, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrLocateSpaces(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrSpacesLocateInfo* locateInfo{};
+        XrSpaceLocations* spaceLocations{};
+    };
+    Args args{};
+    args.session = (XrSession) 0xc683e863900f3308;
+    XrSpacesLocateInfo args_locateInfo[1]{};
+    args_locateInfo[0].type = XR_TYPE_SPACES_LOCATE_INFO;
+    args_locateInfo[0].next = nullptr;
+    args_locateInfo[0].baseSpace = (XrSpace) 0xac425be6621fe4c1;
+    args_locateInfo[0].time = (XrTime) 0xb1b42da62fa94d09;
+    args_locateInfo[0].spaceCount = 17;
+    XrSpace args_locateInfo_0_spaces[17]{};
+    args_locateInfo_0_spaces[0] = (XrSpace) 0xdf3621e039f16669;
+    args_locateInfo_0_spaces[1] = (XrSpace) 0xbbd2a42495394733;
+    args_locateInfo_0_spaces[2] = (XrSpace) 0x6b836652699f9878;
+    args_locateInfo_0_spaces[3] = (XrSpace) 0x569bc711ffb79e9e;
+    args_locateInfo_0_spaces[4] = (XrSpace) 0xaf4a8d26492be221;
+    args_locateInfo_0_spaces[5] = (XrSpace) 0xc0d023d8f671041e;
+    args_locateInfo_0_spaces[6] = (XrSpace) 0xda319f011f2b0896;
+    args_locateInfo_0_spaces[7] = (XrSpace) 0x2d9739a532f6d062;
+    args_locateInfo_0_spaces[8] = (XrSpace) 0xfcead7b26ae8cae2;
+    args_locateInfo_0_spaces[9] = (XrSpace) 0x2cab296df60e7114;
+    args_locateInfo_0_spaces[10] = (XrSpace) 0xa2ce7a9968e1aba8;
+    args_locateInfo_0_spaces[11] = (XrSpace) 0x94346e5db4d88d67;
+    args_locateInfo_0_spaces[12] = (XrSpace) 0xd57a3d2bb8947a30;
+    args_locateInfo_0_spaces[13] = (XrSpace) 0x71a5c2c186e78145;
+    args_locateInfo_0_spaces[14] = (XrSpace) 0xd2ef0ac17d8ce061;
+    args_locateInfo_0_spaces[15] = (XrSpace) 0x82cb777c443c8c81;
+    args_locateInfo_0_spaces[16] = (XrSpace) 0x3b064208b9186a62;
+    args_locateInfo[0].spaces = args_locateInfo_0_spaces;
+    args.locateInfo = args_locateInfo;
+    XrSpaceLocations args_spaceLocations[1]{};
+    args_spaceLocations[0].type = XR_TYPE_SPACE_LOCATIONS;
+    args_spaceLocations[0].next = nullptr;
+    args_spaceLocations[0].locationCount = 11;
+    XrSpaceLocationData args_spaceLocations_0_locations[11]{};
+    args_spaceLocations_0_locations[0].locationFlags = (XrSpaceLocationFlags) 0x2cf46ddc07a838ac;
+    args_spaceLocations_0_locations[0].pose.orientation.x = (float) 0x8e1d8afac3e5d068;
+    args_spaceLocations_0_locations[0].pose.orientation.y = (float) 0x4573459f03c8a399;
+    args_spaceLocations_0_locations[0].pose.orientation.z = (float) 0x4d13c4eab18a9db;
+    args_spaceLocations_0_locations[0].pose.orientation.w = (float) 0x38e3add976a67ce0;
+    args_spaceLocations_0_locations[0].pose.position.x = (float) 0x86af45588a830a58;
+    args_spaceLocations_0_locations[0].pose.position.y = (float) 0xb062060d59d20136;
+    args_spaceLocations_0_locations[0].pose.position.z = (float) 0x85991a5213166fa1;
+    args_spaceLocations_0_locations[1].locationFlags = (XrSpaceLocationFlags) 0x1e8471c345626c2f;
+    args_spaceLocations_0_locations[1].pose.orientation.x = (float) 0xf96492f733e3acc6;
+    args_spaceLocations_0_locations[1].pose.orientation.y = (float) 0xe8482cce5103fd60;
+    args_spaceLocations_0_locations[1].pose.orientation.z = (float) 0x7053db6a392f2bce;
+    args_spaceLocations_0_locations[1].pose.orientation.w = (float) 0xd236332b6f8fc2af;
+    args_spaceLocations_0_locations[1].pose.position.x = (float) 0xfba7b8705ce46319;
+    args_spaceLocations_0_locations[1].pose.position.y = (float) 0xf52176adca1b7670;
+    args_spaceLocations_0_locations[1].pose.position.z = (float) 0xe0b59cc112d6171b;
+    args_spaceLocations_0_locations[2].locationFlags = (XrSpaceLocationFlags) 0xb0fbf190731ca3a7;
+    args_spaceLocations_0_locations[2].pose.orientation.x = (float) 0x3c72c61de9dc0872;
+    args_spaceLocations_0_locations[2].pose.orientation.y = (float) 0x3df0b48579af7c28;
+    args_spaceLocations_0_locations[2].pose.orientation.z = (float) 0x58c19c77a265e819;
+    args_spaceLocations_0_locations[2].pose.orientation.w = (float) 0x458bc7e62041050a;
+    args_spaceLocations_0_locations[2].pose.position.x = (float) 0x6255dd49d079bc3;
+    args_spaceLocations_0_locations[2].pose.position.y = (float) 0x994fe02d37830997;
+    args_spaceLocations_0_locations[2].pose.position.z = (float) 0xdb31fb65239b96d;
+    args_spaceLocations_0_locations[3].locationFlags = (XrSpaceLocationFlags) 0x9593ba6b98470ca9;
+    args_spaceLocations_0_locations[3].pose.orientation.x = (float) 0xb17316a6786e79b8;
+    args_spaceLocations_0_locations[3].pose.orientation.y = (float) 0xbe110410d70145da;
+    args_spaceLocations_0_locations[3].pose.orientation.z = (float) 0x75051872a1339beb;
+    args_spaceLocations_0_locations[3].pose.orientation.w = (float) 0x9f50b80c34485fca;
+    args_spaceLocations_0_locations[3].pose.position.x = (float) 0x56f24e18d2a5e96c;
+    args_spaceLocations_0_locations[3].pose.position.y = (float) 0x8d2b55597d663115;
+    args_spaceLocations_0_locations[3].pose.position.z = (float) 0xf0d695ee473d53a2;
+    args_spaceLocations_0_locations[4].locationFlags = (XrSpaceLocationFlags) 0xe1d134b27247e3b7;
+    args_spaceLocations_0_locations[4].pose.orientation.x = (float) 0x2b2b0f4c7f894dad;
+    args_spaceLocations_0_locations[4].pose.orientation.y = (float) 0x73b06fb743f2db60;
+    args_spaceLocations_0_locations[4].pose.orientation.z = (float) 0x5897340be28e924f;
+    args_spaceLocations_0_locations[4].pose.orientation.w = (float) 0xe1e7241d6e614288;
+    args_spaceLocations_0_locations[4].pose.position.x = (float) 0xe9ead105233ff94d;
+    args_spaceLocations_0_locations[4].pose.position.y = (float) 0x9d3ab4d1f8572ede;
+    args_spaceLocations_0_locations[4].pose.position.z = (float) 0x50d84e5fbdba37d2;
+    args_spaceLocations_0_locations[5].locationFlags = (XrSpaceLocationFlags) 0xde7f1437d1f5ae6e;
+    args_spaceLocations_0_locations[5].pose.orientation.x = (float) 0xbdb4484de6e9e9f2;
+    args_spaceLocations_0_locations[5].pose.orientation.y = (float) 0x54015e3b22ea86eb;
+    args_spaceLocations_0_locations[5].pose.orientation.z = (float) 0x57a03c851bfa3206;
+    args_spaceLocations_0_locations[5].pose.orientation.w = (float) 0x78749c2d105b779d;
+    args_spaceLocations_0_locations[5].pose.position.x = (float) 0x11813f3f91caa967;
+    args_spaceLocations_0_locations[5].pose.position.y = (float) 0xae517d207c1b9dbc;
+    args_spaceLocations_0_locations[5].pose.position.z = (float) 0x5dd9f97362f64062;
+    args_spaceLocations_0_locations[6].locationFlags = (XrSpaceLocationFlags) 0xcd0aef20dafd914d;
+    args_spaceLocations_0_locations[6].pose.orientation.x = (float) 0xc2d9980c037bdb4c;
+    args_spaceLocations_0_locations[6].pose.orientation.y = (float) 0x66750be3169e3bb4;
+    args_spaceLocations_0_locations[6].pose.orientation.z = (float) 0xd2b5902a18e51bfe;
+    args_spaceLocations_0_locations[6].pose.orientation.w = (float) 0xafe614ce7ffe5c70;
+    args_spaceLocations_0_locations[6].pose.position.x = (float) 0x330a70d4c4722e11;
+    args_spaceLocations_0_locations[6].pose.position.y = (float) 0xae9b3f36fb332dd9;
+    args_spaceLocations_0_locations[6].pose.position.z = (float) 0x599fcd64b11b9bb5;
+    args_spaceLocations_0_locations[7].locationFlags = (XrSpaceLocationFlags) 0x583a0f8434118964;
+    args_spaceLocations_0_locations[7].pose.orientation.x = (float) 0x19464bdcea6dc4c6;
+    args_spaceLocations_0_locations[7].pose.orientation.y = (float) 0xd27ef7e39efc992b;
+    args_spaceLocations_0_locations[7].pose.orientation.z = (float) 0xa9ea025034bf3c8f;
+    args_spaceLocations_0_locations[7].pose.orientation.w = (float) 0xd8d65570536688de;
+    args_spaceLocations_0_locations[7].pose.position.x = (float) 0x98344d5736de6e02;
+    args_spaceLocations_0_locations[7].pose.position.y = (float) 0xd4b1d51124545766;
+    args_spaceLocations_0_locations[7].pose.position.z = (float) 0xe0e42ae97a831977;
+    args_spaceLocations_0_locations[8].locationFlags = (XrSpaceLocationFlags) 0xd262de8727de011f;
+    args_spaceLocations_0_locations[8].pose.orientation.x = (float) 0x6d9906a1179d830c;
+    args_spaceLocations_0_locations[8].pose.orientation.y = (float) 0x1d60915540c908c;
+    args_spaceLocations_0_locations[8].pose.orientation.z = (float) 0x2970afe01894633f;
+    args_spaceLocations_0_locations[8].pose.orientation.w = (float) 0x3f24ba743f8d9728;
+    args_spaceLocations_0_locations[8].pose.position.x = (float) 0x5efb90eb4d8cfe72;
+    args_spaceLocations_0_locations[8].pose.position.y = (float) 0x4c858c83701a01e7;
+    args_spaceLocations_0_locations[8].pose.position.z = (float) 0x276946ec6fdbef12;
+    args_spaceLocations_0_locations[9].locationFlags = (XrSpaceLocationFlags) 0x5c71366a61cfbc01;
+    args_spaceLocations_0_locations[9].pose.orientation.x = (float) 0x10eb15a6f90e1e3c;
+    args_spaceLocations_0_locations[9].pose.orientation.y = (float) 0x7d64006d50b4877e;
+    args_spaceLocations_0_locations[9].pose.orientation.z = (float) 0x5c4eccc1f9920d4d;
+    args_spaceLocations_0_locations[9].pose.orientation.w = (float) 0xa186532a7cf40ec9;
+    args_spaceLocations_0_locations[9].pose.position.x = (float) 0xeffcda0030b31732;
+    args_spaceLocations_0_locations[9].pose.position.y = (float) 0xefe694799b2b1b1c;
+    args_spaceLocations_0_locations[9].pose.position.z = (float) 0xa9d7e89fba5f7b55;
+    args_spaceLocations_0_locations[10].locationFlags = (XrSpaceLocationFlags) 0x34974d2e4ac202cc;
+    args_spaceLocations_0_locations[10].pose.orientation.x = (float) 0xe3b0c55e3d3b79dd;
+    args_spaceLocations_0_locations[10].pose.orientation.y = (float) 0xd1141b4c9607dd06;
+    args_spaceLocations_0_locations[10].pose.orientation.z = (float) 0x55c4d17b2a8e81ba;
+    args_spaceLocations_0_locations[10].pose.orientation.w = (float) 0x27b79142027ec8a2;
+    args_spaceLocations_0_locations[10].pose.position.x = (float) 0xbbca529194b62c2b;
+    args_spaceLocations_0_locations[10].pose.position.y = (float) 0x49fa54497b6c125c;
+    args_spaceLocations_0_locations[10].pose.position.z = (float) 0x276e0908bf2f6942;
+    args_spaceLocations[0].locations = args_spaceLocations_0_locations;
+    args.spaceLocations = args_spaceLocations;
+    return run_benchmark("xrLocateSpaces", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.locateInfo, 1, ctx);
+            serialize_ptr(args.spaceLocations, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.locateInfo, ctx);
+            deserialize_ptr(&args.spaceLocations, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.locateInfo, 1);
+            cleanup_ptr(args.spaceLocations, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrLocateViews(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrViewLocateInfo* viewLocateInfo{};
+        XrViewState* viewState{};
+        uint32_t viewCapacityInput{};
+        uint32_t* viewCountOutput{};
+        XrView* views{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x351bb46fbc72c44a;
+    XrViewLocateInfo args_viewLocateInfo[1]{};
+    args_viewLocateInfo[0].type = XR_TYPE_VIEW_LOCATE_INFO;
+    args_viewLocateInfo[0].next = nullptr;
+    args_viewLocateInfo[0].viewConfigurationType = (XrViewConfigurationType) 0x378b4059f7e7a1c0;
+    args_viewLocateInfo[0].displayTime = (XrTime) 0x2a61603f81a3bde7;
+    args_viewLocateInfo[0].space = (XrSpace) 0x50d80bdcf185f1d2;
+    args.viewLocateInfo = args_viewLocateInfo;
+    XrViewState args_viewState[1]{};
+    args_viewState[0].type = XR_TYPE_VIEW_STATE;
+    args_viewState[0].next = nullptr;
+    args_viewState[0].viewStateFlags = (XrViewStateFlags) 0x4a9ac41c7cc490c0;
+    args.viewState = args_viewState;
+    args.viewCapacityInput = 20;
+    uint32_t args_viewCountOutput[1]{};
+    args_viewCountOutput[0] = (uint32_t) 0x6115d50e00595ddc;
+    args.viewCountOutput = args_viewCountOutput;
+    XrView args_views[20]{};
+    args_views[0].type = XR_TYPE_VIEW;
+    args_views[0].next = nullptr;
+    args_views[0].pose.orientation.x = (float) 0xa369a89354e6c7df;
+    args_views[0].pose.orientation.y = (float) 0xdfd7932e49893c9a;
+    args_views[0].pose.orientation.z = (float) 0x6dd0917d1e45fe35;
+    args_views[0].pose.orientation.w = (float) 0x57ba6528658f6daf;
+    args_views[0].pose.position.x = (float) 0x81863a9702c6758e;
+    args_views[0].pose.position.y = (float) 0xe0a9a881d279c458;
+    args_views[0].pose.position.z = (float) 0x6fe5084457487fbc;
+    args_views[0].fov.angleLeft = (float) 0xeeba053d70387516;
+    args_views[0].fov.angleRight = (float) 0xa3a547c7eacfd9df;
+    args_views[0].fov.angleUp = (float) 0x4255900eecb87e4;
+    args_views[0].fov.angleDown = (float) 0x287960d3f3926d04;
+    args_views[1].type = XR_TYPE_VIEW;
+    args_views[1].next = nullptr;
+    args_views[1].pose.orientation.x = (float) 0x4d5f5b52bd0e4600;
+    args_views[1].pose.orientation.y = (float) 0x6a93abb146bf6e9;
+    args_views[1].pose.orientation.z = (float) 0x90e0beb855034e9b;
+    args_views[1].pose.orientation.w = (float) 0x3c2cf8a348ac5dcd;
+    args_views[1].pose.position.x = (float) 0x586982b6ecd32857;
+    args_views[1].pose.position.y = (float) 0xa67f61d00c6142af;
+    args_views[1].pose.position.z = (float) 0x7992a634eed05e86;
+    args_views[1].fov.angleLeft = (float) 0xd77ced611b1b3d19;
+    args_views[1].fov.angleRight = (float) 0x50ec5658988b4cf7;
+    args_views[1].fov.angleUp = (float) 0xff2adda18b9e5b0c;
+    args_views[1].fov.angleDown = (float) 0xa72fe5455140f161;
+    args_views[2].type = XR_TYPE_VIEW;
+    args_views[2].next = nullptr;
+    args_views[2].pose.orientation.x = (float) 0xcf3ba62a30ceafcc;
+    args_views[2].pose.orientation.y = (float) 0x11e97bbfa012bcef;
+    args_views[2].pose.orientation.z = (float) 0xa2f85a5409cfb966;
+    args_views[2].pose.orientation.w = (float) 0x24349d1ef439e5ce;
+    args_views[2].pose.position.x = (float) 0x6ece692f4acdd752;
+    args_views[2].pose.position.y = (float) 0x7231cb6c5c99af8;
+    args_views[2].pose.position.z = (float) 0xaf2afe7f2db3637c;
+    args_views[2].fov.angleLeft = (float) 0x2329f3c4b7a86301;
+    args_views[2].fov.angleRight = (float) 0xad08f0e50ad319d1;
+    args_views[2].fov.angleUp = (float) 0x97ff4a649879cfb0;
+    args_views[2].fov.angleDown = (float) 0x23d96951158e67f4;
+    args_views[3].type = XR_TYPE_VIEW;
+    args_views[3].next = nullptr;
+    args_views[3].pose.orientation.x = (float) 0xfefd12cbde2e253c;
+    args_views[3].pose.orientation.y = (float) 0xcb99cbcbafd86acd;
+    args_views[3].pose.orientation.z = (float) 0xa7c77ffd18453bd4;
+    args_views[3].pose.orientation.w = (float) 0x1d22bbbce0ed58e6;
+    args_views[3].pose.position.x = (float) 0xa430549ea8bd7f52;
+    args_views[3].pose.position.y = (float) 0xdab8f0a42b78623f;
+    args_views[3].pose.position.z = (float) 0x22917a0db7ed0a91;
+    args_views[3].fov.angleLeft = (float) 0xbcb5bd641611c6c3;
+    args_views[3].fov.angleRight = (float) 0x3452b1521800deea;
+    args_views[3].fov.angleUp = (float) 0x9717e0fa20d975e3;
+    args_views[3].fov.angleDown = (float) 0x26582e204d14366f;
+    args_views[4].type = XR_TYPE_VIEW;
+    args_views[4].next = nullptr;
+    args_views[4].pose.orientation.x = (float) 0x44359f87c12efb04;
+    args_views[4].pose.orientation.y = (float) 0x506640527ce49e73;
+    args_views[4].pose.orientation.z = (float) 0xa3de9067692b05e4;
+    args_views[4].pose.orientation.w = (float) 0x5df57d2082b53d68;
+    args_views[4].pose.position.x = (float) 0xee78ab34a1023d8d;
+    args_views[4].pose.position.y = (float) 0xa372225026a4224f;
+    args_views[4].pose.position.z = (float) 0xd47d8abcfff9e3ef;
+    args_views[4].fov.angleLeft = (float) 0xd251525ca637cb5c;
+    args_views[4].fov.angleRight = (float) 0xe506ebda6c2c8c17;
+    args_views[4].fov.angleUp = (float) 0xd638e1b0815776c7;
+    args_views[4].fov.angleDown = (float) 0x6b0bbf22aa82b5fd;
+    args_views[5].type = XR_TYPE_VIEW;
+    args_views[5].next = nullptr;
+    args_views[5].pose.orientation.x = (float) 0xb1c42e3bcd8eff50;
+    args_views[5].pose.orientation.y = (float) 0x2d6946332642b11a;
+    args_views[5].pose.orientation.z = (float) 0xdf202f6e454f1af9;
+    args_views[5].pose.orientation.w = (float) 0x6109a6551bf02e82;
+    args_views[5].pose.position.x = (float) 0x817b0593afb4ee63;
+    args_views[5].pose.position.y = (float) 0xfeb6351f7febe673;
+    args_views[5].pose.position.z = (float) 0xbecc08d33f44be5b;
+    args_views[5].fov.angleLeft = (float) 0x6dd83205c6fc964b;
+    args_views[5].fov.angleRight = (float) 0x3b22257653a666e9;
+    args_views[5].fov.angleUp = (float) 0x94c171a4a3c9080d;
+    args_views[5].fov.angleDown = (float) 0x413589db504846a;
+    args_views[6].type = XR_TYPE_VIEW;
+    args_views[6].next = nullptr;
+    args_views[6].pose.orientation.x = (float) 0x2d227f7b420bf6ef;
+    args_views[6].pose.orientation.y = (float) 0x66122b143f0500b1;
+    args_views[6].pose.orientation.z = (float) 0xc1eb66ff48c01876;
+    args_views[6].pose.orientation.w = (float) 0xf493f69ae8ce352f;
+    args_views[6].pose.position.x = (float) 0x1ba03b0df9f8600a;
+    args_views[6].pose.position.y = (float) 0x6d61b4513de3e5ce;
+    args_views[6].pose.position.z = (float) 0x49319a61aaa0a735;
+    args_views[6].fov.angleLeft = (float) 0xffb457bcb9b2dba3;
+    args_views[6].fov.angleRight = (float) 0x3e35d616de69b29e;
+    args_views[6].fov.angleUp = (float) 0xa3626500f6a99e5;
+    args_views[6].fov.angleDown = (float) 0x38bcfc7d16df894d;
+    args_views[7].type = XR_TYPE_VIEW;
+    args_views[7].next = nullptr;
+    args_views[7].pose.orientation.x = (float) 0x1264890a883f3f40;
+    args_views[7].pose.orientation.y = (float) 0x18a8be126ca6cdab;
+    args_views[7].pose.orientation.z = (float) 0x4f8679a7a6aa023b;
+    args_views[7].pose.orientation.w = (float) 0xd3e50be8ce1e64f8;
+    args_views[7].pose.position.x = (float) 0xd28f562eee4db71e;
+    args_views[7].pose.position.y = (float) 0x5eac259cc8ea5070;
+    args_views[7].pose.position.z = (float) 0x414cce86533d667d;
+    args_views[7].fov.angleLeft = (float) 0x222e1a883f07fc7;
+    args_views[7].fov.angleRight = (float) 0x38404449226eda87;
+    args_views[7].fov.angleUp = (float) 0x526474e8d70109af;
+    args_views[7].fov.angleDown = (float) 0x8aa6408745c75907;
+    args_views[8].type = XR_TYPE_VIEW;
+    args_views[8].next = nullptr;
+    args_views[8].pose.orientation.x = (float) 0xe8be37d165fa8a2d;
+    args_views[8].pose.orientation.y = (float) 0xed0ad063953c68b7;
+    args_views[8].pose.orientation.z = (float) 0x5f115562669e235d;
+    args_views[8].pose.orientation.w = (float) 0x10ead01c47abafe4;
+    args_views[8].pose.position.x = (float) 0x6fb579c82ee313a2;
+    args_views[8].pose.position.y = (float) 0xa4529cf00230cf58;
+    args_views[8].pose.position.z = (float) 0x7f6b3e796954b6ba;
+    args_views[8].fov.angleLeft = (float) 0xafabafce04c1f7b;
+    args_views[8].fov.angleRight = (float) 0xec2923b7a3a46b4e;
+    args_views[8].fov.angleUp = (float) 0x90820d750964a8f7;
+    args_views[8].fov.angleDown = (float) 0xe147df510c0a84ea;
+    args_views[9].type = XR_TYPE_VIEW;
+    args_views[9].next = nullptr;
+    args_views[9].pose.orientation.x = (float) 0x8d22ed1ed41b195f;
+    args_views[9].pose.orientation.y = (float) 0x9823cc120c3b05f0;
+    args_views[9].pose.orientation.z = (float) 0xcb20ecb3086ebc6e;
+    args_views[9].pose.orientation.w = (float) 0xa98a907ce9f4baaa;
+    args_views[9].pose.position.x = (float) 0xdfbb133f791fff5e;
+    args_views[9].pose.position.y = (float) 0x12d7293f197ec949;
+    args_views[9].pose.position.z = (float) 0xdbf069dbf39a10b0;
+    args_views[9].fov.angleLeft = (float) 0xb53b49cdc6c5a389;
+    args_views[9].fov.angleRight = (float) 0xac85a82ef11fabde;
+    args_views[9].fov.angleUp = (float) 0xea974f4794561d89;
+    args_views[9].fov.angleDown = (float) 0xbbc6bd444a3c0939;
+    args_views[10].type = XR_TYPE_VIEW;
+    args_views[10].next = nullptr;
+    args_views[10].pose.orientation.x = (float) 0xe44dfd6b75fb88;
+    args_views[10].pose.orientation.y = (float) 0xb219dc089565b27e;
+    args_views[10].pose.orientation.z = (float) 0x7f969bf9b7b95692;
+    args_views[10].pose.orientation.w = (float) 0x855cef2425351a9f;
+    args_views[10].pose.position.x = (float) 0xac401b80596369fa;
+    args_views[10].pose.position.y = (float) 0x6eb6be963ef072f4;
+    args_views[10].pose.position.z = (float) 0xeb521cc1af320107;
+    args_views[10].fov.angleLeft = (float) 0x63103ffb184cd033;
+    args_views[10].fov.angleRight = (float) 0x5aef6c999c1d932f;
+    args_views[10].fov.angleUp = (float) 0x45b6a112115cc1e7;
+    args_views[10].fov.angleDown = (float) 0xf8bf23c6ae102159;
+    args_views[11].type = XR_TYPE_VIEW;
+    args_views[11].next = nullptr;
+    args_views[11].pose.orientation.x = (float) 0xfd44a6d045d2e776;
+    args_views[11].pose.orientation.y = (float) 0xbd145094d19bc51c;
+    args_views[11].pose.orientation.z = (float) 0x4aa4aaef3f0281be;
+    args_views[11].pose.orientation.w = (float) 0xaeae565200f81f97;
+    args_views[11].pose.position.x = (float) 0x191f75f4e92b276d;
+    args_views[11].pose.position.y = (float) 0x11ae19296779e101;
+    args_views[11].pose.position.z = (float) 0x1eb6fb2d05207b5a;
+    args_views[11].fov.angleLeft = (float) 0x7a58634a74e425c3;
+    args_views[11].fov.angleRight = (float) 0xa1ac53bc5e27a37f;
+    args_views[11].fov.angleUp = (float) 0x535856db62acea07;
+    args_views[11].fov.angleDown = (float) 0x22b5b5dd82775dd0;
+    args_views[12].type = XR_TYPE_VIEW;
+    args_views[12].next = nullptr;
+    args_views[12].pose.orientation.x = (float) 0x2cd188c5e399be65;
+    args_views[12].pose.orientation.y = (float) 0x5e759655c57d6064;
+    args_views[12].pose.orientation.z = (float) 0x6ace198fff74a07a;
+    args_views[12].pose.orientation.w = (float) 0xeee9d2e532b56bfe;
+    args_views[12].pose.position.x = (float) 0xa593addca92e2d7;
+    args_views[12].pose.position.y = (float) 0xfa3935130d0712f5;
+    args_views[12].pose.position.z = (float) 0xf3f89de1c9452600;
+    args_views[12].fov.angleLeft = (float) 0x4ea2bb4a1a38af88;
+    args_views[12].fov.angleRight = (float) 0x996e7bcce1b84853;
+    args_views[12].fov.angleUp = (float) 0xec844deff170da16;
+    args_views[12].fov.angleDown = (float) 0x8b30bf087b22e95c;
+    args_views[13].type = XR_TYPE_VIEW;
+    args_views[13].next = nullptr;
+    args_views[13].pose.orientation.x = (float) 0xc45e7241ca1ff89d;
+    args_views[13].pose.orientation.y = (float) 0x8a95568b756b1dd2;
+    args_views[13].pose.orientation.z = (float) 0xdb002acf52452c1a;
+    args_views[13].pose.orientation.w = (float) 0xe67d92c72da80e3a;
+    args_views[13].pose.position.x = (float) 0xe9f994fa3b663ca4;
+    args_views[13].pose.position.y = (float) 0xd45aff478bb25a2a;
+    args_views[13].pose.position.z = (float) 0x7cf59af80dc329c8;
+    args_views[13].fov.angleLeft = (float) 0xbe13d1671f8709bb;
+    args_views[13].fov.angleRight = (float) 0x4a8bb814c98436fa;
+    args_views[13].fov.angleUp = (float) 0x832845a50370714e;
+    args_views[13].fov.angleDown = (float) 0x96c0803311c8f3c5;
+    args_views[14].type = XR_TYPE_VIEW;
+    args_views[14].next = nullptr;
+    args_views[14].pose.orientation.x = (float) 0x361b353a841fef30;
+    args_views[14].pose.orientation.y = (float) 0xfdf2354db957669d;
+    args_views[14].pose.orientation.z = (float) 0xe23ba4fae0754c48;
+    args_views[14].pose.orientation.w = (float) 0x205c035312d7b683;
+    args_views[14].pose.position.x = (float) 0xac8ffed9051a9cc0;
+    args_views[14].pose.position.y = (float) 0x11295dde666bffcb;
+    args_views[14].pose.position.z = (float) 0xd268b716c19bfaf9;
+    args_views[14].fov.angleLeft = (float) 0x96c756aea28ae316;
+    args_views[14].fov.angleRight = (float) 0xc8b1f10f015d2a0d;
+    args_views[14].fov.angleUp = (float) 0x2211118f31da328a;
+    args_views[14].fov.angleDown = (float) 0x1a097ca4e1f0fd25;
+    args_views[15].type = XR_TYPE_VIEW;
+    args_views[15].next = nullptr;
+    args_views[15].pose.orientation.x = (float) 0x365f12f7e383afa4;
+    args_views[15].pose.orientation.y = (float) 0xb4d9b32a4cfd765c;
+    args_views[15].pose.orientation.z = (float) 0xd9de5cce6a8036d3;
+    args_views[15].pose.orientation.w = (float) 0xfd28fdaf6a9b7549;
+    args_views[15].pose.position.x = (float) 0xce0ed0c27777b6cf;
+    args_views[15].pose.position.y = (float) 0x1754bc593b2595ad;
+    args_views[15].pose.position.z = (float) 0x1fcc5fce61e476ec;
+    args_views[15].fov.angleLeft = (float) 0x5867c947040b3e3e;
+    args_views[15].fov.angleRight = (float) 0x50a3a6fef032bf8e;
+    args_views[15].fov.angleUp = (float) 0x84ce392db315fbdb;
+    args_views[15].fov.angleDown = (float) 0xf1266a19ef8b9d40;
+    args_views[16].type = XR_TYPE_VIEW;
+    args_views[16].next = nullptr;
+    args_views[16].pose.orientation.x = (float) 0xe37c1df7256b78e9;
+    args_views[16].pose.orientation.y = (float) 0xa2145c3504b0ef26;
+    args_views[16].pose.orientation.z = (float) 0x60a322c7d558366e;
+    args_views[16].pose.orientation.w = (float) 0x9d97d289e3b62eeb;
+    args_views[16].pose.position.x = (float) 0x517a22d7ca88d95e;
+    args_views[16].pose.position.y = (float) 0xa72abebaf22eea66;
+    args_views[16].pose.position.z = (float) 0x320c175bb9831b9e;
+    args_views[16].fov.angleLeft = (float) 0xcb5be4885fe12e15;
+    args_views[16].fov.angleRight = (float) 0x2973d90ce7831558;
+    args_views[16].fov.angleUp = (float) 0x4334ba1c49e8f180;
+    args_views[16].fov.angleDown = (float) 0x77bf287c7467550f;
+    args_views[17].type = XR_TYPE_VIEW;
+    args_views[17].next = nullptr;
+    args_views[17].pose.orientation.x = (float) 0x79b8063a3160c23e;
+    args_views[17].pose.orientation.y = (float) 0xaaa72850376bca92;
+    args_views[17].pose.orientation.z = (float) 0x44837f6fc3dd58c;
+    args_views[17].pose.orientation.w = (float) 0x71bff579ea293135;
+    args_views[17].pose.position.x = (float) 0x975c1eb13e9436c1;
+    args_views[17].pose.position.y = (float) 0x8932539e0716d61a;
+    args_views[17].pose.position.z = (float) 0xbfa0103e01b61558;
+    args_views[17].fov.angleLeft = (float) 0x48e9e7fd7862647e;
+    args_views[17].fov.angleRight = (float) 0x2f99e0927fadf85d;
+    args_views[17].fov.angleUp = (float) 0xb494fcfe817171ed;
+    args_views[17].fov.angleDown = (float) 0xe9f7b90b6c0c4e29;
+    args_views[18].type = XR_TYPE_VIEW;
+    args_views[18].next = nullptr;
+    args_views[18].pose.orientation.x = (float) 0x840d009a78be6aff;
+    args_views[18].pose.orientation.y = (float) 0x5ec85b05350d08eb;
+    args_views[18].pose.orientation.z = (float) 0xcdde374115d6c698;
+    args_views[18].pose.orientation.w = (float) 0x4299b6ecadc76e10;
+    args_views[18].pose.position.x = (float) 0xb84f0b32d78f564d;
+    args_views[18].pose.position.y = (float) 0x96691915f81dd8c9;
+    args_views[18].pose.position.z = (float) 0x2c81b5deba468a94;
+    args_views[18].fov.angleLeft = (float) 0xfca360ab6e3144bc;
+    args_views[18].fov.angleRight = (float) 0xa4de83ea105a6713;
+    args_views[18].fov.angleUp = (float) 0xf6a5afad01ac6e08;
+    args_views[18].fov.angleDown = (float) 0xa8de0cab6b9f8f64;
+    args_views[19].type = XR_TYPE_VIEW;
+    args_views[19].next = nullptr;
+    args_views[19].pose.orientation.x = (float) 0xf34f806c904bde12;
+    args_views[19].pose.orientation.y = (float) 0x62ba36007ab7180a;
+    args_views[19].pose.orientation.z = (float) 0xd3842b693042d18d;
+    args_views[19].pose.orientation.w = (float) 0x9ac29b1af7560e20;
+    args_views[19].pose.position.x = (float) 0x65b2aa7e6acdaa06;
+    args_views[19].pose.position.y = (float) 0x9208a3913168703e;
+    args_views[19].pose.position.z = (float) 0x5d279e681591edce;
+    args_views[19].fov.angleLeft = (float) 0xf73c6dcdadb080d5;
+    args_views[19].fov.angleRight = (float) 0x9359191facfe48f0;
+    args_views[19].fov.angleUp = (float) 0x32dcbd2054ed3bc;
+    args_views[19].fov.angleDown = (float) 0x53042188432d2074;
+    args.views = args_views;
+    return run_benchmark("xrLocateViews", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.viewLocateInfo, 1, ctx);
+            serialize_output_xr_ptr(args.viewState, 1, ctx);
+            serialize(&args.viewCapacityInput, ctx);
+            serialize_output_ptr(args.viewCountOutput, 1, ctx);
+            serialize_output_xr_ptr(args.views, args.viewCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.viewLocateInfo, ctx);
+            deserialize_output_xr_ptr(&args.viewState, ctx);
+            deserialize(&args.viewCapacityInput, ctx);
+            deserialize_output_ptr(&args.viewCountOutput, ctx);
+            deserialize_output_xr_ptr(&args.views, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.viewLocateInfo, 1);
+            cleanup_ptr(args.viewState, 1);
+            cleanup(&args.viewCapacityInput);
+            cleanup_ptr(args.viewCountOutput, 1);
+            cleanup_ptr(args.views, args.viewCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrPathToString(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrPath path{};
+        uint32_t bufferCapacityInput{};
+        uint32_t* bufferCountOutput{};
+        char* buffer{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xf6a6b38bb5b079fb;
+    args.path = (XrPath) 0xae58345af822652c;
+    args.bufferCapacityInput = 16;
+    uint32_t args_bufferCountOutput[1]{};
+    args_bufferCountOutput[0] = (uint32_t) 0x4274a8f9770187d3;
+    args.bufferCountOutput = args_bufferCountOutput;
+    char args_buffer[16]{};
+    args_buffer[0] = 'I';
+    args_buffer[1] = 'c';
+    args_buffer[2] = 'i';
+    args_buffer[3] = 'o';
+    args_buffer[4] = 'B';
+    args_buffer[5] = '5';
+    args_buffer[6] = 'v';
+    args_buffer[7] = '3';
+    args_buffer[8] = 'N';
+    args_buffer[9] = 'V';
+    args_buffer[10] = 'Z';
+    args_buffer[11] = 'U';
+    args_buffer[12] = 'Q';
+    args_buffer[13] = '4';
+    args_buffer[14] = 'n';
+    args_buffer[15] = 'j';
+    args.buffer = args_buffer;
+    return run_benchmark("xrPathToString", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.path, ctx);
+            serialize(&args.bufferCapacityInput, ctx);
+            serialize_output_ptr(args.bufferCountOutput, 1, ctx);
+            serialize_output_ptr(args.buffer, args.bufferCapacityInput, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.path, ctx);
+            deserialize(&args.bufferCapacityInput, ctx);
+            deserialize_output_ptr(&args.bufferCountOutput, ctx);
+            deserialize_output_ptr(&args.buffer, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.path);
+            cleanup(&args.bufferCapacityInput);
+            cleanup_ptr(args.bufferCountOutput, 1);
+            cleanup_ptr(args.buffer, args.bufferCapacityInput);
+        });
+}
+
+BenchmarkResult benchmark_xrPollEvent(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrEventDataBuffer* eventData{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xb823d808d69d3f2e;
+    XrEventDataBuffer args_eventData[1]{};
+    args_eventData[0].type = XR_TYPE_EVENT_DATA_BUFFER;
+    args_eventData[0].next = nullptr;
+    for (int i = 0; i < 4000; i++) {
+        args_eventData[0].varying[i] = (uint8_t) 0xff914d219f6aa1de;
+    }
+    args.eventData = args_eventData;
+    return run_benchmark("xrPollEvent", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_output_xr_ptr(args.eventData, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_output_xr_ptr(&args.eventData, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.eventData, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrReleaseSwapchainImage(std::size_t iterations) {
+    struct Args {
+        XrSwapchain swapchain{};
+        const XrSwapchainImageReleaseInfo* releaseInfo{};
+    };
+    Args args{};
+    args.swapchain = (XrSwapchain) 0x264d8e418fbc06d9;
+    XrSwapchainImageReleaseInfo args_releaseInfo[1]{};
+    args_releaseInfo[0].type = XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO;
+    args_releaseInfo[0].next = nullptr;
+    args.releaseInfo = args_releaseInfo;
+    return run_benchmark("xrReleaseSwapchainImage", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.swapchain, ctx);
+            serialize_ptr(args.releaseInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.swapchain, ctx);
+            deserialize_ptr(&args.releaseInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.swapchain);
+            cleanup_ptr(args.releaseInfo, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrRequestExitSession(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x3536a93250a5b065;
+    return run_benchmark("xrRequestExitSession", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+        });
+}
+
+BenchmarkResult benchmark_xrResultToString(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrResult value{};
+        char buffer[XR_MAX_RESULT_STRING_SIZE]{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xe5874f32c6532971;
+    args.value = (XrResult) 0xbd866a8e5ed43589;
+    for (int i = 0; i < XR_MAX_RESULT_STRING_SIZE; i++) {
+        args.buffer[i] = 'P';
+    }
+    return run_benchmark("xrResultToString", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.value, ctx);
+            serialize_string_array(args.buffer, XR_MAX_RESULT_STRING_SIZE, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.value, ctx);
+            deserialize_string_array(args.buffer, XR_MAX_RESULT_STRING_SIZE, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.value);
+            cleanup_array(args.buffer, XR_MAX_RESULT_STRING_SIZE);
+        });
+}
+
+BenchmarkResult benchmark_xrStopHapticFeedback(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrHapticActionInfo* hapticActionInfo{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x19d394fcb8935648;
+    XrHapticActionInfo args_hapticActionInfo[1]{};
+    args_hapticActionInfo[0].type = XR_TYPE_HAPTIC_ACTION_INFO;
+    args_hapticActionInfo[0].next = nullptr;
+    args_hapticActionInfo[0].action = (XrAction) 0x712f99601dc3df46;
+    args_hapticActionInfo[0].subactionPath = (XrPath) 0xf9398f9db8dd85a4;
+    args.hapticActionInfo = args_hapticActionInfo;
+    return run_benchmark("xrStopHapticFeedback", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.hapticActionInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.hapticActionInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.hapticActionInfo, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrStringToPath(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        const char* pathString{};
+        XrPath* path{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xfc3f04ed1d038aeb;
+    char args_pathString[3]{};
+    args_pathString[0] = 'J';
+    args_pathString[1] = 'k';
+    args_pathString[2] = char{};
+    args.pathString = args_pathString;
+    XrPath args_path[1]{};
+    args_path[0] = (XrPath) 0xbd26fdf7b49e0713;
+    args.path = args_path;
+    return run_benchmark("xrStringToPath", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_string(args.pathString, ctx);
+            serialize_output_ptr(args.path, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_string(&args.pathString, ctx);
+            deserialize_output_ptr(&args.path, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.pathString, count_null_terminated(args.pathString));
+            cleanup_ptr(args.path, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrStructureTypeToString(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        XrStructureType value{};
+        char buffer[XR_MAX_STRUCTURE_NAME_SIZE]{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0xccd5a4f023551f47;
+    args.value = (XrStructureType) 0x6abcb1f9c7fc7f1c;
+    for (int i = 0; i < XR_MAX_STRUCTURE_NAME_SIZE; i++) {
+        args.buffer[i] = 'G';
+    }
+    return run_benchmark("xrStructureTypeToString", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize(&args.value, ctx);
+            serialize_string_array(args.buffer, XR_MAX_STRUCTURE_NAME_SIZE, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize(&args.value, ctx);
+            deserialize_string_array(args.buffer, XR_MAX_STRUCTURE_NAME_SIZE, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup(&args.value);
+            cleanup_array(args.buffer, XR_MAX_STRUCTURE_NAME_SIZE);
+        });
+}
+
+BenchmarkResult benchmark_xrSuggestInteractionProfileBindings(std::size_t iterations) {
+    struct Args {
+        XrInstance instance{};
+        const XrInteractionProfileSuggestedBinding* suggestedBindings{};
+    };
+    Args args{};
+    args.instance = (XrInstance) 0x90a2502c4bab6d5c;
+    XrInteractionProfileSuggestedBinding args_suggestedBindings[1]{};
+    args_suggestedBindings[0].type = XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING;
+    args_suggestedBindings[0].next = nullptr;
+    args_suggestedBindings[0].interactionProfile = (XrPath) 0x83bccf203165f797;
+    args_suggestedBindings[0].countSuggestedBindings = 19;
+    XrActionSuggestedBinding args_suggestedBindings_0_suggestedBindings[19]{};
+    args_suggestedBindings_0_suggestedBindings[0].action = (XrAction) 0x411e5c5ffccf2732;
+    args_suggestedBindings_0_suggestedBindings[0].binding = (XrPath) 0x2ac5845c95dc2b77;
+    args_suggestedBindings_0_suggestedBindings[1].action = (XrAction) 0x3587a99baa78abe2;
+    args_suggestedBindings_0_suggestedBindings[1].binding = (XrPath) 0x9446692412c3cb52;
+    args_suggestedBindings_0_suggestedBindings[2].action = (XrAction) 0x8fe88c8285ea5baa;
+    args_suggestedBindings_0_suggestedBindings[2].binding = (XrPath) 0xcc2a6bf3af63ad95;
+    args_suggestedBindings_0_suggestedBindings[3].action = (XrAction) 0x807125139ff0ac35;
+    args_suggestedBindings_0_suggestedBindings[3].binding = (XrPath) 0x2138c30da5d24d5f;
+    args_suggestedBindings_0_suggestedBindings[4].action = (XrAction) 0x7ad281e0e8bb5f28;
+    args_suggestedBindings_0_suggestedBindings[4].binding = (XrPath) 0xa5c244ee669690a4;
+    args_suggestedBindings_0_suggestedBindings[5].action = (XrAction) 0xa021d3b9ccdb8a66;
+    args_suggestedBindings_0_suggestedBindings[5].binding = (XrPath) 0x4860c2efc4c8097;
+    args_suggestedBindings_0_suggestedBindings[6].action = (XrAction) 0x95226a83d0305868;
+    args_suggestedBindings_0_suggestedBindings[6].binding = (XrPath) 0x2546331b7bd3d542;
+    args_suggestedBindings_0_suggestedBindings[7].action = (XrAction) 0x9b881490420f422;
+    args_suggestedBindings_0_suggestedBindings[7].binding = (XrPath) 0xc75be37367998ff6;
+    args_suggestedBindings_0_suggestedBindings[8].action = (XrAction) 0xd9b3c681cf7e6086;
+    args_suggestedBindings_0_suggestedBindings[8].binding = (XrPath) 0xe6252487ec72b88e;
+    args_suggestedBindings_0_suggestedBindings[9].action = (XrAction) 0x75067b2295f98de5;
+    args_suggestedBindings_0_suggestedBindings[9].binding = (XrPath) 0x30e65f57ca2aae6a;
+    args_suggestedBindings_0_suggestedBindings[10].action = (XrAction) 0xbb27eb44a4871128;
+    args_suggestedBindings_0_suggestedBindings[10].binding = (XrPath) 0x7c182498ee3f2a81;
+    args_suggestedBindings_0_suggestedBindings[11].action = (XrAction) 0x34668660f829132e;
+    args_suggestedBindings_0_suggestedBindings[11].binding = (XrPath) 0x16bfa80e2c4dc87b;
+    args_suggestedBindings_0_suggestedBindings[12].action = (XrAction) 0x86035f0147107c0e;
+    args_suggestedBindings_0_suggestedBindings[12].binding = (XrPath) 0x415d2e61242228e4;
+    args_suggestedBindings_0_suggestedBindings[13].action = (XrAction) 0x6fdf9777a91ab8ee;
+    args_suggestedBindings_0_suggestedBindings[13].binding = (XrPath) 0xe220051fa7de07bd;
+    args_suggestedBindings_0_suggestedBindings[14].action = (XrAction) 0xab3f4d8971d1dbd9;
+    args_suggestedBindings_0_suggestedBindings[14].binding = (XrPath) 0xd6aca326a9e7bafa;
+    args_suggestedBindings_0_suggestedBindings[15].action = (XrAction) 0xc829d631b71bcfd5;
+    args_suggestedBindings_0_suggestedBindings[15].binding = (XrPath) 0x2ae4a8b59db20da7;
+    args_suggestedBindings_0_suggestedBindings[16].action = (XrAction) 0x95d2133d638aa951;
+    args_suggestedBindings_0_suggestedBindings[16].binding = (XrPath) 0x888cf099d65f4942;
+    args_suggestedBindings_0_suggestedBindings[17].action = (XrAction) 0x9f6c738b8a4a39a4;
+    args_suggestedBindings_0_suggestedBindings[17].binding = (XrPath) 0x3f949cdaf75491a5;
+    args_suggestedBindings_0_suggestedBindings[18].action = (XrAction) 0x196d9090a67f9054;
+    args_suggestedBindings_0_suggestedBindings[18].binding = (XrPath) 0x14bf71df54d81ea1;
+    args_suggestedBindings[0].suggestedBindings = args_suggestedBindings_0_suggestedBindings;
+    args.suggestedBindings = args_suggestedBindings;
+    return run_benchmark("xrSuggestInteractionProfileBindings", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.instance, ctx);
+            serialize_ptr(args.suggestedBindings, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.instance, ctx);
+            deserialize_ptr(&args.suggestedBindings, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.instance);
+            cleanup_ptr(args.suggestedBindings, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrSyncActions(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrActionsSyncInfo* syncInfo{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x329d679667ad7a1;
+    XrActionsSyncInfo args_syncInfo[1]{};
+    args_syncInfo[0].type = XR_TYPE_ACTIONS_SYNC_INFO;
+    args_syncInfo[0].next = nullptr;
+    args_syncInfo[0].countActiveActionSets = 14;
+    XrActiveActionSet args_syncInfo_0_activeActionSets[14]{};
+    args_syncInfo_0_activeActionSets[0].actionSet = (XrActionSet) 0x4c5a936def045d73;
+    args_syncInfo_0_activeActionSets[0].subactionPath = (XrPath) 0x5baa2f07e5f1ec43;
+    args_syncInfo_0_activeActionSets[1].actionSet = (XrActionSet) 0xd695524061f57dd0;
+    args_syncInfo_0_activeActionSets[1].subactionPath = (XrPath) 0xc10a96b3b087f10f;
+    args_syncInfo_0_activeActionSets[2].actionSet = (XrActionSet) 0x890e8075b5dd3811;
+    args_syncInfo_0_activeActionSets[2].subactionPath = (XrPath) 0x4fd25d0e3e7e5c5;
+    args_syncInfo_0_activeActionSets[3].actionSet = (XrActionSet) 0xba90fd115265d8a3;
+    args_syncInfo_0_activeActionSets[3].subactionPath = (XrPath) 0xf48ff9be1149b5e0;
+    args_syncInfo_0_activeActionSets[4].actionSet = (XrActionSet) 0x162c99901c18a4c9;
+    args_syncInfo_0_activeActionSets[4].subactionPath = (XrPath) 0x4c01a0d58eaf4788;
+    args_syncInfo_0_activeActionSets[5].actionSet = (XrActionSet) 0x5326e3a76dc94e88;
+    args_syncInfo_0_activeActionSets[5].subactionPath = (XrPath) 0xf4b5a2e50576fc27;
+    args_syncInfo_0_activeActionSets[6].actionSet = (XrActionSet) 0x9872678745f10e46;
+    args_syncInfo_0_activeActionSets[6].subactionPath = (XrPath) 0x93965b39087186c6;
+    args_syncInfo_0_activeActionSets[7].actionSet = (XrActionSet) 0x8fa6b729da4444d8;
+    args_syncInfo_0_activeActionSets[7].subactionPath = (XrPath) 0x5608c0d824af315c;
+    args_syncInfo_0_activeActionSets[8].actionSet = (XrActionSet) 0xc350f9a385ebaf47;
+    args_syncInfo_0_activeActionSets[8].subactionPath = (XrPath) 0xb63cd6c8da7b9021;
+    args_syncInfo_0_activeActionSets[9].actionSet = (XrActionSet) 0xfb7264c79f952957;
+    args_syncInfo_0_activeActionSets[9].subactionPath = (XrPath) 0x23d47c5d82cecec2;
+    args_syncInfo_0_activeActionSets[10].actionSet = (XrActionSet) 0xb3c9f2db48808816;
+    args_syncInfo_0_activeActionSets[10].subactionPath = (XrPath) 0x5471e9792295b269;
+    args_syncInfo_0_activeActionSets[11].actionSet = (XrActionSet) 0x2a01b74ec308f23;
+    args_syncInfo_0_activeActionSets[11].subactionPath = (XrPath) 0x6ed06246c86149d5;
+    args_syncInfo_0_activeActionSets[12].actionSet = (XrActionSet) 0x477cbfc12c6528b8;
+    args_syncInfo_0_activeActionSets[12].subactionPath = (XrPath) 0x97856f41c9851515;
+    args_syncInfo_0_activeActionSets[13].actionSet = (XrActionSet) 0x98325c94427b9b94;
+    args_syncInfo_0_activeActionSets[13].subactionPath = (XrPath) 0xa546c3ee8d1c7179;
+    args_syncInfo[0].activeActionSets = args_syncInfo_0_activeActionSets;
+    args.syncInfo = args_syncInfo;
+    return run_benchmark("xrSyncActions", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.syncInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.syncInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.syncInfo, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrWaitFrame(std::size_t iterations) {
+    struct Args {
+        XrSession session{};
+        const XrFrameWaitInfo* frameWaitInfo{};
+        XrFrameState* frameState{};
+    };
+    Args args{};
+    args.session = (XrSession) 0x9d0bbb22c3a6760d;
+    XrFrameWaitInfo args_frameWaitInfo[1]{};
+    args_frameWaitInfo[0].type = XR_TYPE_FRAME_WAIT_INFO;
+    args_frameWaitInfo[0].next = nullptr;
+    args.frameWaitInfo = args_frameWaitInfo;
+    XrFrameState args_frameState[1]{};
+    args_frameState[0].type = XR_TYPE_FRAME_STATE;
+    args_frameState[0].next = nullptr;
+    args_frameState[0].predictedDisplayTime = (XrTime) 0x903396866da484aa;
+    args_frameState[0].predictedDisplayPeriod = (XrDuration) 0xc5a24c8f8c6ec6a1;
+    args_frameState[0].shouldRender = (XrBool32) 0xd2d619936a6670a5;
+    args.frameState = args_frameState;
+    return run_benchmark("xrWaitFrame", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.session, ctx);
+            serialize_ptr(args.frameWaitInfo, 1, ctx);
+            serialize_output_xr_ptr(args.frameState, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.session, ctx);
+            deserialize_ptr(&args.frameWaitInfo, ctx);
+            deserialize_output_xr_ptr(&args.frameState, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.session);
+            cleanup_ptr(args.frameWaitInfo, 1);
+            cleanup_ptr(args.frameState, 1);
+        });
+}
+
+BenchmarkResult benchmark_xrWaitSwapchainImage(std::size_t iterations) {
+    struct Args {
+        XrSwapchain swapchain{};
+        const XrSwapchainImageWaitInfo* waitInfo{};
+    };
+    Args args{};
+    args.swapchain = (XrSwapchain) 0xfaee8de9d6aaef08;
+    XrSwapchainImageWaitInfo args_waitInfo[1]{};
+    args_waitInfo[0].type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+    args_waitInfo[0].next = nullptr;
+    args_waitInfo[0].timeout = (XrDuration) 0x39cd9364be731ee0;
+    args.waitInfo = args_waitInfo;
+    return run_benchmark("xrWaitSwapchainImage", args, iterations,
+        [](const Args& args, SerializeContext& ctx) {
+            serialize(&args.swapchain, ctx);
+            serialize_ptr(args.waitInfo, 1, ctx);
+        },
+        [](Args& args, DeserializeContext& ctx) {
+            deserialize(&args.swapchain, ctx);
+            deserialize_ptr(&args.waitInfo, ctx);
+        },
+        [](Args& args) {
+            cleanup(&args.swapchain);
+            cleanup_ptr(args.waitInfo, 1);
+        });
+}
+
+void write_results(std::FILE* out, const char* key, const std::vector<BenchmarkResult>& results) {
+    std::fprintf(out, "  \"%s\": [\n", key);
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        std::fprintf(out,
+            "    {\"name\": \"%s\", \"bytes\": %.1f, \"serialize_ns\": %.1f, \"deserialize_ns\": %.1f, \"cleanup_ns\": %.1f, \"first_ns\": %.1f}%s\n",
+            result.name, result.bytes, result.serialize_ns, result.deserialize_ns, result.cleanup_ns, result.first_ns,
+            i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::size_t iterations = 1000;
+    const char* output_path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else {
+            output_path = argv[i];
+        }
+    }
+    if (iterations == 0) {
+        std::fprintf(stderr, "usage: %s [--iterations N] [output.json]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<BenchmarkResult> struct_results;
+    struct_results.push_back(benchmark_XrActionCreateInfo(iterations));
+    struct_results.push_back(benchmark_XrActionSetCreateInfo(iterations));
+    struct_results.push_back(benchmark_XrActionSpaceCreateInfo(iterations));
+    struct_results.push_back(benchmark_XrActionStateBoolean(iterations));
+    struct_results.push_back(benchmark_XrActionStateFloat(iterations));
+    struct_results.push_back(benchmark_XrActionStateGetInfo(iterations));
+    struct_results.push_back(benchmark_XrActionStatePose(iterations));
+    struct_results.push_back(benchmark_XrActionStateVector2f(iterations));
+    struct_results.push_back(benchmark_XrActionSuggestedBinding(iterations));
+    struct_results.push_back(benchmark_XrActionsSyncInfo(iterations));
+    struct_results.push_back(benchmark_XrActiveActionSet(iterations));
+    struct_results.push_back(benchmark_XrApiLayerProperties(iterations));
+    struct_results.push_back(benchmark_XrApplicationInfo(iterations));
+    struct_results.push_back(benchmark_XrBodySkeletonJointHTC(iterations));
+    struct_results.push_back(benchmark_XrBoundSourcesForActionEnumerateInfo(iterations));
+    struct_results.push_back(benchmark_XrBoxf(iterations));
+    struct_results.push_back(benchmark_XrColor3f(iterations));
+    struct_results.push_back(benchmark_XrColor4f(iterations));
+    struct_results.push_back(benchmark_XrCompositionLayerProjection(iterations));
+    struct_results.push_back(benchmark_XrCompositionLayerProjectionView(iterations));
+    struct_results.push_back(benchmark_XrCompositionLayerQuad(iterations));
+    struct_results.push_back(benchmark_XrEventDataBuffer(iterations));
+    struct_results.push_back(benchmark_XrEventDataEventsLost(iterations));
+    struct_results.push_back(benchmark_XrEventDataInstanceLossPending(iterations));
+    struct_results.push_back(benchmark_XrEventDataInteractionProfileChanged(iterations));
+    struct_results.push_back(benchmark_XrEventDataReferenceSpaceChangePending(iterations));
+    struct_results.push_back(benchmark_XrEventDataSessionStateChanged(iterations));
+    struct_results.push_back(benchmark_XrExtensionProperties(iterations));
+    struct_results.push_back(benchmark_XrExtent2Df(iterations));
+    struct_results.push_back(benchmark_XrExtent2Di(iterations));
+    struct_results.push_back(benchmark_XrExtent3Df(iterations));
+    struct_results.push_back(benchmark_XrFovf(iterations));
+    struct_results.push_back(benchmark_XrFrameBeginInfo(iterations));
+    struct_results.push_back(benchmark_XrFrameState(iterations));
+    struct_results.push_back(benchmark_XrFrameWaitInfo(iterations));
+    struct_results.push_back(benchmark_XrFrustumf(iterations));
+    struct_results.push_back(benchmark_XrHapticActionInfo(iterations));
+    struct_results.push_back(benchmark_XrHapticVibration(iterations));
+    struct_results.push_back(benchmark_XrInputSourceLocalizedNameGetInfo(iterations));
+    struct_results.push_back(benchmark_XrInstanceProperties(iterations));
+    struct_results.push_back(benchmark_XrInteractionProfileState(iterations));
+    struct_results.push_back(benchmark_XrInteractionProfileSuggestedBinding(iterations));
+    struct_results.push_back(benchmark_XrOffset2Df(iterations));
+    struct_results.push_back(benchmark_XrOffset2Di(iterations));
+    struct_results.push_back(benchmark_XrPosef(iterations));
+    struct_results.push_back(benchmark_XrQuaternionf(iterations));
+    struct_results.push_back(benchmark_XrRect2Df(iterations));
+    struct_results.push_back(benchmark_XrRect2Di(iterations));
+    struct_results.push_back(benchmark_XrReferenceSpaceCreateInfo(iterations));
+    struct_results.push_back(benchmark_XrSessionActionSetsAttachInfo(iterations));
+    struct_results.push_back(benchmark_XrSessionBeginInfo(iterations));
+    struct_results.push_back(benchmark_XrSessionCreateInfo(iterations));
+    struct_results.push_back(benchmark_XrSpaceLocation(iterations));
+    struct_results.push_back(benchmark_XrSpaceLocationData(iterations));
+    struct_results.push_back(benchmark_XrSpaceLocations(iterations));
+    struct_results.push_back(benchmark_XrSpaceVelocities(iterations));
+    struct_results.push_back(benchmark_XrSpaceVelocity(iterations));
+    struct_results.push_back(benchmark_XrSpaceVelocityData(iterations));
+    struct_results.push_back(benchmark_XrSpacesLocateInfo(iterations));
+    struct_results.push_back(benchmark_XrSpheref(iterations));
+    struct_results.push_back(benchmark_XrSwapchainCreateInfo(iterations));
+    struct_results.push_back(benchmark_XrSwapchainImageAcquireInfo(iterations));
+    struct_results.push_back(benchmark_XrSwapchainImageReleaseInfo(iterations));
+    struct_results.push_back(benchmark_XrSwapchainImageWaitInfo(iterations));
+    struct_results.push_back(benchmark_XrSwapchainSubImage(iterations));
+    struct_results.push_back(benchmark_XrSystemGetInfo(iterations));
+    struct_results.push_back(benchmark_XrSystemGraphicsProperties(iterations));
+    struct_results.push_back(benchmark_XrSystemProperties(iterations));
+    struct_results.push_back(benchmark_XrSystemTrackingProperties(iterations));
+    struct_results.push_back(benchmark_XrUuid(iterations));
+    struct_results.push_back(benchmark_XrVector2f(iterations));
+    struct_results.push_back(benchmark_XrVector3f(iterations));
+    struct_results.push_back(benchmark_XrVector4f(iterations));
+    struct_results.push_back(benchmark_XrView(iterations));
+    struct_results.push_back(benchmark_XrViewConfigurationProperties(iterations));
+    struct_results.push_back(benchmark_XrViewConfigurationView(iterations));
+    struct_results.push_back(benchmark_XrViewLocateInfo(iterations));
+    struct_results.push_back(benchmark_XrViewState(iterations));
+
+    std::vector<BenchmarkResult> function_results;
+    function_results.push_back(benchmark_xrAcquireSwapchainImage(iterations));
+    function_results.push_back(benchmark_xrAttachSessionActionSets(iterations));
+    function_results.push_back(benchmark_xrBeginFrame(iterations));
+    function_results.push_back(benchmark_xrBeginSession(iterations));
+    function_results.push_back(benchmark_xrCreateAction(iterations));
+    function_results.push_back(benchmark_xrCreateActionSet(iterations));
+    function_results.push_back(benchmark_xrCreateActionSpace(iterations));
+    function_results.push_back(benchmark_xrCreateReferenceSpace(iterations));
+    function_results.push_back(benchmark_xrCreateSession(iterations));
+    function_results.push_back(benchmark_xrCreateSwapchain(iterations));
+    function_results.push_back(benchmark_xrDestroyAction(iterations));
+    function_results.push_back(benchmark_xrDestroyActionSet(iterations));
+    function_results.push_back(benchmark_xrDestroyInstance(iterations));
+    function_results.push_back(benchmark_xrDestroySession(iterations));
+    function_results.push_back(benchmark_xrDestroySpace(iterations));
+    function_results.push_back(benchmark_xrDestroySwapchain(iterations));
+    function_results.push_back(benchmark_xrEndSession(iterations));
+    function_results.push_back(benchmark_xrEnumerateApiLayerProperties(iterations));
+    function_results.push_back(benchmark_xrEnumerateBoundSourcesForAction(iterations));
+    function_results.push_back(benchmark_xrEnumerateEnvironmentBlendModes(iterations));
+    function_results.push_back(benchmark_xrEnumerateInstanceExtensionProperties(iterations));
+    function_results.push_back(benchmark_xrEnumerateReferenceSpaces(iterations));
+    function_results.push_back(benchmark_xrEnumerateSwapchainFormats(iterations));
+    function_results.push_back(benchmark_xrEnumerateViewConfigurationViews(iterations));
+    function_results.push_back(benchmark_xrEnumerateViewConfigurations(iterations));
+    function_results.push_back(benchmark_xrGetActionStateBoolean(iterations));
+    function_results.push_back(benchmark_xrGetActionStateFloat(iterations));
+    function_results.push_back(benchmark_xrGetActionStatePose(iterations));
+    function_results.push_back(benchmark_xrGetActionStateVector2f(iterations));
+    function_results.push_back(benchmark_xrGetCurrentInteractionProfile(iterations));
+    function_results.push_back(benchmark_xrGetInputSourceLocalizedName(iterations));
+    function_results.push_back(benchmark_xrGetInstanceProperties(iterations));
+    function_results.push_back(benchmark_xrGetReferenceSpaceBoundsRect(iterations));
+    function_results.push_back(benchmark_xrGetSystem(iterations));
+    function_results.push_back(benchmark_xrGetSystemProperties(iterations));
+    function_results.push_back(benchmark_xrGetViewConfigurationProperties(iterations));
+    function_results.push_back(benchmark_xrLocateSpace(iterations));
+    function_results.push_back(benchmark_xrLocateSpaces(iterations));
+    function_results.push_back(benchmark_xrLocateViews(iterations));
+    function_results.push_back(benchmark_xrPathToString(iterations));
+    function_results.push_back(benchmark_xrPollEvent(iterations));
+    function_results.push_back(benchmark_xrReleaseSwapchainImage(iterations));
+    function_results.push_back(benchmark_xrRequestExitSession(iterations));
+    function_results.push_back(benchmark_xrResultToString(iterations));
+    function_results.push_back(benchmark_xrStopHapticFeedback(iterations));
+    function_results.push_back(benchmark_xrStringToPath(iterations));
+    function_results.push_back(benchmark_xrStructureTypeToString(iterations));
+    function_results.push_back(benchmark_xrSuggestInteractionProfileBindings(iterations));
+    function_results.push_back(benchmark_xrSyncActions(iterations));
+    function_results.push_back(benchmark_xrWaitFrame(iterations));
+    function_results.push_back(benchmark_xrWaitSwapchainImage(iterations));
+
+    std::FILE* out = output_path ? std::fopen(output_path, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "failed to open %s\n", output_path);
+        return 1;
+    }
+    std::fprintf(out, "{\n  \"mode\": \"%s\",\n  \"iterations\": %zu,\n", SERIALIZATION_MODE, iterations);
+    write_results(out, "structs", struct_results);
+    std::fprintf(out, ",\n");
+    write_results(out, "functions", function_results);
+    std::fprintf(out, "\n}\n");
+    if (out != stdout) {
+        std::fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/asio_compat.h"
+#include "xrtransport/util.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Handles are pointers on 64 bit platforms and integers on 32 bit platforms
+template <typename T>
+T make_handle(std::uint64_t value) {
+    T handle{};
+    std::memcpy(&handle, &value, sizeof(handle));
+    return handle;
+}
+
+// The array length is 4 bytes, so padding of 4 puts 8 byte aligned elements on an 8 byte boundary
+void write_active_action_sets(LendingByteQueue& queue, std::uint32_t padding, const std::vector<XrActiveActionSet>& sets) {
+    SerializeContext s_ctx(queue);
+    for (std::uint32_t i = 0; i < padding; i++) {
+        std::uint8_t zero = 0;
+        serialize(&zero, s_ctx);
+    }
+    serialize_ptr(sets.data(), sets.size(), s_ctx);
+}
+
+void skip_padding(LendingByteQueue& queue, std::uint32_t padding) {
+    queue.read_pos += padding;
+}
+
+std::vector<XrActiveActionSet> test_action_sets() {
+    return {
+        {make_handle<XrActionSet>(0x1000), 17},
+        {make_handle<XrActionSet>(0x2000), 0},
+        {make_handle<XrActionSet>(0x3000), 42},
+    };
+}
+
+} // namespace
+
+TEST_CASE("Flat types match their serialized layout", "[borrow]") {
+    CHECK(is_flat(static_cast<const float*>(nullptr)));
+    CHECK(is_flat(static_cast<const XrStructureType*>(nullptr)));
+    CHECK(is_flat(static_cast<const XrSpace*>(nullptr)));
+    CHECK(is_flat(static_cast<const XrPosef*>(nullptr)));
+    CHECK(is_flat(static_cast<const XrActiveActionSet*>(nullptr)));
+    CHECK(is_flat(static_cast<const XrActionSuggestedBinding*>(nullptr)));
+
+    // padded between the flags and the pose
+    CHECK_FALSE(is_flat(static_cast<const XrSpaceLocationData*>(nullptr)));
+    // has a next chain
+    CHECK_FALSE(is_flat(static_cast<const XrActionsSyncInfo*>(nullptr)));
+}
+
+TEST_CASE("Aligned const arrays are borrowed from the message", "[borrow]") {
+    std::vector<XrActiveActionSet> sets = test_action_sets();
+    LendingByteQueue queue;
+    write_active_action_sets(queue, 4, sets);
+    skip_padding(queue, 4);
+
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(queue);
+    const XrActiveActionSet* result{};
+    deserialize_ptr(&result, d_ctx);
+
+    REQUIRE(result);
+    CHECK(queue.contains(result));
+    CHECK(borrow_scope.is_borrowed(result));
+    for (std::size_t i = 0; i < sets.size(); i++) {
+        CHECK(result[i].actionSet == sets[i].actionSet);
+        CHECK(result[i].subactionPath == sets[i].subactionPath);
+    }
+
+    // must not be freed
+    cleanup_ptr(result, sets.size());
+}
+
+TEST_CASE("Misaligned const arrays are copied", "[borrow]") {
+    std::vector<XrActiveActionSet> sets = test_action_sets();
+    LendingByteQueue queue;
+    write_active_action_sets(queue, 0, sets);
+
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(queue);
+    const XrActiveActionSet* result{};
+    deserialize_ptr(&result, d_ctx);
+
+    REQUIRE(result);
+    CHECK_FALSE(queue.contains(result));
+    CHECK_FALSE(borrow_scope.is_borrowed(result));
+    for (std::size_t i = 0; i < sets.size(); i++) {
+        CHECK(result[i].actionSet == sets[i].actionSet);
+        CHECK(result[i].subactionPath == sets[i].subactionPath);
+    }
+    // everything after the array is still read correctly
+    CHECK(queue.read_pos == queue.bytes.size());
+
+    cleanup_ptr(result, sets.size());
+}
+
+TEST_CASE("Const strings are borrowed from the message", "[borrow]") {
+    const char* path = "/user/hand/left/input/trigger/value";
+    LendingByteQueue queue;
+    SerializeContext s_ctx(queue);
+    serialize_ptr(path, count_null_terminated(path), s_ctx);
+    std::uint32_t trailing = 0xDEADBEEF;
+    serialize(&trailing, s_ctx);
+
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(queue);
+    const char* result{};
+    deserialize_ptr(&result, d_ctx);
+    std::uint32_t trailing_result{};
+    deserialize(&trailing_result, d_ctx);
+
+    REQUIRE(result);
+    CHECK(queue.contains(result));
+    CHECK(std::strcmp(result, path) == 0);
+    CHECK(trailing_result == trailing);
+
+    cleanup_ptr(result, count_null_terminated(result));
+}
+
+TEST_CASE("Nothing is borrowed without a BorrowScope", "[borrow]") {
+    std::vector<XrActiveActionSet> sets = test_action_sets();
+    LendingByteQueue queue;
+    write_active_action_sets(queue, 4, sets);
+    skip_padding(queue, 4);
+
+    DeserializeContext d_ctx(queue);
+    const XrActiveActionSet* result{};
+    deserialize_ptr(&result, d_ctx);
+
+    REQUIRE(result);
+    CHECK_FALSE(queue.contains(result));
+
+    cleanup_ptr(result, sets.size());
+}
+
+TEST_CASE("Non-const arrays are never borrowed", "[borrow]") {
+    // non-const pointers are outputs that the runtime writes to
+    std::vector<XrActiveActionSet> sets = test_action_sets();
+    LendingByteQueue queue;
+    write_active_action_sets(queue, 4, sets);
+    skip_padding(queue, 4);
+
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(queue);
+    XrActiveActionSet* result{};
+    deserialize_ptr(&result, d_ctx);
+
+    REQUIRE(result);
+    CHECK_FALSE(queue.contains(result));
+
+    cleanup_ptr(result, sets.size());
+}
+
+TEST_CASE("Scopes nest and restore the previous scope", "[borrow]") {
+    CHECK(BorrowScope::active() == nullptr);
+    {
+        BorrowScope outer;
+        CHECK(BorrowScope::active() == &outer);
+        {
+            BorrowScope inner;
+            CHECK(BorrowScope::active() == &inner);
+        }
+        CHECK(BorrowScope::active() == &outer);
+    }
+    CHECK(BorrowScope::active() == nullptr);
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef XRTRANSPORT_TEST_BYTE_QUEUE_H
+#define XRTRANSPORT_TEST_BYTE_QUEUE_H
+
+#include "xrtransport/asio_compat.h"
+#include "asio.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace xrtransport {
+namespace test {
+
+/**
+ * Simple in-memory FIFO for serialized values. Everything written is appended to bytes, and reads
+ * consume it from read_pos on.
+ */
+class ByteQueue : public SyncDuplexStream {
+public:
+    std::vector<std::uint8_t> bytes;
+    std::size_t read_pos = 0;
+
+    std::size_t read_some(const asio::mutable_buffer& buffer, asio::error_code& ec) override {
+        ec.clear();
+        std::size_t size = std::min(buffer.size(), bytes.size() - read_pos);
+        if (size == 0 && buffer.size() != 0) {
+            ec = asio::error::eof;
+            return 0;
+        }
+        std::memcpy(buffer.data(), bytes.data() + read_pos, size);
+        read_pos += size;
+        return size;
+    }
+
+    std::size_t read_some(const asio::mutable_buffer& buffer) override {
+        asio::error_code ec;
+        std::size_t size = read_some(buffer, ec);
+        if (ec) throw asio::system_error(ec);
+        return size;
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer, asio::error_code& ec) override {
+        ec.clear();
+        const std::uint8_t* data = static_cast<const std::uint8_t*>(buffer.data());
+        bytes.insert(bytes.end(), data, data + buffer.size());
+        return buffer.size();
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer) override {
+        asio::error_code ec;
+        return write_some(buffer, ec);
+    }
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+
+    void clear() {
+        bytes.clear();
+        read_pos = 0;
+    }
+
+    std::size_t unread() const {
+        return bytes.size() - read_pos;
+    }
+
+    bool contains(const void* p) const {
+        const std::uint8_t* byte = static_cast<const std::uint8_t*>(p);
+        return byte >= bytes.data() && byte < bytes.data() + bytes.size();
+    }
+};
+
+/**
+ * ByteQueue that lends out its bytes, like the buffer of a received message.
+ */
+class LendingByteQueue : public ByteQueue {
+public:
+    const void* borrow(std::size_t size, std::size_t alignment) override {
+        const std::uint8_t* data = bytes.data() + read_pos;
+        if (bytes.size() - read_pos < size || reinterpret_cast<std::uintptr_t>(data) % alignment != 0) {
+            return nullptr;
+        }
+        read_pos += size;
+        return data;
+    }
+};
+
+/**
+ * Write-only sink that counts serialized bytes.
+ */
+class ByteCounter : public SyncWriteStream {
+public:
+    std::size_t size = 0;
+
+    std::size_t write_some(const asio::const_buffer& buffer, asio::error_code& ec) override {
+        ec.clear();
+        size += buffer.size();
+        return buffer.size();
+    }
+
+    std::size_t write_some(const asio::const_buffer& buffer) override {
+        size += buffer.size();
+        return buffer.size();
+    }
+
+    void close() override {}
+    void close(asio::error_code& ec) override { ec.clear(); }
+};
+
+} // namespace test
+} // namespace xrtransport
+
+#endif // XRTRANSPORT_TEST_BYTE_QUEUE_H
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/error.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Both ends of one direction of a connection
+struct Channel {
+    ByteQueue queue;
+    HandleInterner interner;
+    HandleTable table;
+
+    // Serializes one message and returns its size
+    template <typename F>
+    std::size_t send(F&& serialize_message) {
+        std::size_t start = queue.bytes.size();
+        SerializeContext s_ctx(queue);
+        s_ctx.handles = begin_handles(&interner);
+        serialize_message(s_ctx);
+        commit_handles(s_ctx);
+        return queue.bytes.size() - start;
+    }
+
+    template <typename T>
+    T receive() {
+        DeserializeContext d_ctx(queue);
+        d_ctx.handles = &table;
+        T value{};
+        deserialize(&value, d_ctx);
+        return value;
+    }
+};
+
+template <typename T>
+std::size_t send_value(Channel& channel, T value) {
+    return channel.send([&](SerializeContext& ctx) { serialize(&value, ctx); });
+}
+
+} // namespace
+
+TEST_CASE("Counts are sent as varints", "[compact_encoding]") {
+    Channel channel;
+    CHECK(send_value<std::uint32_t>(channel, 0) == 1);
+    CHECK(send_value<std::uint32_t>(channel, 127) == 1);
+    CHECK(send_value<std::uint32_t>(channel, 128) == 2);
+    CHECK(send_value<std::uint32_t>(channel, UINT32_MAX) == 5);
+
+    CHECK(channel.receive<std::uint32_t>() == 0);
+    CHECK(channel.receive<std::uint32_t>() == 127);
+    CHECK(channel.receive<std::uint32_t>() == 128);
+    CHECK(channel.receive<std::uint32_t>() == UINT32_MAX);
+    CHECK(channel.queue.unread() == 0);
+}
+
+TEST_CASE("Other integers keep their size", "[compact_encoding]") {
+    Channel channel;
+    CHECK(send_value<XrTime>(channel, 5) == sizeof(XrTime));
+    CHECK(send_value<XrPath>(channel, 5) == sizeof(XrPath));
+    CHECK(send_value<float>(channel, 0.5f) == sizeof(float));
+
+    CHECK(channel.receive<XrTime>() == 5);
+    CHECK(channel.receive<XrPath>() == 5);
+    CHECK(channel.receive<float>() == 0.5f);
+}
+
+TEST_CASE("Negative enum values stay small", "[compact_encoding]") {
+    Channel channel;
+    CHECK(send_value(channel, XR_SUCCESS) == 1);
+    CHECK(send_value(channel, XR_ERROR_HANDLE_INVALID) == 1);
+
+    CHECK(channel.receive<XrResult>() == XR_SUCCESS);
+    CHECK(channel.receive<XrResult>() == XR_ERROR_HANDLE_INVALID);
+}
+
+TEST_CASE("Struct types are sent as struct codes", "[compact_encoding]") {
+    Channel channel;
+    CHECK(send_value(channel, XR_TYPE_UNKNOWN) == 1);
+    CHECK(send_value(channel, XR_TYPE_SPACE_LOCATION) == 1);
+    CHECK(send_value(channel, XR_TYPE_HAND_JOINT_LOCATIONS_EXT) == 1);
+    CHECK(send_value(channel, XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE) <= 3);
+
+    CHECK(channel.receive<XrStructureType>() == XR_TYPE_UNKNOWN);
+    CHECK(channel.receive<XrStructureType>() == XR_TYPE_SPACE_LOCATION);
+    CHECK(channel.receive<XrStructureType>() == XR_TYPE_HAND_JOINT_LOCATIONS_EXT);
+    CHECK(channel.receive<XrStructureType>() == XR_TYPE_DIGITAL_LENS_CONTROL_ALMALENCE);
+}
+
+TEST_CASE("Every struct code maps back to its type", "[compact_encoding]") {
+    for (std::size_t i = 0; i < COMPACT_STRUCT_TYPE_COUNT; i++) {
+        XrStructureType type = COMPACT_STRUCT_TYPES[i];
+        CHECK(struct_type_code(type) < 128);
+        CHECK(struct_type_from_code(struct_type_code(type)) == type);
+    }
+    XrStructureType unusual = static_cast<XrStructureType>(12345);
+    CHECK(struct_type_from_code(struct_type_code(unusual)) == unusual);
+    CHECK_THROWS_AS(struct_type_from_code(64 + COMPACT_STRUCT_TYPE_COUNT), CompactEncodingException);
+}
+
+TEST_CASE("Repeated handles are sent as ids", "[compact_encoding]") {
+    Channel channel;
+    XrSpace space = reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x7f0012345678));
+    XrSession session = reinterpret_cast<XrSession>(static_cast<std::uintptr_t>(0x7f0087654321));
+
+    CHECK(send_value(channel, space) == 1 + sizeof(std::uint64_t));
+    CHECK(send_value(channel, space) == 1);
+    CHECK(send_value(channel, session) == 1 + sizeof(std::uint64_t));
+    CHECK(send_value<XrSpace>(channel, XR_NULL_HANDLE) == 1);
+
+    CHECK(channel.receive<XrSpace>() == space);
+    CHECK(channel.receive<XrSpace>() == space);
+    CHECK(channel.receive<XrSession>() == session);
+    CHECK(channel.receive<XrSpace>() == XR_NULL_HANDLE);
+    CHECK(channel.interner.size() == 2);
+    CHECK(channel.table.size() == 2);
+}
+
+TEST_CASE("Handles of unsent messages are not assigned ids", "[compact_encoding]") {
+    Channel channel;
+    XrSpace space = reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x7f0012345678));
+
+    // serialized, but never sent
+    ByteQueue dropped;
+    SerializeContext s_ctx(dropped);
+    s_ctx.handles = begin_handles(&channel.interner);
+    serialize(&space, s_ctx);
+    CHECK(channel.interner.size() == 1);
+
+    CHECK(send_value(channel, space) == 1 + sizeof(std::uint64_t));
+    CHECK(channel.receive<XrSpace>() == space);
+    CHECK(channel.interner.size() == 1);
+    CHECK(channel.table.size() == 1);
+}
+
+TEST_CASE("Arrays of handles are copied, not borrowed", "[compact_encoding]") {
+    Channel channel;
+    std::vector<XrSpace> spaces = {
+        reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x7f0000001000)),
+        reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x7f0000002000)),
+        reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x7f0000001000)),
+    };
+    channel.send([&](SerializeContext& ctx) { serialize_ptr(spaces.data(), spaces.size(), ctx); });
+
+    BorrowScope scope;
+    DeserializeContext d_ctx(channel.queue);
+    d_ctx.handles = &channel.table;
+    const XrSpace* received{};
+    deserialize_ptr(&received, d_ctx);
+    REQUIRE(received);
+    CHECK(!scope.is_borrowed(received));
+    CHECK(std::memcmp(received, spaces.data(), sizeof(XrSpace) * spaces.size()) == 0);
+    cleanup_ptr(received, spaces.size());
+}
+
+TEST_CASE("Unknown handle ids are rejected", "[compact_encoding]") {
+    ByteQueue queue;
+    std::uint8_t tag = (5 << 1) | 1;
+    queue.bytes.push_back(tag);
+
+    HandleTable table;
+    DeserializeContext d_ctx(queue);
+    d_ctx.handles = &table;
+    XrSpace space{};
+    CHECK_THROWS_AS(deserialize(&space, d_ctx), CompactEncodingException);
+}
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/delta_encoding.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Encodes params the same way the generated RPC stubs do, returns the encoded size
+std::size_t send(DeltaEncoder& encoder, ByteQueue& queue, std::uint32_t function_id, const std::vector<std::uint8_t>& params) {
+    queue.clear();
+    DeltaWriteStream params_out(queue, &encoder, function_id);
+    asio::write(params_out, asio::buffer(params));
+    params_out.finish();
+    return queue.bytes.size();
+}
+
+} // namespace
+
+TEST_CASE("Delta encoding sends only changed bytes", "[serialization][delta]") {
+    DeltaEncoder encoder;
+    DeltaDecoder decoder;
+    ByteQueue queue;
+
+    std::vector<std::uint8_t> params(256);
+    for (std::size_t i = 0; i < params.size(); i++) {
+        params[i] = static_cast<std::uint8_t>(i * 7);
+    }
+
+    // first call has no history and is sent in full
+    std::size_t first_size = send(encoder, queue, 43, params);
+    REQUIRE(first_size > params.size());
+    REQUIRE(decoder.decode(43, queue) == params);
+
+    // a single changed field (e.g. the display time) only costs a few bytes
+    params[100] ^= 0xFF;
+    params[101] ^= 0xFF;
+    std::size_t delta_size = send(encoder, queue, 43, params);
+    REQUIRE(delta_size < 16);
+    REQUIRE(decoder.decode(43, queue) == params);
+
+    // identical params cost almost nothing
+    std::size_t same_size = send(encoder, queue, 43, params);
+    REQUIRE(same_size < 10);
+    REQUIRE(decoder.decode(43, queue) == params);
+}
+
+TEST_CASE("Delta encoding round-trips random params", "[serialization][delta]") {
+    DeltaEncoder encoder;
+    DeltaDecoder decoder;
+    ByteQueue queue;
+    std::mt19937 rng(1234);
+
+    // more handles than slots, alternating functions, growing and shrinking params
+    std::vector<std::vector<std::uint8_t>> last_params(DELTA_SLOTS_PER_FUNCTION + 2);
+    for (int round = 0; round < 2000; round++) {
+        std::uint32_t function_id = rng() % 3;
+        std::size_t handle = rng() % last_params.size();
+        std::vector<std::uint8_t>& params = last_params[handle];
+
+        if (params.empty() || rng() % 8 == 0) {
+            params.resize(9 + rng() % 200);
+        }
+        std::uint64_t handle_value = handle;
+        std::memcpy(params.data(), &handle_value, sizeof(handle_value));
+        int changes = rng() % 6;
+        for (int i = 0; i < changes; i++) {
+            params[8 + rng() % (params.size() - 8)] = static_cast<std::uint8_t>(rng());
+        }
+
+        send(encoder, queue, function_id, params);
+        REQUIRE(decoder.decode(function_id, queue) == params);
+        REQUIRE(queue.read_pos == queue.bytes.size());
+    }
+}
+
+TEST_CASE("Delta write stream passes through when disabled", "[serialization][delta]") {
+    ByteQueue queue;
+    std::vector<std::uint8_t> params{1, 2, 3, 4};
+
+    DeltaWriteStream params_out(queue, nullptr, 43);
+    asio::write(params_out, asio::buffer(params));
+    params_out.finish();
+
+    REQUIRE(queue.bytes == params);
+}
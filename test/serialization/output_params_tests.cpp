@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+TEST_CASE("Pure output params are sent as their length", "[output_params]") {
+    ByteQueue queue;
+    std::uint32_t count_output = 0xDEADBEEF;
+    float buffer[16];
+    std::memset(buffer, 0xFF, sizeof(buffer));
+    {
+        SerializeContext s_ctx(queue);
+        serialize_output_ptr(&count_output, 1, s_ctx);
+        serialize_output_ptr(buffer, 16, s_ctx);
+        serialize_output_ptr<float>(nullptr, 16, s_ctx);
+    }
+    CHECK(queue.bytes.size() == 3 * sizeof(std::uint32_t));
+
+    DeserializeContext d_ctx(queue);
+    std::uint32_t* count_result{};
+    float* buffer_result{};
+    float* null_result{};
+    CHECK(deserialize_output_ptr(&count_result, d_ctx) == 1);
+    CHECK(deserialize_output_ptr(&buffer_result, d_ctx) == 16);
+    CHECK(deserialize_output_ptr(&null_result, d_ctx) == 0);
+    CHECK(queue.unread() == 0);
+
+    // allocated and zeroed for the runtime to fill in
+    REQUIRE(count_result);
+    CHECK(*count_result == 0);
+    REQUIRE(buffer_result);
+    for (std::size_t i = 0; i < 16; i++) {
+        CHECK(buffer_result[i] == 0.0f);
+    }
+    CHECK(null_result == nullptr);
+
+    cleanup_ptr(count_result, 1);
+    cleanup_ptr(buffer_result, 16);
+}
+
+TEST_CASE("Pure output XR structs keep their type and next chain", "[output_params]") {
+    ByteQueue queue;
+    // any registered struct works as a chain element, the serializer doesn't check structextends
+    XrViewConfigurationView chained{XR_TYPE_VIEW_CONFIGURATION_VIEW};
+    chained.recommendedImageRectWidth = 1832;
+    XrViewConfigurationView views[2]{};
+    for (auto& view : views) {
+        view.type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+        view.recommendedImageRectWidth = 0xFFFFFFFF;
+        view.maxSwapchainSampleCount = 0xFFFFFFFF;
+    }
+    views[1].next = &chained;
+
+    std::size_t chained_size;
+    {
+        ByteQueue chain_queue;
+        SerializeContext s_ctx(chain_queue);
+        serialize_xr(&chained, s_ctx);
+        chained_size = chain_queue.bytes.size();
+    }
+    {
+        SerializeContext s_ctx(queue);
+        serialize_output_xr_ptr(views, 2, s_ctx);
+    }
+    // length, then type and terminated next chain of each element
+    std::size_t null_next_size = sizeof(XrStructureType);
+    CHECK(queue.bytes.size() ==
+        sizeof(std::uint32_t) + 2 * sizeof(XrStructureType) + null_next_size + chained_size);
+
+    DeserializeContext d_ctx(queue);
+    XrViewConfigurationView* result{};
+    deserialize_output_xr_ptr(&result, d_ctx);
+    CHECK(queue.unread() == 0);
+
+    REQUIRE(result);
+    for (std::size_t i = 0; i < 2; i++) {
+        CHECK(result[i].type == XR_TYPE_VIEW_CONFIGURATION_VIEW);
+        CHECK(result[i].recommendedImageRectWidth == 0);
+        CHECK(result[i].maxSwapchainSampleCount == 0);
+    }
+    CHECK(result[0].next == nullptr);
+    REQUIRE(result[1].next);
+    auto* result_chained = static_cast<const XrViewConfigurationView*>(result[1].next);
+    CHECK(result_chained->type == XR_TYPE_VIEW_CONFIGURATION_VIEW);
+    // the chain is sent in full, it can carry inputs
+    CHECK(result_chained->recommendedImageRectWidth == 1832);
+
+    cleanup_ptr(result, 2);
+}
+
+TEST_CASE("Two-call arrays only return the filled elements", "[output_params]") {
+    ByteQueue queue;
+    float rates[8] = {72.0f, 90.0f, 120.0f};
+    XrViewConfigurationView views[4]{};
+    for (auto& view : views) {
+        view.type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+        view.recommendedImageRectWidth = 1832;
+    }
+    {
+        SerializeContext s_ctx(queue);
+        serialize_filled_ptr(rates, 8, 3, s_ctx);
+        // size query, and a count larger than the capacity
+        serialize_filled_ptr<float>(nullptr, 0, 3, s_ctx);
+        serialize_filled_xr_array(views, 2, 4, s_ctx);
+        serialize_filled_xr_array(views, 4, 0, s_ctx);
+    }
+
+    DeserializeContext d_ctx(queue, true, 0);
+    float rates_result[8];
+    std::memset(rates_result, 0, sizeof(rates_result));
+    deserialize_filled_ptr(rates_result, 8, d_ctx);
+    CHECK(rates_result[0] == 72.0f);
+    CHECK(rates_result[2] == 120.0f);
+    CHECK(rates_result[3] == 0.0f);
+    deserialize_filled_ptr<float>(nullptr, 0, d_ctx);
+
+    XrViewConfigurationView views_result[4]{};
+    for (auto& view : views_result) {
+        view.type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+    }
+    deserialize_filled_xr_array(views_result, 4, d_ctx);
+    CHECK(views_result[1].recommendedImageRectWidth == 1832);
+    CHECK(views_result[2].recommendedImageRectWidth == 0);
+    // nothing sent, the array is left alone
+    deserialize_filled_xr_array(views_result, 4, d_ctx);
+    CHECK(queue.unread() == 0);
+
+    // more elements than the receiving array can hold
+    {
+        SerializeContext s_ctx(queue);
+        serialize_filled_ptr(rates, 8, 3, s_ctx);
+    }
+    CHECK_THROWS(deserialize_filled_ptr(rates_result, 2, d_ctx));
+}
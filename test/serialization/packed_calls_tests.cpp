@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/packed_calls.h"
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+TEST_CASE("Packed frames have no padding", "[packed_calls]") {
+    CHECK(alignof(Request_xrLocateSpace) == 1);
+    CHECK(sizeof(Request_xrLocateSpace) == 2 * sizeof(XrSpace) + sizeof(XrTime));
+    CHECK(sizeof(Response_xrLocateSpace) ==
+        sizeof(XrResult) + sizeof(XrDuration) + sizeof(XrSpaceLocationFlags) + sizeof(XrPosef));
+    CHECK(sizeof(Request_xrApplyHapticFeedback) ==
+        sizeof(XrSession) + sizeof(XrAction) + sizeof(XrPath) + sizeof(XrDuration) + 2 * sizeof(float));
+    CHECK(sizeof(Response_xrGetActionStatePose) == sizeof(XrResult) + sizeof(XrDuration) + sizeof(XrBool32));
+}
+
+TEST_CASE("Packed frames are smaller than the generic encoding", "[packed_calls]") {
+    XrSpace space = reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x1000));
+    XrSpace base_space = reinterpret_cast<XrSpace>(static_cast<std::uintptr_t>(0x2000));
+    XrTime time = 123456789;
+    XrSpaceLocation location{XR_TYPE_SPACE_LOCATION};
+
+    ByteCounter counter;
+    SerializeContext ctx(counter);
+    serialize(&space, ctx);
+    serialize(&base_space, ctx);
+    serialize_time(&time, ctx);
+    serialize_output_xr_ptr(&location, 1, ctx);
+    CHECK(sizeof(Request_xrLocateSpace) < counter.size);
+}
+
+TEST_CASE("Packed frames keep their values through a byte copy", "[packed_calls]") {
+    Response_xrLocateSpace response{};
+    response.result = XR_SUCCESS;
+    response.runtime_duration = 1000;
+    response.location_locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    response.location_pose.orientation.w = 1.0f;
+    response.location_pose.position.y = 1.5f;
+
+    std::vector<std::uint8_t> bytes(sizeof(response));
+    std::memcpy(bytes.data(), &response, sizeof(response));
+
+    const auto* received = reinterpret_cast<const Response_xrLocateSpace*>(bytes.data());
+    CHECK(received->result == XR_SUCCESS);
+    CHECK(received->runtime_duration == 1000);
+    CHECK(received->location_locationFlags == XR_SPACE_LOCATION_POSITION_VALID_BIT);
+    XrPosef pose = received->location_pose;
+    CHECK(pose.orientation.w == 1.0f);
+    CHECK(pose.position.y == 1.5f);
+}
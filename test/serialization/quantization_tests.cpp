@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/quantization.h"
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Size of the array header written before the encoded elements
+constexpr std::size_t QUANTIZED_HEADER_SIZE =
+    sizeof(std::uint8_t) + sizeof(std::uint32_t) + 4 * sizeof(float) + sizeof(std::uint32_t);
+
+XrQuaternionf random_orientation(std::mt19937& rng) {
+    std::normal_distribution<float> normal;
+    float x = normal(rng), y = normal(rng), z = normal(rng), w = normal(rng);
+    float norm = std::sqrt(x * x + y * y + z * z + w * w);
+    return {x / norm, y / norm, z / norm, w / norm};
+}
+
+// A hand-sized cloud of joints somewhere in the play space
+std::vector<XrHandJointLocationEXT> random_hand(std::mt19937& rng, std::size_t joint_count) {
+    std::uniform_real_distribution<float> offset(-0.12f, 0.12f);
+    std::uniform_real_distribution<float> radius(0.005f, 0.02f);
+    XrVector3f center{0.3f, 1.1f, -0.4f};
+
+    std::vector<XrHandJointLocationEXT> joints(joint_count);
+    for (XrHandJointLocationEXT& joint : joints) {
+        joint.locationFlags = XR_SPACE_LOCATION_ORIENTATION_VALID_BIT | XR_SPACE_LOCATION_POSITION_VALID_BIT;
+        joint.pose.orientation = random_orientation(rng);
+        joint.pose.position = {center.x + offset(rng), center.y + offset(rng), center.z + offset(rng)};
+        joint.radius = radius(rng);
+    }
+    return joints;
+}
+
+bool quantize_hand(const std::vector<XrHandJointLocationEXT>& joints, QuantizedWriter& writer) {
+    writer.reset();
+    for (const XrHandJointLocationEXT& joint : joints) {
+        writer.include_position(joint.pose.position);
+    }
+    if (!writer.begin()) {
+        return false;
+    }
+    for (const XrHandJointLocationEXT& joint : joints) {
+        if (!writer.put_flags(joint.locationFlags) || !writer.put_pose(joint.pose) || !writer.put_float(joint.radius)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Quantized joints stay within error bounds", "[serialization][quantization]") {
+    std::mt19937 rng(1234);
+    constexpr std::size_t joint_count = XR_HAND_JOINT_COUNT_EXT;
+    constexpr std::size_t encoded_joint_size = 1 + 12 + 2;
+
+    for (int round = 0; round < 200; round++) {
+        std::vector<XrHandJointLocationEXT> joints = random_hand(rng, joint_count);
+
+        ByteQueue queue;
+        QuantizedWriter writer;
+        REQUIRE(quantize_hand(joints, writer));
+        REQUIRE(writer.size() == joint_count * encoded_joint_size);
+        SerializeContext s_ctx(queue);
+        writer.write(s_ctx);
+
+        DeserializeContext d_ctx(queue);
+        QuantizedReader reader(d_ctx);
+        reader.begin(joint_count * encoded_joint_size);
+
+        float min_x = joints[0].pose.position.x, max_x = min_x;
+        float min_y = joints[0].pose.position.y, max_y = min_y;
+        float min_z = joints[0].pose.position.z, max_z = min_z;
+        for (const XrHandJointLocationEXT& joint : joints) {
+            min_x = std::min(min_x, joint.pose.position.x);
+            max_x = std::max(max_x, joint.pose.position.x);
+            min_y = std::min(min_y, joint.pose.position.y);
+            max_y = std::max(max_y, joint.pose.position.y);
+            min_z = std::min(min_z, joint.pose.position.z);
+            max_z = std::max(max_z, joint.pose.position.z);
+        }
+        // half a quantization step, plus float rounding
+        float extent = std::max({max_x - min_x, max_y - min_y, max_z - min_z});
+        float position_max_error = extent / 65535.0f * 0.5f + 1e-6f;
+
+        for (const XrHandJointLocationEXT& joint : joints) {
+            XrHandJointLocationEXT decoded{};
+            reader.get_flags(&decoded.locationFlags);
+            reader.get_pose(&decoded.pose);
+            reader.get_float(&decoded.radius);
+
+            REQUIRE(decoded.locationFlags == joint.locationFlags);
+
+            // q and -q are the same rotation
+            const XrQuaternionf& q = joint.pose.orientation;
+            const XrQuaternionf& d = decoded.pose.orientation;
+            float sign = q.x * d.x + q.y * d.y + q.z * d.z + q.w * d.w < 0 ? -1.0f : 1.0f;
+            REQUIRE(std::fabs(q.x - sign * d.x) <= QUANTIZED_ORIENTATION_MAX_ERROR);
+            REQUIRE(std::fabs(q.y - sign * d.y) <= QUANTIZED_ORIENTATION_MAX_ERROR);
+            REQUIRE(std::fabs(q.z - sign * d.z) <= QUANTIZED_ORIENTATION_MAX_ERROR);
+            REQUIRE(std::fabs(q.w - sign * d.w) <= QUANTIZED_ORIENTATION_MAX_ERROR);
+
+            REQUIRE(std::fabs(joint.pose.position.x - decoded.pose.position.x) <= position_max_error);
+            REQUIRE(std::fabs(joint.pose.position.y - decoded.pose.position.y) <= position_max_error);
+            REQUIRE(std::fabs(joint.pose.position.z - decoded.pose.position.z) <= position_max_error);
+
+            // half floats keep 11 significant bits
+            REQUIRE(std::fabs(joint.radius - decoded.radius) <= joint.radius / 2048.0f);
+        }
+        REQUIRE(queue.read_pos == queue.bytes.size());
+    }
+}
+
+TEST_CASE("Quantization rejects values it can't encode", "[serialization][quantization]") {
+    std::mt19937 rng(1234);
+    std::vector<XrHandJointLocationEXT> joints = random_hand(rng, XR_HAND_JOINT_COUNT_EXT);
+    QuantizedWriter writer;
+    REQUIRE(quantize_hand(joints, writer));
+
+    SECTION("non-finite position") {
+        joints[3].pose.position.y = NAN;
+        REQUIRE_FALSE(quantize_hand(joints, writer));
+    }
+    SECTION("non-finite orientation") {
+        joints[3].pose.orientation.w = INFINITY;
+        REQUIRE_FALSE(quantize_hand(joints, writer));
+    }
+    SECTION("flags beyond the low 8 bits") {
+        joints[3].locationFlags = 0x100;
+        REQUIRE_FALSE(quantize_hand(joints, writer));
+    }
+    SECTION("float out of half float range") {
+        joints[3].radius = 1e6f;
+        REQUIRE_FALSE(quantize_hand(joints, writer));
+    }
+    SECTION("weight out of range") {
+        writer.reset();
+        REQUIRE(writer.begin());
+        REQUIRE(writer.put_weight(0.5f));
+        REQUIRE_FALSE(writer.put_weight(1.5f));
+        REQUIRE_FALSE(writer.put_weight(NAN));
+    }
+}
+
+TEST_CASE("Quantizable weight arrays round-trip", "[serialization][quantization]") {
+    constexpr std::uint64_t extension_bit = 1ull << 3;
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> weight(0.0f, 1.0f);
+    std::vector<float> weights(70);
+    for (float& w : weights) {
+        w = weight(rng);
+    }
+
+    auto round_trip = [&](std::uint64_t quantized_extensions, bool in_place, std::size_t& encoded_size) {
+        ByteQueue queue;
+        SerializeContext s_ctx(queue);
+        s_ctx.quantized_extensions = quantized_extensions;
+        serialize_quantizable_ptr(weights.data(), weights.size(), extension_bit, s_ctx);
+        encoded_size = queue.bytes.size();
+
+        std::vector<float> out_storage(weights.size());
+        float* out = in_place ? out_storage.data() : nullptr;
+        DeserializeContext d_ctx(queue, in_place, 0);
+        deserialize_quantizable_ptr(&out, d_ctx);
+        REQUIRE(queue.read_pos == queue.bytes.size());
+
+        std::vector<float> result(out, out + weights.size());
+        if (!in_place) {
+            std::free(out);
+        }
+        return result;
+    };
+
+    std::size_t raw_size = 0;
+    std::size_t quantized_size = 0;
+
+    SECTION("enabled for the extension") {
+        std::vector<float> result = round_trip(extension_bit, false, quantized_size);
+        REQUIRE(quantized_size == QUANTIZED_HEADER_SIZE + weights.size() * sizeof(std::uint16_t));
+        for (std::size_t i = 0; i < weights.size(); i++) {
+            REQUIRE(std::fabs(result[i] - weights[i]) <= QUANTIZED_WEIGHT_MAX_ERROR);
+        }
+    }
+    SECTION("enabled, deserialized in place") {
+        std::vector<float> result = round_trip(extension_bit, true, quantized_size);
+        for (std::size_t i = 0; i < weights.size(); i++) {
+            REQUIRE(std::fabs(result[i] - weights[i]) <= QUANTIZED_WEIGHT_MAX_ERROR);
+        }
+    }
+    SECTION("disabled for the extension") {
+        REQUIRE(round_trip(~extension_bit, false, raw_size) == weights);
+        REQUIRE(raw_size == 1 + sizeof(std::uint32_t) + weights.size() * sizeof(float));
+    }
+    SECTION("falls back to raw when a value doesn't fit") {
+        weights[10] = 1.25f;
+        REQUIRE(round_trip(extension_bit, false, raw_size) == weights);
+        REQUIRE(raw_size == 1 + sizeof(std::uint32_t) + weights.size() * sizeof(float));
+    }
+}
+
+#ifdef XRTRANSPORT_EXT_XR_EXT_hand_tracking
+TEST_CASE("Quantized hand joints round-trip through the generated serializer", "[serialization][quantization]") {
+    std::mt19937 rng(1234);
+    std::vector<XrHandJointLocationEXT> joints = random_hand(rng, XR_HAND_JOINT_COUNT_EXT);
+
+    XrHandJointLocationsEXT locations{XR_TYPE_HAND_JOINT_LOCATIONS_EXT};
+    locations.isActive = XR_TRUE;
+    locations.jointCount = XR_HAND_JOINT_COUNT_EXT;
+    locations.jointLocations = joints.data();
+
+    ByteQueue queue;
+    SerializeContext s_ctx(queue);
+    s_ctx.quantized_extensions = QUANTIZED_XR_EXT_hand_tracking;
+    serialize(&locations, s_ctx);
+
+    std::vector<XrHandJointLocationEXT> out_joints(XR_HAND_JOINT_COUNT_EXT);
+    XrHandJointLocationsEXT out{XR_TYPE_HAND_JOINT_LOCATIONS_EXT};
+    out.jointLocations = out_joints.data();
+    DeserializeContext d_ctx(queue, true, 0);
+    deserialize(&out, d_ctx);
+
+    REQUIRE(out.isActive == XR_TRUE);
+    REQUIRE(out.jointCount == XR_HAND_JOINT_COUNT_EXT);
+    for (std::size_t i = 0; i < joints.size(); i++) {
+        REQUIRE(out_joints[i].locationFlags == joints[i].locationFlags);
+        REQUIRE(std::fabs(out_joints[i].pose.position.x - joints[i].pose.position.x) < 1e-5f);
+        REQUIRE(std::fabs(out_joints[i].radius - joints[i].radius) <= joints[i].radius / 2048.0f);
+    }
+}
+#endif // XRTRANSPORT_EXT_XR_EXT_hand_tracking
+
+TEST_CASE("Quantization bandwidth", "[.benchmark][quantization]") {
+    // Bytes per frame of the arrays returned by common tracking calls, raw vs quantized.
+    // Run with: serialization_tests "[.benchmark]"
+    std::mt19937 rng(1234);
+    QuantizedWriter writer;
+    constexpr double frames_per_second = 90.0;
+
+    auto report = [&](const char* name, std::size_t raw, std::size_t quantized) {
+        std::printf("%-40s %6zu B raw %6zu B quantized (%4.1f%%), %7.1f KiB/s saved at 90 Hz\n",
+            name, raw, quantized, 100.0 * quantized / raw, (raw - quantized) * frames_per_second / 1024.0);
+    };
+
+    // two hands of XrHandJointLocationEXT
+    std::vector<XrHandJointLocationEXT> hand = random_hand(rng, XR_HAND_JOINT_COUNT_EXT);
+    REQUIRE(quantize_hand(hand, writer));
+    std::size_t hand_raw = 1 + sizeof(std::uint32_t) +
+        hand.size() * (sizeof(XrSpaceLocationFlags) + sizeof(XrPosef) + sizeof(float));
+    report("xrLocateHandJointsEXT (2 hands)", 2 * hand_raw, 2 * (QUANTIZED_HEADER_SIZE + writer.size()));
+
+    // 70 joint FB body, XrBodyJointLocationFB is flags + pose
+    std::vector<XrHandJointLocationEXT> body = random_hand(rng, 70);
+    writer.reset();
+    for (const XrHandJointLocationEXT& joint : body) {
+        writer.include_position(joint.pose.position);
+    }
+    REQUIRE(writer.begin());
+    for (const XrHandJointLocationEXT& joint : body) {
+        REQUIRE(writer.put_flags(joint.locationFlags));
+        REQUIRE(writer.put_pose(joint.pose));
+    }
+    std::size_t body_raw = 1 + sizeof(std::uint32_t) + body.size() * (sizeof(XrSpaceLocationFlags) + sizeof(XrPosef));
+    report("xrLocateBodyJointsFB (70 joints)", body_raw, QUANTIZED_HEADER_SIZE + writer.size());
+
+    // 70 face weights plus 2 confidences
+    std::vector<float> weights(70, 0.25f);
+    writer.reset();
+    REQUIRE(quantize(weights.data(), weights.size(), writer));
+    std::size_t weights_quantized = QUANTIZED_HEADER_SIZE + writer.size();
+    std::vector<float> confidences(2, 0.9f);
+    writer.reset();
+    REQUIRE(quantize(confidences.data(), confidences.size(), writer));
+    std::size_t confidences_quantized = QUANTIZED_HEADER_SIZE + writer.size();
+    std::size_t face_raw = 2 * (1 + sizeof(std::uint32_t)) + (weights.size() + confidences.size()) * sizeof(float);
+    report("xrGetFaceExpressionWeights2FB", face_raw, weights_quantized + confidences_quantized);
+}
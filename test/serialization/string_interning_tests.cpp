@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/error.h"
+#include "xrtransport/asio_compat.h"
+#include "xrtransport/util.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Both ends of one direction of a connection
+struct Channel {
+    ByteQueue queue;
+    StringInterner interner;
+    StringTable table;
+
+    // Serializes one message and returns its size
+    template <typename F>
+    std::size_t send(F&& serialize_message) {
+        std::size_t start = queue.bytes.size();
+        SerializeContext s_ctx(queue);
+        s_ctx.strings = begin_strings(&interner);
+        serialize_message(s_ctx);
+        commit_strings(s_ctx);
+        return queue.bytes.size() - start;
+    }
+
+    std::string receive() {
+        DeserializeContext d_ctx(queue);
+        d_ctx.strings = &table;
+        char* result{};
+        deserialize_string(&result, d_ctx);
+        std::string string = result ? result : "<nullptr>";
+        std::free(result);
+        return string;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Repeated strings are sent as ids", "[string_interning]") {
+    Channel channel;
+    const char* path = "/user/hand/left/input/trigger/value";
+
+    std::size_t first_size = channel.send([&](SerializeContext& ctx) { serialize_string(path, ctx); });
+    std::size_t second_size = channel.send([&](SerializeContext& ctx) { serialize_string(path, ctx); });
+    CHECK(first_size > std::strlen(path));
+    CHECK(second_size == 1);
+
+    CHECK(channel.receive() == path);
+    CHECK(channel.receive() == path);
+    CHECK(channel.queue.unread() == 0);
+    CHECK(channel.interner.size() == 1);
+    CHECK(channel.table.size() == 1);
+}
+
+TEST_CASE("Null and empty strings round trip", "[string_interning]") {
+    Channel channel;
+    channel.send([&](SerializeContext& ctx) {
+        serialize_string(nullptr, ctx);
+        serialize_string("", ctx);
+        serialize_string("", ctx);
+    });
+
+    CHECK(channel.receive() == "<nullptr>");
+    CHECK(channel.receive() == "");
+    CHECK(channel.receive() == "");
+    CHECK(channel.queue.unread() == 0);
+}
+
+TEST_CASE("Fixed size arrays are zero filled", "[string_interning]") {
+    Channel channel;
+    char name[16] = "grab_action";
+    channel.send([&](SerializeContext& ctx) {
+        serialize_string_array(name, sizeof(name), ctx);
+        serialize_string_array(name, sizeof(name), ctx);
+    });
+
+    DeserializeContext d_ctx(channel.queue);
+    d_ctx.strings = &channel.table;
+    for (int i = 0; i < 2; i++) {
+        char result[16];
+        std::memset(result, 'x', sizeof(result));
+        deserialize_string_array(result, sizeof(result), d_ctx);
+        CHECK(std::memcmp(result, name, sizeof(name)) == 0);
+    }
+
+    // strings that don't fit the receiving array are rejected
+    char full[4] = {'a', 'b', 'c', 'd'};
+    channel.send([&](SerializeContext& ctx) { serialize_string_array(full, sizeof(full), ctx); });
+    char small[3];
+    CHECK_THROWS_AS(deserialize_string_array(small, sizeof(small), d_ctx), StringInterningException);
+}
+
+TEST_CASE("Output buffers are filled in place", "[string_interning]") {
+    Channel channel;
+    char buffer[48] = "/interaction_profiles/khr/simple_controller";
+    // garbage after the terminator isn't sent
+    buffer[sizeof(buffer) - 1] = 'x';
+    channel.send([&](SerializeContext& ctx) {
+        serialize_string_buffer(buffer, sizeof(buffer), ctx);
+        serialize_string_buffer(nullptr, 0, ctx);
+    });
+
+    DeserializeContext d_ctx(channel.queue, true, 0);
+    d_ctx.strings = &channel.table;
+    char result[48];
+    std::memset(result, 'x', sizeof(result));
+    deserialize_string_buffer(result, sizeof(result), d_ctx);
+    CHECK(std::strcmp(result, buffer) == 0);
+    deserialize_string_buffer(nullptr, 0, d_ctx);
+    CHECK(channel.queue.unread() == 0);
+
+    channel.send([&](SerializeContext& ctx) { serialize_string_buffer(buffer, sizeof(buffer), ctx); });
+    char small[8];
+    CHECK_THROWS_AS(deserialize_string_buffer(small, sizeof(small), d_ctx), StringInterningException);
+}
+
+TEST_CASE("Strings of unsent messages are sent again", "[string_interning]") {
+    Channel channel;
+    const char* name = "teleport";
+
+    // serialized, but never sent
+    SerializeContext s_ctx(channel.queue);
+    s_ctx.strings = begin_strings(&channel.interner);
+    serialize_string(name, s_ctx);
+    channel.queue.bytes.clear();
+
+    std::size_t size = channel.send([&](SerializeContext& ctx) { serialize_string(name, ctx); });
+    CHECK(size > std::strlen(name));
+    CHECK(channel.receive() == name);
+    CHECK(channel.interner.size() == 1);
+    CHECK(channel.table.size() == 1);
+}
+
+TEST_CASE("Long strings are not interned", "[string_interning]") {
+    Channel channel;
+    std::string long_string(MAX_INTERNED_STRING_SIZE + 1, 'a');
+
+    std::size_t first_size = channel.send([&](SerializeContext& ctx) { serialize_string(long_string.c_str(), ctx); });
+    std::size_t second_size = channel.send([&](SerializeContext& ctx) { serialize_string(long_string.c_str(), ctx); });
+    CHECK(first_size == second_size);
+
+    CHECK(channel.receive() == long_string);
+    CHECK(channel.receive() == long_string);
+    CHECK(channel.interner.size() == 0);
+    CHECK(channel.table.size() == 0);
+}
+
+TEST_CASE("Unknown string ids are rejected", "[string_interning]") {
+    ByteQueue queue;
+    std::uint8_t tag = (5 << 1) | 1;
+    queue.bytes.push_back(tag);
+
+    StringTable table;
+    DeserializeContext d_ctx(queue);
+    d_ctx.strings = &table;
+    const char* result{};
+    CHECK_THROWS_AS(deserialize_string(&result, d_ctx), StringInterningException);
+}
+
+TEST_CASE("Interned strings are borrowed from the table", "[string_interning]") {
+    Channel channel;
+    const char* name = "/user/hand/right";
+    channel.send([&](SerializeContext& ctx) {
+        serialize_string(name, ctx);
+        serialize_string(name, ctx);
+    });
+
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(channel.queue);
+    d_ctx.strings = &channel.table;
+    const char* first{};
+    const char* second{};
+    deserialize_string(&first, d_ctx);
+    deserialize_string(&second, d_ctx);
+
+    CHECK(first == second);
+    CHECK(first == channel.table.get(0).c_str());
+    CHECK(borrow_scope.is_borrowed(first));
+
+    // must not be freed
+    cleanup_ptr(first, count_null_terminated(first));
+    cleanup_ptr(second, count_null_terminated(second));
+}
+
+TEST_CASE("Strings use the plain encoding without a string table", "[string_interning]") {
+    const char* name = "/user/head";
+    ByteQueue plain;
+    SerializeContext plain_ctx(plain);
+    serialize_ptr(name, count_null_terminated(name), plain_ctx);
+
+    ByteQueue legacy;
+    SerializeContext legacy_ctx(legacy);
+    serialize_string(name, legacy_ctx);
+    CHECK(legacy.bytes == plain.bytes);
+
+    DeserializeContext d_ctx(legacy);
+    const char* result{};
+    deserialize_string(&result, d_ctx);
+    CHECK(std::strcmp(result, name) == 0);
+    cleanup_ptr(result, count_null_terminated(result));
+}
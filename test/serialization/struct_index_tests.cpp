@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/struct_index.h"
+#include "xrtransport/serialization/struct_size.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using namespace xrtransport;
+
+namespace {
+
+constexpr bool all_indices_in_range() {
+    for (XrStructureType struct_type : indexed_struct_types) {
+        if (struct_type_index(struct_type) >= struct_table_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Two different types sharing a slot would make one of them look up the other's entry
+constexpr bool all_indices_distinct() {
+    std::array<XrStructureType, struct_table_size + 1> owners{};
+    for (XrStructureType struct_type : indexed_struct_types) {
+        XrStructureType& owner = owners[struct_type_index(struct_type)];
+        if (owner != XR_TYPE_UNKNOWN && owner != struct_type) {
+            return false;
+        }
+        owner = struct_type;
+    }
+    return true;
+}
+
+constexpr XrStructureType as_type(std::int64_t value) {
+    return static_cast<XrStructureType>(value);
+}
+
+constexpr StructTableEntry<int> test_entries[] = {
+    {XR_TYPE_INSTANCE_CREATE_INFO, 1},
+    {XR_TYPE_VIEW_STATE, 2},
+    {XR_TYPE_INSTANCE_CREATE_INFO, 1},
+};
+
+constexpr auto test_table = make_struct_table(test_entries);
+
+} // namespace
+
+static_assert(all_indices_in_range(), "every indexed struct type has a slot in the table");
+static_assert(all_indices_distinct(), "indexed struct types do not share slots");
+
+// Core types index the table directly
+static_assert(struct_type_index(XR_TYPE_INSTANCE_CREATE_INFO) == static_cast<std::size_t>(XR_TYPE_INSTANCE_CREATE_INFO), "");
+static_assert(struct_type_index(XR_TYPE_VIEW_STATE) == static_cast<std::size_t>(XR_TYPE_VIEW_STATE), "");
+
+// Values outside every indexed range map to the reserved unknown slot
+static_assert(struct_type_index(as_type(-1)) == struct_table_size, "");
+static_assert(struct_type_index(XR_STRUCTURE_TYPE_MAX_ENUM) == struct_table_size, "");
+static_assert(struct_type_index(as_type(struct_index_detail::extension_type_base - 1)) == struct_table_size, "");
+static_assert(struct_type_index(as_type(
+    struct_index_detail::extension_type_base +
+    static_cast<std::int64_t>(struct_index_detail::extension_slot_count) * struct_index_detail::extension_type_stride))
+    == struct_table_size, "");
+
+static_assert(test_table[struct_type_index(XR_TYPE_INSTANCE_CREATE_INFO)] == 1, "");
+static_assert(test_table[struct_type_index(XR_TYPE_VIEW_STATE)] == 2, "");
+static_assert(test_table[struct_type_index(XR_TYPE_SESSION_CREATE_INFO)] == 0, "");
+static_assert(test_table[struct_type_index(as_type(-1))] == 0, "");
+static_assert(test_table[struct_table_size] == 0, "");
+
+#ifdef XRTRANSPORT_EXT_XR_EXT_debug_utils
+static_assert(struct_type_index(XR_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT) < struct_table_size, "");
+static_assert(struct_type_index(XR_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT) >= struct_index_detail::core_count, "");
+#endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
+
+TEST_CASE("size_lookup returns the size of each indexed struct", "[struct_index]") {
+    CHECK(size_lookup(XR_TYPE_INSTANCE_CREATE_INFO) == sizeof(XrInstanceCreateInfo));
+    CHECK(size_lookup(XR_TYPE_SESSION_CREATE_INFO) == sizeof(XrSessionCreateInfo));
+    CHECK(size_lookup(XR_TYPE_FRAME_STATE) == sizeof(XrFrameState));
+    CHECK(size_lookup(XR_TYPE_VIEW_STATE) == sizeof(XrViewState));
+    CHECK(size_lookup(XR_TYPE_COMPOSITION_LAYER_PROJECTION) == sizeof(XrCompositionLayerProjection));
+    CHECK(size_lookup(XR_TYPE_EVENT_DATA_BUFFER) == sizeof(XrEventDataBuffer));
+
+#ifdef XRTRANSPORT_EXT_XR_EXT_debug_utils
+    CHECK(size_lookup(XR_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT) == sizeof(XrDebugUtilsMessengerCreateInfoEXT));
+    CHECK(size_lookup(XR_TYPE_DEBUG_UTILS_LABEL_EXT) == sizeof(XrDebugUtilsLabelEXT));
+#endif // XRTRANSPORT_EXT_XR_EXT_debug_utils
+}
+
+TEST_CASE("size_lookup rejects unknown struct types", "[struct_index]") {
+    CHECK(size_lookup(XR_TYPE_UNKNOWN) == 0);
+    CHECK(size_lookup(as_type(-1)) == 0);
+    CHECK(size_lookup(XR_STRUCTURE_TYPE_MAX_ENUM) == 0);
+    CHECK(size_lookup(as_type(struct_index_detail::extension_type_base - 1)) == 0);
+    CHECK(size_lookup(as_type(struct_index_detail::extension_type_base + 999)) == 0);
+
+    // every slot between the indexed types is empty
+    for (std::size_t i = 0; i < struct_index_detail::core_count; i++) {
+        XrStructureType struct_type = as_type(static_cast<std::int64_t>(i));
+        bool indexed = false;
+        for (XrStructureType indexed_type : indexed_struct_types) {
+            indexed = indexed || indexed_type == struct_type;
+        }
+        if (!indexed) {
+            CHECK(size_lookup(struct_type) == 0);
+        }
+    }
+}
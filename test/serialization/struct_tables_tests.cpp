@@ -0,0 +1,2224 @@
+/*
+ * AUTO-GENERATED FILE - DO NOT EDIT DIRECTLY
+ *
+ * This file was automatically generated by the code_generation module.
+ * Any changes made to this file will be lost when regenerated.
+ *
+ * To modify this file, edit the corresponding template in:
+ * code_generation/templates/test/struct_tables_tests.mako
+ */
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+// Checks that the field tables of struct_tables.cpp produce the same bytes as the generated struct
+// serializers, for a random value of every core struct. The tables are the ones struct_tables.cpp is
+// generated with, and the values are generated the same way as in fuzzer.cpp.
+//
+// With XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION, serialize itself walks these tables, so there is nothing
+// to compare them to and the checks are compiled out.
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/table_serialization.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstddef>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+#ifndef XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
+
+namespace {
+
+constexpr FieldDescriptor fields_XrActionCreateInfo[] = {
+    FIELD_VALUE(XrActionCreateInfo, type),
+    FIELD_XR(XrActionCreateInfo, next),
+    FIELD_STRING_ARRAY(XrActionCreateInfo, actionName),
+    FIELD_VALUE(XrActionCreateInfo, actionType),
+    FIELD_VALUE(XrActionCreateInfo, countSubactionPaths),
+    FIELD_PTR(XrActionCreateInfo, subactionPaths, countSubactionPaths),
+    FIELD_STRING_ARRAY(XrActionCreateInfo, localizedActionName),
+};
+
+constexpr FieldDescriptor fields_XrActionSetCreateInfo[] = {
+    FIELD_VALUE(XrActionSetCreateInfo, type),
+    FIELD_XR(XrActionSetCreateInfo, next),
+    FIELD_STRING_ARRAY(XrActionSetCreateInfo, actionSetName),
+    FIELD_STRING_ARRAY(XrActionSetCreateInfo, localizedActionSetName),
+    FIELD_VALUE(XrActionSetCreateInfo, priority),
+};
+
+constexpr FieldDescriptor fields_XrActionSpaceCreateInfo[] = {
+    FIELD_VALUE(XrActionSpaceCreateInfo, type),
+    FIELD_XR(XrActionSpaceCreateInfo, next),
+    FIELD_VALUE(XrActionSpaceCreateInfo, action),
+    FIELD_VALUE(XrActionSpaceCreateInfo, subactionPath),
+    FIELD_VALUE(XrActionSpaceCreateInfo, poseInActionSpace),
+};
+
+constexpr FieldDescriptor fields_XrActionStateBoolean[] = {
+    FIELD_VALUE(XrActionStateBoolean, type),
+    FIELD_XR(XrActionStateBoolean, next),
+    FIELD_VALUE(XrActionStateBoolean, currentState),
+    FIELD_VALUE(XrActionStateBoolean, changedSinceLastSync),
+    FIELD_TIME(XrActionStateBoolean, lastChangeTime),
+    FIELD_VALUE(XrActionStateBoolean, isActive),
+};
+
+constexpr FieldDescriptor fields_XrActionStateFloat[] = {
+    FIELD_VALUE(XrActionStateFloat, type),
+    FIELD_XR(XrActionStateFloat, next),
+    FIELD_VALUE(XrActionStateFloat, currentState),
+    FIELD_VALUE(XrActionStateFloat, changedSinceLastSync),
+    FIELD_TIME(XrActionStateFloat, lastChangeTime),
+    FIELD_VALUE(XrActionStateFloat, isActive),
+};
+
+constexpr FieldDescriptor fields_XrActionStateGetInfo[] = {
+    FIELD_VALUE(XrActionStateGetInfo, type),
+    FIELD_XR(XrActionStateGetInfo, next),
+    FIELD_VALUE(XrActionStateGetInfo, action),
+    FIELD_VALUE(XrActionStateGetInfo, subactionPath),
+};
+
+constexpr FieldDescriptor fields_XrActionStatePose[] = {
+    FIELD_VALUE(XrActionStatePose, type),
+    FIELD_XR(XrActionStatePose, next),
+    FIELD_VALUE(XrActionStatePose, isActive),
+};
+
+constexpr FieldDescriptor fields_XrActionStateVector2f[] = {
+    FIELD_VALUE(XrActionStateVector2f, type),
+    FIELD_XR(XrActionStateVector2f, next),
+    FIELD_VALUE(XrActionStateVector2f, currentState),
+    FIELD_VALUE(XrActionStateVector2f, changedSinceLastSync),
+    FIELD_TIME(XrActionStateVector2f, lastChangeTime),
+    FIELD_VALUE(XrActionStateVector2f, isActive),
+};
+
+constexpr FieldDescriptor fields_XrActionSuggestedBinding[] = {
+    FIELD_VALUE(XrActionSuggestedBinding, action),
+    FIELD_VALUE(XrActionSuggestedBinding, binding),
+};
+
+constexpr FieldDescriptor fields_XrActionsSyncInfo[] = {
+    FIELD_VALUE(XrActionsSyncInfo, type),
+    FIELD_XR(XrActionsSyncInfo, next),
+    FIELD_VALUE(XrActionsSyncInfo, countActiveActionSets),
+    FIELD_PTR(XrActionsSyncInfo, activeActionSets, countActiveActionSets),
+};
+
+constexpr FieldDescriptor fields_XrActiveActionSet[] = {
+    FIELD_VALUE(XrActiveActionSet, actionSet),
+    FIELD_VALUE(XrActiveActionSet, subactionPath),
+};
+
+constexpr FieldDescriptor fields_XrApiLayerProperties[] = {
+    FIELD_VALUE(XrApiLayerProperties, type),
+    FIELD_XR(XrApiLayerProperties, next),
+    FIELD_STRING_ARRAY(XrApiLayerProperties, layerName),
+    FIELD_VALUE(XrApiLayerProperties, specVersion),
+    FIELD_VALUE(XrApiLayerProperties, layerVersion),
+    FIELD_STRING_ARRAY(XrApiLayerProperties, description),
+};
+
+constexpr FieldDescriptor fields_XrApplicationInfo[] = {
+    FIELD_STRING_ARRAY(XrApplicationInfo, applicationName),
+    FIELD_VALUE(XrApplicationInfo, applicationVersion),
+    FIELD_STRING_ARRAY(XrApplicationInfo, engineName),
+    FIELD_VALUE(XrApplicationInfo, engineVersion),
+    FIELD_VALUE(XrApplicationInfo, apiVersion),
+};
+
+constexpr FieldDescriptor fields_XrBodySkeletonJointHTC[] = {
+    FIELD_VALUE(XrBodySkeletonJointHTC, pose),
+};
+
+constexpr FieldDescriptor fields_XrBoundSourcesForActionEnumerateInfo[] = {
+    FIELD_VALUE(XrBoundSourcesForActionEnumerateInfo, type),
+    FIELD_XR(XrBoundSourcesForActionEnumerateInfo, next),
+    FIELD_VALUE(XrBoundSourcesForActionEnumerateInfo, action),
+};
+
+constexpr FieldDescriptor fields_XrBoxf[] = {
+    FIELD_VALUE(XrBoxf, center),
+    FIELD_VALUE(XrBoxf, extents),
+};
+
+constexpr FieldDescriptor fields_XrColor3f[] = {
+    FIELD_VALUE(XrColor3f, r),
+    FIELD_VALUE(XrColor3f, g),
+    FIELD_VALUE(XrColor3f, b),
+};
+
+constexpr FieldDescriptor fields_XrColor4f[] = {
+    FIELD_VALUE(XrColor4f, r),
+    FIELD_VALUE(XrColor4f, g),
+    FIELD_VALUE(XrColor4f, b),
+    FIELD_VALUE(XrColor4f, a),
+};
+
+constexpr FieldDescriptor fields_XrCompositionLayerProjection[] = {
+    FIELD_VALUE(XrCompositionLayerProjection, type),
+    FIELD_XR(XrCompositionLayerProjection, next),
+    FIELD_VALUE(XrCompositionLayerProjection, layerFlags),
+    FIELD_VALUE(XrCompositionLayerProjection, space),
+    FIELD_VALUE(XrCompositionLayerProjection, viewCount),
+    FIELD_PTR(XrCompositionLayerProjection, views, viewCount),
+};
+
+constexpr FieldDescriptor fields_XrCompositionLayerProjectionView[] = {
+    FIELD_VALUE(XrCompositionLayerProjectionView, type),
+    FIELD_XR(XrCompositionLayerProjectionView, next),
+    FIELD_VALUE(XrCompositionLayerProjectionView, pose),
+    FIELD_VALUE(XrCompositionLayerProjectionView, fov),
+    FIELD_VALUE(XrCompositionLayerProjectionView, subImage),
+};
+
+constexpr FieldDescriptor fields_XrCompositionLayerQuad[] = {
+    FIELD_VALUE(XrCompositionLayerQuad, type),
+    FIELD_XR(XrCompositionLayerQuad, next),
+    FIELD_VALUE(XrCompositionLayerQuad, layerFlags),
+    FIELD_VALUE(XrCompositionLayerQuad, space),
+    FIELD_VALUE(XrCompositionLayerQuad, eyeVisibility),
+    FIELD_VALUE(XrCompositionLayerQuad, subImage),
+    FIELD_VALUE(XrCompositionLayerQuad, pose),
+    FIELD_VALUE(XrCompositionLayerQuad, size),
+};
+
+constexpr FieldDescriptor fields_XrEventDataBuffer[] = {
+    FIELD_VALUE(XrEventDataBuffer, type),
+    FIELD_XR(XrEventDataBuffer, next),
+    FIELD_ARRAY(XrEventDataBuffer, varying),
+};
+
+constexpr FieldDescriptor fields_XrEventDataEventsLost[] = {
+    FIELD_VALUE(XrEventDataEventsLost, type),
+    FIELD_XR(XrEventDataEventsLost, next),
+    FIELD_VALUE(XrEventDataEventsLost, lostEventCount),
+};
+
+constexpr FieldDescriptor fields_XrEventDataInstanceLossPending[] = {
+    FIELD_VALUE(XrEventDataInstanceLossPending, type),
+    FIELD_XR(XrEventDataInstanceLossPending, next),
+    FIELD_TIME(XrEventDataInstanceLossPending, lossTime),
+};
+
+constexpr FieldDescriptor fields_XrEventDataInteractionProfileChanged[] = {
+    FIELD_VALUE(XrEventDataInteractionProfileChanged, type),
+    FIELD_XR(XrEventDataInteractionProfileChanged, next),
+    FIELD_VALUE(XrEventDataInteractionProfileChanged, session),
+};
+
+constexpr FieldDescriptor fields_XrEventDataReferenceSpaceChangePending[] = {
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, type),
+    FIELD_XR(XrEventDataReferenceSpaceChangePending, next),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, session),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, referenceSpaceType),
+    FIELD_TIME(XrEventDataReferenceSpaceChangePending, changeTime),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, poseValid),
+    FIELD_VALUE(XrEventDataReferenceSpaceChangePending, poseInPreviousSpace),
+};
+
+constexpr FieldDescriptor fields_XrEventDataSessionStateChanged[] = {
+    FIELD_VALUE(XrEventDataSessionStateChanged, type),
+    FIELD_XR(XrEventDataSessionStateChanged, next),
+    FIELD_VALUE(XrEventDataSessionStateChanged, session),
+    FIELD_VALUE(XrEventDataSessionStateChanged, state),
+    FIELD_TIME(XrEventDataSessionStateChanged, time),
+};
+
+constexpr FieldDescriptor fields_XrExtensionProperties[] = {
+    FIELD_VALUE(XrExtensionProperties, type),
+    FIELD_XR(XrExtensionProperties, next),
+    FIELD_STRING_ARRAY(XrExtensionProperties, extensionName),
+    FIELD_VALUE(XrExtensionProperties, extensionVersion),
+};
+
+constexpr FieldDescriptor fields_XrExtent2Df[] = {
+    FIELD_VALUE(XrExtent2Df, width),
+    FIELD_VALUE(XrExtent2Df, height),
+};
+
+constexpr FieldDescriptor fields_XrExtent2Di[] = {
+    FIELD_VALUE(XrExtent2Di, width),
+    FIELD_VALUE(XrExtent2Di, height),
+};
+
+constexpr FieldDescriptor fields_XrExtent3Df[] = {
+    FIELD_VALUE(XrExtent3Df, width),
+    FIELD_VALUE(XrExtent3Df, height),
+    FIELD_VALUE(XrExtent3Df, depth),
+};
+
+constexpr FieldDescriptor fields_XrFovf[] = {
+    FIELD_VALUE(XrFovf, angleLeft),
+    FIELD_VALUE(XrFovf, angleRight),
+    FIELD_VALUE(XrFovf, angleUp),
+    FIELD_VALUE(XrFovf, angleDown),
+};
+
+constexpr FieldDescriptor fields_XrFrameBeginInfo[] = {
+    FIELD_VALUE(XrFrameBeginInfo, type),
+    FIELD_XR(XrFrameBeginInfo, next),
+};
+
+constexpr FieldDescriptor fields_XrFrameState[] = {
+    FIELD_VALUE(XrFrameState, type),
+    FIELD_XR(XrFrameState, next),
+    FIELD_TIME(XrFrameState, predictedDisplayTime),
+    FIELD_VALUE(XrFrameState, predictedDisplayPeriod),
+    FIELD_VALUE(XrFrameState, shouldRender),
+};
+
+constexpr FieldDescriptor fields_XrFrameWaitInfo[] = {
+    FIELD_VALUE(XrFrameWaitInfo, type),
+    FIELD_XR(XrFrameWaitInfo, next),
+};
+
+constexpr FieldDescriptor fields_XrFrustumf[] = {
+    FIELD_VALUE(XrFrustumf, pose),
+    FIELD_VALUE(XrFrustumf, fov),
+    FIELD_VALUE(XrFrustumf, nearZ),
+    FIELD_VALUE(XrFrustumf, farZ),
+};
+
+constexpr FieldDescriptor fields_XrHapticActionInfo[] = {
+    FIELD_VALUE(XrHapticActionInfo, type),
+    FIELD_XR(XrHapticActionInfo, next),
+    FIELD_VALUE(XrHapticActionInfo, action),
+    FIELD_VALUE(XrHapticActionInfo, subactionPath),
+};
+
+constexpr FieldDescriptor fields_XrHapticVibration[] = {
+    FIELD_VALUE(XrHapticVibration, type),
+    FIELD_XR(XrHapticVibration, next),
+    FIELD_VALUE(XrHapticVibration, duration),
+    FIELD_VALUE(XrHapticVibration, frequency),
+    FIELD_VALUE(XrHapticVibration, amplitude),
+};
+
+constexpr FieldDescriptor fields_XrInputSourceLocalizedNameGetInfo[] = {
+    FIELD_VALUE(XrInputSourceLocalizedNameGetInfo, type),
+    FIELD_XR(XrInputSourceLocalizedNameGetInfo, next),
+    FIELD_VALUE(XrInputSourceLocalizedNameGetInfo, sourcePath),
+    FIELD_VALUE(XrInputSourceLocalizedNameGetInfo, whichComponents),
+};
+
+constexpr FieldDescriptor fields_XrInstanceProperties[] = {
+    FIELD_VALUE(XrInstanceProperties, type),
+    FIELD_XR(XrInstanceProperties, next),
+    FIELD_VALUE(XrInstanceProperties, runtimeVersion),
+    FIELD_STRING_ARRAY(XrInstanceProperties, runtimeName),
+};
+
+constexpr FieldDescriptor fields_XrInteractionProfileState[] = {
+    FIELD_VALUE(XrInteractionProfileState, type),
+    FIELD_XR(XrInteractionProfileState, next),
+    FIELD_VALUE(XrInteractionProfileState, interactionProfile),
+};
+
+constexpr FieldDescriptor fields_XrInteractionProfileSuggestedBinding[] = {
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, type),
+    FIELD_XR(XrInteractionProfileSuggestedBinding, next),
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, interactionProfile),
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, countSuggestedBindings),
+    FIELD_PTR(XrInteractionProfileSuggestedBinding, suggestedBindings, countSuggestedBindings),
+};
+
+constexpr FieldDescriptor fields_XrOffset2Df[] = {
+    FIELD_VALUE(XrOffset2Df, x),
+    FIELD_VALUE(XrOffset2Df, y),
+};
+
+constexpr FieldDescriptor fields_XrOffset2Di[] = {
+    FIELD_VALUE(XrOffset2Di, x),
+    FIELD_VALUE(XrOffset2Di, y),
+};
+
+constexpr FieldDescriptor fields_XrPosef[] = {
+    FIELD_VALUE(XrPosef, orientation),
+    FIELD_VALUE(XrPosef, position),
+};
+
+constexpr FieldDescriptor fields_XrQuaternionf[] = {
+    FIELD_VALUE(XrQuaternionf, x),
+    FIELD_VALUE(XrQuaternionf, y),
+    FIELD_VALUE(XrQuaternionf, z),
+    FIELD_VALUE(XrQuaternionf, w),
+};
+
+constexpr FieldDescriptor fields_XrRect2Df[] = {
+    FIELD_VALUE(XrRect2Df, offset),
+    FIELD_VALUE(XrRect2Df, extent),
+};
+
+constexpr FieldDescriptor fields_XrRect2Di[] = {
+    FIELD_VALUE(XrRect2Di, offset),
+    FIELD_VALUE(XrRect2Di, extent),
+};
+
+constexpr FieldDescriptor fields_XrReferenceSpaceCreateInfo[] = {
+    FIELD_VALUE(XrReferenceSpaceCreateInfo, type),
+    FIELD_XR(XrReferenceSpaceCreateInfo, next),
+    FIELD_VALUE(XrReferenceSpaceCreateInfo, referenceSpaceType),
+    FIELD_VALUE(XrReferenceSpaceCreateInfo, poseInReferenceSpace),
+};
+
+constexpr FieldDescriptor fields_XrSessionActionSetsAttachInfo[] = {
+    FIELD_VALUE(XrSessionActionSetsAttachInfo, type),
+    FIELD_XR(XrSessionActionSetsAttachInfo, next),
+    FIELD_VALUE(XrSessionActionSetsAttachInfo, countActionSets),
+    FIELD_PTR(XrSessionActionSetsAttachInfo, actionSets, countActionSets),
+};
+
+constexpr FieldDescriptor fields_XrSessionBeginInfo[] = {
+    FIELD_VALUE(XrSessionBeginInfo, type),
+    FIELD_XR(XrSessionBeginInfo, next),
+    FIELD_VALUE(XrSessionBeginInfo, primaryViewConfigurationType),
+};
+
+constexpr FieldDescriptor fields_XrSessionCreateInfo[] = {
+    FIELD_VALUE(XrSessionCreateInfo, type),
+    FIELD_XR(XrSessionCreateInfo, next),
+    FIELD_VALUE(XrSessionCreateInfo, createFlags),
+    FIELD_VALUE(XrSessionCreateInfo, systemId),
+};
+
+constexpr FieldDescriptor fields_XrSpaceLocation[] = {
+    FIELD_VALUE(XrSpaceLocation, type),
+    FIELD_XR(XrSpaceLocation, next),
+    FIELD_VALUE(XrSpaceLocation, locationFlags),
+    FIELD_VALUE(XrSpaceLocation, pose),
+};
+
+constexpr FieldDescriptor fields_XrSpaceLocationData[] = {
+    FIELD_VALUE(XrSpaceLocationData, locationFlags),
+    FIELD_VALUE(XrSpaceLocationData, pose),
+};
+
+constexpr FieldDescriptor fields_XrSpaceLocations[] = {
+    FIELD_VALUE(XrSpaceLocations, type),
+    FIELD_XR(XrSpaceLocations, next),
+    FIELD_VALUE(XrSpaceLocations, locationCount),
+    FIELD_PTR(XrSpaceLocations, locations, locationCount),
+};
+
+constexpr FieldDescriptor fields_XrSpaceVelocities[] = {
+    FIELD_VALUE(XrSpaceVelocities, type),
+    FIELD_XR(XrSpaceVelocities, next),
+    FIELD_VALUE(XrSpaceVelocities, velocityCount),
+    FIELD_PTR(XrSpaceVelocities, velocities, velocityCount),
+};
+
+constexpr FieldDescriptor fields_XrSpaceVelocity[] = {
+    FIELD_VALUE(XrSpaceVelocity, type),
+    FIELD_XR(XrSpaceVelocity, next),
+    FIELD_VALUE(XrSpaceVelocity, velocityFlags),
+    FIELD_VALUE(XrSpaceVelocity, linearVelocity),
+    FIELD_VALUE(XrSpaceVelocity, angularVelocity),
+};
+
+constexpr FieldDescriptor fields_XrSpaceVelocityData[] = {
+    FIELD_VALUE(XrSpaceVelocityData, velocityFlags),
+    FIELD_VALUE(XrSpaceVelocityData, linearVelocity),
+    FIELD_VALUE(XrSpaceVelocityData, angularVelocity),
+};
+
+constexpr FieldDescriptor fields_XrSpacesLocateInfo[] = {
+    FIELD_VALUE(XrSpacesLocateInfo, type),
+    FIELD_XR(XrSpacesLocateInfo, next),
+    FIELD_VALUE(XrSpacesLocateInfo, baseSpace),
+    FIELD_TIME(XrSpacesLocateInfo, time),
+    FIELD_VALUE(XrSpacesLocateInfo, spaceCount),
+    FIELD_PTR(XrSpacesLocateInfo, spaces, spaceCount),
+};
+
+constexpr FieldDescriptor fields_XrSpheref[] = {
+    FIELD_VALUE(XrSpheref, center),
+    FIELD_VALUE(XrSpheref, radius),
+};
+
+constexpr FieldDescriptor fields_XrSwapchainCreateInfo[] = {
+    FIELD_VALUE(XrSwapchainCreateInfo, type),
+    FIELD_XR(XrSwapchainCreateInfo, next),
+    FIELD_VALUE(XrSwapchainCreateInfo, createFlags),
+    FIELD_VALUE(XrSwapchainCreateInfo, usageFlags),
+    FIELD_VALUE(XrSwapchainCreateInfo, format),
+    FIELD_VALUE(XrSwapchainCreateInfo, sampleCount),
+    FIELD_VALUE(XrSwapchainCreateInfo, width),
+    FIELD_VALUE(XrSwapchainCreateInfo, height),
+    FIELD_VALUE(XrSwapchainCreateInfo, faceCount),
+    FIELD_VALUE(XrSwapchainCreateInfo, arraySize),
+    FIELD_VALUE(XrSwapchainCreateInfo, mipCount),
+};
+
+constexpr FieldDescriptor fields_XrSwapchainImageAcquireInfo[] = {
+    FIELD_VALUE(XrSwapchainImageAcquireInfo, type),
+    FIELD_XR(XrSwapchainImageAcquireInfo, next),
+};
+
+constexpr FieldDescriptor fields_XrSwapchainImageReleaseInfo[] = {
+    FIELD_VALUE(XrSwapchainImageReleaseInfo, type),
+    FIELD_XR(XrSwapchainImageReleaseInfo, next),
+};
+
+constexpr FieldDescriptor fields_XrSwapchainImageWaitInfo[] = {
+    FIELD_VALUE(XrSwapchainImageWaitInfo, type),
+    FIELD_XR(XrSwapchainImageWaitInfo, next),
+    FIELD_VALUE(XrSwapchainImageWaitInfo, timeout),
+};
+
+constexpr FieldDescriptor fields_XrSwapchainSubImage[] = {
+    FIELD_VALUE(XrSwapchainSubImage, swapchain),
+    FIELD_VALUE(XrSwapchainSubImage, imageRect),
+    FIELD_VALUE(XrSwapchainSubImage, imageArrayIndex),
+};
+
+constexpr FieldDescriptor fields_XrSystemGetInfo[] = {
+    FIELD_VALUE(XrSystemGetInfo, type),
+    FIELD_XR(XrSystemGetInfo, next),
+    FIELD_VALUE(XrSystemGetInfo, formFactor),
+};
+
+constexpr FieldDescriptor fields_XrSystemGraphicsProperties[] = {
+    FIELD_VALUE(XrSystemGraphicsProperties, maxSwapchainImageHeight),
+    FIELD_VALUE(XrSystemGraphicsProperties, maxSwapchainImageWidth),
+    FIELD_VALUE(XrSystemGraphicsProperties, maxLayerCount),
+};
+
+constexpr FieldDescriptor fields_XrSystemProperties[] = {
+    FIELD_VALUE(XrSystemProperties, type),
+    FIELD_XR(XrSystemProperties, next),
+    FIELD_VALUE(XrSystemProperties, systemId),
+    FIELD_VALUE(XrSystemProperties, vendorId),
+    FIELD_STRING_ARRAY(XrSystemProperties, systemName),
+    FIELD_VALUE(XrSystemProperties, graphicsProperties),
+    FIELD_VALUE(XrSystemProperties, trackingProperties),
+};
+
+constexpr FieldDescriptor fields_XrSystemTrackingProperties[] = {
+    FIELD_VALUE(XrSystemTrackingProperties, orientationTracking),
+    FIELD_VALUE(XrSystemTrackingProperties, positionTracking),
+};
+
+constexpr FieldDescriptor fields_XrUuid[] = {
+    FIELD_ARRAY(XrUuid, data),
+};
+
+constexpr FieldDescriptor fields_XrVector2f[] = {
+    FIELD_VALUE(XrVector2f, x),
+    FIELD_VALUE(XrVector2f, y),
+};
+
+constexpr FieldDescriptor fields_XrVector3f[] = {
+    FIELD_VALUE(XrVector3f, x),
+    FIELD_VALUE(XrVector3f, y),
+    FIELD_VALUE(XrVector3f, z),
+};
+
+constexpr FieldDescriptor fields_XrVector4f[] = {
+    FIELD_VALUE(XrVector4f, x),
+    FIELD_VALUE(XrVector4f, y),
+    FIELD_VALUE(XrVector4f, z),
+    FIELD_VALUE(XrVector4f, w),
+};
+
+constexpr FieldDescriptor fields_XrView[] = {
+    FIELD_VALUE(XrView, type),
+    FIELD_XR(XrView, next),
+    FIELD_VALUE(XrView, pose),
+    FIELD_VALUE(XrView, fov),
+};
+
+constexpr FieldDescriptor fields_XrViewConfigurationProperties[] = {
+    FIELD_VALUE(XrViewConfigurationProperties, type),
+    FIELD_XR(XrViewConfigurationProperties, next),
+    FIELD_VALUE(XrViewConfigurationProperties, viewConfigurationType),
+    FIELD_VALUE(XrViewConfigurationProperties, fovMutable),
+};
+
+constexpr FieldDescriptor fields_XrViewConfigurationView[] = {
+    FIELD_VALUE(XrViewConfigurationView, type),
+    FIELD_XR(XrViewConfigurationView, next),
+    FIELD_VALUE(XrViewConfigurationView, recommendedImageRectWidth),
+    FIELD_VALUE(XrViewConfigurationView, maxImageRectWidth),
+    FIELD_VALUE(XrViewConfigurationView, recommendedImageRectHeight),
+    FIELD_VALUE(XrViewConfigurationView, maxImageRectHeight),
+    FIELD_VALUE(XrViewConfigurationView, recommendedSwapchainSampleCount),
+    FIELD_VALUE(XrViewConfigurationView, maxSwapchainSampleCount),
+};
+
+constexpr FieldDescriptor fields_XrViewLocateInfo[] = {
+    FIELD_VALUE(XrViewLocateInfo, type),
+    FIELD_XR(XrViewLocateInfo, next),
+    FIELD_VALUE(XrViewLocateInfo, viewConfigurationType),
+    FIELD_TIME(XrViewLocateInfo, displayTime),
+    FIELD_VALUE(XrViewLocateInfo, space),
+};
+
+constexpr FieldDescriptor fields_XrViewState[] = {
+    FIELD_VALUE(XrViewState, type),
+    FIELD_XR(XrViewState, next),
+    FIELD_VALUE(XrViewState, viewStateFlags),
+};
+
+// Nonzero, so that times which aren't converted or are converted twice change the bytes
+constexpr XrDuration TIME_OFFSET = 1'000'000'000;
+
+// Serializes item with the generated serializer and with fields, then deserializes the bytes with
+// fields and serializes the result with the generated serializer again. Compact encoding sends
+// counts, enums and handles differently, so it is checked separately.
+template <typename T, std::size_t N>
+void check_same_bytes(const T& item, const FieldDescriptor (&fields)[N], bool compact) {
+    HandleInterner generated_handles;
+    ByteQueue generated;
+    SerializeContext generated_ctx(generated, TIME_OFFSET);
+    generated_ctx.handles = compact ? begin_handles(&generated_handles) : nullptr;
+    serialize(&item, generated_ctx);
+
+    HandleInterner table_handles;
+    ByteQueue table;
+    SerializeContext table_ctx(table, TIME_OFFSET);
+    table_ctx.handles = compact ? begin_handles(&table_handles) : nullptr;
+    serialize_fields(&item, fields, table_ctx);
+    REQUIRE(table.bytes == generated.bytes);
+
+    HandleTable received_handles;
+    T deserialized{};
+    DeserializeContext d_ctx(table, false, TIME_OFFSET);
+    d_ctx.handles = compact ? &received_handles : nullptr;
+    deserialize_fields(&deserialized, fields, d_ctx);
+    CHECK(table.unread() == 0);
+
+    HandleInterner round_trip_handles;
+    ByteQueue round_trip;
+    SerializeContext round_trip_ctx(round_trip, TIME_OFFSET);
+    round_trip_ctx.handles = compact ? begin_handles(&round_trip_handles) : nullptr;
+    serialize(&deserialized, round_trip_ctx);
+    CHECK(round_trip.bytes == generated.bytes);
+
+    cleanup_fields(&deserialized, fields);
+}
+
+} // namespace
+
+TEST_CASE("Struct tables match the generated serializers", "[table_serialization]") {
+    SECTION("XrActionCreateInfo") {
+        XrActionCreateInfo item{};
+        item.type = XR_TYPE_ACTION_CREATE_INFO;
+        XrSpaceLocation item_next[1]{};
+        item_next[0].type = XR_TYPE_SPACE_LOCATION;
+        XrSpaceVelocities item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_SPACE_VELOCITIES;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].velocityCount = 7;
+        XrSpaceVelocityData item_next_0_next_0_velocities[7]{};
+        item_next_0_next_0_velocities[0].velocityFlags = (XrSpaceVelocityFlags) 0x5d685155e98cd7d9;
+        item_next_0_next_0_velocities[0].linearVelocity.x = (float) 0xe66eb1186613c33d;
+        item_next_0_next_0_velocities[0].linearVelocity.y = (float) 0xe369ab3d591d3569;
+        item_next_0_next_0_velocities[0].linearVelocity.z = (float) 0xd51f25e60490392a;
+        item_next_0_next_0_velocities[0].angularVelocity.x = (float) 0x1e5876bf982e524e;
+        item_next_0_next_0_velocities[0].angularVelocity.y = (float) 0xf522dfdc3f12cc0c;
+        item_next_0_next_0_velocities[0].angularVelocity.z = (float) 0xda1298c4cbb452ae;
+        item_next_0_next_0_velocities[1].velocityFlags = (XrSpaceVelocityFlags) 0x9ac68d26ea43fe43;
+        item_next_0_next_0_velocities[1].linearVelocity.x = (float) 0x8c39d6bb337385ed;
+        item_next_0_next_0_velocities[1].linearVelocity.y = (float) 0xb3bbf03c6047157;
+        item_next_0_next_0_velocities[1].linearVelocity.z = (float) 0x9ea7a4fbe6e2343e;
+        item_next_0_next_0_velocities[1].angularVelocity.x = (float) 0x327009803262c798;
+        item_next_0_next_0_velocities[1].angularVelocity.y = (float) 0x3252b97648f0e642;
+        item_next_0_next_0_velocities[1].angularVelocity.z = (float) 0x9194e696cc596130;
+        item_next_0_next_0_velocities[2].velocityFlags = (XrSpaceVelocityFlags) 0x5566488c9c5cf234;
+        item_next_0_next_0_velocities[2].linearVelocity.x = (float) 0xca5976a69275bab2;
+        item_next_0_next_0_velocities[2].linearVelocity.y = (float) 0x87485ff586d6b717;
+        item_next_0_next_0_velocities[2].linearVelocity.z = (float) 0xa9a29c4cc67b74e2;
+        item_next_0_next_0_velocities[2].angularVelocity.x = (float) 0x95714c91bc8b306f;
+        item_next_0_next_0_velocities[2].angularVelocity.y = (float) 0xe6171071f9307a71;
+        item_next_0_next_0_velocities[2].angularVelocity.z = (float) 0x85b568b4ce13c2e4;
+        item_next_0_next_0_velocities[3].velocityFlags = (XrSpaceVelocityFlags) 0xeed81733ba9746a3;
+        item_next_0_next_0_velocities[3].linearVelocity.x = (float) 0xa508c8e891a8623e;
+        item_next_0_next_0_velocities[3].linearVelocity.y = (float) 0xf2a57b172167d343;
+        item_next_0_next_0_velocities[3].linearVelocity.z = (float) 0x2b8cac8fe7545280;
+        item_next_0_next_0_velocities[3].angularVelocity.x = (float) 0x1413b58cd1ea37fc;
+        item_next_0_next_0_velocities[3].angularVelocity.y = (float) 0x8df6073d0dbbff09;
+        item_next_0_next_0_velocities[3].angularVelocity.z = (float) 0xaf84fd9ee5744ef;
+        item_next_0_next_0_velocities[4].velocityFlags = (XrSpaceVelocityFlags) 0x58e8abfc7618f5fd;
+        item_next_0_next_0_velocities[4].linearVelocity.x = (float) 0x355ac876118344eb;
+        item_next_0_next_0_velocities[4].linearVelocity.y = (float) 0x310791bb36b87e69;
+        item_next_0_next_0_velocities[4].linearVelocity.z = (float) 0x8d85b3156df9f721;
+        item_next_0_next_0_velocities[4].angularVelocity.x = (float) 0xd7b9ba35fdc95e56;
+        item_next_0_next_0_velocities[4].angularVelocity.y = (float) 0x9fd67893649866e0;
+        item_next_0_next_0_velocities[4].angularVelocity.z = (float) 0xedf86d309ff95cca;
+        item_next_0_next_0_velocities[5].velocityFlags = (XrSpaceVelocityFlags) 0x52591d5fa111b92e;
+        item_next_0_next_0_velocities[5].linearVelocity.x = (float) 0xa42ca3e6312ec7c8;
+        item_next_0_next_0_velocities[5].linearVelocity.y = (float) 0x8bce90e8f5931159;
+        item_next_0_next_0_velocities[5].linearVelocity.z = (float) 0xe451ef0c4e26b0b8;
+        item_next_0_next_0_velocities[5].angularVelocity.x = (float) 0x61553c85a2f4e8b9;
+        item_next_0_next_0_velocities[5].angularVelocity.y = (float) 0xd202751c9fa88bba;
+        item_next_0_next_0_velocities[5].angularVelocity.z = (float) 0xbf0d1338c339627c;
+        item_next_0_next_0_velocities[6].velocityFlags = (XrSpaceVelocityFlags) 0x57adf7db00bc9d0c;
+        item_next_0_next_0_velocities[6].linearVelocity.x = (float) 0xee87e8a2d75ce2e2;
+        item_next_0_next_0_velocities[6].linearVelocity.y = (float) 0xe885b64f981d1baa;
+        item_next_0_next_0_velocities[6].linearVelocity.z = (float) 0x23b8ef17ff195e1b;
+        item_next_0_next_0_velocities[6].angularVelocity.x = (float) 0x60f80c2794c6e3f4;
+        item_next_0_next_0_velocities[6].angularVelocity.y = (float) 0x71be74bca3b5c6c4;
+        item_next_0_next_0_velocities[6].angularVelocity.z = (float) 0x3e36eee3aac04cfd;
+        item_next_0_next[0].velocities = item_next_0_next_0_velocities;
+        item_next[0].next = item_next_0_next;
+        item_next[0].locationFlags = (XrSpaceLocationFlags) 0x36646367b78c2f91;
+        item_next[0].pose.orientation.x = (float) 0xf34407f8ac4c718a;
+        item_next[0].pose.orientation.y = (float) 0xa4ec780fabedb4a1;
+        item_next[0].pose.orientation.z = (float) 0x8f78a664a41f6cf8;
+        item_next[0].pose.orientation.w = (float) 0x40e58254bd7ee48;
+        item_next[0].pose.position.x = (float) 0xee3451827d29c6d9;
+        item_next[0].pose.position.y = (float) 0xb8c273f1bc356740;
+        item_next[0].pose.position.z = (float) 0xca6cff022cde9d66;
+        item.next = item_next;
+        for (int i = 0; i < XR_MAX_ACTION_NAME_SIZE; i++) {
+            item.actionName[i] = 'k';
+        }
+        item.actionType = (XrActionType) 0xc0776b023caf3403;
+        item.countSubactionPaths = (uint32_t) 0xcc99eb12a1f3ab06;
+        item.subactionPaths = nullptr;
+        for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_NAME_SIZE; i++) {
+            item.localizedActionName[i] = 'Z';
+        }
+        check_same_bytes(item, fields_XrActionCreateInfo, false);
+        check_same_bytes(item, fields_XrActionCreateInfo, true);
+    }
+    SECTION("XrActionSetCreateInfo") {
+        XrActionSetCreateInfo item{};
+        item.type = XR_TYPE_ACTION_SET_CREATE_INFO;
+        item.next = nullptr;
+        for (int i = 0; i < XR_MAX_ACTION_SET_NAME_SIZE; i++) {
+            item.actionSetName[i] = 't';
+        }
+        for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_SET_NAME_SIZE; i++) {
+            item.localizedActionSetName[i] = 'W';
+        }
+        item.priority = (uint32_t) 0xe858138103ed8faf;
+        check_same_bytes(item, fields_XrActionSetCreateInfo, false);
+        check_same_bytes(item, fields_XrActionSetCreateInfo, true);
+    }
+    SECTION("XrActionSpaceCreateInfo") {
+        XrActionSpaceCreateInfo item{};
+        item.type = XR_TYPE_ACTION_SPACE_CREATE_INFO;
+        XrCompositionLayerProjectionView item_next[1]{};
+        item_next[0].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item_next[0].next = nullptr;
+        item_next[0].pose.orientation.x = (float) 0x1b463d1932648cd6;
+        item_next[0].pose.orientation.y = (float) 0xe50901a3ea121242;
+        item_next[0].pose.orientation.z = (float) 0x6a6b59c9c9c0c490;
+        item_next[0].pose.orientation.w = (float) 0x8d359604d9fbe780;
+        item_next[0].pose.position.x = (float) 0xbe9ba399791c0523;
+        item_next[0].pose.position.y = (float) 0x12e2ccc012e9831d;
+        item_next[0].pose.position.z = (float) 0x5c643f1022db2ca5;
+        item_next[0].fov.angleLeft = (float) 0x60eef6fd948e6c15;
+        item_next[0].fov.angleRight = (float) 0xeeeff2448cda8e87;
+        item_next[0].fov.angleUp = (float) 0xf55e05af65f3c0fa;
+        item_next[0].fov.angleDown = (float) 0x6a1100bcd9f6bca7;
+        item_next[0].subImage.swapchain = (XrSwapchain) 0x5f1fe1407c78397d;
+        item_next[0].subImage.imageRect.offset.x = (int32_t) 0xaa0a39c2c470e5bc;
+        item_next[0].subImage.imageRect.offset.y = (int32_t) 0x9f882ba76fa0a125;
+        item_next[0].subImage.imageRect.extent.width = (int32_t) 0x7920276665ae497d;
+        item_next[0].subImage.imageRect.extent.height = (int32_t) 0xda77d7f1acb7403e;
+        item_next[0].subImage.imageArrayIndex = (uint32_t) 0x12cf8e3b308442bd;
+        item.next = item_next;
+        item.action = (XrAction) 0xcee1a58ec8d2520e;
+        item.subactionPath = (XrPath) 0xd701b4a09a5bde6f;
+        item.poseInActionSpace.orientation.x = (float) 0x6fd3ac3c2fa10751;
+        item.poseInActionSpace.orientation.y = (float) 0xa202ada8eca547ab;
+        item.poseInActionSpace.orientation.z = (float) 0xe099e4dfb5a5fdeb;
+        item.poseInActionSpace.orientation.w = (float) 0xfd9dbfef327d42f;
+        item.poseInActionSpace.position.x = (float) 0x875392e8b07bb153;
+        item.poseInActionSpace.position.y = (float) 0xf84d63b79d571882;
+        item.poseInActionSpace.position.z = (float) 0x74dbe96fb8925066;
+        check_same_bytes(item, fields_XrActionSpaceCreateInfo, false);
+        check_same_bytes(item, fields_XrActionSpaceCreateInfo, true);
+    }
+    SECTION("XrActionStateBoolean") {
+        XrActionStateBoolean item{};
+        item.type = XR_TYPE_ACTION_STATE_BOOLEAN;
+        XrSpacesLocateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_SPACES_LOCATE_INFO;
+        item_next[0].next = nullptr;
+        item_next[0].baseSpace = (XrSpace) 0x369320c5f4d932fd;
+        item_next[0].time = (XrTime) 0xbed86e625cf909db;
+        item_next[0].spaceCount = (uint32_t) 0x250b68ac0845024e;
+        item_next[0].spaces = nullptr;
+        item.next = item_next;
+        item.currentState = (XrBool32) 0x9eed7637cd5eaa26;
+        item.changedSinceLastSync = (XrBool32) 0x22c5d1d929ef1e5a;
+        item.lastChangeTime = (XrTime) 0xd2a87911a9a2b599;
+        item.isActive = (XrBool32) 0x7bfb015f62ec9678;
+        check_same_bytes(item, fields_XrActionStateBoolean, false);
+        check_same_bytes(item, fields_XrActionStateBoolean, true);
+    }
+    SECTION("XrActionStateFloat") {
+        XrActionStateFloat item{};
+        item.type = XR_TYPE_ACTION_STATE_FLOAT;
+        item.next = nullptr;
+        item.currentState = (float) 0x37422ffe9e4c13ee;
+        item.changedSinceLastSync = (XrBool32) 0xcd53fc318a7e5c09;
+        item.lastChangeTime = (XrTime) 0xedc65635ac996c7c;
+        item.isActive = (XrBool32) 0x41b5ecbf7bff8ae1;
+        check_same_bytes(item, fields_XrActionStateFloat, false);
+        check_same_bytes(item, fields_XrActionStateFloat, true);
+    }
+    SECTION("XrActionStateGetInfo") {
+        XrActionStateGetInfo item{};
+        item.type = XR_TYPE_ACTION_STATE_GET_INFO;
+        XrViewLocateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_VIEW_LOCATE_INFO;
+        item_next[0].next = nullptr;
+        item_next[0].viewConfigurationType = (XrViewConfigurationType) 0x29c1fcf3b2fefd09;
+        item_next[0].displayTime = (XrTime) 0xa922933b0b315a10;
+        item_next[0].space = (XrSpace) 0x1fa7ef6f5a0a0add;
+        item.next = item_next;
+        item.action = (XrAction) 0xa81d04c333010b25;
+        item.subactionPath = (XrPath) 0x83e412adbb100261;
+        check_same_bytes(item, fields_XrActionStateGetInfo, false);
+        check_same_bytes(item, fields_XrActionStateGetInfo, true);
+    }
+    SECTION("XrActionStatePose") {
+        XrActionStatePose item{};
+        item.type = XR_TYPE_ACTION_STATE_POSE;
+        XrSpaceVelocities item_next[1]{};
+        item_next[0].type = XR_TYPE_SPACE_VELOCITIES;
+        XrViewConfigurationProperties item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_VIEW_CONFIGURATION_PROPERTIES;
+        XrActionStateGetInfo item_next_0_next_0_next[1]{};
+        item_next_0_next_0_next[0].type = XR_TYPE_ACTION_STATE_GET_INFO;
+        item_next_0_next_0_next[0].next = nullptr;
+        item_next_0_next_0_next[0].action = (XrAction) 0xb69e2dbb5c40a5c7;
+        item_next_0_next_0_next[0].subactionPath = (XrPath) 0x19b5fc393e0fe3ae;
+        item_next_0_next[0].next = item_next_0_next_0_next;
+        item_next_0_next[0].viewConfigurationType = (XrViewConfigurationType) 0x5122540c8e528606;
+        item_next_0_next[0].fovMutable = (XrBool32) 0xe023683652ffc41b;
+        item_next[0].next = item_next_0_next;
+        item_next[0].velocityCount = (uint32_t) 0xb153a85ea4259db;
+        item_next[0].velocities = nullptr;
+        item.next = item_next;
+        item.isActive = (XrBool32) 0xb052cf64571eb840;
+        check_same_bytes(item, fields_XrActionStatePose, false);
+        check_same_bytes(item, fields_XrActionStatePose, true);
+    }
+    SECTION("XrActionStateVector2f") {
+        XrActionStateVector2f item{};
+        item.type = XR_TYPE_ACTION_STATE_VECTOR2F;
+        XrSpaceLocation item_next[1]{};
+        item_next[0].type = XR_TYPE_SPACE_LOCATION;
+        XrEventDataInteractionProfileChanged item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].session = (XrSession) 0xe019cf5f08d74c5a;
+        item_next[0].next = item_next_0_next;
+        item_next[0].locationFlags = (XrSpaceLocationFlags) 0xd535be69e2b40d48;
+        item_next[0].pose.orientation.x = (float) 0x23cbab5def58301d;
+        item_next[0].pose.orientation.y = (float) 0xe2f4fc517f35f951;
+        item_next[0].pose.orientation.z = (float) 0x561ef6ea89b3dbf;
+        item_next[0].pose.orientation.w = (float) 0x959f4db312dbb5e1;
+        item_next[0].pose.position.x = (float) 0xbca2014c6234db04;
+        item_next[0].pose.position.y = (float) 0x20b1eed5978e4900;
+        item_next[0].pose.position.z = (float) 0xbf037ba260e9c111;
+        item.next = item_next;
+        item.currentState.x = (float) 0x1384c3552db44714;
+        item.currentState.y = (float) 0x2117120a54ab329a;
+        item.changedSinceLastSync = (XrBool32) 0x91594a52a4aac9c5;
+        item.lastChangeTime = (XrTime) 0x8610a613b654b8e1;
+        item.isActive = (XrBool32) 0x217909c82f899893;
+        check_same_bytes(item, fields_XrActionStateVector2f, false);
+        check_same_bytes(item, fields_XrActionStateVector2f, true);
+    }
+    SECTION("XrActionSuggestedBinding") {
+        XrActionSuggestedBinding item{};
+        item.action = (XrAction) 0x69b37f5eadafa5f5;
+        item.binding = (XrPath) 0x81181f0b2718bcb6;
+        check_same_bytes(item, fields_XrActionSuggestedBinding, false);
+        check_same_bytes(item, fields_XrActionSuggestedBinding, true);
+    }
+    SECTION("XrActionsSyncInfo") {
+        XrActionsSyncInfo item{};
+        item.type = XR_TYPE_ACTIONS_SYNC_INFO;
+        XrFrameState item_next[1]{};
+        item_next[0].type = XR_TYPE_FRAME_STATE;
+        XrSpaceLocations item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_SPACE_LOCATIONS;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].locationCount = (uint32_t) 0x4d8df934efb6fab4;
+        item_next_0_next[0].locations = nullptr;
+        item_next[0].next = item_next_0_next;
+        item_next[0].predictedDisplayTime = (XrTime) 0xc468048e753175f2;
+        item_next[0].predictedDisplayPeriod = (XrDuration) 0xb558d95c115b07fd;
+        item_next[0].shouldRender = (XrBool32) 0xffba43859f10cc5c;
+        item.next = item_next;
+        item.countActiveActionSets = 20;
+        XrActiveActionSet item_activeActionSets[20]{};
+        item_activeActionSets[0].actionSet = (XrActionSet) 0x57e7f058d27a9ad2;
+        item_activeActionSets[0].subactionPath = (XrPath) 0xf00d7bda4db00037;
+        item_activeActionSets[1].actionSet = (XrActionSet) 0xe90be33165417b8c;
+        item_activeActionSets[1].subactionPath = (XrPath) 0x6c605fa96fe8f2cd;
+        item_activeActionSets[2].actionSet = (XrActionSet) 0x126dfd0ca20bc67d;
+        item_activeActionSets[2].subactionPath = (XrPath) 0x2efef73484850f19;
+        item_activeActionSets[3].actionSet = (XrActionSet) 0x572f48ed969bf5a5;
+        item_activeActionSets[3].subactionPath = (XrPath) 0x2d43d0f97381c9b7;
+        item_activeActionSets[4].actionSet = (XrActionSet) 0x5045d6ce43236e35;
+        item_activeActionSets[4].subactionPath = (XrPath) 0xa3a5a298070e2fb0;
+        item_activeActionSets[5].actionSet = (XrActionSet) 0x64b111777a378b6c;
+        item_activeActionSets[5].subactionPath = (XrPath) 0xc77af44d036f405a;
+        item_activeActionSets[6].actionSet = (XrActionSet) 0x9e3b0c36817543fa;
+        item_activeActionSets[6].subactionPath = (XrPath) 0x74a8331394946f9f;
+        item_activeActionSets[7].actionSet = (XrActionSet) 0x703f95bed6e34a3a;
+        item_activeActionSets[7].subactionPath = (XrPath) 0xae3e0354857694e5;
+        item_activeActionSets[8].actionSet = (XrActionSet) 0xac1b4e2750778a01;
+        item_activeActionSets[8].subactionPath = (XrPath) 0x2ff023f28af70926;
+        item_activeActionSets[9].actionSet = (XrActionSet) 0xe2a5d94c29dd3293;
+        item_activeActionSets[9].subactionPath = (XrPath) 0xdc19353b88731bd8;
+        item_activeActionSets[10].actionSet = (XrActionSet) 0x86f7c7788d7312b7;
+        item_activeActionSets[10].subactionPath = (XrPath) 0x80fbbbf6f4e6480;
+        item_activeActionSets[11].actionSet = (XrActionSet) 0xae81dd56570801fd;
+        item_activeActionSets[11].subactionPath = (XrPath) 0x57eb923b63d9fbde;
+        item_activeActionSets[12].actionSet = (XrActionSet) 0xefa08bbe8fb8aa94;
+        item_activeActionSets[12].subactionPath = (XrPath) 0x5e68e47d3a360a80;
+        item_activeActionSets[13].actionSet = (XrActionSet) 0xa0af8f9b2b660425;
+        item_activeActionSets[13].subactionPath = (XrPath) 0x1b87c80b54d1a524;
+        item_activeActionSets[14].actionSet = (XrActionSet) 0xe6c9453ab320b9ba;
+        item_activeActionSets[14].subactionPath = (XrPath) 0xdfdd4106d488f678;
+        item_activeActionSets[15].actionSet = (XrActionSet) 0xd7274a4fe47c6c36;
+        item_activeActionSets[15].subactionPath = (XrPath) 0x9f52c1fa859f7740;
+        item_activeActionSets[16].actionSet = (XrActionSet) 0x21e227ff803ccd93;
+        item_activeActionSets[16].subactionPath = (XrPath) 0xfb6105f5d4915011;
+        item_activeActionSets[17].actionSet = (XrActionSet) 0xf008a8f241acf6a0;
+        item_activeActionSets[17].subactionPath = (XrPath) 0x49239f6c7171e431;
+        item_activeActionSets[18].actionSet = (XrActionSet) 0xa587b6cf32bb235;
+        item_activeActionSets[18].subactionPath = (XrPath) 0xb49cd12bc1c6802f;
+        item_activeActionSets[19].actionSet = (XrActionSet) 0x46d79c16bc914125;
+        item_activeActionSets[19].subactionPath = (XrPath) 0xab527c0be0eb08d5;
+        item.activeActionSets = item_activeActionSets;
+        check_same_bytes(item, fields_XrActionsSyncInfo, false);
+        check_same_bytes(item, fields_XrActionsSyncInfo, true);
+    }
+    SECTION("XrActiveActionSet") {
+        XrActiveActionSet item{};
+        item.actionSet = (XrActionSet) 0x2bd28e49e224a791;
+        item.subactionPath = (XrPath) 0x23f8a86a8793b3dd;
+        check_same_bytes(item, fields_XrActiveActionSet, false);
+        check_same_bytes(item, fields_XrActiveActionSet, true);
+    }
+    SECTION("XrApiLayerProperties") {
+        XrApiLayerProperties item{};
+        item.type = XR_TYPE_API_LAYER_PROPERTIES;
+        XrEventDataInteractionProfileChanged item_next[1]{};
+        item_next[0].type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+        XrBoundSourcesForActionEnumerateInfo item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_BOUND_SOURCES_FOR_ACTION_ENUMERATE_INFO;
+        XrSessionCreateInfo item_next_0_next_0_next[1]{};
+        item_next_0_next_0_next[0].type = XR_TYPE_SESSION_CREATE_INFO;
+        item_next_0_next_0_next[0].next = nullptr;
+        item_next_0_next_0_next[0].createFlags = (XrSessionCreateFlags) 0x61fceeb6debc33d;
+        item_next_0_next_0_next[0].systemId = (XrSystemId) 0xe4ce39d6b14e9919;
+        item_next_0_next[0].next = item_next_0_next_0_next;
+        item_next_0_next[0].action = (XrAction) 0xe91b9a59defb2f68;
+        item_next[0].next = item_next_0_next;
+        item_next[0].session = (XrSession) 0xd0fee9ecdf23a130;
+        item.next = item_next;
+        for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+            item.layerName[i] = '5';
+        }
+        item.specVersion = (XrVersion) 0xb04e0bb2e91c39fe;
+        item.layerVersion = (uint32_t) 0x210dceec7505166a;
+        for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+            item.description[i] = 'V';
+        }
+        check_same_bytes(item, fields_XrApiLayerProperties, false);
+        check_same_bytes(item, fields_XrApiLayerProperties, true);
+    }
+    SECTION("XrApplicationInfo") {
+        XrApplicationInfo item{};
+        for (int i = 0; i < XR_MAX_APPLICATION_NAME_SIZE; i++) {
+            item.applicationName[i] = 'r';
+        }
+        item.applicationVersion = (uint32_t) 0x91163aa9f0ec5819;
+        for (int i = 0; i < XR_MAX_ENGINE_NAME_SIZE; i++) {
+            item.engineName[i] = 'G';
+        }
+        item.engineVersion = (uint32_t) 0x50672caa9c72a7c6;
+        item.apiVersion = (XrVersion) 0x13c2215bc0d07db3;
+        check_same_bytes(item, fields_XrApplicationInfo, false);
+        check_same_bytes(item, fields_XrApplicationInfo, true);
+    }
+    SECTION("XrBodySkeletonJointHTC") {
+        XrBodySkeletonJointHTC item{};
+        item.pose.orientation.x = (float) 0x9dcabc0e8c23efcb;
+        item.pose.orientation.y = (float) 0x44f694b7cc483681;
+        item.pose.orientation.z = (float) 0x3de92c0a5593065d;
+        item.pose.orientation.w = (float) 0x8695ed30a3f9cd3a;
+        item.pose.position.x = (float) 0xa020a0b2edf1d796;
+        item.pose.position.y = (float) 0x68dcdfbe95ddb5be;
+        item.pose.position.z = (float) 0xbe467d4220a1cc9e;
+        check_same_bytes(item, fields_XrBodySkeletonJointHTC, false);
+        check_same_bytes(item, fields_XrBodySkeletonJointHTC, true);
+    }
+    SECTION("XrBoundSourcesForActionEnumerateInfo") {
+        XrBoundSourcesForActionEnumerateInfo item{};
+        item.type = XR_TYPE_BOUND_SOURCES_FOR_ACTION_ENUMERATE_INFO;
+        XrEventDataInstanceLossPending item_next[1]{};
+        item_next[0].type = XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING;
+        XrApiLayerProperties item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_API_LAYER_PROPERTIES;
+        XrSystemGetInfo item_next_0_next_0_next[1]{};
+        item_next_0_next_0_next[0].type = XR_TYPE_SYSTEM_GET_INFO;
+        item_next_0_next_0_next[0].next = nullptr;
+        item_next_0_next_0_next[0].formFactor = (XrFormFactor) 0xa9ac9a367afa56b2;
+        item_next_0_next[0].next = item_next_0_next_0_next;
+        for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+            item_next_0_next[0].layerName[i] = 'Q';
+        }
+        item_next_0_next[0].specVersion = (XrVersion) 0xc93bef8c6f515db;
+        item_next_0_next[0].layerVersion = (uint32_t) 0x686f0db53c51c04;
+        for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+            item_next_0_next[0].description[i] = 'H';
+        }
+        item_next[0].next = item_next_0_next;
+        item_next[0].lossTime = (XrTime) 0xc5371a0851e3c67d;
+        item.next = item_next;
+        item.action = (XrAction) 0xa0ec5d9e0d53267f;
+        check_same_bytes(item, fields_XrBoundSourcesForActionEnumerateInfo, false);
+        check_same_bytes(item, fields_XrBoundSourcesForActionEnumerateInfo, true);
+    }
+    SECTION("XrBoxf") {
+        XrBoxf item{};
+        item.center.orientation.x = (float) 0x8212b2aca3ee398f;
+        item.center.orientation.y = (float) 0xccb213ebf93e9cd1;
+        item.center.orientation.z = (float) 0x6925b7445f83322e;
+        item.center.orientation.w = (float) 0x3683e3923b877ff6;
+        item.center.position.x = (float) 0xdc784dd5558148e7;
+        item.center.position.y = (float) 0x4e0c965ab5e1534e;
+        item.center.position.z = (float) 0x92cf4d40e0825f0d;
+        item.extents.width = (float) 0xd6e1bd92658378ef;
+        item.extents.height = (float) 0x466fe56d74e14933;
+        item.extents.depth = (float) 0xac9b592e4d7dfc0d;
+        check_same_bytes(item, fields_XrBoxf, false);
+        check_same_bytes(item, fields_XrBoxf, true);
+    }
+    SECTION("XrColor3f") {
+        XrColor3f item{};
+        item.r = (float) 0x20adb8ebbe3d9ed8;
+        item.g = (float) 0x9f5a402b4d1e15e1;
+        item.b = (float) 0x5f0ac8484d2a8f7;
+        check_same_bytes(item, fields_XrColor3f, false);
+        check_same_bytes(item, fields_XrColor3f, true);
+    }
+    SECTION("XrColor4f") {
+        XrColor4f item{};
+        item.r = (float) 0x61f1cd27baa3001d;
+        item.g = (float) 0xa23da1c578402700;
+        item.b = (float) 0x199dd9cb43ff9fe3;
+        item.a = (float) 0x826cac4557b54f67;
+        check_same_bytes(item, fields_XrColor4f, false);
+        check_same_bytes(item, fields_XrColor4f, true);
+    }
+    SECTION("XrCompositionLayerProjection") {
+        XrCompositionLayerProjection item{};
+        item.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION;
+        item.next = nullptr;
+        item.layerFlags = (XrCompositionLayerFlags) 0xa7fe302c86ef1f0d;
+        item.space = (XrSpace) 0xe888cb0415dd02de;
+        item.viewCount = 13;
+        XrCompositionLayerProjectionView item_views[13]{};
+        item_views[0].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrViewState item_views_0_next[1]{};
+        item_views_0_next[0].type = XR_TYPE_VIEW_STATE;
+        XrInteractionProfileState item_views_0_next_0_next[1]{};
+        item_views_0_next_0_next[0].type = XR_TYPE_INTERACTION_PROFILE_STATE;
+        XrEventDataEventsLost item_views_0_next_0_next_0_next[1]{};
+        item_views_0_next_0_next_0_next[0].type = XR_TYPE_EVENT_DATA_EVENTS_LOST;
+        item_views_0_next_0_next_0_next[0].next = nullptr;
+        item_views_0_next_0_next_0_next[0].lostEventCount = (uint32_t) 0x51e3a00816117f63;
+        item_views_0_next_0_next[0].next = item_views_0_next_0_next_0_next;
+        item_views_0_next_0_next[0].interactionProfile = (XrPath) 0x7fc0097d69755f0;
+        item_views_0_next[0].next = item_views_0_next_0_next;
+        item_views_0_next[0].viewStateFlags = (XrViewStateFlags) 0x18e89bdb2110cbaa;
+        item_views[0].next = item_views_0_next;
+        item_views[0].pose.orientation.x = (float) 0x843d7edb454dbe8c;
+        item_views[0].pose.orientation.y = (float) 0xf88c08652d037577;
+        item_views[0].pose.orientation.z = (float) 0x6f5c3c247fcd1cef;
+        item_views[0].pose.orientation.w = (float) 0x325fe99552473f97;
+        item_views[0].pose.position.x = (float) 0xe11cf6edb9eb0a64;
+        item_views[0].pose.position.y = (float) 0x887345371c93f7c4;
+        item_views[0].pose.position.z = (float) 0xf13c9d21a8622b12;
+        item_views[0].fov.angleLeft = (float) 0xfd92380821603f9a;
+        item_views[0].fov.angleRight = (float) 0xe0459b855188d045;
+        item_views[0].fov.angleUp = (float) 0x3e95a6143224d140;
+        item_views[0].fov.angleDown = (float) 0xddb6d903bd410212;
+        item_views[0].subImage.swapchain = (XrSwapchain) 0xaca1b687ad9fb79a;
+        item_views[0].subImage.imageRect.offset.x = (int32_t) 0x9ee4a085394013d2;
+        item_views[0].subImage.imageRect.offset.y = (int32_t) 0x5d35c9d4be0fd1b6;
+        item_views[0].subImage.imageRect.extent.width = (int32_t) 0x79d4dbf9d396aaa1;
+        item_views[0].subImage.imageRect.extent.height = (int32_t) 0xd5e2f69d09b36753;
+        item_views[0].subImage.imageArrayIndex = (uint32_t) 0xa3116e3dfb3ed68b;
+        item_views[1].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item_views[1].next = nullptr;
+        item_views[1].pose.orientation.x = (float) 0xba610b6c5d80c91a;
+        item_views[1].pose.orientation.y = (float) 0x3bb3646f50a74201;
+        item_views[1].pose.orientation.z = (float) 0x7a674e4207b3f7bd;
+        item_views[1].pose.orientation.w = (float) 0xc1e4e2833834bb2e;
+        item_views[1].pose.position.x = (float) 0xd9ecbbe2155f1cce;
+        item_views[1].pose.position.y = (float) 0x24ae0fa4dd036bfc;
+        item_views[1].pose.position.z = (float) 0x68b2bf3d433fcef5;
+        item_views[1].fov.angleLeft = (float) 0x3d89f4838dc8b5a;
+        item_views[1].fov.angleRight = (float) 0x96df8176039c666;
+        item_views[1].fov.angleUp = (float) 0x3e6b3c66eeaaec1d;
+        item_views[1].fov.angleDown = (float) 0x7e1a125dcfa56359;
+        item_views[1].subImage.swapchain = (XrSwapchain) 0x451dc61ec6b0368e;
+        item_views[1].subImage.imageRect.offset.x = (int32_t) 0xedf9493fdbddc693;
+        item_views[1].subImage.imageRect.offset.y = (int32_t) 0xb560451f51cd1aa3;
+        item_views[1].subImage.imageRect.extent.width = (int32_t) 0xa73388c249ad5201;
+        item_views[1].subImage.imageRect.extent.height = (int32_t) 0x73802c52d4054e83;
+        item_views[1].subImage.imageArrayIndex = (uint32_t) 0xa1833e0b46731a76;
+        item_views[2].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item_views[2].next = nullptr;
+        item_views[2].pose.orientation.x = (float) 0x308308f2fd4bdd67;
+        item_views[2].pose.orientation.y = (float) 0xd6934af6aadc56b3;
+        item_views[2].pose.orientation.z = (float) 0xf8cdc33cb063deb9;
+        item_views[2].pose.orientation.w = (float) 0x4307968de9e0c6bf;
+        item_views[2].pose.position.x = (float) 0x41fbe86fef393b6b;
+        item_views[2].pose.position.y = (float) 0xfd31484ed5fce17c;
+        item_views[2].pose.position.z = (float) 0x14939571228a994e;
+        item_views[2].fov.angleLeft = (float) 0x19e328db1a6ae616;
+        item_views[2].fov.angleRight = (float) 0x6748723f8851a402;
+        item_views[2].fov.angleUp = (float) 0xf2549886c8391b5;
+        item_views[2].fov.angleDown = (float) 0xe44f8b195a138c4;
+        item_views[2].subImage.swapchain = (XrSwapchain) 0x416f6bff892ebb6e;
+        item_views[2].subImage.imageRect.offset.x = (int32_t) 0x7695951331d06448;
+        item_views[2].subImage.imageRect.offset.y = (int32_t) 0x523704d824cfd2b0;
+        item_views[2].subImage.imageRect.extent.width = (int32_t) 0x39ecd7eb9e09bede;
+        item_views[2].subImage.imageRect.extent.height = (int32_t) 0x8facec5d578fc7ef;
+        item_views[2].subImage.imageArrayIndex = (uint32_t) 0xed01b3ca82557ac3;
+        item_views[3].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item_views[3].next = nullptr;
+        item_views[3].pose.orientation.x = (float) 0x4e1808d1d9dc75fa;
+        item_views[3].pose.orientation.y = (float) 0x2ef92294fc489d9e;
+        item_views[3].pose.orientation.z = (float) 0xfe271c1224b3f212;
+        item_views[3].pose.orientation.w = (float) 0x4cc8b018367e99e4;
+        item_views[3].pose.position.x = (float) 0xefedabb18aecbed6;
+        item_views[3].pose.position.y = (float) 0xc4973fd06e3d1a10;
+        item_views[3].pose.position.z = (float) 0xc3213c90ec0ce939;
+        item_views[3].fov.angleLeft = (float) 0x2e5fc1a14674005d;
+        item_views[3].fov.angleRight = (float) 0x5c0589dddc363d97;
+        item_views[3].fov.angleUp = (float) 0xf4d25540ed584887;
+        item_views[3].fov.angleDown = (float) 0x68954848fecc5d18;
+        item_views[3].subImage.swapchain = (XrSwapchain) 0x6f13d0e31103696b;
+        item_views[3].subImage.imageRect.offset.x = (int32_t) 0xd39a5284b5c33239;
+        item_views[3].subImage.imageRect.offset.y = (int32_t) 0x298351a9a25de48b;
+        item_views[3].subImage.imageRect.extent.width = (int32_t) 0xdb0cb7280fef8231;
+        item_views[3].subImage.imageRect.extent.height = (int32_t) 0xa6452b7745d99eb0;
+        item_views[3].subImage.imageArrayIndex = (uint32_t) 0xfc73d493e9cfc0af;
+        item_views[4].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrEventDataInteractionProfileChanged item_views_4_next[1]{};
+        item_views_4_next[0].type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+        item_views_4_next[0].next = nullptr;
+        item_views_4_next[0].session = (XrSession) 0x9424dca8b9d4e32e;
+        item_views[4].next = item_views_4_next;
+        item_views[4].pose.orientation.x = (float) 0xb8d550a79b355a7c;
+        item_views[4].pose.orientation.y = (float) 0xcb65130dc127364a;
+        item_views[4].pose.orientation.z = (float) 0xffff5c695a440295;
+        item_views[4].pose.orientation.w = (float) 0xe97a6f9e9c5fffed;
+        item_views[4].pose.position.x = (float) 0x636a354a379922e0;
+        item_views[4].pose.position.y = (float) 0x8d5af9d523859032;
+        item_views[4].pose.position.z = (float) 0xa6e3ec95e729261a;
+        item_views[4].fov.angleLeft = (float) 0xdaac2d7b1b61d569;
+        item_views[4].fov.angleRight = (float) 0x5440365193f0164e;
+        item_views[4].fov.angleUp = (float) 0xc648cc2ec2ef33e7;
+        item_views[4].fov.angleDown = (float) 0x9a9a9a478325b63;
+        item_views[4].subImage.swapchain = (XrSwapchain) 0x39de2797f5237231;
+        item_views[4].subImage.imageRect.offset.x = (int32_t) 0xbc7d982e961e4da5;
+        item_views[4].subImage.imageRect.offset.y = (int32_t) 0x406f5f56cce8d1c3;
+        item_views[4].subImage.imageRect.extent.width = (int32_t) 0x4ae00c4741ff78d9;
+        item_views[4].subImage.imageRect.extent.height = (int32_t) 0xadee0607a2338b2d;
+        item_views[4].subImage.imageArrayIndex = (uint32_t) 0x4e8fb4da142c57f4;
+        item_views[5].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrSystemProperties item_views_5_next[1]{};
+        item_views_5_next[0].type = XR_TYPE_SYSTEM_PROPERTIES;
+        item_views_5_next[0].next = nullptr;
+        item_views_5_next[0].systemId = (XrSystemId) 0x9e0c5b2afe12327f;
+        item_views_5_next[0].vendorId = (uint32_t) 0x74b9463b21b6c307;
+        for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+            item_views_5_next[0].systemName[i] = '4';
+        }
+        item_views_5_next[0].graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0xbf9eb3c1cb8595bc;
+        item_views_5_next[0].graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0xb7c370b5ae33d786;
+        item_views_5_next[0].graphicsProperties.maxLayerCount = (uint32_t) 0x5a0a95553c9bee44;
+        item_views_5_next[0].trackingProperties.orientationTracking = (XrBool32) 0x72dcd619e0cc200a;
+        item_views_5_next[0].trackingProperties.positionTracking = (XrBool32) 0xf4c3d1b3aa10e618;
+        item_views[5].next = item_views_5_next;
+        item_views[5].pose.orientation.x = (float) 0x69476c20a28b8882;
+        item_views[5].pose.orientation.y = (float) 0xffa58dded71714c6;
+        item_views[5].pose.orientation.z = (float) 0x1c1fce7fc536ae0c;
+        item_views[5].pose.orientation.w = (float) 0x9521d4d4245f13ff;
+        item_views[5].pose.position.x = (float) 0x5c4dd77552259578;
+        item_views[5].pose.position.y = (float) 0x6a306ab54d5e816f;
+        item_views[5].pose.position.z = (float) 0xf4d7ee4c199bb2d4;
+        item_views[5].fov.angleLeft = (float) 0x6d53e0cf159a5da8;
+        item_views[5].fov.angleRight = (float) 0xce71205a355916cd;
+        item_views[5].fov.angleUp = (float) 0x1a9a0626a035fb9d;
+        item_views[5].fov.angleDown = (float) 0x66b49b5082a97d65;
+        item_views[5].subImage.swapchain = (XrSwapchain) 0x67b3d5902cc32dfa;
+        item_views[5].subImage.imageRect.offset.x = (int32_t) 0x2c3b0cf6fcf989af;
+        item_views[5].subImage.imageRect.offset.y = (int32_t) 0xc21a9d5730d89929;
+        item_views[5].subImage.imageRect.extent.width = (int32_t) 0xfdde53690164a34e;
+        item_views[5].subImage.imageRect.extent.height = (int32_t) 0x48ad9a7a90928361;
+        item_views[5].subImage.imageArrayIndex = (uint32_t) 0x2513e52431d1b8fa;
+        item_views[6].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item_views[6].next = nullptr;
+        item_views[6].pose.orientation.x = (float) 0xd2d3e3281bf556c6;
+        item_views[6].pose.orientation.y = (float) 0xecbab5399d1a44b4;
+        item_views[6].pose.orientation.z = (float) 0xe75fedad3a8bf8a7;
+        item_views[6].pose.orientation.w = (float) 0x6bf5b00f28dc0891;
+        item_views[6].pose.position.x = (float) 0x63a52f91600e8ac6;
+        item_views[6].pose.position.y = (float) 0xc8f82d07316dcd3b;
+        item_views[6].pose.position.z = (float) 0xa36456fd2fa7c470;
+        item_views[6].fov.angleLeft = (float) 0x9eb443ef46e34bc4;
+        item_views[6].fov.angleRight = (float) 0xd0a99a7a6b6ea596;
+        item_views[6].fov.angleUp = (float) 0x18d7be92b3f5dc16;
+        item_views[6].fov.angleDown = (float) 0xa1d77a0d6bcbbbdf;
+        item_views[6].subImage.swapchain = (XrSwapchain) 0xd9ce6b045210252b;
+        item_views[6].subImage.imageRect.offset.x = (int32_t) 0x18618e99d49a655e;
+        item_views[6].subImage.imageRect.offset.y = (int32_t) 0x620bf41312c8b524;
+        item_views[6].subImage.imageRect.extent.width = (int32_t) 0x1607817dfa73bae1;
+        item_views[6].subImage.imageRect.extent.height = (int32_t) 0x4b316dfd94a441d1;
+        item_views[6].subImage.imageArrayIndex = (uint32_t) 0x7fced0d1874123ab;
+        item_views[7].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrCompositionLayerProjectionView item_views_7_next[1]{};
+        item_views_7_next[0].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrActionStatePose item_views_7_next_0_next[1]{};
+        item_views_7_next_0_next[0].type = XR_TYPE_ACTION_STATE_POSE;
+        item_views_7_next_0_next[0].next = nullptr;
+        item_views_7_next_0_next[0].isActive = (XrBool32) 0x5e303e9220e33172;
+        item_views_7_next[0].next = item_views_7_next_0_next;
+        item_views_7_next[0].pose.orientation.x = (float) 0x706828af183dd88b;
+        item_views_7_next[0].pose.orientation.y = (float) 0x5844c8cd02eaa179;
+        item_views_7_next[0].pose.orientation.z = (float) 0xa4b5103604793a7;
+        item_views_7_next[0].pose.orientation.w = (float) 0x28064b9470eff3d9;
+        item_views_7_next[0].pose.position.x = (float) 0xa05a9bcd283be368;
+        item_views_7_next[0].pose.position.y = (float) 0x4e07b0b416e42571;
+        item_views_7_next[0].pose.position.z = (float) 0x88511a5788ba4f47;
+        item_views_7_next[0].fov.angleLeft = (float) 0xb596cfe903737c78;
+        item_views_7_next[0].fov.angleRight = (float) 0x943eaa034ab01a18;
+        item_views_7_next[0].fov.angleUp = (float) 0xb893fe86af57b6d9;
+        item_views_7_next[0].fov.angleDown = (float) 0x44f081990598927;
+        item_views_7_next[0].subImage.swapchain = (XrSwapchain) 0x482125245a8bb9d5;
+        item_views_7_next[0].subImage.imageRect.offset.x = (int32_t) 0xcfeeeceba6e6a112;
+        item_views_7_next[0].subImage.imageRect.offset.y = (int32_t) 0xeab7418bb8b57f8a;
+        item_views_7_next[0].subImage.imageRect.extent.width = (int32_t) 0xb99b00053ab5b0a2;
+        item_views_7_next[0].subImage.imageRect.extent.height = (int32_t) 0xef12d94abcd11eea;
+        item_views_7_next[0].subImage.imageArrayIndex = (uint32_t) 0x2d2a7a08dc386cd;
+        item_views[7].next = item_views_7_next;
+        item_views[7].pose.orientation.x = (float) 0xb9fa4325f207b6a8;
+        item_views[7].pose.orientation.y = (float) 0xbd87483045a46755;
+        item_views[7].pose.orientation.z = (float) 0x4d0186bca172b02d;
+        item_views[7].pose.orientation.w = (float) 0x1c3919e9ca3ef74d;
+        item_views[7].pose.position.x = (float) 0xb46b3745639b9016;
+        item_views[7].pose.position.y = (float) 0xf5f7495cb0b620c5;
+        item_views[7].pose.position.z = (float) 0xceeeee4a8f62e953;
+        item_views[7].fov.angleLeft = (float) 0x3d2141e3b2a2daee;
+        item_views[7].fov.angleRight = (float) 0xab7ace5da80d263e;
+        item_views[7].fov.angleUp = (float) 0x7cb33592270ed053;
+        item_views[7].fov.angleDown = (float) 0x617831c061ea9cce;
+        item_views[7].subImage.swapchain = (XrSwapchain) 0x749f03afee512d3;
+        item_views[7].subImage.imageRect.offset.x = (int32_t) 0xc0e96bfb035fa182;
+        item_views[7].subImage.imageRect.offset.y = (int32_t) 0x4d1f6bddf0a1a9d6;
+        item_views[7].subImage.imageRect.extent.width = (int32_t) 0x3cce05f8b10f6b57;
+        item_views[7].subImage.imageRect.extent.height = (int32_t) 0xee85accba2e83306;
+        item_views[7].subImage.imageArrayIndex = (uint32_t) 0xae7962e600c4ccb5;
+        item_views[8].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrInteractionProfileSuggestedBinding item_views_8_next[1]{};
+        item_views_8_next[0].type = XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING;
+        item_views_8_next[0].next = nullptr;
+        item_views_8_next[0].interactionProfile = (XrPath) 0x4ee14648503da781;
+        item_views_8_next[0].countSuggestedBindings = (uint32_t) 0x384049ce1e4c8e3d;
+        item_views_8_next[0].suggestedBindings = nullptr;
+        item_views[8].next = item_views_8_next;
+        item_views[8].pose.orientation.x = (float) 0xede1223caec11060;
+        item_views[8].pose.orientation.y = (float) 0xf3f2bb6546df9fc4;
+        item_views[8].pose.orientation.z = (float) 0xca73f38dc9f46b22;
+        item_views[8].pose.orientation.w = (float) 0x17437d6ad24b913e;
+        item_views[8].pose.position.x = (float) 0xf2291f6330dbc46f;
+        item_views[8].pose.position.y = (float) 0x8d2f55711f037e6b;
+        item_views[8].pose.position.z = (float) 0xcdf532c60d60e862;
+        item_views[8].fov.angleLeft = (float) 0x26b429801aca71c0;
+        item_views[8].fov.angleRight = (float) 0xef176c83d6a9a0c5;
+        item_views[8].fov.angleUp = (float) 0xa98eeec8f091a0d1;
+        item_views[8].fov.angleDown = (float) 0x8a466f6fac926a88;
+        item_views[8].subImage.swapchain = (XrSwapchain) 0xc724b84fd904e1bb;
+        item_views[8].subImage.imageRect.offset.x = (int32_t) 0xd7bd14d4f333d91a;
+        item_views[8].subImage.imageRect.offset.y = (int32_t) 0xf9953845c1fd45c6;
+        item_views[8].subImage.imageRect.extent.width = (int32_t) 0x30576f66f79ca8b7;
+        item_views[8].subImage.imageRect.extent.height = (int32_t) 0x453e2c393d2541fe;
+        item_views[8].subImage.imageArrayIndex = (uint32_t) 0x7d109613e4d825eb;
+        item_views[9].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrFrameWaitInfo item_views_9_next[1]{};
+        item_views_9_next[0].type = XR_TYPE_FRAME_WAIT_INFO;
+        XrSystemProperties item_views_9_next_0_next[1]{};
+        item_views_9_next_0_next[0].type = XR_TYPE_SYSTEM_PROPERTIES;
+        XrSystemProperties item_views_9_next_0_next_0_next[1]{};
+        item_views_9_next_0_next_0_next[0].type = XR_TYPE_SYSTEM_PROPERTIES;
+        item_views_9_next_0_next_0_next[0].next = nullptr;
+        item_views_9_next_0_next_0_next[0].systemId = (XrSystemId) 0x191114821d3481fb;
+        item_views_9_next_0_next_0_next[0].vendorId = (uint32_t) 0x14ef3eed72b09604;
+        for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+            item_views_9_next_0_next_0_next[0].systemName[i] = 'e';
+        }
+        item_views_9_next_0_next_0_next[0].graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0x749e8082db34037d;
+        item_views_9_next_0_next_0_next[0].graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0x7908954c116872d7;
+        item_views_9_next_0_next_0_next[0].graphicsProperties.maxLayerCount = (uint32_t) 0xadd719e0fcc2d11a;
+        item_views_9_next_0_next_0_next[0].trackingProperties.orientationTracking = (XrBool32) 0x733a6d166691b51d;
+        item_views_9_next_0_next_0_next[0].trackingProperties.positionTracking = (XrBool32) 0x13d464b523eea6f2;
+        item_views_9_next_0_next[0].next = item_views_9_next_0_next_0_next;
+        item_views_9_next_0_next[0].systemId = (XrSystemId) 0x6066181bb1931f84;
+        item_views_9_next_0_next[0].vendorId = (uint32_t) 0x3b70f0c50ccf856f;
+        for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+            item_views_9_next_0_next[0].systemName[i] = 'f';
+        }
+        item_views_9_next_0_next[0].graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0xca1a47f1b236cb9f;
+        item_views_9_next_0_next[0].graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0xda3bace2e3e96e5;
+        item_views_9_next_0_next[0].graphicsProperties.maxLayerCount = (uint32_t) 0xfd30029a25b600a3;
+        item_views_9_next_0_next[0].trackingProperties.orientationTracking = (XrBool32) 0x392ef165edb152c5;
+        item_views_9_next_0_next[0].trackingProperties.positionTracking = (XrBool32) 0xf8454ad0f0250c16;
+        item_views_9_next[0].next = item_views_9_next_0_next;
+        item_views[9].next = item_views_9_next;
+        item_views[9].pose.orientation.x = (float) 0x2c120a01ce6e5635;
+        item_views[9].pose.orientation.y = (float) 0xc2163647788661f8;
+        item_views[9].pose.orientation.z = (float) 0x9f74435088d26c6b;
+        item_views[9].pose.orientation.w = (float) 0x5d414a5ca79ea187;
+        item_views[9].pose.position.x = (float) 0x7a787391acc02757;
+        item_views[9].pose.position.y = (float) 0xd865554aedcf3e4;
+        item_views[9].pose.position.z = (float) 0x598f27f05a561a0c;
+        item_views[9].fov.angleLeft = (float) 0x888117505c3481ea;
+        item_views[9].fov.angleRight = (float) 0x855472bd43a7eb1b;
+        item_views[9].fov.angleUp = (float) 0x1b5e6eafe4d9319c;
+        item_views[9].fov.angleDown = (float) 0x7ba6dcc71952c758;
+        item_views[9].subImage.swapchain = (XrSwapchain) 0xc409de0e72c1029e;
+        item_views[9].subImage.imageRect.offset.x = (int32_t) 0xecddc38fe4bd9fa7;
+        item_views[9].subImage.imageRect.offset.y = (int32_t) 0xf0fb3dea0e963a3a;
+        item_views[9].subImage.imageRect.extent.width = (int32_t) 0xc74f56910e787eb0;
+        item_views[9].subImage.imageRect.extent.height = (int32_t) 0x90990e5bc3373ca5;
+        item_views[9].subImage.imageArrayIndex = (uint32_t) 0xc5925d4837153a2;
+        item_views[10].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrSystemProperties item_views_10_next[1]{};
+        item_views_10_next[0].type = XR_TYPE_SYSTEM_PROPERTIES;
+        XrActionCreateInfo item_views_10_next_0_next[1]{};
+        item_views_10_next_0_next[0].type = XR_TYPE_ACTION_CREATE_INFO;
+        item_views_10_next_0_next[0].next = nullptr;
+        for (int i = 0; i < XR_MAX_ACTION_NAME_SIZE; i++) {
+            item_views_10_next_0_next[0].actionName[i] = '6';
+        }
+        item_views_10_next_0_next[0].actionType = (XrActionType) 0x57ed017f14efdfcf;
+        item_views_10_next_0_next[0].countSubactionPaths = 5;
+        XrPath item_views_10_next_0_next_0_subactionPaths[5]{};
+        item_views_10_next_0_next_0_subactionPaths[0] = (XrPath) 0xcd540b0ad76b6470;
+        item_views_10_next_0_next_0_subactionPaths[1] = (XrPath) 0x52bf75758aa43077;
+        item_views_10_next_0_next_0_subactionPaths[2] = (XrPath) 0xeaf57b4de7aec8f5;
+        item_views_10_next_0_next_0_subactionPaths[3] = (XrPath) 0xfaf1f16fc0595840;
+        item_views_10_next_0_next_0_subactionPaths[4] = (XrPath) 0xa1827d3281774f09;
+        item_views_10_next_0_next[0].subactionPaths = item_views_10_next_0_next_0_subactionPaths;
+        for (int i = 0; i < XR_MAX_LOCALIZED_ACTION_NAME_SIZE; i++) {
+            item_views_10_next_0_next[0].localizedActionName[i] = 'v';
+        }
+        item_views_10_next[0].next = item_views_10_next_0_next;
+        item_views_10_next[0].systemId = (XrSystemId) 0xac070ee29a9e9637;
+        item_views_10_next[0].vendorId = (uint32_t) 0x80012791d02c6367;
+        for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+            item_views_10_next[0].systemName[i] = 'u';
+        }
+        item_views_10_next[0].graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0xc700c2701b44eeb;
+        item_views_10_next[0].graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0x8a0bf5239eed75c4;
+        item_views_10_next[0].graphicsProperties.maxLayerCount = (uint32_t) 0xaeba7d070739f5cd;
+        item_views_10_next[0].trackingProperties.orientationTracking = (XrBool32) 0x9627c35e41dc57de;
+        item_views_10_next[0].trackingProperties.positionTracking = (XrBool32) 0x1249e0cfd2939680;
+        item_views[10].next = item_views_10_next;
+        item_views[10].pose.orientation.x = (float) 0x25208a3a026a6c98;
+        item_views[10].pose.orientation.y = (float) 0xbc38c140f4b56f6a;
+        item_views[10].pose.orientation.z = (float) 0x6b8f3169f6f7e307;
+        item_views[10].pose.orientation.w = (float) 0x9c5965a47cab52ba;
+        item_views[10].pose.position.x = (float) 0x4027671d00ca1f99;
+        item_views[10].pose.position.y = (float) 0x18e33a1e4ff30654;
+        item_views[10].pose.position.z = (float) 0x2a3d4a87b3df91e;
+        item_views[10].fov.angleLeft = (float) 0x131b43e970f44851;
+        item_views[10].fov.angleRight = (float) 0xafabd6cf773fc726;
+        item_views[10].fov.angleUp = (float) 0x1e00a4b9e25488f6;
+        item_views[10].fov.angleDown = (float) 0xda0b8e9b7337a7ac;
+        item_views[10].subImage.swapchain = (XrSwapchain) 0x23aae6eda8213ea5;
+        item_views[10].subImage.imageRect.offset.x = (int32_t) 0xfd35f478f99b5b90;
+        item_views[10].subImage.imageRect.offset.y = (int32_t) 0xa8490abb630820fc;
+        item_views[10].subImage.imageRect.extent.width = (int32_t) 0x57dcf553bef4b6ce;
+        item_views[10].subImage.imageRect.extent.height = (int32_t) 0x1ab7730df0febe5f;
+        item_views[10].subImage.imageArrayIndex = (uint32_t) 0x25bc9aff736b80a8;
+        item_views[11].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        XrViewConfigurationView item_views_11_next[1]{};
+        item_views_11_next[0].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+        item_views_11_next[0].next = nullptr;
+        item_views_11_next[0].recommendedImageRectWidth = (uint32_t) 0x96136407b491b9fc;
+        item_views_11_next[0].maxImageRectWidth = (uint32_t) 0xdf942caaa74a1087;
+        item_views_11_next[0].recommendedImageRectHeight = (uint32_t) 0x9f6aa2d664891149;
+        item_views_11_next[0].maxImageRectHeight = (uint32_t) 0x903c49b977638cc2;
+        item_views_11_next[0].recommendedSwapchainSampleCount = (uint32_t) 0xde981ab87e610f64;
+        item_views_11_next[0].maxSwapchainSampleCount = (uint32_t) 0xd663ab542cf7e8cc;
+        item_views[11].next = item_views_11_next;
+        item_views[11].pose.orientation.x = (float) 0x3e320ddcefa295bd;
+        item_views[11].pose.orientation.y = (float) 0x1009304267449d36;
+        item_views[11].pose.orientation.z = (float) 0x454bf8714c0c92b0;
+        item_views[11].pose.orientation.w = (float) 0x52f76cd402888d6a;
+        item_views[11].pose.position.x = (float) 0x223e81b011e135df;
+        item_views[11].pose.position.y = (float) 0x296579134b854492;
+        item_views[11].pose.position.z = (float) 0x28a1f17c7bd8eb4;
+        item_views[11].fov.angleLeft = (float) 0x1dc1efc1b05f3cf3;
+        item_views[11].fov.angleRight = (float) 0x9bf0973d8c1ab8a3;
+        item_views[11].fov.angleUp = (float) 0x1bc972ca705323dd;
+        item_views[11].fov.angleDown = (float) 0x983eccc42bfc5cfe;
+        item_views[11].subImage.swapchain = (XrSwapchain) 0x51ac0f2d6d2d92bd;
+        item_views[11].subImage.imageRect.offset.x = (int32_t) 0x844480ed482f2d88;
+        item_views[11].subImage.imageRect.offset.y = (int32_t) 0x3213c250d95e2415;
+        item_views[11].subImage.imageRect.extent.width = (int32_t) 0x2e5e3198a6b4c017;
+        item_views[11].subImage.imageRect.extent.height = (int32_t) 0x615548ece7312fb;
+        item_views[11].subImage.imageArrayIndex = (uint32_t) 0xea011e5d1e1378d0;
+        item_views[12].type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item_views[12].next = nullptr;
+        item_views[12].pose.orientation.x = (float) 0x2d420cdb576030b;
+        item_views[12].pose.orientation.y = (float) 0xed89d11c8c232aa6;
+        item_views[12].pose.orientation.z = (float) 0x10d592579b778752;
+        item_views[12].pose.orientation.w = (float) 0xa5c969fa0d36c797;
+        item_views[12].pose.position.x = (float) 0x988a1c344ff49050;
+        item_views[12].pose.position.y = (float) 0xa12ab449f53102a2;
+        item_views[12].pose.position.z = (float) 0x1f018a53d5357195;
+        item_views[12].fov.angleLeft = (float) 0x21f7dcae20f6961f;
+        item_views[12].fov.angleRight = (float) 0x35b90aa7d0cd9c55;
+        item_views[12].fov.angleUp = (float) 0x10a4cc831719a872;
+        item_views[12].fov.angleDown = (float) 0x84c361c0af35bd5a;
+        item_views[12].subImage.swapchain = (XrSwapchain) 0x37d1666f2d2ec5f5;
+        item_views[12].subImage.imageRect.offset.x = (int32_t) 0xe299f30331d54393;
+        item_views[12].subImage.imageRect.offset.y = (int32_t) 0x156759b0e83a7c7d;
+        item_views[12].subImage.imageRect.extent.width = (int32_t) 0x4216e37cb1e54f5;
+        item_views[12].subImage.imageRect.extent.height = (int32_t) 0xc331e71801bd9870;
+        item_views[12].subImage.imageArrayIndex = (uint32_t) 0x8788d1332b6062d2;
+        item.views = item_views;
+        check_same_bytes(item, fields_XrCompositionLayerProjection, false);
+        check_same_bytes(item, fields_XrCompositionLayerProjection, true);
+    }
+    SECTION("XrCompositionLayerProjectionView") {
+        XrCompositionLayerProjectionView item{};
+        item.type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
+        item.next = nullptr;
+        item.pose.orientation.x = (float) 0x7b48cc17e6de39d;
+        item.pose.orientation.y = (float) 0x538428f71ef83f7;
+        item.pose.orientation.z = (float) 0xfbff40331cedbe90;
+        item.pose.orientation.w = (float) 0xe1c0ded2468a5cd6;
+        item.pose.position.x = (float) 0x9672cd694b056557;
+        item.pose.position.y = (float) 0xb5e697741ec9f7f;
+        item.pose.position.z = (float) 0x14c7af573cb32000;
+        item.fov.angleLeft = (float) 0x21c89ef47bf8285d;
+        item.fov.angleRight = (float) 0xfe8747c302a1d609;
+        item.fov.angleUp = (float) 0xd9405c252380886b;
+        item.fov.angleDown = (float) 0x511cb2f4b955e750;
+        item.subImage.swapchain = (XrSwapchain) 0x815370102085d385;
+        item.subImage.imageRect.offset.x = (int32_t) 0x97a1a37d380be8a8;
+        item.subImage.imageRect.offset.y = (int32_t) 0x96cd8b94d3abe3a;
+        item.subImage.imageRect.extent.width = (int32_t) 0x85e39b3e48cc3ae9;
+        item.subImage.imageRect.extent.height = (int32_t) 0xce82c50ba32b2ca1;
+        item.subImage.imageArrayIndex = (uint32_t) 0x354f3a6df04a3a5a;
+        check_same_bytes(item, fields_XrCompositionLayerProjectionView, false);
+        check_same_bytes(item, fields_XrCompositionLayerProjectionView, true);
+    }
+    SECTION("XrCompositionLayerQuad") {
+        XrCompositionLayerQuad item{};
+        item.type = XR_TYPE_COMPOSITION_LAYER_QUAD;
+        XrActionsSyncInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_ACTIONS_SYNC_INFO;
+        XrSwapchainCreateInfo item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_SWAPCHAIN_CREATE_INFO;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].createFlags = (XrSwapchainCreateFlags) 0x8eb6a02c0587e87d;
+        item_next_0_next[0].usageFlags = (XrSwapchainUsageFlags) 0xc06f950e913ead4d;
+        item_next_0_next[0].format = (int64_t) 0xe5b13994a6b82a41;
+        item_next_0_next[0].sampleCount = (uint32_t) 0xa544eb82529ba4a8;
+        item_next_0_next[0].width = (uint32_t) 0xd07b3a6674b96867;
+        item_next_0_next[0].height = (uint32_t) 0xb7ab8dc5da20e2af;
+        item_next_0_next[0].faceCount = (uint32_t) 0x6159552a9eca68c9;
+        item_next_0_next[0].arraySize = (uint32_t) 0xd16ea7b3deb06e32;
+        item_next_0_next[0].mipCount = (uint32_t) 0x3f282ac397f2f34a;
+        item_next[0].next = item_next_0_next;
+        item_next[0].countActiveActionSets = 5;
+        XrActiveActionSet item_next_0_activeActionSets[5]{};
+        item_next_0_activeActionSets[0].actionSet = (XrActionSet) 0x662c45e89c519b65;
+        item_next_0_activeActionSets[0].subactionPath = (XrPath) 0x43c780de9786cf09;
+        item_next_0_activeActionSets[1].actionSet = (XrActionSet) 0x4aa9efff6f12a461;
+        item_next_0_activeActionSets[1].subactionPath = (XrPath) 0x32b726b52da573d0;
+        item_next_0_activeActionSets[2].actionSet = (XrActionSet) 0x7a1942ebf6f46d48;
+        item_next_0_activeActionSets[2].subactionPath = (XrPath) 0x2d27e62a8c02ed83;
+        item_next_0_activeActionSets[3].actionSet = (XrActionSet) 0xd150cfa777299761;
+        item_next_0_activeActionSets[3].subactionPath = (XrPath) 0x70499e9499db84a0;
+        item_next_0_activeActionSets[4].actionSet = (XrActionSet) 0xd90a87df8d0b7172;
+        item_next_0_activeActionSets[4].subactionPath = (XrPath) 0x5b4284ac26fb58c4;
+        item_next[0].activeActionSets = item_next_0_activeActionSets;
+        item.next = item_next;
+        item.layerFlags = (XrCompositionLayerFlags) 0x7c46f5b6fcf76ff6;
+        item.space = (XrSpace) 0x7aeb06fe3b8d3092;
+        item.eyeVisibility = (XrEyeVisibility) 0xf5d1347d91dddd69;
+        item.subImage.swapchain = (XrSwapchain) 0x802841931581db4b;
+        item.subImage.imageRect.offset.x = (int32_t) 0xa890fe220a5679e6;
+        item.subImage.imageRect.offset.y = (int32_t) 0x216ca887190e7268;
+        item.subImage.imageRect.extent.width = (int32_t) 0x5ec63d10c8063a;
+        item.subImage.imageRect.extent.height = (int32_t) 0xb49ae75bd1dbf8b1;
+        item.subImage.imageArrayIndex = (uint32_t) 0x5310e7f13a566549;
+        item.pose.orientation.x = (float) 0xe649e7a144d7f1ae;
+        item.pose.orientation.y = (float) 0x464f2386109ecdfe;
+        item.pose.orientation.z = (float) 0xd4851a802fa798c6;
+        item.pose.orientation.w = (float) 0x8d00a60d9134de2c;
+        item.pose.position.x = (float) 0x6dbd6ea15a6e97d7;
+        item.pose.position.y = (float) 0x18ab88d9d2082d18;
+        item.pose.position.z = (float) 0x7cc5494c51862621;
+        item.size.width = (float) 0xcf5da06ee5d59b8b;
+        item.size.height = (float) 0xb54d1686a00fc279;
+        check_same_bytes(item, fields_XrCompositionLayerQuad, false);
+        check_same_bytes(item, fields_XrCompositionLayerQuad, true);
+    }
+    SECTION("XrEventDataBuffer") {
+        XrEventDataBuffer item{};
+        item.type = XR_TYPE_EVENT_DATA_BUFFER;
+        item.next = nullptr;
+        for (int i = 0; i < 4000; i++) {
+            item.varying[i] = (uint8_t) 0x6515673a5839f9a0;
+        }
+        check_same_bytes(item, fields_XrEventDataBuffer, false);
+        check_same_bytes(item, fields_XrEventDataBuffer, true);
+    }
+    SECTION("XrEventDataEventsLost") {
+        XrEventDataEventsLost item{};
+        item.type = XR_TYPE_EVENT_DATA_EVENTS_LOST;
+        item.next = nullptr;
+        item.lostEventCount = (uint32_t) 0xecdb8197ab877cda;
+        check_same_bytes(item, fields_XrEventDataEventsLost, false);
+        check_same_bytes(item, fields_XrEventDataEventsLost, true);
+    }
+    SECTION("XrEventDataInstanceLossPending") {
+        XrEventDataInstanceLossPending item{};
+        item.type = XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING;
+        item.next = nullptr;
+        item.lossTime = (XrTime) 0xe025c20695cb365f;
+        check_same_bytes(item, fields_XrEventDataInstanceLossPending, false);
+        check_same_bytes(item, fields_XrEventDataInstanceLossPending, true);
+    }
+    SECTION("XrEventDataInteractionProfileChanged") {
+        XrEventDataInteractionProfileChanged item{};
+        item.type = XR_TYPE_EVENT_DATA_INTERACTION_PROFILE_CHANGED;
+        XrEventDataInstanceLossPending item_next[1]{};
+        item_next[0].type = XR_TYPE_EVENT_DATA_INSTANCE_LOSS_PENDING;
+        item_next[0].next = nullptr;
+        item_next[0].lossTime = (XrTime) 0xd1fca52ebca64163;
+        item.next = item_next;
+        item.session = (XrSession) 0x77e05eddf3ed8d64;
+        check_same_bytes(item, fields_XrEventDataInteractionProfileChanged, false);
+        check_same_bytes(item, fields_XrEventDataInteractionProfileChanged, true);
+    }
+    SECTION("XrEventDataReferenceSpaceChangePending") {
+        XrEventDataReferenceSpaceChangePending item{};
+        item.type = XR_TYPE_EVENT_DATA_REFERENCE_SPACE_CHANGE_PENDING;
+        item.next = nullptr;
+        item.session = (XrSession) 0x2f1fa9ad77a617ca;
+        item.referenceSpaceType = (XrReferenceSpaceType) 0x8582e262a7eb2f51;
+        item.changeTime = (XrTime) 0x9f86d63e36362291;
+        item.poseValid = (XrBool32) 0x17cd4929ae070dba;
+        item.poseInPreviousSpace.orientation.x = (float) 0xfef83cc86b831116;
+        item.poseInPreviousSpace.orientation.y = (float) 0xc37107f96b19d1fc;
+        item.poseInPreviousSpace.orientation.z = (float) 0xd0dcb1018c49475f;
+        item.poseInPreviousSpace.orientation.w = (float) 0x6ba9ec8ff1ce3ba;
+        item.poseInPreviousSpace.position.x = (float) 0x74af99fe62cdf756;
+        item.poseInPreviousSpace.position.y = (float) 0x5949995bad61e038;
+        item.poseInPreviousSpace.position.z = (float) 0xf0e637daad4b1588;
+        check_same_bytes(item, fields_XrEventDataReferenceSpaceChangePending, false);
+        check_same_bytes(item, fields_XrEventDataReferenceSpaceChangePending, true);
+    }
+    SECTION("XrEventDataSessionStateChanged") {
+        XrEventDataSessionStateChanged item{};
+        item.type = XR_TYPE_EVENT_DATA_SESSION_STATE_CHANGED;
+        item.next = nullptr;
+        item.session = (XrSession) 0xf67eb026df6fbba4;
+        item.state = (XrSessionState) 0x3fca2b1d0303d91b;
+        item.time = (XrTime) 0x83d472ee97d9a017;
+        check_same_bytes(item, fields_XrEventDataSessionStateChanged, false);
+        check_same_bytes(item, fields_XrEventDataSessionStateChanged, true);
+    }
+    SECTION("XrExtensionProperties") {
+        XrExtensionProperties item{};
+        item.type = XR_TYPE_EXTENSION_PROPERTIES;
+        item.next = nullptr;
+        for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+            item.extensionName[i] = 'B';
+        }
+        item.extensionVersion = (uint32_t) 0x241e5b3df37cf896;
+        check_same_bytes(item, fields_XrExtensionProperties, false);
+        check_same_bytes(item, fields_XrExtensionProperties, true);
+    }
+    SECTION("XrExtent2Df") {
+        XrExtent2Df item{};
+        item.width = (float) 0xfcd0b25f9f0810ae;
+        item.height = (float) 0xf192b9930e61aa2b;
+        check_same_bytes(item, fields_XrExtent2Df, false);
+        check_same_bytes(item, fields_XrExtent2Df, true);
+    }
+    SECTION("XrExtent2Di") {
+        XrExtent2Di item{};
+        item.width = (int32_t) 0xac58e4ec2ff65d5a;
+        item.height = (int32_t) 0x8f8a24cebeeb31f1;
+        check_same_bytes(item, fields_XrExtent2Di, false);
+        check_same_bytes(item, fields_XrExtent2Di, true);
+    }
+    SECTION("XrExtent3Df") {
+        XrExtent3Df item{};
+        item.width = (float) 0xabaff16af62d7736;
+        item.height = (float) 0xdabdcf858a4a856e;
+        item.depth = (float) 0xaa72ffbb9ed20b93;
+        check_same_bytes(item, fields_XrExtent3Df, false);
+        check_same_bytes(item, fields_XrExtent3Df, true);
+    }
+    SECTION("XrFovf") {
+        XrFovf item{};
+        item.angleLeft = (float) 0x644e81d6a8309dc6;
+        item.angleRight = (float) 0xb42f7bf190d05835;
+        item.angleUp = (float) 0xc214800eac48589c;
+        item.angleDown = (float) 0x4e6b65947b2ffd40;
+        check_same_bytes(item, fields_XrFovf, false);
+        check_same_bytes(item, fields_XrFovf, true);
+    }
+    SECTION("XrFrameBeginInfo") {
+        XrFrameBeginInfo item{};
+        item.type = XR_TYPE_FRAME_BEGIN_INFO;
+        XrActionStateVector2f item_next[1]{};
+        item_next[0].type = XR_TYPE_ACTION_STATE_VECTOR2F;
+        item_next[0].next = nullptr;
+        item_next[0].currentState.x = (float) 0x747ff5e11fed6d1;
+        item_next[0].currentState.y = (float) 0xcea3d1fb764ca19;
+        item_next[0].changedSinceLastSync = (XrBool32) 0xc72b8905586199f;
+        item_next[0].lastChangeTime = (XrTime) 0x30c7b86c541c7af9;
+        item_next[0].isActive = (XrBool32) 0x4ac402d7db311790;
+        item.next = item_next;
+        check_same_bytes(item, fields_XrFrameBeginInfo, false);
+        check_same_bytes(item, fields_XrFrameBeginInfo, true);
+    }
+    SECTION("XrFrameState") {
+        XrFrameState item{};
+        item.type = XR_TYPE_FRAME_STATE;
+        item.next = nullptr;
+        item.predictedDisplayTime = (XrTime) 0xa2824a65af07616d;
+        item.predictedDisplayPeriod = (XrDuration) 0xe9588b54751530e8;
+        item.shouldRender = (XrBool32) 0x3a79ae5fcdec455e;
+        check_same_bytes(item, fields_XrFrameState, false);
+        check_same_bytes(item, fields_XrFrameState, true);
+    }
+    SECTION("XrFrameWaitInfo") {
+        XrFrameWaitInfo item{};
+        item.type = XR_TYPE_FRAME_WAIT_INFO;
+        item.next = nullptr;
+        check_same_bytes(item, fields_XrFrameWaitInfo, false);
+        check_same_bytes(item, fields_XrFrameWaitInfo, true);
+    }
+    SECTION("XrFrustumf") {
+        XrFrustumf item{};
+        item.pose.orientation.x = (float) 0x8d8cad6dacdb6639;
+        item.pose.orientation.y = (float) 0xcea60cd7a0486adf;
+        item.pose.orientation.z = (float) 0x9c4619a8106ac5dc;
+        item.pose.orientation.w = (float) 0x4aa67a1fb37c4763;
+        item.pose.position.x = (float) 0xeed84d1cc51a115;
+        item.pose.position.y = (float) 0xd776929c93ecc89d;
+        item.pose.position.z = (float) 0x9a222e68986dd73a;
+        item.fov.angleLeft = (float) 0xd555a058b986be61;
+        item.fov.angleRight = (float) 0x25b586e7551edc82;
+        item.fov.angleUp = (float) 0x167cff37b0a639e0;
+        item.fov.angleDown = (float) 0x68c764eff6f360e6;
+        item.nearZ = (float) 0x6eab223724a6c590;
+        item.farZ = (float) 0x4f0e83ea4c410300;
+        check_same_bytes(item, fields_XrFrustumf, false);
+        check_same_bytes(item, fields_XrFrustumf, true);
+    }
+    SECTION("XrHapticActionInfo") {
+        XrHapticActionInfo item{};
+        item.type = XR_TYPE_HAPTIC_ACTION_INFO;
+        XrReferenceSpaceCreateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_REFERENCE_SPACE_CREATE_INFO;
+        item_next[0].next = nullptr;
+        item_next[0].referenceSpaceType = (XrReferenceSpaceType) 0x3366e2b72deab196;
+        item_next[0].poseInReferenceSpace.orientation.x = (float) 0x919c9493784abaea;
+        item_next[0].poseInReferenceSpace.orientation.y = (float) 0x687a438a4c75f36;
+        item_next[0].poseInReferenceSpace.orientation.z = (float) 0xf5e75e422ad7c1bc;
+        item_next[0].poseInReferenceSpace.orientation.w = (float) 0x3740a5debb37f24d;
+        item_next[0].poseInReferenceSpace.position.x = (float) 0xbb1efe6870affc1f;
+        item_next[0].poseInReferenceSpace.position.y = (float) 0xf87939db031f1b9b;
+        item_next[0].poseInReferenceSpace.position.z = (float) 0x33a7c99b2c27049c;
+        item.next = item_next;
+        item.action = (XrAction) 0x2239169c83ef6fc0;
+        item.subactionPath = (XrPath) 0xc4bbe05a06ee3f38;
+        check_same_bytes(item, fields_XrHapticActionInfo, false);
+        check_same_bytes(item, fields_XrHapticActionInfo, true);
+    }
+    SECTION("XrHapticVibration") {
+        XrHapticVibration item{};
+        item.type = XR_TYPE_HAPTIC_VIBRATION;
+        item.next = nullptr;
+        item.duration = (XrDuration) 0x12ffa86cebaab300;
+        item.frequency = (float) 0xf15026a592a90f73;
+        item.amplitude = (float) 0x4d9eb1ef2934f2fe;
+        check_same_bytes(item, fields_XrHapticVibration, false);
+        check_same_bytes(item, fields_XrHapticVibration, true);
+    }
+    SECTION("XrInputSourceLocalizedNameGetInfo") {
+        XrInputSourceLocalizedNameGetInfo item{};
+        item.type = XR_TYPE_INPUT_SOURCE_LOCALIZED_NAME_GET_INFO;
+        item.next = nullptr;
+        item.sourcePath = (XrPath) 0x2a49b299c3c6d0a9;
+        item.whichComponents = (XrInputSourceLocalizedNameFlags) 0xa260dee26a237abd;
+        check_same_bytes(item, fields_XrInputSourceLocalizedNameGetInfo, false);
+        check_same_bytes(item, fields_XrInputSourceLocalizedNameGetInfo, true);
+    }
+    SECTION("XrInstanceProperties") {
+        XrInstanceProperties item{};
+        item.type = XR_TYPE_INSTANCE_PROPERTIES;
+        XrSpacesLocateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_SPACES_LOCATE_INFO;
+        item_next[0].next = nullptr;
+        item_next[0].baseSpace = (XrSpace) 0x29f7780e83a466fd;
+        item_next[0].time = (XrTime) 0x3074a99b82a736a8;
+        item_next[0].spaceCount = (uint32_t) 0x38aff6c6fa483af9;
+        item_next[0].spaces = nullptr;
+        item.next = item_next;
+        item.runtimeVersion = (XrVersion) 0x98f76e4591869c25;
+        for (int i = 0; i < XR_MAX_RUNTIME_NAME_SIZE; i++) {
+            item.runtimeName[i] = 'F';
+        }
+        check_same_bytes(item, fields_XrInstanceProperties, false);
+        check_same_bytes(item, fields_XrInstanceProperties, true);
+    }
+    SECTION("XrInteractionProfileState") {
+        XrInteractionProfileState item{};
+        item.type = XR_TYPE_INTERACTION_PROFILE_STATE;
+        XrInstanceProperties item_next[1]{};
+        item_next[0].type = XR_TYPE_INSTANCE_PROPERTIES;
+        item_next[0].next = nullptr;
+        item_next[0].runtimeVersion = (XrVersion) 0x2b3d9291d1c65ac3;
+        for (int i = 0; i < XR_MAX_RUNTIME_NAME_SIZE; i++) {
+            item_next[0].runtimeName[i] = 'i';
+        }
+        item.next = item_next;
+        item.interactionProfile = (XrPath) 0x82af06f4690680bd;
+        check_same_bytes(item, fields_XrInteractionProfileState, false);
+        check_same_bytes(item, fields_XrInteractionProfileState, true);
+    }
+    SECTION("XrInteractionProfileSuggestedBinding") {
+        XrInteractionProfileSuggestedBinding item{};
+        item.type = XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING;
+        item.next = nullptr;
+        item.interactionProfile = (XrPath) 0xcd5fb5b0185e7b43;
+        item.countSuggestedBindings = (uint32_t) 0x352d121ede07fff2;
+        item.suggestedBindings = nullptr;
+        check_same_bytes(item, fields_XrInteractionProfileSuggestedBinding, false);
+        check_same_bytes(item, fields_XrInteractionProfileSuggestedBinding, true);
+    }
+    SECTION("XrOffset2Df") {
+        XrOffset2Df item{};
+        item.x = (float) 0x710ee2f69165a0a3;
+        item.y = (float) 0xf1b56a9ab503b3cd;
+        check_same_bytes(item, fields_XrOffset2Df, false);
+        check_same_bytes(item, fields_XrOffset2Df, true);
+    }
+    SECTION("XrOffset2Di") {
+        XrOffset2Di item{};
+        item.x = (int32_t) 0xb14c7a8c7e11d7e9;
+        item.y = (int32_t) 0xc03cc5e4f4f085d4;
+        check_same_bytes(item, fields_XrOffset2Di, false);
+        check_same_bytes(item, fields_XrOffset2Di, true);
+    }
+    SECTION("XrPosef") {
+        XrPosef item{};
+        item.orientation.x = (float) 0xb165226b797cdf19;
+        item.orientation.y = (float) 0x59aa2ed76326bf01;
+        item.orientation.z = (float) 0xf030024bc3c48705;
+        item.orientation.w = (float) 0x17a16f5a89560159;
+        item.position.x = (float) 0x66ae0508c99cc05;
+        item.position.y = (float) 0xc5ac56eaf0905b8d;
+        item.position.z = (float) 0xf85461c32672324d;
+        check_same_bytes(item, fields_XrPosef, false);
+        check_same_bytes(item, fields_XrPosef, true);
+    }
+    SECTION("XrQuaternionf") {
+        XrQuaternionf item{};
+        item.x = (float) 0xdd4fffacc9222726;
+        item.y = (float) 0xc18c0fe0e3d3deca;
+        item.z = (float) 0x8a0945f9454de24a;
+        item.w = (float) 0xd3c57f12cd8bebfe;
+        check_same_bytes(item, fields_XrQuaternionf, false);
+        check_same_bytes(item, fields_XrQuaternionf, true);
+    }
+    SECTION("XrRect2Df") {
+        XrRect2Df item{};
+        item.offset.x = (float) 0x3b55a1af24654c34;
+        item.offset.y = (float) 0x356ec0b1f45562be;
+        item.extent.width = (float) 0x1fad098bf410d9d4;
+        item.extent.height = (float) 0x3be20ff1d5eb399d;
+        check_same_bytes(item, fields_XrRect2Df, false);
+        check_same_bytes(item, fields_XrRect2Df, true);
+    }
+    SECTION("XrRect2Di") {
+        XrRect2Di item{};
+        item.offset.x = (int32_t) 0x38e5eb9ed8fce331;
+        item.offset.y = (int32_t) 0xf8036c1bb55698f7;
+        item.extent.width = (int32_t) 0xb368f7e7f4d238a3;
+        item.extent.height = (int32_t) 0xf95e72cce4c52f92;
+        check_same_bytes(item, fields_XrRect2Di, false);
+        check_same_bytes(item, fields_XrRect2Di, true);
+    }
+    SECTION("XrReferenceSpaceCreateInfo") {
+        XrReferenceSpaceCreateInfo item{};
+        item.type = XR_TYPE_REFERENCE_SPACE_CREATE_INFO;
+        item.next = nullptr;
+        item.referenceSpaceType = (XrReferenceSpaceType) 0xbff22a0988e93a62;
+        item.poseInReferenceSpace.orientation.x = (float) 0x9deb978739564ccb;
+        item.poseInReferenceSpace.orientation.y = (float) 0x3d0ac758a3325008;
+        item.poseInReferenceSpace.orientation.z = (float) 0xaf62bf68a692f39f;
+        item.poseInReferenceSpace.orientation.w = (float) 0xc1403877108b9687;
+        item.poseInReferenceSpace.position.x = (float) 0xd546d2f66dc8ec49;
+        item.poseInReferenceSpace.position.y = (float) 0xc644b53df279b219;
+        item.poseInReferenceSpace.position.z = (float) 0x6521bca8e7c88d92;
+        check_same_bytes(item, fields_XrReferenceSpaceCreateInfo, false);
+        check_same_bytes(item, fields_XrReferenceSpaceCreateInfo, true);
+    }
+    SECTION("XrSessionActionSetsAttachInfo") {
+        XrSessionActionSetsAttachInfo item{};
+        item.type = XR_TYPE_SESSION_ACTION_SETS_ATTACH_INFO;
+        XrSwapchainCreateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_SWAPCHAIN_CREATE_INFO;
+        XrActionStateFloat item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_ACTION_STATE_FLOAT;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].currentState = (float) 0x1ef14a9a09e4ef97;
+        item_next_0_next[0].changedSinceLastSync = (XrBool32) 0x35bb46ae64db9679;
+        item_next_0_next[0].lastChangeTime = (XrTime) 0xe4dd0aa349d5a2ec;
+        item_next_0_next[0].isActive = (XrBool32) 0xf78fccf966dd588b;
+        item_next[0].next = item_next_0_next;
+        item_next[0].createFlags = (XrSwapchainCreateFlags) 0xc0f440df32757c23;
+        item_next[0].usageFlags = (XrSwapchainUsageFlags) 0xe7cdfc8ac4f8da63;
+        item_next[0].format = (int64_t) 0xb935c35b8cb17d9a;
+        item_next[0].sampleCount = (uint32_t) 0x2695595470f9a33b;
+        item_next[0].width = (uint32_t) 0xd19362cbed2fd7a4;
+        item_next[0].height = (uint32_t) 0x7e3307c3a85f1abc;
+        item_next[0].faceCount = (uint32_t) 0x4f9a98558b0e99d1;
+        item_next[0].arraySize = (uint32_t) 0x1b6fc0e475115b08;
+        item_next[0].mipCount = (uint32_t) 0xcf9bdf01f2f43e6d;
+        item.next = item_next;
+        item.countActionSets = (uint32_t) 0xc2ec0c71ed70cdfa;
+        item.actionSets = nullptr;
+        check_same_bytes(item, fields_XrSessionActionSetsAttachInfo, false);
+        check_same_bytes(item, fields_XrSessionActionSetsAttachInfo, true);
+    }
+    SECTION("XrSessionBeginInfo") {
+        XrSessionBeginInfo item{};
+        item.type = XR_TYPE_SESSION_BEGIN_INFO;
+        XrActionStateVector2f item_next[1]{};
+        item_next[0].type = XR_TYPE_ACTION_STATE_VECTOR2F;
+        XrHapticActionInfo item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_HAPTIC_ACTION_INFO;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].action = (XrAction) 0xe22fdc7d68cf6971;
+        item_next_0_next[0].subactionPath = (XrPath) 0x5626ad088b618bd9;
+        item_next[0].next = item_next_0_next;
+        item_next[0].currentState.x = (float) 0xfb95c915defd5ae;
+        item_next[0].currentState.y = (float) 0x9329b79611beea0e;
+        item_next[0].changedSinceLastSync = (XrBool32) 0x2e5073b471f3d906;
+        item_next[0].lastChangeTime = (XrTime) 0xf9aa2bf0d69be269;
+        item_next[0].isActive = (XrBool32) 0xd939a770e1de4658;
+        item.next = item_next;
+        item.primaryViewConfigurationType = (XrViewConfigurationType) 0x8eee022c3ffe1512;
+        check_same_bytes(item, fields_XrSessionBeginInfo, false);
+        check_same_bytes(item, fields_XrSessionBeginInfo, true);
+    }
+    SECTION("XrSessionCreateInfo") {
+        XrSessionCreateInfo item{};
+        item.type = XR_TYPE_SESSION_CREATE_INFO;
+        item.next = nullptr;
+        item.createFlags = (XrSessionCreateFlags) 0x2461b4a0bcb4cc03;
+        item.systemId = (XrSystemId) 0x395fc6d34d7f0fd4;
+        check_same_bytes(item, fields_XrSessionCreateInfo, false);
+        check_same_bytes(item, fields_XrSessionCreateInfo, true);
+    }
+    SECTION("XrSpaceLocation") {
+        XrSpaceLocation item{};
+        item.type = XR_TYPE_SPACE_LOCATION;
+        XrActionStatePose item_next[1]{};
+        item_next[0].type = XR_TYPE_ACTION_STATE_POSE;
+        XrInteractionProfileSuggestedBinding item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING;
+        item_next_0_next[0].next = nullptr;
+        item_next_0_next[0].interactionProfile = (XrPath) 0xffc031794c726f2;
+        item_next_0_next[0].countSuggestedBindings = (uint32_t) 0xbeef2350ab3d287e;
+        item_next_0_next[0].suggestedBindings = nullptr;
+        item_next[0].next = item_next_0_next;
+        item_next[0].isActive = (XrBool32) 0xcfbb3e776f18ac28;
+        item.next = item_next;
+        item.locationFlags = (XrSpaceLocationFlags) 0x959c4e08fa9daeee;
+        item.pose.orientation.x = (float) 0xbb877db770c0e4ea;
+        item.pose.orientation.y = (float) 0xfd97ed5afbb4db72;
+        item.pose.orientation.z = (float) 0xc61fdead6598b8f;
+        item.pose.orientation.w = (float) 0x11269a5821164ea6;
+        item.pose.position.x = (float) 0xcd67a5cd5fa20981;
+        item.pose.position.y = (float) 0x264c4e5058b54421;
+        item.pose.position.z = (float) 0xa0c5fa9cf651a9fb;
+        check_same_bytes(item, fields_XrSpaceLocation, false);
+        check_same_bytes(item, fields_XrSpaceLocation, true);
+    }
+    SECTION("XrSpaceLocationData") {
+        XrSpaceLocationData item{};
+        item.locationFlags = (XrSpaceLocationFlags) 0xcea0727155debf8;
+        item.pose.orientation.x = (float) 0x43cefa89c4b89d77;
+        item.pose.orientation.y = (float) 0x25ea7a7a400e3aa8;
+        item.pose.orientation.z = (float) 0xb1aad2525423f7e3;
+        item.pose.orientation.w = (float) 0x4b2ce8e2d25ea25b;
+        item.pose.position.x = (float) 0x7950c1e4f68ac19f;
+        item.pose.position.y = (float) 0xb89cb0a75bdf6a94;
+        item.pose.position.z = (float) 0xc2327b9f10ac709d;
+        check_same_bytes(item, fields_XrSpaceLocationData, false);
+        check_same_bytes(item, fields_XrSpaceLocationData, true);
+    }
+    SECTION("XrSpaceLocations") {
+        XrSpaceLocations item{};
+        item.type = XR_TYPE_SPACE_LOCATIONS;
+        XrReferenceSpaceCreateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_REFERENCE_SPACE_CREATE_INFO;
+        XrHapticVibration item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_HAPTIC_VIBRATION;
+        XrSwapchainImageWaitInfo item_next_0_next_0_next[1]{};
+        item_next_0_next_0_next[0].type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+        XrSystemGetInfo item_next_0_next_0_next_0_next[1]{};
+        item_next_0_next_0_next_0_next[0].type = XR_TYPE_SYSTEM_GET_INFO;
+        XrInteractionProfileState item_next_0_next_0_next_0_next_0_next[1]{};
+        item_next_0_next_0_next_0_next_0_next[0].type = XR_TYPE_INTERACTION_PROFILE_STATE;
+        item_next_0_next_0_next_0_next_0_next[0].next = nullptr;
+        item_next_0_next_0_next_0_next_0_next[0].interactionProfile = (XrPath) 0xbd016ba82f719f0c;
+        item_next_0_next_0_next_0_next[0].next = item_next_0_next_0_next_0_next_0_next;
+        item_next_0_next_0_next_0_next[0].formFactor = (XrFormFactor) 0x97499175d8fb96d4;
+        item_next_0_next_0_next[0].next = item_next_0_next_0_next_0_next;
+        item_next_0_next_0_next[0].timeout = (XrDuration) 0xfca4692a097ee1d7;
+        item_next_0_next[0].next = item_next_0_next_0_next;
+        item_next_0_next[0].duration = (XrDuration) 0xb31e86cccc6daa75;
+        item_next_0_next[0].frequency = (float) 0x76d003bf2c265ec1;
+        item_next_0_next[0].amplitude = (float) 0x709c78d744651f57;
+        item_next[0].next = item_next_0_next;
+        item_next[0].referenceSpaceType = (XrReferenceSpaceType) 0xf4dbe54dd313bb4e;
+        item_next[0].poseInReferenceSpace.orientation.x = (float) 0xfffb015b15ed317f;
+        item_next[0].poseInReferenceSpace.orientation.y = (float) 0x1db26935f1ed9c52;
+        item_next[0].poseInReferenceSpace.orientation.z = (float) 0xcbe39dd7401e06a2;
+        item_next[0].poseInReferenceSpace.orientation.w = (float) 0x25463ab11b3b4dad;
+        item_next[0].poseInReferenceSpace.position.x = (float) 0x153489150d2e1ee0;
+        item_next[0].poseInReferenceSpace.position.y = (float) 0x5ac2cd115b7fad4b;
+        item_next[0].poseInReferenceSpace.position.z = (float) 0x378ed1f42ea99bcf;
+        item.next = item_next;
+        item.locationCount = (uint32_t) 0x71895996e1cd443c;
+        item.locations = nullptr;
+        check_same_bytes(item, fields_XrSpaceLocations, false);
+        check_same_bytes(item, fields_XrSpaceLocations, true);
+    }
+    SECTION("XrSpaceVelocities") {
+        XrSpaceVelocities item{};
+        item.type = XR_TYPE_SPACE_VELOCITIES;
+        item.next = nullptr;
+        item.velocityCount = (uint32_t) 0xe5a3665159c1a94a;
+        item.velocities = nullptr;
+        check_same_bytes(item, fields_XrSpaceVelocities, false);
+        check_same_bytes(item, fields_XrSpaceVelocities, true);
+    }
+    SECTION("XrSpaceVelocity") {
+        XrSpaceVelocity item{};
+        item.type = XR_TYPE_SPACE_VELOCITY;
+        item.next = nullptr;
+        item.velocityFlags = (XrSpaceVelocityFlags) 0x4cd4d1a8d50f2eb;
+        item.linearVelocity.x = (float) 0xdeb71787bf7c0e42;
+        item.linearVelocity.y = (float) 0xac7bb0da39f9a8c0;
+        item.linearVelocity.z = (float) 0xb289dec7c67211d1;
+        item.angularVelocity.x = (float) 0x8973264bb4e2fc0f;
+        item.angularVelocity.y = (float) 0x2ce303548e21ca91;
+        item.angularVelocity.z = (float) 0xe4c149b85e815c7d;
+        check_same_bytes(item, fields_XrSpaceVelocity, false);
+        check_same_bytes(item, fields_XrSpaceVelocity, true);
+    }
+    SECTION("XrSpaceVelocityData") {
+        XrSpaceVelocityData item{};
+        item.velocityFlags = (XrSpaceVelocityFlags) 0xa5bf00840b8e66eb;
+        item.linearVelocity.x = (float) 0xee083ac221ce8d37;
+        item.linearVelocity.y = (float) 0x267f39ee764b011c;
+        item.linearVelocity.z = (float) 0xdc72dff9cf521ce0;
+        item.angularVelocity.x = (float) 0x29958bffb363beeb;
+        item.angularVelocity.y = (float) 0xfb723910db1ba100;
+        item.angularVelocity.z = (float) 0xbf565befb88debc2;
+        check_same_bytes(item, fields_XrSpaceVelocityData, false);
+        check_same_bytes(item, fields_XrSpaceVelocityData, true);
+    }
+    SECTION("XrSpacesLocateInfo") {
+        XrSpacesLocateInfo item{};
+        item.type = XR_TYPE_SPACES_LOCATE_INFO;
+        XrSwapchainImageWaitInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+        XrApiLayerProperties item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_API_LAYER_PROPERTIES;
+        item_next_0_next[0].next = nullptr;
+        for (int i = 0; i < XR_MAX_API_LAYER_NAME_SIZE; i++) {
+            item_next_0_next[0].layerName[i] = '4';
+        }
+        item_next_0_next[0].specVersion = (XrVersion) 0x5984c1b54a3cc65c;
+        item_next_0_next[0].layerVersion = (uint32_t) 0x6f73499f91433434;
+        for (int i = 0; i < XR_MAX_API_LAYER_DESCRIPTION_SIZE; i++) {
+            item_next_0_next[0].description[i] = '2';
+        }
+        item_next[0].next = item_next_0_next;
+        item_next[0].timeout = (XrDuration) 0x481d508cc7cd48d;
+        item.next = item_next;
+        item.baseSpace = (XrSpace) 0xfaabb0463ef21691;
+        item.time = (XrTime) 0x7176363eda7c85a3;
+        item.spaceCount = (uint32_t) 0x480d5f8b201e30b6;
+        item.spaces = nullptr;
+        check_same_bytes(item, fields_XrSpacesLocateInfo, false);
+        check_same_bytes(item, fields_XrSpacesLocateInfo, true);
+    }
+    SECTION("XrSpheref") {
+        XrSpheref item{};
+        item.center.orientation.x = (float) 0x7afc6400684a1d73;
+        item.center.orientation.y = (float) 0xf5a32d25dd679e92;
+        item.center.orientation.z = (float) 0x4b0365c3c7c7e67e;
+        item.center.orientation.w = (float) 0xebddb82c0528562d;
+        item.center.position.x = (float) 0x2a1d40bb44bab938;
+        item.center.position.y = (float) 0xbe83d373a40c9dda;
+        item.center.position.z = (float) 0xd6f9893afb6fbd2;
+        item.radius = (float) 0xf339a97fefff496;
+        check_same_bytes(item, fields_XrSpheref, false);
+        check_same_bytes(item, fields_XrSpheref, true);
+    }
+    SECTION("XrSwapchainCreateInfo") {
+        XrSwapchainCreateInfo item{};
+        item.type = XR_TYPE_SWAPCHAIN_CREATE_INFO;
+        item.next = nullptr;
+        item.createFlags = (XrSwapchainCreateFlags) 0x5d92a1a914b138ab;
+        item.usageFlags = (XrSwapchainUsageFlags) 0x290c2d1b9e6a6ffa;
+        item.format = (int64_t) 0x7ae022d93f6d6f43;
+        item.sampleCount = (uint32_t) 0x3329177b4bdc49ad;
+        item.width = (uint32_t) 0x793f9eeabf9c4b56;
+        item.height = (uint32_t) 0xd675bf4f54d0c8bc;
+        item.faceCount = (uint32_t) 0x6fc86d232c5ffb42;
+        item.arraySize = (uint32_t) 0xfa0a022dd28396b0;
+        item.mipCount = (uint32_t) 0x60a51da5dce6792b;
+        check_same_bytes(item, fields_XrSwapchainCreateInfo, false);
+        check_same_bytes(item, fields_XrSwapchainCreateInfo, true);
+    }
+    SECTION("XrSwapchainImageAcquireInfo") {
+        XrSwapchainImageAcquireInfo item{};
+        item.type = XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO;
+        item.next = nullptr;
+        check_same_bytes(item, fields_XrSwapchainImageAcquireInfo, false);
+        check_same_bytes(item, fields_XrSwapchainImageAcquireInfo, true);
+    }
+    SECTION("XrSwapchainImageReleaseInfo") {
+        XrSwapchainImageReleaseInfo item{};
+        item.type = XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO;
+        item.next = nullptr;
+        check_same_bytes(item, fields_XrSwapchainImageReleaseInfo, false);
+        check_same_bytes(item, fields_XrSwapchainImageReleaseInfo, true);
+    }
+    SECTION("XrSwapchainImageWaitInfo") {
+        XrSwapchainImageWaitInfo item{};
+        item.type = XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO;
+        XrSessionCreateInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_SESSION_CREATE_INFO;
+        XrExtensionProperties item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_EXTENSION_PROPERTIES;
+        item_next_0_next[0].next = nullptr;
+        for (int i = 0; i < XR_MAX_EXTENSION_NAME_SIZE; i++) {
+            item_next_0_next[0].extensionName[i] = '9';
+        }
+        item_next_0_next[0].extensionVersion = (uint32_t) 0x197f6f28841c29a7;
+        item_next[0].next = item_next_0_next;
+        item_next[0].createFlags = (XrSessionCreateFlags) 0x64a6c8e42a620290;
+        item_next[0].systemId = (XrSystemId) 0xbb6f08032a81a871;
+        item.next = item_next;
+        item.timeout = (XrDuration) 0xf35e6503c7793586;
+        check_same_bytes(item, fields_XrSwapchainImageWaitInfo, false);
+        check_same_bytes(item, fields_XrSwapchainImageWaitInfo, true);
+    }
+    SECTION("XrSwapchainSubImage") {
+        XrSwapchainSubImage item{};
+        item.swapchain = (XrSwapchain) 0xb6f3973607e4dd19;
+        item.imageRect.offset.x = (int32_t) 0x60c99dcb5ba30ee;
+        item.imageRect.offset.y = (int32_t) 0xd6bd5b3ab8692afc;
+        item.imageRect.extent.width = (int32_t) 0x7a7f32d1c772a919;
+        item.imageRect.extent.height = (int32_t) 0xbe1daee0f5d7ecb6;
+        item.imageArrayIndex = (uint32_t) 0xf7024d8db0724639;
+        check_same_bytes(item, fields_XrSwapchainSubImage, false);
+        check_same_bytes(item, fields_XrSwapchainSubImage, true);
+    }
+    SECTION("XrSystemGetInfo") {
+        XrSystemGetInfo item{};
+        item.type = XR_TYPE_SYSTEM_GET_INFO;
+        XrFrameState item_next[1]{};
+        item_next[0].type = XR_TYPE_FRAME_STATE;
+        XrInstanceProperties item_next_0_next[1]{};
+        item_next_0_next[0].type = XR_TYPE_INSTANCE_PROPERTIES;
+        XrViewConfigurationView item_next_0_next_0_next[1]{};
+        item_next_0_next_0_next[0].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+        item_next_0_next_0_next[0].next = nullptr;
+        item_next_0_next_0_next[0].recommendedImageRectWidth = (uint32_t) 0x5b44e1f07e498314;
+        item_next_0_next_0_next[0].maxImageRectWidth = (uint32_t) 0xeaf57f4deeddda57;
+        item_next_0_next_0_next[0].recommendedImageRectHeight = (uint32_t) 0xc451b685e862abc2;
+        item_next_0_next_0_next[0].maxImageRectHeight = (uint32_t) 0x6009fdffe359ddd3;
+        item_next_0_next_0_next[0].recommendedSwapchainSampleCount = (uint32_t) 0x7a7167ecd021a3ec;
+        item_next_0_next_0_next[0].maxSwapchainSampleCount = (uint32_t) 0x2d27a42c1494493e;
+        item_next_0_next[0].next = item_next_0_next_0_next;
+        item_next_0_next[0].runtimeVersion = (XrVersion) 0x79a5ccfff02bcaa6;
+        for (int i = 0; i < XR_MAX_RUNTIME_NAME_SIZE; i++) {
+            item_next_0_next[0].runtimeName[i] = '7';
+        }
+        item_next[0].next = item_next_0_next;
+        item_next[0].predictedDisplayTime = (XrTime) 0x3e106ef9fa8dfdbe;
+        item_next[0].predictedDisplayPeriod = (XrDuration) 0xf02bdbdbf868dc2f;
+        item_next[0].shouldRender = (XrBool32) 0xa15a4ed6e472c4b9;
+        item.next = item_next;
+        item.formFactor = (XrFormFactor) 0x578e6994a320382d;
+        check_same_bytes(item, fields_XrSystemGetInfo, false);
+        check_same_bytes(item, fields_XrSystemGetInfo, true);
+    }
+    SECTION("XrSystemGraphicsProperties") {
+        XrSystemGraphicsProperties item{};
+        item.maxSwapchainImageHeight = (uint32_t) 0x240b6ae7f3a0f143;
+        item.maxSwapchainImageWidth = (uint32_t) 0x8858c7e65e0d33bb;
+        item.maxLayerCount = (uint32_t) 0x48ec589363b0ab86;
+        check_same_bytes(item, fields_XrSystemGraphicsProperties, false);
+        check_same_bytes(item, fields_XrSystemGraphicsProperties, true);
+    }
+    SECTION("XrSystemProperties") {
+        XrSystemProperties item{};
+        item.type = XR_TYPE_SYSTEM_PROPERTIES;
+        item.next = nullptr;
+        item.systemId = (XrSystemId) 0x9fc93f140937f2eb;
+        item.vendorId = (uint32_t) 0xd93bb9b0ccc82894;
+        for (int i = 0; i < XR_MAX_SYSTEM_NAME_SIZE; i++) {
+            item.systemName[i] = 'D';
+        }
+        item.graphicsProperties.maxSwapchainImageHeight = (uint32_t) 0x98ebabbe5b57415c;
+        item.graphicsProperties.maxSwapchainImageWidth = (uint32_t) 0x4623e8a90123aba0;
+        item.graphicsProperties.maxLayerCount = (uint32_t) 0xc5925fe13f44a8ca;
+        item.trackingProperties.orientationTracking = (XrBool32) 0x80f85b81f150c4a5;
+        item.trackingProperties.positionTracking = (XrBool32) 0x5257efe07cf36239;
+        check_same_bytes(item, fields_XrSystemProperties, false);
+        check_same_bytes(item, fields_XrSystemProperties, true);
+    }
+    SECTION("XrSystemTrackingProperties") {
+        XrSystemTrackingProperties item{};
+        item.orientationTracking = (XrBool32) 0x7a796e0c6630092f;
+        item.positionTracking = (XrBool32) 0xc5b2fc8052a4e56c;
+        check_same_bytes(item, fields_XrSystemTrackingProperties, false);
+        check_same_bytes(item, fields_XrSystemTrackingProperties, true);
+    }
+    SECTION("XrUuid") {
+        XrUuid item{};
+        for (int i = 0; i < XR_UUID_SIZE; i++) {
+            item.data[i] = (uint8_t) 0xfd717d77915b0e67;
+        }
+        check_same_bytes(item, fields_XrUuid, false);
+        check_same_bytes(item, fields_XrUuid, true);
+    }
+    SECTION("XrVector2f") {
+        XrVector2f item{};
+        item.x = (float) 0x3720f7475dd22a86;
+        item.y = (float) 0x9ddc4f2c48f9010a;
+        check_same_bytes(item, fields_XrVector2f, false);
+        check_same_bytes(item, fields_XrVector2f, true);
+    }
+    SECTION("XrVector3f") {
+        XrVector3f item{};
+        item.x = (float) 0x41bbf7fe55611187;
+        item.y = (float) 0xce787bf65aa70a5e;
+        item.z = (float) 0x61ef28358e606d4b;
+        check_same_bytes(item, fields_XrVector3f, false);
+        check_same_bytes(item, fields_XrVector3f, true);
+    }
+    SECTION("XrVector4f") {
+        XrVector4f item{};
+        item.x = (float) 0xc4c63bbd2418249;
+        item.y = (float) 0xba9548b88cd5f401;
+        item.z = (float) 0x75847d5f226da9a0;
+        item.w = (float) 0x9568335a673a2c54;
+        check_same_bytes(item, fields_XrVector4f, false);
+        check_same_bytes(item, fields_XrVector4f, true);
+    }
+    SECTION("XrView") {
+        XrView item{};
+        item.type = XR_TYPE_VIEW;
+        item.next = nullptr;
+        item.pose.orientation.x = (float) 0x6aacc32b3d4b4107;
+        item.pose.orientation.y = (float) 0xd1cf923a1002e7a4;
+        item.pose.orientation.z = (float) 0xc8b81825f9f682b0;
+        item.pose.orientation.w = (float) 0x9bdb4a9e46834285;
+        item.pose.position.x = (float) 0xf59da37b500e2a1d;
+        item.pose.position.y = (float) 0x25499687da0a3be0;
+        item.pose.position.z = (float) 0x4c22e98c22e893ac;
+        item.fov.angleLeft = (float) 0x6c54404d2d0ff7bd;
+        item.fov.angleRight = (float) 0xf7dc61fa1918bb93;
+        item.fov.angleUp = (float) 0x2d03f44e7b5562f8;
+        item.fov.angleDown = (float) 0x90ed3bbef7598b86;
+        check_same_bytes(item, fields_XrView, false);
+        check_same_bytes(item, fields_XrView, true);
+    }
+    SECTION("XrViewConfigurationProperties") {
+        XrViewConfigurationProperties item{};
+        item.type = XR_TYPE_VIEW_CONFIGURATION_PROPERTIES;
+        item.next = nullptr;
+        item.viewConfigurationType = (XrViewConfigurationType) 0xa921d00d8739be06;
+        item.fovMutable = (XrBool32) 0xe026dc5a78befd34;
+        check_same_bytes(item, fields_XrViewConfigurationProperties, false);
+        check_same_bytes(item, fields_XrViewConfigurationProperties, true);
+    }
+    SECTION("XrViewConfigurationView") {
+        XrViewConfigurationView item{};
+        item.type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
+        item.next = nullptr;
+        item.recommendedImageRectWidth = (uint32_t) 0xa3e00d9d75278e2e;
+        item.maxImageRectWidth = (uint32_t) 0xcb70a05fd3a5551e;
+        item.recommendedImageRectHeight = (uint32_t) 0x7d71e626c4742a37;
+        item.maxImageRectHeight = (uint32_t) 0x9787211f7582a812;
+        item.recommendedSwapchainSampleCount = (uint32_t) 0xbce686f53dc831bf;
+        item.maxSwapchainSampleCount = (uint32_t) 0x6b7989a96c774433;
+        check_same_bytes(item, fields_XrViewConfigurationView, false);
+        check_same_bytes(item, fields_XrViewConfigurationView, true);
+    }
+    SECTION("XrViewLocateInfo") {
+        XrViewLocateInfo item{};
+        item.type = XR_TYPE_VIEW_LOCATE_INFO;
+        XrActionStateGetInfo item_next[1]{};
+        item_next[0].type = XR_TYPE_ACTION_STATE_GET_INFO;
+        item_next[0].next = nullptr;
+        item_next[0].action = (XrAction) 0x24cbd9ee81ad3cd;
+        item_next[0].subactionPath = (XrPath) 0xdb30a20d05346ab0;
+        item.next = item_next;
+        item.viewConfigurationType = (XrViewConfigurationType) 0xb7ccf5a36cefd097;
+        item.displayTime = (XrTime) 0xe461082ef507066c;
+        item.space = (XrSpace) 0xef307947c4b654ce;
+        check_same_bytes(item, fields_XrViewLocateInfo, false);
+        check_same_bytes(item, fields_XrViewLocateInfo, true);
+    }
+    SECTION("XrViewState") {
+        XrViewState item{};
+        item.type = XR_TYPE_VIEW_STATE;
+        item.next = nullptr;
+        item.viewStateFlags = (XrViewStateFlags) 0x275d7db98a1bd243;
+        check_same_bytes(item, fields_XrViewState, false);
+        check_same_bytes(item, fields_XrViewState, true);
+    }
+}
+
+#endif // XRTRANSPORT_TABLE_DRIVEN_SERIALIZATION
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/table_serialization.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/string_interning.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Tables as struct_tables.cpp has them, so that they can be compared to the struct serializers in
+// either mode
+constexpr FieldDescriptor action_create_info_fields[] = {
+    FIELD_VALUE(XrActionCreateInfo, type),
+    FIELD_XR(XrActionCreateInfo, next),
+    FIELD_STRING_ARRAY(XrActionCreateInfo, actionName),
+    FIELD_VALUE(XrActionCreateInfo, actionType),
+    FIELD_VALUE(XrActionCreateInfo, countSubactionPaths),
+    FIELD_PTR(XrActionCreateInfo, subactionPaths, countSubactionPaths),
+    FIELD_STRING_ARRAY(XrActionCreateInfo, localizedActionName),
+};
+
+constexpr FieldDescriptor spaces_locate_info_fields[] = {
+    FIELD_VALUE(XrSpacesLocateInfo, type),
+    FIELD_XR(XrSpacesLocateInfo, next),
+    FIELD_VALUE(XrSpacesLocateInfo, baseSpace),
+    FIELD_TIME(XrSpacesLocateInfo, time),
+    FIELD_VALUE(XrSpacesLocateInfo, spaceCount),
+    FIELD_PTR(XrSpacesLocateInfo, spaces, spaceCount),
+};
+
+constexpr FieldDescriptor suggested_binding_fields[] = {
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, type),
+    FIELD_XR(XrInteractionProfileSuggestedBinding, next),
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, interactionProfile),
+    FIELD_VALUE(XrInteractionProfileSuggestedBinding, countSuggestedBindings),
+    FIELD_PTR(XrInteractionProfileSuggestedBinding, suggestedBindings, countSuggestedBindings),
+};
+
+constexpr FieldDescriptor space_location_fields[] = {
+    FIELD_VALUE(XrSpaceLocation, type),
+    FIELD_XR(XrSpaceLocation, next),
+    FIELD_VALUE(XrSpaceLocation, locationFlags),
+    FIELD_VALUE(XrSpaceLocation, pose),
+};
+
+// Handles are pointers on 64 bit platforms and integers on 32 bit platforms
+template <typename T>
+T make_handle(std::uint64_t value) {
+    T handle{};
+    std::memcpy(&handle, &value, sizeof(handle));
+    return handle;
+}
+
+enum class Encoding {
+    PLAIN,
+    COMPACT,
+    INTERNED,
+};
+
+// Serializes with a fresh context of the given encoding
+template <typename F>
+std::vector<std::uint8_t> serialize_with(Encoding encoding, F&& serialize_message) {
+    LendingByteQueue queue;
+    HandleInterner handles;
+    StringInterner strings;
+    SerializeContext ctx(queue);
+    ctx.time_offset = 1000;
+    if (encoding == Encoding::COMPACT) {
+        ctx.handles = begin_handles(&handles);
+    }
+    if (encoding == Encoding::INTERNED) {
+        ctx.strings = begin_strings(&strings);
+    }
+    serialize_message(ctx);
+    return queue.bytes;
+}
+
+template <typename T, std::size_t N>
+void check_same_bytes(const T& value, const FieldDescriptor (&fields)[N]) {
+    Encoding encodings[] = {Encoding::PLAIN, Encoding::INTERNED};
+    for (Encoding encoding : encodings) {
+        CHECK(serialize_with(encoding, [&](SerializeContext& ctx) { serialize_fields(&value, fields, ctx); }) ==
+            serialize_with(encoding, [&](SerializeContext& ctx) { serialize(&value, ctx); }));
+    }
+#if UINTPTR_MAX == UINT64_MAX
+    // compact encoding is only supported with 64-bit handles
+    CHECK(serialize_with(Encoding::COMPACT, [&](SerializeContext& ctx) { serialize_fields(&value, fields, ctx); }) ==
+        serialize_with(Encoding::COMPACT, [&](SerializeContext& ctx) { serialize(&value, ctx); }));
+#endif
+}
+
+} // namespace
+
+TEST_CASE("Tables produce the same bytes as the struct serializers", "[table_serialization]") {
+    XrPath paths[] = {11, 12, 13};
+    XrActionCreateInfo create_info{XR_TYPE_ACTION_CREATE_INFO};
+    std::strcpy(create_info.actionName, "grab");
+    create_info.actionType = XR_ACTION_TYPE_POSE_INPUT;
+    create_info.countSubactionPaths = 3;
+    create_info.subactionPaths = paths;
+    std::strcpy(create_info.localizedActionName, "Grab");
+    check_same_bytes(create_info, action_create_info_fields);
+
+    XrSpace spaces[] = {make_handle<XrSpace>(0x1000), make_handle<XrSpace>(0x2000), make_handle<XrSpace>(0x1000)};
+    XrSpacesLocateInfo locate_info{XR_TYPE_SPACES_LOCATE_INFO};
+    locate_info.baseSpace = make_handle<XrSpace>(0x3000);
+    locate_info.time = 5000;
+    locate_info.spaceCount = 3;
+    locate_info.spaces = spaces;
+    check_same_bytes(locate_info, spaces_locate_info_fields);
+
+    XrActionSuggestedBinding bindings[] = {
+        {make_handle<XrAction>(0x4000), 21},
+        {make_handle<XrAction>(0x5000), 22},
+    };
+    XrInteractionProfileSuggestedBinding suggested{XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING};
+    suggested.interactionProfile = 20;
+    suggested.countSuggestedBindings = 2;
+    suggested.suggestedBindings = bindings;
+    check_same_bytes(suggested, suggested_binding_fields);
+
+    // null arrays
+    suggested.suggestedBindings = nullptr;
+    check_same_bytes(suggested, suggested_binding_fields);
+}
+
+TEST_CASE("Tables round trip", "[table_serialization]") {
+    XrActionSuggestedBinding bindings[] = {
+        {make_handle<XrAction>(0x4000), 21},
+        {make_handle<XrAction>(0x5000), 22},
+    };
+    XrInteractionProfileSuggestedBinding suggested{XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING};
+    suggested.interactionProfile = 20;
+    suggested.countSuggestedBindings = 2;
+    suggested.suggestedBindings = bindings;
+
+    LendingByteQueue queue;
+    SerializeContext s_ctx(queue);
+    serialize_fields(&suggested, suggested_binding_fields, s_ctx);
+
+    DeserializeContext d_ctx(queue);
+    XrInteractionProfileSuggestedBinding result{};
+    deserialize_fields(&result, suggested_binding_fields, d_ctx);
+    CHECK(queue.read_pos == queue.bytes.size());
+    CHECK(result.type == XR_TYPE_INTERACTION_PROFILE_SUGGESTED_BINDING);
+    CHECK(result.next == nullptr);
+    CHECK(result.interactionProfile == 20);
+    REQUIRE(result.countSuggestedBindings == 2);
+    REQUIRE(result.suggestedBindings);
+    CHECK(result.suggestedBindings != bindings);
+    CHECK(result.suggestedBindings[1].action == bindings[1].action);
+    CHECK(result.suggestedBindings[1].binding == 22);
+    cleanup_fields(&result, suggested_binding_fields);
+}
+
+TEST_CASE("Time fields are converted between clocks", "[table_serialization]") {
+    XrSpacesLocateInfo locate_info{XR_TYPE_SPACES_LOCATE_INFO};
+    locate_info.time = 5000;
+
+    LendingByteQueue queue;
+    SerializeContext s_ctx(queue, XrTime{1000});
+    serialize_fields(&locate_info, spaces_locate_info_fields, s_ctx);
+
+    DeserializeContext d_ctx(queue, false, 300);
+    XrSpacesLocateInfo result{};
+    deserialize_fields(&result, spaces_locate_info_fields, d_ctx);
+    CHECK(result.time == 5000 - 1000 + 300);
+    CHECK(result.spaces == nullptr);
+    cleanup_fields(&result, spaces_locate_info_fields);
+}
+
+TEST_CASE("Tables borrow const flat arrays", "[table_serialization]") {
+    XrSpace spaces[] = {make_handle<XrSpace>(0x1000), make_handle<XrSpace>(0x2000)};
+    XrSpacesLocateInfo locate_info{XR_TYPE_SPACES_LOCATE_INFO};
+    locate_info.spaceCount = 2;
+    locate_info.spaces = spaces;
+
+    LendingByteQueue queue;
+    queue.bytes.reserve(256);
+    SerializeContext s_ctx(queue);
+    serialize_fields(&locate_info, spaces_locate_info_fields, s_ctx);
+
+    BorrowScope borrow_scope;
+    DeserializeContext d_ctx(queue);
+    XrSpacesLocateInfo result{};
+    deserialize_fields(&result, spaces_locate_info_fields, d_ctx);
+    REQUIRE(result.spaces);
+    // the array follows 4 + 4 + 8 + 8 + 4 + 4 bytes, so it is aligned
+    CHECK(queue.contains(result.spaces));
+    CHECK(result.spaces[1] == spaces[1]);
+    // must not be freed
+    cleanup_fields(&result, spaces_locate_info_fields);
+}
+
+TEST_CASE("Tables deserialize in place", "[table_serialization]") {
+    XrSpaceLocation location{XR_TYPE_SPACE_LOCATION};
+    location.locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    location.pose.orientation.w = 1.0f;
+    location.pose.position.z = -2.0f;
+
+    LendingByteQueue queue;
+    SerializeContext s_ctx(queue);
+    serialize_fields(&location, space_location_fields, s_ctx);
+    CHECK(queue.bytes.size() ==
+        sizeof(XrStructureType) * 2 + sizeof(XrSpaceLocationFlags) + sizeof(XrPosef));
+
+    DeserializeContext d_ctx(queue, true, 0);
+    XrSpaceLocation result{XR_TYPE_SPACE_LOCATION};
+    deserialize_fields(&result, space_location_fields, d_ctx);
+    CHECK(result.locationFlags == XR_SPACE_LOCATION_POSITION_VALID_BIT);
+    CHECK(result.pose.orientation.w == 1.0f);
+    CHECK(result.pose.position.z == -2.0f);
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "xrtransport/serialization/virtual_handles.h"
+#include "xrtransport/serialization/compact_encoding.h"
+#include "xrtransport/serialization/serializer.h"
+#include "xrtransport/serialization/deserializer.h"
+#include "xrtransport/serialization/error.h"
+#include "xrtransport/asio_compat.h"
+
+#include "byte_queue.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+// Requests of a connection with pipelined creation: the client sends virtual handles, and the server
+// resolves them as they are added to its handle table
+struct Channel {
+    ByteQueue queue;
+    VirtualHandleAllocator allocator;
+    VirtualHandleMap map;
+    HandleInterner interner;
+    HandleTable table;
+
+    Channel() {
+        table.set_virtual_handles(&map);
+    }
+
+    void send(XrSpace space) {
+        SerializeContext s_ctx(queue);
+        s_ctx.handles = begin_handles(&interner);
+        serialize(&space, s_ctx);
+        commit_handles(s_ctx);
+    }
+
+    XrSpace receive() {
+        DeserializeContext d_ctx(queue);
+        d_ctx.handles = &table;
+        XrSpace space{};
+        deserialize(&space, d_ctx);
+        return space;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Virtual handles are allocated in order", "[virtual_handles]") {
+    VirtualHandleAllocator allocator;
+    std::uint64_t first = allocator.allocate();
+    std::uint64_t second = allocator.allocate();
+    CHECK(is_virtual_handle(first));
+    CHECK(is_virtual_handle(second));
+    CHECK(first != 0);
+    CHECK(second == first + 1);
+    CHECK(allocator.size() == 2);
+    CHECK(!is_virtual_handle(0x7f0000001000));
+}
+
+TEST_CASE("Virtual handles resolve to the handle bound at their index", "[virtual_handles]") {
+    VirtualHandleAllocator allocator;
+    VirtualHandleMap map;
+    std::uint64_t created = allocator.allocate();
+    std::uint64_t failed = allocator.allocate();
+    map.bind(0x7f0000001000);
+    map.bind(0); // the second call failed
+
+    CHECK(map.resolve(created) == 0x7f0000001000);
+    CHECK(map.resolve(failed) == 0);
+    // real handles are left alone
+    CHECK(map.resolve(std::uint64_t{0x7f0000002000}) == 0x7f0000002000);
+    CHECK(map.resolve(std::uint64_t{0}) == 0);
+
+    XrSpace space = handle_from_value<XrSpace>(created);
+    CHECK(handle_value(map.resolve(space)) == 0x7f0000001000);
+}
+
+TEST_CASE("Unbound virtual handles are rejected", "[virtual_handles]") {
+    VirtualHandleAllocator allocator;
+    VirtualHandleMap map;
+    std::uint64_t handle = allocator.allocate();
+    CHECK_THROWS_AS(map.resolve(handle), VirtualHandleException);
+}
+
+TEST_CASE("Virtual handles are resolved by the handle table", "[virtual_handles]") {
+    Channel channel;
+    XrSpace space = handle_from_value<XrSpace>(channel.allocator.allocate());
+    XrSpace real = handle_from_value<XrSpace>(0x7f0000001000);
+    channel.map.bind(handle_value(real));
+
+    // first as a new handle, then as an id into the table
+    channel.send(space);
+    channel.send(space);
+    CHECK(channel.receive() == real);
+    CHECK(channel.receive() == real);
+    CHECK(channel.table.size() == 1);
+
+    XrSpace other = handle_from_value<XrSpace>(0x7f0000002000);
+    channel.send(other);
+    CHECK(channel.receive() == other);
+}
+
+TEST_CASE("Virtual handles are resolved in requests without compact encoding", "[virtual_handles]") {
+    VirtualHandleAllocator allocator;
+    VirtualHandleMap map;
+    XrSpace space = handle_from_value<XrSpace>(allocator.allocate());
+    XrSpace real = handle_from_value<XrSpace>(0x7f0000001000);
+    map.bind(handle_value(real));
+
+    ByteQueue queue;
+    SerializeContext s_ctx(queue);
+    serialize(&space, s_ctx);
+
+    DeserializeContext d_ctx(queue);
+    d_ctx.virtual_handles = &map;
+    XrSpace received{};
+    deserialize(&received, d_ctx);
+    CHECK(received == real);
+}
@@ -0,0 +1,467 @@
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "frame_waiter.h"
+#include "function_dispatch.h"
+
+#include "xrtransport/transport/transport.h"
+#include "xrtransport/server/function_loader.h"
+#include "xrtransport/serialization/virtual_handles.h"
+#include "test_duplex_stream.h"
+
+#include "asio/io_context.hpp"
+#include "asio/read.hpp"
+#include "asio/write.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace xrtransport;
+using namespace xrtransport::test;
+
+namespace {
+
+constexpr XrTime DISPLAY_TIME = 2'000'000'000;
+constexpr XrDuration DISPLAY_PERIOD = 13'888'888;
+constexpr XrViewStateFlags VIEW_STATE = 0xF;
+
+const XrSession SESSION = handle_from_value<XrSession>(0x100);
+const XrSpace VIEW_SPACE = handle_from_value<XrSpace>(0x200);
+const XrSpace LEFT_HAND = handle_from_value<XrSpace>(0x300);
+const XrSpace RIGHT_HAND = handle_from_value<XrSpace>(0x301);
+const XrSpace STAGE = handle_from_value<XrSpace>(0x400);
+const XrSpace LOCAL = handle_from_value<XrSpace>(0x401);
+
+// function ids of the generated stubs
+constexpr std::uint32_t LOCATE_HAND_JOINTS = 52003;
+constexpr std::uint32_t UNKNOWN_FUNCTION = 0xFFFFFFFF;
+
+/**
+ * The runtime on the server's side, loaded through xrGetInstanceProcAddr. Only used by the thread of
+ * the FrameWaiter while a test waits for its frame state.
+ */
+struct FakeRuntime {
+    XrResult wait_result;
+    int wait_frame;
+    XrResult locate_views_result;
+    int locate_views;
+    XrTime views_time;
+    XrSpace views_space;
+    bool has_locate_spaces;
+    int locate_space;
+    std::vector<XrSpace> locate_spaces_bases;
+    XrTime spaces_time;
+
+    void reset() {
+        wait_result = XR_SUCCESS;
+        wait_frame = 0;
+        locate_views_result = XR_SUCCESS;
+        locate_views = 0;
+        views_time = 0;
+        views_space = XR_NULL_HANDLE;
+        has_locate_spaces = true;
+        locate_space = 0;
+        locate_spaces_bases.clear();
+        spaces_time = 0;
+    }
+};
+
+FakeRuntime runtime;
+
+XrResult XRAPI_CALL fake_wait_frame(XrSession, const XrFrameWaitInfo*, XrFrameState* frame_state) {
+    runtime.wait_frame++;
+    frame_state->predictedDisplayTime = DISPLAY_TIME + runtime.wait_frame * DISPLAY_PERIOD;
+    frame_state->predictedDisplayPeriod = DISPLAY_PERIOD;
+    frame_state->shouldRender = XR_TRUE;
+    return runtime.wait_result;
+}
+
+XrResult XRAPI_CALL fake_locate_views(XrSession, const XrViewLocateInfo* view_locate_info, XrViewState* view_state,
+    uint32_t view_capacity_input, uint32_t* view_count_output, XrView* views)
+{
+    runtime.locate_views++;
+    runtime.views_time = view_locate_info->displayTime;
+    runtime.views_space = view_locate_info->space;
+    *view_count_output = 2;
+    view_state->viewStateFlags = VIEW_STATE;
+    for (uint32_t i = 0; i < view_capacity_input && i < 2; i++) {
+        views[i].pose = {{0, 0, 0, 1}, {static_cast<float>(i), 0, 0}};
+        views[i].fov = {-1, 1, 1, -1};
+    }
+    return runtime.locate_views_result;
+}
+
+// The position tells which pair was located
+XrPosef located_pose(XrSpace space, XrSpace base_space) {
+    return {{0, 0, 0, 1}, {static_cast<float>(handle_value(space)), 0, static_cast<float>(handle_value(base_space))}};
+}
+
+XrResult XRAPI_CALL fake_locate_space(XrSpace space, XrSpace base_space, XrTime time, XrSpaceLocation* location) {
+    runtime.locate_space++;
+    runtime.spaces_time = time;
+    location->locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+    location->pose = located_pose(space, base_space);
+    return XR_SUCCESS;
+}
+
+XrResult XRAPI_CALL fake_locate_spaces(XrSession, const XrSpacesLocateInfo* locate_info, XrSpaceLocations* space_locations) {
+    runtime.locate_spaces_bases.push_back(locate_info->baseSpace);
+    runtime.spaces_time = locate_info->time;
+    for (uint32_t i = 0; i < locate_info->spaceCount && i < space_locations->locationCount; i++) {
+        space_locations->locations[i].locationFlags = XR_SPACE_LOCATION_POSITION_VALID_BIT;
+        space_locations->locations[i].pose = located_pose(locate_info->spaces[i], locate_info->baseSpace);
+    }
+    return XR_SUCCESS;
+}
+
+XrResult XRAPI_CALL fake_get_instance_proc_addr(XrInstance, const char* name, PFN_xrVoidFunction* function) {
+    if (std::strcmp(name, "xrWaitFrame") == 0) {
+        *function = reinterpret_cast<PFN_xrVoidFunction>(fake_wait_frame);
+    }
+    else if (std::strcmp(name, "xrLocateViews") == 0) {
+        *function = reinterpret_cast<PFN_xrVoidFunction>(fake_locate_views);
+    }
+    else if (std::strcmp(name, "xrLocateSpace") == 0) {
+        *function = reinterpret_cast<PFN_xrVoidFunction>(fake_locate_space);
+    }
+    else if (std::strcmp(name, "xrLocateSpaces") == 0 && runtime.has_locate_spaces) {
+        *function = reinterpret_cast<PFN_xrVoidFunction>(fake_locate_spaces);
+    }
+    else {
+        *function = nullptr;
+        return XR_ERROR_FUNCTION_UNSUPPORTED;
+    }
+    return XR_SUCCESS;
+}
+
+struct ReceivedLocation {
+    XrResult result;
+    XrSpaceLocationFlags location_flags;
+    XrPosef pose;
+};
+
+/**
+ * What the server sent in an XRTP_MSG_FRAME_STATE.
+ */
+struct ReceivedFrameState {
+    std::uint64_t session;
+    XrResult result;
+    XrTime predicted_display_time;
+    XrDuration predicted_display_period;
+    XrBool32 should_render;
+    bool has_views = false;
+    XrViewStateFlags view_state_flags = 0;
+    std::vector<std::pair<XrPosef, XrFovf>> views;
+    std::vector<ReceivedLocation> locations;
+    std::vector<std::vector<std::uint8_t>> samples;
+};
+
+/**
+ * A FrameWaiter on the server end of a loopback connection, with the test as the client.
+ */
+struct FrameWaiterFixture {
+    bool view_prefetch;
+    bool space_prefetch;
+    bool tracker_sampling;
+
+    asio::io_context io_context;
+    std::pair<std::unique_ptr<SyncDuplexStream>, std::unique_ptr<SyncDuplexStream>> streams;
+    Transport client;
+    Transport server;
+    FunctionLoader function_loader;
+    FunctionDispatch function_dispatch;
+    FrameWaiter frame_waiter;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<ReceivedFrameState> frame_states;
+
+    explicit FrameWaiterFixture(bool view_prefetch, bool space_prefetch = false, bool tracker_sampling = false)
+        : view_prefetch(view_prefetch), space_prefetch(space_prefetch), tracker_sampling(tracker_sampling),
+            streams(create_connected_streams(io_context)),
+            client(std::move(streams.first)), server(std::move(streams.second)),
+            function_loader(fake_get_instance_proc_addr),
+            function_dispatch(server, function_loader, [](MessageLockIn){}, [](MessageLockIn){}),
+            frame_waiter(server, function_loader, view_prefetch, space_prefetch, nullptr,
+                tracker_sampling ? &function_dispatch : nullptr)
+    {
+        runtime.reset();
+
+        server.register_handler(XRTP_MSG_SPECULATIVE_WAIT_FRAME, [this](MessageLockIn msg_in) {
+            frame_waiter.handle_message(std::move(msg_in));
+        });
+        client.register_handler(XRTP_MSG_FRAME_STATE, [this](MessageLockIn msg_in) {
+            ReceivedFrameState frame_state = read_frame_state(msg_in);
+            std::lock_guard<std::mutex> lock(mutex);
+            frame_states.push_back(std::move(frame_state));
+            condition.notify_all();
+        });
+        client.start();
+        server.start();
+    }
+
+    ~FrameWaiterFixture() {
+        frame_waiter.stop();
+        client.shutdown();
+        client.join();
+        server.join();
+    }
+
+    /**
+     * @param view_space The space to locate the views in, XR_NULL_HANDLE for none
+     * @param spaces The pairs of space and base space to locate
+     * @param calls The function ids and params of the calls to sample
+     */
+    void send_wait(XrSpace view_space = XR_NULL_HANDLE, const std::vector<std::pair<XrSpace, XrSpace>>& spaces = {},
+        const std::vector<std::pair<std::uint32_t, std::vector<std::uint8_t>>>& calls = {})
+    {
+        auto msg_out = client.start_message(XRTP_MSG_SPECULATIVE_WAIT_FRAME);
+        std::uint64_t session = handle_value(SESSION);
+        asio::write(msg_out.buffer, asio::buffer(&session, sizeof(std::uint64_t)));
+        if (view_prefetch) {
+            XrViewConfigurationType view_configuration_type = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+            std::uint64_t space = handle_value(view_space);
+            asio::write(msg_out.buffer, asio::buffer(&view_configuration_type, sizeof(XrViewConfigurationType)));
+            asio::write(msg_out.buffer, asio::buffer(&space, sizeof(std::uint64_t)));
+        }
+        if (space_prefetch) {
+            std::uint32_t space_count = static_cast<std::uint32_t>(spaces.size());
+            asio::write(msg_out.buffer, asio::buffer(&space_count, sizeof(std::uint32_t)));
+            for (auto [space, base_space] : spaces) {
+                std::uint64_t pair[2] = {handle_value(space), handle_value(base_space)};
+                asio::write(msg_out.buffer, asio::buffer(pair, sizeof(pair)));
+            }
+        }
+        if (tracker_sampling) {
+            std::uint32_t call_count = static_cast<std::uint32_t>(calls.size());
+            asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(std::uint32_t)));
+            for (const auto& [function_id, params] : calls) {
+                std::uint32_t params_size = static_cast<std::uint32_t>(params.size());
+                asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(std::uint32_t)));
+                asio::write(msg_out.buffer, asio::buffer(&params_size, sizeof(std::uint32_t)));
+                asio::write(msg_out.buffer, asio::buffer(params.data(), params.size()));
+            }
+        }
+        msg_out.flush();
+    }
+
+    ReceivedFrameState read_frame_state(MessageLockIn& msg_in) {
+        ReceivedFrameState frame_state{};
+        asio::read(msg_in.buffer, asio::buffer(&frame_state.session, sizeof(std::uint64_t)));
+        asio::read(msg_in.buffer, asio::buffer(&frame_state.result, sizeof(XrResult)));
+        asio::read(msg_in.buffer, asio::buffer(&frame_state.predicted_display_time, sizeof(XrTime)));
+        asio::read(msg_in.buffer, asio::buffer(&frame_state.predicted_display_period, sizeof(XrDuration)));
+        asio::read(msg_in.buffer, asio::buffer(&frame_state.should_render, sizeof(XrBool32)));
+        if (view_prefetch) {
+            std::uint8_t has_views{};
+            asio::read(msg_in.buffer, asio::buffer(&has_views, sizeof(std::uint8_t)));
+            frame_state.has_views = has_views;
+            if (has_views) {
+                asio::read(msg_in.buffer, asio::buffer(&frame_state.view_state_flags, sizeof(XrViewStateFlags)));
+                std::uint32_t view_count{};
+                asio::read(msg_in.buffer, asio::buffer(&view_count, sizeof(std::uint32_t)));
+                frame_state.views.resize(view_count);
+                for (auto& [pose, fov] : frame_state.views) {
+                    asio::read(msg_in.buffer, asio::buffer(&pose, sizeof(XrPosef)));
+                    asio::read(msg_in.buffer, asio::buffer(&fov, sizeof(XrFovf)));
+                }
+            }
+        }
+        if (space_prefetch) {
+            std::uint32_t location_count{};
+            asio::read(msg_in.buffer, asio::buffer(&location_count, sizeof(std::uint32_t)));
+            frame_state.locations.resize(location_count);
+            for (ReceivedLocation& location : frame_state.locations) {
+                asio::read(msg_in.buffer, asio::buffer(&location.result, sizeof(XrResult)));
+                asio::read(msg_in.buffer, asio::buffer(&location.location_flags, sizeof(XrSpaceLocationFlags)));
+                asio::read(msg_in.buffer, asio::buffer(&location.pose, sizeof(XrPosef)));
+            }
+        }
+        if (tracker_sampling) {
+            std::uint32_t sample_count{};
+            asio::read(msg_in.buffer, asio::buffer(&sample_count, sizeof(std::uint32_t)));
+            frame_state.samples.resize(sample_count);
+            for (std::vector<std::uint8_t>& sample : frame_state.samples) {
+                std::uint32_t sample_size{};
+                asio::read(msg_in.buffer, asio::buffer(&sample_size, sizeof(std::uint32_t)));
+                sample.resize(sample_size);
+                asio::read(msg_in.buffer, asio::buffer(sample.data(), sample.size()));
+            }
+        }
+        return frame_state;
+    }
+
+    ReceivedFrameState receive_frame_state() {
+        std::unique_lock<std::mutex> lock(mutex);
+        bool received = condition.wait_for(lock, std::chrono::seconds(5), [this]{ return !frame_states.empty(); });
+        REQUIRE(received);
+        ReceivedFrameState frame_state = std::move(frame_states.front());
+        frame_states.pop_front();
+        return frame_state;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Frame waiter sends the frame state of each speculative wait", "[frame_waiter]") {
+    FrameWaiterFixture fixture(false);
+
+    fixture.send_wait();
+    fixture.send_wait();
+    for (int frame = 1; frame <= 2; frame++) {
+        ReceivedFrameState frame_state = fixture.receive_frame_state();
+        CHECK(frame_state.session == handle_value(SESSION));
+        CHECK(frame_state.result == XR_SUCCESS);
+        CHECK(frame_state.predicted_display_time == DISPLAY_TIME + frame * DISPLAY_PERIOD);
+        CHECK(frame_state.predicted_display_period == DISPLAY_PERIOD);
+        CHECK(frame_state.should_render == XR_TRUE);
+    }
+
+    // the client reports the error of a failed wait
+    runtime.wait_result = XR_ERROR_RUNTIME_FAILURE;
+    fixture.send_wait();
+    CHECK(fixture.receive_frame_state().result == XR_ERROR_RUNTIME_FAILURE);
+    CHECK(runtime.wait_frame == 3);
+}
+
+TEST_CASE("Frame waiter locates the views at the display time of the frame", "[frame_waiter][views]") {
+    FrameWaiterFixture fixture(true);
+
+    fixture.send_wait(VIEW_SPACE);
+    ReceivedFrameState frame_state = fixture.receive_frame_state();
+    REQUIRE(frame_state.result == XR_SUCCESS);
+    CHECK(runtime.views_time == frame_state.predicted_display_time);
+    CHECK(runtime.views_space == VIEW_SPACE);
+    REQUIRE(frame_state.has_views);
+    CHECK(frame_state.view_state_flags == VIEW_STATE);
+    REQUIRE(frame_state.views.size() == 2);
+    for (std::size_t i = 0; i < 2; i++) {
+        CHECK(frame_state.views[i].first.position.x == static_cast<float>(i));
+        CHECK(frame_state.views[i].second.angleLeft == -1);
+    }
+    // size query and the views
+    CHECK(runtime.locate_views == 2);
+
+    // no views were asked for
+    fixture.send_wait();
+    frame_state = fixture.receive_frame_state();
+    CHECK(!frame_state.has_views);
+    CHECK(runtime.locate_views == 2);
+
+    // the client locates the views itself if the server couldn't
+    runtime.locate_views_result = XR_ERROR_RUNTIME_FAILURE;
+    fixture.send_wait(VIEW_SPACE);
+    frame_state = fixture.receive_frame_state();
+    CHECK(frame_state.result == XR_SUCCESS);
+    CHECK(!frame_state.has_views);
+
+    // or if the wait failed
+    runtime.locate_views_result = XR_SUCCESS;
+    runtime.wait_result = XR_ERROR_RUNTIME_FAILURE;
+    int located = runtime.locate_views;
+    fixture.send_wait(VIEW_SPACE);
+    frame_state = fixture.receive_frame_state();
+    CHECK(frame_state.result == XR_ERROR_RUNTIME_FAILURE);
+    CHECK(!frame_state.has_views);
+    CHECK(runtime.locate_views == located);
+}
+
+TEST_CASE("Frame waiter locates the spaces with one xrLocateSpaces per base space", "[frame_waiter][spaces]") {
+    FrameWaiterFixture fixture(false, true);
+
+    fixture.send_wait(XR_NULL_HANDLE, {
+        {LEFT_HAND, STAGE},
+        {LEFT_HAND, LOCAL},
+        {XR_NULL_HANDLE, XR_NULL_HANDLE}, // destroyed since the client sent it
+        {RIGHT_HAND, STAGE},
+    });
+    ReceivedFrameState frame_state = fixture.receive_frame_state();
+    CHECK(runtime.spaces_time == frame_state.predicted_display_time);
+    REQUIRE(runtime.locate_spaces_bases.size() == 2);
+    CHECK(runtime.locate_spaces_bases[0] == STAGE);
+    CHECK(runtime.locate_spaces_bases[1] == LOCAL);
+    CHECK(runtime.locate_space == 0);
+
+    REQUIRE(frame_state.locations.size() == 4);
+    CHECK(frame_state.locations[2].result == XR_ERROR_HANDLE_INVALID);
+    std::pair<XrSpace, XrSpace> located[] = {{LEFT_HAND, STAGE}, {LEFT_HAND, LOCAL}, {RIGHT_HAND, STAGE}};
+    std::size_t indices[] = {0, 1, 3};
+    for (std::size_t i = 0; i < 3; i++) {
+        const ReceivedLocation& location = frame_state.locations[indices[i]];
+        XrPosef pose = located_pose(located[i].first, located[i].second);
+        CHECK(location.result == XR_SUCCESS);
+        CHECK(location.location_flags == XR_SPACE_LOCATION_POSITION_VALID_BIT);
+        CHECK(location.pose.position.x == pose.position.x);
+        CHECK(location.pose.position.z == pose.position.z);
+    }
+
+    // nothing to locate
+    fixture.send_wait();
+    frame_state = fixture.receive_frame_state();
+    CHECK(frame_state.locations.empty());
+    CHECK(runtime.locate_spaces_bases.size() == 2);
+}
+
+TEST_CASE("Frame waiter locates the spaces one at a time without xrLocateSpaces", "[frame_waiter][spaces]") {
+    FrameWaiterFixture fixture(false, true);
+    runtime.has_locate_spaces = false;
+
+    fixture.send_wait(XR_NULL_HANDLE, {
+        {LEFT_HAND, STAGE},
+        {XR_NULL_HANDLE, XR_NULL_HANDLE},
+        {RIGHT_HAND, LOCAL},
+    });
+    ReceivedFrameState frame_state = fixture.receive_frame_state();
+    CHECK(runtime.spaces_time == frame_state.predicted_display_time);
+    CHECK(runtime.locate_space == 2);
+    CHECK(runtime.locate_spaces_bases.empty());
+
+    REQUIRE(frame_state.locations.size() == 3);
+    CHECK(frame_state.locations[0].result == XR_SUCCESS);
+    CHECK(frame_state.locations[0].pose.position.x == located_pose(LEFT_HAND, STAGE).position.x);
+    CHECK(frame_state.locations[1].result == XR_ERROR_HANDLE_INVALID);
+    CHECK(frame_state.locations[2].result == XR_SUCCESS);
+    CHECK(frame_state.locations[2].pose.position.z == located_pose(RIGHT_HAND, LOCAL).position.z);
+
+    // xrLocateSpaces isn't looked up again
+    runtime.has_locate_spaces = true;
+    fixture.send_wait(XR_NULL_HANDLE, {{LEFT_HAND, STAGE}});
+    frame_state = fixture.receive_frame_state();
+    CHECK(runtime.locate_space == 3);
+    CHECK(runtime.locate_spaces_bases.empty());
+}
+
+TEST_CASE("Frame waiter sends an empty sample for calls it can't make", "[frame_waiter][sampling]") {
+    FrameWaiterFixture fixture(false, false, true);
+
+    // xrLocateHandJointsEXT isn't in the runtime, and the params are cut short
+    std::uint64_t tracker = 0x500;
+    std::vector<std::uint8_t> params(sizeof(std::uint64_t));
+    std::memcpy(params.data(), &tracker, sizeof(std::uint64_t));
+    fixture.send_wait(XR_NULL_HANDLE, {}, {
+        {UNKNOWN_FUNCTION, {}},
+        {LOCATE_HAND_JOINTS, params},
+        {UNKNOWN_FUNCTION, params},
+    });
+    ReceivedFrameState frame_state = fixture.receive_frame_state();
+    CHECK(frame_state.result == XR_SUCCESS);
+    REQUIRE(frame_state.samples.size() == 3);
+    for (const std::vector<std::uint8_t>& sample : frame_state.samples) {
+        CHECK(sample.empty());
+    }
+
+    // the next frame isn't held up by them
+    fixture.send_wait();
+    frame_state = fixture.receive_frame_state();
+    CHECK(frame_state.result == XR_SUCCESS);
+    CHECK(frame_state.samples.empty());
+    CHECK(runtime.wait_frame == 2);
+}
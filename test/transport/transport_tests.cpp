@@ -4,6 +4,7 @@
 #include <catch2/catch_section_info.hpp>
 
 #include "xrtransport/transport/transport.h"
+#include "xrtransport/time.h"
 #include "test_duplex_stream.h"
 
 #include "asio/io_context.hpp"
@@ -22,7 +23,9 @@
 #include <atomic>
 #include <future>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 using namespace xrtransport;
 using namespace xrtransport::test;
@@ -305,4 +308,106 @@ TEST_CASE("await_message handler takeover", "[transport][async]") {
 
     transport_b.join();
     transport_a.join();
-}
\ No newline at end of file
+}
+
+TEST_CASE("Call batch round trip", "[transport][batch]") {
+    asio::io_context io_context;
+    auto [stream_a, stream_b] = create_connected_streams(io_context);
+    Transport transport_a(std::move(stream_a));
+    Transport transport_b(std::move(stream_b));
+    transport_a.start();
+    transport_b.start();
+
+    // answers each call with its function id followed by its params
+    transport_b.register_handler(XRTP_MSG_FUNCTION_CALL_BATCH, [&](MessageLockIn msg_in){
+        uint32_t call_count{};
+        asio::read(msg_in.buffer, asio::buffer(&call_count, sizeof(call_count)));
+        auto msg_out = transport_b.start_message(XRTP_MSG_FUNCTION_RETURN_BATCH);
+        asio::write(msg_out.buffer, asio::buffer(&call_count, sizeof(call_count)));
+        for (uint32_t i = 0; i < call_count; i++) {
+            uint32_t function_id{};
+            uint32_t size{};
+            asio::read(msg_in.buffer, asio::buffer(&function_id, sizeof(function_id)));
+            asio::read(msg_in.buffer, asio::buffer(&size, sizeof(size)));
+            std::vector<uint8_t> params(size);
+            asio::read(msg_in.buffer, asio::buffer(params.data(), params.size()));
+
+            uint32_t result_size = static_cast<uint32_t>(sizeof(function_id) + size);
+            asio::write(msg_out.buffer, asio::buffer(&result_size, sizeof(result_size)));
+            asio::write(msg_out.buffer, asio::buffer(&function_id, sizeof(function_id)));
+            asio::write(msg_out.buffer, asio::buffer(params.data(), params.size()));
+        }
+        msg_out.flush();
+    });
+
+    uint64_t first_params = 0x1122334455667788;
+    uint8_t second_params[3] = {1, 2, 3};
+
+    auto batch = transport_a.begin_batch();
+    batch.append_call(30, &first_params, sizeof(first_params));
+    batch.append_call(41, second_params, sizeof(second_params));
+    batch.append_call(49, nullptr, 0);
+    REQUIRE_THROWS_AS(batch.get_result(0), TransportException);
+    batch.submit();
+    REQUIRE_THROWS_AS(batch.submit(), TransportException);
+
+    asio::const_buffer first = batch.get_result(0);
+    REQUIRE(first.size() == sizeof(uint32_t) + sizeof(first_params));
+    uint32_t function_id{};
+    uint64_t value{};
+    std::memcpy(&function_id, first.data(), sizeof(function_id));
+    std::memcpy(&value, static_cast<const uint8_t*>(first.data()) + sizeof(function_id), sizeof(value));
+    REQUIRE(function_id == 30);
+    REQUIRE(value == first_params);
+
+    asio::const_buffer second = batch.get_result(1);
+    REQUIRE(second.size() == sizeof(uint32_t) + sizeof(second_params));
+    REQUIRE(std::memcmp(static_cast<const uint8_t*>(second.data()) + sizeof(uint32_t), second_params, sizeof(second_params)) == 0);
+
+    asio::const_buffer third = batch.get_result(2);
+    REQUIRE(third.size() == sizeof(uint32_t));
+    std::memcpy(&function_id, third.data(), sizeof(function_id));
+    REQUIRE(function_id == 49);
+
+    REQUIRE_THROWS_AS(batch.get_result(3), TransportException);
+
+    transport_a.shutdown();
+    transport_a.join();
+    transport_b.join();
+}
+TEST_CASE("Receive time is stamped on arrival", "[transport][sync]") {
+    asio::io_context io_context;
+    auto [stream_a, stream_b] = create_connected_streams(io_context);
+    Transport transport_a(std::move(stream_a));
+    Transport transport_b(std::move(stream_b));
+    transport_a.start();
+    transport_b.start();
+
+    std::int64_t sent_time{};
+    std::int64_t receive_time{};
+    std::int64_t handled_time{};
+    {
+        // keep transport b from handling the message until it waited in the queue for a while
+        auto b_lock = transport_b.acquire_message_lock();
+
+        sent_time = get_time();
+        {
+            auto msg_out = transport_a.start_message(100);
+            uint32_t value = 1000;
+            asio::write(msg_out.buffer, asio::buffer(&value, sizeof(value)));
+            msg_out.flush();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        auto msg_in = transport_b.await_message(100);
+        handled_time = get_time();
+        receive_time = msg_in.get_receive_time();
+    }
+
+    transport_a.shutdown();
+    transport_a.join();
+    transport_b.join();
+
+    REQUIRE(receive_time >= sent_time);
+    REQUIRE(handled_time - receive_time >= 40'000'000);
+}